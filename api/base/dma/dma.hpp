@@ -283,6 +283,85 @@ public:
    */
   virtual ~Dma() {}
 };
+
+/**
+ * @brief DMA 通道池 (pt_dma 句柄中断接入)
+ *
+ * @note  Dma 与 pt_dma 句柄从同一通道池分配16个数据流 (pt_dma_channel_alloc);
+ *        数据流中断向量由 Dma_Base 统一定义，pt_dma 句柄创建后需经 attach() 将所在数据流的中断
+ *        转发至 pt_dma_irq_handler()，删除句柄前调用 detach()
+ */
+class Dma_Pool final : private interrupt::Interrupt_Device
+{
+  // 禁止拷贝和移动
+  QAQ_NO_COPY_MOVE(Dma_Pool)
+
+private:
+  /// @brief DMA 基类 类型声明
+  using Dma_Base = base_internal::dma_internal::Dma_Base;
+
+  /**
+   * @brief  DMA 通道池 获取句柄所在通道编号
+   *
+   * @param  handle   pt_dma 句柄
+   * @return uint8_t  通道编号 (0~7 为 DMA1，8~15 为 DMA2)
+   */
+  static uint8_t channel_of(const PT_DMA* handle)
+  {
+    return static_cast<uint8_t>(((DMA2 == handle->pt_dma_ptr) ? Dma_Base::MAX_CHANNEL / 2 : 0) + handle->pt_dma_stream_number);
+  }
+
+  /**
+   * @brief  DMA 通道池 中断转发函数
+   *
+   * @param  arg  pt_dma 句柄
+   */
+  static void irq_handler(interrupt::Interrupt_Args_t arg, uint8_t)
+  {
+    pt_dma_irq_handler(static_cast<PT_DMA*>(arg));
+  }
+
+public:
+  /**
+   * @brief  DMA 通道池 接入 pt_dma 句柄中断
+   *
+   * @param  handle       已创建的 pt_dma 句柄
+   * @param  priority     中断优先级
+   * @param  subpriority  中断子优先级
+   * @return true         成功
+   * @return false        句柄未创建或中断注册失败
+   */
+  static bool attach(PT_DMA* handle, uint32_t priority = 0, uint32_t subpriority = 0)
+  {
+    bool ret = false;
+
+    if (nullptr != handle && (DMA1 == handle->pt_dma_ptr || DMA2 == handle->pt_dma_ptr))
+    {
+      ret = register_device(Dma_Base::get_interrupt_channel(channel_of(handle)), irq_handler, nullptr, handle, priority, subpriority);
+    }
+
+    return ret;
+  }
+
+  /**
+   * @brief  DMA 通道池 断开 pt_dma 句柄中断
+   *
+   * @param  handle  pt_dma 句柄
+   * @return true    成功
+   * @return false   句柄未创建或中断注销失败
+   */
+  static bool detach(PT_DMA* handle)
+  {
+    bool ret = false;
+
+    if (nullptr != handle && (DMA1 == handle->pt_dma_ptr || DMA2 == handle->pt_dma_ptr))
+    {
+      ret = unregister_device(Dma_Base::get_interrupt_channel(channel_of(handle)));
+    }
+
+    return ret;
+  }
+};
 } /* namespace dma */
 } /* namespace base */
 } /* namespace QAQ */
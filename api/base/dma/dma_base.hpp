@@ -5,6 +5,8 @@
 #include "stm32h7xx_ll_rcc.h"
 #include "stm32h7xx_ll_dma.h"
 #include "interrupt.hpp"
+#include "dma_define.hpp"
+#include "hardware/inc/pt_dma_api.h"
 
 /// @brief 名称空间 QAQ
 namespace QAQ
@@ -15,64 +17,7 @@ namespace base
 /// @brief 名称空间 DMA
 namespace dma
 {
-/// @brief 回调函数参数类型
-using Dma_Callback_Args_t = void*;
-/// @brief 回调函数类型
-using Dma_Callback_Func_t = void (*)(Dma_Callback_Args_t);
-
-/**
- * @brief DMA 数据传输方向
- */
-enum class Dma_Direction : uint8_t
-{
-  Memory_To_Memory,     /* 内存到内存 */
-  Peripheral_To_Memory, /* 外设到内存 */
-  Memory_To_Peripheral, /* 内存到外设 */
-};
-
-/**
- * @brief DMA 模式
- */
-enum class Dma_Mode : uint8_t
-{
-  Normal,        /* 正常模式 */
-  Cyclic,        /* 循环模式 */
-  Double_Buffer, /* 双缓冲模式 */
-};
-
-/**
- * @brief DMA 优先级
- */
-enum class Dma_Priority : uint8_t
-{
-  Low,       /* 低优先级 */
-  Medium,    /* 中等优先级 */
-  High,      /* 高优先级 */
-  Very_High, /* 非常高优先级 */
-};
-
-/**
- * @brief DMA 数据位大小
- */
-enum class Dma_Data_Size : uint8_t
-{
-  Byte,      /*  8bit 比特 */
-  Half_Word, /* 16bit 半字节 */
-  Word       /* 32bit 字节 */
-};
-
-/**
- * @brief DMA 错误码
- */
-enum class Dma_Error_Code : uint8_t
-{
-  OK,                   /* 正常 */
-  NO_AVAILABLE_CHANNEL, /* 没有可用的通道 */
-  CHANNEL_NOT_OPEN,     /* 通道未打开 */
-  CHANNEL_NOT_STOPPED,  /* 通道未停止 */
-  ALREADY_OPENED,       /* 通道已打开 */
-  ERROR,                /* 错误 */
-};
+class Dma_Pool;
 
 /**
  * @brief  DMA 通道配置 模版类
@@ -326,6 +271,8 @@ class Dma_Base : public interrupt::Interrupt_Device
   // 禁止拷贝和移动
   QAQ_NO_COPY_MOVE(Dma_Base)
 
+  friend class dma::Dma_Pool;
+
 protected:
   /// @brief DMA 通道 类型声明
   using Dma_Reg        = DMA_TypeDef*;
@@ -381,8 +328,6 @@ private:
 
   /// @brief DMA 回调数据结构体数组
   static inline Dma_Callback_Data m_callback_data[MAX_CHANNEL]                      = { 0 };
-  /// @brief DMA 通道激活标志
-  static inline uint16_t          m_activate_channel_flag                           = 0;
 
   /// @brief DMA 当前通道编号
   int8_t   m_channel                                                                = -1;
@@ -528,6 +473,8 @@ protected:
   /**
    * @brief  DMA 基类 分配通道
    *
+   * @note   与 pt_dma 通道 API 共用同一通道池，可在中断中调用
+   *
    * @return true  分配成功
    * @return false 分配失败
    */
@@ -537,18 +484,11 @@ protected:
 
     if (m_channel == -1)
     {
-      for (uint8_t i = 0; i < MAX_CHANNEL; i++)
-      {
-        if ((m_activate_channel_flag & (1 << i)) == 0)
-        {
-          m_channel                = i;
-          m_activate_channel_flag |= (1 << i);
-          break;
-        }
-      }
+      uint32_t channel = 0;
 
-      if (m_channel != -1)
+      if (PT_SUCCEED == pt_dma_channel_alloc(&channel))
       {
+        m_channel = static_cast<int8_t>(channel);
         update_channel(m_channel);
         ret = true;
       }
@@ -568,16 +508,12 @@ protected:
   {
     if (m_channel != -1)
     {
-      m_activate_channel_flag &= ~(1 << m_channel);
-      m_channel                = -1;
-      m_dma                    = nullptr;
-      m_stream                 = 0;
-    }
-    else
-    {
-      m_dma    = nullptr;
-      m_stream = 0;
+      pt_dma_channel_free(static_cast<uint32_t>(m_channel));
+      m_channel = -1;
     }
+
+    m_dma    = nullptr;
+    m_stream = 0;
   }
 
   /**
@@ -673,8 +609,6 @@ public:
     return transferred_size;
   }
 
-  void set
-
   /**
    * @brief  DMA 类 关闭传输
    *
@@ -705,6 +639,36 @@ public:
     return error_code;
   }
 
+  /**
+   * @brief  DMA 类 设置内存地址自增 (关闭数据流后修改，下一次 start() 生效)
+   *
+   * @note   用于外设收发固定填充字节或丢弃数据等场景
+   *
+   * @param  enable          是否自增
+   * @return Dma_Error_Code  DMA 错误码
+   */
+  Dma_Error_Code set_memory_increment(bool enable)
+  {
+    Dma_Error_Code error_code = Dma_Error_Code::OK;
+
+    if (State::CLOSEED == m_state)
+    {
+      error_code = Dma_Error_Code::CHANNEL_NOT_OPEN;
+    }
+    else
+    {
+      LL_DMA_DisableStream(get_dma(), get_stream());
+
+      while (LL_DMA_IsEnabledStream(get_dma(), get_stream()))
+      {
+      }
+
+      LL_DMA_SetMemoryIncMode(get_dma(), get_stream(), enable ? LL_DMA_MEMORY_INCREMENT : LL_DMA_MEMORY_NOINCREMENT);
+    }
+
+    return error_code;
+  }
+
   /**
    * @brief  DMA 类 恢复传输
    *
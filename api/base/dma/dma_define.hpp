@@ -0,0 +1,77 @@
+#ifndef __DMA_DEFINE_HPP__
+#define __DMA_DEFINE_HPP__
+
+#include "fast_memory_port.hpp"
+
+/// @brief 名称空间 QAQ
+namespace QAQ
+{
+/// @brief 名称空间 基本对象
+namespace base
+{
+/// @brief 名称空间 DMA
+namespace dma
+{
+/// @brief 回调函数参数类型
+using Dma_Callback_Args_t = void*;
+/// @brief 回调函数类型
+using Dma_Callback_Func_t = void (*)(Dma_Callback_Args_t);
+
+/**
+ * @brief DMA 数据传输方向
+ */
+enum class Dma_Direction : uint8_t
+{
+  Memory_To_Memory,     /* 内存到内存 */
+  Peripheral_To_Memory, /* 外设到内存 */
+  Memory_To_Peripheral, /* 内存到外设 */
+};
+
+/**
+ * @brief DMA 模式
+ */
+enum class Dma_Mode : uint8_t
+{
+  Normal,        /* 正常模式 */
+  Cyclic,        /* 循环模式 */
+  Double_Buffer, /* 双缓冲模式 */
+};
+
+/**
+ * @brief DMA 优先级
+ */
+enum class Dma_Priority : uint8_t
+{
+  Low,       /* 低优先级 */
+  Medium,    /* 中等优先级 */
+  High,      /* 高优先级 */
+  Very_High, /* 非常高优先级 */
+};
+
+/**
+ * @brief DMA 数据位大小
+ */
+enum class Dma_Data_Size : uint8_t
+{
+  Byte,      /*  8bit 比特 */
+  Half_Word, /* 16bit 半字节 */
+  Word       /* 32bit 字节 */
+};
+
+/**
+ * @brief DMA 错误码
+ */
+enum class Dma_Error_Code : uint8_t
+{
+  OK,                   /* 正常 */
+  NO_AVAILABLE_CHANNEL, /* 没有可用的通道 */
+  CHANNEL_NOT_OPEN,     /* 通道未打开 */
+  CHANNEL_NOT_STOPPED,  /* 通道未停止 */
+  ALREADY_OPENED,       /* 通道已打开 */
+  ERROR,                /* 错误 */
+};
+} /* namespace dma */
+} /* namespace base */
+} /* namespace QAQ */
+
+#endif /* __DMA_DEFINE_HPP__ */
@@ -0,0 +1,433 @@
+#ifndef __MDMA_HPP__
+#define __MDMA_HPP__
+
+#include "dma_base.hpp"
+#include "mdma_chain.hpp"
+
+/// @brief 名称空间 QAQ
+namespace QAQ
+{
+/// @brief 名称空间 基本对象
+namespace base
+{
+/// @brief 名称空间 DMA
+namespace dma
+{
+/**
+ * @brief MDMA 通道 (链表分散/聚集传输)
+ *
+ * @note  16个通道按需分配，共用 MDMA 全局中断 (首个通道打开时注册，最后一个关闭时注销);
+ *        一次软件请求执行整条链表，每个节点完成产生 Block 事件，末节点后产生 Complete 事件;
+ *        节点完成标志可能合并，Block 事件按节点顺序补发，Complete 前保证全部节点已上报;
+ *        启动时清除节点与源数据缓存、清除并失效目标缓存，节点上报前再次失效该节点的目标缓存
+ *        (传输期间的预取可能填入旧数据，目标缓存区应按缓存行对齐)
+ */
+class Mdma final : private interrupt::Interrupt_Device
+{
+  // 禁止拷贝和移动
+  QAQ_NO_COPY_MOVE(Mdma)
+
+private:
+  /// @brief MDMA 最大通道数
+  static constexpr uint8_t  MAX_CHANNEL    = 16;
+  /// @brief MDMA 通道寄存器间隔
+  static constexpr uint32_t CHANNEL_STRIDE = 0x40;
+  /// @brief MDMA 通道标志
+  static constexpr uint32_t CHANNEL_FLAGS  = MDMA_CISR_TEIF | MDMA_CISR_CTCIF | MDMA_CISR_BRTIF | MDMA_CISR_BTIF | MDMA_CISR_TCIF;
+
+  /// @brief MDMA 通道所有者
+  static inline Mdma*     m_owner[MAX_CHANNEL] = {};
+  /// @brief MDMA 通道占用位图
+  static inline uint16_t  m_used               = 0;
+
+  /// @brief 通道编号
+  int8_t                  m_channel            = -1;
+  /// @brief 通道寄存器
+  MDMA_Channel_TypeDef*   m_reg                = nullptr;
+  /// @brief 通道优先级
+  Dma_Priority            m_priority           = Dma_Priority::Medium;
+  /// @brief 当前链表
+  Mdma_Chain_View         m_view               = {};
+  /// @brief 回调函数
+  Mdma_Callback_Func_t    m_function           = nullptr;
+  /// @brief 回调函数参数
+  void*                   m_arg                = nullptr;
+  /// @brief 已上报的节点数
+  uint32_t                m_reported           = 0;
+  /// @brief 是否传输中
+  volatile bool           m_busy               = false;
+  /// @brief 统计信息
+  Mdma_Stats              m_stats              = {};
+
+  /**
+   * @brief  MDMA 通道 获取通道寄存器
+   *
+   * @param  channel                 通道编号
+   * @return MDMA_Channel_TypeDef*   通道寄存器
+   */
+  static MDMA_Channel_TypeDef* channel_reg(uint8_t channel)
+  {
+    return reinterpret_cast<MDMA_Channel_TypeDef*>(MDMA_Channel0_BASE + CHANNEL_STRIDE * channel);
+  }
+
+  /**
+   * @brief  MDMA 通道 全局中断处理函数
+   */
+  static void irq_handler(interrupt::Interrupt_Args_t, uint8_t)
+  {
+    uint32_t pending = MDMA->GISR0 & 0xFFFFU;
+
+    while (0 != pending)
+    {
+      const uint8_t channel  = static_cast<uint8_t>(__builtin_ctz(pending));
+      pending               &= pending - 1;
+
+      if (nullptr != m_owner[channel])
+      {
+        m_owner[channel]->service();
+      }
+      else
+      {
+        channel_reg(channel)->CIFCR = CHANNEL_FLAGS;
+      }
+    }
+  }
+
+  /**
+   * @brief  MDMA 通道 获取当前装载的节点序号 (已装载节点之前的节点均已完成)
+   *
+   * @return uint32_t  节点序号
+   */
+  uint32_t loaded_node(void) const
+  {
+    const uint32_t link = m_reg->CLAR;
+    uint32_t       ret  = m_view.count - 1;
+
+    if (0 != link)
+    {
+      ret = (link - static_cast<uint32_t>(reinterpret_cast<uintptr_t>(m_view.nodes))) / sizeof(Mdma_Node) - 1;
+    }
+
+    return ret;
+  }
+
+  /**
+   * @brief  MDMA 通道 按顺序上报已完成的节点 (上报前失效节点目标缓存)
+   *
+   * @param  end  上报至该序号 (不含)
+   */
+  void report(uint32_t end)
+  {
+    namespace port = system::system_internal::memory_internal::port;
+
+    while (m_reported < end)
+    {
+      port::cache_invalidate(m_view.segments[m_reported].dest, m_view.segments[m_reported].size);
+
+      ++m_stats.blocks;
+      m_stats.bytes += m_view.segments[m_reported].size;
+
+      if (nullptr != m_function)
+      {
+        m_function(m_arg, m_reported, Mdma_Event::Block);
+      }
+
+      ++m_reported;
+    }
+  }
+
+  /**
+   * @brief  MDMA 通道 中断服务 (清除标志后回调，Complete/Error 回调中可直接启动下一条链表)
+   */
+  void service(void)
+  {
+    const uint32_t flags = m_reg->CISR & CHANNEL_FLAGS;
+    m_reg->CIFCR         = flags;
+
+    if (0 != (flags & MDMA_CISR_TEIF))
+    {
+      const uint32_t node  = loaded_node();
+      m_reg->CCR          &= ~MDMA_CCR_EN;
+
+      report(node);
+      ++m_stats.errors;
+      m_busy = false;
+
+      if (nullptr != m_function)
+      {
+        m_function(m_arg, node, Mdma_Event::Error);
+      }
+    }
+    else if (0 != (flags & MDMA_CISR_CTCIF))
+    {
+      report(m_view.count);
+      ++m_stats.chains;
+      m_busy = false;
+
+      if (nullptr != m_function)
+      {
+        m_function(m_arg, m_view.count - 1, Mdma_Event::Complete);
+      }
+    }
+    else if (0 != (flags & MDMA_CISR_BTIF))
+    {
+      report(loaded_node());
+    }
+  }
+
+public:
+  /**
+   * @brief  MDMA 通道 构造函数
+   */
+  explicit Mdma() {}
+
+  /**
+   * @brief  MDMA 通道 打开 (分配通道)
+   *
+   * @param  priority         通道优先级
+   * @param  irq_priority     MDMA 中断优先级 (仅首个通道打开时生效)
+   * @param  irq_subpriority  MDMA 中断子优先级 (仅首个通道打开时生效)
+   * @return Dma_Error_Code   DMA 错误码
+   */
+  Dma_Error_Code open(Dma_Priority priority = Dma_Priority::Medium, uint32_t irq_priority = 0, uint32_t irq_subpriority = 0)
+  {
+    Dma_Error_Code error_code = Dma_Error_Code::OK;
+    bool           first      = false;
+
+    if (-1 != m_channel)
+    {
+      error_code = Dma_Error_Code::ALREADY_OPENED;
+    }
+    else
+    {
+      {
+        system::kernel::Interrupt_Guard guard;
+
+        const uint32_t free = static_cast<uint16_t>(~m_used);
+
+        if (0 != free)
+        {
+          m_channel           = static_cast<int8_t>(__builtin_ctz(free));
+          first               = (0 == m_used);
+          m_used             |= static_cast<uint16_t>(1U << m_channel);
+          m_owner[m_channel]  = this;
+        }
+      }
+
+      if (-1 == m_channel)
+      {
+        error_code = Dma_Error_Code::NO_AVAILABLE_CHANNEL;
+      }
+      else
+      {
+        LL_AHB3_GRP1_EnableClock(LL_AHB3_GRP1_PERIPH_MDMA);
+
+        m_reg        = channel_reg(static_cast<uint8_t>(m_channel));
+        m_priority   = priority;
+        m_busy       = false;
+        m_reg->CCR   = 0;
+        m_reg->CIFCR = CHANNEL_FLAGS;
+
+        if (first && !register_device(MDMA_IRQn, irq_handler, nullptr, nullptr, irq_priority, irq_subpriority))
+        {
+          close();
+          error_code = Dma_Error_Code::ERROR;
+        }
+      }
+    }
+
+    return error_code;
+  }
+
+  /**
+   * @brief  MDMA 通道 启动链表传输
+   *
+   * @param  chain           链表视图 (完成回调前不可修改)
+   * @param  function        回调函数 (中断中执行)
+   * @param  arg             回调函数参数
+   * @return Dma_Error_Code  DMA 错误码
+   */
+  Dma_Error_Code start(const Mdma_Chain_View& chain, Mdma_Callback_Func_t function, void* arg)
+  {
+    Dma_Error_Code error_code = Dma_Error_Code::OK;
+
+    if (-1 == m_channel)
+    {
+      error_code = Dma_Error_Code::CHANNEL_NOT_OPEN;
+    }
+    else if (m_busy)
+    {
+      error_code = Dma_Error_Code::CHANNEL_NOT_STOPPED;
+    }
+    else if (0 == chain.count)
+    {
+      error_code = Dma_Error_Code::ERROR;
+    }
+    else
+    {
+      namespace port = system::system_internal::memory_internal::port;
+
+      port::cache_clean(chain.nodes, chain.count * sizeof(Mdma_Node));
+
+      for (uint32_t i = 0; i < chain.count; ++i)
+      {
+        port::cache_clean(chain.segments[i].src, chain.segments[i].size);
+        port::cache_clean_invalidate(chain.segments[i].dest, chain.segments[i].size);
+      }
+
+      m_view       = chain;
+      m_function   = function;
+      m_arg        = arg;
+      m_reported   = 0;
+      m_busy       = true;
+
+      const Mdma_Node& first = chain.nodes[0];
+
+      m_reg->CIFCR  = CHANNEL_FLAGS;
+      m_reg->CTCR   = first.ctcr;
+      m_reg->CBNDTR = first.cbndtr;
+      m_reg->CSAR   = first.csar;
+      m_reg->CDAR   = first.cdar;
+      m_reg->CBRUR  = first.cbrur;
+      m_reg->CLAR   = first.clar;
+      m_reg->CTBR   = first.ctbr;
+      m_reg->CMAR   = first.cmar;
+      m_reg->CMDR   = first.cmdr;
+      m_reg->CCR    = (static_cast<uint32_t>(m_priority) << MDMA_CCR_PL_Pos) | MDMA_CCR_TEIE | MDMA_CCR_CTCIE | MDMA_CCR_BTIE;
+
+      port::sync_barrier();
+
+      m_reg->CCR   |= MDMA_CCR_EN;
+      m_reg->CCR   |= MDMA_CCR_SWRQ;
+    }
+
+    return error_code;
+  }
+
+  /**
+   * @brief  MDMA 通道 启动链表传输
+   *
+   * @tparam Max_Nodes       链表最大节点数
+   * @param  chain           链表 (完成回调前不可修改)
+   * @param  function        回调函数 (中断中执行)
+   * @param  arg             回调函数参数
+   * @return Dma_Error_Code  DMA 错误码
+   */
+  template <uint32_t Max_Nodes>
+  Dma_Error_Code start(const Mdma_Chain<Max_Nodes>& chain, Mdma_Callback_Func_t function, void* arg)
+  {
+    return start(chain.view(), function, arg);
+  }
+
+  /**
+   * @brief  MDMA 通道 中止传输 (不产生回调)
+   *
+   * @return Dma_Error_Code  DMA 错误码
+   */
+  Dma_Error_Code stop(void)
+  {
+    Dma_Error_Code error_code = Dma_Error_Code::OK;
+
+    if (-1 == m_channel)
+    {
+      error_code = Dma_Error_Code::CHANNEL_NOT_OPEN;
+    }
+    else
+    {
+      m_reg->CCR &= ~(MDMA_CCR_TEIE | MDMA_CCR_CTCIE | MDMA_CCR_BTIE);
+      m_reg->CCR &= ~MDMA_CCR_EN;
+
+      while (0 != (m_reg->CCR & MDMA_CCR_EN))
+      {
+      }
+
+      m_reg->CIFCR = CHANNEL_FLAGS;
+      m_busy       = false;
+    }
+
+    return error_code;
+  }
+
+  /**
+   * @brief  MDMA 通道 关闭 (释放通道)
+   *
+   * @return Dma_Error_Code  DMA 错误码
+   */
+  Dma_Error_Code close(void)
+  {
+    Dma_Error_Code error_code = Dma_Error_Code::OK;
+    bool           last       = false;
+
+    if (-1 == m_channel)
+    {
+      error_code = Dma_Error_Code::CHANNEL_NOT_OPEN;
+    }
+    else
+    {
+      stop();
+
+      {
+        system::kernel::Interrupt_Guard guard;
+
+        m_owner[m_channel]  = nullptr;
+        m_used             &= static_cast<uint16_t>(~(1U << m_channel));
+        last                = (0 == m_used);
+      }
+
+      if (last)
+      {
+        unregister_device(MDMA_IRQn);
+      }
+
+      m_channel = -1;
+      m_reg     = nullptr;
+    }
+
+    return error_code;
+  }
+
+  /**
+   * @brief  MDMA 通道 是否传输中
+   *
+   * @return true   传输中
+   * @return false  空闲
+   */
+  bool busy(void) const noexcept
+  {
+    return m_busy;
+  }
+
+  /**
+   * @brief  MDMA 通道 获取统计信息
+   *
+   * @return Mdma_Stats  统计信息
+   */
+  Mdma_Stats stats(void) const noexcept
+  {
+    return m_stats;
+  }
+
+  /**
+   * @brief  MDMA 通道 清零统计信息
+   */
+  void reset_stats(void) noexcept
+  {
+    m_stats = {};
+  }
+
+  /**
+   * @brief  MDMA 通道 析构函数
+   */
+  ~Mdma()
+  {
+    close();
+  }
+};
+} /* namespace dma */
+} /* namespace base */
+} /* namespace QAQ */
+
+/* ------- 注册中断函数 ------- */
+INTERRUPT_HANDLER(MDMA)
+
+#endif /* __MDMA_HPP__ */
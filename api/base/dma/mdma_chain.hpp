@@ -0,0 +1,287 @@
+#ifndef __MDMA_CHAIN_HPP__
+#define __MDMA_CHAIN_HPP__
+
+#include "dma_define.hpp"
+
+/// @brief 名称空间 QAQ
+namespace QAQ
+{
+/// @brief 名称空间 基本对象
+namespace base
+{
+/// @brief 名称空间 DMA
+namespace dma
+{
+/**
+ * @brief MDMA 链表节点 (与 MDMA 通道寄存器 CTCR~CMDR 布局一致，硬件按 CLAR 自动装载下一节点)
+ */
+struct alignas(8) Mdma_Node
+{
+  uint32_t ctcr;     /* 传输配置 */
+  uint32_t cbndtr;   /* 块数据长度 */
+  uint32_t csar;     /* 源地址 */
+  uint32_t cdar;     /* 目标地址 */
+  uint32_t cbrur;    /* 块重复地址更新 */
+  uint32_t clar;     /* 下一节点地址 (0 为末节点) */
+  uint32_t ctbr;     /* 触发与总线选择 */
+  uint32_t reserved; /* 保留 */
+  uint32_t cmar;     /* 掩码地址 */
+  uint32_t cmdr;     /* 掩码数据 */
+};
+
+static_assert(40 == sizeof(Mdma_Node), "MDMA node must match the channel register layout");
+
+/**
+ * @brief MDMA 链表分段 (节点对应的CPU侧视图，用于缓存维护与仿真)
+ */
+struct Mdma_Segment
+{
+  void*       dest; /* 目标地址 */
+  const void* src;  /* 源地址 */
+  uint32_t    size; /* 大小 (字节) */
+};
+
+/**
+ * @brief MDMA 链表视图 (类型擦除，供通道启动)
+ */
+struct Mdma_Chain_View
+{
+  const Mdma_Node*    nodes;    /* 节点数组 */
+  const Mdma_Segment* segments; /* 分段数组 */
+  uint32_t            count;    /* 节点数 */
+};
+
+/**
+ * @brief MDMA 事件
+ */
+enum class Mdma_Event : uint8_t
+{
+  Block,    /* 单个节点传输完成 */
+  Complete, /* 整条链表传输完成 */
+  Error,    /* 传输错误 (链表终止) */
+};
+
+/// @brief MDMA 回调函数类型 (中断中执行; 参数: 回调参数、节点序号、事件)
+using Mdma_Callback_Func_t = void (*)(void*, uint32_t, Mdma_Event);
+
+/**
+ * @brief MDMA 统计信息
+ */
+struct Mdma_Stats
+{
+  uint32_t chains; /* 完成的链表数 */
+  uint32_t blocks; /* 完成的节点数 */
+  uint32_t bytes;  /* 传输字节数 */
+  uint32_t errors; /* 错误次数 */
+};
+} /* namespace dma */
+
+/// @brief 名称空间 内部
+namespace base_internal
+{
+/// @brief 名称空间 DMA 内部
+namespace dma_internal
+{
+/// @brief MDMA 单节点最大字节数 (CBNDTR.BNDT 为17位)
+inline constexpr uint32_t MDMA_MAX_BLOCK     = 0x10000;
+/// @brief MDMA 缓冲传输长度 (TLEN+1，字节)
+inline constexpr uint32_t MDMA_BUFFER_LENGTH = 128;
+
+/// @brief CTCR 源地址自增 (SINC = 10)
+inline constexpr uint32_t MDMA_NODE_SINC     = 2U << 0;
+/// @brief CTCR 目标地址自增 (DINC = 10)
+inline constexpr uint32_t MDMA_NODE_DINC     = 2U << 2;
+/// @brief CTCR 每次请求传输整条链表 (TRGM = 11)
+inline constexpr uint32_t MDMA_NODE_TRGM     = 3U << 28;
+/// @brief CTCR 软件请求模式 (SWRM)
+inline constexpr uint32_t MDMA_NODE_SWRM     = 1U << 30;
+/// @brief CTBR 源经 AHBS 总线访问 (TCM)
+inline constexpr uint32_t MDMA_NODE_SBUS     = 1U << 16;
+/// @brief CTBR 目标经 AHBS 总线访问 (TCM)
+inline constexpr uint32_t MDMA_NODE_DBUS     = 1U << 17;
+
+/**
+ * @brief  MDMA 判断地址是否位于 TCM (ITCM 0x00000000~0x0000FFFF, DTCM 0x20000000~0x2001FFFF)
+ *
+ * @param  address  地址
+ * @return true     位于 TCM
+ * @return false    位于 AXI 总线
+ */
+constexpr bool mdma_is_tcm(uint32_t address) noexcept
+{
+  return (address < 0x00010000U) || (address >= 0x20000000U && address < 0x20020000U);
+}
+
+/**
+ * @brief  MDMA 生成链表节点 (按地址与长度的公共对齐选择传输宽度，TCM 地址经 AHBS 访问)
+ *
+ * @param  dest       目标地址
+ * @param  src        源地址
+ * @param  size       大小 (字节，不超过 MDMA_MAX_BLOCK)
+ * @return Mdma_Node  链表节点 (CLAR 为0)
+ */
+constexpr dma::Mdma_Node mdma_make_node(uint32_t dest, uint32_t src, uint32_t size) noexcept
+{
+  const uint32_t align = dest | src | size;
+  const uint32_t width = (0 == (align & 3U)) ? 2U : ((0 == (align & 1U)) ? 1U : 0U);
+
+  dma::Mdma_Node node {};
+  node.ctcr   = MDMA_NODE_SINC | MDMA_NODE_DINC | (width << 4) | (width << 6) | (width << 8) | (width << 10) | ((MDMA_BUFFER_LENGTH - 1U) << 18) | MDMA_NODE_TRGM | MDMA_NODE_SWRM;
+  node.cbndtr = size;
+  node.csar   = src;
+  node.cdar   = dest;
+  node.ctbr   = (mdma_is_tcm(src) ? MDMA_NODE_SBUS : 0U) | (mdma_is_tcm(dest) ? MDMA_NODE_DBUS : 0U);
+  return node;
+}
+
+static_assert(0x71FC0AAAU == mdma_make_node(0x24000000U, 0x30000000U, 0x100U).ctcr, "MDMA word node configuration error");
+static_assert(0x71FC0000U == (mdma_make_node(0x24000001U, 0x30000000U, 0x100U).ctcr & ~0xFU), "MDMA byte node configuration error");
+static_assert(MDMA_NODE_SBUS == mdma_make_node(0x24000000U, 0x20000000U, 4U).ctbr, "MDMA TCM bus selection error");
+} /* namespace dma_internal */
+} /* namespace base_internal */
+
+/// @brief 名称空间 DMA
+namespace dma
+{
+/**
+ * @brief MDMA 链表 (分散/聚集传输描述符)
+ *
+ * @note  append() 逐段追加并链接节点，超过单节点上限的分段自动拆分; 启动后至完成回调前不可修改;
+ *        节点须位于 MDMA 可访问的内存 (AXI SRAM 或 DTCM)，启动时由通道负责缓存清除
+ *
+ * @tparam Max_Nodes  最大节点数
+ */
+template <uint32_t Max_Nodes>
+class Mdma_Chain final
+{
+  // 禁止拷贝和移动
+  QAQ_NO_COPY_MOVE(Mdma_Chain)
+
+  static_assert(Max_Nodes > 0, "MDMA chain needs at least one node");
+
+private:
+  /// @brief 链表节点
+  Mdma_Node    m_nodes[Max_Nodes]    = {};
+  /// @brief 节点分段
+  Mdma_Segment m_segments[Max_Nodes] = {};
+  /// @brief 节点数
+  uint32_t     m_count               = 0;
+  /// @brief 总字节数
+  uint32_t     m_bytes               = 0;
+
+  /**
+   * @brief  MDMA 链表 获取地址的32位总线地址
+   *
+   * @param  ptr       指针
+   * @return uint32_t  总线地址
+   */
+  static uint32_t address(const void* ptr) noexcept
+  {
+    return static_cast<uint32_t>(reinterpret_cast<uintptr_t>(ptr));
+  }
+
+public:
+  /**
+   * @brief  MDMA 链表 构造函数
+   */
+  explicit Mdma_Chain() {}
+
+  /**
+   * @brief  MDMA 链表 追加分段
+   *
+   * @param  dest   目标地址
+   * @param  src    源地址
+   * @param  size   大小 (字节)
+   * @return true   追加成功
+   * @return false  参数错误或节点不足 (链表保持不变)
+   */
+  bool append(void* dest, const void* src, uint32_t size) noexcept
+  {
+    const uint32_t need = (size + base_internal::dma_internal::MDMA_MAX_BLOCK - 1) / base_internal::dma_internal::MDMA_MAX_BLOCK;
+    bool           ret  = false;
+
+    if (nullptr != dest && nullptr != src && 0 != size && need <= Max_Nodes - m_count)
+    {
+      uint8_t*       dest_ptr = static_cast<uint8_t*>(dest);
+      const uint8_t* src_ptr  = static_cast<const uint8_t*>(src);
+
+      while (0 != size)
+      {
+        const uint32_t block = (size < base_internal::dma_internal::MDMA_MAX_BLOCK) ? size : base_internal::dma_internal::MDMA_MAX_BLOCK;
+
+        m_nodes[m_count]    = base_internal::dma_internal::mdma_make_node(address(dest_ptr), address(src_ptr), block);
+        m_segments[m_count] = Mdma_Segment { dest_ptr, src_ptr, block };
+
+        if (0 != m_count)
+        {
+          m_nodes[m_count - 1].clar = address(&m_nodes[m_count]);
+        }
+
+        ++m_count;
+        m_bytes  += block;
+        dest_ptr += block;
+        src_ptr  += block;
+        size     -= block;
+      }
+
+      ret = true;
+    }
+
+    return ret;
+  }
+
+  /**
+   * @brief  MDMA 链表 清空
+   */
+  void clear(void) noexcept
+  {
+    m_count = 0;
+    m_bytes = 0;
+  }
+
+  /**
+   * @brief  MDMA 链表 获取节点数
+   *
+   * @return uint32_t  节点数
+   */
+  uint32_t size(void) const noexcept
+  {
+    return m_count;
+  }
+
+  /**
+   * @brief  MDMA 链表 获取总字节数
+   *
+   * @return uint32_t  总字节数
+   */
+  uint32_t bytes(void) const noexcept
+  {
+    return m_bytes;
+  }
+
+  /**
+   * @brief  MDMA 链表 获取节点
+   *
+   * @param  index             节点序号
+   * @return const Mdma_Node&  链表节点
+   */
+  const Mdma_Node& node(uint32_t index) const noexcept
+  {
+    return m_nodes[index];
+  }
+
+  /**
+   * @brief  MDMA 链表 获取视图
+   *
+   * @return Mdma_Chain_View  链表视图
+   */
+  Mdma_Chain_View view(void) const noexcept
+  {
+    return Mdma_Chain_View { m_nodes, m_segments, m_count };
+  }
+};
+} /* namespace dma */
+} /* namespace base */
+} /* namespace QAQ */
+
+#endif /* __MDMA_CHAIN_HPP__ */
@@ -0,0 +1,354 @@
+#ifndef __SIM_MDMA_HPP__
+#define __SIM_MDMA_HPP__
+
+#include "mdma_chain.hpp"
+
+/// @brief 名称空间 QAQ
+namespace QAQ
+{
+/// @brief 名称空间 基本对象
+namespace base
+{
+/// @brief 名称空间 DMA
+namespace dma
+{
+/**
+ * @brief MDMA 仿真通道 (接口与 Mdma 一致，用于在主机上验证链表构建、完成顺序与通道仲裁)
+ *
+ * @note  start() 仅登记链表，由 step()/run() 逐节点执行: 每步在传输中的通道里选出优先级最高者
+ *        (同优先级轮询)，拷贝一个节点并触发 Block 事件，末节点后触发 Complete 事件;
+ *        fail_next() 注入传输错误 (该节点不拷贝，触发 Error 事件并终止链表)
+ */
+class Sim_Mdma final
+{
+  // 禁止拷贝和移动
+  QAQ_NO_COPY_MOVE(Sim_Mdma)
+
+private:
+  /// @brief 中断保护器 类型声明
+  using Irq_Guard = system::system_internal::memory_internal::port::Irq_Guard;
+
+  /// @brief 最大通道数
+  static constexpr uint8_t MAX_CHANNEL = 16;
+
+  /// @brief 通道所有者
+  static inline Sim_Mdma* m_owner[MAX_CHANNEL] = {};
+  /// @brief 上次执行的通道 (轮询起点)
+  static inline uint8_t   m_last               = MAX_CHANNEL - 1;
+  /// @brief 待注入错误次数
+  static inline uint32_t  m_fail_count         = 0;
+
+  /// @brief 通道编号
+  int8_t               m_channel               = -1;
+  /// @brief 通道优先级
+  Dma_Priority         m_priority              = Dma_Priority::Medium;
+  /// @brief 当前链表
+  Mdma_Chain_View      m_view                  = {};
+  /// @brief 回调函数
+  Mdma_Callback_Func_t m_function              = nullptr;
+  /// @brief 回调函数参数
+  void*                m_arg                   = nullptr;
+  /// @brief 下一个执行的节点
+  uint32_t             m_next                  = 0;
+  /// @brief 是否传输中
+  bool                 m_busy                  = false;
+  /// @brief 统计信息
+  Mdma_Stats           m_stats                 = {};
+
+  /**
+   * @brief  MDMA 仿真通道 选出下一个执行的通道
+   *
+   * @return Sim_Mdma*  通道 (无传输中的通道时为 nullptr)
+   */
+  static Sim_Mdma* arbitrate(void)
+  {
+    Sim_Mdma* ret = nullptr;
+
+    for (uint8_t i = 1; i <= MAX_CHANNEL; ++i)
+    {
+      const uint8_t channel = static_cast<uint8_t>((m_last + i) % MAX_CHANNEL);
+      Sim_Mdma*     owner   = m_owner[channel];
+
+      if (nullptr != owner && owner->m_busy && (nullptr == ret || owner->m_priority > ret->m_priority))
+      {
+        ret = owner;
+      }
+    }
+
+    if (nullptr != ret)
+    {
+      m_last = static_cast<uint8_t>(ret->m_channel);
+    }
+
+    return ret;
+  }
+
+public:
+  /**
+   * @brief  MDMA 仿真通道 构造函数
+   */
+  explicit Sim_Mdma() {}
+
+  /**
+   * @brief  MDMA 仿真通道 打开 (分配通道)
+   *
+   * @param  priority        通道优先级
+   * @return Dma_Error_Code  DMA 错误码
+   */
+  Dma_Error_Code open(Dma_Priority priority = Dma_Priority::Medium, uint32_t = 0, uint32_t = 0)
+  {
+    Dma_Error_Code error_code = Dma_Error_Code::NO_AVAILABLE_CHANNEL;
+
+    if (-1 != m_channel)
+    {
+      error_code = Dma_Error_Code::ALREADY_OPENED;
+    }
+    else
+    {
+      Irq_Guard guard;
+
+      for (uint8_t i = 0; i < MAX_CHANNEL; ++i)
+      {
+        if (nullptr == m_owner[i])
+        {
+          m_owner[i] = this;
+          m_channel  = static_cast<int8_t>(i);
+          m_priority = priority;
+          m_busy     = false;
+          error_code = Dma_Error_Code::OK;
+          break;
+        }
+      }
+    }
+
+    return error_code;
+  }
+
+  /**
+   * @brief  MDMA 仿真通道 登记链表传输
+   *
+   * @param  chain           链表视图
+   * @param  function        回调函数
+   * @param  arg             回调函数参数
+   * @return Dma_Error_Code  DMA 错误码
+   */
+  Dma_Error_Code start(const Mdma_Chain_View& chain, Mdma_Callback_Func_t function, void* arg)
+  {
+    Dma_Error_Code error_code = Dma_Error_Code::OK;
+    Irq_Guard      guard;
+
+    if (-1 == m_channel)
+    {
+      error_code = Dma_Error_Code::CHANNEL_NOT_OPEN;
+    }
+    else if (m_busy)
+    {
+      error_code = Dma_Error_Code::CHANNEL_NOT_STOPPED;
+    }
+    else if (0 == chain.count)
+    {
+      error_code = Dma_Error_Code::ERROR;
+    }
+    else
+    {
+      m_view     = chain;
+      m_function = function;
+      m_arg      = arg;
+      m_next     = 0;
+      m_busy     = true;
+    }
+
+    return error_code;
+  }
+
+  /**
+   * @brief  MDMA 仿真通道 登记链表传输
+   *
+   * @tparam Max_Nodes       链表最大节点数
+   * @param  chain           链表
+   * @param  function        回调函数
+   * @param  arg             回调函数参数
+   * @return Dma_Error_Code  DMA 错误码
+   */
+  template <uint32_t Max_Nodes>
+  Dma_Error_Code start(const Mdma_Chain<Max_Nodes>& chain, Mdma_Callback_Func_t function, void* arg)
+  {
+    return start(chain.view(), function, arg);
+  }
+
+  /**
+   * @brief  MDMA 仿真通道 中止传输 (不产生回调)
+   *
+   * @return Dma_Error_Code  DMA 错误码
+   */
+  Dma_Error_Code stop(void)
+  {
+    Dma_Error_Code error_code = Dma_Error_Code::OK;
+    Irq_Guard      guard;
+
+    if (-1 == m_channel)
+    {
+      error_code = Dma_Error_Code::CHANNEL_NOT_OPEN;
+    }
+    else
+    {
+      m_busy = false;
+    }
+
+    return error_code;
+  }
+
+  /**
+   * @brief  MDMA 仿真通道 关闭 (释放通道)
+   *
+   * @return Dma_Error_Code  DMA 错误码
+   */
+  Dma_Error_Code close(void)
+  {
+    Dma_Error_Code error_code = Dma_Error_Code::OK;
+    Irq_Guard      guard;
+
+    if (-1 == m_channel)
+    {
+      error_code = Dma_Error_Code::CHANNEL_NOT_OPEN;
+    }
+    else
+    {
+      m_owner[m_channel] = nullptr;
+      m_channel          = -1;
+      m_busy             = false;
+    }
+
+    return error_code;
+  }
+
+  /**
+   * @brief  MDMA 仿真通道 是否传输中
+   *
+   * @return true   传输中
+   * @return false  空闲
+   */
+  bool busy(void) const noexcept
+  {
+    return m_busy;
+  }
+
+  /**
+   * @brief  MDMA 仿真通道 获取统计信息
+   *
+   * @return Mdma_Stats  统计信息
+   */
+  Mdma_Stats stats(void) const noexcept
+  {
+    return m_stats;
+  }
+
+  /**
+   * @brief  MDMA 仿真通道 清零统计信息
+   */
+  void reset_stats(void) noexcept
+  {
+    m_stats = {};
+  }
+
+  /**
+   * @brief  MDMA 仿真通道 执行一个节点 (回调中可启动新的链表)
+   *
+   * @return true   已执行一个节点
+   * @return false  无传输中的通道
+   */
+  static bool step(void)
+  {
+    Sim_Mdma*  channel = nullptr;
+    uint32_t   node    = 0;
+    Mdma_Event event   = Mdma_Event::Block;
+
+    {
+      Irq_Guard guard;
+
+      channel = arbitrate();
+
+      if (nullptr != channel)
+      {
+        const Mdma_Segment& segment = channel->m_view.segments[channel->m_next];
+        node                        = channel->m_next++;
+
+        if (0 != m_fail_count)
+        {
+          --m_fail_count;
+          ++channel->m_stats.errors;
+          channel->m_busy = false;
+          event           = Mdma_Event::Error;
+        }
+        else
+        {
+          __builtin_memcpy(segment.dest, segment.src, segment.size);
+          ++channel->m_stats.blocks;
+          channel->m_stats.bytes += segment.size;
+        }
+      }
+    }
+
+    if (nullptr != channel && nullptr != channel->m_function)
+    {
+      channel->m_function(channel->m_arg, node, event);
+    }
+
+    if (nullptr != channel && Mdma_Event::Block == event && node + 1 == channel->m_view.count)
+    {
+      {
+        Irq_Guard guard;
+        ++channel->m_stats.chains;
+        channel->m_busy = false;
+      }
+
+      if (nullptr != channel->m_function)
+      {
+        channel->m_function(channel->m_arg, node, Mdma_Event::Complete);
+      }
+    }
+
+    return nullptr != channel;
+  }
+
+  /**
+   * @brief  MDMA 仿真通道 执行至所有通道空闲 (包括回调中新启动的链表)
+   *
+   * @return uint32_t  执行的节点数
+   */
+  static uint32_t run(void)
+  {
+    uint32_t count = 0;
+
+    while (step())
+    {
+      ++count;
+    }
+
+    return count;
+  }
+
+  /**
+   * @brief  MDMA 仿真通道 注入传输错误
+   *
+   * @param  count  接下来失败的节点数
+   */
+  static void fail_next(uint32_t count) noexcept
+  {
+    Irq_Guard guard;
+    m_fail_count = count;
+  }
+
+  /**
+   * @brief  MDMA 仿真通道 析构函数
+   */
+  ~Sim_Mdma()
+  {
+    close();
+  }
+};
+} /* namespace dma */
+} /* namespace base */
+} /* namespace QAQ */
+
+#endif /* __SIM_MDMA_HPP__ */
@@ -0,0 +1,416 @@
+#ifndef __DEBOUNCE_HPP__
+#define __DEBOUNCE_HPP__
+
+#include "gpio.hpp"
+#include "signal.hpp"
+#include "soft_timer.hpp"
+
+/// @brief 名称空间 QAQ
+namespace QAQ
+{
+/// @brief 名称空间 基本对象
+namespace base
+{
+/// @brief 名称空间 内部
+namespace base_internal
+{
+/// @brief 名称空间 GPIO 内部
+namespace gpio_internal
+{
+/**
+ * @brief  竖直计数器去抖核心 (位切片，一次运算处理全部32路输入)
+ *
+ * @tparam Planes  计数器位数 (每路最多连续 2^Planes - 1 个采样)
+ * @note   第 k 个计数平面保存全部通道计数值的第 k 位; 输入与稳定电平不同时计数加一，相同时清零，
+ *         计数达到该通道的采样阈值 (同样按位切片保存) 时稳定电平翻转并上报;
+ *         与硬件无关，可在主机上编译期验证
+ */
+template <uint32_t Planes>
+class Vertical_Debounce
+{
+  // 计数器位数检查
+  static_assert((0 < Planes) && (Planes <= 8), "Vertical_Debounce planes must be 1 to 8");
+
+public:
+  /// @brief 最大采样阈值
+  static constexpr uint32_t MAX_SAMPLES = (1U << Planes) - 1U;
+
+private:
+  /// @brief 计数平面
+  uint32_t m_count[Planes] = {};
+  /// @brief 阈值平面
+  uint32_t m_limit[Planes] = {};
+  /// @brief 稳定电平
+  uint32_t m_state         = 0;
+
+public:
+  /**
+   * @brief  竖直计数器去抖核心 构造函数
+   *
+   * @param  state    初始稳定电平
+   * @param  samples  全部通道的采样阈值
+   */
+  explicit constexpr Vertical_Debounce(uint32_t state = 0, uint32_t samples = MAX_SAMPLES) : m_state(state)
+  {
+    for (uint32_t index = 0; index < 32; ++index)
+    {
+      set_samples(index, samples);
+    }
+  }
+
+  /**
+   * @brief  竖直计数器去抖核心 设置通道采样阈值
+   *
+   * @param  index    通道序号
+   * @param  samples  连续采样次数 (限定在 1 ~ MAX_SAMPLES)
+   */
+  constexpr void set_samples(uint32_t index, uint32_t samples)
+  {
+    const uint32_t bit   = 1U << (index & 31U);
+    const uint32_t limit = (samples < 1U) ? 1U : ((samples > MAX_SAMPLES) ? MAX_SAMPLES : samples);
+
+    for (uint32_t k = 0; k < Planes; ++k)
+    {
+      m_limit[k] = (m_limit[k] & ~bit) | (((limit >> k) & 1U) ? bit : 0U);
+    }
+  }
+
+  /**
+   * @brief  竖直计数器去抖核心 输入一次采样
+   *
+   * @param  raw       原始电平
+   * @return uint32_t  本次翻转的通道掩码
+   */
+  constexpr uint32_t update(uint32_t raw)
+  {
+    const uint32_t delta   = raw ^ m_state;
+    uint32_t       carry   = delta;
+    uint32_t       reached = delta;
+
+    for (uint32_t k = 0; k < Planes; ++k)
+    {
+      const uint32_t next  = m_count[k] ^ carry;
+      carry               &= m_count[k];
+      m_count[k]           = next & delta;
+      reached             &= ~(m_count[k] ^ m_limit[k]);
+    }
+
+    m_state ^= reached;
+
+    for (uint32_t k = 0; k < Planes; ++k)
+    {
+      m_count[k] &= ~reached;
+    }
+
+    return reached;
+  }
+
+  /**
+   * @brief  竖直计数器去抖核心 复位 (清除计数)
+   *
+   * @param  state  稳定电平
+   */
+  constexpr void reset(uint32_t state)
+  {
+    m_state = state;
+
+    for (uint32_t k = 0; k < Planes; ++k)
+    {
+      m_count[k] = 0;
+    }
+  }
+
+  /**
+   * @brief  竖直计数器去抖核心 获取稳定电平
+   *
+   * @return uint32_t 稳定电平
+   */
+  constexpr uint32_t state(void) const
+  {
+    return m_state;
+  }
+};
+
+/**
+ * @brief  竖直计数器去抖核心 合成抖动序列自检
+ *
+ * @note   通道0阈值3: 先抖动后稳定为高，第7个采样上报; 随后两个采样的低电平毛刺被滤除;
+ *         通道1阈值5: 第2个采样起稳定为高，第6个采样上报
+ * @return true   通过
+ * @return false  失败
+ */
+constexpr bool vertical_debounce_self_check(void)
+{
+  constexpr uint32_t trace[]    = { 0b01, 0b10, 0b11, 0b10, 0b11, 0b11, 0b11, 0b11, 0b11, 0b10, 0b10, 0b11, 0b11, 0b11 };
+  constexpr uint32_t expected[] = { 0b00, 0b00, 0b00, 0b00, 0b00, 0b10, 0b01, 0b00, 0b00, 0b00, 0b00, 0b00, 0b00, 0b00 };
+
+  Vertical_Debounce<4> core(0, 3);
+  bool                 ret = true;
+
+  core.set_samples(1, 5);
+
+  for (uint32_t i = 0; i < sizeof(trace) / sizeof(trace[0]); ++i)
+  {
+    ret = ret && (expected[i] == core.update(trace[i]));
+  }
+
+  return ret && (0b11 == core.state());
+}
+
+// 去抖核心自检
+static_assert(vertical_debounce_self_check(), "Vertical_Debounce must report one edge per stable change and reject glitches");
+} /* namespace gpio_internal */
+} /* namespace base_internal */
+
+/// @brief 名称空间 GPIO
+namespace gpio
+{
+/// @brief 去抖回调函数参数类型
+using Debounce_Args_t = void*;
+/// @brief 去抖回调函数类型 (参数: 回调参数、引脚在组内的序号、稳定后的电平)
+using Debounce_Func_t = void (*)(Debounce_Args_t, uint32_t, bool);
+
+/**
+ * @brief  GPIO 输入去抖引擎 (单个软件定时器周期采样整组输入)
+ *
+ * @tparam Group   GPIO 组类型 (gpio::Gpio_Group<...>)，组内第 i 个引脚即通道 i
+ * @tparam Planes  竖直计数器位数 (单通道最多连续 2^Planes - 1 个采样周期)
+ * @note   每个采样周期读取一次组输入 (每端口一次 IDR)，经位切片计数器同时处理全部通道，
+ *         仅在电平稳定翻转且符合通道边沿设置时上报; 抖动期间不产生中断、队列消息或逐引脚定时器;
+ *         回调与信号在定时器线程中执行，信号以不等待方式发送
+ */
+template <typename Group, uint32_t Planes = 4>
+class Debounce final : public system::Soft_Timer<Debounce<Group, Planes>>
+{
+  // 通道数量检查
+  static_assert(Group::WIDTH <= 32, "Debounce supports up to 32 pins");
+
+  // 禁止拷贝和移动
+  QAQ_NO_COPY_MOVE(Debounce)
+
+  /// @brief 友元声明 定时器回调
+  template <typename T>
+  friend void system::system_internal::soft_timer_internal::timer_callback(ULONG arg);
+
+  /// @brief 基类类型
+  using Timer = system::Soft_Timer<Debounce<Group, Planes>>;
+  /// @brief 去抖核心类型
+  using Core  = base_internal::gpio_internal::Vertical_Debounce<Planes>;
+
+public:
+  /// @brief 边沿信号类型 (参数: 引脚在组内的序号、稳定后的电平)
+  using Edge_Signal = system::signal::Signal<uint32_t, bool>;
+
+private:
+  /// @brief 去抖引擎 定时器名称
+  static constexpr const char* TIMER_NAME = "Gpio Debounce";
+
+  /// @brief 去抖核心
+  Core            m_core;
+  /// @brief 采样周期 (系统节拍)
+  uint32_t        m_period;
+  /// @brief 上升沿上报掩码
+  uint32_t        m_rising                = Group::MASK;
+  /// @brief 下降沿上报掩码
+  uint32_t        m_falling               = Group::MASK;
+  /// @brief 上报回调
+  Debounce_Func_t m_func                  = nullptr;
+  /// @brief 上报回调参数
+  Debounce_Args_t m_arg                   = nullptr;
+  /// @brief 上报信号
+  Edge_Signal*    m_signal                = nullptr;
+  /// @brief 已上报边沿数
+  uint32_t        m_edges                 = 0;
+  /// @brief 定时器是否已创建
+  bool            m_created               = false;
+
+  /**
+   * @brief  去抖引擎 定时器回调 (定时器线程中执行)
+   */
+  void callback(void)
+  {
+    uint32_t changed = m_core.update(Group::read() & Group::MASK);
+
+    if (0 != changed)
+    {
+      const uint32_t state  = m_core.state();
+      changed              &= (state & m_rising) | (~state & m_falling);
+
+      while (0 != changed)
+      {
+        const uint32_t index  = static_cast<uint32_t>(__builtin_ctz(changed));
+        const bool     level  = 0 != (state & (1U << index));
+        changed              &= changed - 1U;
+        m_edges++;
+
+        if (nullptr != m_func)
+        {
+          m_func(m_arg, index, level);
+        }
+
+        if (nullptr != m_signal)
+        {
+          m_signal->emit(static_cast<uint32_t>(index), static_cast<bool>(level), 0);
+        }
+      }
+    }
+  }
+
+public:
+  /**
+   * @brief  去抖引擎 构造函数
+   *
+   * @param  period_ticks  采样周期 (系统节拍)
+   * @param  debounce_ms   全部通道的默认去抖时间 (毫秒)
+   */
+  explicit Debounce(uint32_t period_ticks = 1, uint32_t debounce_ms = 10) : Timer((0 != period_ticks) ? period_ticks : 1, true), m_period((0 != period_ticks) ? period_ticks : 1)
+  {
+    for (uint32_t index = 0; index < Group::WIDTH; ++index)
+    {
+      m_core.set_samples(index, to_samples(debounce_ms));
+    }
+  }
+
+  /**
+   * @brief  去抖引擎 析构函数
+   */
+  ~Debounce() {}
+
+  /**
+   * @brief  去抖引擎 开始采样 (以当前输入为初始稳定电平，不上报初始状态)
+   *
+   * @note   引脚需事先配置为输入 (Group::setup)
+   */
+  void open(void)
+  {
+    {
+      system::kernel::Interrupt_Guard guard;
+      m_core.reset(Group::read() & Group::MASK);
+    }
+
+    if (!m_created)
+    {
+      m_created = true;
+      this->create(TIMER_NAME, false);
+    }
+
+    this->start();
+  }
+
+  /**
+   * @brief  去抖引擎 停止采样
+   */
+  void close(void)
+  {
+    if (m_created)
+    {
+      this->stop();
+    }
+  }
+
+  /**
+   * @brief  去抖引擎 去抖时间转换为采样次数
+   *
+   * @param  time_ms   去抖时间 (毫秒)
+   * @return uint32_t  采样次数 (向上取整，限定在 1 ~ 2^Planes - 1)
+   */
+  uint32_t to_samples(uint32_t time_ms) const
+  {
+    const uint32_t ticks   = (time_ms * TX_TIMER_TICKS_PER_SECOND + 999U) / 1000U;
+    const uint32_t samples = (ticks + m_period - 1U) / m_period;
+    return (samples < 1U) ? 1U : ((samples > Core::MAX_SAMPLES) ? Core::MAX_SAMPLES : samples);
+  }
+
+  /**
+   * @brief  去抖引擎 设置通道去抖时间
+   *
+   * @param  index    引脚在组内的序号
+   * @param  time_ms  去抖时间 (毫秒)
+   */
+  void set_debounce(uint32_t index, uint32_t time_ms)
+  {
+    if (index < Group::WIDTH)
+    {
+      const uint32_t                  samples = to_samples(time_ms);
+      system::kernel::Interrupt_Guard guard;
+      m_core.set_samples(index, samples);
+    }
+  }
+
+  /**
+   * @brief  去抖引擎 设置通道上报边沿
+   *
+   * @param  index  引脚在组内的序号
+   * @param  edge   上报边沿
+   */
+  void set_edge(uint32_t index, Pin_Edge edge)
+  {
+    if (index < Group::WIDTH)
+    {
+      const uint32_t                  bit = 1U << index;
+      system::kernel::Interrupt_Guard guard;
+      m_rising  = (Pin_Edge::Falling != edge) ? (m_rising | bit) : (m_rising & ~bit);
+      m_falling = (Pin_Edge::Rising != edge) ? (m_falling | bit) : (m_falling & ~bit);
+    }
+  }
+
+  /**
+   * @brief  去抖引擎 设置上报回调
+   *
+   * @param  func  回调函数 (为空取消)
+   * @param  arg   回调参数
+   */
+  void set_callback(Debounce_Func_t func, Debounce_Args_t arg = nullptr)
+  {
+    system::kernel::Interrupt_Guard guard;
+    m_func = func;
+    m_arg  = arg;
+  }
+
+  /**
+   * @brief  去抖引擎 设置上报信号
+   *
+   * @param  signal  边沿信号 (为空取消)
+   */
+  void set_signal(Edge_Signal* signal)
+  {
+    m_signal = signal;
+  }
+
+  /**
+   * @brief  去抖引擎 获取全部通道稳定电平
+   *
+   * @return uint32_t 稳定电平 (第 i 位对应组内第 i 个引脚)
+   */
+  uint32_t state(void) const
+  {
+    return m_core.state();
+  }
+
+  /**
+   * @brief  去抖引擎 获取通道稳定电平
+   *
+   * @param  index  引脚在组内的序号
+   * @return true   高电平
+   * @return false  低电平
+   */
+  bool level(uint32_t index) const
+  {
+    return (index < Group::WIDTH) && (0 != (m_core.state() & (1U << index)));
+  }
+
+  /**
+   * @brief  去抖引擎 获取已上报边沿数
+   *
+   * @return uint32_t 边沿数
+   */
+  uint32_t edges(void) const
+  {
+    return m_edges;
+  }
+};
+} /* namespace gpio */
+} /* namespace base */
+} /* namespace QAQ */
+
+#endif /* __DEBOUNCE_HPP__ */
@@ -512,7 +512,7 @@ protected:
    */
   static void read(bool& value) noexcept
   {
-    value = (m_reg->IDR >> (1U << pin)) != 0U;
+    value = (m_reg->IDR & (1U << pin)) != 0U;
   }
 
   /**
@@ -522,7 +522,7 @@ protected:
    */
   static bool read(void) noexcept
   {
-    return (m_reg->IDR >> (1U << pin)) != 0U;
+    return (m_reg->IDR & (1U << pin)) != 0U;
   }
 
   /**
@@ -669,6 +669,161 @@ protected:
    */
   virtual ~Gpio_Base() {}
 };
+
+/**
+ * @brief GPIO 组 引脚描述
+ */
+struct Group_Pin
+{
+  gpio::Pin_Port port = gpio::Pin_Port::PA; /* 端口号 */
+  gpio::Pin_Num  pin  = 0;                  /* 引脚号 */
+};
+
+/**
+ * @brief  GPIO 组 编译期布局 (按端口首次出现的顺序归并引脚，生成每端口的掩码与值位映射)
+ *
+ * @tparam Count 引脚数量 (值的第 i 位对应第 i 个引脚)
+ * @note   同一端口内各引脚满足 引脚号 - 值位序号 为同一常数时为线性映射，
+ *         值与端口位之间一次移位即可完成转换; 否则逐引脚展开
+ */
+template <uint32_t Count>
+struct Gpio_Group_Layout
+{
+  Group_Pin      pins[Count];          /* 引脚列表 */
+  uint8_t        slot[Count]   = {};   /* 引脚所属端口序号 */
+  gpio::Pin_Port ports[Count]  = {};   /* 端口列表 */
+  uint16_t       masks[Count]  = {};   /* 每端口引脚掩码 */
+  uint32_t       bits[Count]   = {};   /* 每端口对应的值位掩码 */
+  int32_t        shift[Count]  = {};   /* 每端口线性映射移位量 (引脚号 - 值位序号) */
+  bool           linear[Count] = {};   /* 每端口是否线性映射 */
+  uint32_t       port_count    = 0;    /* 端口数量 */
+  bool           valid         = true; /* 引脚合法且无重复 */
+
+  /**
+   * @brief  GPIO 组 编译期布局 构造函数
+   *
+   * @param  list  引脚列表
+   */
+  explicit constexpr Gpio_Group_Layout(const Group_Pin (&list)[Count]) : pins()
+  {
+    for (uint32_t i = 0; i < Count; ++i)
+    {
+      pins[i]        = list[i];
+      uint32_t index = port_count;
+
+      for (uint32_t p = 0; p < port_count; ++p)
+      {
+        if (ports[p] == list[i].port)
+        {
+          index = p;
+        }
+      }
+
+      if (index == port_count)
+      {
+        ports[port_count] = list[i].port;
+        shift[port_count] = static_cast<int32_t>(list[i].pin) - static_cast<int32_t>(i);
+        linear[port_count] = true;
+        port_count++;
+      }
+
+      if ((16U <= list[i].pin) || (0 != (masks[index] & (1U << list[i].pin))))
+      {
+        valid = false;
+      }
+
+      slot[i]        = static_cast<uint8_t>(index);
+      masks[index]  |= static_cast<uint16_t>(1U << (list[i].pin & 0xFU));
+      bits[index]   |= 1U << i;
+      linear[index]  = linear[index] && (shift[index] == static_cast<int32_t>(list[i].pin) - static_cast<int32_t>(i));
+    }
+  }
+
+  /**
+   * @brief  GPIO 组 值转换为端口输出位
+   *
+   * @param  port      端口序号
+   * @param  value     组值
+   * @return uint32_t  端口输出位 (仅含该端口引脚)
+   */
+  constexpr uint32_t scatter(uint32_t port, uint32_t value) const
+  {
+    uint32_t ret = 0;
+
+    if (linear[port])
+    {
+      ret = (0 <= shift[port]) ? ((value & bits[port]) << shift[port]) : ((value & bits[port]) >> -shift[port]);
+    }
+    else
+    {
+      for (uint32_t i = 0; i < Count; ++i)
+      {
+        if (slot[i] == port)
+        {
+          ret |= ((value >> i) & 1U) << pins[i].pin;
+        }
+      }
+    }
+
+    return ret;
+  }
+
+  /**
+   * @brief  GPIO 组 端口输入位转换为值
+   *
+   * @param  port      端口序号
+   * @param  idr       端口输入寄存器值
+   * @return uint32_t  组值 (仅含该端口引脚对应的位)
+   */
+  constexpr uint32_t gather(uint32_t port, uint32_t idr) const
+  {
+    uint32_t ret = 0;
+
+    if (linear[port])
+    {
+      ret = ((0 <= shift[port]) ? (idr >> shift[port]) : (idr << -shift[port])) & bits[port];
+    }
+    else
+    {
+      for (uint32_t i = 0; i < Count; ++i)
+      {
+        if (slot[i] == port)
+        {
+          ret |= ((idr >> pins[i].pin) & 1U) << i;
+        }
+      }
+    }
+
+    return ret;
+  }
+
+  /**
+   * @brief  GPIO 组 生成端口置位/复位寄存器值
+   *
+   * @param  port      端口序号
+   * @param  value     组值
+   * @return uint32_t  BSRR 值 (低16位置位，高16位复位)
+   */
+  constexpr uint32_t bsrr(uint32_t port, uint32_t value) const
+  {
+    const uint32_t set = scatter(port, value);
+    return set | ((masks[port] & ~set) << 16U);
+  }
+};
+
+// GPIO 组 编译期布局自检样例: PB8/PB9 线性映射，PE3/PE1 逐引脚映射
+inline constexpr Gpio_Group_Layout<4> GPIO_GROUP_LAYOUT_SAMPLE({
+  {gpio::Pin_Port::PB, 8},
+  {gpio::Pin_Port::PB, 9},
+  {gpio::Pin_Port::PE, 3},
+  {gpio::Pin_Port::PE, 1},
+});
+
+static_assert((2 == GPIO_GROUP_LAYOUT_SAMPLE.port_count) && (0x0300 == GPIO_GROUP_LAYOUT_SAMPLE.masks[0]) && (0x000A == GPIO_GROUP_LAYOUT_SAMPLE.masks[1]), "Gpio group layout must merge pins by port");
+static_assert(GPIO_GROUP_LAYOUT_SAMPLE.linear[0] && !GPIO_GROUP_LAYOUT_SAMPLE.linear[1], "Gpio group layout must detect linear port mapping");
+static_assert((0x02000100 == GPIO_GROUP_LAYOUT_SAMPLE.bsrr(0, 0b0001)) && (0x00020008 == GPIO_GROUP_LAYOUT_SAMPLE.bsrr(1, 0b0100)) && (0x00080002 == GPIO_GROUP_LAYOUT_SAMPLE.bsrr(1, 0b1000)), "Gpio group layout must generate set and reset masks");
+static_assert((0b0011 == GPIO_GROUP_LAYOUT_SAMPLE.gather(0, 0x0300)) && (0b1000 == GPIO_GROUP_LAYOUT_SAMPLE.gather(1, 0x0002)), "Gpio group layout must gather input bits");
+static_assert(!Gpio_Group_Layout<2>({ {gpio::Pin_Port::PA, 3}, {gpio::Pin_Port::PA, 3} }).valid, "Gpio group layout must reject duplicate pins");
 } /* namespace gpio_internal */
 } /* namespace base_internal */
 
@@ -920,6 +1075,168 @@ public:
    */
   virtual ~Gpio() {}
 };
+
+/**
+ * @brief  GPIO 组模版类 (多引脚同时读写)
+ *
+ * @tparam Pins  GPIO 引脚类型 (gpio::Gpio<...>)，值的第 i 位对应第 i 个引脚
+ * @note   掩码与映射在编译期生成; 写入时每个端口仅一次 BSRR 写操作，同端口引脚同时翻转、无中间态且不影响组外引脚;
+ *         跨端口的组按端口首次出现的顺序依次写入; 读取时每个端口仅读一次 IDR
+ */
+template <typename... Pins>
+class Gpio_Group
+{
+  // 引脚数量检查
+  static_assert((0 < sizeof...(Pins)) && (sizeof...(Pins) <= 32), "Gpio_Group must contain 1 to 32 pins");
+
+  // 禁止拷贝和移动
+  QAQ_NO_COPY_MOVE(Gpio_Group)
+
+  /// @brief 布局类型
+  using Layout                   = base_internal::gpio_internal::Gpio_Group_Layout<sizeof...(Pins)>;
+  /// @brief 编译期布局
+  static constexpr Layout LAYOUT = Layout({ base_internal::gpio_internal::Group_Pin { Pins::get_port(), Pins::get_pin() }... });
+
+  // 引脚合法性检查
+  static_assert(LAYOUT.valid, "Gpio_Group pins must be valid and unique");
+
+  /// @brief 端口序号序列
+  using Port_Sequence            = std::make_index_sequence<LAYOUT.port_count>;
+
+  /**
+   * @brief  GPIO 组 获取端口寄存器指针
+   *
+   * @tparam Port  端口序号
+   * @return GPIO_TypeDef* 寄存器指针
+   */
+  template <uint32_t Port>
+  static QAQ_INLINE GPIO_TypeDef* reg(void) noexcept
+  {
+    return base_internal::gpio_internal::get_ptr<LAYOUT.ports[Port]>();
+  }
+
+  /**
+   * @brief  GPIO 组 逐端口写入
+   *
+   * @param  value  组值
+   */
+  template <size_t... Port>
+  static QAQ_INLINE void write_ports(uint32_t value, std::index_sequence<Port...>) noexcept
+  {
+    ((reg<Port>()->BSRR = LAYOUT.bsrr(Port, value)), ...);
+  }
+
+  /**
+   * @brief  GPIO 组 逐端口读取
+   *
+   * @return uint32_t 组值
+   */
+  template <size_t... Port>
+  static QAQ_INLINE uint32_t read_ports(std::index_sequence<Port...>) noexcept
+  {
+    return (LAYOUT.gather(Port, reg<Port>()->IDR) | ...);
+  }
+
+  /**
+   * @brief  GPIO 组 逐端口翻转
+   */
+  template <size_t... Port>
+  static QAQ_INLINE void toggle_ports(std::index_sequence<Port...>) noexcept
+  {
+    ((reg<Port>()->BSRR = (LAYOUT.masks[Port] & ~reg<Port>()->ODR) | ((LAYOUT.masks[Port] & reg<Port>()->ODR) << 16U)), ...);
+  }
+
+public:
+  /// @brief 引脚数量
+  static constexpr uint32_t WIDTH      = sizeof...(Pins);
+  /// @brief 值掩码
+  static constexpr uint32_t MASK       = (32U == WIDTH) ? 0xFFFFFFFFU : ((1U << WIDTH) - 1U);
+  /// @brief 涉及的端口数量 (每次写入的寄存器写操作次数)
+  static constexpr uint32_t PORT_COUNT = LAYOUT.port_count;
+
+  /**
+   * @brief GPIO 组 构造函数
+   *
+   */
+  explicit Gpio_Group() {}
+
+  /**
+   * @brief GPIO 组 配置全部引脚
+   *
+   * @param mode 工作模式
+   * @param pull 上下拉设置
+   */
+  static void setup(Pin_Mode mode = Pin_Mode::Output, Pin_Pull pull = Pin_Pull::Up) noexcept
+  {
+    (Pins::setup(mode, pull), ...);
+  }
+
+  /**
+   * @brief GPIO 组 输出
+   *
+   * @param value 组值 (第 i 位对应第 i 个引脚)
+   */
+  static QAQ_O3 void write(uint32_t value) noexcept
+  {
+    write_ports(value, Port_Sequence {});
+  }
+
+  /**
+   * @brief GPIO 组 全部输出高电平
+   *
+   */
+  static void set(void) noexcept
+  {
+    write_ports(MASK, Port_Sequence {});
+  }
+
+  /**
+   * @brief GPIO 组 全部输出低电平
+   *
+   */
+  static void reset(void) noexcept
+  {
+    write_ports(0U, Port_Sequence {});
+  }
+
+  /**
+   * @brief GPIO 组 全部电平翻转
+   *
+   * @note  基于 ODR 当前值生成 BSRR，翻转本身为单次写入，不影响组外引脚
+   */
+  static void toggle(void) noexcept
+  {
+    toggle_ports(Port_Sequence {});
+  }
+
+  /**
+   * @brief  GPIO 组 读取输入电平
+   *
+   * @return uint32_t 组值 (第 i 位对应第 i 个引脚)
+   */
+  static QAQ_O3 uint32_t read(void) noexcept
+  {
+    return read_ports(Port_Sequence {});
+  }
+
+  /**
+   * @brief  GPIO 组 生成指定端口的 BSRR 值 (编译期可用)
+   *
+   * @param  port      端口序号 (按端口首次出现的顺序)
+   * @param  value     组值
+   * @return uint32_t  BSRR 值
+   */
+  static constexpr uint32_t bsrr(uint32_t port, uint32_t value) noexcept
+  {
+    return LAYOUT.bsrr(port, value);
+  }
+
+  /**
+   * @brief GPIO 组 析构函数
+   *
+   */
+  ~Gpio_Group() {}
+};
 } /* namespace gpio */
 } /* namespace base */
 } /* namespace QAQ */
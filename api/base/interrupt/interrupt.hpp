@@ -2,7 +2,7 @@
 #define __INTERRUPT_HPP__
 
 #include "stm32h743xx.h"
-#include "message_queue.hpp"
+#include "semaphore.hpp"
 #include "thread.hpp"
 
 /// @brief 名称空间 QAQ
@@ -21,8 +21,297 @@ namespace interrupt_internal
 static constexpr uint32_t INTERRUPT_MANAGER_STACK_SIZE         = 1536;
 /// @brief 中断管理器 线程优先级
 static constexpr uint32_t INTERRUPT_MANAGER_PRIORITY           = 2;
-/// @brief 中断管理器 消息队列大小
+/// @brief 中断管理器 延迟处理环形队列大小 (2的幂)
 static constexpr uint32_t INTERRUPT_MANAGER_MASSAGE_QUEUE_SIZE = 32;
+/// @brief 中断管理器 监视槽位数量 (同时开启统计的中断通道数)
+static constexpr uint32_t INTERRUPT_MANAGER_MONITOR_COUNT      = 8;
+
+/**
+ * @brief  中断延迟处理环形队列 (多生产者单消费者，无锁)
+ *
+ * @tparam T     元素类型
+ * @tparam Size  队列大小 (2的幂)
+ * @note   每个槽位带序号: 生产者 (任意优先级的中断，可相互抢占) 以 CAS 抢占写位置后写入数据再发布序号，
+ *         消费者 (管理器线程) 仅在槽位序号已发布时读取; 写入期间被抢占的槽位会暂停消费，直至该槽位发布
+ */
+template <typename T, uint32_t Size>
+class Isr_Ring
+{
+  // 队列大小检查
+  static_assert((0 != Size) && (0 == (Size & (Size - 1))), "Isr_Ring size must be a power of 2");
+
+  // 禁止拷贝和移动
+  QAQ_NO_COPY_MOVE(Isr_Ring)
+
+private:
+  /// @brief 槽位
+  struct Slot
+  {
+    std::atomic<uint32_t> sequence; /* 槽位序号 */
+    T                     data;     /* 数据 */
+  };
+
+  /// @brief 下标掩码
+  static constexpr uint32_t MASK = Size - 1;
+
+  /// @brief 槽位数组
+  Slot                  m_slots[Size];
+  /// @brief 写位置
+  std::atomic<uint32_t> m_tail = 0;
+  /// @brief 读位置 (仅消费者访问)
+  uint32_t              m_head = 0;
+
+public:
+  /**
+   * @brief  延迟处理环形队列 构造函数
+   */
+  explicit Isr_Ring()
+  {
+    for (uint32_t i = 0; i < Size; ++i)
+    {
+      m_slots[i].sequence.store(i, std::memory_order_relaxed);
+    }
+  }
+
+  /**
+   * @brief  延迟处理环形队列 写入 (可在中断中调用)
+   *
+   * @param  data   数据
+   * @return true   成功
+   * @return false  队列已满
+   */
+  bool push(const T& data)
+  {
+    bool     ret = false;
+    uint32_t pos = m_tail.load(std::memory_order_relaxed);
+
+    while (true)
+    {
+      Slot&         slot = m_slots[pos & MASK];
+      const int32_t diff = static_cast<int32_t>(slot.sequence.load(std::memory_order_acquire) - pos);
+
+      if (0 == diff)
+      {
+        if (m_tail.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+        {
+          slot.data = data;
+          slot.sequence.store(pos + 1, std::memory_order_release);
+          ret = true;
+          break;
+        }
+      }
+      else if (diff < 0)
+      {
+        break;
+      }
+      else
+      {
+        pos = m_tail.load(std::memory_order_relaxed);
+      }
+    }
+
+    return ret;
+  }
+
+  /**
+   * @brief  延迟处理环形队列 是否为空 (仅消费者调用)
+   *
+   * @return true   为空 (或队首槽位尚未发布)
+   * @return false  非空
+   */
+  bool empty(void) const
+  {
+    return m_slots[m_head & MASK].sequence.load(std::memory_order_acquire) != m_head + 1;
+  }
+
+  /**
+   * @brief  延迟处理环形队列 读取 (仅消费者调用)
+   *
+   * @param  data   数据
+   * @return true   成功
+   * @return false  队列为空 (或队首槽位尚未发布)
+   */
+  bool pop(T& data)
+  {
+    bool  ret  = false;
+    Slot& slot = m_slots[m_head & MASK];
+
+    if (slot.sequence.load(std::memory_order_acquire) == m_head + 1)
+    {
+      data = slot.data;
+      slot.sequence.store(m_head + Size, std::memory_order_release);
+      m_head++;
+      ret = true;
+    }
+
+    return ret;
+  }
+};
+
+/**
+ * @brief  中断风暴限流器 (窗口计数与屏蔽到期，不访问硬件)
+ *
+ * @note   窗口以 DWT 周期计，差值按32位回绕比较，窗口须小于一次回绕 (480MHz 下约 8.9 秒);
+ *         屏蔽到期以系统节拍计，差值按有符号比较，屏蔽时长须小于 2^31 节拍
+ */
+class Storm_Limiter
+{
+private:
+  /// @brief 窗口上限 (CPU周期)
+  static constexpr uint64_t MAX_WINDOW_CYCLES = 0xFFFFFFFFU;
+  /// @brief 屏蔽时长上限 (系统节拍)
+  static constexpr uint64_t MAX_HOLDOFF_TICKS = 0x7FFFFFFFU;
+
+  /// @brief 窗口内允许的最大中断次数 (0为不限流)
+  uint32_t                  m_max_count     = 0;
+  /// @brief 统计窗口 (CPU周期)
+  uint32_t                  m_window_cycles = 0;
+  /// @brief 屏蔽时长 (系统节拍)
+  uint32_t                  m_holdoff_ticks = 0;
+  /// @brief 当前窗口起点 (CPU周期)
+  uint32_t                  m_window_start  = 0;
+  /// @brief 当前窗口内中断次数
+  uint32_t                  m_window_count  = 0;
+  /// @brief 解除屏蔽时刻 (系统节拍)
+  uint32_t                  m_release_tick  = 0;
+  /// @brief 本次屏蔽是否已确定解除时刻
+  bool                      m_armed         = true;
+
+public:
+  /**
+   * @brief  风暴限流器 配置 (换算在64位下完成，超出范围的配置被拒绝且不修改当前状态)
+   *
+   * @param  max_count    窗口内允许的最大中断次数 (0为不限流，忽略窗口与屏蔽时长)
+   * @param  window_us    统计窗口 (微秒)
+   * @param  holdoff_ms   触发后屏蔽时长 (毫秒)
+   * @param  core_clock   CPU 频率 (Hz)
+   * @param  now_cycles   当前时刻 (CPU周期)
+   * @param  now_tick     当前时刻 (系统节拍)
+   * @return true         成功
+   * @return false        窗口超出32位周期计数或屏蔽时长超出节拍比较范围
+   */
+  bool configure(uint32_t max_count, uint32_t window_us, uint32_t holdoff_ms, uint32_t core_clock, uint32_t now_cycles, uint32_t now_tick)
+  {
+    bool           ret     = false;
+    const uint64_t window  = static_cast<uint64_t>(core_clock / 1000000U) * window_us;
+    const uint64_t holdoff = static_cast<uint64_t>(holdoff_ms) * TX_TIMER_TICKS_PER_SECOND / 1000U;
+
+    if ((0 == max_count) || ((window <= MAX_WINDOW_CYCLES) && (holdoff <= MAX_HOLDOFF_TICKS)))
+    {
+      m_max_count     = max_count;
+      m_window_cycles = (0 != max_count) ? static_cast<uint32_t>(window) : 0U;
+      m_holdoff_ticks = (0 != max_count) ? static_cast<uint32_t>(holdoff) : 0U;
+      m_window_start  = now_cycles;
+      m_window_count  = 0;
+      m_release_tick  = now_tick;
+      m_armed         = true;
+      ret             = true;
+    }
+
+    return ret;
+  }
+
+  /**
+   * @brief  风暴限流器 准入 (中断中调用)
+   *
+   * @param  now      当前时刻 (CPU周期)
+   * @return true     正常处理
+   * @return false    窗口内次数超限，调用者屏蔽通道后调用 remain() 等待解除
+   */
+  bool admit(uint32_t now)
+  {
+    bool ret = true;
+
+    if (0 != m_max_count)
+    {
+      if (now - m_window_start >= m_window_cycles)
+      {
+        m_window_start = now;
+        m_window_count = 0;
+      }
+
+      if (++m_window_count > m_max_count)
+      {
+        m_armed = false;
+        ret     = false;
+      }
+    }
+
+    return ret;
+  }
+
+  /**
+   * @brief  风暴限流器 确定解除时刻 (管理器线程中调用，每次屏蔽仅首次生效)
+   *
+   * @param  now      当前时刻 (系统节拍)
+   * @return true     本次屏蔽首次处理 (需记录日志)
+   * @return false    已处理过
+   */
+  bool arm(uint32_t now)
+  {
+    const bool ret = !m_armed;
+
+    if (ret)
+    {
+      m_armed        = true;
+      m_release_tick = now + m_holdoff_ticks;
+    }
+
+    return ret;
+  }
+
+  /**
+   * @brief  风暴限流器 剩余屏蔽时长 (管理器线程中调用，到期时清零窗口计数)
+   *
+   * @param  now       当前时刻 (系统节拍)
+   * @return uint32_t  剩余节拍，0为已到期
+   */
+  uint32_t remain(uint32_t now)
+  {
+    const int32_t remain = static_cast<int32_t>(m_release_tick - now);
+    uint32_t      ret    = 0;
+
+    if (remain > 0)
+    {
+      ret = static_cast<uint32_t>(remain);
+    }
+    else
+    {
+      m_window_count = 0;
+    }
+
+    return ret;
+  }
+
+  /**
+   * @brief  风暴限流器 立即解除屏蔽 (清零窗口计数)
+   */
+  void release(void)
+  {
+    m_window_count = 0;
+    m_armed        = true;
+  }
+
+  /**
+   * @brief  风暴限流器 统计窗口
+   *
+   * @return uint32_t  窗口 (CPU周期)
+   */
+  uint32_t window_cycles(void) const
+  {
+    return m_window_cycles;
+  }
+
+  /**
+   * @brief  风暴限流器 屏蔽时长
+   *
+   * @return uint32_t  屏蔽时长 (系统节拍)
+   */
+  uint32_t holdoff_ticks(void) const
+  {
+    return m_holdoff_ticks;
+  }
+};
 } /* namespace interrupt_internal */
 } /* namespace base_internal */
 
@@ -47,6 +336,28 @@ enum class Interrupt_Type
   Device, /* 设备触发 */
 };
 
+/// @brief 中断风暴限流配置
+struct Interrupt_Storm_Config
+{
+  uint32_t max_count;  /* 窗口内允许的最大中断次数 (0为不限流) */
+  uint32_t window_us;  /* 统计窗口 (微秒) */
+  uint32_t holdoff_ms; /* 触发后屏蔽时长 (毫秒) */
+};
+
+/// @brief 中断统计
+struct Interrupt_Stats
+{
+  Interrupt_Channel_t irq;           /* 中断通道 */
+  uint32_t            count;         /* 中断次数 */
+  uint32_t            max_cycles;    /* 同步处理最长耗时 (CPU周期) */
+  uint64_t            total_cycles;  /* 同步处理累计耗时 (CPU周期) */
+  uint32_t            deferred;      /* 延迟处理次数 */
+  uint32_t            max_latency;   /* 入队至线程执行最长延迟 (CPU周期) */
+  uint64_t            total_latency; /* 入队至线程执行累计延迟 (CPU周期) */
+  uint32_t            storms;        /* 风暴限流触发次数 */
+  bool                muted;         /* 当前是否被限流屏蔽 */
+};
+
 /// @brief 中断管理器
 class Interrupt_Manager final : private system::thread::Thread<base_internal::interrupt_internal::INTERRUPT_MANAGER_STACK_SIZE, 0, Interrupt_Manager>
 {
@@ -57,65 +368,380 @@ public:
 private:
   /// @brief 友元声明 中断设备基类
   friend class Interrupt_Device;
+  /// @brief 友元声明 中断分发基准测试
+  template <uint32_t Repeat>
+  friend class Interrupt_Bench;
+
+  struct Interrupt_Handle;
+
+  /// @brief 中断分发函数 (注册时按触发类型、通道判断函数与监视状态选定)
+  using Interrupt_Dispatch_t = void (*)(const Interrupt_Handle&, Interrupt_Channel_t);
+
+  /// @brief 中断监视槽位 (统计由中断与管理器线程分别写入，快照在关中断下读取)
+  struct Interrupt_Monitor
+  {
+    Interrupt_Stats                                  stats;   /* 统计 */
+    bool                                             used;    /* 槽位是否占用 */
+    base_internal::interrupt_internal::Storm_Limiter limiter; /* 风暴限流 */
+  };
 
   /// @brief 中断处理信息结构体
   struct Interrupt_Handle
   {
-    Interrupt_Type   type;         /* 触发类型 */
-    Interrupt_Func_t direct_func;  /* 同步处理函数 */
-    Interrupt_Func_t queue_func;   /* 异步线程处理函数 */
-    Interrupt_Meas_t measure_func; /* 通道判断函数 */
-    Interrupt_Args_t arg;          /* 函数参数 */
+    Interrupt_Dispatch_t dispatch;     /* 分发函数 */
+    Interrupt_Type       type;         /* 触发类型 */
+    Interrupt_Func_t     direct_func;  /* 同步处理函数 */
+    Interrupt_Func_t     queue_func;   /* 异步线程处理函数 */
+    Interrupt_Meas_t     measure_func; /* 通道判断函数 */
+    Interrupt_Args_t     arg;          /* 函数参数 */
+    Interrupt_Monitor*   monitor;      /* 监视槽位 (未开启统计为空) */
   };
 
   /// @brief 队列数据结构体
   struct Queue_Data
   {
-    Interrupt_Channel_t irq;     /* 触发通道 */
-    uint8_t             channel; /* 触发通道编号 */
+    uint8_t  irq;     /* 触发通道 */
+    uint8_t  channel; /* 触发通道编号 */
+    uint32_t stamp;   /* 入队时刻 (CPU周期，仅监视通道) */
   };
 
-  /// @brief 中断管理器 队列类型
-  using Interrupt_Queue_t                  = system::kernel::Message_Queue<Queue_Data, base_internal::interrupt_internal::INTERRUPT_MANAGER_MASSAGE_QUEUE_SIZE>;
-  /// @brief 中断管理器 队列名称
-  static constexpr const char* QUEUE_NAME  = "Interrupt Manager Queue";
+  /// @brief 中断管理器 延迟处理队列类型
+  using Interrupt_Queue_t                      = base_internal::interrupt_internal::Isr_Ring<Queue_Data, base_internal::interrupt_internal::INTERRUPT_MANAGER_MASSAGE_QUEUE_SIZE>;
+  /// @brief 中断管理器 唤醒信号量名称
+  static constexpr const char* SEMAPHORE_NAME  = "Interrupt Manager Semaphore";
   /// @brief 中断管理器 线程名称
-  static constexpr const char* THREAD_NAME = "Interrupt Manager Thread";
-  /// @brief 中断管理器 队列实例
+  static constexpr const char* THREAD_NAME     = "Interrupt Manager Thread";
+  /// @brief 中断管理器 延迟处理队列实例
   Interrupt_Queue_t            m_queue;
+  /// @brief 中断管理器 唤醒信号量 (二值)
+  system::kernel::Semaphore    m_wake;
+  /// @brief 中断管理器 线程等待唤醒标志
+  std::atomic_bool             m_sleeping      = false;
+  /// @brief 中断管理器 队列满丢弃次数
+  std::atomic<uint32_t>        m_dropped       = 0;
+  /// @brief 中断管理器 风暴待处理标志
+  std::atomic_bool             m_storm_pending = false;
   /// @brief 中断管理器 中断处理信息结构体数组
   Interrupt_Handle             m_interrupts[MAX_INTERRUPTS];
+  /// @brief 中断管理器 监视槽位数组
+  Interrupt_Monitor            m_monitors[base_internal::interrupt_internal::INTERRUPT_MANAGER_MONITOR_COUNT];
 
   /// @brief 中断管理器 线程任务
   THREAD_TASK
   {
-    Interrupt_Queue_t::Status status;
-    Queue_Data                data;
+    Queue_Data data;
+    uint32_t   timeout = TX_WAIT_FOREVER;
     while (1)
     {
-      status = m_queue.receive(data, TX_WAIT_FOREVER);
-      if (status == Interrupt_Queue_t::Status::SUCCESS)
+      while (m_queue.pop(data))
       {
-        Interrupt_Handle& handle = m_interrupts[data.irq];
+        const Interrupt_Handle& handle = m_interrupts[data.irq];
         if (handle.type != Interrupt_Type::Direct)
         {
+          // 入队后才开启统计的条目不带时间戳
+          if ((nullptr != handle.monitor) && (0 != data.stamp))
+          {
+            record_latency(*handle.monitor, cycle_count() - data.stamp);
+          }
+
           if (nullptr != handle.queue_func)
           {
             handle.queue_func(handle.arg, data.channel);
           }
         }
       }
+
+      // 有风暴事件或有通道待解除屏蔽时处理限流
+      if (m_storm_pending.exchange(false, std::memory_order_acq_rel) || (TX_WAIT_FOREVER != timeout))
+      {
+        timeout = service_storms();
+      }
+
+      // 先声明等待再复查队列，避免与入队唤醒竞争而丢失唤醒
+      m_sleeping.store(true, std::memory_order_seq_cst);
+      if (m_queue.empty() && !m_storm_pending.load(std::memory_order_seq_cst))
+      {
+        m_wake.acquire(timeout);
+      }
+      m_sleeping.store(false, std::memory_order_relaxed);
+    }
+  }
+
+  /**
+   * @brief  中断管理器 读取CPU周期计数
+   *
+   * @return uint32_t 周期计数
+   */
+  static QAQ_INLINE uint32_t cycle_count(void)
+  {
+    return DWT->CYCCNT;
+  }
+
+  /**
+   * @brief  中断管理器 唤醒管理器线程 (线程等待中才释放信号量)
+   */
+  void wake(void)
+  {
+    if (m_sleeping.exchange(false, std::memory_order_seq_cst))
+    {
+      m_wake.ceiling(1);
+    }
+  }
+
+  /**
+   * @brief  中断管理器 监视通道准入 (中断中调用，计数并检测风暴)
+   *
+   * @param  monitor  监视槽位
+   * @param  irq      中断通道
+   * @param  now      当前时刻 (CPU周期)
+   * @return true     正常处理
+   * @return false    触发风暴，通道已屏蔽，本次中断丢弃
+   */
+  bool admit(Interrupt_Monitor& monitor, Interrupt_Channel_t irq, uint32_t now)
+  {
+    bool ret = true;
+
+    monitor.stats.count++;
+
+    if (!monitor.limiter.admit(now))
+    {
+      NVIC_DisableIRQ(irq);
+      monitor.stats.storms++;
+      monitor.stats.muted = true;
+      m_storm_pending.store(true, std::memory_order_seq_cst);
+      wake();
+      ret = false;
+    }
+
+    return ret;
+  }
+
+  /**
+   * @brief  中断管理器 记录同步处理耗时 (中断中调用)
+   *
+   * @param  monitor  监视槽位
+   * @param  cycles   耗时 (CPU周期)
+   */
+  static QAQ_INLINE void record_cycles(Interrupt_Monitor& monitor, uint32_t cycles)
+  {
+    monitor.stats.total_cycles += cycles;
+    if (cycles > monitor.stats.max_cycles)
+    {
+      monitor.stats.max_cycles = cycles;
+    }
+  }
+
+  /**
+   * @brief  中断管理器 记录延迟处理时延 (管理器线程中调用)
+   *
+   * @param  monitor  监视槽位
+   * @param  latency  时延 (CPU周期)
+   */
+  static void record_latency(Interrupt_Monitor& monitor, uint32_t latency)
+  {
+    monitor.stats.deferred++;
+    monitor.stats.total_latency += latency;
+    if (latency > monitor.stats.max_latency)
+    {
+      monitor.stats.max_latency = latency;
+    }
+  }
+
+  /**
+   * @brief  中断管理器 处理风暴限流 (管理器线程中调用)
+   *
+   * @note   新触发的风暴记录警告日志并确定解除时刻，到期后重新使能通道;
+   *         通道在屏蔽期间被注销则不再使能
+   * @return uint32_t 距最近一次解除屏蔽的等待节拍，无屏蔽通道返回 TX_WAIT_FOREVER
+   */
+  uint32_t service_storms(void)
+  {
+    uint32_t       ret = TX_WAIT_FOREVER;
+    const uint32_t now = tx_time_get();
+
+    for (Interrupt_Monitor& monitor : m_monitors)
+    {
+      bool report = false;
+
+      {
+        system::kernel::Interrupt_Guard guard;
+
+        if (monitor.used && monitor.stats.muted)
+        {
+          report = monitor.limiter.arm(now);
+
+          const uint32_t remain = monitor.limiter.remain(now);
+          if (0 == remain)
+          {
+            monitor.stats.muted = false;
+            if (dispatch_none != m_interrupts[monitor.stats.irq].dispatch)
+            {
+              enable_interrupt(monitor.stats.irq);
+            }
+          }
+          else if (remain < ret)
+          {
+            ret = remain;
+          }
+        }
+      }
+
+      if (report)
+      {
+        QAQ_WARNING_LOG(static_cast<uint32_t>(monitor.stats.irq), "Interrupt storm, line masked");
+      }
+    }
+
+    return ret;
+  }
+
+  /**
+   * @brief  中断管理器 延迟处理入队 (中断中调用)
+   *
+   * @param  irq      中断通道
+   * @param  channel  通道编号
+   * @param  stamp    入队时刻 (CPU周期，未监视为0)
+   */
+  void enqueue(Interrupt_Channel_t irq, uint8_t channel, uint32_t stamp)
+  {
+    if (!m_queue.push({ static_cast<uint8_t>(irq), channel, stamp }))
+    {
+      m_dropped.fetch_add(1, std::memory_order_relaxed);
+    }
+    else
+    {
+      wake();
+    }
+  }
+
+  /**
+   * @brief  中断管理器 空分发 (未注册通道)
+   */
+  static void dispatch_none(const Interrupt_Handle&, Interrupt_Channel_t) {}
+
+  /**
+   * @brief  中断管理器 分发函数模板 (触发类型、通道判断与监视在编译期展开，中断路径无分支)
+   *
+   * @tparam Type       触发类型
+   * @tparam Measured   是否带通道判断函数
+   * @tparam Monitored  是否开启统计与风暴检测
+   * @param  handle     中断处理信息
+   * @param  irq        中断通道
+   */
+  template <Interrupt_Type Type, bool Measured, bool Monitored>
+  static void dispatch(const Interrupt_Handle& handle, Interrupt_Channel_t irq)
+  {
+    uint8_t channel = 0;
+
+    if constexpr (Monitored)
+    {
+      if (!get_instance().admit(*handle.monitor, irq, cycle_count()))
+      {
+        return;
+      }
+    }
+
+    if constexpr (Measured)
+    {
+      channel = handle.measure_func();
+    }
+
+    if constexpr (Interrupt_Type::Queue != Type)
+    {
+      if constexpr (Monitored)
+      {
+        const uint32_t start = cycle_count();
+        handle.direct_func(handle.arg, channel);
+        record_cycles(*handle.monitor, cycle_count() - start);
+      }
+      else
+      {
+        handle.direct_func(handle.arg, channel);
+      }
+    }
+
+    if constexpr (Interrupt_Type::Queue == Type || Interrupt_Type::Mixed == Type)
+    {
+      const uint32_t stamp = Monitored ? cycle_count() : 0;
+      get_instance().enqueue(irq, channel, stamp);
     }
   }
 
+  /**
+   * @brief  中断管理器 选择分发函数变体
+   *
+   * @tparam Type       触发类型
+   * @param  measured   是否带通道判断函数
+   * @param  monitored  是否开启统计与风暴检测
+   * @return Interrupt_Dispatch_t 分发函数
+   */
+  template <Interrupt_Type Type>
+  static Interrupt_Dispatch_t dispatch_variant(bool measured, bool monitored)
+  {
+    static constexpr Interrupt_Dispatch_t variants[2][2] = {
+      {&dispatch<Type, false, false>, &dispatch<Type, false, true>},
+      {&dispatch<Type, true, false>,  &dispatch<Type, true, true> },
+    };
+
+    return variants[measured][monitored];
+  }
+
+  /**
+   * @brief  中断管理器 选择分发函数
+   *
+   * @param  handle  中断处理信息
+   * @return Interrupt_Dispatch_t 分发函数
+   */
+  static Interrupt_Dispatch_t select_dispatch(const Interrupt_Handle& handle)
+  {
+    Interrupt_Dispatch_t ret       = dispatch_none;
+    const bool           measured  = (nullptr != handle.measure_func);
+    const bool           monitored = (nullptr != handle.monitor);
+
+    switch (handle.type)
+    {
+      case Interrupt_Type::Direct :
+      case Interrupt_Type::Device :
+        if (nullptr != handle.direct_func)
+        {
+          ret = dispatch_variant<Interrupt_Type::Direct>(measured, monitored);
+        }
+        break;
+      case Interrupt_Type::Queue :
+        ret = dispatch_variant<Interrupt_Type::Queue>(measured, monitored);
+        break;
+      case Interrupt_Type::Mixed :
+        if (nullptr != handle.direct_func)
+        {
+          ret = dispatch_variant<Interrupt_Type::Mixed>(measured, monitored);
+        }
+        else
+        {
+          ret = dispatch_variant<Interrupt_Type::Queue>(measured, monitored);
+        }
+        break;
+      default :
+        break;
+    }
+
+    return ret;
+  }
+
 private:
   /**
    * @brief 中断管理器 构造函数
    *
    */
-  explicit Interrupt_Manager() : m_queue(QUEUE_NAME)
+  explicit Interrupt_Manager() : m_wake(0, SEMAPHORE_NAME)
   {
-    memset(m_interrupts, 0, sizeof(m_interrupts));
+    for (uint32_t i = 0; i < MAX_INTERRUPTS; ++i)
+    {
+      m_interrupts[i] = { dispatch_none, Interrupt_Type::Direct, nullptr, nullptr, nullptr, nullptr, nullptr };
+    }
+    for (Interrupt_Monitor& monitor : m_monitors)
+    {
+      monitor = {};
+    }
     this->create(THREAD_NAME, base_internal::interrupt_internal::INTERRUPT_MANAGER_PRIORITY);
     this->start();
   }
@@ -150,6 +776,14 @@ private:
     m_interrupts[irq].queue_func   = handle.queue_func;
     m_interrupts[irq].measure_func = handle.measure_func;
     m_interrupts[irq].arg          = handle.arg;
+    m_interrupts[irq].dispatch     = select_dispatch(m_interrupts[irq]);
+
+    // 监视槽位跨注册保留，重新注册解除限流屏蔽
+    if (nullptr != m_interrupts[irq].monitor)
+    {
+      m_interrupts[irq].monitor->stats.muted = false;
+      m_interrupts[irq].monitor->limiter.release();
+    }
 
     set_interrupt_priority(irq, priority, subpriority);
     enable_interrupt(irq);
@@ -173,6 +807,7 @@ private:
 
     system::kernel::Interrupt_Guard guard;
 
+    m_interrupts[irq].dispatch     = dispatch_none;
     m_interrupts[irq].type         = Interrupt_Type::Direct;
     m_interrupts[irq].direct_func  = nullptr;
     m_interrupts[irq].queue_func   = nullptr;
@@ -198,7 +833,7 @@ private:
    */
   bool register_device(Interrupt_Channel_t irq, Interrupt_Func_t direct_func, Interrupt_Func_t queue_func, Interrupt_Args_t arg, uint32_t priority, uint32_t subpriority)
   {
-    Interrupt_Handle handle = { Interrupt_Type::Device, direct_func, queue_func, nullptr, arg };
+    Interrupt_Handle handle = { nullptr, Interrupt_Type::Device, direct_func, queue_func, nullptr, arg, nullptr };
     return register_handle(irq, handle, priority, subpriority);
   }
 
@@ -217,53 +852,224 @@ public:
   /**
    * @brief 中断管理器 中断处理函数
    *
-   * @note  该函数由中断服务程序调用，不应在外部调用
+   * @note  该函数由中断服务程序调用，不应在外部调用; 经分发表一次间接调用，无类型判断分支
    * @param irq       中断通道
    */
-  void irq_handler(Interrupt_Channel_t irq)
+  QAQ_INLINE void irq_handler(Interrupt_Channel_t irq)
+  {
+    const Interrupt_Handle& handle = m_interrupts[irq];
+    handle.dispatch(handle, irq);
+  }
+
+  /**
+   * @brief  中断管理器 获取延迟处理队列满丢弃次数
+   *
+   * @return uint32_t 丢弃次数
+   */
+  uint32_t dropped(void) const
   {
-    Interrupt_Handle& handle = m_interrupts[irq];
+    return m_dropped.load(std::memory_order_relaxed);
+  }
+
+  /**
+   * @brief  中断管理器 开启中断统计 (已开启则更新限流配置并清零统计)
+   *
+   * @note   统计经专用分发变体完成，未开启的通道无额外开销; 风暴限流屏蔽整个 NVIC 通道，
+   *         共享通道 (如 EXTI9_5、EXTI15_10) 上的所有线会一并屏蔽，到期由管理器线程重新使能;
+   *         屏蔽期间到来的中断在外设中保持挂起，解除后处理一次;
+   *         限流窗口须小于 DWT 周期计数一次回绕 (480MHz 下约 8.9 秒)，超出的配置被拒绝
+   * @param  irq     中断通道
+   * @param  storm   风暴限流配置 (max_count 为0不限流)
+   * @return true    成功
+   * @return false   通道无效、监视槽位已满或限流配置超出范围
+   */
+  bool monitor(Interrupt_Channel_t irq, const Interrupt_Storm_Config& storm = { 0, 0, 0 })
+  {
+    bool ret = false;
 
-    if (handle.measure_func == nullptr)
+    if ((irq >= 0) && (static_cast<uint32_t>(irq) < MAX_INTERRUPTS))
     {
-      if (handle.type == Interrupt_Type::Direct || handle.type == Interrupt_Type::Device)
+      // 使能 DWT 周期计数 (处理耗时与时延统计)
+      CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+      DWT->LAR          = 0xC5ACCE55;
+      DWT->CTRL        |= DWT_CTRL_CYCCNTENA_Msk;
+
+      system::kernel::Interrupt_Guard guard;
+
+      Interrupt_Handle&  handle  = m_interrupts[irq];
+      Interrupt_Monitor* monitor = handle.monitor;
+
+      for (uint32_t i = 0; (nullptr == monitor) && (i < base_internal::interrupt_internal::INTERRUPT_MANAGER_MONITOR_COUNT); ++i)
       {
-        handle.direct_func(handle.arg, 0);
+        if (!m_monitors[i].used)
+        {
+          monitor = &m_monitors[i];
+        }
       }
-      else if (handle.type == Interrupt_Type::Queue)
+
+      base_internal::interrupt_internal::Storm_Limiter limiter;
+
+      if ((nullptr != monitor) && limiter.configure(storm.max_count, storm.window_us, storm.holdoff_ms, SystemCoreClock, cycle_count(), tx_time_get()))
       {
-        Queue_Data data = { irq, 0 };
-        m_queue.send(data);
+        const bool muted     = monitor->stats.muted;
+
+        *monitor             = {};
+        monitor->used        = true;
+        monitor->limiter     = limiter;
+        monitor->stats.irq   = irq;
+        monitor->stats.muted = muted;
+
+        handle.monitor       = monitor;
+        handle.dispatch      = select_dispatch(handle);
+        ret                  = true;
       }
-      else if (handle.type == Interrupt_Type::Mixed)
+    }
+
+    return ret;
+  }
+
+  /**
+   * @brief  中断管理器 关闭中断统计 (释放监视槽位，限流屏蔽中的通道立即恢复)
+   *
+   * @param  irq     中断通道
+   * @return true    成功
+   * @return false   通道无效或未开启统计
+   */
+  bool unmonitor(Interrupt_Channel_t irq)
+  {
+    bool ret = false;
+
+    if ((irq >= 0) && (static_cast<uint32_t>(irq) < MAX_INTERRUPTS))
+    {
+      system::kernel::Interrupt_Guard guard;
+
+      Interrupt_Handle& handle = m_interrupts[irq];
+
+      if (nullptr != handle.monitor)
       {
-        Queue_Data data = { irq, 0 };
-        handle.direct_func(handle.arg, 0);
-        m_queue.send(data);
+        if (handle.monitor->stats.muted && (dispatch_none != handle.dispatch))
+        {
+          enable_interrupt(irq);
+        }
+
+        *handle.monitor = {};
+        handle.monitor  = nullptr;
+        handle.dispatch = select_dispatch(handle);
+        ret             = true;
       }
     }
-    else
+
+    return ret;
+  }
+
+  /**
+   * @brief  中断管理器 获取中断统计快照
+   *
+   * @param  irq     中断通道
+   * @param  stats   统计输出
+   * @return true    成功
+   * @return false   通道无效或未开启统计
+   */
+  bool stats(Interrupt_Channel_t irq, Interrupt_Stats& stats) const
+  {
+    bool ret = false;
+
+    if ((irq >= 0) && (static_cast<uint32_t>(irq) < MAX_INTERRUPTS))
     {
-      uint8_t channel = handle.measure_func();
+      system::kernel::Interrupt_Guard guard;
 
-      if (handle.type == Interrupt_Type::Direct || handle.type == Interrupt_Type::Device)
+      if (nullptr != m_interrupts[irq].monitor)
       {
-        handle.direct_func(handle.arg, channel);
+        stats = m_interrupts[irq].monitor->stats;
+        ret   = true;
       }
-      else if (handle.type == Interrupt_Type::Queue)
+    }
+
+    return ret;
+  }
+
+  /**
+   * @brief  中断管理器 获取全部已监视通道的统计快照
+   *
+   * @param  stats     统计输出数组
+   * @param  max       数组容量
+   * @return uint32_t  输出的通道数量
+   */
+  uint32_t snapshot(Interrupt_Stats* stats, uint32_t max) const
+  {
+    uint32_t ret = 0;
+
+    for (const Interrupt_Monitor& monitor : m_monitors)
+    {
+      if (ret >= max)
       {
-        Queue_Data data = { irq, channel };
-        m_queue.send(data);
+        break;
       }
-      else if (handle.type == Interrupt_Type::Mixed)
+
+      system::kernel::Interrupt_Guard guard;
+
+      if (monitor.used)
       {
-        Queue_Data data = { irq, channel };
-        handle.direct_func(handle.arg, channel);
-        m_queue.send(data);
+        stats[ret++] = monitor.stats;
+      }
+    }
+
+    return ret;
+  }
+
+  /**
+   * @brief  中断管理器 清零中断统计 (保留限流配置与屏蔽状态)
+   *
+   * @param  irq     中断通道
+   */
+  void reset_stats(Interrupt_Channel_t irq)
+  {
+    if ((irq >= 0) && (static_cast<uint32_t>(irq) < MAX_INTERRUPTS))
+    {
+      system::kernel::Interrupt_Guard guard;
+
+      Interrupt_Monitor* monitor = m_interrupts[irq].monitor;
+
+      if (nullptr != monitor)
+      {
+        const bool muted     = monitor->stats.muted;
+
+        monitor->stats       = {};
+        monitor->stats.irq   = irq;
+        monitor->stats.muted = muted;
       }
     }
   }
 
+  /**
+   * @brief  中断管理器 输出全部已监视通道的统计至系统监视器日志
+   */
+  void log_stats(void) const
+  {
+    Interrupt_Stats stats[base_internal::interrupt_internal::INTERRUPT_MANAGER_MONITOR_COUNT];
+    const uint32_t  count = snapshot(stats, base_internal::interrupt_internal::INTERRUPT_MANAGER_MONITOR_COUNT);
+
+    for (uint32_t i = 0; i < count; ++i)
+    {
+      const Interrupt_Stats& item = stats[i];
+
+      QAQ_INFO_LOG("IRQ %ld: count %lu, cycles max %lu avg %lu, latency max %lu avg %lu, storms %lu%s\n",
+                   static_cast<int32_t>(item.irq),
+                   item.count,
+                   item.max_cycles,
+                   (0 != item.count) ? static_cast<uint32_t>(item.total_cycles / item.count) : 0U,
+                   item.max_latency,
+                   (0 != item.deferred) ? static_cast<uint32_t>(item.total_latency / item.deferred) : 0U,
+                   item.storms,
+                   item.muted ? " (masked)" : "");
+    }
+
+    if (0 != dropped())
+    {
+      QAQ_INFO_LOG("IRQ deferred queue dropped %lu\n", dropped());
+    }
+  }
+
   /**
    * @brief  中断管理器 注册中断处理函数 (同步或异步模式)
    *
@@ -281,12 +1087,12 @@ public:
   {
     if (Interrupt_Type::Direct == type)
     {
-      Interrupt_Handle handle = { Interrupt_Type::Direct, function, nullptr, measure_func, arg };
+      Interrupt_Handle handle = { nullptr, Interrupt_Type::Direct, function, nullptr, measure_func, arg, nullptr };
       return register_handle(irq, handle, priority, subpriority);
     }
     else if (Interrupt_Type::Queue == type)
     {
-      Interrupt_Handle handle = { Interrupt_Type::Queue, nullptr, function, measure_func, arg };
+      Interrupt_Handle handle = { nullptr, Interrupt_Type::Queue, nullptr, function, measure_func, arg, nullptr };
       return register_handle(irq, handle, priority, subpriority);
     }
     else
@@ -310,7 +1116,7 @@ public:
    */
   bool register_interrupt(Interrupt_Channel_t irq, Interrupt_Func_t direct_func, Interrupt_Func_t queue_func, Interrupt_Args_t arg, Interrupt_Meas_t measure_func, uint32_t priority, uint32_t subpriority)
   {
-    Interrupt_Handle handle = { Interrupt_Type::Mixed, direct_func, queue_func, measure_func, arg };
+    Interrupt_Handle handle = { nullptr, Interrupt_Type::Mixed, direct_func, queue_func, measure_func, arg, nullptr };
     return register_handle(irq, handle, priority, subpriority);
   }
 
@@ -426,7 +1232,8 @@ protected:
    */
   static void send_to_queue(Interrupt_Channel_t irq, uint8_t channel)
   {
-    Interrupt_Manager::get_instance().m_queue.send({ irq, channel });
+    Interrupt_Manager& manager = Interrupt_Manager::get_instance();
+    manager.enqueue(irq, channel, (nullptr != manager.m_interrupts[irq].monitor) ? Interrupt_Manager::cycle_count() : 0);
   }
 
   /**
@@ -474,4 +1281,14 @@ extern "C" void trace_isr_exit(void);
     trace_isr_exit();                                                                \
   }
 
+/// @brief 定义静态绑定的中断处理函数宏 (处理函数与参数在编译期写入向量函数，绕过中断管理器分发表)
+/// @note  仅用于未由库头文件定义向量函数的中断通道，需自行设置优先级并使能中断
+#define INTERRUPT_STATIC_HANDLER(irq, func, arg) \
+  extern "C" void irq##_IRQHandler()             \
+  {                                              \
+    trace_isr_enter();                           \
+    func(arg, 0);                                \
+    trace_isr_exit();                            \
+  }
+
 #endif /* __INTERRUPT_HPP__ */
@@ -0,0 +1,44 @@
+/**
+ * @file   interrupt_bench.cpp
+ * @brief  中断分发 主机基准测试入口
+ *
+ * @note   仅用于主机，不参与固件编译 (已加入 eide excludeList);
+ *         目标板直接在线程中调用 Interrupt_Bench<>::run() 并以串口输出表格 (含旧实现的 ThreadX 队列耗时)
+ *
+ *         构建 (仓库根目录):
+ *         g++ -std=c++17 -O2 -fpermissive -w \
+ *             $(python3 -c "import json;c=json.load(open('.eide/eide.json'))['targets']['Debug']['custom_dep'];print(' '.join(['-I'+p for p in c['incList']]+['-D'+d for d in c['defineList']]))") \
+ *             api/base/interrupt/interrupt_bench.cpp -o interrupt_bench && ./interrupt_bench
+ */
+#include "interrupt_bench.hpp"
+
+#include <cstdio>
+
+uint32_t SystemCoreClock = 480000000;
+
+/* ThreadX 桩函数 (基准测试不创建内核对象，仅满足头文件中内联函数的链接) */
+extern "C"
+{
+  ULONG _tx_time_get(VOID)
+  {
+    return 0;
+  }
+
+  TX_THREAD* _tx_thread_identify(VOID)
+  {
+    return nullptr;
+  }
+
+  UINT _tx_thread_sleep(ULONG)
+  {
+    return TX_SUCCESS;
+  }
+
+  VOID _tx_thread_relinquish(VOID) {}
+}
+
+int main(void)
+{
+  QAQ::base::interrupt::Interrupt_Bench<200000>::run([](const char* line) { puts(line); });
+  return 0;
+}
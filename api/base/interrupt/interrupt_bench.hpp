@@ -0,0 +1,393 @@
+#ifndef __INTERRUPT_BENCH_HPP__
+#define __INTERRUPT_BENCH_HPP__
+
+#include "interrupt.hpp"
+
+#include <stdio.h>
+
+#if defined(__arm__)
+#include "message_queue.hpp"
+#else
+#include <chrono>
+#endif
+
+/**
+ * @note  中断分发 基准测试: 对比表驱动分发 (dispatch<> 跳板 + 无锁延迟队列)、静态绑定 (INTERRUPT_STATIC_HANDLER)
+ *        与此前按触发类型逐级分支、经 tx_queue_send 入队的实现 (按原实现重建);
+ *        向量入口至处理函数: 向量函数经分发调用 (空) 处理函数的平均耗时，扣除空向量函数的调用开销 (硬件压栈对各路径相同，不计入);
+ *        延迟处理: 中断侧入队与线程侧出队耗时，二者之和加一次线程切换即入队至处理的时延;
+ *        目标板以 DWT 周期计数，主机以纳秒计时; 旧实现的入队/出队依赖 ThreadX 队列，仅在目标板测量;
+ *        目标板在线程中调用 Interrupt_Bench::run() 输出表格，主机由 interrupt_bench.cpp 运行
+ */
+
+/// @brief 名称空间 QAQ
+namespace QAQ
+{
+/// @brief 名称空间 基本对象
+namespace base
+{
+/// @brief 命名空间 内部
+namespace base_internal
+{
+/// @brief 名称空间 中断 内部
+namespace interrupt_internal
+{
+/// @brief 命名空间 基准测试
+namespace bench
+{
+/**
+ * @brief  读取时间戳 (目标板: CPU周期，主机: 纳秒)
+ *
+ * @return uint32_t  时间戳
+ */
+QAQ_INLINE uint32_t timestamp(void) noexcept
+{
+#if defined(__arm__)
+  return DWT->CYCCNT;
+#else
+  return static_cast<uint32_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count());
+#endif
+}
+
+/// @brief 时间戳单位
+#if defined(__arm__)
+constexpr const char* TIMESTAMP_UNIT = "cycles";
+#else
+constexpr const char* TIMESTAMP_UNIT = "ns";
+#endif
+
+/// @brief 处理次数 (按通道编号累加)
+inline volatile uint32_t g_handled = 0;
+
+/**
+ * @brief  处理函数
+ */
+__attribute__((noinline)) inline void count_handler(void*, uint8_t channel)
+{
+  g_handled = g_handled + channel + 1U;
+}
+
+/**
+ * @brief  通道判断函数
+ */
+__attribute__((noinline)) inline uint8_t measure_channel(void)
+{
+  return 3;
+}
+
+/// @brief 旧实现 中断处理信息
+struct Legacy_Handle
+{
+  interrupt::Interrupt_Type   type;         /* 触发类型 */
+  interrupt::Interrupt_Func_t direct_func;  /* 同步处理函数 */
+  interrupt::Interrupt_Func_t queue_func;   /* 异步线程处理函数 */
+  interrupt::Interrupt_Meas_t measure_func; /* 通道判断函数 */
+  interrupt::Interrupt_Args_t arg;          /* 函数参数 */
+};
+
+/// @brief 旧实现 队列数据
+struct Legacy_Queue_Data
+{
+  interrupt::Interrupt_Channel_t irq;     /* 触发通道 */
+  uint8_t                        channel; /* 触发通道编号 */
+};
+
+/// @brief 旧实现 中断处理信息表
+inline Legacy_Handle g_legacy[interrupt::Interrupt_Manager::MAX_INTERRUPTS];
+
+/**
+ * @brief  旧实现 中断处理函数 (按通道判断函数与触发类型逐级分支，延迟部分不入队)
+ */
+__attribute__((noinline)) inline void legacy_irq_handler(interrupt::Interrupt_Channel_t irq)
+{
+  Legacy_Handle& handle = g_legacy[irq];
+
+  if (handle.measure_func == nullptr)
+  {
+    if (handle.type == interrupt::Interrupt_Type::Direct || handle.type == interrupt::Interrupt_Type::Device)
+    {
+      handle.direct_func(handle.arg, 0);
+    }
+    else if (handle.type == interrupt::Interrupt_Type::Mixed)
+    {
+      handle.direct_func(handle.arg, 0);
+    }
+  }
+  else
+  {
+    uint8_t channel = handle.measure_func();
+
+    if (handle.type == interrupt::Interrupt_Type::Direct || handle.type == interrupt::Interrupt_Type::Device)
+    {
+      handle.direct_func(handle.arg, channel);
+    }
+    else if (handle.type == interrupt::Interrupt_Type::Mixed)
+    {
+      handle.direct_func(handle.arg, channel);
+    }
+  }
+}
+} /* namespace bench */
+} /* namespace interrupt_internal */
+} /* namespace base_internal */
+
+/// @brief 名称空间 中断
+namespace interrupt
+{
+/**
+ * @brief 中断分发 基准测试
+ *
+ * @tparam Repeat  每项的重复次数
+ */
+template <uint32_t Repeat = 1000>
+class Interrupt_Bench final
+{
+public:
+  /// @brief 输出函数类型 (每次输出一行，不含换行符)
+  using Print_Func_t = void (*)(const char*);
+
+private:
+  /// @brief 测试通道 (仅使用分发表中的条目，不使能中断)
+  static constexpr Interrupt_Channel_t BENCH_IRQ = EXTI0_IRQn;
+
+  /// @brief 分发表
+  static inline Interrupt_Manager::Interrupt_Handle s_table[Interrupt_Manager::MAX_INTERRUPTS];
+  /// @brief 延迟处理队列
+  static inline Interrupt_Manager::Interrupt_Queue_t s_ring;
+
+  /**
+   * @brief  向量函数 旧实现
+   */
+  __attribute__((noinline)) static void legacy_vector(void)
+  {
+    base_internal::interrupt_internal::bench::legacy_irq_handler(BENCH_IRQ);
+  }
+
+  /**
+   * @brief  向量函数 表驱动分发 (与 Interrupt_Manager::irq_handler 相同)
+   */
+  __attribute__((noinline)) static void table_vector(void)
+  {
+    const Interrupt_Manager::Interrupt_Handle& handle = s_table[BENCH_IRQ];
+    handle.dispatch(handle, BENCH_IRQ);
+  }
+
+  /**
+   * @brief  向量函数 静态绑定 (与 INTERRUPT_STATIC_HANDLER 相同)
+   */
+  __attribute__((noinline)) static void static_vector(void)
+  {
+    base_internal::interrupt_internal::bench::count_handler(nullptr, 0);
+  }
+
+  /**
+   * @brief  空向量函数 (调用与循环开销基线)
+   */
+  __attribute__((noinline)) static void empty_vector(void)
+  {
+    __asm__ volatile("" ::: "memory");
+  }
+
+  /**
+   * @brief  测量向量函数经分发调用处理函数的平均耗时 (扣除空向量函数的调用与循环开销)
+   *
+   * @param  vector  向量函数
+   * @return double  平均耗时
+   */
+  static double measure_entry(void (*vector)(void)) noexcept
+  {
+    using namespace base_internal::interrupt_internal::bench;
+
+    void (*volatile call)(void) = empty_vector;
+    uint32_t start              = timestamp();
+
+    for (uint32_t r = 0; r < Repeat; ++r)
+    {
+      call();
+    }
+
+    const uint32_t overhead = timestamp() - start;
+
+    call  = vector;
+    start = timestamp();
+
+    for (uint32_t r = 0; r < Repeat; ++r)
+    {
+      call();
+    }
+
+    const uint32_t total = timestamp() - start;
+
+    return (total > overhead) ? static_cast<double>(total - overhead) / Repeat : 0.0;
+  }
+
+  /**
+   * @brief  测量无锁延迟队列的入队与出队平均耗时
+   *
+   * @param  push  入队平均耗时
+   * @param  pop   出队平均耗时
+   */
+  static void measure_ring(uint32_t& push, uint32_t& pop) noexcept
+  {
+    using namespace base_internal::interrupt_internal::bench;
+    using namespace base_internal::interrupt_internal;
+
+    constexpr uint32_t BATCH = INTERRUPT_MANAGER_MASSAGE_QUEUE_SIZE / 2;
+
+    Interrupt_Manager::Queue_Data data   = { static_cast<uint8_t>(BENCH_IRQ), 0, 0 };
+    uint32_t                      pushed = 0;
+    uint32_t                      popped = 0;
+
+    for (uint32_t r = 0; r < Repeat; ++r)
+    {
+      uint32_t start = timestamp();
+
+      for (uint32_t i = 0; i < BATCH; ++i)
+      {
+        s_ring.push(data);
+      }
+
+      pushed += timestamp() - start;
+      start   = timestamp();
+
+      for (uint32_t i = 0; i < BATCH; ++i)
+      {
+        s_ring.pop(data);
+      }
+
+      popped += timestamp() - start;
+    }
+
+    push = pushed / (Repeat * BATCH);
+    pop  = popped / (Repeat * BATCH);
+  }
+
+#if defined(__arm__)
+  /**
+   * @brief  测量旧实现 ThreadX 队列的入队与出队平均耗时 (无等待线程时 tx_queue_send 与中断中调用的路径相同)
+   *
+   * @param  push  入队平均耗时
+   * @param  pop   出队平均耗时
+   */
+  static void measure_legacy_queue(uint32_t& push, uint32_t& pop) noexcept
+  {
+    using namespace base_internal::interrupt_internal::bench;
+    using namespace base_internal::interrupt_internal;
+
+    constexpr uint32_t BATCH = INTERRUPT_MANAGER_MASSAGE_QUEUE_SIZE / 2;
+
+    static system::kernel::Message_Queue<Legacy_Queue_Data, INTERRUPT_MANAGER_MASSAGE_QUEUE_SIZE> queue("Interrupt Bench Queue");
+
+    Legacy_Queue_Data data   = { BENCH_IRQ, 0 };
+    uint32_t          pushed = 0;
+    uint32_t          popped = 0;
+
+    for (uint32_t r = 0; r < Repeat; ++r)
+    {
+      uint32_t start = timestamp();
+
+      for (uint32_t i = 0; i < BATCH; ++i)
+      {
+        queue.send(data, TX_NO_WAIT);
+      }
+
+      pushed += timestamp() - start;
+      start   = timestamp();
+
+      for (uint32_t i = 0; i < BATCH; ++i)
+      {
+        queue.receive(data, TX_NO_WAIT);
+      }
+
+      popped += timestamp() - start;
+    }
+
+    push = pushed / (Repeat * BATCH);
+    pop  = popped / (Repeat * BATCH);
+  }
+#endif /* defined(__arm__) */
+
+  /**
+   * @brief  设置旧实现与分发表中的同步测试条目
+   *
+   * @param  measured  是否带通道判断函数
+   */
+  static void setup(bool measured) noexcept
+  {
+    using namespace base_internal::interrupt_internal::bench;
+
+    const Interrupt_Meas_t measure = measured ? measure_channel : nullptr;
+
+    g_legacy[BENCH_IRQ]         = { Interrupt_Type::Direct, count_handler, nullptr, measure, nullptr };
+    // 与 select_dispatch() 对未监视的同步条目的选择相同 (不实例化需要管理器单例与 NVIC 的变体)
+    s_table[BENCH_IRQ]          = { nullptr, Interrupt_Type::Direct, count_handler, nullptr, measure, nullptr, nullptr };
+    s_table[BENCH_IRQ].dispatch = measured ? &Interrupt_Manager::dispatch<Interrupt_Type::Direct, true, false> : &Interrupt_Manager::dispatch<Interrupt_Type::Direct, false, false>;
+  }
+
+  /**
+   * @brief  输出一行结果
+   */
+  static void report(Print_Func_t print, const char* name, double entry, const char* push, const char* pop) noexcept
+  {
+    char line[96];
+    snprintf(line, sizeof(line), "%-16s %14.1f %12s %12s", name, entry, push, pop);
+    print(line);
+  }
+
+public:
+  /**
+   * @brief  运行基准测试并输出表格
+   *
+   * @param  print  输出函数
+   */
+  static void run(Print_Func_t print) noexcept
+  {
+    char header[96];
+    char push[16];
+    char pop[16];
+
+#if defined(__arm__)
+    CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+    DWT->CTRL        |= DWT_CTRL_CYCCNTENA_Msk;
+#endif
+
+    snprintf(header, sizeof(header), "%-16s %14s %12s %12s  (%s)", "path", "entry->handler", "defer push", "defer pop", base_internal::interrupt_internal::bench::TIMESTAMP_UNIT);
+    print(header);
+
+    // 旧实现: 分支分发 + ThreadX 队列
+#if defined(__arm__)
+    uint32_t legacy_push = 0;
+    uint32_t legacy_pop  = 0;
+    measure_legacy_queue(legacy_push, legacy_pop);
+    snprintf(push, sizeof(push), "%lu", static_cast<unsigned long>(legacy_push));
+    snprintf(pop, sizeof(pop), "%lu", static_cast<unsigned long>(legacy_pop));
+#else
+    snprintf(push, sizeof(push), "-");
+    snprintf(pop, sizeof(pop), "-");
+#endif
+
+    setup(false);
+    report(print, "legacy", measure_entry(legacy_vector), push, pop);
+    setup(true);
+    report(print, "legacy+measure", measure_entry(legacy_vector), push, pop);
+
+    // 表驱动分发 + 无锁延迟队列
+    uint32_t ring_push = 0;
+    uint32_t ring_pop  = 0;
+    measure_ring(ring_push, ring_pop);
+    snprintf(push, sizeof(push), "%lu", static_cast<unsigned long>(ring_push));
+    snprintf(pop, sizeof(pop), "%lu", static_cast<unsigned long>(ring_pop));
+
+    setup(false);
+    report(print, "table", measure_entry(table_vector), push, pop);
+    setup(true);
+    report(print, "table+measure", measure_entry(table_vector), push, pop);
+
+    report(print, "static", measure_entry(static_vector), "-", "-");
+  }
+};
+} /* namespace interrupt */
+} /* namespace base */
+} /* namespace QAQ */
+
+#endif /* __INTERRUPT_BENCH_HPP__ */
@@ -0,0 +1,261 @@
+/**
+ * @file   interrupt_test.cpp
+ * @brief  中断风暴限流 主机测试: 窗口计数、DWT 回绕、长窗口与长屏蔽时长的换算范围、屏蔽到期
+ *
+ * @note   仅用于主机，不参与固件编译 (已加入 eide excludeList);
+ *         Interrupt_Manager::admit()/service_storms() 的计数与到期判断均委托 Storm_Limiter，
+ *         此处按两者的调用顺序 (准入失败 -> arm -> remain) 驱动限流器
+ *
+ *         构建 (仓库根目录):
+ *         g++ -std=c++17 -O2 -g -fsanitize=address,undefined -fpermissive -w \
+ *             $(python3 -c "import json;c=json.load(open('.eide/eide.json'))['targets']['Debug']['custom_dep'];print(' '.join(['-I'+p for p in c['incList']]+['-D'+d for d in c['defineList']]))") \
+ *             api/base/interrupt/interrupt_test.cpp -o interrupt_test && ./interrupt_test
+ */
+#include "interrupt.hpp"
+
+#include <cstdio>
+
+using QAQ::base::base_internal::interrupt_internal::Storm_Limiter;
+
+/* ThreadX 桩函数 (测试不创建内核对象，仅满足头文件中内联函数的链接) */
+extern "C"
+{
+  ULONG _tx_time_get(VOID)
+  {
+    return 0;
+  }
+
+  TX_THREAD* _tx_thread_identify(VOID)
+  {
+    return nullptr;
+  }
+
+  UINT _tx_thread_sleep(ULONG)
+  {
+    return TX_SUCCESS;
+  }
+
+  VOID _tx_thread_relinquish(VOID) {}
+}
+
+namespace
+{
+/// @brief 仿真 CPU 频率
+constexpr uint32_t CORE_CLOCK = 480000000;
+
+/// @brief 失败的检查数
+int g_failures = 0;
+
+#define CHECK(cond)                                                  \
+  do                                                                 \
+  {                                                                  \
+    if (!(cond))                                                     \
+    {                                                                \
+      ++g_failures;                                                  \
+      printf("%s:%d: CHECK(%s) failed\n", __FILE__, __LINE__, #cond); \
+    }                                                                \
+  } while (0)
+
+/**
+ * @brief  按 service_storms() 的顺序处理一次屏蔽
+ *
+ * @param  limiter  限流器
+ * @param  now      当前时刻 (系统节拍)
+ * @param  report   输出 是否首次处理
+ * @return uint32_t 剩余节拍
+ */
+uint32_t service(Storm_Limiter& limiter, uint32_t now, bool& report)
+{
+  report = limiter.arm(now);
+  return limiter.remain(now);
+}
+} /* namespace */
+
+/**
+ * @brief  窗口计数: 超限触发，窗口结束后重新计数，窗口跨越 DWT 回绕
+ */
+static void test_window(void)
+{
+  Storm_Limiter  limiter;
+  const uint32_t start = 0xFFFFFF00U;
+
+  CHECK(limiter.configure(3, 1000, 10, CORE_CLOCK, start, 0));
+  CHECK(480000 == limiter.window_cycles() && 10 * TX_TIMER_TICKS_PER_SECOND / 1000 == limiter.holdoff_ticks());
+
+  CHECK(limiter.admit(start + 100));
+  CHECK(limiter.admit(start + 200));
+  CHECK(limiter.admit(start + 300));
+  CHECK(!limiter.admit(start + 400));
+  CHECK(!limiter.admit(start + 479999));
+
+  // 窗口结束 (跨越回绕) 后重新计数
+  CHECK(limiter.admit(start + 480000));
+  CHECK(limiter.admit(start + 480001));
+  CHECK(limiter.admit(start + 480002));
+  CHECK(!limiter.admit(start + 480003));
+}
+
+/**
+ * @brief  长窗口: 换算在64位下完成，超出32位周期计数的窗口被拒绝且不修改当前配置
+ */
+static void test_long_window(void)
+{
+  Storm_Limiter limiter;
+
+  // 8.9 秒 = 4272000000 周期 (32位内)，旧实现在此之上回绕为极短窗口
+  CHECK(limiter.configure(3, 8900000, 10, CORE_CLOCK, 0, 0));
+  CHECK(4272000000U == limiter.window_cycles());
+
+  CHECK(limiter.admit(1000000000U));
+  CHECK(limiter.admit(2000000000U));
+  CHECK(limiter.admit(3000000000U));
+  CHECK(!limiter.admit(4000000000U));
+
+  // 9 秒 = 4320000000 周期，旧实现得到 25032704 周期 (约 52 毫秒)
+  CHECK(!limiter.configure(3, 9000000, 10, CORE_CLOCK, 0, 0));
+  CHECK(!limiter.configure(1, 0xFFFFFFFFU, 10, CORE_CLOCK, 0, 0));
+  CHECK(4272000000U == limiter.window_cycles());
+
+  // 上限恰为 0xFFFFFFFF 周期
+  CHECK(limiter.configure(3, 0xFFFFFFFFU / 1000U, 10, 1000000000U, 0, 0));
+  CHECK(limiter.configure(3, 0xFFFFFFFFU, 10, 1000000U, 0, 0));
+  CHECK(0xFFFFFFFFU == limiter.window_cycles());
+  CHECK(!limiter.configure(3, 0xFFFFFFFFU, 10, 2000000U, 0, 0));
+
+  // 不限流时忽略窗口与屏蔽时长
+  CHECK(limiter.configure(0, 0xFFFFFFFFU, 0xFFFFFFFFU, CORE_CLOCK, 0, 0));
+
+  for (uint32_t i = 0; i < 1000; ++i)
+  {
+    CHECK(limiter.admit(i));
+  }
+}
+
+/**
+ * @brief  屏蔽到期: 首次处理确定解除时刻，到期后清零窗口计数，节拍回绕
+ */
+static void test_holdoff(void)
+{
+  Storm_Limiter  limiter;
+  const uint32_t tick    = 0xFFFFFFFAU;
+  const uint32_t holdoff = 10 * TX_TIMER_TICKS_PER_SECOND / 1000;
+  bool           report  = false;
+
+  CHECK(limiter.configure(2, 1000, 10, CORE_CLOCK, 0, tick));
+  CHECK(limiter.admit(1));
+  CHECK(limiter.admit(2));
+  CHECK(!limiter.admit(3));
+
+  CHECK(holdoff == service(limiter, tick, report) && report);
+  CHECK(holdoff - 1 == service(limiter, tick + 1, report) && !report);
+  CHECK(1 == service(limiter, tick + holdoff - 1, report) && !report);
+  CHECK(0 == service(limiter, tick + holdoff, report) && !report);
+
+  // 解除后同一窗口内重新计数
+  CHECK(limiter.admit(4));
+  CHECK(limiter.admit(5));
+  CHECK(!limiter.admit(6));
+  CHECK(holdoff == service(limiter, tick + 100, report) && report);
+
+  // 屏蔽中重新配置: 下一次处理立即解除
+  CHECK(limiter.configure(2, 1000, 10, CORE_CLOCK, 0, tick + 101));
+  CHECK(0 == service(limiter, tick + 101, report) && !report);
+
+  // 屏蔽中重新注册: 立即解除，窗口重新计数，未处理的屏蔽不再记录
+  CHECK(limiter.admit(1));
+  CHECK(limiter.admit(2));
+  CHECK(!limiter.admit(3));
+  limiter.release();
+  CHECK(limiter.admit(4));
+  CHECK(limiter.admit(5));
+  CHECK(!limiter.admit(6));
+  limiter.release();
+  CHECK(!limiter.arm(tick + 102));
+
+  // 屏蔽时长为0: 首次处理即解除
+  CHECK(limiter.configure(1, 1000, 0, CORE_CLOCK, 0, 0));
+  CHECK(limiter.admit(1));
+  CHECK(!limiter.admit(2));
+  CHECK(0 == service(limiter, 7, report) && report);
+  CHECK(limiter.admit(3));
+}
+
+/**
+ * @brief  长屏蔽时长: 换算在64位下完成，超出有符号节拍比较范围的配置被拒绝
+ */
+static void test_long_holdoff(void)
+{
+  Storm_Limiter  limiter;
+  const uint64_t ticks = 5000000ULL * TX_TIMER_TICKS_PER_SECOND / 1000U;
+  bool           report = false;
+
+  // 5000000 毫秒: 旧实现在乘以节拍频率时回绕
+  CHECK(limiter.configure(1, 1000, 5000000, CORE_CLOCK, 0, 0));
+  CHECK(ticks == limiter.holdoff_ticks());
+  CHECK(limiter.admit(1));
+  CHECK(!limiter.admit(2));
+  CHECK(ticks == service(limiter, 0, report) && report);
+  CHECK(0 == service(limiter, static_cast<uint32_t>(ticks), report));
+
+  CHECK(!limiter.configure(1, 1000, 0xFFFFFFFFU, CORE_CLOCK, 0, 0));
+  CHECK(ticks == limiter.holdoff_ticks());
+}
+
+/**
+ * @brief  持续风暴: 每 10 微秒一次中断，每毫秒最多 20 次，屏蔽 5 毫秒，按 1 毫秒节拍处理
+ */
+static void test_sustained_storm(void)
+{
+  Storm_Limiter  limiter;
+  const uint32_t cycles_per_irq  = CORE_CLOCK / 100000U;
+  const uint32_t cycles_per_tick = CORE_CLOCK / TX_TIMER_TICKS_PER_SECOND;
+  const uint32_t ticks           = 1000;
+  uint32_t       admitted        = 0;
+  uint32_t       storms          = 0;
+  uint32_t       reports         = 0;
+  bool           muted           = false;
+  bool           report          = false;
+
+  CHECK(limiter.configure(20, 1000, 5, CORE_CLOCK, 0, 0));
+
+  for (uint32_t tick = 0; tick < ticks; ++tick)
+  {
+    for (uint32_t now = tick * cycles_per_tick; !muted && (now < (tick + 1) * cycles_per_tick); now += cycles_per_irq)
+    {
+      if (limiter.admit(now))
+      {
+        ++admitted;
+      }
+      else
+      {
+        ++storms;
+        muted = true;
+      }
+    }
+
+    if (muted && (0 == service(limiter, tick + 1, report)))
+    {
+      muted = false;
+    }
+    reports += report;
+  }
+
+  // 每 6 个节拍一轮: 触发节拍内准入 20 次，随后屏蔽 5 个节拍
+  printf("sustained storm: %u admitted, %u storms in %u ms\n", admitted, storms, ticks);
+  CHECK(storms == reports);
+  CHECK(ticks / 6 == storms || ticks / 6 + 1 == storms);
+  CHECK(20 * storms == admitted || 20 * (storms + 1) == admitted);
+}
+
+int main(void)
+{
+  test_window();
+  test_long_window();
+  test_holdoff();
+  test_long_holdoff();
+  test_sustained_storm();
+
+  printf("interrupt_test: %s (%d failures)\n", 0 == g_failures ? "OK" : "FAILED", g_failures);
+  fflush(stdout);
+  return 0 == g_failures ? 0 : 1;
+}
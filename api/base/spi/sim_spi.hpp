@@ -0,0 +1,528 @@
+#ifndef __SIM_SPI_HPP__
+#define __SIM_SPI_HPP__
+
+#include "spi_bus.hpp"
+
+/**
+ * @note  仿真 SPI: Sim_Spi_Config 提供与 Spi_Config 相同的端口接口，transfer() 仅登记传输，由 step()/run()
+ *        逐事务执行: 与所有已选中的从机逐字节交换数据 (多个从机同时选中时 MISO 线与，无从机选中时读到 0xFF)，
+ *        随后在 step() 中触发端口传输完成回调 (对应硬件接收 DMA 传输完成中断); fail_next() 注入传输错误;
+ *        Sim_Spi_Slave 为寄存器型从机: 首字节 bit7 为读标志、bit6~0 为寄存器地址，从机在首字节返回状态字节,
+ *        之后按地址自增读出或写入寄存器; 主机时钟极性/相位与从机不一致或时钟超过从机上限时从机丢弃该帧并输出 0xFF,
+ *        字节序不一致时双方看到的数据按位反转
+ */
+
+/// @brief 名称空间 QAQ
+namespace QAQ
+{
+/// @brief 名称空间 基本对象
+namespace base
+{
+/// @brief 名称空间 SPI
+namespace spi
+{
+/// @brief 仿真 SPI 从机 统计
+struct Sim_Spi_Slave_Stats
+{
+  uint32_t frames;      /* 完成的帧数 (片选有效期间) */
+  uint32_t reads;       /* 读出的寄存器字节数 */
+  uint32_t writes;      /* 写入的寄存器字节数 */
+  uint32_t mode_errors; /* 时钟模式或速率不匹配的帧数 */
+};
+
+/// @brief 仿真 SPI 端口 统计
+struct Sim_Spi_Stats
+{
+  uint32_t transfers; /* 完成的传输数 */
+  uint32_t bytes;     /* 传输字节数 */
+  uint32_t configs;   /* 总线配置次数 */
+  uint64_t bus_ns;    /* 按内核时钟与分频折算的线路占用时间 (纳秒) */
+};
+
+/**
+ * @brief 仿真 SPI 寄存器型从机
+ */
+class Sim_Spi_Slave final
+{
+  // 禁止拷贝和移动
+  QAQ_NO_COPY_MOVE(Sim_Spi_Slave)
+
+  /// @brief 友元声明 仿真 SPI 端口
+  template <uint8_t Id>
+  friend class Sim_Spi_Config;
+
+public:
+  /// @brief 寄存器数量
+  static constexpr uint32_t REGISTER_COUNT = 128;
+  /// @brief 首字节返回的状态字节
+  static constexpr uint8_t  STATUS         = 0x5A;
+  /// @brief 首字节读标志
+  static constexpr uint8_t  READ_FLAG      = 0x80;
+
+private:
+  /// @brief 下一个从机 (端口链表)
+  Sim_Spi_Slave*      m_next                      = nullptr;
+  /// @brief 从机时钟极性
+  uint32_t            m_clock_polarity            = Spi_Clock_Polarity::LOW_POLARITY;
+  /// @brief 从机时钟相位
+  uint32_t            m_clock_phase               = Spi_Clock_Phase::FIRST_EDGE;
+  /// @brief 从机字节序
+  uint32_t            m_endian                    = Spi_Endian::MSB;
+  /// @brief 从机允许的最小分频系数 (最高时钟)
+  uint32_t            m_min_prescaler             = 2;
+  /// @brief 寄存器
+  uint8_t             m_registers[REGISTER_COUNT] = {};
+  /// @brief 片选是否有效
+  bool                m_selected                  = false;
+  /// @brief 当前帧已交换的字节数
+  uint32_t            m_index                     = 0;
+  /// @brief 当前帧为读操作
+  bool                m_read                      = false;
+  /// @brief 当前帧寄存器地址
+  uint8_t             m_address                   = 0;
+  /// @brief 当前帧时钟模式不匹配
+  bool                m_mismatch                  = false;
+  /// @brief 统计信息
+  Sim_Spi_Slave_Stats m_stats                     = {};
+
+  /**
+   * @brief  仿真 SPI 从机 按位反转字节
+   *
+   * @param  value    字节
+   * @return uint8_t  反转后的字节
+   */
+  static uint8_t reverse(uint8_t value) noexcept
+  {
+    value = static_cast<uint8_t>(((value & 0xF0U) >> 4) | ((value & 0x0FU) << 4));
+    value = static_cast<uint8_t>(((value & 0xCCU) >> 2) | ((value & 0x33U) << 2));
+    value = static_cast<uint8_t>(((value & 0xAAU) >> 1) | ((value & 0x55U) << 1));
+    return value;
+  }
+
+  /**
+   * @brief  仿真 SPI 从机 交换一个字节
+   *
+   * @param  mosi     主机发送的字节
+   * @param  config   主机总线配置
+   * @return uint8_t  从机输出的字节
+   */
+  uint8_t exchange(uint8_t mosi, const Spi_Device_Config& config)
+  {
+    uint8_t miso = base_internal::spi_internal::SPI_FILL_BYTE;
+
+    if (0 == m_index)
+    {
+      m_mismatch = (config.clock_polarity != m_clock_polarity) || (config.clock_phase != m_clock_phase) || (config.baud_rate_prescaler < m_min_prescaler);
+    }
+
+    if (!m_mismatch)
+    {
+      const bool swap = (config.endian != m_endian);
+
+      if (swap)
+      {
+        mosi = reverse(mosi);
+      }
+
+      if (0 == m_index)
+      {
+        m_read    = (0 != (mosi & READ_FLAG));
+        m_address = static_cast<uint8_t>(mosi & (REGISTER_COUNT - 1));
+        miso      = STATUS;
+      }
+      else if (m_read)
+      {
+        miso      = m_registers[m_address];
+        m_address = static_cast<uint8_t>((m_address + 1) & (REGISTER_COUNT - 1));
+        ++m_stats.reads;
+      }
+      else
+      {
+        m_registers[m_address] = mosi;
+        m_address              = static_cast<uint8_t>((m_address + 1) & (REGISTER_COUNT - 1));
+        miso                   = 0x00;
+        ++m_stats.writes;
+      }
+
+      if (swap)
+      {
+        miso = reverse(miso);
+      }
+    }
+
+    ++m_index;
+    return miso;
+  }
+
+public:
+  /**
+   * @brief  仿真 SPI 从机 构造函数
+   *
+   * @param  clock_polarity  从机时钟极性
+   * @param  clock_phase     从机时钟相位
+   * @param  endian          从机字节序
+   * @param  min_prescaler   从机允许的最小分频系数
+   */
+  explicit Sim_Spi_Slave(uint32_t clock_polarity = Spi_Clock_Polarity::LOW_POLARITY, uint32_t clock_phase = Spi_Clock_Phase::FIRST_EDGE, uint32_t endian = Spi_Endian::MSB, uint32_t min_prescaler = 2)
+    : m_clock_polarity(clock_polarity), m_clock_phase(clock_phase), m_endian(endian), m_min_prescaler(min_prescaler)
+  {
+  }
+
+  /**
+   * @brief  仿真 SPI 从机 片选函数 (用作 Spi_Device::select，参数为从机)
+   *
+   * @param  slave   从机
+   * @param  active  是否选中
+   */
+  static void select(void* slave, bool active)
+  {
+    Sim_Spi_Slave* self = static_cast<Sim_Spi_Slave*>(slave);
+
+    if (active && !self->m_selected)
+    {
+      self->m_index = 0;
+    }
+    else if (!active && self->m_selected && 0 != self->m_index)
+    {
+      ++self->m_stats.frames;
+      self->m_stats.mode_errors += self->m_mismatch ? 1 : 0;
+    }
+
+    self->m_selected = active;
+  }
+
+  /**
+   * @brief  仿真 SPI 从机 读取寄存器
+   *
+   * @param  address  寄存器地址
+   * @return uint8_t  寄存器值
+   */
+  uint8_t read_register(uint8_t address) const noexcept
+  {
+    return m_registers[address & (REGISTER_COUNT - 1)];
+  }
+
+  /**
+   * @brief  仿真 SPI 从机 写入寄存器
+   *
+   * @param  address  寄存器地址
+   * @param  value    寄存器值
+   */
+  void write_register(uint8_t address, uint8_t value) noexcept
+  {
+    m_registers[address & (REGISTER_COUNT - 1)] = value;
+  }
+
+  /**
+   * @brief  仿真 SPI 从机 片选是否有效
+   *
+   * @return true   已选中
+   * @return false  未选中
+   */
+  bool selected(void) const noexcept
+  {
+    return m_selected;
+  }
+
+  /**
+   * @brief  仿真 SPI 从机 获取统计信息
+   *
+   * @return Sim_Spi_Slave_Stats  统计信息
+   */
+  Sim_Spi_Slave_Stats stats(void) const noexcept
+  {
+    return m_stats;
+  }
+
+  /**
+   * @brief  仿真 SPI 从机 清零统计信息
+   */
+  void reset_stats(void) noexcept
+  {
+    m_stats = {};
+  }
+
+  /**
+   * @brief  仿真 SPI 从机 析构函数
+   */
+  ~Sim_Spi_Slave() {}
+};
+
+/**
+ * @brief  仿真 SPI 端口 (接口与 Spi_Config 一致)
+ *
+ * @tparam Id  仿真端口编号
+ */
+template <uint8_t Id>
+class Sim_Spi_Config final
+{
+  // 禁止拷贝和移动
+  QAQ_NO_COPY_MOVE(Sim_Spi_Config)
+
+private:
+  /// @brief 友元类声明 SPI 总线
+  template <typename Port, uint32_t Queue_Depth>
+  friend class Spi_Bus;
+
+  /// @brief 中断保护器 类型声明
+  using Irq_Guard       = system::system_internal::memory_internal::port::Irq_Guard;
+  /// @brief 端口传输完成函数 类型声明
+  using Spi_Port_Func_t = base_internal::spi_internal::Spi_Port_Func_t;
+
+  /// @brief 仿真内核时钟 (Hz)
+  static constexpr uint64_t KERNEL_CLOCK = 200000000ULL;
+
+  /// @brief 传输完成函数
+  static inline Spi_Port_Func_t   m_function   = nullptr;
+  /// @brief 传输完成函数参数
+  static inline void*             m_arg        = nullptr;
+  /// @brief 当前总线配置
+  static inline Spi_Device_Config m_config     = {};
+  /// @brief 从机链表
+  static inline Sim_Spi_Slave*    m_slaves     = nullptr;
+  /// @brief 发送数据
+  static inline const uint8_t*    m_tx         = nullptr;
+  /// @brief 接收数据
+  static inline uint8_t*          m_rx         = nullptr;
+  /// @brief 传输大小
+  static inline uint32_t          m_size       = 0;
+  /// @brief 是否已打开
+  static inline bool              m_opened     = false;
+  /// @brief 是否有登记的传输
+  static inline bool              m_pending    = false;
+  /// @brief 待注入错误次数
+  static inline uint32_t          m_fail_count = 0;
+  /// @brief 统计信息
+  static inline Sim_Spi_Stats     m_stats      = {};
+
+  /**
+   * @brief  仿真 SPI 端口 打开
+   *
+   * @param  function  传输完成函数
+   * @param  arg       传输完成函数参数
+   * @return true      打开成功
+   * @return false     已打开
+   */
+  static bool open(Spi_Port_Func_t function, void* arg, uint32_t, uint32_t)
+  {
+    bool      ret = false;
+    Irq_Guard guard;
+
+    if (!m_opened)
+    {
+      m_function = function;
+      m_arg      = arg;
+      m_pending  = false;
+      m_opened   = true;
+      ret        = true;
+    }
+
+    return ret;
+  }
+
+  /**
+   * @brief  仿真 SPI 端口 关闭 (丢弃登记的传输，不产生回调)
+   */
+  static void close(void)
+  {
+    Irq_Guard guard;
+    m_opened   = false;
+    m_pending  = false;
+    m_function = nullptr;
+    m_arg      = nullptr;
+  }
+
+  /**
+   * @brief  仿真 SPI 端口 写入总线配置
+   *
+   * @param  config  总线配置
+   */
+  static void configure(const Spi_Device_Config& config)
+  {
+    m_config = config;
+    ++m_stats.configs;
+  }
+
+  /**
+   * @brief  仿真 SPI 端口 登记全双工传输
+   *
+   * @param  tx    发送数据 (nullptr 发送填充字节)
+   * @param  rx    接收数据 (nullptr 丢弃)
+   * @param  size  大小 (字节)
+   */
+  static void transfer(const uint8_t* tx, uint8_t* rx, uint32_t size)
+  {
+    m_tx      = tx;
+    m_rx      = rx;
+    m_size    = size;
+    m_pending = true;
+  }
+
+public:
+  /**
+   * @brief  仿真 SPI 端口 挂接从机
+   *
+   * @param  slave  从机
+   */
+  static void attach(Sim_Spi_Slave& slave)
+  {
+    Irq_Guard guard;
+    slave.m_next = m_slaves;
+    m_slaves     = &slave;
+  }
+
+  /**
+   * @brief  仿真 SPI 端口 移除从机
+   *
+   * @param  slave  从机
+   */
+  static void detach(Sim_Spi_Slave& slave)
+  {
+    Irq_Guard       guard;
+    Sim_Spi_Slave** link = &m_slaves;
+
+    while (nullptr != *link && &slave != *link)
+    {
+      link = &(*link)->m_next;
+    }
+
+    if (nullptr != *link)
+    {
+      *link        = slave.m_next;
+      slave.m_next = nullptr;
+    }
+  }
+
+  /**
+   * @brief  仿真 SPI 端口 执行登记的传输并触发传输完成回调 (回调中启动的下一传输留待下一步)
+   *
+   * @return true   已执行一个传输
+   * @return false  无登记的传输
+   */
+  static bool step(void)
+  {
+    Spi_Port_Func_t function = nullptr;
+    void*           arg      = nullptr;
+    bool            ok       = true;
+
+    {
+      Irq_Guard guard;
+
+      if (m_pending)
+      {
+        m_pending = false;
+        function  = m_function;
+        arg       = m_arg;
+
+        if (0 != m_fail_count)
+        {
+          --m_fail_count;
+          ok = false;
+        }
+        else
+        {
+          for (uint32_t i = 0; i < m_size; ++i)
+          {
+            const uint8_t mosi = (nullptr != m_tx) ? m_tx[i] : base_internal::spi_internal::SPI_FILL_BYTE;
+            uint8_t       miso = base_internal::spi_internal::SPI_FILL_BYTE;
+
+            for (Sim_Spi_Slave* slave = m_slaves; nullptr != slave; slave = slave->m_next)
+            {
+              if (slave->m_selected)
+              {
+                miso &= slave->exchange(mosi, m_config);
+              }
+            }
+
+            if (nullptr != m_rx)
+            {
+              m_rx[i] = miso;
+            }
+          }
+
+          ++m_stats.transfers;
+          m_stats.bytes  += m_size;
+          m_stats.bus_ns += (static_cast<uint64_t>(m_size) * 8U * m_config.baud_rate_prescaler * 1000000000ULL) / KERNEL_CLOCK;
+        }
+      }
+    }
+
+    if (nullptr != function)
+    {
+      function(arg, ok);
+    }
+
+    return nullptr != function;
+  }
+
+  /**
+   * @brief  仿真 SPI 端口 执行至无登记的传输 (包括回调中新提交的事务)
+   *
+   * @return uint32_t  执行的传输数
+   */
+  static uint32_t run(void)
+  {
+    uint32_t count = 0;
+
+    while (step())
+    {
+      ++count;
+    }
+
+    return count;
+  }
+
+  /**
+   * @brief  仿真 SPI 端口 注入传输错误
+   *
+   * @param  count  接下来失败的传输数
+   */
+  static void fail_next(uint32_t count) noexcept
+  {
+    Irq_Guard guard;
+    m_fail_count = count;
+  }
+
+  /**
+   * @brief  仿真 SPI 端口 获取统计信息
+   *
+   * @return Sim_Spi_Stats  统计信息
+   */
+  static Sim_Spi_Stats stats(void) noexcept
+  {
+    return m_stats;
+  }
+
+  /**
+   * @brief  仿真 SPI 端口 清零统计信息
+   */
+  static void reset_stats(void) noexcept
+  {
+    Irq_Guard guard;
+    m_stats = {};
+  }
+
+  /**
+   * @brief  仿真 SPI 端口 获取端口编号
+   *
+   * @return uint32_t  端口编号
+   */
+  static constexpr uint32_t get_port_num(void)
+  {
+    return Id;
+  }
+};
+
+/**
+ * @brief  仿真 SPI 总线 模板类
+ *
+ * @tparam Id           仿真端口编号
+ * @tparam Queue_Depth  队列深度
+ */
+template <uint8_t Id, uint32_t Queue_Depth>
+using Sim_Spi_Bus = Spi_Bus<Sim_Spi_Config<Id>, Queue_Depth>;
+} /* namespace spi */
+} /* namespace base */
+} /* namespace QAQ */
+
+#endif /* __SIM_SPI_HPP__ */
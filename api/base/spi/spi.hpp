@@ -0,0 +1,37 @@
+#ifndef __SPI_HPP__
+#define __SPI_HPP__
+
+#include "spi_config.hpp"
+#include "spi_base.hpp"
+
+/// @brief 名称空间 QAQ
+namespace QAQ
+{
+/// @brief 名称空间 基本对象
+namespace base
+{
+/// @brief 名称空间 SPI
+namespace spi
+{
+/**
+ * @brief  Spi 总线模板类 (硬件端口)
+ *
+ * @tparam Port         端口号 (1 ~ 5)
+ * @tparam Queue_Depth  事务队列深度
+ */
+template <uint8_t Port, uint32_t Queue_Depth = 8>
+using Spi_Port_Bus = Spi_Bus<Spi_Config<Port>, Queue_Depth>;
+
+/**
+ * @brief  Spi 设备模板类
+ *
+ * @tparam Bus     Spi 总线类型
+ * @tparam Cs_Pin  片选引脚 (低电平有效，void 表示无片选)
+ */
+template <typename Bus, typename Cs_Pin = void>
+using Spi = base_internal::spi_internal::Spi_Base<Bus, Cs_Pin>;
+} /* namespace spi */
+} /* namespace base */
+} /* namespace QAQ */
+
+#endif /* __SPI_HPP__ */
@@ -0,0 +1,640 @@
+#ifndef __SPI_BASE_HPP__
+#define __SPI_BASE_HPP__
+
+#include "direct_device.hpp"
+#include "gpio.hpp"
+#include "spi_bus.hpp"
+
+/// @brief 名称空间 QAQ
+namespace QAQ
+{
+/// @brief 名称空间 基本对象
+namespace base
+{
+/// @brief 命名空间 内部
+namespace base_internal
+{
+/// @brief 命名空间 SPI 内部
+namespace spi_internal
+{
+template <typename Bus, typename Cs_Pin>
+class Spi_Base;
+
+/**
+ * @brief  Spi 链式配置器
+ *
+ * @tparam T  Spi 设备类型
+ */
+template <typename T>
+class Spi_Set_Config
+{
+  /// @brief 配置选项 类型声明
+  using Spi_Config_Code = spi::Config;
+
+  /// @brief 友元类声明 Spi_Base 模版类
+  template <typename Bus, typename Cs_Pin>
+  friend class Spi_Base;
+
+  /// @brief Spi 设备
+  T& spi;
+
+  /**
+   * @brief  Spi 链式配置器 构造函数
+   *
+   * @param  spi  Spi 设备
+   */
+  explicit Spi_Set_Config(T& spi) : spi(spi) {}
+
+  /**
+   * @brief  Spi 链式配置器 析构函数
+   */
+  ~Spi_Set_Config() {}
+
+public:
+  /**
+   * @brief  Spi 设置工作模式
+   *
+   * @param  mode             工作模式
+   * @return Spi_Set_Config&  配置器
+   */
+  Spi_Set_Config& mode(uint32_t mode)
+  {
+    spi.config(Spi_Config_Code::Mode, mode);
+    return *this;
+  }
+
+  /**
+   * @brief  Spi 设置字节序
+   *
+   * @param  endian           字节序
+   * @return Spi_Set_Config&  配置器
+   */
+  Spi_Set_Config& endian(uint32_t endian)
+  {
+    spi.config(Spi_Config_Code::Endian, endian);
+    return *this;
+  }
+
+  /**
+   * @brief  Spi 设置数据大小
+   *
+   * @param  data_size        数据大小
+   * @return Spi_Set_Config&  配置器
+   */
+  Spi_Set_Config& data_size(uint32_t data_size)
+  {
+    spi.config(Spi_Config_Code::Data_Size, data_size);
+    return *this;
+  }
+
+  /**
+   * @brief  Spi 设置波特率分频系数
+   *
+   * @param  baud_rate_prescaler  分频系数
+   * @return Spi_Set_Config&      配置器
+   */
+  Spi_Set_Config& baud_rate_prescaler(uint32_t baud_rate_prescaler)
+  {
+    spi.config(Spi_Config_Code::Baud_Rate_Prescaler, baud_rate_prescaler);
+    return *this;
+  }
+
+  /**
+   * @brief  Spi 设置时钟极性
+   *
+   * @param  clock_polarity   时钟极性
+   * @return Spi_Set_Config&  配置器
+   */
+  Spi_Set_Config& clock_polarity(uint32_t clock_polarity)
+  {
+    spi.config(Spi_Config_Code::Clock_Polarity, clock_polarity);
+    return *this;
+  }
+
+  /**
+   * @brief  Spi 设置时钟相位
+   *
+   * @param  clock_phase      时钟相位
+   * @return Spi_Set_Config&  配置器
+   */
+  Spi_Set_Config& clock_phase(uint32_t clock_phase)
+  {
+    spi.config(Spi_Config_Code::Clock_Phase, clock_phase);
+    return *this;
+  }
+};
+
+/**
+ * @brief  Spi 链式查询器
+ *
+ * @tparam T  Spi 设备类型
+ */
+template <typename T>
+class Spi_Get_Config
+{
+  /// @brief 配置选项 类型声明
+  using Spi_Config_Code = spi::Config;
+
+  /// @brief 友元类声明 Spi_Base 模版类
+  template <typename Bus, typename Cs_Pin>
+  friend class Spi_Base;
+
+  /// @brief Spi 设备
+  const T& spi;
+
+  /**
+   * @brief  Spi 链式查询器 构造函数
+   *
+   * @param  spi  Spi 设备
+   */
+  explicit Spi_Get_Config(const T& spi) : spi(spi) {}
+
+  /**
+   * @brief  Spi 链式查询器 析构函数
+   */
+  ~Spi_Get_Config() {}
+
+public:
+  uint32_t mode(void) const
+  {
+    return spi.get_config(Spi_Config_Code::Mode);
+  }
+
+  Spi_Get_Config& mode(uint32_t& mode)
+  {
+    mode = spi.get_config(Spi_Config_Code::Mode);
+    return *this;
+  }
+
+  uint32_t endian(void) const
+  {
+    return spi.get_config(Spi_Config_Code::Endian);
+  }
+
+  Spi_Get_Config& endian(uint32_t& endian)
+  {
+    endian = spi.get_config(Spi_Config_Code::Endian);
+    return *this;
+  }
+
+  uint32_t data_size(void) const
+  {
+    return spi.get_config(Spi_Config_Code::Data_Size);
+  }
+
+  Spi_Get_Config& data_size(uint32_t& data_size)
+  {
+    data_size = spi.get_config(Spi_Config_Code::Data_Size);
+    return *this;
+  }
+
+  uint32_t baud_rate_prescaler(void) const
+  {
+    return spi.get_config(Spi_Config_Code::Baud_Rate_Prescaler);
+  }
+
+  Spi_Get_Config& baud_rate_prescaler(uint32_t& baud_rate_prescaler)
+  {
+    baud_rate_prescaler = spi.get_config(Spi_Config_Code::Baud_Rate_Prescaler);
+    return *this;
+  }
+
+  uint32_t clock_polarity(void) const
+  {
+    return spi.get_config(Spi_Config_Code::Clock_Polarity);
+  }
+
+  Spi_Get_Config& clock_polarity(uint32_t& clock_polarity)
+  {
+    clock_polarity = spi.get_config(Spi_Config_Code::Clock_Polarity);
+    return *this;
+  }
+
+  uint32_t clock_phase(void) const
+  {
+    return spi.get_config(Spi_Config_Code::Clock_Phase);
+  }
+
+  Spi_Get_Config& clock_phase(uint32_t& clock_phase)
+  {
+    clock_phase = spi.get_config(Spi_Config_Code::Clock_Phase);
+    return *this;
+  }
+
+  uint32_t port_num(void) const
+  {
+    return spi.get_config(Spi_Config_Code::Port_Num);
+  }
+
+  Spi_Get_Config& port_num(uint32_t& port_num)
+  {
+    port_num = spi.get_config(Spi_Config_Code::Port_Num);
+    return *this;
+  }
+};
+
+/**
+ * @brief  Spi 基类 (共享总线上一个片选对应的设备)
+ *
+ * @note   write() 发送并丢弃接收数据，read() 发送填充字节并接收，transfer() 为全双工收发;
+ *         各操作作为一个事务提交至总线队列，片选在事务期间有效; 总线须先于设备打开;
+ *         读取超时后未启动的事务被取消，已启动的事务仍会写入接收缓存区
+ *
+ * @tparam Bus     Spi 总线类型 (Spi_Bus)
+ * @tparam Cs_Pin  片选引脚 (低电平有效，void 表示无片选)
+ */
+template <typename Bus, typename Cs_Pin = void>
+class Spi_Base : public system::device::Direct_Device
+{
+  // 禁止拷贝和移动
+  QAQ_NO_COPY_MOVE(Spi_Base)
+
+  /// @brief Spi 错误码 类型声明
+  using Spi_Error_Code  = system::device::Device_Error_Code;
+  /// @brief Spi 配置选项 类型声明
+  using Spi_Config_Code = spi::Config;
+  /// @brief Spi 设备事件标志位 类型声明
+  using Bits            = system::system_internal::device_internal::Device_Event_Bits;
+  /// @brief 自身类型 类型声明
+  using Self            = Spi_Base<Bus, Cs_Pin>;
+  /// @brief 基类 类型声明
+  using Base            = system::device::Direct_Device;
+
+private:
+  /// @brief Spi 总线
+  Bus&                 m_bus;
+  /// @brief Spi 总线设备
+  spi::Spi_Device      m_device;
+  /// @brief Spi 全双工发送数据 (transfer() 期间有效)
+  const uint8_t*       m_transfer_tx = nullptr;
+  /// @brief Spi 最近一次事务失败
+  volatile bool        m_failed      = false;
+  /// @brief Spi 最近一次接收事务已完成 (超时返回时仍为 false)
+  volatile bool        m_received    = false;
+  /// @brief Spi 链式配置器
+  Spi_Set_Config<Self> m_set_config;
+  /// @brief Spi 链式查询器
+  Spi_Get_Config<Self> m_get_config;
+
+  /**
+   * @brief  Spi 片选函数 (低电平有效)
+   *
+   * @param  active  是否选中
+   */
+  static void chip_select(void*, bool active)
+  {
+    if (active)
+    {
+      Cs_Pin::reset();
+    }
+    else
+    {
+      Cs_Pin::set();
+    }
+  }
+
+  /**
+   * @brief  Spi 发送事务完成回调 (DMA 中断中执行)
+   *
+   * @param  arg    Spi 设备
+   * @param  event  事务事件
+   */
+  static void send_complete_callback(void* arg, const spi::Spi_Transaction&, spi::Spi_Event event)
+  {
+    Self* spi     = static_cast<Self*>(arg);
+    spi->m_failed = (spi::Spi_Event::Complete != event);
+    spi->output_complete();
+  }
+
+  /**
+   * @brief  Spi 接收事务完成回调 (DMA 中断中执行)
+   *
+   * @param  arg    Spi 设备
+   * @param  event  事务事件
+   */
+  static void received_complete_callback(void* arg, const spi::Spi_Transaction&, spi::Spi_Event event)
+  {
+    Self* spi       = static_cast<Self*>(arg);
+    spi->m_failed   = (spi::Spi_Event::Complete != event);
+    spi->m_received = true;
+    spi->input_complete();
+  }
+
+  /**
+   * @brief  Spi 设备管理器事件处理 - 元方法覆写
+   *
+   * @param  event  事件标志
+   */
+  void manger_handler(uint32_t event) override
+  {
+    if (event & static_cast<uint32_t>(Bits::Receive_Timeout))
+    {
+      m_bus.cancel(m_device);
+    }
+  }
+
+  /**
+   * @brief  Spi 设备打开 - 元方法覆写
+   *
+   * @return Spi_Error_Code  错误码
+   */
+  Spi_Error_Code open_impl(void) override
+  {
+    Spi_Error_Code error_code = Spi_Error_Code::OK;
+
+    if (!m_bus.is_opened())
+    {
+      error_code = Spi_Error_Code::INIT_FAILED;
+    }
+    else
+    {
+      if constexpr (!std::is_same_v<Cs_Pin, void>)
+      {
+        Cs_Pin::setup(gpio::Pin_Mode::Output);
+        Cs_Pin::set();
+      }
+
+      m_failed = false;
+    }
+
+    return error_code;
+  }
+
+  /**
+   * @brief  Spi 设备关闭 - 元方法覆写
+   *
+   * @return Spi_Error_Code  错误码 (仍有传输中的事务时返回 BUSY)
+   */
+  Spi_Error_Code close_impl(void) override
+  {
+    Spi_Error_Code error_code = Spi_Error_Code::OK;
+
+    m_bus.cancel(m_device);
+
+    if (m_bus.pending(m_device))
+    {
+      error_code = Spi_Error_Code::BUSY;
+    }
+    else
+    {
+      if constexpr (!std::is_same_v<Cs_Pin, void>)
+      {
+        Cs_Pin::clearup();
+      }
+    }
+
+    return error_code;
+  }
+
+  /**
+   * @brief  Spi 发送数据 - 元方法覆写 (接收数据丢弃)
+   *
+   * @param  data      发送数据指针
+   * @param  size      发送数据大小
+   * @return uint32_t  已提交的数据大小 (队列已满时为0)
+   */
+  uint32_t send_impl(const uint8_t* data, uint32_t size) override
+  {
+    m_failed = false;
+
+    return m_bus.submit(m_device, data, nullptr, size, send_complete_callback, this) ? size : 0;
+  }
+
+  /**
+   * @brief  Spi 接收数据 - 元方法覆写 (发送 transfer() 指定的数据或填充字节)
+   *
+   * @param  data      接收数据指针
+   * @param  size      接收数据大小
+   * @return uint32_t  已提交的数据大小 (队列已满时为0)
+   */
+  uint32_t recv_impl(uint8_t* data, uint32_t size) override
+  {
+    const uint8_t* tx = m_transfer_tx;
+
+    m_transfer_tx     = nullptr;
+    m_failed          = false;
+    m_received        = false;
+
+    return m_bus.submit(m_device, tx, data, size, received_complete_callback, this) ? size : 0;
+  }
+
+  /**
+   * @brief  Spi 设备配置 - 元方法覆写 (该设备的下一事务启动时生效)
+   *
+   * @param  param           配置参数
+   * @param  value           配置值
+   * @return Spi_Error_Code  错误码
+   */
+  Spi_Error_Code config_impl(uint32_t param, uint32_t value) override
+  {
+    Spi_Error_Code error_code = Spi_Error_Code::OK;
+
+    if (Spi_Config_Code::Mode == param)
+    {
+      error_code = (spi::Spi_Mode::FULL_DUPLEX_MASTER == value) ? Spi_Error_Code::OK : Spi_Error_Code::INVALID_PARAMETER;
+    }
+    else if (Spi_Config_Code::Endian == param)
+    {
+      if (spi::Spi_Endian::MSB == value || spi::Spi_Endian::LSB == value)
+      {
+        m_device.config.endian = value;
+      }
+      else
+      {
+        error_code = Spi_Error_Code::INVALID_PARAMETER;
+      }
+    }
+    else if (Spi_Config_Code::Data_Size == param)
+    {
+      error_code = (Default_Data_Size == value) ? Spi_Error_Code::OK : Spi_Error_Code::INVALID_PARAMETER;
+    }
+    else if (Spi_Config_Code::Baud_Rate_Prescaler == param)
+    {
+      if (spi_prescaler_valid(value))
+      {
+        m_device.config.baud_rate_prescaler = value;
+      }
+      else
+      {
+        error_code = Spi_Error_Code::INVALID_PARAMETER;
+      }
+    }
+    else if (Spi_Config_Code::Clock_Polarity == param)
+    {
+      if (spi::Spi_Clock_Polarity::LOW_POLARITY == value || spi::Spi_Clock_Polarity::HIGH_POLARITY == value)
+      {
+        m_device.config.clock_polarity = value;
+      }
+      else
+      {
+        error_code = Spi_Error_Code::INVALID_PARAMETER;
+      }
+    }
+    else if (Spi_Config_Code::Clock_Phase == param)
+    {
+      if (spi::Spi_Clock_Phase::FIRST_EDGE == value || spi::Spi_Clock_Phase::SECOND_EDGE == value)
+      {
+        m_device.config.clock_phase = value;
+      }
+      else
+      {
+        error_code = Spi_Error_Code::INVALID_PARAMETER;
+      }
+    }
+    else
+    {
+      error_code = Spi_Error_Code::INVALID_PARAMETER;
+    }
+
+    if (Spi_Error_Code::OK == error_code)
+    {
+      m_bus.invalidate(m_device);
+    }
+
+    return error_code;
+  }
+
+  /**
+   * @brief  Spi 获取设备配置 - 元方法覆写
+   *
+   * @param  param     配置参数
+   * @return uint32_t  配置值
+   */
+  uint32_t get_config_impl(uint32_t param) const override
+  {
+    uint32_t value = 0;
+
+    if (Spi_Config_Code::Mode == param)
+    {
+      value = spi::Spi_Mode::FULL_DUPLEX_MASTER;
+    }
+    else if (Spi_Config_Code::Endian == param)
+    {
+      value = m_device.config.endian;
+    }
+    else if (Spi_Config_Code::Data_Size == param)
+    {
+      value = Default_Data_Size;
+    }
+    else if (Spi_Config_Code::Baud_Rate_Prescaler == param)
+    {
+      value = m_device.config.baud_rate_prescaler;
+    }
+    else if (Spi_Config_Code::Clock_Polarity == param)
+    {
+      value = m_device.config.clock_polarity;
+    }
+    else if (Spi_Config_Code::Clock_Phase == param)
+    {
+      value = m_device.config.clock_phase;
+    }
+    else if (Spi_Config_Code::Port_Num == param)
+    {
+      value = Bus::get_port_num();
+    }
+
+    return value;
+  }
+
+public:
+  using Base::config;
+  using Base::get_config;
+
+  /**
+   * @brief  Spi 基类 构造函数
+   *
+   * @param  bus  Spi 总线
+   */
+  explicit Spi_Base(Bus& bus)
+    : m_bus(bus),
+      m_device { { Default_Baud_Rate_Prescaler, Default_Clock_Polarity, Default_Clock_Phase, Default_Endian }, chip_select_func(), this },
+      m_set_config(*this),
+      m_get_config(*this)
+  {
+  }
+
+  /**
+   * @brief  Spi 全双工收发 (发送与接收在同一事务中完成)
+   *
+   * @param  tx          发送数据 (nullptr 发送填充字节)
+   * @param  rx          接收数据 (nullptr 丢弃)
+   * @param  size        数据大小
+   * @param  timeout_ms  超时时间 - 毫秒
+   * @return int64_t     传输数据大小 (失败或超时时为-1)
+   */
+  int64_t transfer(const void* tx, void* rx, uint32_t size, uint32_t timeout_ms = TX_WAIT_FOREVER)
+  {
+    int64_t ret   = 0;
+
+    m_transfer_tx = static_cast<const uint8_t*>(tx);
+    ret           = read(rx, size, timeout_ms);
+    m_transfer_tx = nullptr;
+
+    // 超时时 read() 仍返回已提交的大小，以完成回调是否已执行判断
+    if (ret > 0 && (!m_received || m_failed))
+    {
+      ret = -1;
+    }
+
+    return ret;
+  }
+
+  /**
+   * @brief  Spi 获取总线设备 (可直接向总线提交异步事务)
+   *
+   * @return spi::Spi_Device&  总线设备
+   */
+  spi::Spi_Device& device(void) noexcept
+  {
+    return m_device;
+  }
+
+  /**
+   * @brief  Spi 获取链式配置器
+   *
+   * @return Spi_Set_Config<Self>&  配置器
+   */
+  Spi_Set_Config<Self>& config(void)
+  {
+    return m_set_config;
+  }
+
+  /**
+   * @brief  Spi 获取链式查询器
+   *
+   * @return Spi_Get_Config<Self>&  查询器
+   */
+  Spi_Get_Config<Self>& get_config(void)
+  {
+    return m_get_config;
+  }
+
+  /**
+   * @brief  Spi 基类 析构函数
+   */
+  virtual ~Spi_Base() {}
+
+private:
+  /**
+   * @brief  Spi 获取片选函数
+   *
+   * @return spi::Spi_Select_Func_t  片选函数 (无片选引脚时为 nullptr)
+   */
+  static constexpr spi::Spi_Select_Func_t chip_select_func(void)
+  {
+    if constexpr (std::is_same_v<Cs_Pin, void>)
+    {
+      return nullptr;
+    }
+    else
+    {
+      return chip_select;
+    }
+  }
+};
+} /* namespace spi_internal */
+} /* namespace base_internal */
+} /* namespace base */
+} /* namespace QAQ */
+
+#endif /* __SPI_BASE_HPP__ */
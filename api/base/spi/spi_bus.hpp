@@ -0,0 +1,400 @@
+#ifndef __SPI_BUS_HPP__
+#define __SPI_BUS_HPP__
+
+#include "spi_define.hpp"
+
+/// @brief 名称空间 QAQ
+namespace QAQ
+{
+/// @brief 名称空间 基本对象
+namespace base
+{
+/// @brief 名称空间 SPI
+namespace spi
+{
+/**
+ * @brief SPI 共享总线仲裁器 (全双工事务队列)
+ *
+ * @note  事务按提交顺序执行; 端口传输完成中断中先释放当前设备片选、立即启动队列中的下一事务
+ *        (设备切换时先写入该设备的时钟极性/相位/分频/字节序，再选中片选)，随后执行完成回调,
+ *        相邻事务之间不经过线程调度; 回调中可再次提交事务;
+ *        事务的收发缓存区在完成回调前不可访问 (启动时由端口清除缓存，完成时失效接收缓存区，
+ *        接收缓存区应按缓存行对齐，否则首尾缓存行中的其他数据会被丢弃)
+ *
+ * @tparam Port         SPI 端口 (Spi_Config 或 Sim_Spi_Config)
+ * @tparam Queue_Depth  队列深度 (包括传输中的事务)
+ */
+template <typename Port, uint32_t Queue_Depth>
+class Spi_Bus final
+{
+  // 禁止拷贝和移动
+  QAQ_NO_COPY_MOVE(Spi_Bus)
+
+  static_assert(Queue_Depth > 0, "SPI bus needs at least one queue slot");
+
+private:
+  /// @brief 中断保护器 类型声明
+  using Irq_Guard = system::system_internal::memory_internal::port::Irq_Guard;
+
+  /// @brief 事务队列
+  Spi_Transaction   m_queue[Queue_Depth] = {};
+  /// @brief 队首位置
+  uint32_t          m_head               = 0;
+  /// @brief 队列中的事务数
+  uint32_t          m_count              = 0;
+  /// @brief 当前总线配置所属设备
+  const Spi_Device* m_current            = nullptr;
+  /// @brief 是否已打开
+  bool              m_opened             = false;
+  /// @brief 队首事务是否传输中
+  bool              m_active             = false;
+  /// @brief 统计信息
+  Spi_Stats         m_stats              = {};
+
+  /**
+   * @brief  SPI 总线 启动队首事务 (调用方持有中断保护器)
+   */
+  void start_front(void)
+  {
+    const Spi_Transaction& transaction = m_queue[m_head];
+
+    if (m_current != transaction.device)
+    {
+      Port::configure(transaction.device->config);
+      m_current = transaction.device;
+      ++m_stats.reconfigs;
+    }
+
+    if (nullptr != transaction.device->select)
+    {
+      transaction.device->select(transaction.device->select_arg, true);
+    }
+
+    m_active = true;
+    Port::transfer(transaction.tx, transaction.rx, transaction.size);
+  }
+
+  /**
+   * @brief  SPI 总线 取出一个未启动的事务
+   *
+   * @param  device   设备 (nullptr 表示任意设备)
+   * @param  removed  取出的事务
+   * @return true     已取出
+   * @return false    无匹配事务
+   */
+  bool take(const Spi_Device* device, Spi_Transaction& removed)
+  {
+    bool      ret = false;
+    Irq_Guard guard;
+
+    for (uint32_t i = m_active ? 1 : 0; i < m_count && !ret; ++i)
+    {
+      if (nullptr == device || m_queue[(m_head + i) % Queue_Depth].device == device)
+      {
+        removed = m_queue[(m_head + i) % Queue_Depth];
+
+        for (uint32_t j = i; j + 1 < m_count; ++j)
+        {
+          m_queue[(m_head + j) % Queue_Depth] = m_queue[(m_head + j + 1) % Queue_Depth];
+        }
+
+        --m_count;
+        ret = true;
+      }
+    }
+
+    return ret;
+  }
+
+  /**
+   * @brief  SPI 总线 端口传输完成回调 (中断中执行)
+   *
+   * @param  arg  总线
+   * @param  ok   是否成功
+   */
+  static void transfer_complete(void* arg, bool ok)
+  {
+    Spi_Bus*        bus  = static_cast<Spi_Bus*>(arg);
+    Spi_Transaction done = {};
+    bool            valid = false;
+
+    {
+      Irq_Guard guard;
+
+      if (bus->m_active)
+      {
+        done          = bus->m_queue[bus->m_head];
+        bus->m_head   = (bus->m_head + 1) % Queue_Depth;
+        bus->m_active = false;
+        valid         = true;
+        --bus->m_count;
+
+        if (nullptr != done.device->select)
+        {
+          done.device->select(done.device->select_arg, false);
+        }
+
+        if (ok)
+        {
+          ++bus->m_stats.transactions;
+          bus->m_stats.bytes += done.size;
+        }
+        else
+        {
+          ++bus->m_stats.errors;
+          bus->m_current = nullptr;
+        }
+
+        if (0 != bus->m_count)
+        {
+          bus->start_front();
+        }
+      }
+    }
+
+    if (valid && nullptr != done.callback)
+    {
+      done.callback(done.arg, done, ok ? Spi_Event::Complete : Spi_Event::Error);
+    }
+  }
+
+public:
+  /**
+   * @brief  SPI 总线 构造函数
+   */
+  explicit Spi_Bus() {}
+
+  /**
+   * @brief  SPI 总线 打开 (初始化端口为全双工主机)
+   *
+   * @param  priority      中断优先级
+   * @param  sub_priority  中断子优先级
+   * @return true          打开成功
+   * @return false         已打开或端口初始化失败
+   */
+  bool open(uint32_t priority = base_internal::spi_internal::Default_Interrupt_Priority, uint32_t sub_priority = 0)
+  {
+    bool ret = false;
+
+    if (!m_opened && Port::open(transfer_complete, this, priority, sub_priority))
+    {
+      Irq_Guard guard;
+      m_current = nullptr;
+      m_active  = false;
+      m_opened  = true;
+      ret       = true;
+    }
+
+    return ret;
+  }
+
+  /**
+   * @brief  SPI 总线 关闭 (中止传输中的事务，全部事务以 Cancelled 事件回调)
+   */
+  void close(void)
+  {
+    Spi_Transaction removed = {};
+
+    {
+      Irq_Guard guard;
+
+      if (m_opened)
+      {
+        Port::close();
+
+        if (m_active && nullptr != m_queue[m_head].device->select)
+        {
+          m_queue[m_head].device->select(m_queue[m_head].device->select_arg, false);
+        }
+
+        m_opened  = false;
+        m_active  = false;
+        m_current = nullptr;
+      }
+    }
+
+    while (take(nullptr, removed))
+    {
+      if (nullptr != removed.callback)
+      {
+        removed.callback(removed.arg, removed, Spi_Event::Cancelled);
+      }
+    }
+  }
+
+  /**
+   * @brief  SPI 总线 提交事务 (可在中断与回调中调用)
+   *
+   * @param  transaction  事务
+   * @return true         已加入队列
+   * @return false        参数错误、总线未打开或队列已满
+   */
+  bool submit(const Spi_Transaction& transaction)
+  {
+    bool ret = false;
+
+    if (nullptr != transaction.device && 0 != transaction.size && transaction.size <= base_internal::spi_internal::SPI_MAX_TRANSFER)
+    {
+      Irq_Guard guard;
+
+      if (m_opened && m_count < Queue_Depth)
+      {
+        m_queue[(m_head + m_count) % Queue_Depth] = transaction;
+        ++m_count;
+
+        if (m_count > m_stats.peak_depth)
+        {
+          m_stats.peak_depth = m_count;
+        }
+
+        if (!m_active)
+        {
+          start_front();
+        }
+
+        ret = true;
+      }
+    }
+
+    return ret;
+  }
+
+  /**
+   * @brief  SPI 总线 提交事务
+   *
+   * @param  device    目标设备
+   * @param  tx        发送数据 (nullptr 发送填充字节)
+   * @param  rx        接收数据 (nullptr 丢弃接收数据)
+   * @param  size      大小 (字节)
+   * @param  callback  完成回调函数
+   * @param  arg       完成回调函数参数
+   * @return true      已加入队列
+   * @return false     参数错误、总线未打开或队列已满
+   */
+  bool submit(Spi_Device& device, const uint8_t* tx, uint8_t* rx, uint32_t size, Spi_Callback_Func_t callback = nullptr, void* arg = nullptr)
+  {
+    return submit(Spi_Transaction { &device, tx, rx, size, callback, arg });
+  }
+
+  /**
+   * @brief  SPI 总线 取消设备未启动的事务 (以 Cancelled 事件回调，传输中的事务不受影响)
+   *
+   * @param  device    设备
+   * @return uint32_t  取消的事务数
+   */
+  uint32_t cancel(const Spi_Device& device)
+  {
+    uint32_t        count   = 0;
+    Spi_Transaction removed = {};
+
+    while (take(&device, removed))
+    {
+      ++count;
+
+      if (nullptr != removed.callback)
+      {
+        removed.callback(removed.arg, removed, Spi_Event::Cancelled);
+      }
+    }
+
+    return count;
+  }
+
+  /**
+   * @brief  SPI 总线 设备配置已修改 (该设备的下一事务启动前重新写入总线配置)
+   *
+   * @param  device  设备
+   */
+  void invalidate(const Spi_Device& device) noexcept
+  {
+    Irq_Guard guard;
+
+    if (m_current == &device)
+    {
+      m_current = nullptr;
+    }
+  }
+
+  /**
+   * @brief  SPI 总线 设备是否有未完成的事务
+   *
+   * @param  device  设备
+   * @return true    有排队或传输中的事务
+   * @return false   无
+   */
+  bool pending(const Spi_Device& device) const
+  {
+    bool      ret = false;
+    Irq_Guard guard;
+
+    for (uint32_t i = 0; i < m_count && !ret; ++i)
+    {
+      ret = (m_queue[(m_head + i) % Queue_Depth].device == &device);
+    }
+
+    return ret;
+  }
+
+  /**
+   * @brief  SPI 总线 获取队列中的事务数 (包括传输中的事务)
+   *
+   * @return uint32_t  事务数
+   */
+  uint32_t depth(void) const noexcept
+  {
+    return m_count;
+  }
+
+  /**
+   * @brief  SPI 总线 是否已打开
+   *
+   * @return true   已打开
+   * @return false  未打开
+   */
+  bool is_opened(void) const noexcept
+  {
+    return m_opened;
+  }
+
+  /**
+   * @brief  SPI 总线 获取端口编号
+   *
+   * @return uint32_t  端口编号
+   */
+  static constexpr uint32_t get_port_num(void)
+  {
+    return Port::get_port_num();
+  }
+
+  /**
+   * @brief  SPI 总线 获取统计信息
+   *
+   * @return Spi_Stats  统计信息
+   */
+  Spi_Stats stats(void) const noexcept
+  {
+    return m_stats;
+  }
+
+  /**
+   * @brief  SPI 总线 清零统计信息
+   */
+  void reset_stats(void) noexcept
+  {
+    Irq_Guard guard;
+    m_stats = {};
+  }
+
+  /**
+   * @brief  SPI 总线 析构函数
+   */
+  ~Spi_Bus()
+  {
+    close();
+  }
+};
+} /* namespace spi */
+} /* namespace base */
+} /* namespace QAQ */
+
+#endif /* __SPI_BUS_HPP__ */
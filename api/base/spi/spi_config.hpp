@@ -0,0 +1,567 @@
+#ifndef __SPI_CONFIG_HPP__
+#define __SPI_CONFIG_HPP__
+
+#include "stm32h7xx_ll_spi.h"
+#include "interrupt.hpp"
+#include "gpio.hpp"
+#include "dma.hpp"
+#include "spi_bus.hpp"
+
+/// @brief 名称空间 QAQ
+namespace QAQ
+{
+/// @brief 名称空间 基本对象
+namespace base
+{
+/// @brief 命名空间 内部
+namespace base_internal
+{
+/// @brief 命名空间 SPI 内部
+namespace spi_internal
+{
+/**
+ * @brief  Spi 端口硬件信息
+ *
+ * @tparam Port  SPI 端口号 (1~5)
+ */
+template <uint8_t Port>
+class Spi_Base_Interface
+{
+public:
+  /**
+   * @brief  Spi 获取句柄
+   *
+   * @return SPI_TypeDef*  SPI 句柄
+   */
+  static SPI_TypeDef* get_handle(void)
+  {
+    static SPI_TypeDef* const spi_handle[] = { SPI1, SPI2, SPI3, SPI4, SPI5 };
+
+    return spi_handle[Port - 1];
+  }
+
+  /**
+   * @brief  Spi 获取中断通道
+   *
+   * @return Interrupt_Channel_t  中断通道
+   */
+  static constexpr interrupt::Interrupt_Channel_t get_interrupt_channel(void)
+  {
+    constexpr IRQn_Type irqn[] = { SPI1_IRQn, SPI2_IRQn, SPI3_IRQn, SPI4_IRQn, SPI5_IRQn };
+
+    return irqn[Port - 1];
+  }
+
+  /**
+   * @brief  Spi 获取接收 DMA 请求编码
+   *
+   * @return uint32_t  DMAMUX1 请求编码
+   */
+  static constexpr uint32_t get_rx_dma_request(void)
+  {
+    constexpr uint32_t dma_request[] = { LL_DMAMUX1_REQ_SPI1_RX, LL_DMAMUX1_REQ_SPI2_RX, LL_DMAMUX1_REQ_SPI3_RX, LL_DMAMUX1_REQ_SPI4_RX, LL_DMAMUX1_REQ_SPI5_RX };
+
+    return dma_request[Port - 1];
+  }
+
+  /**
+   * @brief  Spi 获取发送 DMA 请求编码
+   *
+   * @return uint32_t  DMAMUX1 请求编码
+   */
+  static constexpr uint32_t get_tx_dma_request(void)
+  {
+    constexpr uint32_t dma_request[] = { LL_DMAMUX1_REQ_SPI1_TX, LL_DMAMUX1_REQ_SPI2_TX, LL_DMAMUX1_REQ_SPI3_TX, LL_DMAMUX1_REQ_SPI4_TX, LL_DMAMUX1_REQ_SPI5_TX };
+
+    return dma_request[Port - 1];
+  }
+
+  /**
+   * @brief  Spi 获取 LL库 波特率分频编码
+   *
+   * @param  baud_rate_prescaler  分频系数 (2~256，2的幂)
+   * @return uint32_t             LL库 分频编码
+   */
+  static uint32_t get_baud_rate_prescaler(uint32_t baud_rate_prescaler)
+  {
+    if (2 == baud_rate_prescaler)
+    {
+      return LL_SPI_BAUDRATEPRESCALER_DIV2;
+    }
+    else if (4 == baud_rate_prescaler)
+    {
+      return LL_SPI_BAUDRATEPRESCALER_DIV4;
+    }
+    else if (8 == baud_rate_prescaler)
+    {
+      return LL_SPI_BAUDRATEPRESCALER_DIV8;
+    }
+    else if (16 == baud_rate_prescaler)
+    {
+      return LL_SPI_BAUDRATEPRESCALER_DIV16;
+    }
+    else if (32 == baud_rate_prescaler)
+    {
+      return LL_SPI_BAUDRATEPRESCALER_DIV32;
+    }
+    else if (64 == baud_rate_prescaler)
+    {
+      return LL_SPI_BAUDRATEPRESCALER_DIV64;
+    }
+    else if (128 == baud_rate_prescaler)
+    {
+      return LL_SPI_BAUDRATEPRESCALER_DIV128;
+    }
+    else if (256 == baud_rate_prescaler)
+    {
+      return LL_SPI_BAUDRATEPRESCALER_DIV256;
+    }
+    else
+    {
+      return LL_SPI_BAUDRATEPRESCALER_DIV4;
+    }
+  }
+
+  /**
+   * @brief  Spi 使能时钟
+   */
+  static void enable_clk(void)
+  {
+    if constexpr (1 == Port)
+    {
+      LL_APB2_GRP1_EnableClock(LL_APB2_GRP1_PERIPH_SPI1);
+    }
+    else if constexpr (2 == Port)
+    {
+      LL_APB1_GRP1_EnableClock(LL_APB1_GRP1_PERIPH_SPI2);
+    }
+    else if constexpr (3 == Port)
+    {
+      LL_APB1_GRP1_EnableClock(LL_APB1_GRP1_PERIPH_SPI3);
+    }
+    else if constexpr (4 == Port)
+    {
+      LL_APB2_GRP1_EnableClock(LL_APB2_GRP1_PERIPH_SPI4);
+    }
+    else if constexpr (5 == Port)
+    {
+      LL_APB2_GRP1_EnableClock(LL_APB2_GRP1_PERIPH_SPI5);
+    }
+  }
+
+  /**
+   * @brief  Spi 关闭时钟
+   */
+  static void disable_clk(void)
+  {
+    if constexpr (1 == Port)
+    {
+      LL_APB2_GRP1_DisableClock(LL_APB2_GRP1_PERIPH_SPI1);
+    }
+    else if constexpr (2 == Port)
+    {
+      LL_APB1_GRP1_DisableClock(LL_APB1_GRP1_PERIPH_SPI2);
+    }
+    else if constexpr (3 == Port)
+    {
+      LL_APB1_GRP1_DisableClock(LL_APB1_GRP1_PERIPH_SPI3);
+    }
+    else if constexpr (4 == Port)
+    {
+      LL_APB2_GRP1_DisableClock(LL_APB2_GRP1_PERIPH_SPI4);
+    }
+    else if constexpr (5 == Port)
+    {
+      LL_APB2_GRP1_DisableClock(LL_APB2_GRP1_PERIPH_SPI5);
+    }
+  }
+
+  /**
+   * @brief  Spi 引脚定义 (SCLK、MISO、MOSI)
+   */
+  struct Pins
+  {
+    using Pin_Port  = gpio::Pin_Port;
+    using Pin_Speed = gpio::Pin_Speed;
+
+    /// @brief 引脚端口表
+    static constexpr Pin_Port port[5][3] = {
+      { Pin_Port::PA, Pin_Port::PA, Pin_Port::PB },
+      { Pin_Port::PB, Pin_Port::PB, Pin_Port::PB },
+      { Pin_Port::PB, Pin_Port::PB, Pin_Port::PB },
+      { Pin_Port::PE, Pin_Port::PE, Pin_Port::PE },
+      { Pin_Port::PF, Pin_Port::PF, Pin_Port::PF },
+    };
+
+    /// @brief 引脚编号表
+    static constexpr gpio::Pin_Num pin[5][3] = {
+      { 5, 6, 5 },
+      { 13, 14, 15 },
+      { 3, 4, 5 },
+      { 2, 5, 6 },
+      { 7, 8, 9 },
+    };
+
+    using Sclk_Pin = gpio::Gpio<port[Port - 1][0], pin[Port - 1][0], Pin_Speed::High>;
+    using Miso_Pin = gpio::Gpio<port[Port - 1][1], pin[Port - 1][1], Pin_Speed::High>;
+    using Mosi_Pin = gpio::Gpio<port[Port - 1][2], pin[Port - 1][2], Pin_Speed::High>;
+  };
+
+  /**
+   * @brief  Spi 获取引脚复用编号 (SPI3 为 AF6，其余为 AF5)
+   *
+   * @return gpio::Pin_Alternate  复用编号
+   */
+  static constexpr gpio::Pin_Alternate get_alternate(void)
+  {
+    return (3 == Port) ? gpio::Pin_Alternate::AF6 : gpio::Pin_Alternate::AF5;
+  }
+
+  /**
+   * @brief  Spi 初始化引脚
+   */
+  static void gpio_init(void)
+  {
+    using Pin_Mode = gpio::Pin_Mode;
+
+    Pins::Sclk_Pin::setup(get_alternate(), Pin_Mode::Alternate);
+    Pins::Miso_Pin::setup(get_alternate(), Pin_Mode::Alternate);
+    Pins::Mosi_Pin::setup(get_alternate(), Pin_Mode::Alternate);
+  }
+
+  /**
+   * @brief  Spi 解除初始化引脚
+   */
+  static void gpio_deinit(void)
+  {
+    Pins::Sclk_Pin::clearup();
+    Pins::Miso_Pin::clearup();
+    Pins::Mosi_Pin::clearup();
+  }
+};
+
+/**
+ * @brief  Spi 接收 DMA 配置 (外设到内存，字节宽度，内存自增可由 set_memory_increment() 切换)
+ */
+using Spi_Rx_Dma_Config = dma::Dma_Config<dma::Dma_Direction::Peripheral_To_Memory, dma::Dma_Mode::Normal, dma::Dma_Priority::High, false, true, dma::Dma_Data_Size::Byte, dma::Dma_Data_Size::Byte>;
+
+/**
+ * @brief  Spi 发送 DMA 配置 (内存到外设，字节宽度，内存自增可由 set_memory_increment() 切换)
+ */
+using Spi_Tx_Dma_Config = dma::Dma_Config<dma::Dma_Direction::Memory_To_Peripheral, dma::Dma_Mode::Normal, dma::Dma_Priority::Medium, true, false, dma::Dma_Data_Size::Byte, dma::Dma_Data_Size::Byte>;
+} /* namespace spi_internal */
+} /* namespace base_internal */
+
+/// @brief 名称空间 SPI
+namespace spi
+{
+/**
+ * @brief  Spi 端口配置模版类 (全双工主机，8位数据帧，收发均使用 DMA)
+ *
+ * @note   由 Spi_Bus 独占使用: 传输完成需接收 DMA 传输完成与 SPI EOT 均已发生 (全双工时接收晚于发送结束),
+ *         接收 DMA 完成时 EOT 未置位则开启 EOT 中断，由 SPI 中断完成本次传输 (中断中不等待);
+ *         完成后失效接收缓存区的数据缓存再调用总线的传输完成函数; 溢出与模式错误由 SPI 中断中止传输并上报;
+ *         片选由总线按设备以 GPIO 控制 (软件 NSS)，SPE 关闭期间 SCLK 保持空闲电平 (AFCNTR);
+ *         SPI6 仅能由 BDMA 访问，不在支持范围内
+ *
+ * @tparam Port  SPI 端口号 (1~5)
+ */
+template <uint8_t Port>
+class Spi_Config : public interrupt::Interrupt_Device
+{
+  /// @warning 端口合法性判断
+  static_assert(1 <= Port && 5 >= Port, "Invalid port number (SPI6 is only reachable by BDMA)");
+
+  // 禁止拷贝和移动
+  QAQ_NO_COPY_MOVE(Spi_Config)
+
+private:
+  /// @brief 友元类声明 SPI 总线
+  template <typename Port_Type, uint32_t Queue_Depth>
+  friend class Spi_Bus;
+
+  /// @brief Spi 硬件信息 类型声明
+  using Interface       = base_internal::spi_internal::Spi_Base_Interface<Port>;
+  /// @brief Spi 端口传输完成函数 类型声明
+  using Spi_Port_Func_t = base_internal::spi_internal::Spi_Port_Func_t;
+
+  /// @brief Spi 句柄
+  static inline SPI_TypeDef*                   m_spi               = Interface::get_handle();
+  /// @brief Spi 中断通道
+  static inline interrupt::Interrupt_Channel_t m_interrupt_channel = Interface::get_interrupt_channel();
+  /// @brief Spi 传输完成函数
+  static inline Spi_Port_Func_t                m_function          = nullptr;
+  /// @brief Spi 传输完成函数参数
+  static inline void*                          m_arg               = nullptr;
+  /// @brief Spi 是否已打开
+  static inline bool                           m_opened            = false;
+  /// @brief Spi 发送填充字节 (无发送数据时使用)
+  static inline uint8_t                        m_fill              = base_internal::spi_internal::SPI_FILL_BYTE;
+  /// @brief Spi 接收丢弃字节 (无接收缓存区时使用)
+  static inline uint8_t                        m_discard           = 0;
+  /// @brief Spi 传输中的接收缓存区 (完成时失效数据缓存)
+  static inline uint8_t*                       m_rx                = nullptr;
+  /// @brief Spi 传输中的接收大小
+  static inline uint32_t                       m_rx_size           = 0;
+
+  /// @brief Spi 接收 DMA
+  static inline dma::Dma<base_internal::spi_internal::Spi_Rx_Dma_Config> m_rx_dma;
+  /// @brief Spi 发送 DMA
+  static inline dma::Dma<base_internal::spi_internal::Spi_Tx_Dma_Config> m_tx_dma;
+
+  /**
+   * @brief  Spi 结束本次传输 (关闭 SPI 与 DMA 请求，清除标志)
+   */
+  static void finish(void)
+  {
+    LL_SPI_DisableIT_EOT(m_spi);
+    LL_SPI_ClearFlag_EOT(m_spi);
+    LL_SPI_ClearFlag_TXTF(m_spi);
+    LL_SPI_Disable(m_spi);
+    LL_SPI_DisableDMAReq_TX(m_spi);
+    LL_SPI_DisableDMAReq_RX(m_spi);
+  }
+
+  /**
+   * @brief  Spi 完成本次传输 (失效接收缓存区后调用总线的传输完成函数)
+   *
+   * @param  ok  是否成功
+   */
+  static void complete(bool ok)
+  {
+    namespace port = system::system_internal::memory_internal::port;
+
+    finish();
+
+    // 传输期间的预取可能已将旧数据填入缓存行，完成后再次失效
+    if (nullptr != m_rx)
+    {
+      port::cache_invalidate(m_rx, m_rx_size);
+      m_rx = nullptr;
+    }
+
+    if (nullptr != m_function)
+    {
+      m_function(m_arg, ok);
+    }
+  }
+
+  /**
+   * @brief  Spi 接收 DMA 回调函数 (传输完成)
+   */
+  static void dma_rx_callback(dma::Dma_Callback_Args_t)
+  {
+    if (LL_SPI_IsActiveFlag_EOT(m_spi))
+    {
+      complete(true);
+    }
+    else
+    {
+      LL_SPI_EnableIT_EOT(m_spi);
+    }
+  }
+
+  /**
+   * @brief  Spi 中断处理 同步函数 (传输结束、溢出与模式错误)
+   */
+  static void irq_direct_handle(interrupt::Interrupt_Args_t, uint8_t)
+  {
+    if (LL_SPI_IsActiveFlag_OVR(m_spi) || LL_SPI_IsActiveFlag_MODF(m_spi))
+    {
+      LL_SPI_ClearFlag_OVR(m_spi);
+      LL_SPI_ClearFlag_MODF(m_spi);
+
+      m_rx_dma.stop();
+      m_tx_dma.stop();
+      complete(false);
+    }
+    else if (LL_SPI_IsEnabledIT_EOT(m_spi) && LL_SPI_IsActiveFlag_EOT(m_spi))
+    {
+      complete(true);
+    }
+  }
+
+  /**
+   * @brief  Spi 打开 (全双工主机，8位数据帧)
+   *
+   * @param  function      传输完成函数
+   * @param  arg           传输完成函数参数
+   * @param  priority      中断优先级 (SPI 与收发 DMA 相同，互不抢占)
+   * @param  sub_priority  中断子优先级
+   * @return true          打开成功
+   * @return false         已打开或初始化失败
+   */
+  static bool open(Spi_Port_Func_t function, void* arg, uint32_t priority, uint32_t sub_priority)
+  {
+    bool ret = false;
+
+    if (!m_opened)
+    {
+      if (dma::Dma_Error_Code::OK != m_rx_dma.template open<interrupt::Interrupt_Type::Direct>(Interface::get_rx_dma_request(), dma_rx_callback, nullptr, priority, sub_priority))
+      {
+      }
+      else if (dma::Dma_Error_Code::OK != m_tx_dma.template open<interrupt::Interrupt_Type::Direct>(Interface::get_tx_dma_request(), nullptr, nullptr, priority, sub_priority))
+      {
+        m_rx_dma.close();
+      }
+      else
+      {
+        LL_SPI_InitTypeDef spi_init = { 0 };
+
+        spi_init.TransferDirection  = LL_SPI_FULL_DUPLEX;
+        spi_init.Mode               = LL_SPI_MODE_MASTER;
+        spi_init.DataWidth          = LL_SPI_DATAWIDTH_8BIT;
+        spi_init.ClockPolarity      = LL_SPI_POLARITY_LOW;
+        spi_init.ClockPhase         = LL_SPI_PHASE_1EDGE;
+        spi_init.NSS                = LL_SPI_NSS_SOFT;
+        spi_init.BaudRate           = Interface::get_baud_rate_prescaler(base_internal::spi_internal::Default_Baud_Rate_Prescaler);
+        spi_init.BitOrder           = LL_SPI_MSB_FIRST;
+        spi_init.CRCCalculation     = LL_SPI_CRCCALCULATION_DISABLE;
+        spi_init.CRCPoly            = 0x07;
+
+        Interface::enable_clk();
+        Interface::gpio_init();
+
+        LL_SPI_Disable(m_spi);
+
+        if (SUCCESS != LL_SPI_Init(m_spi, &spi_init))
+        {
+          Interface::gpio_deinit();
+          Interface::disable_clk();
+          m_tx_dma.close();
+          m_rx_dma.close();
+        }
+        else
+        {
+          LL_SPI_SetFIFOThreshold(m_spi, LL_SPI_FIFO_TH_01DATA);
+          LL_SPI_SetInternalSSLevel(m_spi, LL_SPI_SS_LEVEL_HIGH);
+          LL_SPI_EnableGPIOControl(m_spi);
+          LL_SPI_EnableIT_OVR(m_spi);
+          LL_SPI_EnableIT_MODF(m_spi);
+
+          m_function = function;
+          m_arg      = arg;
+          m_opened   = true;
+
+          register_device(m_interrupt_channel, irq_direct_handle, nullptr, nullptr, priority, sub_priority);
+
+          ret = true;
+        }
+      }
+    }
+
+    return ret;
+  }
+
+  /**
+   * @brief  Spi 关闭 (中止传输中的事务，不产生回调)
+   */
+  static void close(void)
+  {
+    if (m_opened)
+    {
+      unregister_device(m_interrupt_channel);
+
+      m_rx_dma.close();
+      m_tx_dma.close();
+      finish();
+
+      m_rx = nullptr;
+
+      LL_SPI_DisableIT_OVR(m_spi);
+      LL_SPI_DisableIT_MODF(m_spi);
+      LL_SPI_DeInit(m_spi);
+
+      Interface::gpio_deinit();
+      Interface::disable_clk();
+
+      m_function = nullptr;
+      m_arg      = nullptr;
+      m_opened   = false;
+    }
+  }
+
+  /**
+   * @brief  Spi 写入设备总线配置 (SPE 关闭期间调用)
+   *
+   * @param  config  总线配置
+   */
+  static void configure(const Spi_Device_Config& config)
+  {
+    LL_SPI_SetBaudRatePrescaler(m_spi, Interface::get_baud_rate_prescaler(config.baud_rate_prescaler));
+    MODIFY_REG(m_spi->CFG2, SPI_CFG2_CPOL | SPI_CFG2_CPHA | SPI_CFG2_LSBFRST, config.clock_polarity | config.clock_phase | config.endian);
+  }
+
+  /**
+   * @brief  Spi 启动全双工 DMA 传输 (按 RM0433 顺序: RXDMAEN -> DMA 数据流 -> TXDMAEN -> SPE -> CSTART)
+   *
+   * @param  tx    发送数据 (nullptr 发送填充字节)
+   * @param  rx    接收数据 (nullptr 丢弃)
+   * @param  size  大小 (字节，不超过 SPI_MAX_TRANSFER)
+   */
+  static void transfer(const uint8_t* tx, uint8_t* rx, uint32_t size)
+  {
+    namespace port = system::system_internal::memory_internal::port;
+
+    const uint8_t* src = (nullptr != tx) ? tx : &m_fill;
+    uint8_t*       dst = (nullptr != rx) ? rx : &m_discard;
+
+    if (nullptr != tx)
+    {
+      port::cache_clean(tx, size);
+    }
+
+    if (nullptr != rx)
+    {
+      port::cache_clean_invalidate(rx, size);
+    }
+
+    m_rx      = rx;
+    m_rx_size = size;
+
+    m_tx_dma.set_memory_increment(nullptr != tx);
+    m_rx_dma.set_memory_increment(nullptr != rx);
+
+    LL_SPI_SetTransferSize(m_spi, size);
+    LL_SPI_EnableDMAReq_RX(m_spi);
+
+    m_rx_dma.start(LL_SPI_DMA_GetRxRegAddr(m_spi), static_cast<uint32_t>(reinterpret_cast<uintptr_t>(dst)), size);
+    m_tx_dma.start(static_cast<uint32_t>(reinterpret_cast<uintptr_t>(src)), LL_SPI_DMA_GetTxRegAddr(m_spi), size);
+
+    LL_SPI_EnableDMAReq_TX(m_spi);
+    LL_SPI_Enable(m_spi);
+    LL_SPI_StartMasterTransfer(m_spi);
+  }
+
+public:
+  /**
+   * @brief  Spi 获取端口编号
+   *
+   * @return uint32_t  端口编号
+   */
+  static constexpr uint32_t get_port_num(void)
+  {
+    return Port;
+  }
+
+  /**
+   * @brief  Spi 配置 构造函数
+   */
+  explicit Spi_Config() {}
+
+  /**
+   * @brief  Spi 配置 析构函数
+   */
+  ~Spi_Config() {}
+};
+} /* namespace spi */
+} /* namespace base */
+} /* namespace QAQ */
+
+INTERRUPT_HANDLER(SPI1)
+INTERRUPT_HANDLER(SPI2)
+INTERRUPT_HANDLER(SPI3)
+INTERRUPT_HANDLER(SPI4)
+INTERRUPT_HANDLER(SPI5)
+
+#endif /* __SPI_CONFIG_HPP__ */
@@ -0,0 +1,191 @@
+#ifndef __SPI_DEFINE_HPP__
+#define __SPI_DEFINE_HPP__
+
+#include "fast_memory_port.hpp"
+
+/// @brief 名称空间 QAQ
+namespace QAQ
+{
+/// @brief 名称空间 基本对象
+namespace base
+{
+/// @brief 名称空间 SPI
+namespace spi
+{
+/// @brief SPI 配置信息选项
+class Config
+{
+public:
+  /// @brief 工作模式
+  static constexpr uint32_t Mode                = 0x01;
+  /// @brief 字节序
+  static constexpr uint32_t Endian              = 0x02;
+  /// @brief 数据大小
+  static constexpr uint32_t Data_Size           = 0x03;
+  /// @brief 波特率分频系数
+  static constexpr uint32_t Baud_Rate_Prescaler = 0x04;
+  /// @brief 时钟极性
+  static constexpr uint32_t Clock_Polarity      = 0x05;
+  /// @brief 时钟相位
+  static constexpr uint32_t Clock_Phase         = 0x06;
+  /// @brief 端口编号
+  static constexpr uint32_t Port_Num            = 0x07;
+};
+
+/// @brief SPI 工作模式
+class Spi_Mode
+{
+public:
+  /// @brief 全双工从机
+  static constexpr uint32_t FULL_DUPLEX_SLAVE  = 0x00;
+  /// @brief 半双工从机
+  static constexpr uint32_t HALF_DUPLEX_SLAVE  = 0x01;
+  /// @brief 全双工主机
+  static constexpr uint32_t FULL_DUPLEX_MASTER = 0x02;
+  /// @brief 半双工主机
+  static constexpr uint32_t HALF_DUPLEX_MASTER = 0x03;
+};
+
+/// @brief SPI 字节序 (取值与 SPI_CFG2.LSBFRST 一致)
+class Spi_Endian
+{
+public:
+  /// @brief 大端序
+  static constexpr uint32_t MSB = 0x00;
+  /// @brief 小端序
+  static constexpr uint32_t LSB = 0x800000;
+};
+
+/// @brief SPI 时钟极性 (取值与 SPI_CFG2.CPOL 一致)
+class Spi_Clock_Polarity
+{
+public:
+  /// @brief 低极性
+  static constexpr uint32_t LOW_POLARITY  = 0x00;
+  /// @brief 高极性
+  static constexpr uint32_t HIGH_POLARITY = 0x2000000;
+};
+
+/// @brief SPI 时钟相位 (取值与 SPI_CFG2.CPHA 一致)
+class Spi_Clock_Phase
+{
+public:
+  /// @brief 第一个时钟沿
+  static constexpr uint32_t FIRST_EDGE  = 0x00;
+  /// @brief 第二个时钟沿
+  static constexpr uint32_t SECOND_EDGE = 0x01000000;
+};
+
+/**
+ * @brief SPI 设备总线配置 (总线切换至该设备时写入控制器)
+ */
+struct Spi_Device_Config
+{
+  uint32_t baud_rate_prescaler; /* 波特率分频系数 (2~256，2的幂) */
+  uint32_t clock_polarity;      /* 时钟极性 */
+  uint32_t clock_phase;         /* 时钟相位 */
+  uint32_t endian;              /* 字节序 */
+};
+
+/// @brief SPI 片选函数类型 (参数: 片选参数、是否选中)
+using Spi_Select_Func_t = void (*)(void*, bool);
+
+/**
+ * @brief SPI 总线设备 (一个片选对应一个设备)
+ */
+struct Spi_Device
+{
+  Spi_Device_Config config;     /* 总线配置 */
+  Spi_Select_Func_t select;     /* 片选函数 (nullptr 表示无片选) */
+  void*             select_arg; /* 片选函数参数 */
+};
+
+/**
+ * @brief SPI 事务事件
+ */
+enum class Spi_Event : uint8_t
+{
+  Complete,  /* 传输完成 */
+  Error,     /* 传输错误 */
+  Cancelled, /* 未启动即被取消 */
+};
+
+struct Spi_Transaction;
+
+/// @brief SPI 事务回调函数类型 (DMA 中断中执行; 参数: 回调参数、事务、事件)
+using Spi_Callback_Func_t = void (*)(void*, const Spi_Transaction&, Spi_Event);
+
+/**
+ * @brief SPI 全双工事务
+ */
+struct Spi_Transaction
+{
+  Spi_Device*         device;   /* 目标设备 */
+  const uint8_t*      tx;       /* 发送数据 (nullptr 发送填充字节 0xFF) */
+  uint8_t*            rx;       /* 接收数据 (nullptr 丢弃接收数据) */
+  uint32_t            size;     /* 大小 (字节) */
+  Spi_Callback_Func_t callback; /* 完成回调函数 */
+  void*               arg;      /* 完成回调函数参数 */
+};
+
+/**
+ * @brief SPI 总线统计信息
+ */
+struct Spi_Stats
+{
+  uint32_t transactions; /* 完成的事务数 */
+  uint32_t bytes;        /* 传输字节数 */
+  uint32_t errors;       /* 错误次数 */
+  uint32_t reconfigs;    /* 设备切换时的总线重配置次数 */
+  uint32_t peak_depth;   /* 队列最大深度 */
+};
+} /* namespace spi */
+
+/// @brief 命名空间 内部
+namespace base_internal
+{
+/// @brief 命名空间 SPI 内部
+namespace spi_internal
+{
+/// @brief Spi 默认工作模式
+inline constexpr uint32_t Default_Mode                = spi::Spi_Mode::FULL_DUPLEX_MASTER;
+/// @brief Spi 默认字节序
+inline constexpr uint32_t Default_Endian              = spi::Spi_Endian::MSB;
+/// @brief Spi 默认数据大小
+inline constexpr uint32_t Default_Data_Size           = 8;
+/// @brief Spi 默认波特率分频系数
+inline constexpr uint32_t Default_Baud_Rate_Prescaler = 4;
+/// @brief Spi 默认时钟极性
+inline constexpr uint32_t Default_Clock_Polarity      = spi::Spi_Clock_Polarity::LOW_POLARITY;
+/// @brief Spi 默认时钟相位
+inline constexpr uint32_t Default_Clock_Phase         = spi::Spi_Clock_Phase::FIRST_EDGE;
+/// @brief Spi 默认中断优先级
+inline constexpr uint32_t Default_Interrupt_Priority  = 5;
+/// @brief Spi 单次事务最大字节数 (SPI_CR2.TSIZE 与 DMA_SxNDTR 均为16位)
+inline constexpr uint32_t SPI_MAX_TRANSFER            = 0xFFFF;
+/// @brief Spi 无发送数据时的填充字节
+inline constexpr uint8_t  SPI_FILL_BYTE               = 0xFF;
+
+/// @brief SPI 端口传输完成函数类型 (端口在中断中调用; 参数: 回调参数、是否成功)
+using Spi_Port_Func_t = void (*)(void*, bool);
+
+/**
+ * @brief  SPI 判断波特率分频系数是否有效
+ *
+ * @param  prescaler  分频系数
+ * @return true       有效 (2~256 且为2的幂)
+ * @return false      无效
+ */
+constexpr bool spi_prescaler_valid(uint32_t prescaler) noexcept
+{
+  return (prescaler >= 2U) && (prescaler <= 256U) && (0U == (prescaler & (prescaler - 1U)));
+}
+
+static_assert(spi_prescaler_valid(2U) && spi_prescaler_valid(256U), "SPI prescaler range error");
+static_assert(!spi_prescaler_valid(1U) && !spi_prescaler_valid(6U) && !spi_prescaler_valid(512U), "SPI prescaler check error");
+} /* namespace spi_internal */
+} /* namespace base_internal */
+} /* namespace base */
+} /* namespace QAQ */
+
+#endif /* __SPI_DEFINE_HPP__ */
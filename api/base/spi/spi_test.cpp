@@ -0,0 +1,288 @@
+/**
+ * @file   spi_test.cpp
+ * @brief  SPI 总线 主机测试: 仿真从机功能测试与事务吞吐基准
+ *
+ * @note   仅用于主机，不参与固件编译 (已加入 eide excludeList);
+ *         功能测试覆盖寄存器读写、设备切换时的重新配置、时钟模式/字节序不匹配、错误注入、取消、
+ *         回调中链式提交、队列已满与关闭; 基准输出每种负载大小下的队列软件开销 (主机实测，纳秒/事务)
+ *         与按仿真内核时钟折算的线路极限 (事务/秒)
+ *
+ *         构建 (仓库根目录):
+ *         g++ -std=c++17 -O2 -g -fsanitize=address,undefined -fpermissive -w \
+ *             $(python3 -c "import json;c=json.load(open('.eide/eide.json'))['targets']['Debug']['custom_dep'];print(' '.join(['-I'+p for p in c['incList']]+['-D'+d for d in c['defineList']]))") \
+ *             -Iapi/base/spi api/base/spi/spi_test.cpp -o spi_test && ./spi_test
+ */
+#include "sim_spi.hpp"
+
+#include <chrono>
+#include <cstdio>
+
+using namespace QAQ::base::spi;
+
+namespace
+{
+/// @brief 仿真总线队列深度
+constexpr uint32_t QUEUE_DEPTH = 8;
+
+/// @brief 仿真端口
+using Port = Sim_Spi_Config<0>;
+/// @brief 仿真总线
+using Bus  = Sim_Spi_Bus<0, QUEUE_DEPTH>;
+
+/// @brief 失败的检查数
+int g_failures = 0;
+
+#define CHECK(cond)                                                  \
+  do                                                                 \
+  {                                                                  \
+    if (!(cond))                                                     \
+    {                                                                \
+      ++g_failures;                                                  \
+      printf("%s:%d: CHECK(%s) failed\n", __FILE__, __LINE__, #cond); \
+    }                                                                \
+  } while (0)
+
+/// @brief 回调记录 (参数 * 10 + 事件)
+int      g_events[64];
+/// @brief 回调记录数
+uint32_t g_event_count = 0;
+
+void record(void* arg, const Spi_Transaction&, Spi_Event event)
+{
+  if (g_event_count < 64)
+  {
+    g_events[g_event_count++] = static_cast<int>(reinterpret_cast<intptr_t>(arg)) * 10 + static_cast<int>(event);
+  }
+}
+
+/// @brief 回调中链式提交的上下文
+struct Chain
+{
+  Bus*        bus;
+  Spi_Device* device;
+  uint8_t     tx[2];
+  uint8_t     rx[2];
+  uint32_t    left;
+  uint32_t    errors;
+};
+
+void chain(void* arg, const Spi_Transaction&, Spi_Event event)
+{
+  Chain* context = static_cast<Chain*>(arg);
+
+  if (Spi_Event::Complete != event || 0x5A != context->rx[0])
+  {
+    ++context->errors;
+  }
+
+  if (0 != --context->left && !context->bus->submit(*context->device, context->tx, context->rx, 2, chain, context))
+  {
+    ++context->errors;
+  }
+}
+
+/// @brief 从机 A: 模式0，最高 PCLK/4
+Sim_Spi_Slave g_adc(Spi_Clock_Polarity::LOW_POLARITY, Spi_Clock_Phase::FIRST_EDGE, Spi_Endian::MSB, 4);
+/// @brief 从机 B: 模式3，最高 PCLK/8
+Sim_Spi_Slave g_lcd(Spi_Clock_Polarity::HIGH_POLARITY, Spi_Clock_Phase::SECOND_EDGE, Spi_Endian::MSB, 8);
+
+Spi_Device g_adc_device { { 4, Spi_Clock_Polarity::LOW_POLARITY, Spi_Clock_Phase::FIRST_EDGE, Spi_Endian::MSB }, Sim_Spi_Slave::select, &g_adc };
+Spi_Device g_lcd_device { { 8, Spi_Clock_Polarity::HIGH_POLARITY, Spi_Clock_Phase::SECOND_EDGE, Spi_Endian::MSB }, Sim_Spi_Slave::select, &g_lcd };
+} /* namespace */
+
+/**
+ * @brief  寄存器读写: 按提交顺序执行，设备切换时重新配置，完成后释放片选
+ */
+static void test_register_access(Bus& bus)
+{
+  uint8_t write[3]   = { 0x20, 0x01, 0x02 };
+  uint8_t read_tx[3] = { Sim_Spi_Slave::READ_FLAG | 0x10, 0, 0 };
+  uint8_t read_rx[3] = {};
+
+  g_adc.write_register(0x10, 0xAB);
+  g_adc.write_register(0x11, 0xCD);
+  g_event_count = 0;
+  bus.reset_stats();
+
+  CHECK(bus.submit(g_lcd_device, write, nullptr, 3, record, reinterpret_cast<void*>(1)));
+  CHECK(bus.submit(g_adc_device, read_tx, read_rx, 3, record, reinterpret_cast<void*>(2)));
+  CHECK(bus.submit(g_adc_device, nullptr, nullptr, 4, record, reinterpret_cast<void*>(3)));
+  CHECK(g_lcd.selected() && !g_adc.selected());
+  CHECK(3 == Port::run());
+
+  CHECK(3 == g_event_count && 10 == g_events[0] && 20 == g_events[1] && 30 == g_events[2]);
+  CHECK(Sim_Spi_Slave::STATUS == read_rx[0] && 0xAB == read_rx[1] && 0xCD == read_rx[2]);
+  CHECK(0x01 == g_lcd.read_register(0x20) && 0x02 == g_lcd.read_register(0x21));
+  CHECK(!g_adc.selected() && !g_lcd.selected());
+
+  Spi_Stats stats = bus.stats();
+  CHECK(3 == stats.transactions && 2 == stats.reconfigs && 3 == stats.peak_depth && 10 == stats.bytes && 0 == stats.errors);
+}
+
+/**
+ * @brief  时钟模式、速率与字节序不匹配
+ */
+static void test_mode_mismatch(Bus& bus)
+{
+  uint8_t read_tx[3] = { Sim_Spi_Slave::READ_FLAG | 0x10, 0, 0 };
+  uint8_t read_rx[3] = {};
+
+  g_adc.reset_stats();
+
+  Spi_Device phase             = g_adc_device;
+  phase.config.clock_phase     = Spi_Clock_Phase::SECOND_EDGE;
+  CHECK(bus.submit(phase, read_tx, read_rx, 3));
+  Port::run();
+  CHECK(0xFF == read_rx[0] && 0xFF == read_rx[1] && 1 == g_adc.stats().mode_errors);
+
+  Spi_Device fast                 = g_adc_device;
+  fast.config.baud_rate_prescaler = 2;
+  CHECK(bus.submit(fast, read_tx, read_rx, 3));
+  Port::run();
+  CHECK(0xFF == read_rx[1] && 2 == g_adc.stats().mode_errors);
+
+  // 主机 LSB 先行: 从机收到按位反转的首字节，主机收到按位反转的寄存器值
+  Spi_Device lsb     = g_adc_device;
+  lsb.config.endian  = Spi_Endian::LSB;
+  uint8_t lsb_tx[2]  = { 0x09, 0 };
+  CHECK(bus.submit(lsb, lsb_tx, read_rx, 2));
+  Port::run();
+  CHECK(0x5A == read_rx[0] && 0xD5 == read_rx[1]);
+}
+
+/**
+ * @brief  错误注入与取消: 取消仅影响指定设备未启动的事务，错误不影响后续事务
+ */
+static void test_error_and_cancel(Bus& bus)
+{
+  uint8_t read_tx[3] = { Sim_Spi_Slave::READ_FLAG | 0x10, 0, 0 };
+  uint8_t read_rx[3] = {};
+  uint8_t write[3]   = { 0x20, 0x01, 0x02 };
+
+  g_event_count = 0;
+  bus.reset_stats();
+  Port::fail_next(1);
+
+  CHECK(bus.submit(g_adc_device, read_tx, read_rx, 3, record, reinterpret_cast<void*>(4)));
+  CHECK(bus.submit(g_adc_device, read_tx, read_rx, 3, record, reinterpret_cast<void*>(5)));
+  CHECK(bus.submit(g_lcd_device, write, nullptr, 3, record, reinterpret_cast<void*>(6)));
+  CHECK(bus.pending(g_lcd_device));
+  CHECK(1 == bus.cancel(g_lcd_device));
+  CHECK(!bus.pending(g_lcd_device));
+  CHECK(1 == g_event_count && 62 == g_events[0]);
+
+  Port::run();
+  CHECK(3 == g_event_count && 41 == g_events[1] && 50 == g_events[2]);
+  CHECK(1 == bus.stats().errors && 0 == bus.depth());
+}
+
+/**
+ * @brief  回调中链式提交与队列已满
+ */
+static void test_chain_and_queue_full(Bus& bus)
+{
+  uint8_t write[3] = { 0x20, 0x01, 0x02 };
+  Chain   context  = { &bus, &g_adc_device, { Sim_Spi_Slave::READ_FLAG | 0x10, 0 }, {}, 1000, 0 };
+
+  CHECK(bus.submit(g_adc_device, context.tx, context.rx, 2, chain, &context));
+
+  for (uint32_t i = 1; i < QUEUE_DEPTH; ++i)
+  {
+    CHECK(bus.submit(g_lcd_device, write, nullptr, 3));
+  }
+
+  CHECK(!bus.submit(g_lcd_device, write, nullptr, 3));
+  CHECK(QUEUE_DEPTH == bus.depth());
+
+  Port::run();
+  CHECK(0 == context.left && 0 == context.errors && 0 == bus.depth());
+}
+
+/**
+ * @brief  关闭总线: 全部事务以 Cancelled 回调，片选释放，不再有登记的传输
+ */
+static void test_close(Bus& bus)
+{
+  uint8_t read_tx[3] = { Sim_Spi_Slave::READ_FLAG | 0x10, 0, 0 };
+  uint8_t read_rx[3] = {};
+
+  g_event_count = 0;
+  CHECK(bus.submit(g_adc_device, read_tx, read_rx, 3, record, reinterpret_cast<void*>(7)));
+  CHECK(bus.submit(g_adc_device, read_tx, read_rx, 3, record, reinterpret_cast<void*>(8)));
+  bus.close();
+
+  CHECK(2 == g_event_count && 72 == g_events[0] && 82 == g_events[1]);
+  CHECK(!g_adc.selected());
+  CHECK(!Port::step());
+  CHECK(!bus.submit(g_adc_device, read_tx, read_rx, 3));
+  CHECK(bus.open());
+}
+
+/**
+ * @brief  事务吞吐基准: 单事务往返与队列满载两种方式
+ */
+static void bench_throughput(Bus& bus)
+{
+  static uint8_t tx[4096];
+  static uint8_t rx[4096];
+  const uint32_t sizes[] = { 2, 16, 256, 4096 };
+
+  printf("%-6s %-6s %14s %14s %16s\n", "bytes", "mode", "host ns/tr", "host tr/s", "wire tr/s @/4");
+
+  for (uint32_t size : sizes)
+  {
+    for (int queued = 0; queued < 2; ++queued)
+    {
+      const uint32_t total = 400000 / size + 1000;
+
+      bus.reset_stats();
+      Port::reset_stats();
+
+      const auto start = std::chrono::steady_clock::now();
+
+      for (uint32_t done = 0; done < total;)
+      {
+        const uint32_t batch = queued ? QUEUE_DEPTH : 1;
+
+        for (uint32_t i = 0; i < batch; ++i)
+        {
+          bus.submit(g_adc_device, tx, rx, size);
+        }
+
+        done += Port::run();
+      }
+
+      const double        seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+      const Sim_Spi_Stats stats   = Port::stats();
+
+      CHECK(stats.transfers == bus.stats().transactions);
+      printf("%-6u %-6s %14.1f %14.0f %16.0f\n", size, queued ? "queue" : "single", seconds * 1e9 / stats.transfers, stats.transfers / seconds, stats.transfers * 1e9 / static_cast<double>(stats.bus_ns));
+    }
+  }
+}
+
+int main(void)
+{
+  Port::attach(g_adc);
+  Port::attach(g_lcd);
+
+  {
+    Bus bus;
+    CHECK(bus.open());
+    CHECK(!bus.open());
+
+    test_register_access(bus);
+    test_mode_mismatch(bus);
+    test_error_and_cancel(bus);
+    test_chain_and_queue_full(bus);
+    test_close(bus);
+    bench_throughput(bus);
+  }
+
+  Port::detach(g_lcd);
+  Port::detach(g_adc);
+
+  printf("spi_test: %s (%d failures)\n", 0 == g_failures ? "OK" : "FAILED", g_failures);
+  fflush(stdout);
+  return 0 == g_failures ? 0 : 1;
+}
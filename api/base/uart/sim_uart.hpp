@@ -0,0 +1,1203 @@
+#ifndef __SIM_UART_HPP__
+#define __SIM_UART_HPP__
+
+#include "soft_timer.hpp"
+#include "uart_base.hpp"
+
+/**
+ * @note  仿真串口: 以软件定时器为线路时钟，按波特率与帧格式 (起始位 + 数据位 + 校验位 + 停止位) 每个时钟节拍推进线路,
+ *        提供与 Uart_Config 相同的静态配置接口，直接驱动 Uart_Base 的接收字节、接收完成、内存切换与发送完成回调;
+ *        接收中断模式逐字节触发字节接收回调; DMA 模式填满缓存区或线路空闲时触发接收完成回调;
+ *        DMA 双缓冲模式填满半区时触发内存切换回调、线路空闲时触发接收完成回调 (与硬件驱动一致，不使用半传输回调);
+ *        线路在节拍内发送完毕即视为空闲，节拍内未发送完毕则保持忙碌; 收发双方波特率不一致时以发送方为准
+ */
+
+/// @brief 名称空间 QAQ
+namespace QAQ
+{
+/// @brief 名称空间 基本对象
+namespace base
+{
+/// @brief 名称空间 串口
+namespace uart
+{
+/// @brief 仿真串口 统计
+struct Sim_Uart_Stats
+{
+  uint32_t tx_bytes;      /* 发送字节数 */
+  uint32_t rx_bytes;      /* 接收字节数 */
+  uint32_t overrun_bytes; /* 接收未使能或缓存区已满时丢弃的字节数 */
+  uint32_t idle_count;    /* 线路空闲次数 */
+  uint32_t tx_transfers;  /* 启动发送次数 */
+  uint32_t tx_gap_ticks;  /* 发送完成至下一次启动发送的累计间隔 (节拍) */
+  uint32_t tx_gap_max;    /* 发送完成至下一次启动发送的最大间隔 (节拍) */
+};
+} /* namespace uart */
+
+/// @brief 命名空间 内部
+namespace base_internal
+{
+/// @brief 名称空间 串口 内部
+namespace uart_internal
+{
+class Sim_Uart_Clock;
+
+/**
+ * @brief 仿真串口 线路基类
+ *
+ */
+class Sim_Uart_Line
+{
+  // 禁止拷贝和移动
+  QAQ_NO_COPY_MOVE(Sim_Uart_Line)
+
+  /// @brief 友元声明 仿真串口时钟
+  friend class Sim_Uart_Clock;
+
+private:
+  /// @brief 下一条线路 (时钟链表)
+  Sim_Uart_Line* m_next        = nullptr;
+  /// @brief 对端线路
+  Sim_Uart_Line* m_peer        = nullptr;
+  /// @brief 发送数据指针
+  const uint8_t* m_tx_data     = nullptr;
+  /// @brief 发送剩余字节数
+  uint32_t       m_tx_size     = 0;
+  /// @brief 注入数据指针 (模拟对端发送至本线路)
+  const uint8_t* m_inject_data = nullptr;
+  /// @brief 注入剩余字节数
+  uint32_t       m_inject_size = 0;
+  /// @brief 波特率积分 (节拍间余量)
+  uint64_t       m_credit      = 0;
+  /// @brief 接收帧进行中
+  bool           m_rx_in_frame = false;
+  /// @brief 接收线路本节拍末仍忙碌
+  bool           m_rx_busy     = false;
+  /// @brief 线路节拍计数
+  uint32_t       m_tick        = 0;
+  /// @brief 上一次发送完成节拍
+  uint32_t       m_tx_idle_at  = 0;
+  /// @brief 发送间隔计时有效 (已完成过一次发送)
+  bool           m_tx_idled    = false;
+
+  /**
+   * @brief  仿真串口 接收数据
+   *
+   * @param  data  数据指针
+   * @param  size  数据大小
+   * @param  busy  节拍末线路是否仍忙碌
+   */
+  void receive(const uint8_t* data, uint32_t size, bool busy)
+  {
+    m_stats.rx_bytes += size;
+    m_rx_in_frame     = true;
+    m_rx_busy         = m_rx_busy || busy;
+    rx_bytes(data, size);
+  }
+
+  /**
+   * @brief  仿真串口 线路推进一个节拍
+   */
+  void step_transmit(void)
+  {
+    m_tick++;
+
+    if ((0 == m_tx_size) && (0 == m_inject_size))
+    {
+      m_credit = 0;
+    }
+    else
+    {
+      const uint64_t unit      = static_cast<uint64_t>(frame_bits()) * TX_TIMER_TICKS_PER_SECOND;
+      uint32_t       budget    = 0;
+      uint32_t       tx_budget = 0;
+
+      m_credit  += m_baud_rate;
+      budget     = static_cast<uint32_t>(m_credit / unit);
+      m_credit  -= budget * unit;
+      tx_budget  = budget;
+
+      // 发送完成回调中接续的发送使用本节拍剩余的字节数 (与硬件一致，接续发送之间线路不空闲)
+      while ((0 != tx_budget) && (0 != m_tx_size))
+      {
+        const uint32_t count  = std::min(tx_budget, m_tx_size);
+        const uint8_t* data   = m_tx_data;
+
+        m_tx_data            += count;
+        m_tx_size            -= count;
+        m_stats.tx_bytes     += count;
+        tx_budget            -= count;
+
+        if (nullptr != m_peer)
+        {
+          m_peer->receive(data, count, 0 != m_tx_size);
+        }
+
+        if (0 == m_tx_size)
+        {
+          m_tx_data    = nullptr;
+          m_tx_idle_at = m_tick;
+          m_tx_idled   = true;
+          tx_complete();
+        }
+      }
+
+      // 本节拍字节数恰好用尽时接续的发送同样使对端线路保持忙碌
+      if ((0 != m_tx_size) && (nullptr != m_peer))
+      {
+        m_peer->m_rx_busy = true;
+      }
+
+      if (0 != m_inject_size)
+      {
+        const uint32_t count  = std::min(budget, m_inject_size);
+        const uint8_t* data   = m_inject_data;
+
+        m_inject_data        += count;
+        m_inject_size        -= count;
+
+        receive(data, count, 0 != m_inject_size);
+      }
+    }
+  }
+
+  /**
+   * @brief  仿真串口 线路空闲检测
+   */
+  void step_idle(void)
+  {
+    if (m_rx_in_frame && !m_rx_busy)
+    {
+      m_rx_in_frame = false;
+      m_stats.idle_count++;
+      rx_idle();
+    }
+
+    m_rx_busy = false;
+  }
+
+protected:
+  /// @brief 波特率
+  uint32_t             m_baud_rate = 0;
+  /// @brief 数据位
+  uint8_t              m_data_bits = 0;
+  /// @brief 停止位
+  uint8_t              m_stop_bits = 0;
+  /// @brief 校验位
+  uint8_t              m_parity    = 0;
+  /// @brief 统计
+  uart::Sim_Uart_Stats m_stats     = { 0 };
+
+  /**
+   * @brief  仿真串口 接收字节处理 - 纯虚函数
+   *
+   * @param  data  数据指针
+   * @param  size  数据大小
+   */
+  virtual void rx_bytes(const uint8_t* data, uint32_t size) = 0;
+
+  /**
+   * @brief  仿真串口 线路空闲处理 - 纯虚函数
+   */
+  virtual void rx_idle(void)                                = 0;
+
+  /**
+   * @brief  仿真串口 发送完成处理 - 纯虚函数
+   */
+  virtual void tx_complete(void)                            = 0;
+
+  /**
+   * @brief  仿真串口 获取帧位数
+   *
+   * @return uint32_t 帧位数
+   */
+  uint32_t frame_bits(void) const
+  {
+    return 1 + m_data_bits + m_stop_bits + ((uart::Uart_Parity::None == m_parity) ? 0 : 1);
+  }
+
+  /**
+   * @brief  仿真串口 开始发送 (线路忙碌时忽略)
+   *
+   * @param  data  数据指针
+   * @param  size  数据大小
+   * @note   统计与上一次发送完成的间隔节拍，发送完成回调中直接接续发送时间隔为0
+   */
+  void start_transmit(const uint8_t* data, uint32_t size)
+  {
+    if ((0 == m_tx_size) && (0 != size))
+    {
+      m_tx_data = data;
+      m_tx_size = size;
+      m_stats.tx_transfers++;
+
+      if (m_tx_idled)
+      {
+        const uint32_t gap = m_tick - m_tx_idle_at;
+
+        m_stats.tx_gap_ticks += gap;
+        m_stats.tx_gap_max    = std::max(m_stats.tx_gap_max, gap);
+      }
+    }
+  }
+
+  /**
+   * @brief  仿真串口 立即发送 (轮询发送模式，不计时)
+   *
+   * @param  data  数据指针
+   * @param  size  数据大小
+   */
+  void transmit_now(const uint8_t* data, uint32_t size)
+  {
+    m_stats.tx_bytes += size;
+
+    if (nullptr != m_peer)
+    {
+      m_peer->receive(data, size, false);
+    }
+  }
+
+  /**
+   * @brief  仿真串口 清除线路状态
+   */
+  void reset_line(void)
+  {
+    m_tx_data     = nullptr;
+    m_tx_size     = 0;
+    m_inject_data = nullptr;
+    m_inject_size = 0;
+    m_credit      = 0;
+    m_rx_in_frame = false;
+    m_rx_busy     = false;
+    m_tx_idled    = false;
+  }
+
+  /**
+   * @brief 仿真串口 线路构造函数
+   */
+  explicit Sim_Uart_Line() {}
+
+  /**
+   * @brief 仿真串口 线路析构函数
+   */
+  virtual ~Sim_Uart_Line() {}
+
+public:
+  /**
+   * @brief  仿真串口 连接两条线路 (全双工交叉连接，与自身连接即为回环)
+   *
+   * @param  peer 对端线路
+   */
+  void connect(Sim_Uart_Line& peer)
+  {
+    system::kernel::Interrupt_Guard guard;
+
+    m_peer      = &peer;
+    peer.m_peer = this;
+  }
+
+  /**
+   * @brief  仿真串口 注入接收数据 (模拟对端以本线路波特率发送，数据需保持有效直至发送完毕)
+   *
+   * @param  data   数据指针
+   * @param  size   数据大小
+   * @return true   成功
+   * @return false  上一次注入未完成
+   */
+  bool inject(const uint8_t* data, uint32_t size)
+  {
+    system::kernel::Interrupt_Guard guard;
+    bool                            ret = false;
+
+    if (0 == m_inject_size)
+    {
+      m_inject_data = data;
+      m_inject_size = size;
+      ret           = true;
+    }
+
+    return ret;
+  }
+
+  /**
+   * @brief  仿真串口 注入是否完成
+   *
+   * @return true   完成
+   * @return false  未完成
+   */
+  bool inject_done(void) const
+  {
+    return 0 == m_inject_size;
+  }
+
+  /**
+   * @brief  仿真串口 获取统计
+   *
+   * @return uart::Sim_Uart_Stats 统计
+   */
+  uart::Sim_Uart_Stats stats(void) const
+  {
+    return m_stats;
+  }
+
+  /**
+   * @brief  仿真串口 清零统计
+   */
+  void reset_stats(void)
+  {
+    system::kernel::Interrupt_Guard guard;
+    m_stats = { 0 };
+  }
+};
+
+/**
+ * @brief 仿真串口 线路时钟 (软件定时器，每节拍推进全部已打开的线路)
+ *
+ */
+class Sim_Uart_Clock final : public system::Soft_Timer<Sim_Uart_Clock>
+{
+  // 禁止拷贝和移动
+  QAQ_NO_COPY_MOVE(Sim_Uart_Clock)
+
+  /// @brief 友元声明 定时器回调
+  template <typename T>
+  friend void system::system_internal::soft_timer_internal::timer_callback(ULONG arg);
+
+private:
+  /// @brief 仿真串口时钟 定时器名称
+  static constexpr const char* TIMER_NAME = "Sim Uart Clock";
+
+  /// @brief 线路链表
+  Sim_Uart_Line* m_lines                  = nullptr;
+
+  /**
+   * @brief  仿真串口时钟 定时器回调 (定时器线程中执行，与仿真串口接口互斥)
+   */
+  void callback(void)
+  {
+    system::kernel::Interrupt_Guard guard;
+
+    for (Sim_Uart_Line* line = m_lines; nullptr != line; line = line->m_next)
+    {
+      line->step_transmit();
+    }
+
+    for (Sim_Uart_Line* line = m_lines; nullptr != line; line = line->m_next)
+    {
+      line->step_idle();
+    }
+  }
+
+  /**
+   * @brief 仿真串口时钟 构造函数
+   */
+  explicit Sim_Uart_Clock() : Soft_Timer(1, true)
+  {
+    create(TIMER_NAME, true);
+  }
+
+  /**
+   * @brief 仿真串口时钟 析构函数
+   */
+  ~Sim_Uart_Clock() {}
+
+public:
+  /**
+   * @brief  仿真串口时钟 获取单例
+   *
+   * @return Sim_Uart_Clock& 单例
+   */
+  static Sim_Uart_Clock& instance(void)
+  {
+    static Sim_Uart_Clock instance;
+    return instance;
+  }
+
+  /**
+   * @brief  仿真串口时钟 添加线路
+   *
+   * @param  line 线路
+   */
+  void attach(Sim_Uart_Line& line)
+  {
+    system::kernel::Interrupt_Guard guard;
+    Sim_Uart_Line*                  node = m_lines;
+
+    while ((nullptr != node) && (&line != node))
+    {
+      node = node->m_next;
+    }
+
+    if (nullptr == node)
+    {
+      line.m_next = m_lines;
+      m_lines     = &line;
+    }
+  }
+
+  /**
+   * @brief  仿真串口时钟 移除线路
+   *
+   * @param  line 线路
+   */
+  void detach(Sim_Uart_Line& line)
+  {
+    system::kernel::Interrupt_Guard guard;
+    Sim_Uart_Line**                 link = &m_lines;
+
+    while ((nullptr != *link) && (&line != *link))
+    {
+      link = &(*link)->m_next;
+    }
+
+    if (nullptr != *link)
+    {
+      *link       = line.m_next;
+      line.m_next = nullptr;
+    }
+  }
+};
+} /* namespace uart_internal */
+} /* namespace base_internal */
+
+/// @brief 名称空间 串口
+namespace uart
+{
+/**
+ * @brief  仿真串口 配置模版类 (替代 Uart_Config 接入 Uart_Base)
+ *
+ * @tparam Id       仿真端口编号 (区分静态状态，与硬件端口无关)
+ * @tparam Rx_Type  接收类型
+ * @tparam Tx_Type  发送类型
+ */
+template <uint8_t Id, Uart_Type Rx_Type, Uart_Type Tx_Type>
+class Sim_Uart_Config
+{
+  /// @warning 接收类型合法性判断
+  static_assert(Uart_Type::Normal != Rx_Type, "Receive type not support Normal");
+  /// @warning 发送类型合法性判断
+  static_assert(Uart_Type::DMA_Double_Buffer != Tx_Type, "Transmit type not support DMA_Double_Buffer");
+
+  // 禁止拷贝和移动
+  QAQ_NO_COPY_MOVE(Sim_Uart_Config)
+
+private:
+  /// @brief 友元类声明 Uart_Base 模版类
+  template <system::device::Stream_Type Type, typename Config, typename Base_Device, typename DE_Pin, typename RE_Pin>
+  friend class base_internal::uart_internal::Uart_Base;
+
+  /// @brief  Uart 回调函数
+  using Uart_Func_t     = system::system_internal::device_internal::Device_Func_t;
+  /// @brief  Uart 回调函数参数
+  using Uart_Args_t     = system::system_internal::device_internal::Device_Args_t;
+  /// @brief  Uart 错误码
+  using Uart_Error_Code = system::device::Device_Error_Code;
+
+  /// @brief  Uart 回调函数信息结构体
+  struct Callback_t
+  {
+    Uart_Func_t received_byte_callback;     /* 字节接收回调函数 */
+    Uart_Args_t received_byte_arg;          /* 字节接收回调函数参数 */
+    Uart_Func_t received_complete_callback; /* 接收完成回调函数 */
+    Uart_Args_t received_complete_arg;      /* 接收完成回调函数参数 */
+    Uart_Func_t send_start_callback;        /* 开始发送回调函数 */
+    Uart_Args_t send_start_arg;             /* 开始发送回调函数参数 */
+    Uart_Func_t send_complete_callback;     /* 发送完成回调函数 */
+    Uart_Args_t send_complete_arg;          /* 发送完成回调函数参数 */
+    Uart_Func_t memory_switch_callback;     /* 双缓冲内存切换回调函数 */
+    Uart_Args_t memory_switch_arg;          /* 双缓冲内存切换回调函数参数 */
+    Uart_Func_t error_callback;             /* 错误回调函数 */
+    Uart_Args_t error_arg;                  /* 错误回调函数参数 */
+  };
+
+  /**
+   * @brief 仿真串口 线路 (模拟接收数据寄存器与接收 DMA)
+   *
+   */
+  class Line final : public base_internal::uart_internal::Sim_Uart_Line
+  {
+  public:
+    /// @brief 接收数据寄存器
+    uint8_t  rdr           = 0;
+    /// @brief 接收 DMA 内存指针
+    uint8_t* rx_memory[2]  = { nullptr, nullptr };
+    /// @brief 接收 DMA 内存大小
+    uint32_t rx_size       = 0;
+    /// @brief 接收 DMA 当前内存
+    uint32_t rx_index      = 0;
+    /// @brief 接收 DMA 已传输大小
+    uint32_t rx_count      = 0;
+    /// @brief 接收使能
+    bool     rx_enabled    = false;
+    /// @brief 中断优先级
+    uint8_t  priority      = 0x05;
+    /// @brief 中断子优先级
+    uint8_t  sub_priority  = 0x00;
+
+    /// @brief 帧格式设置
+    using Sim_Uart_Line::m_baud_rate;
+    using Sim_Uart_Line::m_data_bits;
+    using Sim_Uart_Line::m_parity;
+    using Sim_Uart_Line::m_stop_bits;
+    using Sim_Uart_Line::reset_line;
+    using Sim_Uart_Line::start_transmit;
+    using Sim_Uart_Line::transmit_now;
+
+  private:
+    /**
+     * @brief  仿真串口 接收字节处理
+     *
+     * @param  data  数据指针
+     * @param  size  数据大小
+     */
+    void rx_bytes(const uint8_t* data, uint32_t size) override
+    {
+      if constexpr (Uart_Type::Interrupt == Rx_Type)
+      {
+        if (rx_enabled)
+        {
+          for (uint32_t i = 0; i < size; ++i)
+          {
+            rdr = data[i];
+
+            if (m_callback.received_byte_callback)
+            {
+              m_callback.received_byte_callback(m_callback.received_byte_arg);
+            }
+          }
+        }
+        else
+        {
+          m_stats.overrun_bytes += size;
+        }
+      }
+      else
+      {
+        uint32_t offset = 0;
+
+        while ((offset < size) && rx_enabled)
+        {
+          const uint32_t length = std::min(size - offset, rx_size - rx_count);
+
+          system::memory::fast_memcpy(rx_memory[rx_index] + rx_count, data + offset, length);
+          offset   += length;
+          rx_count += length;
+
+          if (rx_size == rx_count)
+          {
+            if constexpr (Uart_Type::DMA == Rx_Type)
+            {
+              // 普通模式 DMA 传输完成后停止，由接收完成回调重新使能
+              rx_enabled = false;
+
+              if (m_callback.received_complete_callback)
+              {
+                m_callback.received_complete_callback(m_callback.received_complete_arg);
+              }
+            }
+            else
+            {
+              rx_index ^= 1;
+              rx_count  = 0;
+
+              if (m_callback.memory_switch_callback)
+              {
+                m_callback.memory_switch_callback(m_callback.memory_switch_arg);
+              }
+            }
+          }
+        }
+
+        m_stats.overrun_bytes += size - offset;
+      }
+    }
+
+    /**
+     * @brief  仿真串口 线路空闲处理
+     */
+    void rx_idle(void) override
+    {
+      if constexpr (Uart_Type::Interrupt == Rx_Type)
+      {
+        if (rx_enabled && m_callback.received_complete_callback)
+        {
+          m_callback.received_complete_callback(m_callback.received_complete_arg);
+        }
+      }
+      else
+      {
+        if (rx_enabled && (0 != rx_count))
+        {
+          rx_enabled = false;
+
+          if (m_callback.received_complete_callback)
+          {
+            m_callback.received_complete_callback(m_callback.received_complete_arg);
+          }
+        }
+      }
+    }
+
+    /**
+     * @brief  仿真串口 发送完成处理
+     */
+    void tx_complete(void) override
+    {
+      if (m_callback.send_complete_callback)
+      {
+        m_callback.send_complete_callback(m_callback.send_complete_arg);
+      }
+    }
+  };
+
+  /// @brief Uart 回调函数信息结构体
+  static inline Callback_t m_callback = { 0 };
+  /// @brief 仿真串口 线路
+  static inline Line       m_line;
+
+public:
+  /**
+   * @brief  Uart 获取接收缓冲区工作模式
+   *
+   * @return Ring_Buffer_Mode 接收缓冲区工作模式
+   */
+  static constexpr system::memory::Ring_Buffer_Mode get_received_buffer_mode(void)
+  {
+    if constexpr (Rx_Type == Uart_Type::Interrupt)
+      return system::memory::Ring_Buffer_Mode::INPUT_BYTES;
+    else if constexpr (Rx_Type == Uart_Type::DMA)
+      return system::memory::Ring_Buffer_Mode::INPUT_SINGLE_BUFFER;
+    else if constexpr (Rx_Type == Uart_Type::DMA_Double_Buffer)
+      return system::memory::Ring_Buffer_Mode::INPUT_DOUBLE_BUFFER;
+  }
+
+  /**
+   * @brief  Uart 获取接收类型
+   *
+   * @return Uart_Type 接收类型
+   */
+  static constexpr Uart_Type received_type(void)
+  {
+    return Rx_Type;
+  }
+
+  /**
+   * @brief  Uart 获取发送类型
+   *
+   * @return Uart_Type 发送类型
+   */
+  static constexpr Uart_Type send_type(void)
+  {
+    return Tx_Type;
+  }
+
+  /**
+   * @brief  仿真串口 获取线路
+   *
+   * @return Sim_Uart_Line& 线路
+   */
+  static base_internal::uart_internal::Sim_Uart_Line& line(void)
+  {
+    return m_line;
+  }
+
+  /**
+   * @brief  仿真串口 连接对端 (全双工交叉连接)
+   *
+   * @tparam Peer 对端仿真串口配置
+   */
+  template <typename Peer>
+  static void connect(void)
+  {
+    m_line.connect(Peer::line());
+  }
+
+  /**
+   * @brief  仿真串口 注入接收数据
+   *
+   * @param  data   数据指针 (需保持有效直至注入完成)
+   * @param  size   数据大小
+   * @return true   成功
+   * @return false  上一次注入未完成
+   */
+  static bool inject(const uint8_t* data, uint32_t size)
+  {
+    return m_line.inject(data, size);
+  }
+
+  /**
+   * @brief  仿真串口 获取统计
+   *
+   * @return Sim_Uart_Stats 统计
+   */
+  static Sim_Uart_Stats stats(void)
+  {
+    return m_line.stats();
+  }
+
+private:
+  /**
+   * @brief  Uart 读取接收数据寄存器
+   *
+   * @return uint8_t 接收数据
+   */
+  static const uint8_t read_rdr(void)
+  {
+    return m_line.rdr;
+  }
+
+  /**
+   * @brief  Uart 获取接收数据大小
+   *
+   * @return uint32_t 接收数据大小
+   * @note   该函数仅在接收模式为DMA与DMA双缓冲模式时生效
+   */
+  template <bool enable = (Uart_Type::DMA == Rx_Type || Uart_Type::DMA_Double_Buffer == Rx_Type), typename = std::enable_if_t<enable>>
+  static uint32_t receive_size(void)
+  {
+    return m_line.rx_count;
+  }
+
+  /**
+   * @brief  Uart 字节接收回调函数
+   *
+   * @param  function 回调函数
+   * @param  arg      回调函数参数
+   */
+  static void set_received_byte_callback(Uart_Func_t function, Uart_Args_t arg)
+  {
+    m_callback.received_byte_callback = function;
+    m_callback.received_byte_arg      = arg;
+  }
+
+  /**
+   * @brief  Uart 设置接收完成回调函数
+   *
+   * @param  function 回调函数
+   * @param  arg      回调函数参数
+   */
+  static void set_received_complete_callback(Uart_Func_t function, Uart_Args_t arg)
+  {
+    m_callback.received_complete_callback = function;
+    m_callback.received_complete_arg      = arg;
+  }
+
+  /**
+   * @brief  Uart 设置开始发送回调函数
+   *
+   * @param  function 回调函数
+   * @param  arg      回调函数参数
+   */
+  static void set_send_start_callback(Uart_Func_t function, Uart_Args_t arg)
+  {
+    m_callback.send_start_callback = function;
+    m_callback.send_start_arg      = arg;
+  }
+
+  /**
+   * @brief  Uart 设置发送完成回调函数
+   *
+   * @param  function 回调函数
+   * @param  arg      回调函数参数
+   */
+  static void set_send_complete_callback(Uart_Func_t function, Uart_Args_t arg)
+  {
+    m_callback.send_complete_callback = function;
+    m_callback.send_complete_arg      = arg;
+  }
+
+  /**
+   * @brief  Uart 设置双缓冲内存切换回调函数
+   *
+   * @param  function 回调函数
+   * @param  arg      回调函数参数
+   */
+  static void set_memory_switch_callback(Uart_Func_t function, Uart_Args_t arg)
+  {
+    m_callback.memory_switch_callback = function;
+    m_callback.memory_switch_arg      = arg;
+  }
+
+  /**
+   * @brief  Uart 设置错误回调函数
+   *
+   * @param  function 回调函数
+   * @param  arg      回调函数参数
+   */
+  static void set_error_callback(Uart_Func_t function, Uart_Args_t arg)
+  {
+    m_callback.error_callback = function;
+    m_callback.error_arg      = arg;
+  }
+
+  /**
+   * @brief  Uart 设置波特率
+   *
+   * @param  baud_rate       波特率
+   * @return Uart_Error_Code 错误码
+   */
+  static Uart_Error_Code set_baud_rate(uint32_t baud_rate)
+  {
+    Uart_Error_Code error_code = Uart_Error_Code::OK;
+
+    if (0 == baud_rate)
+    {
+      error_code = Uart_Error_Code::INVALID_PARAMETER;
+    }
+    else
+    {
+      system::kernel::Interrupt_Guard guard;
+      m_line.m_baud_rate = baud_rate;
+    }
+
+    return error_code;
+  }
+
+  /**
+   * @brief  Uart 设置数据位
+   *
+   * @param  data_bits       数据位
+   * @return Uart_Error_Code 错误码
+   */
+  static Uart_Error_Code set_data_bits(uint8_t data_bits)
+  {
+    Uart_Error_Code error_code = Uart_Error_Code::OK;
+
+    if ((7 > data_bits) || (9 < data_bits))
+    {
+      error_code = Uart_Error_Code::INVALID_PARAMETER;
+    }
+    else
+    {
+      system::kernel::Interrupt_Guard guard;
+      m_line.m_data_bits = data_bits;
+    }
+
+    return error_code;
+  }
+
+  /**
+   * @brief  Uart 设置停止位
+   *
+   * @param  stop_bits       停止位
+   * @return Uart_Error_Code 错误码
+   */
+  static Uart_Error_Code set_stop_bits(uint8_t stop_bits)
+  {
+    Uart_Error_Code error_code = Uart_Error_Code::OK;
+
+    if ((1 != stop_bits) && (2 != stop_bits))
+    {
+      error_code = Uart_Error_Code::INVALID_PARAMETER;
+    }
+    else
+    {
+      system::kernel::Interrupt_Guard guard;
+      m_line.m_stop_bits = stop_bits;
+    }
+
+    return error_code;
+  }
+
+  /**
+   * @brief  Uart 设置校验位
+   *
+   * @param  parity          校验位
+   * @return Uart_Error_Code 错误码
+   */
+  static Uart_Error_Code set_parity(uint8_t parity)
+  {
+    Uart_Error_Code error_code = Uart_Error_Code::OK;
+
+    if ((Uart_Parity::None != parity) && (Uart_Parity::Even != parity) && (Uart_Parity::Odd != parity))
+    {
+      error_code = Uart_Error_Code::INVALID_PARAMETER;
+    }
+    else
+    {
+      system::kernel::Interrupt_Guard guard;
+      m_line.m_parity = parity;
+    }
+
+    return error_code;
+  }
+
+  /**
+   * @brief  Uart 设置中断优先级 (仅记录)
+   *
+   * @param  priority        中断优先级
+   * @return Uart_Error_Code 错误码
+   */
+  static Uart_Error_Code set_interrupt_priority(uint8_t priority)
+  {
+    m_line.priority = priority;
+    return Uart_Error_Code::OK;
+  }
+
+  /**
+   * @brief  Uart 设置中断子优先级 (仅记录)
+   *
+   * @param  sub_priority    中断子优先级
+   * @return Uart_Error_Code 错误码
+   */
+  static Uart_Error_Code set_interrupt_sub_priority(uint8_t sub_priority)
+  {
+    m_line.sub_priority = sub_priority;
+    return Uart_Error_Code::OK;
+  }
+
+  /**
+   * @brief  Uart 获取波特率
+   *
+   * @return uint32_t 波特率
+   */
+  static const uint32_t get_baud_rate(void)
+  {
+    return m_line.m_baud_rate;
+  }
+
+  /**
+   * @brief  Uart 获取数据位
+   *
+   * @return uint32_t 数据位
+   */
+  static const uint32_t get_data_bits(void)
+  {
+    return m_line.m_data_bits;
+  }
+
+  /**
+   * @brief  Uart 获取停止位
+   *
+   * @return uint32_t 停止位
+   */
+  static const uint32_t get_stop_bits(void)
+  {
+    return m_line.m_stop_bits;
+  }
+
+  /**
+   * @brief  Uart 获取校验位
+   *
+   * @return uint32_t 校验位
+   */
+  static const uint32_t get_parity(void)
+  {
+    return m_line.m_parity;
+  }
+
+  /**
+   * @brief  Uart 获取中断优先级
+   *
+   * @return uint32_t 中断优先级
+   */
+  static const uint32_t get_interrupt_priority(void)
+  {
+    return m_line.priority;
+  }
+
+  /**
+   * @brief  Uart 获取中断子优先级
+   *
+   * @return uint32_t 中断子优先级
+   */
+  static const uint32_t get_interrupt_sub_priority(void)
+  {
+    return m_line.sub_priority;
+  }
+
+  /**
+   * @brief  Uart 获取端口号
+   *
+   * @return uint32_t 端口号
+   */
+  static constexpr uint32_t get_port_num(void)
+  {
+    return Id;
+  }
+
+  /**
+   * @brief  Uart 初始化 (线路加入仿真时钟)
+   *
+   * @param  baud_rate        波特率
+   * @param  data_bits        数据位
+   * @param  stop_bits        停止位
+   * @param  parity           校验位
+   * @param  type             流类型
+   * @return Uart_Error_Code  错误码
+   */
+  static Uart_Error_Code init(uint32_t baud_rate, uint8_t data_bits, uint8_t stop_bits, uint8_t parity, system::device::Stream_Type type)
+  {
+    Uart_Error_Code error_code = set_baud_rate(baud_rate);
+
+    (void)type;
+
+    if (Uart_Error_Code::OK == error_code)
+    {
+      error_code = set_data_bits(data_bits);
+    }
+
+    if (Uart_Error_Code::OK == error_code)
+    {
+      error_code = set_stop_bits(stop_bits);
+    }
+
+    if (Uart_Error_Code::OK == error_code)
+    {
+      error_code = set_parity(parity);
+    }
+
+    if (Uart_Error_Code::OK == error_code)
+    {
+      {
+        system::kernel::Interrupt_Guard guard;
+        m_line.reset_line();
+        m_line.rx_enabled = false;
+        m_line.rx_count   = 0;
+      }
+
+      base_internal::uart_internal::Sim_Uart_Clock::instance().attach(m_line);
+    }
+    else
+    {
+      error_code = Uart_Error_Code::INIT_FAILED;
+    }
+
+    return error_code;
+  }
+
+  /**
+   * @brief  Uart 使能接收
+   *
+   * @return Uart_Error_Code 错误码
+   * @note   该函数仅在接收模式为中断模式时生效
+   */
+  template <bool enable = (Uart_Type::Interrupt == Rx_Type), typename = std::enable_if_t<enable>>
+  static Uart_Error_Code enable_receive(void)
+  {
+    m_line.rx_enabled = true;
+    return Uart_Error_Code::OK;
+  }
+
+  /**
+   * @brief  Uart 使能接收
+   *
+   * @param  memory_ptr       接收内存指针
+   * @param  size             接收内存大小
+   * @return Uart_Error_Code  错误码
+   * @note   该函数仅在接收模式为DMA模式时生效
+   */
+  template <bool enable = (Uart_Type::DMA == Rx_Type), typename = std::enable_if_t<enable>>
+  static Uart_Error_Code enable_receive(uint8_t* memory_ptr, uint32_t size)
+  {
+    system::kernel::Interrupt_Guard guard;
+
+    m_line.rx_memory[0] = memory_ptr;
+    m_line.rx_memory[1] = memory_ptr;
+    m_line.rx_size      = size;
+    m_line.rx_index     = 0;
+    m_line.rx_count     = 0;
+    m_line.rx_enabled   = (nullptr != memory_ptr) && (0 != size);
+
+    return Uart_Error_Code::OK;
+  }
+
+  /**
+   * @brief  Uart 使能接收
+   *
+   * @param  memory0_ptr      接收内存0指针
+   * @param  memory1_ptr      接收内存1指针
+   * @param  size             接收内存大小
+   * @return Uart_Error_Code  错误码
+   * @note   该函数仅在接收模式为DMA双缓冲模式时生效
+   */
+  template <bool enable = (Uart_Type::DMA_Double_Buffer == Rx_Type), typename = std::enable_if_t<enable>>
+  static Uart_Error_Code enable_receive(uint8_t* memory0_ptr, uint8_t* memory1_ptr, uint32_t size)
+  {
+    system::kernel::Interrupt_Guard guard;
+
+    m_line.rx_memory[0] = memory0_ptr;
+    m_line.rx_memory[1] = memory1_ptr;
+    m_line.rx_size      = size;
+    m_line.rx_index     = 0;
+    m_line.rx_count     = 0;
+    m_line.rx_enabled   = (nullptr != memory0_ptr) && (nullptr != memory1_ptr) && (0 != size);
+
+    return Uart_Error_Code::OK;
+  }
+
+  /**
+   * @brief  Uart 发送数据
+   *
+   * @param  data     发送数据指针
+   * @param  size     发送数据大小
+   * @return uint32_t 实际发送数据大小 (中断与DMA模式异步发送，返回0)
+   */
+  static uint32_t send(const uint8_t* data, uint32_t size)
+  {
+    uint32_t sent_size = 0;
+
+    if (m_callback.send_start_callback)
+    {
+      m_callback.send_start_callback(m_callback.send_start_arg);
+    }
+
+    system::kernel::Interrupt_Guard guard;
+
+    if constexpr (Uart_Type::Normal == Tx_Type)
+    {
+      m_line.transmit_now(data, size);
+      sent_size = size;
+    }
+    else
+    {
+      m_line.start_transmit(data, size);
+    }
+
+    return sent_size;
+  }
+
+  /**
+   * @brief  Uart 解除初始化 (线路移出仿真时钟)
+   *
+   * @return Uart_Error_Code 错误码
+   */
+  static Uart_Error_Code deinit(void)
+  {
+    base_internal::uart_internal::Sim_Uart_Clock::instance().detach(m_line);
+
+    system::kernel::Interrupt_Guard guard;
+    m_line.reset_line();
+    m_line.rx_enabled = false;
+    m_line.rx_count   = 0;
+
+    return Uart_Error_Code::OK;
+  }
+
+public:
+  /**
+   * @brief 仿真串口配置 构造函数
+   */
+  explicit Sim_Uart_Config() {}
+
+  /**
+   * @brief 仿真串口配置 析构函数
+   */
+  ~Sim_Uart_Config() {}
+};
+
+/**
+ * @brief  仿真串口 模板类
+ *
+ * @tparam Id          仿真端口编号
+ * @tparam Rx_Type     接收类型
+ * @tparam Tx_Type     发送类型
+ * @tparam Base_Device Uart 设备基类
+ */
+template <uint8_t Id, Uart_Type Rx_Type, Uart_Type Tx_Type, typename Base_Device>
+using Sim_Uart = base_internal::uart_internal::Uart_Base<Base_Device::stream_type(), Sim_Uart_Config<Id, Rx_Type, Tx_Type>, Base_Device>;
+} /* namespace uart */
+} /* namespace base */
+} /* namespace QAQ */
+
+#endif /* __SIM_UART_HPP__ */
@@ -0,0 +1,387 @@
+/**
+ * @file   sim_uart_test.cpp
+ * @brief  仿真串口 主机测试: 波特率与帧格式计时、线路空闲与 DMA 写满/双缓冲半区切换/逐字节中断接收的回调路径、
+ *         全双工交叉连接收发一致性、发送中途关闭后重新打开，以及 2/6/12 Mbaud 下经设备管理器与直通模式的线路利用率基准
+ *
+ * @note   仅用于主机，不参与固件编译 (已加入 eide excludeList);
+ *         内核由 host_kernel.hpp 仿真，仿真时钟由测试调用 tick() 推进 (1 节拍 = 1 毫秒仿真时间);
+ *         基准耗时请以不带 sanitizer 的 -O2 构建为准
+ *
+ *         构建 (仓库根目录):
+ *         g++ -std=c++17 -O2 -g -fsanitize=address,undefined -fpermissive -w \
+ *             $(python3 -c "import json;c=json.load(open('.eide/eide.json'))['targets']['Debug']['custom_dep'];print(' '.join(['-I'+p for p in c['incList']]+['-D'+d for d in c['defineList']]))") \
+ *             api/base/uart/sim_uart_test.cpp -o sim_uart_test -lpthread && ./sim_uart_test
+ */
+#include "host_kernel.hpp"
+#include "sim_uart.hpp"
+
+#include <chrono>
+#include <cstdio>
+#include <thread>
+#include <vector>
+
+using namespace QAQ::base::uart;
+using QAQ::system::device::Device_Error_Code;
+using QAQ::system::device::Stream_Device;
+using QAQ::system::device::Stream_Type;
+
+namespace
+{
+/// @brief 失败的检查数
+int g_failures = 0;
+
+#define CHECK(cond)                                                  \
+  do                                                                 \
+  {                                                                  \
+    if (!(cond))                                                     \
+    {                                                                \
+      ++g_failures;                                                  \
+      printf("%s:%d: CHECK(%s) failed\n", __FILE__, __LINE__, #cond); \
+    }                                                                \
+  } while (0)
+
+/// @brief 串口设备基类 (输入、输出缓存区各4096字节)
+using Uart_Device = Stream_Device<Stream_Type::READ_WRITE, 4096, 4096>;
+
+/// @brief DMA 接收、DMA 发送
+using Port_Dma    = Sim_Uart_Config<1, Uart_Type::DMA, Uart_Type::DMA>;
+/// @brief 中断接收、中断发送
+using Port_Int    = Sim_Uart_Config<2, Uart_Type::Interrupt, Uart_Type::Interrupt>;
+/// @brief DMA 双缓冲接收、DMA 发送
+using Port_Dbl    = Sim_Uart_Config<3, Uart_Type::DMA_Double_Buffer, Uart_Type::DMA>;
+
+/// @brief 串口 (DMA 接收、DMA 发送)
+Sim_Uart<1, Uart_Type::DMA, Uart_Type::DMA, Uart_Device>               g_uart_dma;
+/// @brief 串口 (中断接收、中断发送)
+Sim_Uart<2, Uart_Type::Interrupt, Uart_Type::Interrupt, Uart_Device>   g_uart_int;
+/// @brief 串口 (DMA 双缓冲接收、DMA 发送)
+Sim_Uart<3, Uart_Type::DMA_Double_Buffer, Uart_Type::DMA, Uart_Device> g_uart_dbl;
+
+/**
+ * @brief  让出处理器，等待设备管理器通道线程处理已投递的事件 (使能接收、启动发送)
+ */
+void settle(void)
+{
+  std::this_thread::sleep_for(std::chrono::milliseconds(5));
+}
+
+/**
+ * @brief  推进仿真时钟
+ *
+ * @param  ticks 节拍数
+ */
+void run(uint32_t ticks)
+{
+  for (uint32_t i = 0; i < ticks; ++i)
+  {
+    QAQ::system::kernel::host::tick(1);
+    std::this_thread::yield();
+  }
+}
+
+/**
+ * @brief  生成测试数据
+ *
+ * @param  size  数据大小
+ * @param  seed  种子
+ * @return std::vector<uint8_t> 数据
+ */
+std::vector<uint8_t> pattern(uint32_t size, uint32_t seed)
+{
+  std::vector<uint8_t> data(size);
+
+  for (uint32_t i = 0; i < size; ++i)
+  {
+    data[i] = static_cast<uint8_t>(seed + i * 7 + (i >> 8));
+  }
+
+  return data;
+}
+
+/**
+ * @brief  推进仿真时钟并读取，直至收齐或超过节拍上限
+ *
+ * @tparam Uart      串口类型
+ * @param  uart      串口
+ * @param  size      期望数据大小
+ * @param  ticks     节拍上限
+ * @return std::vector<uint8_t> 已接收数据
+ */
+template <typename Uart>
+std::vector<uint8_t> receive(Uart& uart, uint32_t size, uint32_t ticks)
+{
+  std::vector<uint8_t> data(size);
+  uint32_t             total = 0;
+
+  for (uint32_t i = 0; (i < ticks) && (total < size); ++i)
+  {
+    run(1);
+    const int64_t ret = uart.read(data.data() + total, size - total, 0);
+
+    if (ret > 0)
+    {
+      total += static_cast<uint32_t>(ret);
+    }
+  }
+
+  data.resize(total);
+  return data;
+}
+
+/**
+ * @brief  打开串口并设置帧格式
+ *
+ * @tparam Uart      串口类型
+ * @param  uart      串口
+ * @param  baud_rate 波特率
+ * @param  direct    发送直通模式
+ * @return true      成功
+ * @return false     失败
+ */
+template <typename Uart>
+bool open_uart(Uart& uart, uint32_t baud_rate, bool direct)
+{
+  const bool ret = (Device_Error_Code::OK == uart.open());
+
+  uart.config().baud_rate(baud_rate).transmit_direct(direct);
+  settle();
+  return ret;
+}
+} /* namespace */
+
+/**
+ * @brief  测试: 注入数据按波特率与帧格式计时，线路忙碌期间不提交，空闲时一次提交全部数据
+ */
+static void test_baud_timing(void)
+{
+  const std::vector<uint8_t> data = pattern(1000, 1);
+
+  CHECK(open_uart(g_uart_dma, 115200, false));
+  Port_Dma::line().reset_stats();
+
+  // 115200 8N1: 每节拍 11.52 字节，余量跨节拍累积
+  CHECK(Port_Dma::inject(data.data(), 1000));
+  CHECK(!Port_Dma::inject(data.data(), 1));
+  run(50);
+  CHECK(576 == Port_Dma::stats().rx_bytes);
+  CHECK(0 == g_uart_dma.available());
+  CHECK(0 == Port_Dma::stats().idle_count);
+
+  const std::vector<uint8_t> got = receive(g_uart_dma, 1000, 100);
+  CHECK(data == got);
+  CHECK(1 == Port_Dma::stats().idle_count);
+  CHECK(0 == Port_Dma::stats().overrun_bytes);
+
+  // 115200 8E2: 每帧12位，每节拍 9.6 字节
+  g_uart_dma.config().parity(Uart_Parity::Even).stop_bits(2);
+  Port_Dma::line().reset_stats();
+  CHECK(Port_Dma::inject(data.data(), 1000));
+  run(50);
+  CHECK(480 == Port_Dma::stats().rx_bytes);
+  CHECK(data == receive(g_uart_dma, 1000, 100));
+
+  // 每节拍内发送完毕的短突发各触发一次空闲
+  for (uint32_t i = 0; i < 5; ++i)
+  {
+    CHECK(Port_Dma::inject(data.data() + i * 8, 8));
+    CHECK(std::vector<uint8_t>(data.begin() + i * 8, data.begin() + i * 8 + 8) == receive(g_uart_dma, 8, 3));
+  }
+
+  CHECK(6 == Port_Dma::stats().idle_count);
+  CHECK(Device_Error_Code::OK == g_uart_dma.close());
+}
+
+/**
+ * @brief  测试: DMA 接收内存写满时提交并重新使能，剩余部分由线路空闲提交 (整个突发只有一次空闲)
+ */
+static void test_dma_full(void)
+{
+  const std::vector<uint8_t> data = pattern(10000, 3);
+
+  CHECK(open_uart(g_uart_dma, 2000000, false));
+  Port_Dma::line().reset_stats();
+
+  // 2 Mbaud: 每节拍200字节，约20节拍写满一次4095字节的接收内存
+  CHECK(Port_Dma::inject(data.data(), 10000));
+  CHECK(data == receive(g_uart_dma, 10000, 200));
+  CHECK(1 == Port_Dma::stats().idle_count);
+  CHECK(10000 == Port_Dma::stats().rx_bytes);
+  CHECK(Device_Error_Code::OK == g_uart_dma.close());
+
+  // 关闭后线路移出仿真时钟，注入的数据不再推进
+  Port_Dma::line().reset_stats();
+  CHECK(Port_Dma::inject(data.data(), 100));
+  run(10);
+  CHECK(0 == Port_Dma::stats().rx_bytes);
+}
+
+/**
+ * @brief  测试: 交叉连接的 DMA 与中断接收端口全双工收发，双缓冲端口回环 (半区切换与不足半区的空闲提交)
+ */
+static void test_duplex(void)
+{
+  const std::vector<uint8_t> a_to_b = pattern(3000, 5);
+  const std::vector<uint8_t> b_to_a = pattern(2500, 9);
+
+  Port_Dma::connect<Port_Int>();
+  CHECK(open_uart(g_uart_dma, 1000000, true));
+  CHECK(open_uart(g_uart_int, 1000000, false));
+  Port_Dma::line().reset_stats();
+  Port_Int::line().reset_stats();
+
+  // 直通模式写入即启动发送; 经设备管理器的一侧以刷新投递启动事件
+  CHECK(3000 == g_uart_dma.write(a_to_b.data(), 3000, 0));
+  CHECK(2500 == g_uart_int.write(b_to_a.data(), 2500, 0));
+  g_uart_int.flush(0);
+  settle();
+
+  std::vector<uint8_t> at_b(3000);
+  std::vector<uint8_t> at_a(2500);
+  uint32_t             got_b = 0;
+  uint32_t             got_a = 0;
+
+  for (uint32_t i = 0; (i < 100) && ((got_b < 3000) || (got_a < 2500)); ++i)
+  {
+    run(1);
+    got_b += static_cast<uint32_t>(g_uart_int.read(at_b.data() + got_b, 3000 - got_b, 0));
+    got_a += static_cast<uint32_t>(g_uart_dma.read(at_a.data() + got_a, 2500 - got_a, 0));
+  }
+
+  CHECK(a_to_b == at_b);
+  CHECK(b_to_a == at_a);
+  CHECK(3000 == Port_Dma::stats().tx_bytes && 3000 == Port_Int::stats().rx_bytes);
+  CHECK(2500 == Port_Int::stats().tx_bytes && 2500 == Port_Dma::stats().rx_bytes);
+  CHECK(Device_Error_Code::OK == g_uart_dma.close());
+  CHECK(Device_Error_Code::OK == g_uart_int.close());
+
+  // 双缓冲回环: 2048字节半区，3500字节跨越一次半区切换
+  const std::vector<uint8_t> loop = pattern(3500, 11);
+
+  Port_Dbl::connect<Port_Dbl>();
+  CHECK(open_uart(g_uart_dbl, 2000000, true));
+  CHECK(3500 == g_uart_dbl.write(loop.data(), 3500, 0));
+  CHECK(loop == receive(g_uart_dbl, 3500, 100));
+  CHECK(1 == Port_Dbl::stats().idle_count);
+  CHECK(Device_Error_Code::OK == g_uart_dbl.close());
+}
+
+/**
+ * @brief  测试: 发送中途关闭后重新打开，遗留的收发数据被丢弃，输出缓存区写满时关闭也不会使之后的写入无法启动发送
+ */
+static void test_reopen(void)
+{
+  const std::vector<uint8_t> stale = pattern(4095, 13);
+  const std::vector<uint8_t> fresh = pattern(300, 17);
+
+  Port_Dma::connect<Port_Int>();
+
+  for (bool direct : { false, true })
+  {
+    CHECK(open_uart(g_uart_dma, 115200, direct));
+    CHECK(open_uart(g_uart_int, 115200, false));
+
+    // 写满输出缓存区，发送约230字节后两端关闭
+    CHECK(4095 == g_uart_dma.write(stale.data(), 4095, 0));
+    g_uart_dma.flush(0);
+    settle();
+    run(20);
+    CHECK(0 != Port_Int::stats().rx_bytes);
+    CHECK(Device_Error_Code::OK == g_uart_dma.close());
+    CHECK(Device_Error_Code::OK == g_uart_int.close());
+    Port_Dma::line().reset_stats();
+    Port_Int::line().reset_stats();
+
+    CHECK(open_uart(g_uart_dma, 115200, direct));
+    CHECK(open_uart(g_uart_int, 115200, false));
+    CHECK(0 == g_uart_int.available());
+    CHECK(300 == g_uart_dma.write(fresh.data(), 300, 0));
+    g_uart_dma.flush(0);
+    settle();
+    CHECK(fresh == receive(g_uart_int, 300, 100));
+    CHECK(300 == Port_Dma::stats().tx_bytes);
+    CHECK(Device_Error_Code::OK == g_uart_dma.close());
+    CHECK(Device_Error_Code::OK == g_uart_int.close());
+  }
+}
+
+/**
+ * @brief  基准: 连续写入时 DMA 发送 -> 双缓冲接收的线路利用率 (经设备管理器启动发送与直通模式对比)
+ *
+ * @param  baud_rate 波特率
+ * @param  direct    发送直通模式
+ */
+static void bench_line(uint32_t baud_rate, bool direct)
+{
+  constexpr uint32_t SIM_TICKS = 1000;
+
+  std::vector<uint8_t> chunk(1024);
+  std::vector<uint8_t> sink(8192);
+  uint32_t             written  = 0;
+  uint32_t             received = 0;
+  bool                 intact   = true;
+
+  Port_Dma::connect<Port_Dbl>();
+  CHECK(open_uart(g_uart_dma, baud_rate, direct));
+  CHECK(open_uart(g_uart_dbl, baud_rate, false));
+  Port_Dma::line().reset_stats();
+
+  const auto start = std::chrono::steady_clock::now();
+
+  for (uint32_t tick = 0; tick < SIM_TICKS; ++tick)
+  {
+    // 写满输出缓存区 (计数序列，接收端按序校验)
+    for (int64_t ret = 1; ret > 0;)
+    {
+      for (uint32_t i = 0; i < chunk.size(); ++i)
+      {
+        chunk[i] = static_cast<uint8_t>(written + i);
+      }
+
+      ret      = g_uart_dma.write(chunk.data(), static_cast<uint32_t>(chunk.size()), 0);
+      written += static_cast<uint32_t>(std::max<int64_t>(ret, 0));
+    }
+
+    run(1);
+
+    for (int64_t ret = g_uart_dbl.read(sink.data(), sink.size(), 0); ret > 0; ret = g_uart_dbl.read(sink.data(), sink.size(), 0))
+    {
+      for (int64_t i = 0; i < ret; ++i)
+      {
+        intact = intact && (static_cast<uint8_t>(received + i) == sink[i]);
+      }
+
+      received += static_cast<uint32_t>(ret);
+    }
+  }
+
+  const double         host_ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+  const Sim_Uart_Stats stats   = Port_Dma::stats();
+  const double         line    = baud_rate / 10.0 * SIM_TICKS / 1000;
+
+  CHECK(intact);
+  CHECK(Device_Error_Code::OK == g_uart_dma.close());
+  CHECK(Device_Error_Code::OK == g_uart_dbl.close());
+
+  printf("%-10u %-8s %12.1f %12.1f %9.1f%% %10u %10.2f %10u %12.1f\n", baud_rate, direct ? "direct" : "manager", line / 1000, received / 1000.0,
+         100.0 * received / line, stats.tx_transfers, stats.tx_transfers ? static_cast<double>(stats.tx_gap_ticks) / stats.tx_transfers : 0.0, stats.tx_gap_max, host_ms);
+}
+
+int main(void)
+{
+  test_baud_timing();
+  test_dma_full();
+  test_duplex();
+  test_reopen();
+
+  printf("%-10s %-8s %12s %12s %10s %10s %10s %10s %12s\n", "baud", "tx", "line KB/s", "recv KB/s", "util", "transfers", "gap avg", "gap max", "host ms/s");
+
+  for (uint32_t baud_rate : { 2000000u, 6000000u, 12000000u })
+  {
+    bench_line(baud_rate, false);
+    bench_line(baud_rate, true);
+  }
+
+  printf("sim_uart_test: %s (%d failures)\n", 0 == g_failures ? "OK" : "FAILED", g_failures);
+  fflush(stdout);
+  return 0 == g_failures ? 0 : 1;
+}
@@ -40,6 +40,10 @@ public:
   static constexpr uint32_t Interrupt_Sub_Priority = 0x06;
   /// @brief 端口号
   static constexpr uint32_t Port_Num               = 0x07;
+  /// @brief 发送直通模式
+  static constexpr uint32_t Transmit_Direct        = 0x08;
+  /// @brief 接收帧模式
+  static constexpr uint32_t Receive_Frame          = 0x09;
 };
 
 /// @brief Uart 校验模式
@@ -53,6 +57,24 @@ public:
   /// @brief 奇校验
   static constexpr uint8_t Odd  = 0x02;
 };
+
+/// @brief Uart 接收帧视图 (指向接收缓存区内的帧数据，缓存区回绕时分为两段)
+struct Uart_Frame
+{
+  const uint8_t* data;      /* 第一段数据指针 */
+  uint32_t       size;      /* 第一段数据大小 */
+  const uint8_t* wrap_data; /* 第二段数据指针 (未回绕时为nullptr) */
+  uint32_t       wrap_size; /* 第二段数据大小 */
+  uint32_t       timestamp; /* 帧结束 (线路空闲) 时间 - 毫秒 */
+};
+
+/// @brief Uart 接收帧统计
+struct Uart_Frame_Stats
+{
+  uint32_t frames;  /* 入队帧数 */
+  uint32_t dropped; /* 描述符队列已满丢弃的帧数 */
+  uint32_t damaged; /* 数据已被覆盖或被 read() 取走而丢弃的帧数 */
+};
 } /* namespace uart */
 
 /// @brief 命名空间 内部
@@ -69,6 +91,212 @@ static constexpr uint8_t  Default_Data_Bits = 8;
 static constexpr uint8_t  Default_Stop_Bits = 1;
 /// @brief Uart 默认校验位
 static constexpr uint8_t  Default_Parity    = uart::Uart_Parity::None;
+/// @brief Uart 接收帧描述符队列大小 (可容纳 Frame_Queue_Size - 1 帧)
+static constexpr uint32_t Frame_Queue_Size  = 16;
+
+/// @brief Uart 接收帧描述符
+struct Uart_Frame_Desc
+{
+  uint16_t offset;    /* 帧起始位置 (输入缓存区下标) */
+  uint16_t length;    /* 帧长度 */
+  uint32_t timestamp; /* 帧结束时间 - 毫秒 */
+};
+
+/**
+ * @brief  Uart 接收帧描述符队列
+ *
+ * @tparam Buf_Size  输入缓存区大小
+ * @note   帧边界取自线路空闲事件: 空闲时以输入缓存区写入位置作为帧结束，DMA 半满/满与内存切换只延续当前帧;
+ *         帧数据留在输入缓存区中原地交付，描述符与缓存区位置不符 (数据被覆盖或被 read() 取走) 时丢弃该帧
+ */
+template <uint32_t Buf_Size>
+class Uart_Frame_Queue
+{
+  // 输入缓存区大小检查 (下标以 Buf_Size - 1 掩码回绕，描述符以 uint16_t 保存起始位置与长度)
+  static_assert((0 != Buf_Size) && (0 == (Buf_Size & (Buf_Size - 1))), "Uart_Frame_Queue buffer size must be a power of 2");
+  static_assert(Buf_Size <= 65536, "Uart_Frame_Queue buffer size must not exceed 65536 (uint16_t frame offset/length)");
+
+  // 禁止拷贝和移动
+  QAQ_NO_COPY_MOVE(Uart_Frame_Queue)
+
+  /// @brief 输入缓存区基类类型
+  using Ring   = system::system_internal::ring_buffer_internal::Ring_Buffer_Base<uint8_t, Buf_Size>;
+  /// @brief 描述符队列返回值类型
+  using Status = typename system::system_internal::ring_buffer_internal::Ring_Buffer_Base<Uart_Frame_Desc, Frame_Queue_Size>::Status;
+
+private:
+  /// @brief 描述符队列
+  system::memory::Ring_Buffer<Uart_Frame_Desc, Frame_Queue_Size> m_queue;
+  /// @brief 当前帧起始位置
+  uint32_t                                                       m_start   = 0;
+  /// @brief 已交付未释放帧的结束位置
+  uint32_t                                                       m_held    = 0;
+  /// @brief 存在已交付未释放的帧
+  bool                                                           m_holding = false;
+  /// @brief 帧模式使能
+  bool                                                           m_enabled = false;
+  /// @brief 统计
+  uart::Uart_Frame_Stats                                         m_stats   = { 0 };
+
+public:
+  /**
+   * @brief  接收帧描述符队列 构造函数
+   */
+  explicit Uart_Frame_Queue() {}
+
+  /**
+   * @brief  接收帧描述符队列 析构函数
+   */
+  ~Uart_Frame_Queue() {}
+
+  /**
+   * @brief  接收帧描述符队列 使能并清空 (之前已接收的数据不计入帧)
+   *
+   * @param  ring    输入缓存区
+   * @param  enable  是否使能
+   */
+  void reset(const Ring& ring, bool enable)
+  {
+    system::kernel::Interrupt_Guard lock;
+
+    m_queue.clear();
+    m_start   = ring.write_index();
+    m_holding = false;
+    m_enabled = enable;
+  }
+
+  /**
+   * @brief  接收帧描述符队列 是否使能
+   *
+   * @return true   使能
+   * @return false  禁用
+   */
+  bool enabled(void) const
+  {
+    return m_enabled;
+  }
+
+  /**
+   * @brief  接收帧描述符队列 是否为空
+   *
+   * @return true   为空
+   * @return false  不为空
+   */
+  bool empty(void) const
+  {
+    return m_queue.empty();
+  }
+
+  /**
+   * @brief  接收帧描述符队列 结束当前帧 (线路空闲时由接收完成回调调用)
+   *
+   * @param  ring    输入缓存区
+   * @return true    新帧入队
+   * @return false   未使能、无新数据或队列已满
+   */
+  bool close(const Ring& ring)
+  {
+    bool ret = false;
+
+    if (m_enabled)
+    {
+      const uint32_t end    = ring.write_index();
+      const uint32_t length = (end - m_start) & (Buf_Size - 1);
+
+      if (0 != length)
+      {
+        const Uart_Frame_Desc desc = { static_cast<uint16_t>(m_start), static_cast<uint16_t>(length), system::kernel::System_Clock::now() };
+
+        if (Status::SUCCESS == m_queue.push(desc))
+        {
+          m_stats.frames++;
+          ret = true;
+        }
+        else
+        {
+          m_stats.dropped++;
+        }
+
+        m_start = end;
+      }
+    }
+
+    return ret;
+  }
+
+  /**
+   * @brief  接收帧描述符队列 取出一帧 (跳过被丢弃帧的残留数据与已损坏的帧)
+   *
+   * @param  ring      输入缓存区
+   * @param  frame     帧视图 - 引用返回
+   * @return uint32_t  帧长度，无帧返回0
+   */
+  uint32_t take(Ring& ring, uart::Uart_Frame& frame)
+  {
+    uint32_t        ret  = 0;
+    Uart_Frame_Desc desc = { 0 };
+
+    while ((0 == ret) && (Status::SUCCESS == m_queue.pop(desc)))
+    {
+      const uint32_t head      = ring.read_index();
+      const uint32_t available = ring.available();
+      const uint32_t gap       = (desc.offset - head) & (Buf_Size - 1);
+      const uint32_t end       = (desc.offset + desc.length - head) & (Buf_Size - 1);
+
+      if (gap + desc.length <= available)
+      {
+        ring.skip(gap);
+        ring.view(frame.data, frame.size, frame.wrap_data, desc.length);
+        frame.wrap_size = desc.length - frame.size;
+        frame.timestamp = desc.timestamp;
+        m_held          = (desc.offset + desc.length) & (Buf_Size - 1);
+        m_holding       = true;
+        ret             = desc.length;
+      }
+      else
+      {
+        if (end <= available)
+        {
+          ring.skip(end);
+        }
+
+        m_stats.damaged++;
+      }
+    }
+
+    return ret;
+  }
+
+  /**
+   * @brief  接收帧描述符队列 释放已交付的帧
+   *
+   * @param  ring  输入缓存区
+   */
+  void release(Ring& ring)
+  {
+    if (m_holding)
+    {
+      const uint32_t end = (m_held - ring.read_index()) & (Buf_Size - 1);
+
+      if (end <= ring.available())
+      {
+        ring.skip(end);
+      }
+
+      m_holding = false;
+    }
+  }
+
+  /**
+   * @brief  接收帧描述符队列 获取统计
+   *
+   * @return uart::Uart_Frame_Stats 统计
+   */
+  uart::Uart_Frame_Stats stats(void) const
+  {
+    return m_stats;
+  }
+};
 
 /**
  * @brief  Uart 基类
@@ -184,6 +412,30 @@ public:
     uart.config(Uart_Config_Code::Interrupt_Sub_Priority, interrupt_sub_priority);
     return *this;
   }
+
+  /**
+   * @brief  Uart 配置 发送直通模式 (需输出缓存区且非轮询发送)
+   *
+   * @param  enable           是否启用
+   * @return Uart_Set_Config& 配置接口引用
+   */
+  Uart_Set_Config& transmit_direct(bool enable)
+  {
+    uart.config(Uart_Config_Code::Transmit_Direct, enable ? 1 : 0);
+    return *this;
+  }
+
+  /**
+   * @brief  Uart 配置 接收帧模式 (以线路空闲划分帧，由 read_frame() 原地读取)
+   *
+   * @param  enable           是否启用
+   * @return Uart_Set_Config& 配置接口引用
+   */
+  Uart_Set_Config& receive_frame(bool enable)
+  {
+    uart.config(Uart_Config_Code::Receive_Frame, enable ? 1 : 0);
+    return *this;
+  }
 };
 
 /**
@@ -372,6 +624,28 @@ public:
     port_num = uart.get_config(Uart_Config_Code::Port_Num);
     return *this;
   }
+
+  /**
+   * @brief  Uart 获取 发送直通模式
+   *
+   * @return true   启用
+   * @return false  禁用
+   */
+  bool transmit_direct() const
+  {
+    return 0 != uart.get_config(Uart_Config_Code::Transmit_Direct);
+  }
+
+  /**
+   * @brief  Uart 获取 接收帧模式
+   *
+   * @return true   启用
+   * @return false  禁用
+   */
+  bool receive_frame() const
+  {
+    return 0 != uart.get_config(Uart_Config_Code::Receive_Frame);
+  }
 };
 
 /**
@@ -408,6 +682,9 @@ private:
   /// @brief Uart 获取配置接口模版类
   Uart_Get_Config<Type> m_get_config;
 
+  /// @brief Uart 接收帧描述符队列
+  Uart_Frame_Queue<Base_Device::input_buffer_size()> m_frame_queue;
+
   /**
    * @brief Uart 接收字节回调函数
    *
@@ -427,7 +704,8 @@ private:
    */
   static void received_complete_callback(void* arg)
   {
-    Type* uart = static_cast<Type*>(arg);
+    Type* uart      = static_cast<Type*>(arg);
+    bool  frame_end = true;
 
     if constexpr (Uart_Type::Interrupt == Config::received_type())
     {
@@ -435,10 +713,13 @@ private:
     }
     else if constexpr (Uart_Type::DMA == Config::received_type())
     {
-      uint8_t* memory_ptr  = nullptr;
-      uint32_t memory_size = uart->input_buffer_size() - 1;
+      uint8_t*       memory_ptr  = nullptr;
+      uint32_t       memory_size = uart->input_buffer_size() - 1;
+      const uint32_t received    = Config::receive_size();
 
-      uart->input_complete(Config::receive_size());
+      // 接收内存写满 (DMA 传输完成) 时帧未结束，由后续线路空闲结束
+      frame_end = (received < memory_size);
+      uart->input_complete(received);
       memory_ptr = uart->input_buffer_ptr(memory_size);
       Config::enable_receive(memory_ptr, memory_size);
     }
@@ -453,6 +734,11 @@ private:
       Config::enable_receive(memory0_ptr, memory1_ptr, memory_size);
     }
 
+    if (frame_end && uart->m_frame_queue.close(uart->m_input_buffer))
+    {
+      uart->m_event_flags.set(static_cast<uint32_t>(system::system_internal::device_internal::Device_Event_Bits::Receive_Finish));
+    }
+
     uart->signal_receive_complete(uart);
   }
 
@@ -511,6 +797,10 @@ private:
   {
     Uart_Error_Code error_code = Uart_Error_Code::OK;
 
+    // 关闭时中止的接收不会再完成，丢弃上次打开遗留的数据
+    this->m_input_buffer.clear();
+    m_frame_queue.reset(this->m_input_buffer, false);
+
     if constexpr (!std::is_same_v<DE_Pin, void>)
     {
       DE_Pin::interrupt_delete();
@@ -599,6 +889,10 @@ private:
     {
       error_code = Config::set_interrupt_sub_priority(value);
     }
+    else if (Uart_Config_Code::Receive_Frame == param)
+    {
+      m_frame_queue.reset(this->m_input_buffer, 0 != value);
+    }
     else
     {
       error_code = Uart_Error_Code::INVALID_PARAMETER;
@@ -613,7 +907,7 @@ private:
    * @param  param            配置参数
    * @return uint32_t         配置值
    */
-  const uint32_t get_config_impl(uint32_t param) override
+  uint32_t get_config_impl(uint32_t param) const override
   {
     uint32_t value = 0;
 
@@ -645,6 +939,10 @@ private:
     {
       value = Config::get_port_num();
     }
+    else if (Uart_Config_Code::Receive_Frame == param)
+    {
+      value = m_frame_queue.enabled() ? 1 : 0;
+    }
 
     return value;
   }
@@ -654,6 +952,8 @@ public:
   using Base::config;
   /// @brief Uart 设备配置获取 - 接口声明
   using Base::get_config;
+  /// @brief Uart 读取长度字段帧 - 接口声明
+  using Base::read_frame;
 
   /// @brief Uart 设备接收完成信号
   system::signal::Signal<system::system_internal::device_internal::InDevice_Base*> signal_receive_complete;
@@ -662,7 +962,89 @@ public:
    * @brief Uart 构造函数
    *
    */
-  explicit Uart_Base() : m_set_config(*this), m_get_config(*this) {}
+  explicit Uart_Base() : m_set_config(*this), m_get_config(*this)
+  {
+    this->m_manager_lane = system::device::Device_Lane::FAST;
+  }
+
+  /**
+   * @brief  Uart 清空输入缓存区 (同时清空接收帧描述符队列)
+   *
+   * @return Uart_Error_Code  错误码
+   */
+  Uart_Error_Code clear(void) override
+  {
+    const Uart_Error_Code error_code = Base::clear();
+
+    m_frame_queue.reset(this->m_input_buffer, m_frame_queue.enabled());
+    return error_code;
+  }
+
+  /**
+   * @brief  Uart 读取接收帧 (帧数据留在输入缓存区中原地交付，不拷贝)
+   *
+   * @param  frame       帧视图 - 引用返回
+   * @param  timeout_ms  超时时间 - 毫秒
+   * @return int64_t     帧长度，超时返回0，设备未打开或未使能接收帧模式返回-1
+   * @note   调用时释放上一帧; 帧数据在下一次 read_frame() 或 release_frame() 前有效，
+   *         期间输入缓存区溢出会覆盖该帧; 接收帧模式下不应混用 read() 等字节流读取接口
+   */
+  int64_t read_frame(uart::Uart_Frame& frame, uint32_t timeout_ms = TX_WAIT_FOREVER)
+  {
+    int64_t ret = 0;
+
+    if (!this->m_opened || !m_frame_queue.enabled())
+    {
+      ret = -1;
+    }
+    else
+    {
+      m_frame_queue.release(this->m_input_buffer);
+
+      while (this->m_opened)
+      {
+        ret = m_frame_queue.take(this->m_input_buffer, frame);
+
+        if (0 != ret)
+        {
+          break;
+        }
+
+        // 先清除标志再复查，接收完成回调在此之后入队的帧不会丢失
+        this->m_event_flags.clear(static_cast<uint32_t>(system::system_internal::device_internal::Device_Event_Bits::Receive_Finish));
+
+        if (m_frame_queue.empty())
+        {
+          const uint32_t event_bits = this->m_event_flags.wait((static_cast<uint32_t>(system::system_internal::device_internal::Device_Event_Bits::Receive_Finish) | static_cast<uint32_t>(system::system_internal::device_internal::Device_Event_Bits::Close)), timeout_ms);
+
+          if ((0 == event_bits) || (event_bits & static_cast<uint32_t>(system::system_internal::device_internal::Device_Event_Bits::Close)))
+          {
+            break;
+          }
+        }
+      }
+    }
+
+    return ret;
+  }
+
+  /**
+   * @brief  Uart 释放已读取的接收帧
+   */
+  void release_frame(void)
+  {
+    m_frame_queue.release(this->m_input_buffer);
+  }
+
+  /**
+   * @brief  Uart 获取接收帧统计
+   *
+   * @return uart::Uart_Frame_Stats 统计
+   */
+  uart::Uart_Frame_Stats frame_stats(void) const
+  {
+    return m_frame_queue.stats();
+  }
 
   /**
    * @brief  Uart 配置设置接口
@@ -724,17 +1106,158 @@ private:
   Uart_Set_Config<Type> m_set_config;
   /// @brief Uart 获取配置接口模版类
   Uart_Get_Config<Type> m_get_config;
+  /// @brief Uart 发送忙标志 (置位方独占输出缓存区的发送启动)
+  std::atomic_bool      m_tx_busy   = false;
+  /// @brief Uart 发送直通模式 (写入与发送完成回调直接启动发送，不经设备管理器)
+  bool                  m_tx_direct = false;
+
+  /**
+   * @brief Uart 收发器切换为发送 (RS485 DE/RE 置位)
+   */
+  static void transceiver_transmit(void)
+  {
+    if constexpr (!std::is_same_v<DE_Pin, void>)
+    {
+      DE_Pin::set();
+    }
+
+    if constexpr (!std::is_same_v<RE_Pin, void>)
+    {
+      RE_Pin::set();
+    }
+  }
+
+  /**
+   * @brief Uart 收发器切换为接收 (RS485 DE/RE 复位)
+   */
+  static void transceiver_receive(void)
+  {
+    if constexpr (!std::is_same_v<DE_Pin, void>)
+    {
+      DE_Pin::reset();
+    }
+
+    if constexpr (!std::is_same_v<RE_Pin, void>)
+    {
+      RE_Pin::reset();
+    }
+  }
+
+  /**
+   * @brief Uart 启动输出缓存区发送
+   *
+   * @note  以发送忙标志 CAS 抢占发送权，写入线程、设备管理器与发送完成回调并发调用时只有一方启动发送;
+   *        轮询发送模式下发送同步完成，持有忙标志逐段发送直至输出缓存区为空，DE 在最后一段发送完成后才复位，
+   *        发送完成信号每轮只发出一次 (不经发送完成回调，不产生多余的 Enable_Transfer 事件)
+   */
+  void transmit_kick(void)
+  {
+    if constexpr (0 < this->output_buffer_size())
+    {
+      bool expected = false;
+
+      while ((0 != this->m_output_buffer.available()) && m_tx_busy.compare_exchange_strong(expected, true))
+      {
+        uint32_t size = 0;
+        uint8_t* ptr  = this->output_start(size);
+
+        if constexpr (Uart_Type::Normal == Config::send_type())
+        {
+          if (0 != size)
+          {
+            transceiver_transmit();
+
+            while (0 != size)
+            {
+              Config::send(ptr, size);
+              this->output_complete();
+              ptr = this->output_start(size);
+            }
+
+            transceiver_receive();
+            m_tx_busy = false;
+            this->signal_send_complete(this);
+          }
+          else
+          {
+            m_tx_busy = false;
+          }
+        }
+        else
+        {
+          if (0 != size)
+          {
+            transceiver_transmit();
+            Config::send(ptr, size);
+            break;
+          }
+
+          m_tx_busy = false;
+        }
+
+        expected = false;
+      }
+    }
+  }
 
   /**
    * @brief Uart 发送完成回调函数
    *
    * @param arg  入口参数
+   * @note  仅由中断/DMA发送完成时调用; 直通模式下剩余数据在回调中直接接续发送，否则经设备管理器启动下一次发送;
+   *        输出缓存区仍有数据 (环形缓存区回绕分段) 时 DE 保持置位，缓存区为空时才切换为接收
    */
   static void send_complete_callback(void* arg)
   {
     Type* uart = static_cast<Type*>(arg);
 
     uart->output_complete();
+
+    if constexpr (0 < Base_Device::output_buffer_size())
+    {
+      uint32_t size = 0;
+      uint8_t* ptr  = nullptr;
+
+      if (uart->m_tx_direct && (0 != uart->m_output_buffer.available()))
+      {
+        ptr = uart->output_start(size);
+      }
+
+      if (0 != size)
+      {
+        Config::send(ptr, size);
+      }
+      else
+      {
+        // 缓存区为空才复位 DE，释放忙标志后写入的数据重新置位
+        const bool pending = (0 != uart->m_output_buffer.available());
+
+        if (!pending)
+        {
+          transceiver_receive();
+        }
+
+        uart->m_tx_busy = false;
+
+        // 剩余或释放忙标志前写入的数据: 直通模式直接启动，否则交由设备管理器
+        if (pending || (0 != uart->m_output_buffer.available()))
+        {
+          if (uart->m_tx_direct)
+          {
+            uart->transmit_kick();
+          }
+          else
+          {
+            uart->post_event(static_cast<uint32_t>(system::system_internal::device_internal::Device_Event_Bits::Enable_Transfer));
+          }
+        }
+      }
+    }
+    else
+    {
+      transceiver_receive();
+    }
+
     uart->signal_send_complete(uart);
   }
 
@@ -747,7 +1270,17 @@ private:
    */
   uint32_t send_impl(const uint8_t* data, uint32_t size) override
   {
-    return Config::send(data, size);
+    uint32_t ret = 0;
+
+    transceiver_transmit();
+    ret = Config::send(data, size);
+
+    if constexpr (Uart_Type::Normal == Config::send_type())
+    {
+      transceiver_receive();
+    }
+
+    return ret;
   }
 
   /**
@@ -761,10 +1294,7 @@ private:
     {
       if (event & static_cast<uint32_t>(system::system_internal::device_internal::Device_Event_Bits::Enable_Transfer))
       {
-        uint32_t size = 0;
-        uint8_t* ptr  = this->output_start(size);
-
-        Config::send(ptr, size);
+        transmit_kick();
       }
     }
   }
@@ -778,6 +1308,15 @@ private:
   {
     Uart_Error_Code error_code = Uart_Error_Code::OK;
 
+    m_tx_busy   = false;
+    m_tx_direct = false;
+
+    // 关闭时中止的发送不会再完成，丢弃上次打开遗留的数据 (否则输出缓存区已满时写入不再触发发送)
+    if constexpr (0 < Base_Device::output_buffer_size())
+    {
+      this->m_output_buffer.clear();
+    }
+
     if constexpr (!std::is_same_v<DE_Pin, void>)
     {
       DE_Pin::interrupt_delete();
@@ -857,6 +1396,17 @@ private:
     {
       error_code = Config::set_interrupt_sub_priority(value);
     }
+    else if (Uart_Config_Code::Transmit_Direct == param)
+    {
+      if constexpr ((0 < this->output_buffer_size()) && (Uart_Type::Normal != Config::send_type()))
+      {
+        m_tx_direct = (0 != value);
+      }
+      else
+      {
+        error_code = Uart_Error_Code::INVALID_PARAMETER;
+      }
+    }
     else
     {
       error_code = Uart_Error_Code::INVALID_PARAMETER;
@@ -871,7 +1421,7 @@ private:
    * @param  param            配置参数
    * @return uint32_t         配置值
    */
-  const uint32_t get_config_impl(uint32_t param) override
+  uint32_t get_config_impl(uint32_t param) const override
   {
     uint32_t value = 0;
 
@@ -903,6 +1453,10 @@ private:
     {
       value = Config::get_port_num();
     }
+    else if (Uart_Config_Code::Transmit_Direct == param)
+    {
+      value = m_tx_direct ? 1 : 0;
+    }
 
     return value;
   }
@@ -920,7 +1474,47 @@ public:
    * @brief Uart 构造函数
    *
    */
-  explicit Uart_Base() : m_set_config(*this), m_get_config(*this) {}
+  explicit Uart_Base() : m_set_config(*this), m_get_config(*this)
+  {
+    this->m_manager_lane = system::device::Device_Lane::FAST;
+  }
+
+  /**
+   * @brief  Uart 写入数据
+   *
+   * @param  data               数据缓存区指针
+   * @param  size               数据大小
+   * @param  timeout_ms         超时时间 - 毫秒
+   * @return int64_t            写入数据大小
+   */
+  int64_t write(const void* data, uint32_t size, uint32_t timeout_ms = 0) override
+  {
+    system::device::Io_Vec vec = { data, size };
+    return Uart_Base::writev(&vec, 1, timeout_ms);
+  }
+
+  /**
+   * @brief  Uart 聚集写入数据 (直通模式下写入后直接启动发送)
+   *
+   * @param  vec                输出向量数组
+   * @param  count              输出向量数量
+   * @param  timeout_ms         超时时间 - 毫秒
+   * @return int64_t            写入数据大小
+   */
+  int64_t writev(const system::device::Io_Vec* vec, uint32_t count, uint32_t timeout_ms = 0) override
+  {
+    const int64_t ret = Base::writev(vec, count, timeout_ms);
+
+    if constexpr (0 < this->output_buffer_size())
+    {
+      if (m_tx_direct)
+      {
+        transmit_kick();
+      }
+    }
+
+    return ret;
+  }
 
   /**
    * @brief  Uart 配置设置接口
@@ -982,6 +1576,13 @@ private:
   Uart_Set_Config<Type> m_set_config;
   /// @brief Uart 获取配置接口模版类
   Uart_Get_Config<Type> m_get_config;
+  /// @brief Uart 发送忙标志 (置位方独占输出缓存区的发送启动)
+  std::atomic_bool      m_tx_busy   = false;
+  /// @brief Uart 发送直通模式 (写入与发送完成回调直接启动发送，不经设备管理器)
+  bool                  m_tx_direct = false;
+
+  /// @brief Uart 接收帧描述符队列
+  Uart_Frame_Queue<Base_Device::input_buffer_size()> m_frame_queue;
 
   /**
    * @brief Uart 接收字节回调函数
@@ -1002,7 +1603,8 @@ private:
    */
   static void received_complete_callback(void* arg)
   {
-    Type* uart = static_cast<Type*>(arg);
+    Type* uart      = static_cast<Type*>(arg);
+    bool  frame_end = true;
 
     if constexpr (Uart_Type::Interrupt == Config::received_type())
     {
@@ -1010,10 +1612,13 @@ private:
     }
     else if constexpr (Uart_Type::DMA == Config::received_type())
     {
-      uint8_t* memory_ptr  = nullptr;
-      uint32_t memory_size = uart->input_buffer_size() - 1;
+      uint8_t*       memory_ptr  = nullptr;
+      uint32_t       memory_size = uart->input_buffer_size() - 1;
+      const uint32_t received    = Config::receive_size();
 
-      uart->input_complete(Config::receive_size());
+      // 接收内存写满 (DMA 传输完成) 时帧未结束，由后续线路空闲结束
+      frame_end = (received < memory_size);
+      uart->input_complete(received);
       memory_ptr = uart->input_buffer_ptr(memory_size);
       Config::enable_receive(memory_ptr, memory_size);
     }
@@ -1028,6 +1633,11 @@ private:
       Config::enable_receive(memory0_ptr, memory1_ptr, memory_size);
     }
 
+    if (frame_end && uart->m_frame_queue.close(uart->m_input_buffer))
+    {
+      uart->m_event_flags.set(static_cast<uint32_t>(system::system_internal::device_internal::Device_Event_Bits::Receive_Finish));
+    }
+
     uart->signal_receive_complete(uart);
   }
 
@@ -1046,10 +1656,101 @@ private:
     uart->signal_receive_complete(uart);
   }
 
+  /**
+   * @brief Uart 收发器切换为发送 (RS485 DE/RE 置位)
+   */
+  static void transceiver_transmit(void)
+  {
+    if constexpr (!std::is_same_v<DE_Pin, void>)
+    {
+      DE_Pin::set();
+    }
+
+    if constexpr (!std::is_same_v<RE_Pin, void>)
+    {
+      RE_Pin::set();
+    }
+  }
+
+  /**
+   * @brief Uart 收发器切换为接收 (RS485 DE/RE 复位)
+   */
+  static void transceiver_receive(void)
+  {
+    if constexpr (!std::is_same_v<DE_Pin, void>)
+    {
+      DE_Pin::reset();
+    }
+
+    if constexpr (!std::is_same_v<RE_Pin, void>)
+    {
+      RE_Pin::reset();
+    }
+  }
+
+  /**
+   * @brief Uart 启动输出缓存区发送
+   *
+   * @note  以发送忙标志 CAS 抢占发送权，写入线程、设备管理器与发送完成回调并发调用时只有一方启动发送;
+   *        轮询发送模式下发送同步完成，持有忙标志逐段发送直至输出缓存区为空，DE 在最后一段发送完成后才复位，
+   *        发送完成信号每轮只发出一次 (不经发送完成回调，不产生多余的 Enable_Transfer 事件)
+   */
+  void transmit_kick(void)
+  {
+    if constexpr (0 < this->output_buffer_size())
+    {
+      bool expected = false;
+
+      while ((0 != this->m_output_buffer.available()) && m_tx_busy.compare_exchange_strong(expected, true))
+      {
+        uint32_t size = 0;
+        uint8_t* ptr  = this->output_start(size);
+
+        if constexpr (Uart_Type::Normal == Config::send_type())
+        {
+          if (0 != size)
+          {
+            transceiver_transmit();
+
+            while (0 != size)
+            {
+              Config::send(ptr, size);
+              this->output_complete();
+              ptr = this->output_start(size);
+            }
+
+            transceiver_receive();
+            m_tx_busy = false;
+            this->signal_send_complete(this);
+          }
+          else
+          {
+            m_tx_busy = false;
+          }
+        }
+        else
+        {
+          if (0 != size)
+          {
+            transceiver_transmit();
+            Config::send(ptr, size);
+            break;
+          }
+
+          m_tx_busy = false;
+        }
+
+        expected = false;
+      }
+    }
+  }
+
   /**
    * @brief Uart 发送完成回调函数
    *
    * @param arg  入口参数
+   * @note  仅由中断/DMA发送完成时调用; 直通模式下剩余数据在回调中直接接续发送，否则经设备管理器启动下一次发送;
+   *        输出缓存区仍有数据 (环形缓存区回绕分段) 时 DE 保持置位，缓存区为空时才切换为接收
    */
   static void send_complete_callback(void* arg)
   {
@@ -1057,14 +1758,49 @@ private:
 
     uart->output_complete();
 
-    if constexpr (!std::is_same_v<DE_Pin, void>)
+    if constexpr (0 < Base_Device::output_buffer_size())
     {
-      DE_Pin::reset();
-    }
+      uint32_t size = 0;
+      uint8_t* ptr  = nullptr;
 
-    if constexpr (!std::is_same_v<RE_Pin, void>)
+      if (uart->m_tx_direct && (0 != uart->m_output_buffer.available()))
+      {
+        ptr = uart->output_start(size);
+      }
+
+      if (0 != size)
+      {
+        Config::send(ptr, size);
+      }
+      else
+      {
+        // 缓存区为空才复位 DE，释放忙标志后写入的数据重新置位
+        const bool pending = (0 != uart->m_output_buffer.available());
+
+        if (!pending)
+        {
+          transceiver_receive();
+        }
+
+        uart->m_tx_busy = false;
+
+        // 剩余或释放忙标志前写入的数据: 直通模式直接启动，否则交由设备管理器
+        if (pending || (0 != uart->m_output_buffer.available()))
+        {
+          if (uart->m_tx_direct)
+          {
+            uart->transmit_kick();
+          }
+          else
+          {
+            uart->post_event(static_cast<uint32_t>(system::system_internal::device_internal::Device_Event_Bits::Enable_Transfer));
+          }
+        }
+      }
+    }
+    else
     {
-      RE_Pin::reset();
+      transceiver_receive();
     }
 
     uart->signal_send_complete(uart);
@@ -1079,7 +1815,17 @@ private:
    */
   uint32_t send_impl(const uint8_t* data, uint32_t size) override
   {
-    return Config::send(data, size);
+    uint32_t ret = 0;
+
+    transceiver_transmit();
+    ret = Config::send(data, size);
+
+    if constexpr (Uart_Type::Normal == Config::send_type())
+    {
+      transceiver_receive();
+    }
+
+    return ret;
   }
 
   /**
@@ -1093,67 +1839,30 @@ private:
     {
       if (event & static_cast<uint32_t>(system::system_internal::device_internal::Device_Event_Bits::Enable_Transfer))
       {
-        uint32_t size = 0;
-        uint8_t* ptr  = this->output_start(size);
-
-        if constexpr (!std::is_same_v<DE_Pin, void>)
-        {
-          DE_Pin::set();
-        }
-
-        if constexpr (!std::is_same_v<RE_Pin, void>)
-        {
-          RE_Pin::set();
-        }
+        transmit_kick();
+      }
+    }
 
-        Config::send(ptr, size);
+    if (event & static_cast<uint32_t>(system::system_internal::device_internal::Device_Event_Bits::Enable_Receive))
+    {
+      if constexpr (Uart_Type::Interrupt == Config::received_type())
+      {
+        Config::enable_receive();
       }
-      else if (event & static_cast<uint32_t>(system::system_internal::device_internal::Device_Event_Bits::Enable_Receive))
+      else if constexpr (Uart_Type::DMA == Config::received_type())
       {
-        if constexpr (Uart_Type::Interrupt == Config::received_type())
-        {
-          Config::enable_receive();
-        }
-        else if constexpr (Uart_Type::DMA == Config::received_type())
-        {
-          uint32_t memory_size = this->input_buffer_size() - 1;
-          uint8_t* memory_ptr  = this->input_buffer_ptr(memory_size);
-
-          Config::enable_receive(memory_ptr, memory_size);
-        }
-        else if constexpr (Uart_Type::DMA_Double_Buffer == Config::received_type())
-        {
-          uint8_t* memory0_ptr = nullptr;
-          uint8_t* memory1_ptr = nullptr;
-          uint32_t memory_size = this->input_buffer_ptr(memory0_ptr, memory1_ptr);
+        uint32_t memory_size = this->input_buffer_size() - 1;
+        uint8_t* memory_ptr  = this->input_buffer_ptr(memory_size);
 
-          Config::enable_receive(memory0_ptr, memory1_ptr, memory_size);
-        }
+        Config::enable_receive(memory_ptr, memory_size);
       }
-    }
-    else
-    {
-      if (event & static_cast<uint32_t>(system::system_internal::device_internal::Device_Event_Bits::Enable_Receive))
+      else if constexpr (Uart_Type::DMA_Double_Buffer == Config::received_type())
       {
-        if constexpr (Uart_Type::Interrupt == Config::received_type())
-        {
-          Config::enable_receive();
-        }
-        else if constexpr (Uart_Type::DMA == Config::received_type())
-        {
-          uint32_t memory_size = this->input_buffer_size() - 1;
-          uint8_t* memory_ptr  = this->input_buffer_ptr(memory_size);
-
-          Config::enable_receive(memory_ptr, memory_size);
-        }
-        else if constexpr (Uart_Type::DMA_Double_Buffer == Config::received_type())
-        {
-          uint8_t* memory0_ptr = nullptr;
-          uint8_t* memory1_ptr = nullptr;
-          uint32_t memory_size = this->input_buffer_ptr(memory0_ptr, memory1_ptr);
+        uint8_t* memory0_ptr = nullptr;
+        uint8_t* memory1_ptr = nullptr;
+        uint32_t memory_size = this->input_buffer_ptr(memory0_ptr, memory1_ptr);
 
-          Config::enable_receive(memory0_ptr, memory1_ptr, memory_size);
-        }
+        Config::enable_receive(memory0_ptr, memory1_ptr, memory_size);
       }
     }
   }
@@ -1167,6 +1876,19 @@ private:
   {
     Uart_Error_Code error_code = Uart_Error_Code::OK;
 
+    m_tx_busy   = false;
+    m_tx_direct = false;
+
+    // 关闭时中止的收发不会再完成，丢弃上次打开遗留的数据 (否则输出缓存区已满时写入不再触发发送)
+    this->m_input_buffer.clear();
+
+    if constexpr (0 < Base_Device::output_buffer_size())
+    {
+      this->m_output_buffer.clear();
+    }
+
+    m_frame_queue.reset(this->m_input_buffer, false);
+
     if constexpr (!std::is_same_v<DE_Pin, void>)
     {
       DE_Pin::interrupt_delete();
@@ -1256,6 +1978,21 @@ private:
     {
       error_code = Config::set_interrupt_sub_priority(value);
     }
+    else if (Uart_Config_Code::Receive_Frame == param)
+    {
+      m_frame_queue.reset(this->m_input_buffer, 0 != value);
+    }
+    else if (Uart_Config_Code::Transmit_Direct == param)
+    {
+      if constexpr ((0 < this->output_buffer_size()) && (Uart_Type::Normal != Config::send_type()))
+      {
+        m_tx_direct = (0 != value);
+      }
+      else
+      {
+        error_code = Uart_Error_Code::INVALID_PARAMETER;
+      }
+    }
     else
     {
       error_code = Uart_Error_Code::INVALID_PARAMETER;
@@ -1302,6 +2039,14 @@ private:
     {
       value = Config::get_port_num();
     }
+    else if (Uart_Config_Code::Receive_Frame == param)
+    {
+      value = m_frame_queue.enabled() ? 1 : 0;
+    }
+    else if (Uart_Config_Code::Transmit_Direct == param)
+    {
+      value = m_tx_direct ? 1 : 0;
+    }
 
     return value;
   }
@@ -1311,6 +2056,8 @@ public:
   using Base::config;
   /// @brief Uart 设备配置获取 - 接口声明
   using Base::get_config;
+  /// @brief Uart 读取长度字段帧 - 接口声明
+  using Base::read_frame;
 
   /// @brief Uart 设备接收完成信号
   system::signal::Signal<system::system_internal::device_internal::IODevice_Base*> signal_receive_complete;
@@ -1321,7 +2068,126 @@ public:
    * @brief Uart 构造函数
    *
    */
-  explicit Uart_Base() : m_set_config(*this), m_get_config(*this) {}
+  explicit Uart_Base() : m_set_config(*this), m_get_config(*this)
+  {
+    this->m_manager_lane = system::device::Device_Lane::FAST;
+  }
+
+  /**
+   * @brief  Uart 写入数据
+   *
+   * @param  data               数据缓存区指针
+   * @param  size               数据大小
+   * @param  timeout_ms         超时时间 - 毫秒
+   * @return int64_t            写入数据大小
+   */
+  int64_t write(const void* data, uint32_t size, uint32_t timeout_ms = 0) override
+  {
+    system::device::Io_Vec vec = { data, size };
+    return Uart_Base::writev(&vec, 1, timeout_ms);
+  }
+
+  /**
+   * @brief  Uart 聚集写入数据 (直通模式下写入后直接启动发送)
+   *
+   * @param  vec                输出向量数组
+   * @param  count              输出向量数量
+   * @param  timeout_ms         超时时间 - 毫秒
+   * @return int64_t            写入数据大小
+   */
+  int64_t writev(const system::device::Io_Vec* vec, uint32_t count, uint32_t timeout_ms = 0) override
+  {
+    const int64_t ret = Base::writev(vec, count, timeout_ms);
+
+    if constexpr (0 < this->output_buffer_size())
+    {
+      if (m_tx_direct)
+      {
+        transmit_kick();
+      }
+    }
+
+    return ret;
+  }
+
+  /**
+   * @brief  Uart 清空输入缓存区 (同时清空接收帧描述符队列)
+   *
+   * @return Uart_Error_Code  错误码
+   */
+  Uart_Error_Code clear(void) override
+  {
+    const Uart_Error_Code error_code = Base::clear();
+
+    m_frame_queue.reset(this->m_input_buffer, m_frame_queue.enabled());
+    return error_code;
+  }
+
+  /**
+   * @brief  Uart 读取接收帧 (帧数据留在输入缓存区中原地交付，不拷贝)
+   *
+   * @param  frame       帧视图 - 引用返回
+   * @param  timeout_ms  超时时间 - 毫秒
+   * @return int64_t     帧长度，超时返回0，设备未打开或未使能接收帧模式返回-1
+   * @note   调用时释放上一帧; 帧数据在下一次 read_frame() 或 release_frame() 前有效，
+   *         期间输入缓存区溢出会覆盖该帧; 接收帧模式下不应混用 read() 等字节流读取接口
+   */
+  int64_t read_frame(uart::Uart_Frame& frame, uint32_t timeout_ms = TX_WAIT_FOREVER)
+  {
+    int64_t ret = 0;
+
+    if (!this->m_opened || !m_frame_queue.enabled())
+    {
+      ret = -1;
+    }
+    else
+    {
+      m_frame_queue.release(this->m_input_buffer);
+
+      while (this->m_opened)
+      {
+        ret = m_frame_queue.take(this->m_input_buffer, frame);
+
+        if (0 != ret)
+        {
+          break;
+        }
+
+        // 先清除标志再复查，接收完成回调在此之后入队的帧不会丢失
+        this->m_event_flags.clear(static_cast<uint32_t>(system::system_internal::device_internal::Device_Event_Bits::Receive_Finish));
+
+        if (m_frame_queue.empty())
+        {
+          const uint32_t event_bits = this->m_event_flags.wait((static_cast<uint32_t>(system::system_internal::device_internal::Device_Event_Bits::Receive_Finish) | static_cast<uint32_t>(system::system_internal::device_internal::Device_Event_Bits::Close)), timeout_ms);
+
+          if ((0 == event_bits) || (event_bits & static_cast<uint32_t>(system::system_internal::device_internal::Device_Event_Bits::Close)))
+          {
+            break;
+          }
+        }
+      }
+    }
+
+    return ret;
+  }
+
+  /**
+   * @brief  Uart 释放已读取的接收帧
+   */
+  void release_frame(void)
+  {
+    m_frame_queue.release(this->m_input_buffer);
+  }
+
+  /**
+   * @brief  Uart 获取接收帧统计
+   *
+   * @return uart::Uart_Frame_Stats 统计
+   */
+  uart::Uart_Frame_Stats frame_stats(void) const
+  {
+    return m_frame_queue.stats();
+  }
 
   /**
    * @brief  Uart 配置设置接口
@@ -0,0 +1,324 @@
+/**
+ * @file   uart_base_test.cpp
+ * @brief  串口基类 接收帧模式 主机测试: DMA、DMA 双缓冲与中断接收下按线路空闲分帧 (含跨 DMA 写满、双缓冲半区切换与输入缓存区回绕的帧)、
+ *         描述符队列满时丢弃与残留数据跳过、混用 read() 时的损坏帧，以及 2 Mbaud 小帧下帧路径与字节流读取的每帧耗时基准
+ *
+ * @note   仅用于主机，不参与固件编译 (已加入 eide excludeList);
+ *         内核由 host_kernel.hpp 仿真，仿真时钟由测试调用 tick() 推进 (1 节拍 = 1 毫秒仿真时间，线路空闲按节拍检测);
+ *         基准耗时请以不带 sanitizer 的 -O2 构建为准
+ *
+ *         构建 (仓库根目录):
+ *         g++ -std=c++17 -O2 -g -fsanitize=address,undefined -fpermissive -w \
+ *             $(python3 -c "import json;c=json.load(open('.eide/eide.json'))['targets']['Debug']['custom_dep'];print(' '.join(['-I'+p for p in c['incList']]+['-D'+d for d in c['defineList']]))") \
+ *             api/base/uart/uart_base_test.cpp -o uart_base_test -lpthread && ./uart_base_test
+ */
+#include "host_kernel.hpp"
+#include "sim_uart.hpp"
+
+#include <chrono>
+#include <cstdio>
+#include <thread>
+#include <vector>
+
+using namespace QAQ::base::uart;
+using QAQ::system::device::Device_Error_Code;
+using QAQ::system::device::Stream_Device;
+using QAQ::system::device::Stream_Type;
+
+namespace
+{
+/// @brief 失败的检查数
+int g_failures = 0;
+
+#define CHECK(cond)                                                  \
+  do                                                                 \
+  {                                                                  \
+    if (!(cond))                                                     \
+    {                                                                \
+      ++g_failures;                                                  \
+      printf("%s:%d: CHECK(%s) failed\n", __FILE__, __LINE__, #cond); \
+    }                                                                \
+  } while (0)
+
+/// @brief 串口设备基类 (输入、输出缓存区各4096字节)
+using Uart_Device = Stream_Device<Stream_Type::READ_WRITE, 4096, 4096>;
+
+/// @brief DMA 接收
+using Port_Dma    = Sim_Uart_Config<1, Uart_Type::DMA, Uart_Type::DMA>;
+/// @brief DMA 双缓冲接收
+using Port_Dbl    = Sim_Uart_Config<2, Uart_Type::DMA_Double_Buffer, Uart_Type::DMA>;
+/// @brief 中断接收
+using Port_Int    = Sim_Uart_Config<3, Uart_Type::Interrupt, Uart_Type::Interrupt>;
+
+/// @brief 串口 (DMA 接收)
+Sim_Uart<1, Uart_Type::DMA, Uart_Type::DMA, Uart_Device>               g_uart_dma;
+/// @brief 串口 (DMA 双缓冲接收)
+Sim_Uart<2, Uart_Type::DMA_Double_Buffer, Uart_Type::DMA, Uart_Device> g_uart_dbl;
+/// @brief 串口 (中断接收)
+Sim_Uart<3, Uart_Type::Interrupt, Uart_Type::Interrupt, Uart_Device>   g_uart_int;
+
+/// @brief 仿真波特率
+constexpr uint32_t BAUD_RATE = 2000000;
+
+/**
+ * @brief  让出处理器，等待设备管理器通道线程处理已投递的事件 (使能接收)
+ */
+void settle(void)
+{
+  std::this_thread::sleep_for(std::chrono::milliseconds(5));
+}
+
+/**
+ * @brief  生成帧数据
+ *
+ * @param  data  数据输出
+ * @param  size  帧长度
+ * @param  seed  种子
+ */
+void pattern(uint8_t* data, uint32_t size, uint32_t seed)
+{
+  for (uint32_t i = 0; i < size; ++i)
+  {
+    data[i] = static_cast<uint8_t>(seed * 31 + i * 7 + (i >> 8));
+  }
+}
+
+/**
+ * @brief  注入一帧并推进仿真时钟至线路空闲
+ *
+ * @tparam Port  仿真串口配置
+ * @param  data  帧数据 (需保持有效直至发送完毕)
+ * @param  size  帧长度
+ */
+template <typename Port>
+void send_frame(const uint8_t* data, uint32_t size)
+{
+  Port::inject(data, size);
+
+  while (!Port::line().inject_done())
+  {
+    QAQ::system::kernel::host::tick(1);
+  }
+
+  // 注入完毕的节拍末检测空闲
+  QAQ::system::kernel::host::tick(1);
+}
+
+/**
+ * @brief  帧视图与期望数据比较 (两段拼接)
+ */
+bool frame_equal(const Uart_Frame& frame, const uint8_t* expect, uint32_t size)
+{
+  return (frame.size + frame.wrap_size == size) && (0 == memcmp(frame.data, expect, frame.size)) &&
+         ((0 == frame.wrap_size) || ((nullptr != frame.wrap_data) && (0 == memcmp(frame.wrap_data, expect + frame.size, frame.wrap_size))));
+}
+
+/**
+ * @brief  打开串口并使能接收帧模式
+ */
+template <typename Uart>
+bool open_frames(Uart& uart)
+{
+  const bool ret = (Device_Error_Code::OK == uart.open());
+
+  uart.config().baud_rate(BAUD_RATE).receive_frame(true);
+  settle();
+  return ret && uart.get_config().receive_frame();
+}
+} /* namespace */
+
+/**
+ * @brief  测试: 长度1~400字节的帧逐帧读取，内容、长度与时间戳正确 (帧跨越 DMA 写满、半区切换与输入缓存区回绕)
+ */
+template <typename Port, typename Uart>
+static void test_frames(Uart& uart)
+{
+  constexpr uint32_t FRAMES = 600;
+
+  uint8_t    data[400];
+  Uart_Frame frame;
+  uint32_t   wrapped   = 0;
+  uint32_t   last_time = 0;
+  bool       intact    = true;
+
+  CHECK(open_frames(uart));
+
+  for (uint32_t i = 0; i < FRAMES; ++i)
+  {
+    const uint32_t size = 1 + (i * 53) % 400;
+
+    pattern(data, size, i);
+    send_frame<Port>(data, size);
+
+    intact     = intact && (static_cast<int64_t>(size) == uart.read_frame(frame, 0)) && frame_equal(frame, data, size);
+    intact     = intact && (last_time <= frame.timestamp);
+    wrapped   += (0 != frame.wrap_size) ? 1 : 0;
+    last_time  = frame.timestamp;
+  }
+
+  CHECK(intact);
+  CHECK(0 < wrapped);
+  CHECK(0 == uart.read_frame(frame, 0));
+  CHECK(FRAMES == uart.frame_stats().frames);
+  CHECK(0 == uart.frame_stats().dropped && 0 == uart.frame_stats().damaged);
+  CHECK(0 == Port::stats().overrun_bytes);
+  CHECK(Device_Error_Code::OK == uart.close());
+}
+
+/**
+ * @brief  测试: 描述符队列满时丢弃的帧其数据被跳过，混用 read() 取走帧数据时该帧计为损坏，重新打开后接收帧模式关闭
+ */
+static void test_drop_damage(void)
+{
+  uint8_t    data[20][16];
+  Uart_Frame frame;
+  bool       intact = true;
+
+  CHECK(open_frames(g_uart_dma));
+
+  // 统计跨打开累计，以差值比较
+  const Uart_Frame_Stats base = g_uart_dma.frame_stats();
+
+  // 20帧未读取: 入队15帧，丢弃5帧
+  for (uint32_t i = 0; i < 20; ++i)
+  {
+    pattern(data[i], 16, i);
+    send_frame<Port_Dma>(data[i], 16);
+  }
+
+  CHECK((base.frames + 15 == g_uart_dma.frame_stats().frames) && (base.dropped + 5 == g_uart_dma.frame_stats().dropped));
+
+  for (uint32_t i = 0; i < 15; ++i)
+  {
+    intact = intact && (16 == g_uart_dma.read_frame(frame, 0)) && frame_equal(frame, data[i], 16);
+  }
+
+  CHECK(intact);
+  CHECK(0 == g_uart_dma.read_frame(frame, 0));
+
+  // 丢弃帧的残留数据在下一帧读取时跳过
+  pattern(data[0], 16, 100);
+  send_frame<Port_Dma>(data[0], 16);
+  CHECK(16 == g_uart_dma.read_frame(frame, 0) && frame_equal(frame, data[0], 16));
+
+  // 字节流读取取走帧数据
+  uint8_t sink[4];
+
+  g_uart_dma.release_frame();
+  pattern(data[1], 16, 101);
+  pattern(data[2], 16, 102);
+  send_frame<Port_Dma>(data[1], 16);
+  send_frame<Port_Dma>(data[2], 16);
+  CHECK(4 == g_uart_dma.read(sink, sizeof(sink), 0));
+  CHECK(16 == g_uart_dma.read_frame(frame, 0) && frame_equal(frame, data[2], 16));
+  CHECK(base.damaged + 1 == g_uart_dma.frame_stats().damaged);
+  CHECK(Device_Error_Code::OK == g_uart_dma.close());
+
+  CHECK(Device_Error_Code::OK == g_uart_dma.open());
+  CHECK(!g_uart_dma.get_config().receive_frame());
+  CHECK(-1 == g_uart_dma.read_frame(frame, 0));
+  CHECK(Device_Error_Code::OK == g_uart_dma.close());
+}
+
+/**
+ * @brief  基准: 2 Mbaud 下每节拍一帧，接收路径 (接收完成回调，含仿真内核的事件标志与信号管理器加锁) 与读取的主机耗时，
+ *         帧路径与字节流 read() 拷贝对比; 线路帧速率按帧间1字符空闲计，cpu load 为线路满速时接收与读取占用的主机处理器比例
+ *
+ * @tparam Port    仿真串口配置
+ * @param  uart    串口
+ * @param  name    接收模式名称
+ * @param  size    帧长度
+ * @param  frames  使用接收帧模式 (否则以 read() 读取)
+ */
+template <typename Port, typename Uart>
+static void bench_frames(Uart& uart, const char* name, uint32_t size, bool frames)
+{
+  constexpr uint32_t COUNT = 20000;
+
+  uint8_t    data[256];
+  uint8_t    sink[256];
+  Uart_Frame frame;
+  uint64_t   sum     = 0;
+  double     rx_ns   = 0;
+  double     read_ns = 0;
+
+  pattern(data, size, 7);
+  CHECK(Device_Error_Code::OK == uart.open());
+  uart.config().baud_rate(BAUD_RATE).receive_frame(frames);
+  settle();
+
+  // 线路无数据时的节拍耗时 (仿真时钟与定时器开销)，从接收路径耗时中扣除
+  const auto idle_start = std::chrono::steady_clock::now();
+
+  for (uint32_t i = 0; i < COUNT; ++i)
+  {
+    QAQ::system::kernel::host::tick(1);
+  }
+
+  const double idle_ns = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - idle_start).count();
+
+  Port::line().reset_stats();
+
+  for (uint32_t i = 0; i < COUNT; ++i)
+  {
+    const auto start = std::chrono::steady_clock::now();
+
+    Port::inject(data, size);
+    QAQ::system::kernel::host::tick(1);
+
+    const auto middle = std::chrono::steady_clock::now();
+
+    if (frames)
+    {
+      if (uart.read_frame(frame, 0) > 0)
+      {
+        sum += frame.data[0] + frame.size + frame.wrap_size;
+      }
+    }
+    else
+    {
+      const int64_t ret = uart.read(sink, sizeof(sink), 0);
+
+      sum += (ret > 0) ? (sink[0] + ret) : 0;
+    }
+
+    const auto end  = std::chrono::steady_clock::now();
+    rx_ns          += std::chrono::duration<double, std::nano>(middle - start).count();
+    read_ns        += std::chrono::duration<double, std::nano>(end - middle).count();
+  }
+
+  CHECK((data[0] + size) * static_cast<uint64_t>(COUNT) == sum);
+  CHECK(COUNT == Port::stats().idle_count);
+  CHECK(Device_Error_Code::OK == uart.close());
+
+  rx_ns = std::max(rx_ns - idle_ns, 0.0);
+
+  const double line = BAUD_RATE / 10.0 / (size + 1);
+  const double cpu  = 1e9 / ((rx_ns + read_ns) / COUNT);
+
+  printf("%-10s %-8s %6u %12.0f %10.0f %10.0f %12.0f %9.1f%%\n", name, frames ? "frame" : "read", size, line, rx_ns / COUNT, read_ns / COUNT, cpu, 100.0 * line / cpu);
+}
+
+int main(void)
+{
+  test_frames<Port_Dma>(g_uart_dma);
+  test_frames<Port_Dbl>(g_uart_dbl);
+  test_frames<Port_Int>(g_uart_int);
+  test_drop_damage();
+
+  printf("%-10s %-8s %6s %12s %10s %10s %12s %10s\n", "rx", "path", "size", "line fr/s", "rx ns", "read ns", "host fr/s", "cpu load");
+
+  for (uint32_t size : { 8u, 16u, 64u })
+  {
+    bench_frames<Port_Dma>(g_uart_dma, "dma", size, true);
+    bench_frames<Port_Dma>(g_uart_dma, "dma", size, false);
+    bench_frames<Port_Dbl>(g_uart_dbl, "double", size, true);
+    bench_frames<Port_Dbl>(g_uart_dbl, "double", size, false);
+    bench_frames<Port_Int>(g_uart_int, "interrupt", size, true);
+    bench_frames<Port_Int>(g_uart_int, "interrupt", size, false);
+  }
+
+  printf("uart_base_test: %s (%d failures)\n", 0 == g_failures ? "OK" : "FAILED", g_failures);
+  fflush(stdout);
+  return 0 == g_failures ? 0 : 1;
+}
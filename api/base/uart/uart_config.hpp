@@ -1714,6 +1714,11 @@ private:
         data++;
         sent_size++;
       }
+
+      // 等待最后一个字节移出，返回后即可切换 RS485 收发器
+      while (!LL_USART_IsActiveFlag_TC(m_handle))
+      {
+      }
     }
     else if constexpr (Uart_Type::Interrupt == Tx_Type)
     {
@@ -0,0 +1,697 @@
+#ifndef __FLAT_HASH_MAP_HPP__
+#define __FLAT_HASH_MAP_HPP__
+
+#include "hasher.hpp"
+
+/// @brief 名称空间 QAQ
+namespace QAQ
+{
+/// @brief 名称空间 容器
+namespace container
+{
+/// @brief 名称空间 内部
+namespace container_internal
+{
+/// @brief 名称空间 哈希表内部
+namespace hash_internal
+{
+/// @brief 控制字节 空槽
+constexpr uint8_t CTRL_EMPTY   = 0x80;
+/// @brief 控制字节 已删除
+constexpr uint8_t CTRL_DELETED = 0xFE;
+/// @brief 控制字节组宽度 (一次读取的控制字节数)
+constexpr uint32_t GROUP_WIDTH = 4;
+
+/**
+ * @brief 控制字节组 (SWAR，一个32位字同时匹配4个控制字节)
+ *
+ * @note  控制字节: 0x00~0x7F 为占用 (低7位哈希)，0x80 为空，0xFE 为已删除;
+ *        返回的掩码每字节最高位表示对应槽位匹配
+ */
+class Control_Group final
+{
+private:
+  /// @brief 每字节最低位
+  static constexpr uint32_t LSBS = 0x01010101U;
+  /// @brief 每字节最高位
+  static constexpr uint32_t MSBS = 0x80808080U;
+
+  /// @brief 控制字节
+  uint32_t m_ctrl;
+
+public:
+  /**
+   * @brief  控制字节组 构造函数
+   *
+   * @param  ctrl  控制字节起始地址 (4字节对齐)
+   */
+  explicit QAQ_INLINE Control_Group(const uint8_t* ctrl) noexcept
+  {
+    memcpy(&m_ctrl, ctrl, sizeof(m_ctrl));
+  }
+
+  /**
+   * @brief  控制字节组 匹配指定的低7位哈希 (可能存在假阳性，需比较键)
+   *
+   * @param  h2        低7位哈希
+   * @return uint32_t  匹配掩码
+   */
+  QAQ_INLINE uint32_t match(uint8_t h2) const noexcept
+  {
+    uint32_t x = m_ctrl ^ (LSBS * h2);
+    return (x - LSBS) & ~x & MSBS;
+  }
+
+  /**
+   * @brief  控制字节组 匹配空槽
+   *
+   * @return uint32_t  匹配掩码
+   */
+  QAQ_INLINE uint32_t match_empty(void) const noexcept
+  {
+    return m_ctrl & ~(m_ctrl << 6) & MSBS;
+  }
+
+  /**
+   * @brief  控制字节组 匹配空槽或已删除槽
+   *
+   * @return uint32_t  匹配掩码
+   */
+  QAQ_INLINE uint32_t match_empty_or_deleted(void) const noexcept
+  {
+    return m_ctrl & MSBS;
+  }
+
+  /**
+   * @brief  控制字节组 获取掩码中最低的匹配位置
+   *
+   * @param  mask      匹配掩码 (非0)
+   * @return uint32_t  组内位置
+   */
+  static QAQ_INLINE uint32_t lowest(uint32_t mask) noexcept
+  {
+    return static_cast<uint32_t>(__builtin_ctz(mask)) >> 3;
+  }
+};
+} /* namespace hash_internal */
+} /* namespace container_internal */
+
+/**
+ * @brief 开放寻址哈希表 (Swiss Table 结构，固定容量，不使用堆内存)
+ *
+ * @note  控制字节与槽位分离存储，查找时每次比较4个控制字节，仅在低7位哈希匹配时比较键;
+ *        最大装载 N - N/8，删除产生的墓碑在插入空间不足时原地重排回收;
+ *        查找接口支持异构键 (如QString键使用QString_View查找)
+ *
+ * @tparam K          键类型
+ * @tparam V          值类型
+ * @tparam N          槽位数量 (2的幂且不小于4)
+ * @tparam Hash_Func  哈希函数对象
+ * @tparam Key_Equal  键比较函数对象
+ */
+template <typename K, typename V, uint32_t N, typename Hash_Func = Hasher<K>, typename Key_Equal = std::equal_to<>>
+class Flat_Hash_Map final
+{
+  static_assert(N >= container_internal::hash_internal::GROUP_WIDTH && 0 == (N & (N - 1)), "N must be a power of 2 and at least 4");
+
+public:
+  /// @brief 键值对
+  struct Entry
+  {
+    /// @brief 键
+    K key;
+    /// @brief 值
+    V value;
+  };
+
+private:
+  /// @brief 控制字节组类型
+  using Group = container_internal::hash_internal::Control_Group;
+
+  /// @brief 最大装载数量
+  static constexpr uint32_t MAX_LOAD    = N - N / 8;
+  /// @brief 控制字节组数量
+  static constexpr uint32_t GROUP_COUNT = N / container_internal::hash_internal::GROUP_WIDTH;
+
+  /// @brief 控制字节
+  alignas(uint32_t) uint8_t m_ctrl[N];
+  /// @brief 槽位存储
+  typename std::aligned_storage<sizeof(Entry), alignof(Entry)>::type m_slots[N];
+  /// @brief 元素数量
+  uint32_t m_size;
+  /// @brief 墓碑数量
+  uint32_t m_deleted;
+  /// @brief 哈希函数对象
+  Hash_Func m_hash;
+  /// @brief 键比较函数对象
+  Key_Equal m_equal;
+
+  /**
+   * @brief  开放寻址哈希表 获取槽位
+   *
+   * @param  index   槽位索引
+   * @return Entry*  槽位指针
+   */
+  QAQ_INLINE Entry* slot(uint32_t index) noexcept
+  {
+    return std::launder(reinterpret_cast<Entry*>(&m_slots[index]));
+  }
+
+  /**
+   * @brief  开放寻址哈希表 获取槽位 (const版本)
+   *
+   * @param  index         槽位索引
+   * @return const Entry*  槽位指针
+   */
+  QAQ_INLINE const Entry* slot(uint32_t index) const noexcept
+  {
+    return std::launder(reinterpret_cast<const Entry*>(&m_slots[index]));
+  }
+
+  /**
+   * @brief  开放寻址哈希表 判断控制字节是否为占用
+   *
+   * @param  ctrl  控制字节
+   * @return bool  是否占用
+   */
+  static QAQ_INLINE bool is_full(uint8_t ctrl) noexcept
+  {
+    return 0 == (ctrl & 0x80);
+  }
+
+  /**
+   * @brief  开放寻址哈希表 获取起始组
+   *
+   * @param  hash      哈希值
+   * @return uint32_t  起始组索引
+   */
+  static QAQ_INLINE uint32_t h1(uint32_t hash) noexcept
+  {
+    return (hash >> 7) & (GROUP_COUNT - 1);
+  }
+
+  /**
+   * @brief  开放寻址哈希表 获取控制字节哈希
+   *
+   * @param  hash     哈希值
+   * @return uint8_t  低7位哈希
+   */
+  static QAQ_INLINE uint8_t h2(uint32_t hash) noexcept
+  {
+    return static_cast<uint8_t>(hash & 0x7F);
+  }
+
+  /**
+   * @brief  开放寻址哈希表 查找键所在槽位
+   *
+   * @param  key       键
+   * @param  hash      键的哈希值
+   * @return uint32_t  槽位索引，未找到返回N
+   */
+  template <typename Q>
+  uint32_t QAQ_O3 find_index(const Q& key, uint32_t hash) const
+  {
+    uint32_t group = h1(hash);
+
+    for (uint32_t i = 0; i < GROUP_COUNT; ++i)
+    {
+      Group    ctrl(m_ctrl + group * container_internal::hash_internal::GROUP_WIDTH);
+      uint32_t mask = ctrl.match(h2(hash));
+
+      while (mask)
+      {
+        uint32_t index = group * container_internal::hash_internal::GROUP_WIDTH + Group::lowest(mask);
+
+        if (m_equal(slot(index)->key, key))
+        {
+          return index;
+        }
+
+        mask &= mask - 1;
+      }
+
+      if (ctrl.match_empty())
+      {
+        break;
+      }
+
+      // 三角数探测，组数为2的幂时可遍历所有组
+      group = (group + i + 1) & (GROUP_COUNT - 1);
+    }
+
+    return N;
+  }
+
+  /**
+   * @brief  开放寻址哈希表 查找第一个可插入的槽位 (空或已删除)
+   *
+   * @param  hash      哈希值
+   * @return uint32_t  槽位索引，没有可用槽位返回N
+   */
+  uint32_t find_insert_index(uint32_t hash) const noexcept
+  {
+    uint32_t group = h1(hash);
+
+    for (uint32_t i = 0; i < GROUP_COUNT; ++i)
+    {
+      uint32_t mask = Group(m_ctrl + group * container_internal::hash_internal::GROUP_WIDTH).match_empty_or_deleted();
+
+      if (mask)
+      {
+        return group * container_internal::hash_internal::GROUP_WIDTH + Group::lowest(mask);
+      }
+
+      group = (group + i + 1) & (GROUP_COUNT - 1);
+    }
+
+    return N;
+  }
+
+  /**
+   * @brief  开放寻址哈希表 原地重排，回收所有墓碑
+   *
+   * @note   先将占用标记为已删除、墓碑标记为空，再逐个将元素移至其探测序列中的第一个可用位置
+   */
+  void drop_deleted(void)
+  {
+    using container_internal::hash_internal::CTRL_DELETED;
+    using container_internal::hash_internal::CTRL_EMPTY;
+    using container_internal::hash_internal::GROUP_WIDTH;
+
+    for (uint32_t i = 0; i < N; ++i)
+    {
+      m_ctrl[i] = is_full(m_ctrl[i]) ? CTRL_DELETED : CTRL_EMPTY;
+    }
+
+    for (uint32_t i = 0; i < N; ++i)
+    {
+      if (CTRL_DELETED != m_ctrl[i])
+      {
+        continue;
+      }
+
+      uint32_t hash   = m_hash(slot(i)->key);
+      uint32_t target = find_insert_index(hash);
+
+      if (target / GROUP_WIDTH == i / GROUP_WIDTH)
+      {
+        // 已处于探测序列中的第一个可用组，无需移动
+        m_ctrl[i] = h2(hash);
+      }
+      else if (CTRL_EMPTY == m_ctrl[target])
+      {
+        new (&m_slots[target]) Entry(std::move(*slot(i)));
+        slot(i)->~Entry();
+        m_ctrl[target] = h2(hash);
+        m_ctrl[i]      = CTRL_EMPTY;
+      }
+      else
+      {
+        // 目标为尚未处理的元素，交换后重新处理当前位置
+        Entry temp(std::move(*slot(i)));
+        slot(i)->~Entry();
+        new (&m_slots[i]) Entry(std::move(*slot(target)));
+        slot(target)->~Entry();
+        new (&m_slots[target]) Entry(std::move(temp));
+        m_ctrl[target] = h2(hash);
+        --i;
+      }
+    }
+
+    m_deleted = 0;
+  }
+
+  /**
+   * @brief  开放寻址哈希表 准备插入槽位
+   *
+   * @param  hash      哈希值
+   * @return uint32_t  槽位索引，表已满返回N
+   */
+  uint32_t prepare_insert(uint32_t hash)
+  {
+    uint32_t index = find_insert_index(hash);
+
+    // 复用墓碑不增加装载，使用空槽需检查装载上限
+    if (N != index && container_internal::hash_internal::CTRL_DELETED != m_ctrl[index] && MAX_LOAD <= m_size + m_deleted)
+    {
+      if (0 == m_deleted || MAX_LOAD <= m_size)
+      {
+        return N;
+      }
+
+      drop_deleted();
+      index = find_insert_index(hash);
+    }
+
+    return index;
+  }
+
+  /**
+   * @brief  开放寻址哈希表 迭代器基类
+   *
+   * @tparam Const  是否为常量迭代器
+   */
+  template <bool Const>
+  class Iterator_Base
+  {
+  private:
+    /// @brief 哈希表类型
+    using Map_Type = std::conditional_t<Const, const Flat_Hash_Map, Flat_Hash_Map>;
+    /// @brief 元素类型
+    using Ref_Type = std::conditional_t<Const, const Entry&, Entry&>;
+    /// @brief 元素指针类型
+    using Ptr_Type = std::conditional_t<Const, const Entry*, Entry*>;
+
+    /// @brief 哈希表
+    Map_Type* m_map;
+    /// @brief 槽位索引
+    uint32_t  m_index;
+
+    /**
+     * @brief  迭代器 跳过非占用槽位
+     */
+    void skip(void) noexcept
+    {
+      while (m_index < N && !is_full(m_map->m_ctrl[m_index]))
+      {
+        ++m_index;
+      }
+    }
+
+  public:
+    /**
+     * @brief  迭代器 构造函数
+     *
+     * @param  map    哈希表
+     * @param  index  起始槽位索引
+     */
+    Iterator_Base(Map_Type* map, uint32_t index) noexcept : m_map(map), m_index(index)
+    {
+      skip();
+    }
+
+    Ref_Type operator*() const noexcept
+    {
+      return *m_map->slot(m_index);
+    }
+
+    Ptr_Type operator->() const noexcept
+    {
+      return m_map->slot(m_index);
+    }
+
+    Iterator_Base& operator++() noexcept
+    {
+      ++m_index;
+      skip();
+      return *this;
+    }
+
+    bool operator==(const Iterator_Base& other) const noexcept
+    {
+      return m_index == other.m_index;
+    }
+
+    bool operator!=(const Iterator_Base& other) const noexcept
+    {
+      return m_index != other.m_index;
+    }
+  };
+
+public:
+  /// @brief 迭代器类型
+  using iterator       = Iterator_Base<false>;
+  /// @brief 常量迭代器类型
+  using const_iterator = Iterator_Base<true>;
+
+  /**
+   * @brief  开放寻址哈希表 构造函数
+   */
+  Flat_Hash_Map() noexcept : m_size(0), m_deleted(0)
+  {
+    memset(m_ctrl, container_internal::hash_internal::CTRL_EMPTY, sizeof(m_ctrl));
+  }
+
+  /**
+   * @brief  开放寻址哈希表 析构函数
+   */
+  ~Flat_Hash_Map()
+  {
+    clear();
+  }
+
+  NO_COPY(Flat_Hash_Map)
+
+  /**
+   * @brief  开放寻址哈希表 获取元素数量
+   *
+   * @return uint32_t  元素数量
+   */
+  uint32_t size(void) const noexcept
+  {
+    return m_size;
+  }
+
+  /**
+   * @brief  开放寻址哈希表 获取最大元素数量
+   *
+   * @return uint32_t  最大元素数量
+   */
+  static constexpr uint32_t capacity(void) noexcept
+  {
+    return MAX_LOAD;
+  }
+
+  /**
+   * @brief  开放寻址哈希表 判断是否为空
+   *
+   * @return true   为空
+   * @return false  不为空
+   */
+  bool empty(void) const noexcept
+  {
+    return 0 == m_size;
+  }
+
+  /**
+   * @brief  开放寻址哈希表 判断是否已满
+   *
+   * @return true   已满
+   * @return false  未满
+   */
+  bool full(void) const noexcept
+  {
+    return MAX_LOAD <= m_size;
+  }
+
+  /**
+   * @brief  开放寻址哈希表 查找
+   *
+   * @param  key  键 (可为与K可比较的异构类型)
+   * @return V*   值指针，未找到返回nullptr
+   */
+  template <typename Q = K>
+  V* find(const Q& key)
+  {
+    uint32_t index = find_index(key, m_hash(key));
+    return (N != index) ? std::addressof(slot(index)->value) : nullptr;
+  }
+
+  /**
+   * @brief  开放寻址哈希表 查找 (const版本)
+   *
+   * @param  key       键 (可为与K可比较的异构类型)
+   * @return const V*  值指针，未找到返回nullptr
+   */
+  template <typename Q = K>
+  const V* find(const Q& key) const
+  {
+    uint32_t index = find_index(key, m_hash(key));
+    return (N != index) ? std::addressof(slot(index)->value) : nullptr;
+  }
+
+  /**
+   * @brief  开放寻址哈希表 判断是否包含键
+   *
+   * @param  key   键 (可为与K可比较的异构类型)
+   * @return bool  是否包含
+   */
+  template <typename Q = K>
+  bool contains(const Q& key) const
+  {
+    return N != find_index(key, m_hash(key));
+  }
+
+  /**
+   * @brief  开放寻址哈希表 插入 (键不存在时构造值)
+   *
+   * @param  key                 键
+   * @param  args                值的构造参数
+   * @return std::pair<V*, bool> 值指针 (表满时为nullptr) 与是否新插入
+   */
+  template <typename... Args>
+  std::pair<V*, bool> try_emplace(const K& key, Args&&... args)
+  {
+    uint32_t hash  = m_hash(key);
+    uint32_t index = find_index(key, hash);
+
+    if (N != index)
+    {
+      return { std::addressof(slot(index)->value), false };
+    }
+
+    index = prepare_insert(hash);
+
+    if (N == index)
+    {
+      return { nullptr, false };
+    }
+
+    if (container_internal::hash_internal::CTRL_DELETED == m_ctrl[index])
+    {
+      m_deleted -= 1;
+    }
+
+    new (&m_slots[index]) Entry { key, V(std::forward<Args>(args)...) };
+    m_ctrl[index]  = h2(hash);
+    m_size        += 1;
+
+    return { std::addressof(slot(index)->value), true };
+  }
+
+  /**
+   * @brief  开放寻址哈希表 插入 (键已存在时不修改)
+   *
+   * @param  key    键
+   * @param  value  值
+   * @return true   插入成功
+   * @return false  键已存在或表已满
+   */
+  bool insert(const K& key, const V& value)
+  {
+    return try_emplace(key, value).second;
+  }
+
+  /**
+   * @brief  开放寻址哈希表 插入或赋值
+   *
+   * @param  key    键
+   * @param  value  值
+   * @return true   成功
+   * @return false  表已满
+   */
+  bool insert_or_assign(const K& key, const V& value)
+  {
+    std::pair<V*, bool> result = try_emplace(key, value);
+
+    if (nullptr == result.first)
+    {
+      return false;
+    }
+
+    if (!result.second)
+    {
+      *result.first = value;
+    }
+
+    return true;
+  }
+
+  /**
+   * @brief  开放寻址哈希表 删除
+   *
+   * @param  key    键 (可为与K可比较的异构类型)
+   * @return true   删除成功
+   * @return false  键不存在
+   */
+  template <typename Q = K>
+  bool erase(const Q& key)
+  {
+    using container_internal::hash_internal::GROUP_WIDTH;
+
+    uint32_t index = find_index(key, m_hash(key));
+
+    if (N == index)
+    {
+      return false;
+    }
+
+    slot(index)->~Entry();
+    m_size -= 1;
+
+    // 所在组仍有空槽时，探测不会越过该组，可直接标记为空
+    if (Group(m_ctrl + (index / GROUP_WIDTH) * GROUP_WIDTH).match_empty())
+    {
+      m_ctrl[index] = container_internal::hash_internal::CTRL_EMPTY;
+    }
+    else
+    {
+      m_ctrl[index]  = container_internal::hash_internal::CTRL_DELETED;
+      m_deleted     += 1;
+    }
+
+    return true;
+  }
+
+  /**
+   * @brief  开放寻址哈希表 清空
+   */
+  void clear(void)
+  {
+    for (uint32_t i = 0; i < N; ++i)
+    {
+      if (is_full(m_ctrl[i]))
+      {
+        slot(i)->~Entry();
+      }
+    }
+
+    memset(m_ctrl, container_internal::hash_internal::CTRL_EMPTY, sizeof(m_ctrl));
+    m_size    = 0;
+    m_deleted = 0;
+  }
+
+  /**
+   * @brief  开放寻址哈希表 获取起始迭代器
+   *
+   * @return iterator  起始迭代器
+   */
+  iterator begin(void) noexcept
+  {
+    return iterator(this, 0);
+  }
+
+  /**
+   * @brief  开放寻址哈希表 获取结束迭代器
+   *
+   * @return iterator  结束迭代器
+   */
+  iterator end(void) noexcept
+  {
+    return iterator(this, N);
+  }
+
+  /**
+   * @brief  开放寻址哈希表 获取起始常量迭代器
+   *
+   * @return const_iterator  起始常量迭代器
+   */
+  const_iterator begin(void) const noexcept
+  {
+    return const_iterator(this, 0);
+  }
+
+  /**
+   * @brief  开放寻址哈希表 获取结束常量迭代器
+   *
+   * @return const_iterator  结束常量迭代器
+   */
+  const_iterator end(void) const noexcept
+  {
+    return const_iterator(this, N);
+  }
+};
+} /* namespace container */
+} /* namespace QAQ */
+
+#endif /* __FLAT_HASH_MAP_HPP__ */
@@ -0,0 +1,530 @@
+/**
+ * @file   flat_hash_map_test.cpp
+ * @brief  哈希与开放寻址哈希表 主机测试: QString/QString_View 哈希一致性与缓存失效、与 std::unordered_map 的随机对照、
+ *         墓碑回收、异构查找、元素生命周期，以及查找基准
+ *
+ * @note   仅用于主机，不参与固件编译 (已加入 eide excludeList);
+ *         ThreadX 内存池由本文件中基于 malloc 的桩函数代替，结束时检查内存池无泄漏;
+ *         基准对比主机上的 std::unordered_map，以及目标规模 (16~128 个键) 下的线性 compare 查找，
+ *         耗时请以不带 sanitizer 的 -O2 构建为准
+ *
+ *         构建 (仓库根目录):
+ *         g++ -std=c++17 -O2 -g -fsanitize=address,undefined -fpermissive -w \
+ *             $(python3 -c "import json;c=json.load(open('.eide/eide.json'))['targets']['Debug']['custom_dep'];print(' '.join(['-I'+p for p in c['incList']]+['-D'+d for d in c['defineList']]))") \
+ *             api/container/hash/flat_hash_map_test.cpp -o flat_hash_map_test && ./flat_hash_map_test
+ */
+#include "flat_hash_map.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+using QAQ::container::Flat_Hash_Map;
+using QAQ::container::QString;
+using QAQ::container::QString_View;
+using QAQ::system::algorithm::Hash;
+
+namespace
+{
+/// @brief 桩内存池 未释放的分配数
+int g_outstanding = 0;
+/// @brief 存活的计数元素数
+int g_alive       = 0;
+/// @brief 失败的检查数
+int g_failures    = 0;
+
+/// @brief 桩内存池 分配头部 (记录所属内存池与大小)
+struct alignas(16) Stub_Header
+{
+  void* pool;
+  ULONG size;
+};
+
+void* stub_allocate(void* pool, ULONG size)
+{
+  Stub_Header* head = static_cast<Stub_Header*>(malloc(sizeof(Stub_Header) + size));
+
+  if (nullptr == head)
+  {
+    return nullptr;
+  }
+
+  head->pool = pool;
+  head->size = size;
+  ++g_outstanding;
+  return head + 1;
+}
+
+Stub_Header* stub_header(void* ptr)
+{
+  return static_cast<Stub_Header*>(ptr) - 1;
+}
+
+/// @brief 计数元素 (检查构造与析构成对)
+struct Counted
+{
+  uint32_t value;
+
+  explicit Counted(uint32_t v = 0) : value(v)
+  {
+    ++g_alive;
+  }
+
+  Counted(const Counted& other) : value(other.value)
+  {
+    ++g_alive;
+  }
+
+  Counted& operator=(const Counted& other) = default;
+
+  ~Counted()
+  {
+    --g_alive;
+  }
+};
+
+/// @brief 全部哈希到同一位置的哈希函数 (强制探测链与墓碑)
+struct Collide_Hash
+{
+  uint32_t operator()(uint32_t value) const noexcept
+  {
+    return value & 0x7F;
+  }
+};
+
+/// @brief 伪随机数发生器
+uint32_t next_random(uint32_t& seed)
+{
+  seed = seed * 1664525u + 1013904223u;
+  return seed >> 8;
+}
+
+#define CHECK(cond)                                                  \
+  do                                                                 \
+  {                                                                  \
+    if (!(cond))                                                     \
+    {                                                                \
+      ++g_failures;                                                  \
+      printf("%s:%d: CHECK(%s) failed\n", __FILE__, __LINE__, #cond); \
+    }                                                                \
+  } while (0)
+} /* namespace */
+
+/* ThreadX 内存池桩函数 (单线程，容量与真实内存池一致) */
+extern "C"
+{
+  ULONG _tx_time_get(VOID)
+  {
+    return 0;
+  }
+
+  UINT _tx_block_pool_create(TX_BLOCK_POOL* pool_ptr, CHAR* name_ptr, ULONG block_size, VOID*, ULONG pool_size)
+  {
+    pool_ptr->tx_block_pool_name       = name_ptr;
+    pool_ptr->tx_block_pool_block_size = static_cast<UINT>(block_size);
+    pool_ptr->tx_block_pool_total      = static_cast<UINT>(pool_size / block_size);
+    pool_ptr->tx_block_pool_available  = pool_ptr->tx_block_pool_total;
+    return TX_SUCCESS;
+  }
+
+  UINT _tx_block_pool_delete(TX_BLOCK_POOL*)
+  {
+    return TX_SUCCESS;
+  }
+
+  UINT _tx_block_pool_info_get(TX_BLOCK_POOL* pool_ptr, CHAR**, ULONG* available_blocks, ULONG* total_blocks, TX_THREAD**, ULONG*, TX_BLOCK_POOL**)
+  {
+    if (available_blocks)
+    {
+      *available_blocks = pool_ptr->tx_block_pool_available;
+    }
+
+    if (total_blocks)
+    {
+      *total_blocks = pool_ptr->tx_block_pool_total;
+    }
+
+    return TX_SUCCESS;
+  }
+
+  UINT _tx_block_allocate(TX_BLOCK_POOL* pool_ptr, VOID** block_ptr, ULONG)
+  {
+    if (0 == pool_ptr->tx_block_pool_available)
+    {
+      return TX_NO_MEMORY;
+    }
+
+    *block_ptr = stub_allocate(pool_ptr, pool_ptr->tx_block_pool_block_size);
+
+    if (nullptr == *block_ptr)
+    {
+      return TX_NO_MEMORY;
+    }
+
+    --pool_ptr->tx_block_pool_available;
+    return TX_SUCCESS;
+  }
+
+  UINT _tx_block_release(VOID* block_ptr)
+  {
+    Stub_Header* head = stub_header(block_ptr);
+
+    ++static_cast<TX_BLOCK_POOL*>(head->pool)->tx_block_pool_available;
+    --g_outstanding;
+    free(head);
+    return TX_SUCCESS;
+  }
+
+  UINT _tx_byte_pool_create(TX_BYTE_POOL* pool_ptr, CHAR* name_ptr, VOID*, ULONG pool_size)
+  {
+    pool_ptr->tx_byte_pool_name      = name_ptr;
+    pool_ptr->tx_byte_pool_size      = pool_size;
+    pool_ptr->tx_byte_pool_available = pool_size;
+    return TX_SUCCESS;
+  }
+
+  UINT _tx_byte_pool_delete(TX_BYTE_POOL*)
+  {
+    return TX_SUCCESS;
+  }
+
+  UINT _tx_byte_pool_info_get(TX_BYTE_POOL* pool_ptr, CHAR**, ULONG* available_bytes, ULONG* fragments, TX_THREAD**, ULONG*, TX_BYTE_POOL**)
+  {
+    if (available_bytes)
+    {
+      *available_bytes = pool_ptr->tx_byte_pool_available;
+    }
+
+    if (fragments)
+    {
+      *fragments = 1;
+    }
+
+    return TX_SUCCESS;
+  }
+
+  UINT _tx_byte_allocate(TX_BYTE_POOL* pool_ptr, VOID** memory_ptr, ULONG memory_size, ULONG)
+  {
+    if (memory_size > pool_ptr->tx_byte_pool_available)
+    {
+      return TX_NO_MEMORY;
+    }
+
+    *memory_ptr = stub_allocate(pool_ptr, memory_size);
+
+    if (nullptr == *memory_ptr)
+    {
+      return TX_NO_MEMORY;
+    }
+
+    pool_ptr->tx_byte_pool_available -= memory_size;
+    return TX_SUCCESS;
+  }
+
+  UINT _tx_byte_release(VOID* memory_ptr)
+  {
+    Stub_Header* head = stub_header(memory_ptr);
+
+    static_cast<TX_BYTE_POOL*>(head->pool)->tx_byte_pool_available += head->size;
+    --g_outstanding;
+    free(head);
+    return TX_SUCCESS;
+  }
+}
+
+/**
+ * @brief  哈希: QString (SSO/堆) 与 QString_View 结果一致，修改后缓存失效，各长度分支与种子，主题名碰撞数
+ */
+static void test_hash(void)
+{
+  const std::string text = "device/motor_left/telemetry/speed/0123456789abcdefghijklmnopqrstuvwxyz";
+
+  for (uint32_t len = 0; len <= text.size(); ++len)
+  {
+    QString      str(text.c_str(), len);
+    QString_View view(text.c_str(), len);
+    uint32_t     expect = Hash::hash(text.c_str(), len);
+
+    CHECK(expect == str.hash() && expect == str.hash() && expect == view.hash());
+
+    // 任意一个字节变化都应改变哈希
+    if (0 < len)
+    {
+      std::string changed = text.substr(0, len);
+      changed[len / 2]   ^= 0x01;
+      CHECK(expect != Hash::hash(changed.c_str(), len));
+    }
+  }
+
+  CHECK(Hash::hash(text.c_str(), 16, 1) != Hash::hash(text.c_str(), 16, 2));
+
+  // 堆字符串的缓存在修改后失效
+  QString  str(text.c_str());
+  uint32_t cached = str.hash();
+  str.append("/x");
+  CHECK(cached != str.hash() && Hash::hash(str.data(), str.size()) == str.hash());
+  str[0] = 'D';
+  CHECK(Hash::hash(str.data(), str.size()) == str.hash());
+  str.clear();
+  CHECK(Hash::hash("", 0) == str.hash());
+
+  // 共享存储的副本修改后，原字符串的缓存不受影响
+  QString a(text.c_str());
+  uint32_t before = a.hash();
+  QString b       = a;
+  b.push_back('!');
+  CHECK(before == a.hash() && Hash::hash(b.data(), b.size()) == b.hash());
+
+  // 20000 个相似主题名的 32 位哈希碰撞数 (期望约 0.05 个)
+  std::vector<uint32_t> hashes;
+  char                  name[48];
+  for (uint32_t i = 0; i < 20000; ++i)
+  {
+    int len = snprintf(name, sizeof(name), "sensor/%u/value", i);
+    hashes.push_back(Hash::hash(name, static_cast<uint32_t>(len)));
+  }
+  std::sort(hashes.begin(), hashes.end());
+  uint32_t collisions = static_cast<uint32_t>(hashes.end() - std::unique(hashes.begin(), hashes.end()));
+  CHECK(collisions <= 2);
+}
+
+/**
+ * @brief  随机操作与 std::unordered_map 对照 (含表满、探测链与墓碑回收)
+ *
+ * @tparam Map   被测哈希表类型
+ * @param  keys  键的取值范围
+ */
+template <typename Map>
+static void run_model(uint32_t keys)
+{
+  Map                                    map;
+  std::unordered_map<uint32_t, uint32_t> model;
+  uint32_t                               seed = keys;
+
+  for (uint32_t step = 0; step < 200000; ++step)
+  {
+    uint32_t key = next_random(seed) % keys;
+    uint32_t op  = next_random(seed) % 8;
+
+    if (op < 3)
+    {
+      bool     full   = Map::capacity() <= model.size();
+      bool     exists = 0 != model.count(key);
+      bool     result = map.insert(key, step);
+      CHECK(result == (!exists && !full));
+      if (result)
+      {
+        model[key] = step;
+      }
+    }
+    else if (op < 4)
+    {
+      bool full = Map::capacity() <= model.size() && 0 == model.count(key);
+      CHECK(map.insert_or_assign(key, step) == !full);
+      if (!full)
+      {
+        model[key] = step;
+      }
+    }
+    else if (op < 6)
+    {
+      CHECK(map.erase(key) == (0 != model.erase(key)));
+    }
+    else
+    {
+      const uint32_t* value = map.find(key);
+      auto            it    = model.find(key);
+      CHECK((nullptr == value) == (model.end() == it));
+      CHECK(nullptr == value || model.end() == it || *value == it->second);
+    }
+
+    CHECK(map.size() == model.size());
+  }
+
+  uint32_t visited = 0;
+  for (const auto& entry : map)
+  {
+    CHECK(model.count(entry.key) && model[entry.key] == entry.value);
+    ++visited;
+  }
+  CHECK(visited == model.size());
+}
+
+/**
+ * @brief  随机对照: 正常哈希与全部冲突的哈希，键范围覆盖半满到远超容量
+ */
+static void test_model(void)
+{
+  run_model<Flat_Hash_Map<uint32_t, uint32_t, 4>>(8);
+  run_model<Flat_Hash_Map<uint32_t, uint32_t, 64>>(40);
+  run_model<Flat_Hash_Map<uint32_t, uint32_t, 64>>(1000);
+  run_model<Flat_Hash_Map<uint32_t, uint32_t, 256>>(300);
+  run_model<Flat_Hash_Map<uint32_t, uint32_t, 64, Collide_Hash>>(128);
+}
+
+/**
+ * @brief  墓碑回收: 装满后反复删除/插入不同的键，表不会因墓碑耗尽空槽而拒绝插入
+ */
+static void test_tombstone(void)
+{
+  Flat_Hash_Map<uint32_t, uint32_t, 16, Collide_Hash> map;
+
+  for (uint32_t i = 0; i < 14; ++i)
+  {
+    CHECK(map.insert(i, i));
+  }
+  CHECK(map.full() && !map.insert(100, 0));
+
+  for (uint32_t i = 14; i < 10000; ++i)
+  {
+    CHECK(map.erase(i - 14));
+    CHECK(map.insert(i, i));
+    CHECK(14 == map.size());
+  }
+
+  for (uint32_t i = 10000 - 14; i < 10000; ++i)
+  {
+    CHECK(nullptr != map.find(i) && i == *map.find(i));
+  }
+}
+
+/**
+ * @brief  字符串键: QString 键以 QString_View / C字符串异构查找，键与值的生命周期
+ */
+static void test_string_keys(void)
+{
+  {
+    Flat_Hash_Map<QString, Counted, 64> map;
+    char                                name[48];
+
+    for (uint32_t i = 0; i < 50; ++i)
+    {
+      snprintf(name, sizeof(name), "config/long_parameter_name_%u", i);
+      CHECK(map.try_emplace(QString(name), i).second);
+    }
+    CHECK(50 == map.size() && 50 == g_alive);
+    CHECK(!map.try_emplace(QString("config/long_parameter_name_7"), 0u).second);
+
+    for (uint32_t i = 0; i < 60; ++i)
+    {
+      snprintf(name, sizeof(name), "config/long_parameter_name_%u", i);
+      const Counted* by_view = map.find(QString_View(name));
+      const Counted* by_cstr = map.find(static_cast<const char*>(name));
+      CHECK((i < 50) == (nullptr != by_view) && by_view == by_cstr);
+      CHECK(nullptr == by_view || i == by_view->value);
+    }
+
+    CHECK(map.erase(QString_View("config/long_parameter_name_3")) && 49 == g_alive);
+    CHECK(!map.contains("config/long_parameter_name_3"));
+  }
+
+  CHECK(0 == g_alive);
+  CHECK(0 == g_outstanding);
+}
+
+/**
+ * @brief  查找基准: 主机上对比 std::unordered_map，目标规模下对比线性 compare 查找
+ *
+ * @note   键由 QString 持有 (表与线性查找共享同一堆存储)，查询方持有协议解析出的 QString_View/C字符串，
+ *         每次查找都需重新计算哈希; 键数量受 QString 内存池容量限制
+ *
+ * @tparam N     哈希表容量
+ * @param  keys  键数量
+ */
+template <uint32_t N>
+static void bench_lookup(uint32_t keys)
+{
+  constexpr uint32_t ROUNDS = 2000;
+
+  std::vector<std::string>                  names;
+  std::vector<std::string>                  misses;
+  std::vector<QString>                      table;
+  Flat_Hash_Map<QString, uint32_t, N>       map;
+  std::unordered_map<std::string, uint32_t> std_map;
+  char                                      name[48];
+
+  for (uint32_t i = 0; i < keys; ++i)
+  {
+    snprintf(name, sizeof(name), "device/node_%u/temperature", i);
+    names.emplace_back(name);
+    table.emplace_back(name);
+    map.insert(table.back(), i);
+    std_map.emplace(name, i);
+    snprintf(name, sizeof(name), "device/node_%u/humidity", i);
+    misses.emplace_back(name);
+  }
+
+  uint32_t sink  = 0;
+  auto     start = std::chrono::steady_clock::now();
+  for (uint32_t r = 0; r < ROUNDS; ++r)
+  {
+    for (uint32_t i = 0; i < keys; ++i)
+    {
+      const uint32_t* value = map.find(QString_View(names[i].data(), static_cast<uint32_t>(names[i].size())));
+      sink += (nullptr != value) ? *value : 0;
+      sink += map.contains(QString_View(misses[i].data(), static_cast<uint32_t>(misses[i].size())));
+    }
+  }
+  double flat_ns = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count() / (ROUNDS * keys * 2.0);
+
+  start = std::chrono::steady_clock::now();
+  for (uint32_t r = 0; r < ROUNDS; ++r)
+  {
+    for (uint32_t i = 0; i < keys; ++i)
+    {
+      auto it = std_map.find(names[i]);
+      sink += (std_map.end() != it) ? it->second : 0;
+      sink += static_cast<uint32_t>(std_map.count(misses[i]));
+    }
+  }
+  double std_ns = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count() / (ROUNDS * keys * 2.0);
+
+  // 现有代码的线性 compare 查找
+  auto linear = [&](const std::string& key) -> uint32_t {
+    for (uint32_t j = 0; j < keys; ++j)
+    {
+      if (0 == table[j].compare(key.c_str()))
+      {
+        return j;
+      }
+    }
+    return keys;
+  };
+
+  start = std::chrono::steady_clock::now();
+  for (uint32_t r = 0; r < ROUNDS; ++r)
+  {
+    for (uint32_t i = 0; i < keys; ++i)
+    {
+      sink += linear(names[i]);
+      sink += linear(misses[i]);
+    }
+  }
+  double linear_ns = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count() / (ROUNDS * keys * 2.0);
+
+  printf("%-6u %-6u %14.1f %18.1f %14.1f\n", keys, N, flat_ns, std_ns, linear_ns);
+  CHECK(0 != sink);
+}
+
+int main(void)
+{
+  test_hash();
+  test_model();
+  test_tombstone();
+  test_string_keys();
+
+  printf("%-6s %-6s %14s %18s %14s\n", "keys", "cap", "flat ns", "unordered_map ns", "linear ns");
+  bench_lookup<32>(16);
+  bench_lookup<64>(32);
+  bench_lookup<128>(64);
+  bench_lookup<256>(128);
+  CHECK(0 == g_outstanding);
+
+  printf("flat_hash_map_test: %s (%d failures)\n", 0 == g_failures ? "OK" : "FAILED", g_failures);
+  fflush(stdout);
+  return 0 == g_failures ? 0 : 1;
+}
@@ -0,0 +1,98 @@
+#ifndef __HASHER_HPP__
+#define __HASHER_HPP__
+
+#include "hash.hpp"
+#include "qstring_view.hpp"
+
+/// @brief 名称空间 QAQ
+namespace QAQ
+{
+/// @brief 名称空间 容器
+namespace container
+{
+/**
+ * @brief 哈希函数对象 (整数、枚举、指针)
+ *
+ * @tparam T  键类型
+ */
+template <typename T, typename = void>
+struct Hasher
+{
+  static_assert(std::is_integral<T>::value || std::is_enum<T>::value || std::is_pointer<T>::value, "Hasher is not specialized for this type");
+
+  /**
+   * @brief  哈希函数对象 计算哈希值
+   *
+   * @param  value     键
+   * @return uint32_t  哈希值
+   */
+  QAQ_INLINE uint32_t operator()(const T& value) const noexcept
+  {
+    if constexpr (std::is_pointer<T>::value)
+    {
+      return system::algorithm::Hash::hash(static_cast<uint64_t>(reinterpret_cast<uintptr_t>(value)));
+    }
+    else if constexpr (sizeof(T) <= sizeof(uint32_t))
+    {
+      return system::algorithm::Hash::hash(static_cast<uint32_t>(value));
+    }
+    else
+    {
+      return system::algorithm::Hash::hash(static_cast<uint64_t>(value));
+    }
+  }
+};
+
+/**
+ * @brief 哈希函数对象 (字符串)
+ *
+ * @note  QString与QString_View计算结果一致，QString键的容器可直接使用QString_View查找
+ */
+template <>
+struct Hasher<QString>
+{
+  /**
+   * @brief  哈希函数对象 计算QString哈希值 (使用缓存)
+   *
+   * @param  value     字符串
+   * @return uint32_t  哈希值
+   */
+  QAQ_INLINE uint32_t operator()(const QString& value) const noexcept
+  {
+    return value.hash();
+  }
+
+  /**
+   * @brief  哈希函数对象 计算字符串视图哈希值
+   *
+   * @param  value     字符串视图
+   * @return uint32_t  哈希值
+   */
+  QAQ_INLINE uint32_t operator()(QString_View value) const noexcept
+  {
+    return value.hash();
+  }
+
+  /**
+   * @brief  哈希函数对象 计算C字符串哈希值
+   *
+   * @param  value     C字符串
+   * @return uint32_t  哈希值
+   */
+  QAQ_INLINE uint32_t operator()(const char* value) const noexcept
+  {
+    return QString_View(value).hash();
+  }
+};
+
+/**
+ * @brief 哈希函数对象 (字符串视图)
+ */
+template <>
+struct Hasher<QString_View> : Hasher<QString>
+{
+};
+} /* namespace container */
+} /* namespace QAQ */
+
+#endif /* __HASHER_HPP__ */
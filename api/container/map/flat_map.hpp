@@ -0,0 +1,336 @@
+#ifndef __FLAT_MAP_HPP__
+#define __FLAT_MAP_HPP__
+
+#include "static_vector.hpp"
+
+/// @brief 名称空间 QAQ
+namespace QAQ
+{
+/// @brief 名称空间 容器
+namespace container
+{
+/**
+ * @brief 有序平坦映射 (键值对按键有序连续存储，二分查找，固定容量)
+ *
+ * @note  查找 O(log N) 且缓存友好，插入删除需移动后续元素，适合查多改少的小型表;
+ *        比较函数默认 std::less<>，支持异构键查找
+ *
+ * @tparam K        键类型
+ * @tparam V        值类型
+ * @tparam N        容量
+ * @tparam Compare  键比较函数对象
+ */
+template <typename K, typename V, uint32_t N, typename Compare = std::less<>>
+class Flat_Map final
+{
+public:
+  /// @brief 键值对
+  struct Entry
+  {
+    /// @brief 键
+    K key;
+    /// @brief 值
+    V value;
+  };
+
+  /// @brief 迭代器类型 (修改键会破坏有序性)
+  using iterator       = Entry*;
+  /// @brief 常量迭代器类型
+  using const_iterator = const Entry*;
+
+private:
+  /// @brief 键值对存储
+  Static_Vector<Entry, N> m_entries;
+  /// @brief 键比较函数对象
+  Compare                 m_compare;
+
+  /**
+   * @brief  有序平坦映射 查找第一个不小于键的位置
+   *
+   * @param  key       键
+   * @return uint32_t  位置
+   */
+  template <typename Q>
+  uint32_t QAQ_O3 lower_index(const Q& key) const
+  {
+    const Entry* data  = m_entries.data();
+    uint32_t     first = 0;
+    uint32_t     count = m_entries.size();
+
+    if (0 == count)
+    {
+      return 0;
+    }
+
+    // 无分支二分: 每轮只依据比较结果选择前进量，编译为条件选择指令，避免随机键下的分支预测失败
+    while (1 < count)
+    {
+      uint32_t half  = count / 2;
+      first         += m_compare(data[first + half - 1].key, key) ? half : 0;
+      count         -= half;
+    }
+
+    return first + (m_compare(data[first].key, key) ? 1 : 0);
+  }
+
+  /**
+   * @brief  有序平坦映射 查找键所在位置
+   *
+   * @param  key       键
+   * @return uint32_t  位置，未找到返回UINT32_MAX
+   */
+  template <typename Q>
+  uint32_t find_index(const Q& key) const
+  {
+    uint32_t index = lower_index(key);
+
+    if (index < m_entries.size() && !m_compare(key, m_entries[index].key))
+    {
+      return index;
+    }
+
+    return UINT32_MAX;
+  }
+
+public:
+  /**
+   * @brief  有序平坦映射 构造函数
+   */
+  Flat_Map() noexcept {}
+
+  /**
+   * @brief  有序平坦映射 获取元素数量
+   *
+   * @return uint32_t  元素数量
+   */
+  uint32_t size(void) const noexcept
+  {
+    return m_entries.size();
+  }
+
+  /**
+   * @brief  有序平坦映射 获取容量
+   *
+   * @return uint32_t  容量
+   */
+  static constexpr uint32_t capacity(void) noexcept
+  {
+    return N;
+  }
+
+  /**
+   * @brief  有序平坦映射 判断是否为空
+   *
+   * @return true   为空
+   * @return false  不为空
+   */
+  bool empty(void) const noexcept
+  {
+    return m_entries.empty();
+  }
+
+  /**
+   * @brief  有序平坦映射 判断是否已满
+   *
+   * @return true   已满
+   * @return false  未满
+   */
+  bool full(void) const noexcept
+  {
+    return m_entries.full();
+  }
+
+  /**
+   * @brief  有序平坦映射 查找
+   *
+   * @param  key  键 (可为与K可比较的异构类型)
+   * @return V*   值指针，未找到返回nullptr
+   */
+  template <typename Q = K>
+  V* find(const Q& key)
+  {
+    uint32_t index = find_index(key);
+    return (UINT32_MAX != index) ? std::addressof(m_entries[index].value) : nullptr;
+  }
+
+  /**
+   * @brief  有序平坦映射 查找 (const版本)
+   *
+   * @param  key       键 (可为与K可比较的异构类型)
+   * @return const V*  值指针，未找到返回nullptr
+   */
+  template <typename Q = K>
+  const V* find(const Q& key) const
+  {
+    uint32_t index = find_index(key);
+    return (UINT32_MAX != index) ? std::addressof(m_entries[index].value) : nullptr;
+  }
+
+  /**
+   * @brief  有序平坦映射 判断是否包含键
+   *
+   * @param  key   键 (可为与K可比较的异构类型)
+   * @return bool  是否包含
+   */
+  template <typename Q = K>
+  bool contains(const Q& key) const
+  {
+    return UINT32_MAX != find_index(key);
+  }
+
+  /**
+   * @brief  有序平坦映射 查找第一个不小于键的元素
+   *
+   * @param  key       键 (可为与K可比较的异构类型)
+   * @return iterator  元素位置，不存在返回end()
+   */
+  template <typename Q = K>
+  iterator lower_bound(const Q& key)
+  {
+    return m_entries.begin() + lower_index(key);
+  }
+
+  /**
+   * @brief  有序平坦映射 查找第一个不小于键的元素 (const版本)
+   *
+   * @param  key             键 (可为与K可比较的异构类型)
+   * @return const_iterator  元素位置，不存在返回end()
+   */
+  template <typename Q = K>
+  const_iterator lower_bound(const Q& key) const
+  {
+    return m_entries.begin() + lower_index(key);
+  }
+
+  /**
+   * @brief  有序平坦映射 插入 (键不存在时构造值)
+   *
+   * @param  key                  键
+   * @param  args                 值的构造参数
+   * @return std::pair<V*, bool>  值指针 (已满时为nullptr) 与是否新插入
+   */
+  template <typename... Args>
+  std::pair<V*, bool> try_emplace(const K& key, Args&&... args)
+  {
+    uint32_t index = lower_index(key);
+
+    if (index < m_entries.size() && !m_compare(key, m_entries[index].key))
+    {
+      return { std::addressof(m_entries[index].value), false };
+    }
+
+    Entry* entry = m_entries.emplace(m_entries.begin() + index, Entry { key, V(std::forward<Args>(args)...) });
+    return { entry ? std::addressof(entry->value) : nullptr, nullptr != entry };
+  }
+
+  /**
+   * @brief  有序平坦映射 插入 (键已存在时不修改)
+   *
+   * @param  key    键
+   * @param  value  值
+   * @return true   插入成功
+   * @return false  键已存在或已满
+   */
+  bool insert(const K& key, const V& value)
+  {
+    return try_emplace(key, value).second;
+  }
+
+  /**
+   * @brief  有序平坦映射 插入或赋值
+   *
+   * @param  key    键
+   * @param  value  值
+   * @return true   成功
+   * @return false  已满
+   */
+  bool insert_or_assign(const K& key, const V& value)
+  {
+    std::pair<V*, bool> result = try_emplace(key, value);
+
+    if (nullptr == result.first)
+    {
+      return false;
+    }
+
+    if (!result.second)
+    {
+      *result.first = value;
+    }
+
+    return true;
+  }
+
+  /**
+   * @brief  有序平坦映射 删除
+   *
+   * @param  key    键 (可为与K可比较的异构类型)
+   * @return true   删除成功
+   * @return false  键不存在
+   */
+  template <typename Q = K>
+  bool erase(const Q& key)
+  {
+    uint32_t index = find_index(key);
+
+    if (UINT32_MAX == index)
+    {
+      return false;
+    }
+
+    m_entries.erase(m_entries.begin() + index);
+    return true;
+  }
+
+  /**
+   * @brief  有序平坦映射 清空
+   */
+  void clear(void) noexcept
+  {
+    m_entries.clear();
+  }
+
+  /**
+   * @brief  有序平坦映射 获取起始迭代器
+   *
+   * @return iterator  起始迭代器
+   */
+  iterator begin(void) noexcept
+  {
+    return m_entries.begin();
+  }
+
+  /**
+   * @brief  有序平坦映射 获取结束迭代器
+   *
+   * @return iterator  结束迭代器
+   */
+  iterator end(void) noexcept
+  {
+    return m_entries.end();
+  }
+
+  /**
+   * @brief  有序平坦映射 获取起始常量迭代器
+   *
+   * @return const_iterator  起始常量迭代器
+   */
+  const_iterator begin(void) const noexcept
+  {
+    return m_entries.begin();
+  }
+
+  /**
+   * @brief  有序平坦映射 获取结束常量迭代器
+   *
+   * @return const_iterator  结束常量迭代器
+   */
+  const_iterator end(void) const noexcept
+  {
+    return m_entries.end();
+  }
+};
+} /* namespace container */
+} /* namespace QAQ */
+
+#endif /* __FLAT_MAP_HPP__ */
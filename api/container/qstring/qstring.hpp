@@ -12,88 +12,105 @@ namespace QAQ
 /// @brief 名称空间 容器
 namespace container
 {
+/// @brief 名称空间 内部
+namespace container_internal
+{
+/// @brief 名称空间 动态字符串内部
+namespace qstring_internal
+{
 /**
- * @brief 动态字符串
+ * @brief 动态字符串 通用算法 (QString 与 Static_QString 共用，仅操作原始字符数据)
  *
  */
-class QString final : private container_internal::qstring_internal::QString_Base
+class QString_Algorithm final
 {
 private:
   /// @brief BMH 匹配表大小
   static constexpr uint32_t BMH_SKIPER_SIZE = 256;
-  /// @brief 动态字符串 基类类型
-  using Base                                = container_internal::qstring_internal::QString_Base;
 
 public:
-  /// @brief 动态字符串 迭代器类型
-  using iterator       = char*;
-  /// @brief 动态字符串 常量迭代器类型
-  using const_iterator = const char*;
-
-private:
   /**
-   * @brief  动态字符串 字符解析 判断字符是否为空白字符
+   * @brief  动态字符串算法 字符解析 判断字符是否为空白字符
    *
    * @param  c      待判断的字符
    * @return true   字符为空白字符
    * @return false  字符不为空白字符
    */
-  static const bool QAQ_O3 is_space(char c) noexcept
+  static QAQ_INLINE bool is_space(char c) noexcept
   {
     return c == ' ' || c == '\t' || c == '\n' || c == '\r' || c == '\f' || c == '\v';
   }
 
   /**
-   * @brief  动态字符串 字符解析 判断字符是否为数字字符
+   * @brief  动态字符串算法 字符解析 判断字符是否为数字字符
    *
    * @param  c      待判断的字符
    * @return true   字符为数字字符
    * @return false  字符不为数字字符
    */
-  static const bool QAQ_O3 is_digit(char c) noexcept
+  static QAQ_INLINE bool is_digit(char c) noexcept
   {
     return c >= '0' && c <= '9';
   }
 
   /**
-   * @brief  动态字符串 字符解析 判断字符是否为字母字符
+   * @brief  动态字符串算法 字符解析 判断字符是否为字母字符
    *
    * @param  c      待判断的字符
    * @return true   字符为字母字符
    * @return false  字符不为字母字符
    */
-  static const bool QAQ_O3 is_alpha(char c) noexcept
+  static QAQ_INLINE bool is_alpha(char c) noexcept
   {
     return (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z');
   }
 
   /**
-   * @brief  动态字符串 字符解析 判断字符是否为大写字母
+   * @brief  动态字符串算法 字符解析 判断字符是否为大写字母
    *
    * @param  c      待判断的字符
    * @return true   字符为大写字母
    * @return false  字符不为大写字母
    */
-  static const bool QAQ_O3 is_upper(char c) noexcept
+  static QAQ_INLINE bool is_upper(char c) noexcept
   {
     return c >= 'A' && c <= 'Z';
   }
 
   /**
-   * @brief  动态字符串 字符解析 判断字符是否为小写字母
+   * @brief  动态字符串算法 字符解析 判断字符是否为小写字母
    *
    * @param  c      待判断的字符
    * @return true   字符为小写字母
    * @return false  字符不为小写字母
    */
-  static const bool QAQ_O3 is_lower(char c) noexcept
+  static QAQ_INLINE bool is_lower(char c) noexcept
   {
     return c >= 'a' && c <= 'z';
   }
 
-private:
   /**
-   * @brief  动态字符串 使用Boyer-Moore-Horspool算法正向查找
+   * @brief  动态字符串算法 计算C字符串长度
+   *
+   * @param  str        C字符串 (不可为空)
+   * @return uint32_t   字符串长度
+   */
+  static QAQ_INLINE uint32_t length(const char* str) noexcept
+  {
+    uint32_t len = 0;
+
+    while (str[len] != '\0')
+    {
+      ++len;
+    }
+
+    return len;
+  }
+
+  /**
+   * @brief  动态字符串算法 使用Boyer-Moore-Horspool算法正向查找
+   *
+   * @note   坏字符表位于栈上，可在多线程及中断中并发使用
    */
   static const char* QAQ_O3 bmh_find(const char* text, uint32_t text_len, const char* pattern, uint32_t pattern_len) noexcept
   {
@@ -101,17 +118,17 @@ private:
       return text;
     if (text_len < pattern_len)
       return nullptr;
+    if (1 == pattern_len)
+      return static_cast<const char*>(memchr(text, pattern[0], text_len));
 
     // 构建坏字符表
-    static uint8_t bad_char_skip[BMH_SKIPER_SIZE];
-    for (uint32_t i = 0; i < BMH_SKIPER_SIZE; i++)
-    {
-      bad_char_skip[i] = static_cast<uint8_t>(pattern_len);
-    }
+    uint32_t skip = std::min<uint32_t>(pattern_len, UINT8_MAX);
+    uint8_t  bad_char_skip[BMH_SKIPER_SIZE];
+    memset(bad_char_skip, static_cast<int>(skip), sizeof(bad_char_skip));
 
     for (uint32_t i = 0; i < pattern_len - 1; i++)
     {
-      bad_char_skip[static_cast<uint8_t>(pattern[i])] = static_cast<uint8_t>(pattern_len - 1 - i);
+      bad_char_skip[static_cast<uint8_t>(pattern[i])] = static_cast<uint8_t>(std::min<uint32_t>(pattern_len - 1 - i, UINT8_MAX));
     }
 
     // BMH搜索
@@ -136,7 +153,9 @@ private:
   }
 
   /**
-   * @brief  动态字符串 使用Boyer-Moore-Horspool算法反向查找
+   * @brief  动态字符串算法 使用Boyer-Moore-Horspool算法反向查找
+   *
+   * @note   坏字符表位于栈上，可在多线程及中断中并发使用
    */
   static const char* QAQ_O3 bmh_rfind(const char* text, uint32_t text_len, const char* pattern, uint32_t pattern_len) noexcept
   {
@@ -146,15 +165,13 @@ private:
       return nullptr;
 
     // 构建坏字符表
-    static uint8_t bad_char_skip[BMH_SKIPER_SIZE];
-    for (uint32_t i = 0; i < BMH_SKIPER_SIZE; i++)
-    {
-      bad_char_skip[i] = static_cast<uint8_t>(pattern_len);
-    }
+    uint32_t skip = std::min<uint32_t>(pattern_len, UINT8_MAX);
+    uint8_t  bad_char_skip[BMH_SKIPER_SIZE];
+    memset(bad_char_skip, static_cast<int>(skip), sizeof(bad_char_skip));
 
     for (uint32_t i = pattern_len - 1; i > 0; i--)
     {
-      bad_char_skip[static_cast<uint8_t>(pattern[i])] = static_cast<uint8_t>(i);
+      bad_char_skip[static_cast<uint8_t>(pattern[i])] = static_cast<uint8_t>(std::min<uint32_t>(i, UINT8_MAX));
     }
 
     // 反向BMH搜索
@@ -185,6 +202,307 @@ private:
     return nullptr;
   }
 
+  /**
+   * @brief  动态字符串算法 正向查找指定长度的字符串
+   *
+   * @param  data       被查找数据
+   * @param  size       被查找数据长度
+   * @param  str        要查找的字符串
+   * @param  pos        查找起始位置
+   * @param  count      字符串长度
+   * @return uint32_t   找到的位置，未找到返回UINT32_MAX
+   */
+  static uint32_t find(const char* data, uint32_t size, const char* str, uint32_t pos, uint32_t count) noexcept
+  {
+    if (nullptr == str || 0 == count || size <= pos)
+    {
+      return UINT32_MAX;
+    }
+
+    const char* found = bmh_find(data + pos, size - pos, str, count);
+
+    return found ? static_cast<uint32_t>(found - data) : UINT32_MAX;
+  }
+
+  /**
+   * @brief  动态字符串算法 正向查找字符
+   *
+   * @param  data       被查找数据
+   * @param  size       被查找数据长度
+   * @param  ch         要查找的字符
+   * @param  pos        查找起始位置
+   * @return uint32_t   找到的位置，未找到返回UINT32_MAX
+   */
+  static uint32_t find(const char* data, uint32_t size, char ch, uint32_t pos) noexcept
+  {
+    if (size <= pos)
+    {
+      return UINT32_MAX;
+    }
+
+    const char* found = static_cast<const char*>(memchr(data + pos, ch, size - pos));
+
+    return found ? static_cast<uint32_t>(found - data) : UINT32_MAX;
+  }
+
+  /**
+   * @brief  动态字符串算法 反向查找指定长度的字符串
+   *
+   * @param  data       被查找数据
+   * @param  size       被查找数据长度
+   * @param  str        要查找的字符串
+   * @param  pos        查找起始位置
+   * @param  count      字符串长度
+   * @return uint32_t   找到的位置，未找到返回UINT32_MAX
+   */
+  static uint32_t rfind(const char* data, uint32_t size, const char* str, uint32_t pos, uint32_t count) noexcept
+  {
+    if (0 == count)
+    {
+      return std::min(pos, size);
+    }
+
+    pos = std::min(pos, size);
+
+    if (nullptr == str || pos < count)
+    {
+      return UINT32_MAX;
+    }
+
+    const char* found = bmh_rfind(data, pos, str, count);
+
+    return found ? static_cast<uint32_t>(found - data) : UINT32_MAX;
+  }
+
+  /**
+   * @brief  动态字符串算法 反向查找字符
+   *
+   * @param  data       被查找数据
+   * @param  size       被查找数据长度
+   * @param  ch         要查找的字符
+   * @param  pos        查找起始位置
+   * @return uint32_t   找到的位置，未找到返回UINT32_MAX
+   */
+  static uint32_t rfind(const char* data, uint32_t size, char ch, uint32_t pos) noexcept
+  {
+    pos = std::min(pos, size);
+
+    while (0 < pos)
+    {
+      --pos;
+      if (data[pos] == ch)
+      {
+        return pos;
+      }
+    }
+
+    return UINT32_MAX;
+  }
+
+  /**
+   * @brief  动态字符串算法 比较两段字符数据
+   *
+   * @param  data    数据1
+   * @param  count1  数据1长度
+   * @param  str     数据2
+   * @param  count2  数据2长度
+   * @return int     比较结果：小于0表示小于，等于0表示相等，大于0表示大于
+   */
+  static int compare(const char* data, uint32_t count1, const char* str, uint32_t count2) noexcept
+  {
+    if (str != nullptr)
+    {
+      int result = memcmp(data, str, std::min(count1, count2));
+
+      if (0 != result)
+      {
+        return result;
+      }
+      else if (count1 < count2)
+      {
+        return -1;
+      }
+      else if (count1 > count2)
+      {
+        return 1;
+      }
+      else
+      {
+        return 0;
+      }
+    }
+    else
+    {
+      return -1;
+    }
+  }
+
+  /**
+   * @brief  动态字符串算法 检查是否以指定字符串开头
+   *
+   * @param  data  数据
+   * @param  size  数据长度
+   * @param  str   要检查的字符串
+   * @param  len   字符串长度
+   * @return bool  检查结果
+   */
+  static bool starts_with(const char* data, uint32_t size, const char* str, uint32_t len) noexcept
+  {
+    return len <= size && 0 == memcmp(data, str, len);
+  }
+
+  /**
+   * @brief  动态字符串算法 检查是否以指定字符串结尾
+   *
+   * @param  data  数据
+   * @param  size  数据长度
+   * @param  str   要检查的字符串
+   * @param  len   字符串长度
+   * @return bool  检查结果
+   */
+  static bool ends_with(const char* data, uint32_t size, const char* str, uint32_t len) noexcept
+  {
+    return len <= size && 0 == memcmp(data + size - len, str, len);
+  }
+
+  /**
+   * @brief  动态字符串算法 统计字符出现次数
+   *
+   * @param  data       数据
+   * @param  size       数据长度
+   * @param  ch         要统计的字符
+   * @return uint32_t   字符出现次数
+   */
+  static uint32_t count(const char* data, uint32_t size, char ch) noexcept
+  {
+    uint32_t count = 0;
+
+    for (uint32_t i = 0; i < size; ++i)
+    {
+      if (data[i] == ch)
+      {
+        ++count;
+      }
+    }
+
+    return count;
+  }
+
+  /**
+   * @brief  动态字符串算法 统计字符串出现次数 (不重叠)
+   *
+   * @param  data       数据
+   * @param  size       数据长度
+   * @param  str        要统计的字符串
+   * @param  len        字符串长度
+   * @return uint32_t   字符串出现次数
+   */
+  static uint32_t count(const char* data, uint32_t size, const char* str, uint32_t len) noexcept
+  {
+    if (0 == len || size < len)
+    {
+      return 0;
+    }
+
+    uint32_t count = 0;
+
+    for (uint32_t i = 0; i + len <= size; ++i)
+    {
+      if (0 == memcmp(data + i, str, len))
+      {
+        ++count;
+        i += len - 1;
+      }
+    }
+
+    return count;
+  }
+
+  /**
+   * @brief  动态字符串算法 转换为小写
+   *
+   * @param  data  数据
+   * @param  size  数据长度
+   */
+  static void to_lower(char* data, uint32_t size) noexcept
+  {
+    for (uint32_t i = 0; i < size; ++i)
+    {
+      data[i] = tolower(data[i]);
+    }
+  }
+
+  /**
+   * @brief  动态字符串算法 转换为大写
+   *
+   * @param  data  数据
+   * @param  size  数据长度
+   */
+  static void to_upper(char* data, uint32_t size) noexcept
+  {
+    for (uint32_t i = 0; i < size; ++i)
+    {
+      data[i] = toupper(data[i]);
+    }
+  }
+
+  /**
+   * @brief  动态字符串算法 计算左侧空白字符数量
+   *
+   * @param  data       数据
+   * @param  size       数据长度
+   * @return uint32_t   左侧空白字符数量
+   */
+  static uint32_t leading_space(const char* data, uint32_t size) noexcept
+  {
+    uint32_t start = 0;
+
+    while (size > start && is_space(data[start]))
+    {
+      ++start;
+    }
+
+    return start;
+  }
+
+  /**
+   * @brief  动态字符串算法 计算去除右侧空白后的长度
+   *
+   * @param  data       数据
+   * @param  size       数据长度
+   * @return uint32_t   去除右侧空白后的长度
+   */
+  static uint32_t trailing_end(const char* data, uint32_t size) noexcept
+  {
+    while (0 < size && is_space(data[size - 1]))
+    {
+      --size;
+    }
+
+    return size;
+  }
+};
+} /* namespace qstring_internal */
+} /* namespace container_internal */
+
+/**
+ * @brief 动态字符串
+ *
+ */
+class QString final : private container_internal::qstring_internal::QString_Base
+{
+private:
+  /// @brief 动态字符串 基类类型
+  using Base      = container_internal::qstring_internal::QString_Base;
+  /// @brief 动态字符串 算法类型
+  using Algorithm = container_internal::qstring_internal::QString_Algorithm;
+
+public:
+  /// @brief 动态字符串 迭代器类型
+  using iterator       = char*;
+  /// @brief 动态字符串 常量迭代器类型
+  using const_iterator = const char*;
+
 public:
   /**
    * @brief  动态字符串 构造函数 默认构造函数
@@ -332,7 +650,7 @@ public:
    * @param  value      整数值
    * @return QString&   当前对象引用
    */
-  template <typename T, typename = std::enable_if_t<!std::is_same<T, char>::value>>
+  template <typename T, typename = std::enable_if_t<std::is_arithmetic<T>::value && !std::is_same<T, char>::value>>
   QString& operator=(T value)
   {
     char buffer[64];
@@ -731,7 +1049,7 @@ public:
    * @param  value      要追加的整数值
    * @return QString&   当前对象引用
    */
-  template <typename T, typename = std::enable_if_t<!std::is_same<T, char>::value>>
+  template <typename T, typename = std::enable_if_t<std::is_arithmetic<T>::value && !std::is_same<T, char>::value>>
   QString& operator+=(T value)
   {
     return append(value);
@@ -959,15 +1277,7 @@ public:
    */
   uint32_t find(const char* str, uint32_t pos, uint32_t count) const
   {
-    if (nullptr == str || 0 == count || size_impl() <= pos)
-    {
-      return UINT32_MAX;
-    }
-
-    const char* data_ptr = data_impl();
-    const char* found    = bmh_find(data_ptr + pos, size_impl() - pos, str, count);
-
-    return found ? static_cast<uint32_t>(found - data_ptr) : UINT32_MAX;
+    return Algorithm::find(data_impl(), size_impl(), str, pos, count);
   }
 
   /**
@@ -979,22 +1289,9 @@ public:
    */
   uint32_t find(const char* str, uint32_t pos = 0) const
   {
-    if (nullptr != str && pos < size_impl())
+    if (nullptr != str)
     {
-      uint32_t len = 0;
-
-      while (str[len] != '\0')
-      {
-        ++len;
-      }
-
-      if (0 < len)
-      {
-        const char* data_ptr = data_impl();
-        const char* found    = bmh_find(data_ptr + pos, size_impl() - pos, str, len);
-
-        return found ? static_cast<uint32_t>(found - data_ptr) : UINT32_MAX;
-      }
+      return Algorithm::find(data_impl(), size_impl(), str, pos, Algorithm::length(str));
     }
 
     return UINT32_MAX;
@@ -1009,15 +1306,7 @@ public:
    */
   uint32_t find(char ch, uint32_t pos = 0) const
   {
-    if (size_impl() <= pos)
-    {
-      return UINT32_MAX;
-    }
-
-    const char* data_ptr = data_impl();
-    const char* found    = static_cast<const char*>(memchr(data_ptr + pos, ch, size_impl() - pos));
-
-    return found ? static_cast<uint32_t>(found - data_ptr) : UINT32_MAX;
+    return Algorithm::find(data_impl(), size_impl(), ch, pos);
   }
 
   /**
@@ -1042,22 +1331,7 @@ public:
    */
   uint32_t rfind(const char* str, uint32_t pos, uint32_t count) const
   {
-    if (0 == count)
-    {
-      return std::min(pos, size_impl());
-    }
-
-    pos = std::min(pos, size_impl());
-
-    if (nullptr == str || pos < count)
-    {
-      return UINT32_MAX;
-    }
-
-    const char* data_ptr = data_impl();
-    const char* found    = bmh_rfind(data_ptr, pos, str, count);
-
-    return found ? static_cast<uint32_t>(found - data_ptr) : UINT32_MAX;
+    return Algorithm::rfind(data_impl(), size_impl(), str, pos, count);
   }
 
   /**
@@ -1071,21 +1345,11 @@ public:
   {
     if (str != nullptr && (pos < size_impl() || pos == UINT32_MAX))
     {
-      uint32_t len = 0;
-
-      while (str[len] != '\0')
-      {
-        ++len;
-      }
+      uint32_t len = Algorithm::length(str);
 
       if (0 < len)
       {
-        pos                  = std::min(pos, size_impl());
-
-        const char* data_ptr = data_impl();
-        const char* found    = bmh_rfind(data_ptr, pos, str, len);
-
-        return found ? static_cast<uint32_t>(found - data_ptr) : UINT32_MAX;
+        return Algorithm::rfind(data_impl(), size_impl(), str, pos, len);
       }
     }
 
@@ -1101,32 +1365,7 @@ public:
    */
   uint32_t rfind(char ch, uint32_t pos = UINT32_MAX) const
   {
-    pos = std::min(pos, size_impl());
-
-    if (pos == 0)
-    {
-      return UINT32_MAX;
-    }
-
-    const char* data_ptr   = data_impl();
-    const char* start_ptr  = data_ptr;
-    const char* search_ptr = data_ptr + pos;
-
-    while (search_ptr > start_ptr)
-    {
-      --search_ptr;
-      if (*search_ptr == ch)
-      {
-        return static_cast<uint32_t>(search_ptr - data_ptr);
-      }
-    }
-
-    if (pos > 0 && data_ptr[0] == ch)
-    {
-      return 0;
-    }
-
-    return UINT32_MAX;
+    return Algorithm::rfind(data_impl(), size_impl(), ch, pos);
   }
 
   /**
@@ -1150,14 +1389,7 @@ public:
   {
     if (str != nullptr)
     {
-      uint32_t len = 0;
-
-      while (str[len] != '\0')
-      {
-        ++len;
-      }
-
-      return compare(0, size_impl(), str, len);
+      return compare(0, size_impl(), str, Algorithm::length(str));
     }
     else
     {
@@ -1190,14 +1422,7 @@ public:
   {
     if (str != nullptr)
     {
-      uint32_t len = 0;
-
-      while (str[len] != '\0')
-      {
-        ++len;
-      }
-
-      return compare(pos, count, str, len);
+      return compare(pos, count, str, Algorithm::length(str));
     }
     else
     {
@@ -1216,33 +1441,7 @@ public:
    */
   int compare(uint32_t pos, uint32_t count1, const char* str, uint32_t count2) const
   {
-    if (str != nullptr)
-    {
-      uint32_t len = std::min(count1, count2);
-
-      int result   = memcmp(data_impl() + pos, str, len);
-
-      if (0 != result)
-      {
-        return result;
-      }
-      else if (count1 < count2)
-      {
-        return -1;
-      }
-      else if (count1 > count2)
-      {
-        return 1;
-      }
-      else
-      {
-        return 0;
-      }
-    }
-    else
-    {
-      return -1;
-    }
+    return Algorithm::compare(data_impl() + pos, count1, str, count2);
   }
 
   /**
@@ -1384,13 +1583,7 @@ public:
    */
   QString& to_lower(void) noexcept
   {
-    char* ptr = data_impl();
-
-    for (uint32_t i = 0; i < size_impl(); ++i)
-    {
-      ptr[i] = tolower(ptr[i]);
-    }
-
+    Algorithm::to_lower(data_impl(), size_impl());
     return *this;
   }
 
@@ -1401,13 +1594,7 @@ public:
    */
   QString& to_upper(void) noexcept
   {
-    char* ptr = data_impl();
-
-    for (uint32_t i = 0; i < size_impl(); ++i)
-    {
-      ptr[i] = toupper(ptr[i]);
-    }
-
+    Algorithm::to_upper(data_impl(), size_impl());
     return *this;
   }
 
@@ -1443,12 +1630,7 @@ public:
    */
   bool starts_with(const QString& other) const noexcept
   {
-    if (other.size_impl() > size_impl())
-    {
-      return false;
-    }
-
-    return memcmp(data_impl(), other.data_impl(), other.size_impl()) == 0;
+    return Algorithm::starts_with(data_impl(), size_impl(), other.data_impl(), other.size_impl());
   }
 
   /**
@@ -1461,19 +1643,7 @@ public:
   {
     if (nullptr != str)
     {
-      uint32_t len = 0;
-
-      while (str[len] != '\0')
-      {
-        ++len;
-      }
-
-      if (size_impl() < len)
-      {
-        return false;
-      }
-
-      return memcmp(data_impl(), str, len) == 0;
+      return Algorithm::starts_with(data_impl(), size_impl(), str, Algorithm::length(str));
     }
     else
     {
@@ -1490,12 +1660,12 @@ public:
    */
   bool starts_with(const char* str, uint32_t len) const noexcept
   {
-    if (nullptr == str || 0 == len || size_impl() < len)
+    if (nullptr == str || 0 == len)
     {
       return false;
     }
 
-    return memcmp(data_impl(), str, len) == 0;
+    return Algorithm::starts_with(data_impl(), size_impl(), str, len);
   }
 
   /**
@@ -1517,12 +1687,7 @@ public:
    */
   bool ends_with(const QString& other) const noexcept
   {
-    if (other.size_impl() > size_impl())
-    {
-      return false;
-    }
-
-    return memcmp(data_impl() + size_impl() - other.size_impl(), other.data_impl(), other.size_impl()) == 0;
+    return Algorithm::ends_with(data_impl(), size_impl(), other.data_impl(), other.size_impl());
   }
 
   /**
@@ -1535,19 +1700,7 @@ public:
   {
     if (nullptr != str)
     {
-      uint32_t len = 0;
-
-      while (str[len] != '\0')
-      {
-        ++len;
-      }
-
-      if (size_impl() < len)
-      {
-        return false;
-      }
-
-      return memcmp(data_impl() + size_impl() - len, str, len) == 0;
+      return Algorithm::ends_with(data_impl(), size_impl(), str, Algorithm::length(str));
     }
     else
     {
@@ -1564,12 +1717,12 @@ public:
    */
   bool ends_with(const char* str, uint32_t len) const noexcept
   {
-    if (nullptr == str || 0 == len || size_impl() < len)
+    if (nullptr == str || 0 == len)
     {
       return false;
     }
 
-    return memcmp(data_impl() + size_impl() - len, str, len) == 0;
+    return Algorithm::ends_with(data_impl(), size_impl(), str, len);
   }
 
   /**
@@ -1583,6 +1736,16 @@ public:
     return ((0 != size_impl()) && (data_impl()[size_impl() - 1] == ch));
   }
 
+  /**
+   * @brief  动态字符串 哈希操作 获取哈希值 (堆存储的字符串缓存计算结果)
+   *
+   * @return uint32_t   哈希值，与相同内容的QString_View一致
+   */
+  uint32_t hash(void) const noexcept
+  {
+    return hash_impl();
+  }
+
   /**
    * @brief  动态字符串 统计操作 统计字符出现次数
    *
@@ -1591,18 +1754,7 @@ public:
    */
   uint32_t count(char ch) const noexcept
   {
-    uint32_t    count = 0;
-    const char* ptr   = data_impl();
-
-    for (uint32_t i = 0; i < size_impl(); ++i)
-    {
-      if (ptr[i] == ch)
-      {
-        ++count;
-      }
-    }
-
-    return count;
+    return Algorithm::count(data_impl(), size_impl(), ch);
   }
 
   /**
@@ -1613,26 +1765,7 @@ public:
    */
   uint32_t count(const QString& other) const
   {
-    if (other.empty() || (other.size_impl() > size_impl()))
-    {
-      return 0;
-    }
-
-    uint32_t    count     = 0;
-    const char* ptr       = data_impl();
-    const char* other_ptr = other.data_impl();
-    uint32_t    length    = other.size_impl();
-
-    for (uint32_t i = 0; i < size_impl(); ++i)
-    {
-      if (0 == memcmp(ptr + i, other_ptr, length))
-      {
-        ++count;
-        i += length - 1;
-      }
-    }
-
-    return count;
+    return Algorithm::count(data_impl(), size_impl(), other.data_impl(), other.size_impl());
   }
 
   /**
@@ -1697,12 +1830,7 @@ public:
    */
   QString& trim_left()
   {
-    uint32_t start = 0;
-
-    while (size_impl() > start && is_space(data_impl()[start]))
-    {
-      ++start;
-    }
+    uint32_t start = Algorithm::leading_space(data_impl(), size_impl());
 
     if (0 < start)
     {
@@ -1719,12 +1847,7 @@ public:
    */
   QString& trim_right()
   {
-    uint32_t end = size_impl();
-
-    while (0 < end && is_space(data_impl()[end - 1]))
-    {
-      --end;
-    }
+    uint32_t end = Algorithm::trailing_end(data_impl(), size_impl());
 
     if (size_impl() > end)
     {
@@ -2065,7 +2188,7 @@ public:
    * @param  rhs      右操作数
    * @return QString  拼接结果
    */
-  template <typename T, typename = std::enable_if_t<!std::is_same<T, char>::value>>
+  template <typename T, typename = std::enable_if_t<std::is_arithmetic<T>::value && !std::is_same<T, char>::value>>
   friend QString operator+(const QString& lhs, T rhs)
   {
     QString result(lhs);
@@ -2080,7 +2203,7 @@ public:
    * @param  rhs      右操作数
    * @return QString  拼接结果
    */
-  template <typename T, typename = std::enable_if_t<!std::is_same<T, char>::value>>
+  template <typename T, typename = std::enable_if_t<std::is_arithmetic<T>::value && !std::is_same<T, char>::value>>
   friend QString operator+(T lhs, const QString& rhs)
   {
     QString result;
@@ -2128,7 +2251,7 @@ public:
    * @param  value      要拼接的整数或浮点数
    * @return QString&   当前对象引用
    */
-  template <typename T, typename = std::enable_if_t<!std::is_same<T, char>::value>>
+  template <typename T, typename = std::enable_if_t<std::is_arithmetic<T>::value && !std::is_same<T, char>::value>>
   QString& operator<<(T value)
   {
     return append(value);
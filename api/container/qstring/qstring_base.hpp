@@ -2,6 +2,7 @@
 #define __QSTRING_BASE_HPP__
 
 #include "qstring_memory.hpp"
+#include "hash.hpp"
 
 /// @brief 名称空间 QAQ
 namespace QAQ
@@ -18,14 +19,20 @@ namespace qstring_internal
 /**
  * @brief 动态字符串 基类
  *
+ * @note  堆存储为单块内存: [QString_Heap_Header][字符数据]，引用计数与容量位于头部，
+ *        引用计数表示持有者数量，fetch_sub 返回 1 的持有者负责释放;
+ *        头部缓存哈希值，通过接口修改内容时失效，计算哈希后不可再经先前取得的可写指针修改内容
  */
 class QString_Base
 {
 private:
   /// @brief SSO存储阈值
   static constexpr uint32_t SSO_THRESHOLD = 16;
+  /// @brief 堆存储头部类型
+  using Header                            = QString_Heap_Header;
 
-  union
+  /// @brief 存储区
+  union Storage
   {
     /// @brief SSO存储区
     struct
@@ -41,17 +48,109 @@ private:
     /// @brief 动态存储区
     struct
     {
-      /// @brief 动态存储区指针
-      char*                  data;
+      /// @brief 动态存储区指针 (紧随头部之后)
+      char*    data;
       /// @brief 长度
-      uint32_t               size;
-      /// @brief 容量
-      uint32_t               capacity;
-      /// @brief 引用计数
-      std::atomic<uint32_t>* ref_count;
+      uint32_t size;
     } heap;
   } storage;
 
+  /**
+   * @brief  动态字符串基类 获取堆存储头部
+   *
+   * @param  data     堆存储数据指针
+   * @return Header*  头部指针
+   */
+  static QAQ_INLINE Header* header(char* data) noexcept
+  {
+    return reinterpret_cast<Header*>(data) - 1;
+  }
+
+  /**
+   * @brief  动态字符串基类 分配堆存储 (头部与数据一次分配，引用计数初始化为1)
+   *
+   * @param  capacity  所需数据区容量 (含结束符)
+   * @return char*     数据指针，失败返回nullptr
+   */
+  static char* heap_allocate(uint32_t capacity) noexcept
+  {
+    QString_Memory_Pool& pool  = QString_Memory_Pool::instance();
+    uint32_t             block = pool.get_capacity(capacity + sizeof(Header));
+    char*                mem   = pool.allocate(block);
+
+    if (nullptr == mem)
+    {
+      return nullptr;
+    }
+
+    Header* head   = new (mem) Header;
+    head->capacity = block - sizeof(Header);
+    head->ref_count.store(1, std::memory_order_relaxed);
+    head->hash.store(0, std::memory_order_relaxed);
+
+    return reinterpret_cast<char*>(head + 1);
+  }
+
+  /**
+   * @brief  动态字符串基类 释放一个堆存储引用 (最后一个持有者释放内存)
+   *
+   * @param  data  堆存储数据指针
+   */
+  static void heap_release(char* data) noexcept
+  {
+    Header* head = header(data);
+
+    if (1 == head->ref_count.fetch_sub(1, std::memory_order_acq_rel))
+    {
+      uint32_t block = head->capacity + sizeof(Header);
+      head->~Header();
+      QString_Memory_Pool::instance().deallocate(reinterpret_cast<char*>(head), block);
+    }
+  }
+
+  /**
+   * @brief  动态字符串基类 重置为空SSO字符串 (不释放原有存储)
+   */
+  void reset_sso(void) noexcept
+  {
+    storage.sso.data[0] = '\0';
+    storage.sso.size    = 0;
+    storage.sso.is_sso  = 1;
+  }
+
+  /**
+   * @brief  动态字符串基类 重新分配独占的堆存储
+   *
+   * @param  new_capacity  新容量 (不含结束符)
+   * @param  keep_data     是否保留原有数据
+   * @return true          分配成功
+   * @return false         分配失败 (原数据保持不变)
+   */
+  bool reallocate(uint32_t new_capacity, bool keep_data) noexcept
+  {
+    char* data = heap_allocate(new_capacity + 1);
+
+    if (nullptr == data)
+    {
+      return false;
+    }
+
+    uint32_t size = keep_data ? std::min(size_impl(), new_capacity) : 0;
+
+    if (0 < size)
+    {
+      memcpy(data, static_cast<const QString_Base*>(this)->data_impl(), size);
+    }
+
+    data[size] = '\0';
+    release();
+
+    storage.heap.data  = data;
+    storage.heap.size  = size;
+    storage.sso.is_sso = 0;
+    return true;
+  }
+
 protected:
   /**
    * @brief  动态字符串基类 获取当前存储类型
@@ -64,131 +163,92 @@ protected:
   }
 
   /**
-   * @brief  动态字符串基类 初始化引用计数
+   * @brief  动态字符串基类 判断堆存储是否被共享
+   *
+   * @return true   被多个对象共享
+   * @return false  独占或SSO存储
    */
-  void init_ref_count(void) noexcept
+  bool is_shared(void) const noexcept
   {
-    if (!storage.sso.is_sso)
-    {
-      storage.heap.ref_count = QString_Memory_Pool::instance().counter_malloc();
-      storage.heap.ref_count->store(0);
-    }
+    return !storage.sso.is_sso && 1 < header(storage.heap.data)->ref_count.load(std::memory_order_acquire);
   }
 
   /**
    * @brief  动态字符串基类 增加引用计数
    */
-  void add_ref(void) noexcept
+  void add_ref(void) const noexcept
   {
-    if (!storage.sso.is_sso && storage.heap.ref_count)
+    if (!storage.sso.is_sso)
     {
-      storage.heap.ref_count->fetch_add(1);
+      header(storage.heap.data)->ref_count.fetch_add(1, std::memory_order_relaxed);
     }
   }
 
   /**
-   * @brief  动态字符串基类 减少引用计数 (如果为0则释放内存)
+   * @brief  动态字符串基类 减少引用计数 (如果为最后一个持有者则释放内存)
    */
   void release(void) noexcept
   {
-    if (!storage.sso.is_sso && storage.heap.ref_count)
+    if (!storage.sso.is_sso)
     {
-      if (0 == storage.heap.ref_count->load())
-      {
-        QString_Memory_Pool::instance().deallocate(storage.heap.data, storage.heap.capacity);
-        QString_Memory_Pool::instance().counter_free(storage.heap.ref_count);
-      }
-      else
-      {
-        storage.heap.ref_count->fetch_sub(1);
-      }
+      heap_release(storage.heap.data);
     }
   }
 
   /**
    * @brief  动态字符串基类 分离共享数据 (写时复制)
+   *
+   * @return true   当前存储可写
+   * @return false  分配失败，存储仍为共享
    */
-  void detach(void)
+  bool detach(void) noexcept
   {
-    if (!storage.sso.is_sso && storage.heap.ref_count)
+    if (is_shared())
     {
-      if (storage.heap.ref_count->load())
-      {
-        QString_Base new_string;
-        new_string.storage.heap.capacity = QString_Memory_Pool::instance().get_capacity(storage.heap.capacity);
-        new_string.storage.heap.data     = QString_Memory_Pool::instance().allocate(new_string.storage.heap.capacity);
-        new_string.storage.heap.size     = storage.heap.size;
-        new_string.storage.sso.is_sso    = 0;
-
-        memcpy(new_string.storage.heap.data, storage.heap.data, storage.heap.size);
-        new_string.storage.heap.data[storage.heap.size] = '\0';
-
-        new_string.init_ref_count();
-        swap_impl(new_string);
-      }
+      return reallocate(header(storage.heap.data)->capacity - 1, true);
     }
+
+    return true;
   }
 
   /**
-   * @brief  动态字符串基类 确保有足够的容量
+   * @brief  动态字符串基类 确保有足够的容量且存储可写
    *
    * @param  new_capacity  新容量
    * @param  keep_data     是否保留原有数据
+   * @return true          容量满足要求
+   * @return false         分配失败
    */
-  void reserve_impl(uint32_t new_capacity, bool keep_data = true)
+  bool reserve_impl(uint32_t new_capacity, bool keep_data = true)
   {
-    if (storage.sso.is_sso)
+    if (capacity_impl() >= new_capacity && !is_shared())
     {
-      if (SSO_THRESHOLD < new_capacity)
+      if (!keep_data)
       {
-        QString_Base new_string;
-        new_string.storage.heap.capacity = QString_Memory_Pool::instance().get_capacity(new_capacity + 1);
-        new_string.storage.heap.data     = QString_Memory_Pool::instance().allocate(new_string.storage.heap.capacity);
-        new_string.storage.heap.size     = storage.sso.size;
-        new_string.storage.sso.is_sso    = 0;
-
-        if (keep_data)
-        {
-          memcpy(new_string.storage.heap.data, storage.sso.is_sso ? storage.sso.data : storage.heap.data, size_impl());
-          new_string.storage.heap.data[storage.sso.size] = '\0';
-        }
-        else
-        {
-          new_string.storage.heap.size    = 0;
-          new_string.storage.heap.data[0] = '\0';
-        }
-
-        new_string.init_ref_count();
-        swap_impl(new_string);
+        set_size(0);
       }
+
+      return true;
     }
-    else
+
+    return reallocate(std::max(new_capacity, keep_data ? size_impl() : 0u), keep_data);
+  }
+
+  /**
+   * @brief  动态字符串基类 确保可写入指定大小的数据 (容量不足时按增长策略扩容)
+   *
+   * @param  new_size  写入后的大小
+   * @return true      可写入
+   * @return false     分配失败
+   */
+  bool prepare_write(uint32_t new_size)
+  {
+    if (capacity_impl() < new_size)
     {
-      if (new_capacity + 1 >= storage.heap.capacity)
-      {
-        if (nullptr != storage.heap.ref_count)
-        {
-          QString_Base new_string;
-          new_string.storage.heap.capacity = QString_Memory_Pool::instance().get_capacity(new_capacity + 1);
-          new_string.storage.heap.data     = QString_Memory_Pool::instance().allocate(new_string.storage.heap.capacity);
-          new_string.storage.heap.size     = keep_data ? storage.heap.size : 0;
-          new_string.storage.sso.is_sso    = 0;
-
-          if (keep_data)
-          {
-            memcpy(new_string.storage.heap.data, storage.heap.data, storage.heap.size);
-            new_string.storage.heap.data[storage.heap.size] = '\0';
-          }
-          else
-          {
-            new_string.storage.heap.data[0] = '\0';
-          }
-
-          new_string.init_ref_count();
-          swap_impl(new_string);
-        }
-      }
+      return reserve_impl(calculate_growth_capacity(new_size));
     }
+
+    return detach();
   }
 
   /**
@@ -211,6 +271,7 @@ protected:
     if (!storage.sso.is_sso)
     {
       detach();
+      invalidate_hash();
       return storage.heap.data;
     }
     else
@@ -236,7 +297,42 @@ protected:
    */
   uint32_t capacity_impl(void) const noexcept
   {
-    return storage.sso.is_sso ? SSO_THRESHOLD : storage.heap.capacity - 1;
+    return storage.sso.is_sso ? SSO_THRESHOLD : header(storage.heap.data)->capacity - 1;
+  }
+
+  /**
+   * @brief  动态字符串基类 使缓存的哈希值失效 (仅独占的堆存储)
+   */
+  void invalidate_hash(void) noexcept
+  {
+    if (!storage.sso.is_sso)
+    {
+      header(storage.heap.data)->hash.store(0, std::memory_order_relaxed);
+    }
+  }
+
+  /**
+   * @brief  动态字符串基类 计算哈希值 (堆存储缓存结果，共享的副本共用缓存)
+   *
+   * @return uint32_t  哈希值
+   */
+  uint32_t hash_impl(void) const noexcept
+  {
+    if (storage.sso.is_sso)
+    {
+      return system::algorithm::Hash::hash(storage.sso.data, storage.sso.size);
+    }
+
+    Header*  head  = header(storage.heap.data);
+    uint32_t value = head->hash.load(std::memory_order_relaxed);
+
+    if (0 == value)
+    {
+      value = system::algorithm::Hash::hash(storage.heap.data, storage.heap.size);
+      head->hash.store(value, std::memory_order_relaxed);
+    }
+
+    return value;
   }
 
   /**
@@ -255,24 +351,23 @@ protected:
     {
       storage.heap.size           = new_size;
       storage.heap.data[new_size] = '\0';
+      invalidate_hash();
     }
   }
 
   /**
-   * @brief  动态字符串基类 清空数据
+   * @brief  动态字符串基类 清空数据 (共享存储直接释放引用，无需拷贝)
    */
   void clear_impl(void) noexcept
   {
-    if (storage.sso.is_sso)
+    if (is_shared())
     {
-      storage.sso.data[0] = '\0';
-      storage.sso.size    = 0;
+      release();
+      reset_sso();
     }
     else
     {
-      detach();
-      storage.heap.data[0] = '\0';
-      storage.heap.size    = 0;
+      set_size(0);
     }
   }
 
@@ -284,36 +379,19 @@ protected:
    */
   void init_from_cstr(const char* str, uint32_t len)
   {
-    if (SSO_THRESHOLD >= len)
-    {
-      if (str && 0 < len)
-      {
-        memcpy(storage.sso.data, str, len);
-        storage.sso.size = static_cast<uint8_t>(len);
-      }
-      else
-      {
-        storage.sso.size = 0;
-      }
+    reset_sso();
 
-      storage.sso.data[len] = '\0';
-      storage.sso.is_sso    = 1;
-    }
-    else
+    if (SSO_THRESHOLD < len && !reallocate(len, false))
     {
-      storage.heap.capacity = QString_Memory_Pool::instance().get_capacity(len + 1);
-      storage.heap.data     = QString_Memory_Pool::instance().allocate(storage.heap.capacity);
-
-      if (str && 0 < len)
-      {
-        memcpy(storage.heap.data, str, len);
-      }
+      return;
+    }
 
-      storage.heap.data[len] = '\0';
-      storage.heap.size      = len;
-      storage.sso.is_sso     = 0;
-      init_ref_count();
+    if (str && 0 < len)
+    {
+      memcpy(const_cast<char*>(data_impl()), str, len);
     }
+
+    set_size(len);
   }
 
   /**
@@ -324,23 +402,15 @@ protected:
    */
   void init_from_fill(uint32_t count, char ch)
   {
-    if (SSO_THRESHOLD >= count)
-    {
-      memset(storage.sso.data, ch, count);
-      storage.sso.data[count] = '\0';
-      storage.sso.size        = static_cast<uint8_t>(count);
-      storage.sso.is_sso      = 1;
-    }
-    else
+    reset_sso();
+
+    if (SSO_THRESHOLD < count && !reallocate(count, false))
     {
-      storage.heap.capacity = QString_Memory_Pool::instance().get_capacity(count + 1);
-      storage.heap.data     = QString_Memory_Pool::instance().allocate(storage.heap.capacity);
-      memset(storage.heap.data, ch, count);
-      storage.heap.data[count] = '\0';
-      storage.heap.size        = count;
-      storage.sso.is_sso       = 0;
-      init_ref_count();
+      return;
     }
+
+    memset(const_cast<char*>(data_impl()), ch, count);
+    set_size(count);
   }
 
   /**
@@ -350,21 +420,8 @@ protected:
    */
   void init_from_copy(const QString_Base& other) noexcept
   {
-    if (other.storage.sso.is_sso)
-    {
-      memcpy(&storage.sso.data[0], &other.storage.sso.data[0], other.storage.sso.size + 1);
-      storage.sso.size   = other.storage.sso.size;
-      storage.sso.is_sso = 1;
-    }
-    else
-    {
-      storage.heap.data      = other.storage.heap.data;
-      storage.heap.size      = other.storage.heap.size;
-      storage.heap.capacity  = other.storage.heap.capacity;
-      storage.heap.ref_count = other.storage.heap.ref_count;
-      storage.sso.is_sso     = 0;
-      add_ref();
-    }
+    storage = other.storage;
+    add_ref();
   }
 
   /**
@@ -374,27 +431,8 @@ protected:
    */
   void init_from_move(QString_Base&& other) noexcept
   {
-    if (other.storage.sso.is_sso)
-    {
-      memcpy(storage.sso.data, other.storage.sso.data, other.storage.sso.size + 1);
-      storage.sso.size          = other.storage.sso.size;
-      storage.sso.is_sso        = 1;
-
-      other.storage.sso.data[0] = '\0';
-      other.storage.sso.size    = 0;
-    }
-    else
-    {
-      storage.heap.data         = other.storage.heap.data;
-      storage.heap.size         = other.storage.heap.size;
-      storage.heap.capacity     = other.storage.heap.capacity;
-      storage.heap.ref_count    = other.storage.heap.ref_count;
-      storage.sso.is_sso        = 0;
-
-      other.storage.sso.data[0] = '\0';
-      other.storage.sso.size    = 0;
-      other.storage.sso.is_sso  = 1;
-    }
+    storage = other.storage;
+    other.reset_sso();
   }
 
   /**
@@ -404,23 +442,7 @@ protected:
    */
   void swap_impl(QString_Base& other) noexcept
   {
-    if (storage.sso.is_sso && other.storage.sso.is_sso)
-    {
-      std::swap(storage.sso, other.storage.sso);
-    }
-    else if (!storage.sso.is_sso && !other.storage.sso.is_sso)
-    {
-      std::swap(storage.heap.data, other.storage.heap.data);
-      std::swap(storage.heap.size, other.storage.heap.size);
-      std::swap(storage.heap.capacity, other.storage.heap.capacity);
-      std::swap(storage.heap.ref_count, other.storage.heap.ref_count);
-    }
-    else
-    {
-      QString_Base temp = std::move(*this);
-      *this             = std::move(other);
-      other             = std::move(temp);
-    }
+    std::swap(storage, other.storage);
   }
 
   /**
@@ -431,20 +453,22 @@ protected:
    */
   void resize_impl(uint32_t new_size, char ch = '\0')
   {
-    if (size_impl() > new_size)
+    uint32_t old_size = size_impl();
+
+    if (old_size > new_size)
     {
-      set_size(new_size);
+      if (detach())
+      {
+        set_size(new_size);
+      }
     }
-    else if (size_impl() < new_size)
+    else if (old_size < new_size)
     {
-      reserve_impl(new_size);
-      detach();
-
-      uint32_t old_size = size_impl();
-      char*    ptr      = storage.sso.is_sso ? storage.sso.data : storage.heap.data;
-
-      memset(ptr + old_size, ch, new_size - old_size);
-      set_size(new_size);
+      if (reserve_impl(new_size))
+      {
+        memset(storage.sso.is_sso ? storage.sso.data + old_size : storage.heap.data + old_size, ch, new_size - old_size);
+        set_size(new_size);
+      }
     }
   }
 
@@ -463,35 +487,37 @@ protected:
   /**
    * @brief  动态字符串基类 追加数据实现
    *
-   * @param  str    要追加的字符串
+   * @param  str    要追加的字符串 (可指向自身数据)
    * @param  count  字符数量
    */
   void append_impl(const char* str, uint32_t count)
   {
     if (0 < count)
     {
-      uint32_t old_size = size_impl();
-      uint32_t new_size = old_size + count;
+      uint32_t    old_size = size_impl();
+      uint32_t    new_size = old_size + count;
+      const char* old_data = data_impl();
+      bool        is_self  = (str >= old_data && str < old_data + old_size);
+      uint32_t    offset   = is_self ? static_cast<uint32_t>(str - old_data) : 0;
 
-      if (capacity_impl() < new_size)
+      if (!prepare_write(new_size))
       {
-        uint32_t new_capacity = calculate_growth_capacity(new_size);
-        reserve_impl(new_capacity);
-      }
-      else
-      {
-        detach();
+        return;
       }
 
-      char* ptr = (storage.sso.is_sso ? storage.sso.data : storage.heap.data) + old_size;
+      char* ptr = storage.sso.is_sso ? storage.sso.data : storage.heap.data;
 
-      if (str)
+      if (is_self)
       {
-        memcpy(ptr, str, count);
+        memcpy(ptr + old_size, ptr + offset, count);
+      }
+      else if (str)
+      {
+        memcpy(ptr + old_size, str, count);
       }
       else
       {
-        memset(ptr, '\0', count);
+        memset(ptr + old_size, '\0', count);
       }
 
       set_size(new_size);
@@ -506,37 +532,27 @@ protected:
    */
   void append_impl(char ch, uint32_t count)
   {
-    if (1 == count)
+    if (0 < count)
     {
-      if (size_impl() < capacity_impl())
-      {
-        detach();
-        (storage.sso.is_sso ? storage.sso.data : storage.heap.data)[size_impl()] = ch;
-      }
-      else
+      uint32_t old_size = size_impl();
+      uint32_t new_size = old_size + count;
+
+      if (!prepare_write(new_size))
       {
-        reserve_impl(calculate_growth_capacity(size_impl() + 1));
-        (storage.sso.is_sso ? storage.sso.data : storage.heap.data)[size_impl()] = ch;
+        return;
       }
 
-      set_size(size_impl() + 1);
-    }
-    else if (1 < count)
-    {
-      uint32_t old_size = size_impl();
-      uint32_t new_size = old_size + count;
+      char* ptr = storage.sso.is_sso ? storage.sso.data : storage.heap.data;
 
-      if (capacity_impl() < new_size)
+      if (1 == count)
       {
-        reserve_impl(calculate_growth_capacity(new_size));
+        ptr[old_size] = ch;
       }
       else
       {
-        detach();
+        memset(ptr + old_size, ch, count);
       }
 
-      char* ptr = (storage.sso.is_sso ? storage.sso.data : storage.heap.data) + old_size;
-      memset(ptr, ch, count);
       set_size(new_size);
     }
   }
@@ -558,14 +574,9 @@ protected:
     uint32_t old_size = size_impl();
     uint32_t new_size = old_size + count;
 
-    if (capacity_impl() < new_size)
+    if (!prepare_write(new_size))
     {
-      uint32_t new_capacity = calculate_growth_capacity(new_size);
-      reserve_impl(new_capacity);
-    }
-    else
-    {
-      detach();
+      return;
     }
 
     char* ptr = storage.sso.is_sso ? storage.sso.data : storage.heap.data;
@@ -596,14 +607,9 @@ protected:
     uint32_t old_size = size_impl();
     uint32_t new_size = old_size + count;
 
-    if (capacity_impl() < new_size)
-    {
-      uint32_t new_capacity = calculate_growth_capacity(new_size);
-      reserve_impl(new_capacity);
-    }
-    else
+    if (!prepare_write(new_size))
     {
-      detach();
+      return;
     }
 
     char* ptr = storage.sso.is_sso ? storage.sso.data : storage.heap.data;
@@ -639,7 +645,11 @@ protected:
     }
 
     count = std::min(count, size_impl() - index);
-    detach();
+
+    if (!detach())
+    {
+      return;
+    }
 
     char*    ptr      = storage.sso.is_sso ? storage.sso.data : storage.heap.data;
     uint32_t new_size = size_impl() - count;
@@ -673,25 +683,33 @@ protected:
     if (capacity_impl() < new_size)
     {
       QString_Base new_string;
-      new_string.reserve_impl(new_size, false);
+
+      if (!new_string.reserve_impl(new_size, false))
+      {
+        return;
+      }
 
       if (pos)
       {
-        new_string.append_impl(storage.sso.is_sso ? storage.sso.data : storage.heap.data, pos);
+        new_string.append_impl(static_cast<const QString_Base*>(this)->data_impl(), pos);
       }
 
       new_string.append_impl(str, str_count);
 
       if (size_impl() > pos + count)
       {
-        new_string.append_impl((storage.sso.is_sso ? storage.sso.data : storage.heap.data) + pos + count, size_impl() - pos - count);
+        new_string.append_impl(static_cast<const QString_Base*>(this)->data_impl() + pos + count, size_impl() - pos - count);
       }
 
       swap_impl(new_string);
     }
     else
     {
-      detach();
+      if (!detach())
+      {
+        return;
+      }
+
       char* dest = storage.sso.is_sso ? storage.sso.data : storage.heap.data;
 
       if (str_count != count)
@@ -710,9 +728,7 @@ public:
    */
   QString_Base() noexcept
   {
-    storage.sso.data[0] = '\0';
-    storage.sso.size    = 0;
-    storage.sso.is_sso  = 1;
+    reset_sso();
   }
 
   /**
@@ -722,16 +738,7 @@ public:
    */
   QString_Base(const char* str)
   {
-    if (str)
-    {
-      init_from_cstr(str, strlen(str));
-    }
-    else
-    {
-      storage.sso.data[0] = '\0';
-      storage.sso.size    = 0;
-      storage.sso.is_sso  = 1;
-    }
+    init_from_cstr(str, str ? strlen(str) : 0);
   }
 
   /**
@@ -781,10 +788,7 @@ public:
    */
   virtual ~QString_Base()
   {
-    if (!storage.sso.is_sso)
-    {
-      release();
-    }
+    release();
   }
 
   /**
@@ -797,12 +801,10 @@ public:
   {
     if (&other != this)
     {
-      if (!storage.sso.is_sso)
-      {
-        release();
-      }
-
-      init_from_copy(other);
+      // 先增加源引用再释放自身，两者共享同一存储时也安全
+      other.add_ref();
+      release();
+      storage = other.storage;
     }
 
     return *this;
@@ -818,11 +820,7 @@ public:
   {
     if (&other != this)
     {
-      if (!storage.sso.is_sso)
-      {
-        release();
-      }
-
+      release();
       init_from_move(std::move(other));
     }
 
@@ -832,6 +830,8 @@ public:
   /**
    * @brief  动态字符串基类 从C字符串赋值
    *
+   * @note   str 可指向自身存储 (如 s = s.c_str() + n)
+   *
    * @param  str  C字符串
    * @return QString_Base&  当前对象引用
    */
@@ -839,28 +839,45 @@ public:
   {
     if (str)
     {
-      uint32_t len = strlen(str);
+      uint32_t    len   = strlen(str);
+      const char* begin = static_cast<const QString_Base*>(this)->data_impl();
+      uintptr_t   addr  = reinterpret_cast<uintptr_t>(str);
+      bool        alias = reinterpret_cast<uintptr_t>(begin) <= addr && addr <= reinterpret_cast<uintptr_t>(begin + capacity_impl());
 
-      if (SSO_THRESHOLD > len)
+      if (SSO_THRESHOLD >= len)
       {
-        if (!storage.sso.is_sso)
+        // 先拷贝至栈上再释放，源可能位于即将释放的堆存储中
+        char buffer[SSO_THRESHOLD];
+        memcpy(buffer, str, len);
+        release();
+        memcpy(storage.sso.data, buffer, len);
+        storage.sso.is_sso = 1;
+        set_size(len);
+      }
+      else if (alias && !is_shared())
+      {
+        // 源位于独占的自身堆存储中，原地移动
+        memmove(storage.heap.data, str, len);
+        set_size(len);
+      }
+      else if (alias)
+      {
+        // 源位于共享的自身堆存储中，先拷贝至新存储再释放引用
+        char* data = heap_allocate(len + 1);
+
+        if (nullptr != data)
         {
+          memcpy(data, str, len);
+          data[len] = '\0';
           release();
+          storage.heap.data = data;
+          storage.heap.size = len;
         }
-
-        memcpy(storage.sso.data, str, len);
-        storage.sso.data[len] = '\0';
-        storage.sso.size      = len;
-        storage.sso.is_sso    = 1;
       }
-      else
+      else if (reserve_impl(len, false))
       {
-        reserve_impl(len, false);
-
         memcpy(storage.heap.data, str, len);
-        storage.heap.data[len] = '\0';
-        storage.heap.size      = len;
-        storage.sso.is_sso     = 0;
+        set_size(len);
       }
     }
     else
@@ -879,22 +896,12 @@ public:
    */
   QString_Base& operator=(char ch)
   {
-    if (storage.sso.is_sso)
-    {
-      storage.sso.data[0] = ch;
-      storage.sso.data[1] = '\0';
-      storage.sso.size    = 1;
-      storage.sso.is_sso  = 1;
-    }
-    else
-    {
-      release();
+    release();
 
-      storage.sso.data[0] = ch;
-      storage.sso.data[1] = '\0';
-      storage.sso.size    = 1;
-      storage.sso.is_sso  = 1;
-    }
+    storage.sso.data[0] = ch;
+    storage.sso.data[1] = '\0';
+    storage.sso.size    = 1;
+    storage.sso.is_sso  = 1;
 
     return *this;
   }
@@ -0,0 +1,376 @@
+#ifndef __QSTRING_BUILDER_HPP__
+#define __QSTRING_BUILDER_HPP__
+
+#include "qstring.hpp"
+
+/// @brief 名称空间 QAQ
+namespace QAQ
+{
+/// @brief 名称空间 容器
+namespace container
+{
+/**
+ * @brief 动态字符串 构建器 (收集片段，统一计算长度后一次分配生成)
+ *
+ * @note  构建器只保存字符串片段的指针，被引用的QString/C字符串需在生成结果前保持有效;
+ *        数值与字符在添加时即格式化至内部缓冲区，无需额外保存
+ *
+ * @tparam Max_Pieces   最大片段数量
+ * @tparam Buffer_Size  数值格式化缓冲区大小
+ */
+template <uint32_t Max_Pieces = 16, uint32_t Buffer_Size = 128>
+class QString_Builder final
+{
+  static_assert(Max_Pieces > 0, "Max_Pieces must be greater than 0");
+  static_assert(Buffer_Size > 0, "Buffer_Size must be greater than 0");
+
+private:
+  /// @brief 字符串片段
+  struct Piece
+  {
+    /// @brief 片段数据指针
+    const char* data;
+    /// @brief 片段长度
+    uint32_t    size;
+  };
+
+  /// @brief 片段表
+  Piece    m_pieces[Max_Pieces];
+  /// @brief 数值格式化缓冲区
+  char     m_buffer[Buffer_Size];
+  /// @brief 片段数量
+  uint32_t m_count;
+  /// @brief 格式化缓冲区已使用长度
+  uint32_t m_buffer_used;
+  /// @brief 总长度
+  uint32_t m_size;
+  /// @brief 是否有片段因容量不足被丢弃
+  bool     m_overflow;
+
+  /**
+   * @brief  动态字符串构建器 添加片段
+   *
+   * @param  data  片段数据指针
+   * @param  size  片段长度
+   */
+  void add_piece(const char* data, uint32_t size) noexcept
+  {
+    if (0 == size)
+    {
+      return;
+    }
+
+    if (Max_Pieces <= m_count)
+    {
+      m_overflow = true;
+      return;
+    }
+
+    m_pieces[m_count].data  = data;
+    m_pieces[m_count].size  = size;
+    m_count                += 1;
+    m_size                 += size;
+  }
+
+  /**
+   * @brief  动态字符串构建器 将数据存入格式化缓冲区并作为片段提交
+   *
+   * @param  data  数据指针
+   * @param  size  数据长度
+   */
+  void commit_buffer(const char* data, uint32_t size) noexcept
+  {
+    if (Buffer_Size - m_buffer_used < size)
+    {
+      m_overflow = true;
+      return;
+    }
+
+    memcpy(m_buffer + m_buffer_used, data, size);
+    add_piece(m_buffer + m_buffer_used, size);
+    m_buffer_used += size;
+  }
+
+  /**
+   * @brief  动态字符串构建器 依次追加所有片段 (目标容量需已预留)
+   *
+   * @param  target  目标字符串
+   */
+  void fill(QString& target) const
+  {
+    for (uint32_t i = 0; i < m_count; ++i)
+    {
+      target.append(m_pieces[i].data, m_pieces[i].size);
+    }
+  }
+
+public:
+  /**
+   * @brief  动态字符串构建器 构造函数
+   */
+  QString_Builder() noexcept : m_count(0), m_buffer_used(0), m_size(0), m_overflow(false) {}
+
+  /**
+   * @brief  动态字符串构建器 析构函数
+   */
+  ~QString_Builder() {}
+
+  NO_COPY(QString_Builder)
+
+  /**
+   * @brief  动态字符串构建器 追加QString对象
+   *
+   * @param  str                要追加的QString对象
+   * @return QString_Builder&   当前对象引用
+   */
+  QString_Builder& append(const QString& str) noexcept
+  {
+    add_piece(str.data(), str.size());
+    return *this;
+  }
+
+  /**
+   * @brief  动态字符串构建器 追加C字符串
+   *
+   * @param  str                要追加的C字符串
+   * @return QString_Builder&   当前对象引用
+   */
+  QString_Builder& append(const char* str) noexcept
+  {
+    if (nullptr != str)
+    {
+      add_piece(str, strlen(str));
+    }
+
+    return *this;
+  }
+
+  /**
+   * @brief  动态字符串构建器 追加指定长度的字符串
+   *
+   * @param  str                要追加的字符串
+   * @param  len                字符串长度
+   * @return QString_Builder&   当前对象引用
+   */
+  QString_Builder& append(const char* str, uint32_t len) noexcept
+  {
+    if (nullptr != str)
+    {
+      add_piece(str, len);
+    }
+
+    return *this;
+  }
+
+  /**
+   * @brief  动态字符串构建器 追加字符
+   *
+   * @param  ch                 要追加的字符
+   * @param  count              字符重复次数，默认为1
+   * @return QString_Builder&   当前对象引用
+   */
+  QString_Builder& append(char ch, uint32_t count = 1) noexcept
+  {
+    if (Buffer_Size - m_buffer_used < count)
+    {
+      m_overflow = true;
+      return *this;
+    }
+
+    memset(m_buffer + m_buffer_used, ch, count);
+    add_piece(m_buffer + m_buffer_used, count);
+    m_buffer_used += count;
+    return *this;
+  }
+
+  /**
+   * @brief  动态字符串构建器 追加整数
+   *
+   * @param  value              要追加的整数值
+   * @param  base               进制基数，默认为10
+   * @param  uppercase          是否使用大写字母，默认为false
+   * @param  add_prefix         是否添加前缀，默认为false
+   * @return QString_Builder&   当前对象引用
+   */
+  template <typename T, typename = std::enable_if_t<std::is_integral<T>::value && !std::is_same<T, char>::value>>
+  QString_Builder& append(T value, int base = 10, bool uppercase = false, bool add_prefix = false) noexcept
+  {
+    char buffer[64];
+    int  result = system::algorithm::Format::format(buffer, sizeof(buffer), value, base, uppercase, add_prefix);
+
+    if (0 < result)
+    {
+      commit_buffer(buffer, static_cast<uint32_t>(result));
+    }
+
+    return *this;
+  }
+
+  /**
+   * @brief  动态字符串构建器 追加浮点数
+   *
+   * @param  value              要追加的浮点数值
+   * @param  precision          精度，默认为6
+   * @param  use_scientific     是否使用科学计数法，默认为false
+   * @return QString_Builder&   当前对象引用
+   */
+  template <typename T, typename = std::enable_if_t<std::is_floating_point<T>::value>>
+  QString_Builder& append(T value, int precision = 6, bool use_scientific = false) noexcept
+  {
+    char buffer[64];
+    int  result = system::algorithm::Format::format(buffer, sizeof(buffer), value, precision, use_scientific);
+
+    if (0 < result)
+    {
+      commit_buffer(buffer, static_cast<uint32_t>(result));
+    }
+
+    return *this;
+  }
+
+  /**
+   * @brief  动态字符串构建器 拼接运算符 (相当于append)
+   *
+   * @param  value              要拼接的内容
+   * @return QString_Builder&   当前对象引用
+   */
+  template <typename T>
+  QString_Builder& operator<<(const T& value) noexcept
+  {
+    return append(value);
+  }
+
+  /**
+   * @brief  动态字符串构建器 拼接运算符 (字符串字面量)
+   *
+   * @param  str                要拼接的字符串字面量
+   * @return QString_Builder&   当前对象引用
+   */
+  template <uint32_t N>
+  QString_Builder& operator<<(const char (&str)[N]) noexcept
+  {
+    return append(str, static_cast<uint32_t>(strnlen(str, N)));
+  }
+
+  /**
+   * @brief  动态字符串构建器 获取最终字符串长度
+   *
+   * @return uint32_t  最终字符串长度
+   */
+  uint32_t size(void) const noexcept
+  {
+    return m_size;
+  }
+
+  /**
+   * @brief  动态字符串构建器 获取片段数量
+   *
+   * @return uint32_t  片段数量
+   */
+  uint32_t count(void) const noexcept
+  {
+    return m_count;
+  }
+
+  /**
+   * @brief  动态字符串构建器 判断是否有片段因容量不足被丢弃
+   *
+   * @return true   有片段被丢弃
+   * @return false  所有片段均已记录
+   */
+  bool is_overflow(void) const noexcept
+  {
+    return m_overflow;
+  }
+
+  /**
+   * @brief  动态字符串构建器 清空所有片段
+   */
+  void clear(void) noexcept
+  {
+    m_count       = 0;
+    m_buffer_used = 0;
+    m_size        = 0;
+    m_overflow    = false;
+  }
+
+  /**
+   * @brief  动态字符串构建器 将所有片段拷贝至缓冲区 (不含结束符)
+   *
+   * @param  buffer     目标缓冲区
+   * @param  buf_size   缓冲区大小
+   * @return uint32_t   实际写入长度
+   */
+  uint32_t copy_to(char* buffer, uint32_t buf_size) const noexcept
+  {
+    uint32_t written = 0;
+
+    for (uint32_t i = 0; i < m_count && written < buf_size; ++i)
+    {
+      uint32_t len = std::min(m_pieces[i].size, buf_size - written);
+      memcpy(buffer + written, m_pieces[i].data, len);
+      written += len;
+    }
+
+    return written;
+  }
+
+  /**
+   * @brief  动态字符串构建器 追加至已有的QString (仅预留一次容量)
+   *
+   * @param  target  目标字符串
+   */
+  void append_to(QString& target) const
+  {
+    if (0 == m_size)
+    {
+      return;
+    }
+
+    const char* begin = static_cast<const QString&>(target).data();
+    const char* end   = begin + target.size();
+
+    for (uint32_t i = 0; i < m_count; ++i)
+    {
+      // 片段引用了目标自身的数据，预留容量可能使其失效，改为构建新字符串后替换
+      if (m_pieces[i].data >= begin && m_pieces[i].data < end)
+      {
+        QString result;
+        result.reserve(target.size() + m_size);
+        result.append(target);
+        fill(result);
+        target = std::move(result);
+        return;
+      }
+    }
+
+    target.reserve(target.size() + m_size);
+    fill(target);
+  }
+
+  /**
+   * @brief  动态字符串构建器 生成QString (按最终长度一次分配)
+   *
+   * @return QString  生成的字符串
+   */
+  QString build(void) const
+  {
+    QString result;
+    append_to(result);
+    return result;
+  }
+
+  /**
+   * @brief  动态字符串构建器 类型转换 转换为QString
+   *
+   * @return QString  生成的字符串
+   */
+  operator QString() const
+  {
+    return build();
+  }
+};
+} /* namespace container */
+} /* namespace QAQ */
+
+#endif /* __QSTRING_BUILDER_HPP__ */
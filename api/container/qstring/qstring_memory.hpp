@@ -11,17 +11,30 @@ namespace container_internal
 {
 namespace qstring_internal
 {
+/**
+ * @brief 动态字符串 堆存储头部 (与字符数据位于同一内存块，数据紧随其后)
+ *
+ */
+struct QString_Heap_Header
+{
+  /// @brief 引用计数 (持有者数量)
+  std::atomic<uint32_t> ref_count;
+  /// @brief 数据区容量 (含结束符)
+  uint32_t              capacity;
+  /// @brief 缓存的哈希值 (0表示未计算)
+  std::atomic<uint32_t> hash;
+};
+
 class QString_Memory_Pool final
 {
 private:
-  system::memory::Struct_Memory_Pool<512, std::atomic<uint32_t>> m_counter_pool;
-  system::memory::Block_Memory_Pool<256, 32>                     m_small_pool;
-  system::memory::Block_Memory_Pool<128, 64>                     m_medium_pool;
-  system::memory::Block_Memory_Pool<64, 128>                     m_large_pool;
-  system::memory::Byte_Memory_Pool<8192>                         m_huge_pool;
+  system::memory::Block_Memory_Pool<256, 32> m_small_pool;
+  system::memory::Block_Memory_Pool<128, 64> m_medium_pool;
+  system::memory::Block_Memory_Pool<64, 128> m_large_pool;
+  system::memory::Byte_Memory_Pool<8192>     m_huge_pool;
 
 protected:
-  explicit QString_Memory_Pool() : m_counter_pool("QString Counter Memory Pool"), m_small_pool("QString Small Memory Pool"), m_medium_pool("QString Medium Memory Pool"), m_large_pool("QString Large Memory Pool"), m_huge_pool("QString Huge Memory Pool") {}
+  explicit QString_Memory_Pool() : m_small_pool("QString Small Memory Pool"), m_medium_pool("QString Medium Memory Pool"), m_large_pool("QString Large Memory Pool"), m_huge_pool("QString Huge Memory Pool") {}
   ~QString_Memory_Pool() {}
 
 public:
@@ -55,11 +68,6 @@ public:
     return static_cast<char*>(ptr);
   }
 
-  std::atomic<uint32_t>* counter_malloc(void)
-  {
-    return m_counter_pool.allocate();
-  }
-
   uint32_t get_capacity(uint32_t size) const
   {
     if (size <= 32)
@@ -102,11 +110,6 @@ public:
       }
     }
   }
-
-  void counter_free(std::atomic<uint32_t>* ptr)
-  {
-    m_counter_pool.deallocate(ptr);
-  }
 };
 } /* namespace qstring_internal */
 } /* namespace container_internal */
@@ -0,0 +1,618 @@
+/**
+ * @file   qstring_test.cpp
+ * @brief  QString 主机测试: 自身别名赋值、多线程引用计数压力测试、静态字符串别名/截断、
+ *         构建器一次分配与拼接基准
+ *
+ * @note   仅用于主机，不参与固件编译 (已加入 eide excludeList);
+ *         ThreadX 内存池由本文件中基于 malloc 的桩函数代替，结束时检查内存池无泄漏
+ *         (内存池析构时若仍有未释放的内存，DEMO_DEBUG 下 log_error 将停止运行)
+ *
+ *         构建 (仓库根目录):
+ *         g++ -std=c++17 -O1 -g -fsanitize=address,undefined -fpermissive -w -pthread \
+ *             $(python3 -c "import json;c=json.load(open('.eide/eide.json'))['targets']['Debug']['custom_dep'];print(' '.join(['-I'+p for p in c['incList']]+['-D'+d for d in c['defineList']]))") \
+ *             api/container/qstring/qstring_test.cpp -o qstring_test && ./qstring_test
+ *         将 address 换为 thread 可使用 ThreadSanitizer 检查引用计数竞争;
+ *         拼接基准的耗时请以不带 sanitizer 的 -O2 构建为准
+ */
+#include "qstring.hpp"
+#include "qstring_builder.hpp"
+#include "static_qstring.hpp"
+
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+using QAQ::container::QString;
+using QAQ::container::QString_Builder;
+using QAQ::container::Static_QString;
+
+namespace
+{
+/// @brief 桩内存池 互斥锁
+std::mutex       g_pool_mutex;
+/// @brief 桩内存池 未释放的分配数
+std::atomic<int> g_outstanding { 0 };
+/// @brief 桩内存池 累计分配次数
+std::atomic<int> g_allocations { 0 };
+/// @brief 失败的检查数
+int              g_failures = 0;
+
+/// @brief 桩内存池 分配头部 (记录所属内存池与大小)
+struct alignas(16) Stub_Header
+{
+  void* pool;
+  ULONG size;
+};
+
+void* stub_allocate(void* pool, ULONG size)
+{
+  Stub_Header* head = static_cast<Stub_Header*>(malloc(sizeof(Stub_Header) + size));
+
+  if (nullptr == head)
+  {
+    return nullptr;
+  }
+
+  head->pool = pool;
+  head->size = size;
+  ++g_outstanding;
+  ++g_allocations;
+  return head + 1;
+}
+
+Stub_Header* stub_header(void* ptr)
+{
+  return static_cast<Stub_Header*>(ptr) - 1;
+}
+
+#define CHECK(cond)                                                  \
+  do                                                                 \
+  {                                                                  \
+    if (!(cond))                                                     \
+    {                                                                \
+      ++g_failures;                                                  \
+      printf("%s:%d: CHECK(%s) failed\n", __FILE__, __LINE__, #cond); \
+    }                                                                \
+  } while (0)
+} /* namespace */
+
+/* ThreadX 内存池桩函数 (线程安全，容量与真实内存池一致) */
+extern "C"
+{
+  ULONG _tx_time_get(VOID)
+  {
+    return 0;
+  }
+
+  UINT _tx_block_pool_create(TX_BLOCK_POOL* pool_ptr, CHAR* name_ptr, ULONG block_size, VOID*, ULONG pool_size)
+  {
+    pool_ptr->tx_block_pool_name       = name_ptr;
+    pool_ptr->tx_block_pool_block_size = static_cast<UINT>(block_size);
+    pool_ptr->tx_block_pool_total      = static_cast<UINT>(pool_size / block_size);
+    pool_ptr->tx_block_pool_available  = pool_ptr->tx_block_pool_total;
+    return TX_SUCCESS;
+  }
+
+  UINT _tx_block_pool_delete(TX_BLOCK_POOL*)
+  {
+    return TX_SUCCESS;
+  }
+
+  UINT _tx_block_pool_info_get(TX_BLOCK_POOL* pool_ptr, CHAR**, ULONG* available_blocks, ULONG* total_blocks, TX_THREAD**, ULONG*, TX_BLOCK_POOL**)
+  {
+    std::lock_guard<std::mutex> lock(g_pool_mutex);
+
+    if (available_blocks)
+    {
+      *available_blocks = pool_ptr->tx_block_pool_available;
+    }
+
+    if (total_blocks)
+    {
+      *total_blocks = pool_ptr->tx_block_pool_total;
+    }
+
+    return TX_SUCCESS;
+  }
+
+  UINT _tx_block_allocate(TX_BLOCK_POOL* pool_ptr, VOID** block_ptr, ULONG)
+  {
+    std::lock_guard<std::mutex> lock(g_pool_mutex);
+
+    if (0 == pool_ptr->tx_block_pool_available)
+    {
+      return TX_NO_MEMORY;
+    }
+
+    *block_ptr = stub_allocate(pool_ptr, pool_ptr->tx_block_pool_block_size);
+
+    if (nullptr == *block_ptr)
+    {
+      return TX_NO_MEMORY;
+    }
+
+    --pool_ptr->tx_block_pool_available;
+    return TX_SUCCESS;
+  }
+
+  UINT _tx_block_release(VOID* block_ptr)
+  {
+    std::lock_guard<std::mutex> lock(g_pool_mutex);
+    Stub_Header*                head = stub_header(block_ptr);
+
+    ++static_cast<TX_BLOCK_POOL*>(head->pool)->tx_block_pool_available;
+    --g_outstanding;
+    free(head);
+    return TX_SUCCESS;
+  }
+
+  UINT _tx_byte_pool_create(TX_BYTE_POOL* pool_ptr, CHAR* name_ptr, VOID*, ULONG pool_size)
+  {
+    pool_ptr->tx_byte_pool_name      = name_ptr;
+    pool_ptr->tx_byte_pool_size      = pool_size;
+    pool_ptr->tx_byte_pool_available = pool_size;
+    return TX_SUCCESS;
+  }
+
+  UINT _tx_byte_pool_delete(TX_BYTE_POOL*)
+  {
+    return TX_SUCCESS;
+  }
+
+  UINT _tx_byte_pool_info_get(TX_BYTE_POOL* pool_ptr, CHAR**, ULONG* available_bytes, ULONG* fragments, TX_THREAD**, ULONG*, TX_BYTE_POOL**)
+  {
+    std::lock_guard<std::mutex> lock(g_pool_mutex);
+
+    if (available_bytes)
+    {
+      *available_bytes = pool_ptr->tx_byte_pool_available;
+    }
+
+    if (fragments)
+    {
+      *fragments = 1;
+    }
+
+    return TX_SUCCESS;
+  }
+
+  UINT _tx_byte_allocate(TX_BYTE_POOL* pool_ptr, VOID** memory_ptr, ULONG memory_size, ULONG)
+  {
+    std::lock_guard<std::mutex> lock(g_pool_mutex);
+
+    if (memory_size > pool_ptr->tx_byte_pool_available)
+    {
+      return TX_NO_MEMORY;
+    }
+
+    *memory_ptr = stub_allocate(pool_ptr, memory_size);
+
+    if (nullptr == *memory_ptr)
+    {
+      return TX_NO_MEMORY;
+    }
+
+    pool_ptr->tx_byte_pool_available -= memory_size;
+    return TX_SUCCESS;
+  }
+
+  UINT _tx_byte_release(VOID* memory_ptr)
+  {
+    std::lock_guard<std::mutex> lock(g_pool_mutex);
+    Stub_Header*                head = stub_header(memory_ptr);
+
+    static_cast<TX_BYTE_POOL*>(head->pool)->tx_byte_pool_available += head->size;
+    --g_outstanding;
+    free(head);
+    return TX_SUCCESS;
+  }
+}
+
+/**
+ * @brief  自身别名赋值: 源指针位于自身 SSO/独占堆/共享堆存储中
+ */
+static void test_self_assign(void)
+{
+  const std::string text = "0123456789abcdefghijklmnopqrstuvwxyz0123456789ABCDEFGHIJ";
+
+  // 独占堆存储 -> 堆 (原地移动，含 s = s.c_str())
+  for (uint32_t offset = 0; offset + 17 <= text.size(); ++offset)
+  {
+    QString s(text.c_str());
+    s = s.c_str() + offset;
+    CHECK(text.substr(offset) == s.c_str());
+    CHECK(text.size() - offset == s.size());
+  }
+
+  // 独占堆存储 -> SSO (源位于即将释放的堆存储中)
+  for (uint32_t offset = text.size() - 16; offset <= text.size(); ++offset)
+  {
+    QString s(text.c_str());
+    s = s.c_str() + offset;
+    CHECK(text.substr(offset) == s.c_str());
+  }
+
+  // 共享堆存储 -> 堆/SSO，其他持有者不受影响
+  for (uint32_t offset = 0; offset <= text.size(); offset += 7)
+  {
+    QString s(text.c_str());
+    QString t = s;
+    s         = s.c_str() + offset;
+    CHECK(text.substr(offset) == s.c_str());
+    CHECK(text == t.c_str());
+  }
+
+  // SSO -> SSO
+  for (uint32_t offset = 0; offset <= 12; ++offset)
+  {
+    QString s("short string");
+    s = s.c_str() + offset;
+    CHECK(std::string("short string").substr(offset) == s.c_str());
+  }
+
+  // 独占堆存储，容量足够的非别名赋值
+  QString s(text.c_str());
+  s = "another string longer than sso";
+  CHECK(std::string("another string longer than sso") == s.c_str());
+}
+
+/**
+ * @brief  多线程引用计数压力测试
+ *
+ * @note   每个 QString 对象仅由一个线程访问，堆存储在线程间共享;
+ *         交换槽在线程间转移对象，使最后一个持有者在任意线程上释放存储
+ */
+static void test_refcount_stress(void)
+{
+  constexpr uint32_t THREADS    = 8;
+  constexpr uint32_t ITERATIONS = 20000;
+  constexpr uint32_t SLOTS      = 16;
+
+  // 三种堆块大小 (小/中/大内存块) 与一个字节池存储
+  const std::string texts[] = {
+    std::string(20, 'a'),
+    std::string(50, 'b'),
+    std::string(100, 'c'),
+    std::string(300, 'd'),
+  };
+
+  {
+    std::vector<QString> sources;
+    for (const std::string& text : texts)
+    {
+      sources.emplace_back(text.c_str());
+    }
+
+    std::mutex           slot_mutex;
+    std::vector<QString> slots(SLOTS);
+    std::atomic<int>     mismatches { 0 };
+    std::vector<std::thread> workers;
+
+    for (uint32_t id = 0; id < THREADS; ++id)
+    {
+      workers.emplace_back([&, id]() {
+        uint32_t seed = 0x9E3779B9u * (id + 1);
+
+        for (uint32_t i = 0; i < ITERATIONS; ++i)
+        {
+          seed               = seed * 1664525u + 1013904223u;
+          uint32_t    which  = (seed >> 8) % 4;
+          std::string expect = texts[which];
+
+          // 共享源存储 (只读访问源对象)
+          QString copy = sources[which];
+
+          if (seed & 0x10000)
+          {
+            // 写时复制: 分离后修改，源不受影响
+            copy += static_cast<char>('0' + id);
+            expect += static_cast<char>('0' + id);
+          }
+
+          if (seed & 0x20000)
+          {
+            // 共享状态下的自身别名赋值
+            QString keep = copy;
+            copy         = copy.c_str() + 3;
+            expect       = expect.substr(3);
+
+            if (keep.size() != expect.size() + 3)
+            {
+              ++mismatches;
+            }
+          }
+
+          if (expect != copy.c_str())
+          {
+            ++mismatches;
+          }
+
+          // 与其他线程交换对象，使存储在另一线程上被释放
+          {
+            std::lock_guard<std::mutex> lock(slot_mutex);
+            std::swap(slots[(seed >> 20) % SLOTS], copy);
+          }
+        }
+      });
+    }
+
+    for (std::thread& worker : workers)
+    {
+      worker.join();
+    }
+
+    CHECK(0 == mismatches.load());
+
+    for (uint32_t i = 0; i < 4; ++i)
+    {
+      CHECK(texts[i] == sources[i].c_str());
+    }
+  }
+
+  CHECK(0 == g_outstanding.load());
+}
+
+/**
+ * @brief  静态字符串 插入/替换的源位于自身存储中 (与 std::string 对比全部组合)
+ */
+static void test_static_alias(void)
+{
+  {
+    Static_QString<32> s("abcdef");
+    s.insert(0, s.data() + 2, 3);
+    CHECK(std::string("cdeabcdef") == s.c_str());
+
+    Static_QString<32> t("abcdef");
+    t.replace(1, 1, t.data() + 2, 3);
+    CHECK(std::string("acdecdef") == t.c_str());
+  }
+
+  const std::string text = "abcdefgh";
+
+  for (uint32_t pos = 0; pos <= text.size(); ++pos)
+  {
+    for (uint32_t count = 0; count <= text.size() - pos; ++count)
+    {
+      for (uint32_t from = 0; from <= text.size(); ++from)
+      {
+        for (uint32_t len = 0; len <= text.size() - from; ++len)
+        {
+          std::string expect = text;
+          expect.replace(pos, count, text.substr(from, len));
+
+          Static_QString<32> s(text.c_str());
+          s.replace(pos, count, s.data() + from, len);
+          CHECK(expect == s.c_str());
+          CHECK(expect.size() == s.size());
+          CHECK(!s.is_truncated());
+        }
+      }
+    }
+  }
+
+  // 容量不足时截断尾部，被截断部分中的源数据不能丢失
+  Static_QString<8> full("abcdefgh");
+  full.insert(0, full.data() + 5, 3);
+  CHECK(std::string("fghabcde") == full.c_str());
+  CHECK(full.is_truncated());
+}
+
+/**
+ * @brief  静态字符串 数值容量不足时整体丢弃并标记截断
+ */
+static void test_static_number(void)
+{
+  Static_QString<8> a;
+  a.append(123456789);
+  CHECK(0 == a.size());
+  CHECK(a.is_truncated());
+
+  Static_QString<8> b("abc");
+  b << 12345;
+  CHECK(std::string("abc12345") == b.c_str());
+  CHECK(!b.is_truncated());
+
+  b << 6;
+  CHECK(std::string("abc12345") == b.c_str());
+  CHECK(b.is_truncated());
+
+  Static_QString<8> c("x=");
+  c.append(3.14159, 6);
+  CHECK(std::string("x=") == c.c_str());
+  CHECK(c.is_truncated());
+
+  Static_QString<8> d("x=");
+  d.append(2.5, 1);
+  CHECK(std::string("x=2.5") == d.c_str());
+  CHECK(!d.is_truncated());
+}
+
+/**
+ * @brief  构建器: 与 operator+ 链结果一致、生成时仅分配一次、追加至已有字符串时仅预留一次、引用自身片段、容量不足
+ */
+static void test_builder(void)
+{
+  const QString device("motor_left");
+  const QString unit(" rpm");
+
+  // 数值在添加时格式化，结果与逐段 operator+ 一致
+  {
+    QString expect = QString("[") + 1234u + "] " + device + ": speed=" + -1500 + unit + ", temp=" + 36.5f + " C";
+
+    QString_Builder<> builder;
+    builder << "[" << 1234u << "] " << device << ": speed=" << -1500 << unit << ", temp=" << 36.5f << " C";
+    CHECK(builder.size() == expect.size() && 10 == builder.count() && !builder.is_overflow());
+
+    const int before = g_allocations.load();
+    QString   result = builder.build();
+    CHECK(1 == g_allocations.load() - before);
+    CHECK(std::string(expect.c_str()) == result.c_str());
+
+    char     buffer[16];
+    uint32_t written = builder.copy_to(buffer, sizeof(buffer));
+    CHECK(sizeof(buffer) == written && 0 == memcmp(buffer, expect.c_str(), written));
+  }
+
+  // 进制、前缀与重复字符
+  {
+    QString_Builder<> builder;
+    builder.append(0xBEEFu, 16, true, true).append(' ').append('-', 3).append(' ').append(255, 2);
+    CHECK(std::string("0XBEEF --- 11111111") == builder.build().c_str());
+  }
+
+  // 结果在 SSO 内时不分配
+  {
+    QString_Builder<> builder;
+    builder << "id=" << 42;
+
+    const int before = g_allocations.load();
+    QString   result = builder.build();
+    CHECK(before == g_allocations.load() && std::string("id=42") == result.c_str());
+  }
+
+  // 追加至已有的堆字符串: 仅预留一次 (原容量不足时分配一次)
+  {
+    QString target("telemetry frame header:");
+
+    QString_Builder<> builder;
+    builder << " seq=" << 7 << " vbus=" << 24.25 << " state=" << device;
+
+    std::string expect = std::string(target.c_str()) + " seq=7 vbus=24.250000 state=motor_left";
+    const int   before = g_allocations.load();
+    builder.append_to(target);
+    CHECK(1 == g_allocations.load() - before);
+    CHECK(expect == target.c_str());
+
+    // 容量已足够时不再分配
+    QString_Builder<> tail;
+    tail << "!";
+    target.reserve(target.size() + 8);
+    const int reserved = g_allocations.load();
+    tail.append_to(target);
+    CHECK(reserved == g_allocations.load() && expect + "!" == target.c_str());
+  }
+
+  // 片段引用目标自身的数据
+  {
+    QString target("self referencing piece ");
+
+    QString_Builder<> builder;
+    builder << target << "+" << target.c_str() + 5;
+    std::string text   = target.c_str();
+    std::string expect = text + text + "+" + text.substr(5);
+    builder.append_to(target);
+    CHECK(expect == target.c_str());
+  }
+
+  // 片段或格式化缓冲区不足: 丢弃并标记，已记录的片段不受影响
+  {
+    QString_Builder<2, 4> builder;
+    builder << "a" << 12345 << "b" << "c";
+    CHECK(builder.is_overflow() && 2 == builder.count());
+    CHECK(std::string("ab") == builder.build().c_str());
+
+    builder.clear();
+    builder << 12 << 34 << 5;
+    CHECK(builder.is_overflow() && std::string("1234") == builder.build().c_str());
+  }
+}
+
+/**
+ * @brief  拼接基准: 典型 4~10 段日志/遥测消息，operator+ 链与构建器的耗时与分配次数
+ */
+static void bench_builder(void)
+{
+  constexpr uint32_t ROUNDS = 100000;
+
+  const QString device("motor_left");
+  const QString unit(" rpm");
+  uint32_t      sink = 0;
+
+  printf("%-8s %14s %14s %14s %14s\n", "pieces", "op+ ns", "op+ allocs", "builder ns", "builder allocs");
+
+  // 按片段数量生成消息，两种实现拼接相同内容
+  auto concat = [&](uint32_t pieces, uint32_t i) -> QString {
+    QString result = QString("[") + i + "] " + device;
+    if (6 <= pieces)
+    {
+      result = result + ": speed=" + static_cast<int>(i & 0xFFF);
+    }
+    if (8 <= pieces)
+    {
+      result = result + unit + ", temp=";
+    }
+    if (10 <= pieces)
+    {
+      result = result + 36.5f + " C";
+    }
+    return result;
+  };
+
+  auto build = [&](uint32_t pieces, uint32_t i) -> QString {
+    QString_Builder<> builder;
+    builder << "[" << i << "] " << device;
+    if (6 <= pieces)
+    {
+      builder << ": speed=" << static_cast<int>(i & 0xFFF);
+    }
+    if (8 <= pieces)
+    {
+      builder << unit << ", temp=";
+    }
+    if (10 <= pieces)
+    {
+      builder << 36.5f << " C";
+    }
+    return builder.build();
+  };
+
+  for (uint32_t pieces = 4; pieces <= 10; pieces += 2)
+  {
+    CHECK(std::string(concat(pieces, 77).c_str()) == build(pieces, 77).c_str());
+
+    int  allocs = g_allocations.load();
+    auto start  = std::chrono::steady_clock::now();
+    for (uint32_t i = 0; i < ROUNDS; ++i)
+    {
+      sink += concat(pieces, i).size();
+    }
+    double concat_ns     = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count() / ROUNDS;
+    double concat_allocs = static_cast<double>(g_allocations.load() - allocs) / ROUNDS;
+
+    allocs = g_allocations.load();
+    start  = std::chrono::steady_clock::now();
+    for (uint32_t i = 0; i < ROUNDS; ++i)
+    {
+      sink += build(pieces, i).size();
+    }
+    double build_ns     = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count() / ROUNDS;
+    double build_allocs = static_cast<double>(g_allocations.load() - allocs) / ROUNDS;
+
+    printf("%-8u %14.1f %14.2f %14.1f %14.2f\n", pieces, concat_ns, concat_allocs, build_ns, build_allocs);
+    CHECK(build_allocs <= 1.0);
+  }
+
+  CHECK(0 != sink);
+}
+
+int main(void)
+{
+  test_static_alias();
+  test_static_number();
+  test_self_assign();
+  test_builder();
+  CHECK(0 == g_outstanding.load());
+
+  test_refcount_stress();
+  bench_builder();
+  CHECK(0 == g_outstanding.load());
+
+  printf("qstring_test: %s (%d failures)\n", 0 == g_failures ? "OK" : "FAILED", g_failures);
+  fflush(stdout);
+  return 0 == g_failures ? 0 : 1;
+}
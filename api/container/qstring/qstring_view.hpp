@@ -0,0 +1,375 @@
+#ifndef __QSTRING_VIEW_HPP__
+#define __QSTRING_VIEW_HPP__
+
+#include "qstring.hpp"
+
+/// @brief 名称空间 QAQ
+namespace QAQ
+{
+/// @brief 名称空间 容器
+namespace container
+{
+/**
+ * @brief 字符串视图 (不持有数据，仅引用外部字符序列)
+ *
+ * @note  被引用的数据需在视图使用期间保持有效且不被修改，视图不保证以'\0'结尾
+ */
+class QString_View final
+{
+private:
+  /// @brief 字符串视图 算法类型
+  using Algorithm = container_internal::qstring_internal::QString_Algorithm;
+
+  /// @brief 数据指针
+  const char* m_data;
+  /// @brief 长度
+  uint32_t    m_size;
+
+public:
+  /// @brief 字符串视图 常量迭代器类型
+  using const_iterator = const char*;
+
+  /**
+   * @brief  字符串视图 默认构造函数
+   */
+  constexpr QString_View() noexcept : m_data(""), m_size(0) {}
+
+  /**
+   * @brief  字符串视图 从C字符串构造
+   *
+   * @param  str  C字符串
+   */
+  QString_View(const char* str) noexcept : m_data(str ? str : ""), m_size(str ? Algorithm::length(str) : 0) {}
+
+  /**
+   * @brief  字符串视图 从指定长度的字符数据构造
+   *
+   * @param  data  字符数据
+   * @param  size  数据长度
+   */
+  constexpr QString_View(const char* data, uint32_t size) noexcept : m_data(data ? data : ""), m_size(data ? size : 0) {}
+
+  /**
+   * @brief  字符串视图 从QString构造
+   *
+   * @param  str  QString对象
+   */
+  QString_View(const QString& str) noexcept : m_data(str.data()), m_size(str.size()) {}
+
+  /**
+   * @brief  字符串视图 迭代器 获取起始迭代器
+   *
+   * @return const_iterator  起始迭代器
+   */
+  constexpr const_iterator begin(void) const noexcept
+  {
+    return m_data;
+  }
+
+  /**
+   * @brief  字符串视图 迭代器 获取结束迭代器
+   *
+   * @return const_iterator  结束迭代器
+   */
+  constexpr const_iterator end(void) const noexcept
+  {
+    return m_data + m_size;
+  }
+
+  /**
+   * @brief  字符串视图 元素访问 获取指定位置字符 (不做边界检查)
+   *
+   * @param  index        位置
+   * @return const char&  字符引用
+   */
+  constexpr const char& operator[](uint32_t index) const noexcept
+  {
+    return m_data[index];
+  }
+
+  /**
+   * @brief  字符串视图 元素访问 获取首字符
+   *
+   * @return const char&  字符引用
+   */
+  constexpr const char& front(void) const noexcept
+  {
+    return m_data[0];
+  }
+
+  /**
+   * @brief  字符串视图 元素访问 获取尾字符
+   *
+   * @return const char&  字符引用
+   */
+  constexpr const char& back(void) const noexcept
+  {
+    return m_data[m_size - 1];
+  }
+
+  /**
+   * @brief  字符串视图 获取数据指针
+   *
+   * @return const char*  数据指针
+   */
+  constexpr const char* data(void) const noexcept
+  {
+    return m_data;
+  }
+
+  /**
+   * @brief  字符串视图 获取长度
+   *
+   * @return uint32_t  长度
+   */
+  constexpr uint32_t size(void) const noexcept
+  {
+    return m_size;
+  }
+
+  /**
+   * @brief  字符串视图 获取长度
+   *
+   * @return uint32_t  长度
+   */
+  constexpr uint32_t length(void) const noexcept
+  {
+    return m_size;
+  }
+
+  /**
+   * @brief  字符串视图 判断是否为空
+   *
+   * @return true   为空
+   * @return false  不为空
+   */
+  constexpr bool empty(void) const noexcept
+  {
+    return 0 == m_size;
+  }
+
+  /**
+   * @brief  字符串视图 移除前缀
+   *
+   * @param  count  移除字符数量
+   */
+  void remove_prefix(uint32_t count) noexcept
+  {
+    count   = std::min(count, m_size);
+    m_data += count;
+    m_size -= count;
+  }
+
+  /**
+   * @brief  字符串视图 移除后缀
+   *
+   * @param  count  移除字符数量
+   */
+  void remove_suffix(uint32_t count) noexcept
+  {
+    m_size -= std::min(count, m_size);
+  }
+
+  /**
+   * @brief  字符串视图 获取子视图
+   *
+   * @param  pos           起始位置，默认为0
+   * @param  count         子视图长度，默认为UINT32_MAX
+   * @return QString_View  子视图
+   */
+  QString_View substr(uint32_t pos = 0, uint32_t count = UINT32_MAX) const noexcept
+  {
+    if (m_size <= pos)
+    {
+      return QString_View();
+    }
+
+    return QString_View(m_data + pos, std::min(count, m_size - pos));
+  }
+
+  /**
+   * @brief  字符串视图 去除首尾空白字符
+   *
+   * @return QString_View  去除空白后的视图
+   */
+  QString_View trimmed(void) const noexcept
+  {
+    uint32_t start = Algorithm::leading_space(m_data, m_size);
+    uint32_t end   = Algorithm::trailing_end(m_data, m_size);
+
+    return (start < end) ? QString_View(m_data + start, end - start) : QString_View();
+  }
+
+  /**
+   * @brief  字符串视图 查找操作 正向查找字符串
+   *
+   * @param  str        要查找的字符串视图
+   * @param  pos        查找起始位置，默认为0
+   * @return uint32_t   找到的位置，未找到返回UINT32_MAX
+   */
+  uint32_t find(QString_View str, uint32_t pos = 0) const noexcept
+  {
+    return Algorithm::find(m_data, m_size, str.m_data, pos, str.m_size);
+  }
+
+  /**
+   * @brief  字符串视图 查找操作 正向查找字符
+   *
+   * @param  ch         要查找的字符
+   * @param  pos        查找起始位置，默认为0
+   * @return uint32_t   找到的位置，未找到返回UINT32_MAX
+   */
+  uint32_t find(char ch, uint32_t pos = 0) const noexcept
+  {
+    return Algorithm::find(m_data, m_size, ch, pos);
+  }
+
+  /**
+   * @brief  字符串视图 查找操作 反向查找字符串
+   *
+   * @param  str        要查找的字符串视图
+   * @param  pos        查找起始位置，默认为UINT32_MAX
+   * @return uint32_t   找到的位置，未找到返回UINT32_MAX
+   */
+  uint32_t rfind(QString_View str, uint32_t pos = UINT32_MAX) const noexcept
+  {
+    return Algorithm::rfind(m_data, m_size, str.m_data, pos, str.m_size);
+  }
+
+  /**
+   * @brief  字符串视图 查找操作 反向查找字符
+   *
+   * @param  ch         要查找的字符
+   * @param  pos        查找起始位置，默认为UINT32_MAX
+   * @return uint32_t   找到的位置，未找到返回UINT32_MAX
+   */
+  uint32_t rfind(char ch, uint32_t pos = UINT32_MAX) const noexcept
+  {
+    return Algorithm::rfind(m_data, m_size, ch, pos);
+  }
+
+  /**
+   * @brief  字符串视图 比较操作
+   *
+   * @param  other  要比较的字符串视图
+   * @return int    比较结果：小于0表示小于，等于0表示相等，大于0表示大于
+   */
+  int compare(QString_View other) const noexcept
+  {
+    return Algorithm::compare(m_data, m_size, other.m_data, other.m_size);
+  }
+
+  /**
+   * @brief  字符串视图 前缀检查
+   *
+   * @param  str   要检查的前缀
+   * @return bool  检查结果
+   */
+  bool starts_with(QString_View str) const noexcept
+  {
+    return Algorithm::starts_with(m_data, m_size, str.m_data, str.m_size);
+  }
+
+  /**
+   * @brief  字符串视图 后缀检查
+   *
+   * @param  str   要检查的后缀
+   * @return bool  检查结果
+   */
+  bool ends_with(QString_View str) const noexcept
+  {
+    return Algorithm::ends_with(m_data, m_size, str.m_data, str.m_size);
+  }
+
+  /**
+   * @brief  字符串视图 获取哈希值
+   *
+   * @return uint32_t  哈希值，与相同内容的QString一致
+   */
+  uint32_t hash(void) const noexcept
+  {
+    return system::algorithm::Hash::hash(m_data, m_size);
+  }
+
+  /**
+   * @brief  字符串视图 转换为数值
+   *
+   * @param  result  解析结果
+   * @param  base    进制基数，默认为10 (浮点数忽略)
+   * @return bool    解析是否成功
+   */
+  template <typename T, typename = std::enable_if_t<std::is_arithmetic<T>::value>>
+  bool parse(T& result, int base = 10) const
+  {
+    if constexpr (std::is_floating_point<T>::value)
+    {
+      return system::algorithm::Parse::parse(m_data, m_size, result);
+    }
+    else
+    {
+      return system::algorithm::Parse::parse(m_data, m_size, result, base);
+    }
+  }
+
+  /**
+   * @brief  字符串视图 拷贝为QString
+   *
+   * @return QString  字符串
+   */
+  QString to_qstring(void) const
+  {
+    return QString(m_data, m_size);
+  }
+
+  /**
+   * @brief  字符串视图 比较操作 等于比较
+   */
+  friend bool operator==(QString_View lhs, QString_View rhs) noexcept
+  {
+    return lhs.m_size == rhs.m_size && 0 == lhs.compare(rhs);
+  }
+
+  /**
+   * @brief  字符串视图 比较操作 不等于比较
+   */
+  friend bool operator!=(QString_View lhs, QString_View rhs) noexcept
+  {
+    return !(lhs == rhs);
+  }
+
+  /**
+   * @brief  字符串视图 比较操作 小于比较
+   */
+  friend bool operator<(QString_View lhs, QString_View rhs) noexcept
+  {
+    return lhs.compare(rhs) < 0;
+  }
+
+  /**
+   * @brief  字符串视图 比较操作 大于比较
+   */
+  friend bool operator>(QString_View lhs, QString_View rhs) noexcept
+  {
+    return lhs.compare(rhs) > 0;
+  }
+
+  /**
+   * @brief  字符串视图 比较操作 小于等于比较
+   */
+  friend bool operator<=(QString_View lhs, QString_View rhs) noexcept
+  {
+    return lhs.compare(rhs) <= 0;
+  }
+
+  /**
+   * @brief  字符串视图 比较操作 大于等于比较
+   */
+  friend bool operator>=(QString_View lhs, QString_View rhs) noexcept
+  {
+    return lhs.compare(rhs) >= 0;
+  }
+};
+} /* namespace container */
+} /* namespace QAQ */
+
+#endif /* __QSTRING_VIEW_HPP__ */
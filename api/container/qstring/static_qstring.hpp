@@ -0,0 +1,1436 @@
+#ifndef __STATIC_QSTRING_HPP__
+#define __STATIC_QSTRING_HPP__
+
+#include "qstring.hpp"
+
+/// @brief 名称空间 QAQ
+namespace QAQ
+{
+/// @brief 名称空间 容器
+namespace container
+{
+/**
+ * @brief 静态字符串 (固定容量，数据完全内联，不使用内存池，可用于中断及DMA缓冲区)
+ *
+ * @note  超出容量的写入会被截断 (数值整体丢弃)，可通过 is_truncated() 查询
+ *
+ * @tparam N  最大字符数量 (不含结束符)
+ */
+template <uint32_t N>
+class Static_QString final
+{
+  static_assert(N > 0, "N must be greater than 0");
+
+  template <uint32_t M>
+  friend class Static_QString;
+
+private:
+  /// @brief 静态字符串 算法类型
+  using Algorithm = container_internal::qstring_internal::QString_Algorithm;
+
+  /// @brief 数据存储区
+  char     m_data[N + 1];
+  /// @brief 长度
+  uint32_t m_size;
+  /// @brief 是否发生过截断
+  bool     m_truncated;
+
+  /**
+   * @brief  静态字符串 追加数据实现
+   *
+   * @param  str    要追加的字符串 (为空时填充'\0')
+   * @param  count  字符数量
+   */
+  void append_impl(const char* str, uint32_t count) noexcept
+  {
+    if (N - m_size < count)
+    {
+      count       = N - m_size;
+      m_truncated = true;
+    }
+
+    if (0 < count)
+    {
+      if (str)
+      {
+        memmove(m_data + m_size, str, count);
+      }
+      else
+      {
+        memset(m_data + m_size, '\0', count);
+      }
+
+      m_size         += count;
+      m_data[m_size]  = '\0';
+    }
+  }
+
+  /**
+   * @brief  静态字符串 追加字符实现
+   *
+   * @param  ch     要追加的字符
+   * @param  count  字符数量
+   */
+  void append_impl(char ch, uint32_t count) noexcept
+  {
+    if (N - m_size < count)
+    {
+      count       = N - m_size;
+      m_truncated = true;
+    }
+
+    if (0 < count)
+    {
+      memset(m_data + m_size, ch, count);
+      m_size         += count;
+      m_data[m_size]  = '\0';
+    }
+  }
+
+  /**
+   * @brief  静态字符串 判断指针是否位于自身存储中
+   *
+   * @param  str   要判断的指针
+   * @return bool  位于自身存储中返回true
+   */
+  bool is_alias(const char* str) const noexcept
+  {
+    uintptr_t address = reinterpret_cast<uintptr_t>(str);
+    uintptr_t begin   = reinterpret_cast<uintptr_t>(m_data);
+
+    return (begin <= address) && (address < begin + sizeof(m_data));
+  }
+
+  /**
+   * @brief  静态字符串 追加数值文本实现 (容量不足时整体丢弃，避免保留残缺的数值)
+   *
+   * @param  str    数值文本
+   * @param  count  字符数量
+   */
+  void append_number_impl(const char* str, uint32_t count) noexcept
+  {
+    if (N - m_size < count)
+    {
+      m_truncated = true;
+      return;
+    }
+
+    append_impl(str, count);
+  }
+
+  /**
+   * @brief  静态字符串 替换数据实现
+   *
+   * @param  pos        替换起始位置
+   * @param  count      替换字符数量
+   * @param  str        新字符串 (为空时填充ch，可位于自身存储中)
+   * @param  ch         填充字符
+   * @param  str_count  新字符串字符数量
+   */
+  void replace_impl(uint32_t pos, uint32_t count, const char* str, char ch, uint32_t str_count) noexcept
+  {
+    if (m_size < pos)
+    {
+      return;
+    }
+
+    // 源位于自身存储中时，移动尾部会覆盖源数据，先复制到临时缓冲区
+    if (nullptr != str && 0 < str_count && is_alias(str))
+    {
+      char buffer[N];
+
+      str_count = std::min(str_count, N);
+      memcpy(buffer, str, str_count);
+      replace_impl(pos, count, buffer, '\0', str_count);
+      return;
+    }
+
+    count           = std::min(count, m_size - pos);
+    uint32_t tail   = m_size - pos - count;
+    uint32_t space  = N - pos;
+
+    if (space < str_count)
+    {
+      str_count   = space;
+      m_truncated = true;
+    }
+
+    if (space - str_count < tail)
+    {
+      tail        = space - str_count;
+      m_truncated = true;
+    }
+
+    memmove(m_data + pos + str_count, m_data + pos + count, tail);
+
+    if (str)
+    {
+      memmove(m_data + pos, str, str_count);
+    }
+    else
+    {
+      memset(m_data + pos, ch, str_count);
+    }
+
+    m_size         = pos + str_count + tail;
+    m_data[m_size] = '\0';
+  }
+
+public:
+  /// @brief 静态字符串 迭代器类型
+  using iterator       = char*;
+  /// @brief 静态字符串 常量迭代器类型
+  using const_iterator = const char*;
+
+  /**
+   * @brief  静态字符串 构造函数 默认构造函数
+   */
+  Static_QString() noexcept : m_size(0), m_truncated(false)
+  {
+    m_data[0] = '\0';
+  }
+
+  /**
+   * @brief  静态字符串 构造函数 从C字符串构造
+   *
+   * @param  str  C字符串指针
+   */
+  Static_QString(const char* str) noexcept : Static_QString()
+  {
+    if (str)
+    {
+      append_impl(str, Algorithm::length(str));
+    }
+  }
+
+  /**
+   * @brief  静态字符串 构造函数 从指定长度的数据构造
+   *
+   * @param  data    数据指针
+   * @param  length  数据长度
+   */
+  Static_QString(const char* data, uint32_t length) noexcept : Static_QString()
+  {
+    append_impl(data, length);
+  }
+
+  /**
+   * @brief  静态字符串 构造函数 从QString构造
+   *
+   * @param  other  源QString对象
+   */
+  Static_QString(const QString& other) noexcept : Static_QString()
+  {
+    append_impl(other.data(), other.size());
+  }
+
+  /**
+   * @brief  静态字符串 构造函数 从其他容量的静态字符串构造
+   *
+   * @param  other  源静态字符串
+   */
+  template <uint32_t M, typename = std::enable_if_t<M != N>>
+  Static_QString(const Static_QString<M>& other) noexcept : Static_QString()
+  {
+    append_impl(other.m_data, other.m_size);
+  }
+
+  /**
+   * @brief  静态字符串 构造函数 从字符构造
+   *
+   * @param  ch     字符
+   * @param  count  字符重复次数，默认为1
+   */
+  Static_QString(char ch, uint32_t count = 1) noexcept : Static_QString()
+  {
+    append_impl(ch, count);
+  }
+
+  /**
+   * @brief  静态字符串 构造函数 从整数构造
+   *
+   * @param  value        整数值
+   * @param  base         进制基数，默认为10
+   * @param  uppercase    是否大写，默认为false
+   * @param  add_prefix   是否添加前缀，默认为false
+   */
+  template <typename T, typename = std::enable_if_t<std::is_integral<T>::value && !std::is_same<T, char>::value>>
+  Static_QString(T value, int base = 10, bool uppercase = false, bool add_prefix = false) noexcept : Static_QString()
+  {
+    append(value, base, uppercase, add_prefix);
+  }
+
+  /**
+   * @brief  静态字符串 构造函数 从浮点数构造
+   *
+   * @param  value            浮点数值
+   * @param  precision        精度，默认为6
+   * @param  use_scientific   是否使用科学计数法，默认不使用
+   */
+  template <typename T, typename = std::enable_if_t<std::is_floating_point<T>::value>>
+  Static_QString(T value, int precision = 6, bool use_scientific = false) noexcept : Static_QString()
+  {
+    append(value, precision, use_scientific);
+  }
+
+  /**
+   * @brief  静态字符串 赋值运算符 从C字符串赋值
+   *
+   * @param  str                C字符串指针
+   * @return Static_QString&    当前对象引用
+   */
+  Static_QString& operator=(const char* str) noexcept
+  {
+    clear();
+
+    if (str)
+    {
+      append_impl(str, Algorithm::length(str));
+    }
+
+    return *this;
+  }
+
+  /**
+   * @brief  静态字符串 赋值运算符 从QString赋值
+   *
+   * @param  other              源QString对象
+   * @return Static_QString&    当前对象引用
+   */
+  Static_QString& operator=(const QString& other) noexcept
+  {
+    clear();
+    append_impl(other.data(), other.size());
+    return *this;
+  }
+
+  /**
+   * @brief  静态字符串 赋值运算符 从字符赋值
+   *
+   * @param  ch                 字符
+   * @return Static_QString&    当前对象引用
+   */
+  Static_QString& operator=(char ch) noexcept
+  {
+    clear();
+    append_impl(ch, 1);
+    return *this;
+  }
+
+  /**
+   * @brief  静态字符串 迭代器 获取起始迭代器
+   *
+   * @return iterator  起始迭代器
+   */
+  iterator begin(void) noexcept
+  {
+    return m_data;
+  }
+
+  /**
+   * @brief  静态字符串 迭代器 获取结束迭代器
+   *
+   * @return iterator  结束迭代器
+   */
+  iterator end(void) noexcept
+  {
+    return m_data + m_size;
+  }
+
+  /**
+   * @brief  静态字符串 迭代器 获取起始常量迭代器
+   *
+   * @return const_iterator  起始常量迭代器
+   */
+  const_iterator begin(void) const noexcept
+  {
+    return m_data;
+  }
+
+  /**
+   * @brief  静态字符串 迭代器 获取结束常量迭代器
+   *
+   * @return const_iterator  结束常量迭代器
+   */
+  const_iterator end(void) const noexcept
+  {
+    return m_data + m_size;
+  }
+
+  /**
+   * @brief  静态字符串 迭代器 获取起始常量迭代器
+   *
+   * @return const_iterator  起始常量迭代器
+   */
+  const_iterator cbegin(void) const noexcept
+  {
+    return m_data;
+  }
+
+  /**
+   * @brief  静态字符串 迭代器 获取结束常量迭代器
+   *
+   * @return const_iterator  结束常量迭代器
+   */
+  const_iterator cend(void) const noexcept
+  {
+    return m_data + m_size;
+  }
+
+  /**
+   * @brief  静态字符串 元素访问 通过索引访问字符
+   *
+   * @param  index  索引位置 (越界时返回结束符)
+   * @return char&  索引位置的字符引用
+   */
+  char& operator[](uint32_t index) noexcept
+  {
+    return m_data[index < m_size ? index : m_size];
+  }
+
+  /**
+   * @brief  静态字符串 元素访问 通过索引访问常量字符
+   *
+   * @param  index        索引位置 (越界时返回结束符)
+   * @return const char&  索引位置的常量字符引用
+   */
+  const char& operator[](uint32_t index) const noexcept
+  {
+    return m_data[index < m_size ? index : m_size];
+  }
+
+  /**
+   * @brief  静态字符串 元素访问 通过索引访问字符（安全版本）
+   *
+   * @param  index  索引位置
+   * @return char&  索引位置的字符引用
+   */
+  char& at(uint32_t index) noexcept
+  {
+    return operator[](index);
+  }
+
+  /**
+   * @brief  静态字符串 元素访问 通过索引访问常量字符（安全版本）
+   *
+   * @param  index        索引位置
+   * @return const char&  索引位置的常量字符引用
+   */
+  const char& at(uint32_t index) const noexcept
+  {
+    return operator[](index);
+  }
+
+  /**
+   * @brief  静态字符串 元素访问 获取第一个字符
+   *
+   * @return char&  第一个字符的引用
+   */
+  char& front(void) noexcept
+  {
+    return m_data[0];
+  }
+
+  /**
+   * @brief  静态字符串 元素访问 获取第一个常量字符
+   *
+   * @return const char&  第一个常量字符的引用
+   */
+  const char& front(void) const noexcept
+  {
+    return m_data[0];
+  }
+
+  /**
+   * @brief  静态字符串 元素访问 获取最后一个字符
+   *
+   * @return char&  最后一个字符的引用 (空字符串时为结束符)
+   */
+  char& back(void) noexcept
+  {
+    return m_data[0 != m_size ? m_size - 1 : 0];
+  }
+
+  /**
+   * @brief  静态字符串 元素访问 获取最后一个常量字符
+   *
+   * @return const char&  最后一个常量字符的引用 (空字符串时为结束符)
+   */
+  const char& back(void) const noexcept
+  {
+    return m_data[0 != m_size ? m_size - 1 : 0];
+  }
+
+  /**
+   * @brief  静态字符串 容量 获取字符串大小
+   *
+   * @return uint32_t  字符串大小
+   */
+  uint32_t size(void) const noexcept
+  {
+    return m_size;
+  }
+
+  /**
+   * @brief  静态字符串 容量 获取字符串长度
+   *
+   * @return uint32_t  字符串长度
+   */
+  uint32_t length(void) const noexcept
+  {
+    return m_size;
+  }
+
+  /**
+   * @brief  静态字符串 容量 获取字符串容量
+   *
+   * @return uint32_t  字符串容量
+   */
+  static constexpr uint32_t capacity(void) noexcept
+  {
+    return N;
+  }
+
+  /**
+   * @brief  静态字符串 容量 判断字符串是否为空
+   *
+   * @return true   字符串为空
+   * @return false  字符串不为空
+   */
+  bool empty(void) const noexcept
+  {
+    return 0 == m_size;
+  }
+
+  /**
+   * @brief  静态字符串 容量 判断字符串是否已满
+   *
+   * @return true   字符串已满
+   * @return false  字符串未满
+   */
+  bool full(void) const noexcept
+  {
+    return N == m_size;
+  }
+
+  /**
+   * @brief  静态字符串 容量 判断是否发生过截断
+   *
+   * @return true   发生过截断
+   * @return false  未发生截断
+   */
+  bool is_truncated(void) const noexcept
+  {
+    return m_truncated;
+  }
+
+  /**
+   * @brief  静态字符串 修改器 清空字符串 (同时清除截断标志)
+   */
+  void clear(void) noexcept
+  {
+    m_size      = 0;
+    m_data[0]   = '\0';
+    m_truncated = false;
+  }
+
+  /**
+   * @brief  静态字符串 修改器 调整字符串大小并用指定字符填充
+   *
+   * @param  new_size  新的大小
+   * @param  ch        填充字符，默认为'\0'
+   */
+  void resize(uint32_t new_size, char ch = '\0') noexcept
+  {
+    if (m_size >= new_size)
+    {
+      m_size         = new_size;
+      m_data[m_size] = '\0';
+    }
+    else
+    {
+      append_impl(ch, new_size - m_size);
+    }
+  }
+
+  /**
+   * @brief  静态字符串 修改器 在末尾添加字符
+   *
+   * @param  ch  要添加的字符
+   */
+  void push_back(char ch) noexcept
+  {
+    append_impl(ch, 1);
+  }
+
+  /**
+   * @brief  静态字符串 修改器 删除末尾字符
+   */
+  void pop_back(void) noexcept
+  {
+    if (0 < m_size)
+    {
+      m_data[--m_size] = '\0';
+    }
+  }
+
+  /**
+   * @brief  静态字符串 修改器 追加QString对象
+   *
+   * @param  other              要追加的QString对象
+   * @return Static_QString&    当前对象引用
+   */
+  Static_QString& append(const QString& other) noexcept
+  {
+    append_impl(other.data(), other.size());
+    return *this;
+  }
+
+  /**
+   * @brief  静态字符串 修改器 追加静态字符串
+   *
+   * @param  other              要追加的静态字符串
+   * @return Static_QString&    当前对象引用
+   */
+  template <uint32_t M>
+  Static_QString& append(const Static_QString<M>& other) noexcept
+  {
+    append_impl(other.m_data, other.m_size);
+    return *this;
+  }
+
+  /**
+   * @brief  静态字符串 修改器 追加C字符串
+   *
+   * @param  str                要追加的C字符串
+   * @return Static_QString&    当前对象引用
+   */
+  Static_QString& append(const char* str) noexcept
+  {
+    if (str)
+    {
+      append_impl(str, Algorithm::length(str));
+    }
+
+    return *this;
+  }
+
+  /**
+   * @brief  静态字符串 修改器 追加指定长度的字符串
+   *
+   * @param  str                要追加的字符串
+   * @param  len                字符串长度
+   * @return Static_QString&    当前对象引用
+   */
+  Static_QString& append(const char* str, uint32_t len) noexcept
+  {
+    append_impl(str, len);
+    return *this;
+  }
+
+  /**
+   * @brief  静态字符串 修改器 追加字符
+   *
+   * @param  ch                 要追加的字符
+   * @param  count              字符重复次数，默认为1
+   * @return Static_QString&    当前对象引用
+   */
+  Static_QString& append(char ch, uint32_t count = 1) noexcept
+  {
+    append_impl(ch, count);
+    return *this;
+  }
+
+  /**
+   * @brief  静态字符串 修改器 追加整数
+   *
+   * @param  value              要追加的整数值
+   * @param  base               进制基数，默认为10
+   * @param  uppercase          是否使用大写字母，默认为false
+   * @param  add_prefix         是否添加前缀，默认为false
+   * @return Static_QString&    当前对象引用
+   */
+  template <typename T, typename = std::enable_if_t<std::is_integral<T>::value && !std::is_same<T, char>::value>>
+  Static_QString& append(T value, int base = 10, bool uppercase = false, bool add_prefix = false) noexcept
+  {
+    char buffer[64];
+    int  result = system::algorithm::Format::format(buffer, sizeof(buffer), value, base, uppercase, add_prefix);
+
+    if (0 < result)
+    {
+      append_number_impl(buffer, static_cast<uint32_t>(result));
+    }
+
+    return *this;
+  }
+
+  /**
+   * @brief  静态字符串 修改器 追加浮点数
+   *
+   * @param  value              要追加的浮点数值
+   * @param  precision          精度，默认为6
+   * @param  use_scientific     是否使用科学计数法，默认为false
+   * @return Static_QString&    当前对象引用
+   */
+  template <typename T, typename = std::enable_if_t<std::is_floating_point<T>::value>>
+  Static_QString& append(T value, int precision = 6, bool use_scientific = false) noexcept
+  {
+    char buffer[64];
+    int  result = system::algorithm::Format::format(buffer, sizeof(buffer), value, precision, use_scientific);
+
+    if (0 < result)
+    {
+      append_number_impl(buffer, static_cast<uint32_t>(result));
+    }
+
+    return *this;
+  }
+
+  /**
+   * @brief  静态字符串 修改器 追加（+=运算符）
+   *
+   * @param  value              要追加的内容
+   * @return Static_QString&    当前对象引用
+   */
+  template <typename T>
+  Static_QString& operator+=(const T& value) noexcept
+  {
+    return append(value);
+  }
+
+  /**
+   * @brief  静态字符串 拼接运算符 字符串左移拼接（相当于+=）
+   *
+   * @param  value              要拼接的内容
+   * @return Static_QString&    当前对象引用
+   */
+  template <typename T>
+  Static_QString& operator<<(const T& value) noexcept
+  {
+    return append(value);
+  }
+
+  /**
+   * @brief  静态字符串 修改器 在指定位置插入指定长度的字符串
+   *
+   * @param  index              插入位置
+   * @param  str                要插入的字符串
+   * @param  len                字符串长度
+   * @return Static_QString&    当前对象引用
+   */
+  Static_QString& insert(uint32_t index, const char* str, uint32_t len) noexcept
+  {
+    if (nullptr != str)
+    {
+      replace_impl(index, 0, str, '\0', len);
+    }
+
+    return *this;
+  }
+
+  /**
+   * @brief  静态字符串 修改器 在指定位置插入C字符串
+   *
+   * @param  index              插入位置
+   * @param  str                要插入的C字符串
+   * @return Static_QString&    当前对象引用
+   */
+  Static_QString& insert(uint32_t index, const char* str) noexcept
+  {
+    return (nullptr != str) ? insert(index, str, Algorithm::length(str)) : *this;
+  }
+
+  /**
+   * @brief  静态字符串 修改器 在指定位置插入QString对象
+   *
+   * @param  index              插入位置
+   * @param  other              要插入的QString对象
+   * @return Static_QString&    当前对象引用
+   */
+  Static_QString& insert(uint32_t index, const QString& other) noexcept
+  {
+    return insert(index, other.data(), other.size());
+  }
+
+  /**
+   * @brief  静态字符串 修改器 在指定位置插入字符
+   *
+   * @param  index              插入位置
+   * @param  ch                 要插入的字符
+   * @param  count              字符重复次数，默认为1
+   * @return Static_QString&    当前对象引用
+   */
+  Static_QString& insert(uint32_t index, char ch, uint32_t count = 1) noexcept
+  {
+    replace_impl(index, 0, nullptr, ch, count);
+    return *this;
+  }
+
+  /**
+   * @brief  静态字符串 修改器 删除指定位置的字符
+   *
+   * @param  index              删除起始位置，默认为0
+   * @param  count              删除字符数量，默认为UINT32_MAX
+   * @return Static_QString&    当前对象引用
+   */
+  Static_QString& erase(uint32_t index = 0, uint32_t count = UINT32_MAX) noexcept
+  {
+    if (index < m_size)
+    {
+      replace_impl(index, count, "", '\0', 0);
+    }
+
+    return *this;
+  }
+
+  /**
+   * @brief  静态字符串 修改器 替换指定位置的子串为指定长度的字符串
+   *
+   * @param  index              替换起始位置
+   * @param  count              被替换字符数量
+   * @param  str                替换的字符串
+   * @param  length             字符串长度
+   * @return Static_QString&    当前对象引用
+   */
+  Static_QString& replace(uint32_t index, uint32_t count, const char* str, uint32_t length) noexcept
+  {
+    if (nullptr != str)
+    {
+      replace_impl(index, count, str, '\0', length);
+    }
+
+    return *this;
+  }
+
+  /**
+   * @brief  静态字符串 修改器 替换指定位置的子串为C字符串
+   *
+   * @param  index              替换起始位置
+   * @param  count              被替换字符数量
+   * @param  str                替换的C字符串
+   * @return Static_QString&    当前对象引用
+   */
+  Static_QString& replace(uint32_t index, uint32_t count, const char* str) noexcept
+  {
+    return (nullptr != str) ? replace(index, count, str, Algorithm::length(str)) : *this;
+  }
+
+  /**
+   * @brief  静态字符串 修改器 替换指定位置的子串为QString对象
+   *
+   * @param  index              替换起始位置
+   * @param  count              被替换字符数量
+   * @param  other              替换的QString对象
+   * @return Static_QString&    当前对象引用
+   */
+  Static_QString& replace(uint32_t index, uint32_t count, const QString& other) noexcept
+  {
+    return replace(index, count, other.data(), other.size());
+  }
+
+  /**
+   * @brief  静态字符串 字符串操作 获取C风格字符串
+   *
+   * @return const char*  C风格字符串指针
+   */
+  const char* c_str(void) const noexcept
+  {
+    return m_data;
+  }
+
+  /**
+   * @brief  静态字符串 字符串操作 获取数据指针（常量版本）
+   *
+   * @return const char*  数据指针
+   */
+  const char* data(void) const noexcept
+  {
+    return m_data;
+  }
+
+  /**
+   * @brief  静态字符串 字符串操作 获取数据指针
+   *
+   * @return char*  数据指针
+   */
+  char* data(void) noexcept
+  {
+    return m_data;
+  }
+
+  /**
+   * @brief  静态字符串 字符串操作 获取子字符串
+   *
+   * @param  pos              起始位置，默认为0
+   * @param  count            子字符串长度，默认为UINT32_MAX
+   * @return Static_QString   子字符串
+   */
+  Static_QString substr(uint32_t pos = 0, uint32_t count = UINT32_MAX) const noexcept
+  {
+    if (m_size <= pos)
+    {
+      return Static_QString();
+    }
+
+    return Static_QString(m_data + pos, std::min(count, m_size - pos));
+  }
+
+  /**
+   * @brief  静态字符串 类型转换 转换为QString
+   *
+   * @return QString  转换后的QString
+   */
+  QString to_qstring(void) const
+  {
+    return QString(m_data, m_size);
+  }
+
+  /**
+   * @brief  静态字符串 类型转换 隐式转换为QString
+   *
+   * @return QString  转换后的QString
+   */
+  operator QString() const
+  {
+    return QString(m_data, m_size);
+  }
+
+  /**
+   * @brief  静态字符串 查找操作 正向查找指定长度的字符串
+   *
+   * @param  str        要查找的字符串
+   * @param  pos        查找起始位置
+   * @param  count      字符串长度
+   * @return uint32_t   找到的位置，未找到返回UINT32_MAX
+   */
+  uint32_t find(const char* str, uint32_t pos, uint32_t count) const noexcept
+  {
+    return Algorithm::find(m_data, m_size, str, pos, count);
+  }
+
+  /**
+   * @brief  静态字符串 查找操作 正向查找C字符串
+   *
+   * @param  str        要查找的C字符串
+   * @param  pos        查找起始位置，默认为0
+   * @return uint32_t   找到的位置，未找到返回UINT32_MAX
+   */
+  uint32_t find(const char* str, uint32_t pos = 0) const noexcept
+  {
+    return (nullptr != str) ? Algorithm::find(m_data, m_size, str, pos, Algorithm::length(str)) : UINT32_MAX;
+  }
+
+  /**
+   * @brief  静态字符串 查找操作 正向查找QString对象
+   *
+   * @param  other      要查找的QString对象
+   * @param  pos        查找起始位置，默认为0
+   * @return uint32_t   找到的位置，未找到返回UINT32_MAX
+   */
+  uint32_t find(const QString& other, uint32_t pos = 0) const noexcept
+  {
+    return Algorithm::find(m_data, m_size, other.data(), pos, other.size());
+  }
+
+  /**
+   * @brief  静态字符串 查找操作 正向查找字符
+   *
+   * @param  ch         要查找的字符
+   * @param  pos        查找起始位置，默认为0
+   * @return uint32_t   找到的位置，未找到返回UINT32_MAX
+   */
+  uint32_t find(char ch, uint32_t pos = 0) const noexcept
+  {
+    return Algorithm::find(m_data, m_size, ch, pos);
+  }
+
+  /**
+   * @brief  静态字符串 查找操作 反向查找指定长度的字符串
+   *
+   * @param  str        要查找的字符串
+   * @param  pos        查找起始位置
+   * @param  count      字符串长度
+   * @return uint32_t   找到的位置，未找到返回UINT32_MAX
+   */
+  uint32_t rfind(const char* str, uint32_t pos, uint32_t count) const noexcept
+  {
+    return Algorithm::rfind(m_data, m_size, str, pos, count);
+  }
+
+  /**
+   * @brief  静态字符串 查找操作 反向查找C字符串
+   *
+   * @param  str        要查找的C字符串
+   * @param  pos        查找起始位置，默认为UINT32_MAX
+   * @return uint32_t   找到的位置，未找到返回UINT32_MAX
+   */
+  uint32_t rfind(const char* str, uint32_t pos = UINT32_MAX) const noexcept
+  {
+    return (nullptr != str) ? Algorithm::rfind(m_data, m_size, str, pos, Algorithm::length(str)) : UINT32_MAX;
+  }
+
+  /**
+   * @brief  静态字符串 查找操作 反向查找字符
+   *
+   * @param  ch         要查找的字符
+   * @param  pos        查找起始位置，默认为UINT32_MAX
+   * @return uint32_t   找到的位置，未找到返回UINT32_MAX
+   */
+  uint32_t rfind(char ch, uint32_t pos = UINT32_MAX) const noexcept
+  {
+    return Algorithm::rfind(m_data, m_size, ch, pos);
+  }
+
+  /**
+   * @brief  静态字符串 比较操作 与指定长度字符串比较
+   *
+   * @param  str    要比较的字符串
+   * @param  len    字符串长度
+   * @return int    比较结果：小于0表示小于，等于0表示相等，大于0表示大于
+   */
+  int compare(const char* str, uint32_t len) const noexcept
+  {
+    return Algorithm::compare(m_data, m_size, str, len);
+  }
+
+  /**
+   * @brief  静态字符串 比较操作 与C字符串比较
+   *
+   * @param  str  要比较的C字符串
+   * @return int  比较结果：小于0表示小于，等于0表示相等，大于0表示大于
+   */
+  int compare(const char* str) const noexcept
+  {
+    return (nullptr != str) ? compare(str, Algorithm::length(str)) : -1;
+  }
+
+  /**
+   * @brief  静态字符串 比较操作 与QString对象比较
+   *
+   * @param  other  要比较的QString对象
+   * @return int    比较结果：小于0表示小于，等于0表示相等，大于0表示大于
+   */
+  int compare(const QString& other) const noexcept
+  {
+    return compare(other.data(), other.size());
+  }
+
+  /**
+   * @brief  静态字符串 比较操作 与静态字符串比较
+   *
+   * @param  other  要比较的静态字符串
+   * @return int    比较结果：小于0表示小于，等于0表示相等，大于0表示大于
+   */
+  template <uint32_t M>
+  int compare(const Static_QString<M>& other) const noexcept
+  {
+    return compare(other.m_data, other.m_size);
+  }
+
+  /**
+   * @brief  静态字符串 比较操作 等于比较
+   *
+   * @param  other  要比较的对象
+   * @return bool   比较结果
+   */
+  template <typename T>
+  bool operator==(const T& other) const noexcept
+  {
+    return compare(other) == 0;
+  }
+
+  /**
+   * @brief  静态字符串 比较操作 不等于比较
+   *
+   * @param  other  要比较的对象
+   * @return bool   比较结果
+   */
+  template <typename T>
+  bool operator!=(const T& other) const noexcept
+  {
+    return compare(other) != 0;
+  }
+
+  /**
+   * @brief  静态字符串 比较操作 小于比较
+   *
+   * @param  other  要比较的对象
+   * @return bool   比较结果
+   */
+  template <typename T>
+  bool operator<(const T& other) const noexcept
+  {
+    return compare(other) < 0;
+  }
+
+  /**
+   * @brief  静态字符串 比较操作 大于比较
+   *
+   * @param  other  要比较的对象
+   * @return bool   比较结果
+   */
+  template <typename T>
+  bool operator>(const T& other) const noexcept
+  {
+    return compare(other) > 0;
+  }
+
+  /**
+   * @brief  静态字符串 比较操作 小于等于比较
+   *
+   * @param  other  要比较的对象
+   * @return bool   比较结果
+   */
+  template <typename T>
+  bool operator<=(const T& other) const noexcept
+  {
+    return compare(other) <= 0;
+  }
+
+  /**
+   * @brief  静态字符串 比较操作 大于等于比较
+   *
+   * @param  other  要比较的对象
+   * @return bool   比较结果
+   */
+  template <typename T>
+  bool operator>=(const T& other) const noexcept
+  {
+    return compare(other) >= 0;
+  }
+
+  /**
+   * @brief  静态字符串 大小写转换 转换为小写
+   *
+   * @return Static_QString&  当前对象引用
+   */
+  Static_QString& to_lower(void) noexcept
+  {
+    Algorithm::to_lower(m_data, m_size);
+    return *this;
+  }
+
+  /**
+   * @brief  静态字符串 大小写转换 转换为大写
+   *
+   * @return Static_QString&  当前对象引用
+   */
+  Static_QString& to_upper(void) noexcept
+  {
+    Algorithm::to_upper(m_data, m_size);
+    return *this;
+  }
+
+  /**
+   * @brief  静态字符串 前缀后缀检查 检查是否以指定长度字符串开头
+   *
+   * @param  str  要检查的字符串
+   * @param  len  字符串长度
+   * @return bool 检查结果
+   */
+  bool starts_with(const char* str, uint32_t len) const noexcept
+  {
+    return nullptr != str && 0 != len && Algorithm::starts_with(m_data, m_size, str, len);
+  }
+
+  /**
+   * @brief  静态字符串 前缀后缀检查 检查是否以C字符串开头
+   *
+   * @param  str  要检查的C字符串
+   * @return bool 检查结果
+   */
+  bool starts_with(const char* str) const noexcept
+  {
+    return nullptr != str && Algorithm::starts_with(m_data, m_size, str, Algorithm::length(str));
+  }
+
+  /**
+   * @brief  静态字符串 前缀后缀检查 检查是否以字符开头
+   *
+   * @param  ch   要检查的字符
+   * @return bool 检查结果
+   */
+  bool starts_with(char ch) const noexcept
+  {
+    return 0 != m_size && m_data[0] == ch;
+  }
+
+  /**
+   * @brief  静态字符串 前缀后缀检查 检查是否以指定长度字符串结尾
+   *
+   * @param  str  要检查的字符串
+   * @param  len  字符串长度
+   * @return bool 检查结果
+   */
+  bool ends_with(const char* str, uint32_t len) const noexcept
+  {
+    return nullptr != str && 0 != len && Algorithm::ends_with(m_data, m_size, str, len);
+  }
+
+  /**
+   * @brief  静态字符串 前缀后缀检查 检查是否以C字符串结尾
+   *
+   * @param  str  要检查的C字符串
+   * @return bool 检查结果
+   */
+  bool ends_with(const char* str) const noexcept
+  {
+    return nullptr != str && Algorithm::ends_with(m_data, m_size, str, Algorithm::length(str));
+  }
+
+  /**
+   * @brief  静态字符串 前缀后缀检查 检查是否以字符结尾
+   *
+   * @param  ch   要检查的字符
+   * @return bool 检查结果
+   */
+  bool ends_with(char ch) const noexcept
+  {
+    return 0 != m_size && m_data[m_size - 1] == ch;
+  }
+
+  /**
+   * @brief  静态字符串 统计操作 统计字符出现次数
+   *
+   * @param  ch         要统计的字符
+   * @return uint32_t   字符出现次数
+   */
+  uint32_t count(char ch) const noexcept
+  {
+    return Algorithm::count(m_data, m_size, ch);
+  }
+
+  /**
+   * @brief  静态字符串 统计操作 统计C字符串出现次数
+   *
+   * @param  str        要统计的C字符串
+   * @return uint32_t   C字符串出现次数
+   */
+  uint32_t count(const char* str) const noexcept
+  {
+    return (nullptr != str) ? Algorithm::count(m_data, m_size, str, Algorithm::length(str)) : 0;
+  }
+
+  /**
+   * @brief  静态字符串 格式化操作 左侧填充
+   *
+   * @param  total_width      总宽度
+   * @param  pad_char         填充字符，默认为空格
+   * @return Static_QString&  当前对象引用
+   */
+  Static_QString& pad_left(uint32_t total_width, char pad_char = ' ') noexcept
+  {
+    if (m_size < total_width)
+    {
+      insert(0, pad_char, total_width - m_size);
+    }
+
+    return *this;
+  }
+
+  /**
+   * @brief  静态字符串 格式化操作 右侧填充
+   *
+   * @param  total_width      总宽度
+   * @param  pad_char         填充字符，默认为空格
+   * @return Static_QString&  当前对象引用
+   */
+  Static_QString& pad_right(uint32_t total_width, char pad_char = ' ') noexcept
+  {
+    if (m_size < total_width)
+    {
+      append_impl(pad_char, total_width - m_size);
+    }
+
+    return *this;
+  }
+
+  /**
+   * @brief  静态字符串 格式化操作 去除首尾空白
+   *
+   * @return Static_QString&  当前对象引用
+   */
+  Static_QString& trim(void) noexcept
+  {
+    return trim_left().trim_right();
+  }
+
+  /**
+   * @brief  静态字符串 格式化操作 去除左侧空白
+   *
+   * @return Static_QString&  当前对象引用
+   */
+  Static_QString& trim_left(void) noexcept
+  {
+    uint32_t start = Algorithm::leading_space(m_data, m_size);
+
+    if (0 < start)
+    {
+      erase(0, start);
+    }
+
+    return *this;
+  }
+
+  /**
+   * @brief  静态字符串 格式化操作 去除右侧空白
+   *
+   * @return Static_QString&  当前对象引用
+   */
+  Static_QString& trim_right(void) noexcept
+  {
+    resize(Algorithm::trailing_end(m_data, m_size));
+    return *this;
+  }
+
+  /**
+   * @brief  静态字符串 数值转换 从字符串解析整数
+   *
+   * @param  result  解析结果
+   * @param  base    进制基数，默认为10
+   * @return bool    解析成功返回true，失败返回false
+   */
+  template <typename T, typename = std::enable_if_t<std::is_integral<T>::value && !std::is_same<T, char>::value>>
+  bool parse(T& result, int base = 10) const noexcept
+  {
+    return system::algorithm::Parse::parse(m_data, m_size, result, base);
+  }
+
+  /**
+   * @brief  静态字符串 数值转换 从字符串解析浮点数
+   *
+   * @param  result  解析结果
+   * @return bool    解析成功返回true，失败返回false
+   */
+  template <typename T, typename = std::enable_if_t<std::is_floating_point<T>::value>>
+  bool parse(T& result) const noexcept
+  {
+    return system::algorithm::Parse::parse(m_data, m_size, result);
+  }
+
+  /**
+   * @brief  静态字符串 数值转换 转换为指定数值类型
+   *
+   * @tparam T     目标数值类型
+   * @param  base  进制基数，默认为10 (仅整数有效)
+   * @return T     转换结果，失败时为0
+   */
+  template <typename T>
+  T to_number(int base = 10) const noexcept
+  {
+    T result = 0;
+
+    if constexpr (std::is_floating_point<T>::value)
+    {
+      (void)base;
+      parse(result);
+    }
+    else
+    {
+      parse(result, base);
+    }
+
+    return result;
+  }
+
+  /**
+   * @brief  静态字符串 数值转换 转换为整数
+   *
+   * @param  base  进制基数，默认为10
+   * @return int   转换结果
+   */
+  int to_int(int base = 10) const noexcept
+  {
+    return to_number<int>(base);
+  }
+
+  /**
+   * @brief  静态字符串 数值转换 转换为无符号整数
+   *
+   * @param  base           进制基数，默认为10
+   * @return unsigned int   转换结果
+   */
+  unsigned int to_uint(int base = 10) const noexcept
+  {
+    return to_number<unsigned int>(base);
+  }
+
+  /**
+   * @brief  静态字符串 数值转换 转换为32位整数
+   *
+   * @param  base     进制基数，默认为10
+   * @return int32_t  转换结果
+   */
+  int32_t to_int32(int base = 10) const noexcept
+  {
+    return to_number<int32_t>(base);
+  }
+
+  /**
+   * @brief  静态字符串 数值转换 转换为32位无符号整数
+   *
+   * @param  base       进制基数，默认为10
+   * @return uint32_t   转换结果
+   */
+  uint32_t to_uint32(int base = 10) const noexcept
+  {
+    return to_number<uint32_t>(base);
+  }
+
+  /**
+   * @brief  静态字符串 数值转换 转换为64位整数
+   *
+   * @param  base     进制基数，默认为10
+   * @return int64_t  转换结果
+   */
+  int64_t to_int64(int base = 10) const noexcept
+  {
+    return to_number<int64_t>(base);
+  }
+
+  /**
+   * @brief  静态字符串 数值转换 转换为64位无符号整数
+   *
+   * @param  base       进制基数，默认为10
+   * @return uint64_t   转换结果
+   */
+  uint64_t to_uint64(int base = 10) const noexcept
+  {
+    return to_number<uint64_t>(base);
+  }
+
+  /**
+   * @brief  静态字符串 数值转换 转换为浮点数
+   *
+   * @return float  转换结果
+   */
+  float to_float(void) const noexcept
+  {
+    return to_number<float>();
+  }
+
+  /**
+   * @brief  静态字符串 数值转换 转换为双精度浮点数
+   *
+   * @return double  转换结果
+   */
+  double to_double(void) const noexcept
+  {
+    return to_number<double>();
+  }
+
+  /**
+   * @brief  静态字符串 类型转换 转换为布尔值
+   *
+   * @return true   字符串不为空
+   * @return false  字符串为空
+   */
+  explicit operator bool() const noexcept
+  {
+    return 0 != m_size;
+  }
+};
+} /* namespace container */
+} /* namespace QAQ */
+
+#endif /* __STATIC_QSTRING_HPP__ */
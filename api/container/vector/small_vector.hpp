@@ -0,0 +1,282 @@
+#ifndef __SMALL_VECTOR_HPP__
+#define __SMALL_VECTOR_HPP__
+
+#include "vector_base.hpp"
+
+/// @brief 名称空间 QAQ
+namespace QAQ
+{
+/// @brief 名称空间 容器
+namespace container
+{
+/**
+ * @brief 小向量 (元素数量不超过N时内联存储，超出后从向量内存池申请)
+ *
+ * @note  扩容按2倍增长，内存池耗尽时插入操作失败并返回false/nullptr，不会修改已有元素
+ *
+ * @tparam T  元素类型
+ * @tparam N  内联容量
+ */
+template <typename T, uint32_t N>
+class Small_Vector final : public container_internal::vector_internal::Vector_Base<T, Small_Vector<T, N>>
+{
+  static_assert(N > 0, "N must be greater than 0");
+
+private:
+  /// @brief 基类类型
+  using Base = container_internal::vector_internal::Vector_Base<T, Small_Vector<T, N>>;
+  /// @brief 元素操作类型
+  using Ops  = container_internal::vector_internal::Element_Ops<T>;
+  /// @brief 内存池类型
+  using Pool = container_internal::vector_internal::Vector_Memory_Pool;
+
+  friend Base;
+
+  /// @brief 数据指针 (指向内联存储或内存池)
+  T*       m_data;
+  /// @brief 元素数量
+  uint32_t m_size;
+  /// @brief 容量
+  uint32_t m_capacity;
+  /// @brief 内联存储
+  typename std::aligned_storage<sizeof(T), alignof(T)>::type m_inline[N];
+
+  QAQ_INLINE T* inline_data(void) noexcept
+  {
+    return std::launder(reinterpret_cast<T*>(m_inline));
+  }
+
+  QAQ_INLINE T* data_impl(void) noexcept
+  {
+    return m_data;
+  }
+
+  QAQ_INLINE const T* data_impl(void) const noexcept
+  {
+    return m_data;
+  }
+
+  QAQ_INLINE uint32_t size_impl(void) const noexcept
+  {
+    return m_size;
+  }
+
+  QAQ_INLINE uint32_t capacity_impl(void) const noexcept
+  {
+    return m_capacity;
+  }
+
+  QAQ_INLINE void set_size(uint32_t size) noexcept
+  {
+    m_size = size;
+  }
+
+  /**
+   * @brief  小向量 释放内存池存储
+   */
+  void release(void) noexcept
+  {
+    if (!is_inline())
+    {
+      Pool::instance().deallocate(m_data, alignof(T));
+    }
+
+    m_data     = inline_data();
+    m_capacity = N;
+  }
+
+  /**
+   * @brief  小向量 搬移至新的存储
+   *
+   * @param  new_capacity  新容量
+   * @return bool          是否成功
+   */
+  bool reallocate(uint32_t new_capacity)
+  {
+    T* data = (N >= new_capacity) ? inline_data() : static_cast<T*>(Pool::instance().allocate(new_capacity * sizeof(T), alignof(T)));
+
+    if (nullptr == data)
+    {
+      return false;
+    }
+
+    if (data != m_data)
+    {
+      Ops::relocate(data, m_data, m_size);
+
+      if (!is_inline())
+      {
+        Pool::instance().deallocate(m_data, alignof(T));
+      }
+
+      m_data     = data;
+      m_capacity = std::max(new_capacity, N);
+    }
+
+    return true;
+  }
+
+  /**
+   * @brief  小向量 扩容
+   *
+   * @param  required  所需容量
+   * @return bool      是否成功
+   */
+  bool grow_to(uint32_t required)
+  {
+    return reallocate(std::max(required, m_capacity * 2));
+  }
+
+  /**
+   * @brief  小向量 从另一个对象移动 (当前对象需为空且使用内联存储)
+   *
+   * @param  other  源对象
+   */
+  void steal(Small_Vector& other) noexcept
+  {
+    if (other.is_inline())
+    {
+      Ops::relocate(m_data, other.m_data, other.m_size);
+    }
+    else
+    {
+      m_data           = other.m_data;
+      m_capacity       = other.m_capacity;
+      other.m_data     = other.inline_data();
+      other.m_capacity = N;
+    }
+
+    m_size       = other.m_size;
+    other.m_size = 0;
+  }
+
+public:
+  /**
+   * @brief  小向量 默认构造函数
+   */
+  Small_Vector() noexcept : m_data(inline_data()), m_size(0), m_capacity(N) {}
+
+  /**
+   * @brief  小向量 填充构造函数
+   *
+   * @param  count  元素数量
+   * @param  value  填充值
+   */
+  Small_Vector(uint32_t count, const T& value) : Small_Vector()
+  {
+    Base::resize(count, value);
+  }
+
+  /**
+   * @brief  小向量 初始化列表构造函数
+   *
+   * @param  list  初始化列表
+   */
+  Small_Vector(std::initializer_list<T> list) : Small_Vector()
+  {
+    Base::insert(Base::end(), list.begin(), list.end());
+  }
+
+  /**
+   * @brief  小向量 拷贝构造函数
+   *
+   * @param  other  源对象
+   */
+  Small_Vector(const Small_Vector& other) : Small_Vector()
+  {
+    if (Base::reserve(other.m_size))
+    {
+      Ops::copy(m_data, other.m_data, other.m_size);
+      m_size = other.m_size;
+    }
+  }
+
+  /**
+   * @brief  小向量 移动构造函数 (内存池存储直接转移)
+   *
+   * @param  other  源对象
+   */
+  Small_Vector(Small_Vector&& other) noexcept : Small_Vector()
+  {
+    steal(other);
+  }
+
+  /**
+   * @brief  小向量 析构函数
+   */
+  ~Small_Vector()
+  {
+    Base::clear();
+    release();
+  }
+
+  /**
+   * @brief  小向量 拷贝赋值
+   *
+   * @param  other          源对象
+   * @return Small_Vector&  当前对象引用
+   */
+  Small_Vector& operator=(const Small_Vector& other)
+  {
+    if (&other != this)
+    {
+      Base::clear();
+
+      if (Base::reserve(other.m_size))
+      {
+        Ops::copy(m_data, other.m_data, other.m_size);
+        m_size = other.m_size;
+      }
+    }
+
+    return *this;
+  }
+
+  /**
+   * @brief  小向量 移动赋值
+   *
+   * @param  other          源对象
+   * @return Small_Vector&  当前对象引用
+   */
+  Small_Vector& operator=(Small_Vector&& other) noexcept
+  {
+    if (&other != this)
+    {
+      Base::clear();
+      release();
+      steal(other);
+    }
+
+    return *this;
+  }
+
+  /**
+   * @brief  小向量 判断是否使用内联存储
+   *
+   * @return true   内联存储
+   * @return false  内存池存储
+   */
+  bool is_inline(void) const noexcept
+  {
+    return m_data == std::launder(reinterpret_cast<const T*>(m_inline));
+  }
+
+  /**
+   * @brief  小向量 收缩容量至元素数量 (不超过N时回到内联存储)
+   *
+   * @return bool  是否成功
+   */
+  bool shrink_to_fit(void)
+  {
+    if (is_inline() || m_size == m_capacity)
+    {
+      return true;
+    }
+
+    return reallocate(m_size);
+  }
+};
+} /* namespace container */
+} /* namespace QAQ */
+
+#endif /* __SMALL_VECTOR_HPP__ */
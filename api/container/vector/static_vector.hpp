@@ -0,0 +1,185 @@
+#ifndef __STATIC_VECTOR_HPP__
+#define __STATIC_VECTOR_HPP__
+
+#include "vector_base.hpp"
+
+/// @brief 名称空间 QAQ
+namespace QAQ
+{
+/// @brief 名称空间 容器
+namespace container
+{
+/**
+ * @brief 静态向量 (固定容量，元素内联存储，不申请内存)
+ *
+ * @note  超出容量的插入操作失败并返回false/nullptr，不会修改已有元素
+ *
+ * @tparam T  元素类型
+ * @tparam N  容量
+ */
+template <typename T, uint32_t N>
+class Static_Vector final : public container_internal::vector_internal::Vector_Base<T, Static_Vector<T, N>>
+{
+  static_assert(N > 0, "N must be greater than 0");
+
+private:
+  /// @brief 基类类型
+  using Base = container_internal::vector_internal::Vector_Base<T, Static_Vector<T, N>>;
+  /// @brief 元素操作类型
+  using Ops  = container_internal::vector_internal::Element_Ops<T>;
+
+  friend Base;
+
+  /// @brief 元素存储
+  typename std::aligned_storage<sizeof(T), alignof(T)>::type m_storage[N];
+  /// @brief 元素数量
+  uint32_t m_size;
+
+  QAQ_INLINE T* data_impl(void) noexcept
+  {
+    return std::launder(reinterpret_cast<T*>(m_storage));
+  }
+
+  QAQ_INLINE const T* data_impl(void) const noexcept
+  {
+    return std::launder(reinterpret_cast<const T*>(m_storage));
+  }
+
+  QAQ_INLINE uint32_t size_impl(void) const noexcept
+  {
+    return m_size;
+  }
+
+  static QAQ_INLINE constexpr uint32_t capacity_impl(void) noexcept
+  {
+    return N;
+  }
+
+  QAQ_INLINE void set_size(uint32_t size) noexcept
+  {
+    m_size = size;
+  }
+
+  static QAQ_INLINE constexpr bool grow_to(uint32_t) noexcept
+  {
+    return false;
+  }
+
+public:
+  /**
+   * @brief  静态向量 默认构造函数
+   */
+  Static_Vector() noexcept : m_size(0) {}
+
+  /**
+   * @brief  静态向量 填充构造函数
+   *
+   * @param  count  元素数量 (超出容量部分被忽略)
+   * @param  value  填充值
+   */
+  Static_Vector(uint32_t count, const T& value) : m_size(0)
+  {
+    Base::resize(std::min(count, N), value);
+  }
+
+  /**
+   * @brief  静态向量 初始化列表构造函数
+   *
+   * @param  list  初始化列表 (超出容量部分被忽略)
+   */
+  Static_Vector(std::initializer_list<T> list) : m_size(0)
+  {
+    Base::insert(Base::end(), list.begin(), list.begin() + std::min(static_cast<uint32_t>(list.size()), N));
+  }
+
+  /**
+   * @brief  静态向量 拷贝构造函数
+   *
+   * @param  other  源对象
+   */
+  Static_Vector(const Static_Vector& other) : m_size(other.m_size)
+  {
+    Ops::copy(data_impl(), other.data_impl(), other.m_size);
+  }
+
+  /**
+   * @brief  静态向量 移动构造函数 (逐元素移动)
+   *
+   * @param  other  源对象
+   */
+  Static_Vector(Static_Vector&& other) noexcept : m_size(other.m_size)
+  {
+    Ops::relocate(data_impl(), other.data_impl(), other.m_size);
+    other.m_size = 0;
+  }
+
+  /**
+   * @brief  静态向量 析构函数
+   */
+  ~Static_Vector()
+  {
+    Base::clear();
+  }
+
+  /**
+   * @brief  静态向量 拷贝赋值
+   *
+   * @param  other           源对象
+   * @return Static_Vector&  当前对象引用
+   */
+  Static_Vector& operator=(const Static_Vector& other)
+  {
+    if (&other != this)
+    {
+      Base::clear();
+      Ops::copy(data_impl(), other.data_impl(), other.m_size);
+      m_size = other.m_size;
+    }
+
+    return *this;
+  }
+
+  /**
+   * @brief  静态向量 移动赋值
+   *
+   * @param  other           源对象
+   * @return Static_Vector&  当前对象引用
+   */
+  Static_Vector& operator=(Static_Vector&& other) noexcept
+  {
+    if (&other != this)
+    {
+      Base::clear();
+      Ops::relocate(data_impl(), other.data_impl(), other.m_size);
+      m_size       = other.m_size;
+      other.m_size = 0;
+    }
+
+    return *this;
+  }
+
+  /**
+   * @brief  静态向量 判断是否已满
+   *
+   * @return true   已满
+   * @return false  未满
+   */
+  bool full(void) const noexcept
+  {
+    return N <= m_size;
+  }
+
+  /**
+   * @brief  静态向量 获取最大容量
+   *
+   * @return uint32_t  最大容量
+   */
+  static constexpr uint32_t max_size(void) noexcept
+  {
+    return N;
+  }
+};
+} /* namespace container */
+} /* namespace QAQ */
+
+#endif /* __STATIC_VECTOR_HPP__ */
@@ -0,0 +1,665 @@
+#ifndef __VECTOR_BASE_HPP__
+#define __VECTOR_BASE_HPP__
+
+#include "vector_memory.hpp"
+#include <algorithm>
+#include <initializer_list>
+
+/// @brief 名称空间 QAQ
+namespace QAQ
+{
+/// @brief 名称空间 容器
+namespace container
+{
+/// @brief 名称空间 内部
+namespace container_internal
+{
+/// @brief 名称空间 向量内部
+namespace vector_internal
+{
+/**
+ * @brief 向量 基类 (CRTP，提供与存储方式无关的元素操作)
+ *
+ * @note  派生类需提供: T* data_impl()、uint32_t size_impl()、uint32_t capacity_impl()、
+ *        void set_size(uint32_t)、bool grow_to(uint32_t); 容量不足且无法扩容时操作失败并返回false/nullptr
+ *
+ * @tparam T        元素类型
+ * @tparam Derived  派生类
+ */
+template <typename T, typename Derived>
+class Vector_Base
+{
+private:
+  /// @brief 元素操作类型
+  using Ops = Element_Ops<T>;
+
+  QAQ_INLINE Derived& self(void) noexcept
+  {
+    return static_cast<Derived&>(*this);
+  }
+
+  QAQ_INLINE const Derived& self(void) const noexcept
+  {
+    return static_cast<const Derived&>(*this);
+  }
+
+  /**
+   * @brief  向量基类 确保容量
+   *
+   * @param  required  所需容量
+   * @return bool      容量是否满足
+   */
+  QAQ_INLINE bool ensure(uint32_t required)
+  {
+    return (self().capacity_impl() >= required) || self().grow_to(required);
+  }
+
+  /**
+   * @brief  向量基类 将尾部新追加的元素旋转至指定位置
+   *
+   * @param  index     目标位置
+   * @param  old_size  追加前的大小
+   */
+  void rotate_tail(uint32_t index, uint32_t old_size)
+  {
+    T*       ptr   = self().data_impl();
+    uint32_t count = self().size_impl() - old_size;
+
+    if (index == old_size || 0 == count)
+    {
+      return;
+    }
+
+    if constexpr (Ops::is_trivial)
+    {
+      // 可平凡拷贝类型: 先暂存追加的元素，整体后移后写回
+      if (count * sizeof(T) <= 64)
+      {
+        alignas(T) uint8_t temp[64];
+        memcpy(temp, ptr + old_size, count * sizeof(T));
+        memmove(ptr + index + count, ptr + index, (old_size - index) * sizeof(T));
+        memcpy(ptr + index, temp, count * sizeof(T));
+        return;
+      }
+    }
+
+    if (1 == count)
+    {
+      // 单个元素: 暂存后整体后移一位，每个元素只移动一次 (std::rotate 需逐个交换)
+      T temp(std::move(ptr[old_size]));
+      std::move_backward(ptr + index, ptr + old_size, ptr + old_size + 1);
+      ptr[index] = std::move(temp);
+      return;
+    }
+
+    std::rotate(ptr + index, ptr + old_size, ptr + old_size + count);
+  }
+
+public:
+  /// @brief 元素类型
+  using value_type     = T;
+  /// @brief 迭代器类型
+  using iterator       = T*;
+  /// @brief 常量迭代器类型
+  using const_iterator = const T*;
+
+  /**
+   * @brief  向量 迭代器 获取起始迭代器
+   *
+   * @return iterator  起始迭代器
+   */
+  iterator begin(void) noexcept
+  {
+    return self().data_impl();
+  }
+
+  /**
+   * @brief  向量 迭代器 获取结束迭代器
+   *
+   * @return iterator  结束迭代器
+   */
+  iterator end(void) noexcept
+  {
+    return self().data_impl() + self().size_impl();
+  }
+
+  /**
+   * @brief  向量 迭代器 获取起始常量迭代器
+   *
+   * @return const_iterator  起始常量迭代器
+   */
+  const_iterator begin(void) const noexcept
+  {
+    return self().data_impl();
+  }
+
+  /**
+   * @brief  向量 迭代器 获取结束常量迭代器
+   *
+   * @return const_iterator  结束常量迭代器
+   */
+  const_iterator end(void) const noexcept
+  {
+    return self().data_impl() + self().size_impl();
+  }
+
+  /**
+   * @brief  向量 元素访问 获取指定位置元素 (不做边界检查)
+   *
+   * @param  index  位置
+   * @return T&     元素引用
+   */
+  T& operator[](uint32_t index) noexcept
+  {
+    return self().data_impl()[index];
+  }
+
+  /**
+   * @brief  向量 元素访问 获取指定位置元素 (不做边界检查，const版本)
+   *
+   * @param  index     位置
+   * @return const T&  元素引用
+   */
+  const T& operator[](uint32_t index) const noexcept
+  {
+    return self().data_impl()[index];
+  }
+
+  /**
+   * @brief  向量 元素访问 获取指定位置元素
+   *
+   * @param  index  位置
+   * @return T*     元素指针，越界返回nullptr
+   */
+  T* at(uint32_t index) noexcept
+  {
+    return (index < self().size_impl()) ? self().data_impl() + index : nullptr;
+  }
+
+  /**
+   * @brief  向量 元素访问 获取指定位置元素 (const版本)
+   *
+   * @param  index     位置
+   * @return const T*  元素指针，越界返回nullptr
+   */
+  const T* at(uint32_t index) const noexcept
+  {
+    return (index < self().size_impl()) ? self().data_impl() + index : nullptr;
+  }
+
+  /**
+   * @brief  向量 元素访问 获取首元素 (不可为空)
+   *
+   * @return T&  元素引用
+   */
+  T& front(void) noexcept
+  {
+    return self().data_impl()[0];
+  }
+
+  /**
+   * @brief  向量 元素访问 获取首元素 (不可为空，const版本)
+   *
+   * @return const T&  元素引用
+   */
+  const T& front(void) const noexcept
+  {
+    return self().data_impl()[0];
+  }
+
+  /**
+   * @brief  向量 元素访问 获取尾元素 (不可为空)
+   *
+   * @return T&  元素引用
+   */
+  T& back(void) noexcept
+  {
+    return self().data_impl()[self().size_impl() - 1];
+  }
+
+  /**
+   * @brief  向量 元素访问 获取尾元素 (不可为空，const版本)
+   *
+   * @return const T&  元素引用
+   */
+  const T& back(void) const noexcept
+  {
+    return self().data_impl()[self().size_impl() - 1];
+  }
+
+  /**
+   * @brief  向量 获取数据指针
+   *
+   * @return T*  数据指针
+   */
+  T* data(void) noexcept
+  {
+    return self().data_impl();
+  }
+
+  /**
+   * @brief  向量 获取数据指针 (const版本)
+   *
+   * @return const T*  数据指针
+   */
+  const T* data(void) const noexcept
+  {
+    return self().data_impl();
+  }
+
+  /**
+   * @brief  向量 获取元素数量
+   *
+   * @return uint32_t  元素数量
+   */
+  uint32_t size(void) const noexcept
+  {
+    return self().size_impl();
+  }
+
+  /**
+   * @brief  向量 获取容量
+   *
+   * @return uint32_t  容量
+   */
+  uint32_t capacity(void) const noexcept
+  {
+    return self().capacity_impl();
+  }
+
+  /**
+   * @brief  向量 判断是否为空
+   *
+   * @return true   为空
+   * @return false  不为空
+   */
+  bool empty(void) const noexcept
+  {
+    return 0 == self().size_impl();
+  }
+
+  /**
+   * @brief  向量 预留容量
+   *
+   * @param  new_capacity  新容量
+   * @return bool          容量是否满足
+   */
+  bool reserve(uint32_t new_capacity)
+  {
+    return ensure(new_capacity);
+  }
+
+  /**
+   * @brief  向量 清空
+   */
+  void clear(void) noexcept
+  {
+    Ops::destroy(self().data_impl(), self().size_impl());
+    self().set_size(0);
+  }
+
+  /**
+   * @brief  向量 在尾部构造元素
+   *
+   * @param  args  构造参数
+   * @return T*    新元素指针，容量不足返回nullptr
+   */
+  template <typename... Args>
+  T* emplace_back(Args&&... args)
+  {
+    uint32_t size = self().size_impl();
+
+    if (self().capacity_impl() > size)
+    {
+      T* ptr = new (self().data_impl() + size) T(std::forward<Args>(args)...);
+      self().set_size(size + 1);
+      return ptr;
+    }
+
+    // 参数可能引用自身元素，先构造再扩容
+    T temp(std::forward<Args>(args)...);
+
+    if (!self().grow_to(size + 1))
+    {
+      return nullptr;
+    }
+
+    T* ptr = new (self().data_impl() + size) T(std::move(temp));
+    self().set_size(size + 1);
+    return ptr;
+  }
+
+  /**
+   * @brief  向量 尾部追加元素 (拷贝)
+   *
+   * @param  value  元素
+   * @return bool   是否成功
+   */
+  bool push_back(const T& value)
+  {
+    return nullptr != emplace_back(value);
+  }
+
+  /**
+   * @brief  向量 尾部追加元素 (移动)
+   *
+   * @param  value  元素
+   * @return bool   是否成功
+   */
+  bool push_back(T&& value)
+  {
+    return nullptr != emplace_back(std::move(value));
+  }
+
+  /**
+   * @brief  向量 删除尾部元素
+   */
+  void pop_back(void) noexcept
+  {
+    uint32_t size = self().size_impl();
+
+    if (0 < size)
+    {
+      Ops::destroy(self().data_impl() + size - 1, 1);
+      self().set_size(size - 1);
+    }
+  }
+
+  /**
+   * @brief  向量 在指定位置构造元素
+   *
+   * @param  pos   插入位置
+   * @param  args  构造参数
+   * @return T*    新元素指针，失败返回nullptr
+   */
+  template <typename... Args>
+  T* emplace(const_iterator pos, Args&&... args)
+  {
+    uint32_t index    = static_cast<uint32_t>(pos - begin());
+    uint32_t old_size = self().size_impl();
+
+    if (old_size < index || nullptr == emplace_back(std::forward<Args>(args)...))
+    {
+      return nullptr;
+    }
+
+    rotate_tail(index, old_size);
+    return self().data_impl() + index;
+  }
+
+  /**
+   * @brief  向量 插入元素 (拷贝)
+   *
+   * @param  pos    插入位置
+   * @param  value  元素
+   * @return T*     新元素指针，失败返回nullptr
+   */
+  T* insert(const_iterator pos, const T& value)
+  {
+    return emplace(pos, value);
+  }
+
+  /**
+   * @brief  向量 插入元素 (移动)
+   *
+   * @param  pos    插入位置
+   * @param  value  元素
+   * @return T*     新元素指针，失败返回nullptr
+   */
+  T* insert(const_iterator pos, T&& value)
+  {
+    return emplace(pos, std::move(value));
+  }
+
+  /**
+   * @brief  向量 插入多个相同元素
+   *
+   * @param  pos    插入位置
+   * @param  count  元素数量
+   * @param  value  元素
+   * @return T*     第一个新元素指针，失败返回nullptr
+   */
+  T* insert(const_iterator pos, uint32_t count, const T& value)
+  {
+    uint32_t index    = static_cast<uint32_t>(pos - begin());
+    uint32_t old_size = self().size_impl();
+
+    if (old_size < index)
+    {
+      return nullptr;
+    }
+
+    // 元素可能引用自身，扩容前先拷贝
+    T temp(value);
+
+    if (!ensure(old_size + count))
+    {
+      return nullptr;
+    }
+
+    T* ptr = self().data_impl();
+
+    for (uint32_t i = 0; i < count; ++i)
+    {
+      new (ptr + old_size + i) T(temp);
+    }
+
+    self().set_size(old_size + count);
+    rotate_tail(index, old_size);
+    return self().data_impl() + index;
+  }
+
+  /**
+   * @brief  向量 插入区间 (区间不可引用自身元素)
+   *
+   * @param  pos    插入位置
+   * @param  first  区间起始
+   * @param  last   区间结束
+   * @return T*     第一个新元素指针，失败返回nullptr
+   */
+  template <typename Iterator, typename = std::enable_if_t<!std::is_integral<Iterator>::value>>
+  T* insert(const_iterator pos, Iterator first, Iterator last)
+  {
+    uint32_t index    = static_cast<uint32_t>(pos - begin());
+    uint32_t old_size = self().size_impl();
+    uint32_t count    = static_cast<uint32_t>(std::distance(first, last));
+
+    if (old_size < index || !ensure(old_size + count))
+    {
+      return nullptr;
+    }
+
+    T* ptr = self().data_impl() + old_size;
+
+    if constexpr (Ops::is_trivial && std::is_pointer<Iterator>::value)
+    {
+      Ops::copy(ptr, first, count);
+    }
+    else
+    {
+      for (; first != last; ++first, ++ptr)
+      {
+        new (ptr) T(*first);
+      }
+    }
+
+    self().set_size(old_size + count);
+    rotate_tail(index, old_size);
+    return self().data_impl() + index;
+  }
+
+  /**
+   * @brief  向量 删除区间
+   *
+   * @param  first  区间起始
+   * @param  last   区间结束
+   * @return T*     删除后位于原位置的元素
+   */
+  T* erase(const_iterator first, const_iterator last)
+  {
+    T*       ptr   = self().data_impl();
+    uint32_t size  = self().size_impl();
+    uint32_t index = static_cast<uint32_t>(first - ptr);
+    uint32_t count = static_cast<uint32_t>(last - first);
+
+    if (size < index + count || 0 == count)
+    {
+      return ptr + index;
+    }
+
+    if constexpr (Ops::is_trivial)
+    {
+      memmove(ptr + index, ptr + index + count, (size - index - count) * sizeof(T));
+    }
+    else
+    {
+      std::move(ptr + index + count, ptr + size, ptr + index);
+      Ops::destroy(ptr + size - count, count);
+    }
+
+    self().set_size(size - count);
+    return ptr + index;
+  }
+
+  /**
+   * @brief  向量 删除元素
+   *
+   * @param  pos  元素位置
+   * @return T*   删除后位于原位置的元素
+   */
+  T* erase(const_iterator pos)
+  {
+    return erase(pos, pos + 1);
+  }
+
+  /**
+   * @brief  向量 调整大小 (新元素值初始化)
+   *
+   * @param  new_size  新大小
+   * @return bool      是否成功
+   */
+  bool resize(uint32_t new_size)
+  {
+    uint32_t size = self().size_impl();
+
+    if (new_size <= size)
+    {
+      Ops::destroy(self().data_impl() + new_size, size - new_size);
+      self().set_size(new_size);
+      return true;
+    }
+
+    if (!ensure(new_size))
+    {
+      return false;
+    }
+
+    T* ptr = self().data_impl();
+
+    if constexpr (Ops::is_trivial && std::is_trivially_default_constructible<T>::value)
+    {
+      memset(static_cast<void*>(ptr + size), 0, (new_size - size) * sizeof(T));
+    }
+    else
+    {
+      for (uint32_t i = size; i < new_size; ++i)
+      {
+        new (ptr + i) T();
+      }
+    }
+
+    self().set_size(new_size);
+    return true;
+  }
+
+  /**
+   * @brief  向量 调整大小 (新元素为指定值)
+   *
+   * @param  new_size  新大小
+   * @param  value     填充值
+   * @return bool      是否成功
+   */
+  bool resize(uint32_t new_size, const T& value)
+  {
+    uint32_t size = self().size_impl();
+
+    if (new_size <= size)
+    {
+      Ops::destroy(self().data_impl() + new_size, size - new_size);
+      self().set_size(new_size);
+      return true;
+    }
+
+    T temp(value);
+
+    if (!ensure(new_size))
+    {
+      return false;
+    }
+
+    T* ptr = self().data_impl();
+
+    for (uint32_t i = size; i < new_size; ++i)
+    {
+      new (ptr + i) T(temp);
+    }
+
+    self().set_size(new_size);
+    return true;
+  }
+
+  /**
+   * @brief  向量 赋值区间
+   *
+   * @param  first  区间起始
+   * @param  last   区间结束
+   * @return bool   是否成功
+   */
+  template <typename Iterator, typename = std::enable_if_t<!std::is_integral<Iterator>::value>>
+  bool assign(Iterator first, Iterator last)
+  {
+    clear();
+    return nullptr != insert(end(), first, last);
+  }
+
+  /**
+   * @brief  向量 赋值初始化列表
+   *
+   * @param  list  初始化列表
+   * @return bool  是否成功
+   */
+  bool assign(std::initializer_list<T> list)
+  {
+    return assign(list.begin(), list.end());
+  }
+
+  /**
+   * @brief  向量 比较操作 等于比较
+   *
+   * @param  other  另一个向量
+   * @return bool   比较结果
+   */
+  template <typename Other>
+  bool operator==(const Vector_Base<T, Other>& other) const
+  {
+    return size() == other.size() && std::equal(begin(), end(), other.begin());
+  }
+
+  /**
+   * @brief  向量 比较操作 不等于比较
+   *
+   * @param  other  另一个向量
+   * @return bool   比较结果
+   */
+  template <typename Other>
+  bool operator!=(const Vector_Base<T, Other>& other) const
+  {
+    return !(*this == other);
+  }
+};
+} /* namespace vector_internal */
+} /* namespace container_internal */
+} /* namespace container */
+} /* namespace QAQ */
+
+#endif /* __VECTOR_BASE_HPP__ */
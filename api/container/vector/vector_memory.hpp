@@ -0,0 +1,172 @@
+#ifndef __VECTOR_MEMORY_HPP__
+#define __VECTOR_MEMORY_HPP__
+
+#include "memory_pool.hpp"
+#include "fast_memory.hpp"
+
+/// @brief 名称空间 QAQ
+namespace QAQ
+{
+/// @brief 名称空间 容器
+namespace container
+{
+/// @brief 名称空间 内部
+namespace container_internal
+{
+/// @brief 名称空间 向量内部
+namespace vector_internal
+{
+/**
+ * @brief 向量 内存池 (Small_Vector 溢出后的存储)
+ *
+ * @note  ThreadX 字节池仅保证4字节对齐，对齐要求更高的类型在块前预留空间，
+ *        并将原始指针保存在返回地址之前
+ */
+class Vector_Memory_Pool final
+{
+private:
+  /// @brief 内存池大小
+  static constexpr uint32_t POOL_SIZE = 16384;
+
+  /// @brief 字节型内存池
+  system::memory::Byte_Memory_Pool<POOL_SIZE> m_pool;
+
+protected:
+  explicit Vector_Memory_Pool() : m_pool("Vector Memory Pool") {}
+  ~Vector_Memory_Pool() {}
+
+public:
+  static Vector_Memory_Pool& instance()
+  {
+    static Vector_Memory_Pool instance;
+    return instance;
+  }
+
+  /**
+   * @brief  向量内存池 申请内存
+   *
+   * @param  size   内存大小
+   * @param  align  对齐要求
+   * @return void*  内存指针，失败返回nullptr
+   */
+  void* allocate(uint32_t size, uint32_t align)
+  {
+    if (alignof(uint32_t) >= align)
+    {
+      return m_pool.allocate(size);
+    }
+
+    uint8_t* raw = static_cast<uint8_t*>(m_pool.allocate(size + align + sizeof(void*)));
+
+    if (nullptr == raw)
+    {
+      return nullptr;
+    }
+
+    uintptr_t aligned                     = (reinterpret_cast<uintptr_t>(raw) + sizeof(void*) + align - 1) & ~static_cast<uintptr_t>(align - 1);
+    reinterpret_cast<void**>(aligned)[-1] = raw;
+    return reinterpret_cast<void*>(aligned);
+  }
+
+  /**
+   * @brief  向量内存池 释放内存
+   *
+   * @param  ptr    内存指针
+   * @param  align  申请时的对齐要求
+   */
+  void deallocate(void* ptr, uint32_t align)
+  {
+    if (nullptr == ptr)
+    {
+      return;
+    }
+
+    m_pool.deallocate((alignof(uint32_t) >= align) ? ptr : static_cast<void**>(ptr)[-1]);
+  }
+};
+
+/**
+ * @brief 向量 元素操作 (可平凡拷贝类型使用内存拷贝)
+ *
+ * @tparam T  元素类型
+ */
+template <typename T>
+struct Element_Ops
+{
+  /// @brief 是否可使用内存拷贝
+  static constexpr bool is_trivial = std::is_trivially_copyable<T>::value;
+
+  /**
+   * @brief  元素操作 析构区间内元素
+   *
+   * @param  first  起始元素
+   * @param  count  元素数量
+   */
+  static QAQ_INLINE void destroy(T* first, uint32_t count) noexcept
+  {
+    if constexpr (!std::is_trivially_destructible<T>::value)
+    {
+      for (uint32_t i = 0; i < count; ++i)
+      {
+        first[i].~T();
+      }
+    }
+  }
+
+  /**
+   * @brief  元素操作 将元素搬移至未初始化内存 (源元素被析构，区间不可重叠)
+   *
+   * @param  dest   目标地址
+   * @param  src    源元素
+   * @param  count  元素数量
+   */
+  static QAQ_INLINE void relocate(T* dest, T* src, uint32_t count) noexcept
+  {
+    if constexpr (is_trivial)
+    {
+      if (0 < count)
+      {
+        system::memory::fast_memcpy(dest, src, count * sizeof(T));
+      }
+    }
+    else
+    {
+      for (uint32_t i = 0; i < count; ++i)
+      {
+        new (dest + i) T(std::move(src[i]));
+        src[i].~T();
+      }
+    }
+  }
+
+  /**
+   * @brief  元素操作 将元素拷贝至未初始化内存 (区间不可重叠)
+   *
+   * @param  dest   目标地址
+   * @param  src    源元素
+   * @param  count  元素数量
+   */
+  static QAQ_INLINE void copy(T* dest, const T* src, uint32_t count)
+  {
+    if constexpr (is_trivial)
+    {
+      if (0 < count)
+      {
+        system::memory::fast_memcpy(dest, src, count * sizeof(T));
+      }
+    }
+    else
+    {
+      for (uint32_t i = 0; i < count; ++i)
+      {
+        new (dest + i) T(src[i]);
+      }
+    }
+  }
+};
+} /* namespace vector_internal */
+} /* namespace container_internal */
+} /* namespace container */
+} /* namespace QAQ */
+
+#endif /* __VECTOR_MEMORY_HPP__ */
@@ -0,0 +1,616 @@
+/**
+ * @file   vector_test.cpp
+ * @brief  向量与有序平坦映射 主机测试: Static_Vector/Small_Vector 与 std::vector 的随机对照、自身元素别名、溢出/移动/收缩、
+ *         高对齐元素、Flat_Map 与 std::map 的随机对照、STL_Continuous_Allocator 扩容，以及与 std:: 容器的基准
+ *
+ * @note   仅用于主机，不参与固件编译 (已加入 eide excludeList);
+ *         ThreadX 字节池由本文件中基于 malloc 的桩函数代替，结束时检查内存池无泄漏;
+ *         基准耗时请以不带 sanitizer 的 -O2 构建为准
+ *
+ *         构建 (仓库根目录):
+ *         g++ -std=c++17 -O2 -g -fsanitize=address,undefined -fpermissive -w \
+ *             $(python3 -c "import json;c=json.load(open('.eide/eide.json'))['targets']['Debug']['custom_dep'];print(' '.join(['-I'+p for p in c['incList']]+['-D'+d for d in c['defineList']]))") \
+ *             api/container/vector/vector_test.cpp -o vector_test && ./vector_test
+ */
+#include "flat_map.hpp"
+#include "small_vector.hpp"
+#include "static_vector.hpp"
+#include "stl_memory_pool.hpp"
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <map>
+#include <string>
+#include <vector>
+
+using QAQ::container::Flat_Map;
+using QAQ::container::Small_Vector;
+using QAQ::container::Static_Vector;
+using QAQ::system::memory::STL_Continuous_Allocator;
+
+namespace
+{
+/// @brief 桩内存池 未释放的分配数
+int g_outstanding = 0;
+/// @brief 存活的计数元素数
+int g_alive       = 0;
+/// @brief 失败的检查数
+int g_failures    = 0;
+
+/// @brief 桩内存池 分配头部 (记录所属内存池与大小)
+struct alignas(16) Stub_Header
+{
+  void* pool;
+  ULONG size;
+};
+
+/// @brief 计数元素 (非平凡类型，检查构造与析构成对，被移动的对象标记为-1)
+struct Counted
+{
+  int value;
+
+  Counted(int v = 0) : value(v)
+  {
+    ++g_alive;
+  }
+
+  Counted(const Counted& other) : value(other.value)
+  {
+    ++g_alive;
+  }
+
+  Counted(Counted&& other) noexcept : value(other.value)
+  {
+    other.value = -1;
+    ++g_alive;
+  }
+
+  Counted& operator=(const Counted& other)
+  {
+    value = other.value;
+    return *this;
+  }
+
+  Counted& operator=(Counted&& other) noexcept
+  {
+    value       = other.value;
+    other.value = -1;
+    return *this;
+  }
+
+  ~Counted()
+  {
+    --g_alive;
+  }
+
+  bool operator==(const Counted& other) const
+  {
+    return value == other.value;
+  }
+};
+
+/// @brief 高对齐元素 (超过 ThreadX 字节池保证的4字节对齐)
+struct alignas(16) Wide
+{
+  double value[2];
+};
+
+/// @brief 伪随机数发生器
+uint32_t next_random(uint32_t& seed)
+{
+  seed = seed * 1664525u + 1013904223u;
+  return seed >> 8;
+}
+
+#define CHECK(cond)                                                  \
+  do                                                                 \
+  {                                                                  \
+    if (!(cond))                                                     \
+    {                                                                \
+      ++g_failures;                                                  \
+      printf("%s:%d: CHECK(%s) failed\n", __FILE__, __LINE__, #cond); \
+    }                                                                \
+  } while (0)
+} /* namespace */
+
+/* ThreadX 字节池桩函数 (单线程，容量与真实内存池一致，仅保证4字节对齐) */
+extern "C"
+{
+  ULONG _tx_time_get(VOID)
+  {
+    return 0;
+  }
+
+  UINT _tx_byte_pool_create(TX_BYTE_POOL* pool_ptr, CHAR* name_ptr, VOID*, ULONG pool_size)
+  {
+    pool_ptr->tx_byte_pool_name      = name_ptr;
+    pool_ptr->tx_byte_pool_size      = pool_size;
+    pool_ptr->tx_byte_pool_available = pool_size;
+    return TX_SUCCESS;
+  }
+
+  UINT _tx_byte_pool_delete(TX_BYTE_POOL*)
+  {
+    return TX_SUCCESS;
+  }
+
+  UINT _tx_byte_pool_info_get(TX_BYTE_POOL* pool_ptr, CHAR**, ULONG* available_bytes, ULONG* fragments, TX_THREAD**, ULONG*, TX_BYTE_POOL**)
+  {
+    if (available_bytes)
+    {
+      *available_bytes = pool_ptr->tx_byte_pool_available;
+    }
+
+    if (fragments)
+    {
+      *fragments = 1;
+    }
+
+    return TX_SUCCESS;
+  }
+
+  UINT _tx_byte_allocate(TX_BYTE_POOL* pool_ptr, VOID** memory_ptr, ULONG memory_size, ULONG)
+  {
+    if (memory_size > pool_ptr->tx_byte_pool_available)
+    {
+      return TX_NO_MEMORY;
+    }
+
+    // 返回地址故意错开至仅4字节对齐，暴露依赖 malloc 对齐的代码
+    Stub_Header* head = static_cast<Stub_Header*>(malloc(sizeof(Stub_Header) + 4 + memory_size));
+
+    if (nullptr == head)
+    {
+      return TX_NO_MEMORY;
+    }
+
+    head->pool  = pool_ptr;
+    head->size  = memory_size;
+    *memory_ptr = reinterpret_cast<uint8_t*>(head + 1) + 4;
+
+    pool_ptr->tx_byte_pool_available -= memory_size;
+    ++g_outstanding;
+    return TX_SUCCESS;
+  }
+
+  UINT _tx_byte_release(VOID* memory_ptr)
+  {
+    Stub_Header* head = reinterpret_cast<Stub_Header*>(static_cast<uint8_t*>(memory_ptr) - 4) - 1;
+
+    static_cast<TX_BYTE_POOL*>(head->pool)->tx_byte_pool_available += head->size;
+    --g_outstanding;
+    free(head);
+    return TX_SUCCESS;
+  }
+}
+
+/**
+ * @brief  比较向量与参考 std::vector 内容
+ */
+template <typename Vec, typename T>
+static bool same(const Vec& vec, const std::vector<T>& model)
+{
+  return vec.size() == model.size() && std::equal(model.begin(), model.end(), vec.begin());
+}
+
+/**
+ * @brief  随机操作与 std::vector 对照 (容量不足时要求操作失败且内容不变)
+ *
+ * @tparam Vec    被测向量类型
+ * @tparam T      元素类型
+ * @param  limit  被测向量的容量上限
+ */
+template <typename Vec, typename T>
+static void run_model(uint32_t limit)
+{
+  {
+    Vec            vec;
+    std::vector<T> model;
+    uint32_t       seed = limit * 7 + sizeof(T);
+
+    for (uint32_t step = 0; step < 20000; ++step)
+    {
+      uint32_t op    = next_random(seed) % 11;
+      uint32_t size  = static_cast<uint32_t>(model.size());
+      uint32_t pos   = (0 == size) ? 0 : next_random(seed) % (size + 1);
+      uint32_t count = next_random(seed) % 6;
+      int      value = static_cast<int>(step);
+
+      switch (op)
+      {
+      case 0:
+        CHECK(vec.push_back(T(value)) == (size < limit));
+        if (size < limit)
+        {
+          model.push_back(T(value));
+        }
+        break;
+
+      case 1:
+        CHECK((nullptr != vec.emplace(vec.begin() + pos, value)) == (size < limit));
+        if (size < limit)
+        {
+          model.insert(model.begin() + pos, T(value));
+        }
+        break;
+
+      case 2:
+        CHECK((nullptr != vec.insert(vec.begin() + pos, count, T(value))) == (size + count <= limit));
+        if (size + count <= limit)
+        {
+          model.insert(model.begin() + pos, count, T(value));
+        }
+        break;
+
+      case 3:
+      {
+        T range[5] = { T(value), T(value + 1), T(value + 2), T(value + 3), T(value + 4) };
+        CHECK((nullptr != vec.insert(vec.begin() + pos, range, range + count % 5)) == (size + count % 5 <= limit));
+        if (size + count % 5 <= limit)
+        {
+          model.insert(model.begin() + pos, range, range + count % 5);
+        }
+        break;
+      }
+
+      case 4:
+      case 5:
+        if (0 < size)
+        {
+          uint32_t first = next_random(seed) % size;
+          uint32_t last  = std::min(size, first + count);
+          vec.erase(vec.begin() + first, vec.begin() + last);
+          model.erase(model.begin() + first, model.begin() + last);
+        }
+        break;
+
+      case 6:
+        if (0 < size)
+        {
+          vec.pop_back();
+          model.pop_back();
+        }
+        break;
+
+      case 7:
+      {
+        uint32_t new_size = next_random(seed) % (std::min(limit, 64u) + 8);
+        CHECK(vec.resize(new_size, T(value)) == (new_size <= limit));
+        if (new_size <= limit)
+        {
+          model.resize(new_size, T(value));
+        }
+        break;
+      }
+
+      case 8:
+        // 参数引用自身元素 (扩容/移动时需保持有效)
+        if (0 < size)
+        {
+          uint32_t from = next_random(seed) % size;
+          CHECK(vec.push_back(vec[from]) == (size < limit));
+          if (size < limit)
+          {
+            model.push_back(T(model[from]));
+          }
+        }
+        break;
+
+      case 9:
+        if (0 < size)
+        {
+          uint32_t from = next_random(seed) % size;
+          CHECK((nullptr != vec.insert(vec.begin() + pos, count, vec[from])) == (size + count <= limit));
+          if (size + count <= limit)
+          {
+            model.insert(model.begin() + pos, count, T(model[from]));
+          }
+        }
+        break;
+
+      default:
+        if (0 == next_random(seed) % 16)
+        {
+          vec.clear();
+          model.clear();
+        }
+        break;
+      }
+
+      CHECK(same(vec, model));
+    }
+
+    // 拷贝与移动
+    Vec copy(vec);
+    CHECK(same(copy, model) && same(vec, model));
+    Vec moved(std::move(copy));
+    CHECK(same(moved, model) && 0 == copy.size());
+    copy = moved;
+    CHECK(copy == moved);
+  }
+
+  CHECK(0 == g_alive);
+  CHECK(0 == g_outstanding);
+}
+
+/**
+ * @brief  随机对照: 可平凡拷贝与非平凡元素，内联/溢出/固定容量
+ */
+static void test_model(void)
+{
+  run_model<Static_Vector<int, 32>, int>(32);
+  run_model<Static_Vector<Counted, 32>, Counted>(32);
+  run_model<Small_Vector<int, 4>, int>(UINT32_MAX);
+  run_model<Small_Vector<Counted, 4>, Counted>(UINT32_MAX);
+  run_model<Small_Vector<uint8_t, 16>, uint8_t>(UINT32_MAX);
+}
+
+/**
+ * @brief  小向量: 溢出至内存池、移动时转移存储块、收缩回内联存储、高对齐元素
+ */
+static void test_small_vector(void)
+{
+  {
+    Small_Vector<Counted, 4> vec;
+
+    for (int i = 0; i < 4; ++i)
+    {
+      CHECK(vec.push_back(Counted(i)));
+    }
+    CHECK(vec.is_inline() && 0 == g_outstanding);
+
+    CHECK(vec.push_back(Counted(4)));
+    CHECK(!vec.is_inline() && 8 == vec.capacity() && 1 == g_outstanding);
+
+    // 移动溢出的向量直接转移存储块，不重新分配
+    const Counted*           block = vec.data();
+    Small_Vector<Counted, 4> moved(std::move(vec));
+    CHECK(block == moved.data() && 5 == moved.size() && 0 == vec.size() && vec.is_inline());
+    CHECK(1 == g_outstanding && 5 == g_alive);
+
+    // 收缩至内联容量内时回到内联存储并释放存储块
+    moved.erase(moved.begin(), moved.begin() + 2);
+    CHECK(moved.shrink_to_fit() && moved.is_inline() && 0 == g_outstanding);
+    CHECK(3 == moved.size() && 2 == moved[0].value && 4 == moved[2].value);
+  }
+
+  CHECK(0 == g_alive && 0 == g_outstanding);
+
+  {
+    Small_Vector<Wide, 2> vec;
+
+    for (int i = 0; i < 100; ++i)
+    {
+      CHECK(vec.push_back(Wide { { static_cast<double>(i), -static_cast<double>(i) } }));
+      CHECK(0 == reinterpret_cast<uintptr_t>(vec.data()) % alignof(Wide));
+    }
+    CHECK(99.0 == vec[99].value[0] && -42.0 == vec[42].value[1]);
+  }
+
+  CHECK(0 == g_outstanding);
+}
+
+/**
+ * @brief  静态向量: 满时失败且内容不变，不分配
+ */
+static void test_static_vector(void)
+{
+  Static_Vector<int, 4> vec { 1, 2, 3 };
+
+  CHECK(vec.push_back(4) && vec.full());
+  CHECK(!vec.push_back(5) && nullptr == vec.emplace_back(5) && nullptr == vec.insert(vec.begin(), 0));
+  CHECK(!vec.resize(5) && 4 == vec.size());
+  CHECK(1 == vec[0] && 4 == vec[3] && nullptr == vec.at(4));
+  CHECK(0 == g_outstanding);
+}
+
+/**
+ * @brief  有序平坦映射: 随机操作与 std::map 对照，异构查找，有序迭代
+ */
+static void test_flat_map(void)
+{
+  Flat_Map<uint32_t, uint32_t, 64> map;
+  std::map<uint32_t, uint32_t>     model;
+  uint32_t                         seed = 12345;
+
+  for (uint32_t step = 0; step < 100000; ++step)
+  {
+    uint32_t key = next_random(seed) % 100;
+    uint32_t op  = next_random(seed) % 4;
+    bool     has = 0 != model.count(key);
+
+    if (0 == op)
+    {
+      CHECK(map.insert(key, step) == (!has && model.size() < 64));
+      if (!has && model.size() < 64)
+      {
+        model[key] = step;
+      }
+    }
+    else if (1 == op)
+    {
+      CHECK(map.insert_or_assign(key, step) == (has || model.size() < 64));
+      if (has || model.size() < 64)
+      {
+        model[key] = step;
+      }
+    }
+    else if (2 == op)
+    {
+      CHECK(map.erase(key) == (0 != model.erase(key)));
+    }
+    else
+    {
+      const uint32_t* value = map.find(key);
+      CHECK((nullptr != value) == has);
+      CHECK(nullptr == value || !has || *value == model[key]);
+    }
+  }
+
+  CHECK(map.size() == model.size());
+  CHECK(std::equal(model.begin(), model.end(), map.begin(), [](const std::pair<const uint32_t, uint32_t>& a, const Flat_Map<uint32_t, uint32_t, 64>::Entry& b) {
+    return a.first == b.key && a.second == b.value;
+  }));
+
+  Flat_Map<std::string, int, 8> names;
+  CHECK(names.insert("speed", 1) && names.insert("accel", 2) && names.insert("torque", 3));
+  CHECK(nullptr != names.find("accel") && 2 == *names.find("accel") && !names.contains("jerk"));
+  CHECK(std::string("accel") == names.begin()->key && std::string("speed") == names.lower_bound("s")->key);
+}
+
+/**
+ * @brief  STL连续内存分配器: std::vector 可在字节池中扩容
+ */
+static void test_stl_allocator(void)
+{
+  {
+    std::vector<uint32_t, STL_Continuous_Allocator<uint32_t, 1024>> vec;
+
+    for (uint32_t i = 0; i < 300; ++i)
+    {
+      vec.push_back(i * 3);
+    }
+    CHECK(300 == vec.size() && 897 == vec.back());
+  }
+
+  CHECK(0 == g_outstanding);
+}
+
+/**
+ * @brief  计时运行
+ *
+ * @param  rounds  运行次数
+ * @param  func    被测函数
+ * @return double  每次耗时 (纳秒)
+ */
+template <typename Func>
+static double time_ns(uint32_t rounds, Func&& func)
+{
+  auto start = std::chrono::steady_clock::now();
+
+  for (uint32_t i = 0; i < rounds; ++i)
+  {
+    func(i);
+  }
+
+  return std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count() / rounds;
+}
+
+/**
+ * @brief  基准: 构建/中部插入与 std::vector，查找与 std::map
+ */
+static void bench_containers(void)
+{
+  constexpr uint32_t ROUNDS = 20000;
+
+  volatile uint32_t sink = 0;
+
+  printf("%-24s %10s %14s %14s %14s\n", "operation", "elements", "std:: ns", "Static ns", "Small ns");
+
+  for (uint32_t count : { 8u, 16u, 64u })
+  {
+    double std_ns = time_ns(ROUNDS, [&](uint32_t r) {
+      std::vector<uint32_t> vec;
+      for (uint32_t i = 0; i < count; ++i)
+      {
+        vec.push_back(i ^ r);
+      }
+      sink = sink + vec.back();
+    });
+    double static_ns = time_ns(ROUNDS, [&](uint32_t r) {
+      Static_Vector<uint32_t, 64> vec;
+      for (uint32_t i = 0; i < count; ++i)
+      {
+        vec.push_back(i ^ r);
+      }
+      sink = sink + vec.back();
+    });
+    double small_ns = time_ns(ROUNDS, [&](uint32_t r) {
+      Small_Vector<uint32_t, 16> vec;
+      for (uint32_t i = 0; i < count; ++i)
+      {
+        vec.push_back(i ^ r);
+      }
+      sink = sink + vec.back();
+    });
+    printf("%-24s %10u %14.1f %14.1f %14.1f\n", "push_back (build)", count, std_ns, static_ns, small_ns);
+  }
+
+  for (uint32_t count : { 8u, 16u, 64u })
+  {
+    double std_ns = time_ns(ROUNDS, [&](uint32_t r) {
+      std::vector<Counted> vec;
+      for (uint32_t i = 0; i < count; ++i)
+      {
+        vec.insert(vec.begin() + vec.size() / 2, Counted(static_cast<int>(i ^ r)));
+      }
+      sink = sink + vec.size();
+    });
+    double static_ns = time_ns(ROUNDS, [&](uint32_t r) {
+      Static_Vector<Counted, 64> vec;
+      for (uint32_t i = 0; i < count; ++i)
+      {
+        vec.insert(vec.begin() + vec.size() / 2, Counted(static_cast<int>(i ^ r)));
+      }
+      sink = sink + vec.size();
+    });
+    double small_ns = time_ns(ROUNDS, [&](uint32_t r) {
+      Small_Vector<Counted, 16> vec;
+      for (uint32_t i = 0; i < count; ++i)
+      {
+        vec.insert(vec.begin() + vec.size() / 2, Counted(static_cast<int>(i ^ r)));
+      }
+      sink = sink + vec.size();
+    });
+    printf("%-24s %10u %14.1f %14.1f %14.1f\n", "insert middle (non-triv)", count, std_ns, static_ns, small_ns);
+  }
+
+  printf("%-24s %10s %14s %14s\n", "operation", "keys", "std::map ns", "Flat_Map ns");
+
+  for (uint32_t count : { 16u, 64u, 256u })
+  {
+    std::map<uint32_t, uint32_t>      std_map;
+    Flat_Map<uint32_t, uint32_t, 256> flat_map;
+
+    for (uint32_t i = 0; i < count; ++i)
+    {
+      std_map[i * 7] = i;
+      flat_map.insert(i * 7, i);
+    }
+
+    // 随机顺序的查询键，一半命中
+    std::vector<uint32_t> queries(4096);
+    uint32_t              seed = count;
+    for (uint32_t& query : queries)
+    {
+      query = (next_random(seed) % (count * 2)) * 7 / 2;
+    }
+
+    double std_ns = time_ns(ROUNDS * 16, [&](uint32_t r) {
+      auto it = std_map.find(queries[r & 4095]);
+      sink    = sink + ((std_map.end() != it) ? it->second : 0);
+    });
+    double flat_ns = time_ns(ROUNDS * 16, [&](uint32_t r) {
+      const uint32_t* value = flat_map.find(queries[r & 4095]);
+      sink                  = sink + ((nullptr != value) ? *value : 0);
+    });
+    printf("%-24s %10u %14.1f %14.1f\n", "find (half hits)", count, std_ns, flat_ns);
+  }
+
+  CHECK(0 == g_alive && 0 == g_outstanding);
+}
+
+int main(void)
+{
+  test_model();
+  test_small_vector();
+  test_static_vector();
+  test_flat_map();
+  test_stl_allocator();
+  bench_containers();
+
+  printf("vector_test: %s (%d failures)\n", 0 == g_failures ? "OK" : "FAILED", g_failures);
+  fflush(stdout);
+  return 0 == g_failures ? 0 : 1;
+}
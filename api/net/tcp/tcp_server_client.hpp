@@ -189,6 +189,27 @@ protected:
     return ret;
   }
 
+  /**
+   * @brief  服务器客户端 聚集发送实现 (各段合并为一个数据包链)
+   *
+   * @param  vec        输出向量数组
+   * @param  count      输出向量数量
+   * @return uint32_t   发送大小
+   */
+  template <bool enable = (Type != Device_Type::READ_ONLY), typename = std::enable_if_t<enable>>
+  uint32_t sendv_handler(const system::device::Io_Vec* vec, uint32_t count)
+  {
+    uint32_t ret = 0;
+
+    if ((m_flag & OPEN_FLAG) && count)
+    {
+      ret = Socket::sendv(vec, count, NX_WAIT_FOREVER);
+      static_cast<Client*>(this)->output_complete();
+    }
+
+    return ret;
+  }
+
   /**
    * @brief 服务器客户端 打开实现
    *
@@ -589,7 +610,10 @@ protected:
    * @brief 服务器客户端 构造函数
    *
    */
-  explicit Tcp_Server_Client() {}
+  explicit Tcp_Server_Client()
+  {
+    this->m_manager_lane = system::device::Device_Lane::SLOW;
+  }
 
   /**
    * @brief 服务器客户端 析构函数
@@ -653,6 +677,20 @@ private:
     return Base::send_handler(data, size);
   }
 
+  /**
+   * @brief  服务器客户端 聚集发送实现
+   *
+   * @param  vec        输出向量数组
+   * @param  count      输出向量数量
+   * @param  timeout_ms 超时时间 - 毫秒 (协议栈发送始终等待)
+   * @return uint32_t   发送大小
+   */
+  uint32_t sendv_impl(const system::device::Io_Vec* vec, uint32_t count, uint32_t timeout_ms) override
+  {
+    (void)timeout_ms;
+    return Base::sendv_handler(vec, count);
+  }
+
   /**
    * @brief 服务器客户端 打开实现
    *
@@ -711,7 +749,10 @@ protected:
    * @brief 服务器客户端 构造函数
    *
    */
-  explicit Tcp_Server_Client() {}
+  explicit Tcp_Server_Client()
+  {
+    this->m_manager_lane = system::device::Device_Lane::SLOW;
+  }
 
   /**
    * @brief 服务器客户端 析构函数
@@ -775,6 +816,20 @@ private:
     return Base::send_handler(data, size);
   }
 
+  /**
+   * @brief  服务器客户端 聚集发送实现
+   *
+   * @param  vec        输出向量数组
+   * @param  count      输出向量数量
+   * @param  timeout_ms 超时时间 - 毫秒 (协议栈发送始终等待)
+   * @return uint32_t   发送大小
+   */
+  uint32_t sendv_impl(const system::device::Io_Vec* vec, uint32_t count, uint32_t timeout_ms) override
+  {
+    (void)timeout_ms;
+    return Base::sendv_handler(vec, count);
+  }
+
   /**
    * @brief 服务器客户端 打开实现
    *
@@ -833,7 +888,10 @@ protected:
    * @brief 服务器客户端 构造函数
    *
    */
-  explicit Tcp_Server_Client() {}
+  explicit Tcp_Server_Client()
+  {
+    this->m_manager_lane = system::device::Device_Lane::SLOW;
+  }
 
   /**
    * @brief 服务器客户端 析构函数
@@ -665,6 +665,79 @@ protected:
       {
         nx_packet_release(packet);
 
+#if (SYSTEM_ERROR_LOG_ENABLE && TCP_SOCKET_ERROR_LOG_ENABLE)
+        if (NX_WINDOW_OVERFLOW != status && NX_NOT_CONNECTED != status)
+        {
+          QAQ_ERROR_LOG(status, "TCP Socket Send Failed");
+        }
+#endif /* (SYSTEM_ERROR_LOG_ENABLE && TCP_SOCKET_ERROR_LOG_ENABLE) */
+      }
+    }
+
+    return ret;
+  }
+
+  /**
+   * @brief  TCP套接字 聚集发送数据 (各段追加至同一数据包链，一次提交协议栈)
+   *
+   * @tparam Vec        输出向量类型 (含 data/size 成员)
+   * @param  vec        输出向量数组
+   * @param  count      输出向量数量
+   * @param  timeout    超时时间
+   * @return uint32_t   发送大小
+   */
+  template <typename Vec>
+  uint32_t sendv(const Vec* vec, uint32_t count, uint32_t timeout)
+  {
+    UINT       status = NX_SUCCESS;
+    ULONG      ret    = 0;
+    NX_PACKET* packet = nullptr;
+
+    status            = nx_packet_allocate(Net_Manager::instance().get_pool(), &packet, NX_TCP_PACKET, NX_WAIT_FOREVER);
+
+#if (SYSTEM_ERROR_LOG_ENABLE && TCP_SOCKET_ERROR_LOG_ENABLE)
+    if (NX_SUCCESS != status)
+    {
+      QAQ_ERROR_LOG(status, "TCP Socket Packet Allocate Failed");
+    }
+#endif /* (SYSTEM_ERROR_LOG_ENABLE && TCP_SOCKET_ERROR_LOG_ENABLE) */
+
+    for (uint32_t i = 0; NX_SUCCESS == status && i < count; ++i)
+    {
+      if (0 != vec[i].size)
+      {
+        status = nx_packet_data_append(packet, const_cast<void*>(static_cast<const void*>(vec[i].data)), vec[i].size, Net_Manager::instance().get_pool(), NX_WAIT_FOREVER);
+
+        if (NX_SUCCESS != status)
+        {
+          nx_packet_release(packet);
+#if (SYSTEM_ERROR_LOG_ENABLE && TCP_SOCKET_ERROR_LOG_ENABLE)
+          QAQ_ERROR_LOG(status, "TCP Socket Packet Data Append Failed");
+#endif /* (SYSTEM_ERROR_LOG_ENABLE && TCP_SOCKET_ERROR_LOG_ENABLE) */
+        }
+      }
+    }
+
+    if (NX_SUCCESS == status)
+    {
+      ret = packet->nx_packet_length;
+
+      if (0 == ret)
+      {
+        nx_packet_release(packet);
+        status = NX_INVALID_PACKET;
+      }
+    }
+
+    if (NX_SUCCESS == status)
+    {
+      status = nx_tcp_socket_send(&m_socket, packet, timeout);
+
+      if (NX_SUCCESS != status)
+      {
+        ret = 0;
+        nx_packet_release(packet);
+
 #if (SYSTEM_ERROR_LOG_ENABLE && TCP_SOCKET_ERROR_LOG_ENABLE)
         if (NX_WINDOW_OVERFLOW != status && NX_NOT_CONNECTED != status)
         {
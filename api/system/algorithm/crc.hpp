@@ -0,0 +1,197 @@
+#ifndef __CRC_HPP__
+#define __CRC_HPP__
+
+#include "system_include.hpp"
+
+/// @brief 名称空间 QAQ
+namespace QAQ
+{
+/// @brief 名称空间 系统
+namespace system
+{
+/// @brief 命名空间 内部
+namespace system_internal
+{
+/// @brief 命名空间 算法函数 内部
+namespace algorithm_internal
+{
+/**
+ * @brief CRC-32 查表 (编译期生成)
+ */
+struct Crc32_Table
+{
+  uint32_t value[256];
+
+  /**
+   * @brief  CRC-32 查表 构造函数
+   *
+   * @param  poly  反射多项式
+   */
+  explicit constexpr Crc32_Table(uint32_t poly) : value()
+  {
+    for (uint32_t i = 0; i < 256; ++i)
+    {
+      uint32_t crc = i;
+
+      for (uint32_t bit = 0; bit < 8; ++bit)
+      {
+        crc = (crc >> 1) ^ ((crc & 1U) ? poly : 0U);
+      }
+
+      value[i] = crc;
+    }
+  }
+};
+
+/**
+ * @brief CRC-16 查表 (编译期生成)
+ */
+struct Crc16_Table
+{
+  uint16_t value[256];
+
+  /**
+   * @brief  CRC-16 查表 构造函数
+   *
+   * @param  poly  反射多项式
+   */
+  explicit constexpr Crc16_Table(uint16_t poly) : value()
+  {
+    for (uint32_t i = 0; i < 256; ++i)
+    {
+      uint16_t crc = static_cast<uint16_t>(i);
+
+      for (uint32_t bit = 0; bit < 8; ++bit)
+      {
+        crc = static_cast<uint16_t>((crc >> 1) ^ ((crc & 1U) ? poly : 0U));
+      }
+
+      value[i] = crc;
+    }
+  }
+};
+} /* namespace algorithm_internal */
+} /* namespace system_internal */
+
+/// @brief 命名空间 算法函数
+namespace algorithm
+{
+/**
+ * @brief 循环冗余校验 CRC-32 (IEEE 802.3，反射多项式 0xEDB88320)
+ *
+ * @note  查表法，表在编译期生成并放入 Flash; 支持分段累加:
+ *        crc = update(INIT, a, n); crc = update(crc, b, m); result = finish(crc)
+ */
+class Crc32 final
+{
+private:
+  /// @brief 反射多项式
+  static constexpr uint32_t POLY = 0xEDB88320U;
+
+  /// @brief 查表
+  static constexpr system_internal::algorithm_internal::Crc32_Table TABLE = system_internal::algorithm_internal::Crc32_Table(POLY);
+
+public:
+  /// @brief 初始值
+  static constexpr uint32_t INIT = 0xFFFFFFFFU;
+
+  /**
+   * @brief  CRC-32 累加数据
+   *
+   * @param  crc       当前值 (首段为INIT)
+   * @param  data      数据指针
+   * @param  len       数据长度
+   * @return uint32_t  累加后的值
+   */
+  static uint32_t QAQ_O3 update(uint32_t crc, const void* data, uint32_t len) noexcept
+  {
+    const uint8_t* ptr = static_cast<const uint8_t*>(data);
+
+    while (0 != len--)
+    {
+      crc = (crc >> 8) ^ TABLE.value[(crc ^ *ptr++) & 0xFFU];
+    }
+
+    return crc;
+  }
+
+  /**
+   * @brief  CRC-32 结束计算
+   *
+   * @param  crc       累加值
+   * @return uint32_t  校验值
+   */
+  static constexpr uint32_t finish(uint32_t crc) noexcept
+  {
+    return crc ^ 0xFFFFFFFFU;
+  }
+
+  /**
+   * @brief  CRC-32 计算数据校验值
+   *
+   * @param  data      数据指针
+   * @param  len       数据长度
+   * @return uint32_t  校验值
+   */
+  static QAQ_INLINE uint32_t calculate(const void* data, uint32_t len) noexcept
+  {
+    return finish(update(INIT, data, len));
+  }
+};
+
+/**
+ * @brief 循环冗余校验 CRC-16/MODBUS (反射多项式 0xA001，初始值 0xFFFF，无结果异或)
+ *
+ * @note  查表法，表在编译期生成并放入 Flash; 帧内以低字节在前发送;
+ *        对含校验值的整帧计算结果为0即校验通过
+ */
+class Crc16_Modbus final
+{
+private:
+  /// @brief 反射多项式
+  static constexpr uint16_t POLY = 0xA001U;
+
+  /// @brief 查表
+  static constexpr system_internal::algorithm_internal::Crc16_Table TABLE = system_internal::algorithm_internal::Crc16_Table(POLY);
+
+public:
+  /// @brief 初始值
+  static constexpr uint16_t INIT = 0xFFFFU;
+
+  /**
+   * @brief  CRC-16/MODBUS 累加数据
+   *
+   * @param  crc       当前值 (首段为INIT)
+   * @param  data      数据指针
+   * @param  len       数据长度
+   * @return uint16_t  累加后的值
+   */
+  static uint16_t QAQ_O3 update(uint16_t crc, const void* data, uint32_t len) noexcept
+  {
+    const uint8_t* ptr = static_cast<const uint8_t*>(data);
+
+    while (0 != len--)
+    {
+      crc = static_cast<uint16_t>((crc >> 8) ^ TABLE.value[(crc ^ *ptr++) & 0xFFU]);
+    }
+
+    return crc;
+  }
+
+  /**
+   * @brief  CRC-16/MODBUS 计算数据校验值
+   *
+   * @param  data      数据指针
+   * @param  len       数据长度
+   * @return uint16_t  校验值
+   */
+  static QAQ_INLINE uint16_t calculate(const void* data, uint32_t len) noexcept
+  {
+    return update(INIT, data, len);
+  }
+};
+} /* namespace algorithm */
+} /* namespace system */
+} /* namespace QAQ */
+
+#endif /* __CRC_HPP__ */
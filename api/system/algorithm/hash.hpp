@@ -0,0 +1,156 @@
+#ifndef __HASH_HPP__
+#define __HASH_HPP__
+
+#include "system_include.hpp"
+
+/// @brief 名称空间 QAQ
+namespace QAQ
+{
+/// @brief 名称空间 系统
+namespace system
+{
+/// @brief 命名空间 算法函数
+namespace algorithm
+{
+/**
+ * @brief 哈希函数 (非加密)
+ *
+ * @note  字节序列哈希采用 wyhash32 结构: 每轮8字节，32x32->64 乘法混合，
+ *        Cortex-M7 上单周期 UMULL，无需64位乘法；结果仅用于查找表，不可用于安全用途
+ */
+class Hash final
+{
+private:
+  /// @brief 混合常量 0
+  static constexpr uint32_t MIX_0 = 0x53C5CA59U;
+  /// @brief 混合常量 1
+  static constexpr uint32_t MIX_1 = 0x74743C1BU;
+
+  /**
+   * @brief  哈希函数 读取32位小端数据
+   *
+   * @param  ptr       数据指针 (无对齐要求)
+   * @return uint32_t  数据
+   */
+  static QAQ_INLINE uint32_t read_32(const uint8_t* ptr) noexcept
+  {
+    uint32_t value;
+    memcpy(&value, ptr, sizeof(value));
+    return value;
+  }
+
+  /**
+   * @brief  哈希函数 读取1~3字节数据
+   *
+   * @param  ptr       数据指针
+   * @param  len       数据长度 (1~3)
+   * @return uint32_t  数据
+   */
+  static QAQ_INLINE uint32_t read_24(const uint8_t* ptr, uint32_t len) noexcept
+  {
+    return (static_cast<uint32_t>(ptr[0]) << 16) | (static_cast<uint32_t>(ptr[len >> 1]) << 8) | ptr[len - 1];
+  }
+
+  /**
+   * @brief  哈希函数 乘法混合
+   *
+   * @param  a  状态 A (输出低32位)
+   * @param  b  状态 B (输出高32位)
+   */
+  static QAQ_INLINE void mix(uint32_t& a, uint32_t& b) noexcept
+  {
+    uint64_t c  = a ^ MIX_0;
+    c          *= b ^ MIX_1;
+    a           = static_cast<uint32_t>(c);
+    b           = static_cast<uint32_t>(c >> 32);
+  }
+
+public:
+  /// @brief 默认种子
+  static constexpr uint32_t DEFAULT_SEED = 0x9E3779B9U;
+
+  /**
+   * @brief  哈希函数 计算字节序列哈希
+   *
+   * @param  data      数据指针
+   * @param  len       数据长度
+   * @param  seed      种子
+   * @return uint32_t  哈希值
+   */
+  static uint32_t QAQ_O3 hash(const void* data, uint32_t len, uint32_t seed = DEFAULT_SEED) noexcept
+  {
+    const uint8_t* ptr    = static_cast<const uint8_t*>(data);
+    uint32_t       remain = len;
+    uint32_t       see1   = len;
+
+    mix(seed, see1);
+
+    for (; 8 < remain; remain -= 8, ptr += 8)
+    {
+      seed ^= read_32(ptr);
+      see1 ^= read_32(ptr + 4);
+      mix(seed, see1);
+    }
+
+    if (4 <= remain)
+    {
+      seed ^= read_32(ptr);
+      see1 ^= read_32(ptr + remain - 4);
+    }
+    else if (0 < remain)
+    {
+      seed ^= read_24(ptr, remain);
+    }
+
+    mix(seed, see1);
+    mix(seed, see1);
+    return seed ^ see1;
+  }
+
+  /**
+   * @brief  哈希函数 计算32位整数哈希 (murmur3 fmix32)
+   *
+   * @param  value     整数
+   * @return uint32_t  哈希值
+   */
+  static QAQ_INLINE uint32_t hash(uint32_t value) noexcept
+  {
+    value ^= value >> 16;
+    value *= 0x85EBCA6BU;
+    value ^= value >> 13;
+    value *= 0xC2B2AE35U;
+    value ^= value >> 16;
+    return value;
+  }
+
+  /**
+   * @brief  哈希函数 计算64位整数哈希
+   *
+   * @param  value     整数
+   * @return uint32_t  哈希值
+   */
+  static QAQ_INLINE uint32_t hash(uint64_t value) noexcept
+  {
+    uint32_t low  = static_cast<uint32_t>(value);
+    uint32_t high = static_cast<uint32_t>(value >> 32);
+    mix(low, high);
+    return low ^ high;
+  }
+
+  /**
+   * @brief  哈希函数 合并哈希值
+   *
+   * @param  seed      已有哈希值
+   * @param  value     新哈希值
+   * @return uint32_t  合并后的哈希值
+   */
+  static QAQ_INLINE uint32_t combine(uint32_t seed, uint32_t value) noexcept
+  {
+    return seed ^ (value + 0x9E3779B9U + (seed << 6) + (seed >> 2));
+  }
+};
+} /* namespace algorithm */
+} /* namespace system */
+} /* namespace QAQ */
+
+#endif /* __HASH_HPP__ */
@@ -0,0 +1,594 @@
+#ifndef __ASYNC_IO_HPP__
+#define __ASYNC_IO_HPP__
+
+#include "device_base.hpp"
+
+/// @brief 名称空间 QAQ
+namespace QAQ
+{
+/// @brief 名称空间 系统
+namespace system
+{
+/// @brief 名称空间 设备
+namespace device
+{
+struct Io_Request;
+
+/// @brief 异步请求 完成回调函数类型 (设备管理器线程中执行)
+using Io_Callback_Func_t = void (*)(Io_Request& request, void* arg);
+
+/// @brief 异步请求 状态
+enum class Io_Status : uint8_t
+{
+  IDLE,      /* 空闲 */
+  PENDING,   /* 排队或传输中 */
+  DONE,      /* 已完成 */
+  FAILED,    /* 失败 */
+  CANCELLED, /* 已取消 */
+};
+
+/// @brief 异步请求 操作类型
+enum class Io_Op : uint8_t
+{
+  READ,  /* 读 */
+  WRITE, /* 写 */
+};
+
+/**
+ * @brief 异步请求 (由调用方持有，完成回调执行前不可释放或复用)
+ *
+ * @note  读请求在有数据可读时即完成 (至少1字节)，写请求在数据全部交给设备后完成;
+ *        result 为实际传输大小，失败或取消时为-1
+ */
+struct Io_Request
+{
+  void*              data     = nullptr;         /* 数据缓存区 */
+  uint32_t           size     = 0;               /* 数据大小 */
+  uint32_t           address  = 0;               /* 储存设备地址 */
+  Io_Callback_Func_t function = nullptr;         /* 完成回调函数 */
+  void*              arg      = nullptr;         /* 完成回调函数参数 */
+  int64_t            result   = 0;               /* 传输结果 */
+  uint32_t           done     = 0;               /* 已传输大小 */
+  volatile Io_Status status   = Io_Status::IDLE; /* 状态 */
+  Io_Op              op       = Io_Op::READ;     /* 操作类型 (提交时设置) */
+  Io_Request*        next     = nullptr;         /* 队列链接 (内部使用) */
+
+  /**
+   * @brief  异步请求 设置参数
+   *
+   * @param  data_ptr      数据缓存区
+   * @param  data_size     数据大小
+   * @param  callback      完成回调函数
+   * @param  callback_arg  完成回调函数参数
+   * @param  addr          储存设备地址
+   */
+  void prepare(void* data_ptr, uint32_t data_size, Io_Callback_Func_t callback, void* callback_arg, uint32_t addr = 0)
+  {
+    data     = data_ptr;
+    size     = data_size;
+    address  = addr;
+    function = callback;
+    arg      = callback_arg;
+    result   = 0;
+    done     = 0;
+  }
+
+  /**
+   * @brief  异步请求 是否已结束 (完成、失败或取消)
+   *
+   * @return true   已结束
+   * @return false  空闲或进行中
+   */
+  bool finished(void) const
+  {
+    return Io_Status::IDLE != status && Io_Status::PENDING != status;
+  }
+};
+
+/**
+ * @brief  异步请求 信号完成回调 (将请求指针作为信号参数发出)
+ *
+ * @tparam Signal_Type  信号类型 (参数为 Io_Request*)
+ * @param  request      异步请求
+ * @param  arg          信号指针
+ * @note   用法: request.prepare(data, size, io_signal_handler<Signal<Io_Request*>>, &signal)
+ */
+template <typename Signal_Type>
+void io_signal_handler(Io_Request& request, void* arg)
+{
+  static_cast<Signal_Type*>(arg)->emit(&request, 0);
+}
+} /* namespace device */
+
+/// @brief 命名空间 内部
+namespace system_internal
+{
+/// @brief 名称空间 设备 内部
+namespace device_internal
+{
+/**
+ * @brief 异步请求队列 (侵入式单向链表，调用方负责互斥)
+ */
+class Io_Request_List
+{
+private:
+  /// @brief 队列头
+  device::Io_Request* m_head = nullptr;
+  /// @brief 队列尾
+  device::Io_Request* m_tail = nullptr;
+
+public:
+  /**
+   * @brief  异步请求队列 入队
+   *
+   * @param  request  异步请求
+   */
+  void push(device::Io_Request& request)
+  {
+    request.next = nullptr;
+
+    if (nullptr == m_tail)
+    {
+      m_head = &request;
+    }
+    else
+    {
+      m_tail->next = &request;
+    }
+
+    m_tail = &request;
+  }
+
+  /**
+   * @brief  异步请求队列 出队
+   *
+   * @return Io_Request*  队首请求，队列为空返回nullptr
+   */
+  device::Io_Request* pop(void)
+  {
+    device::Io_Request* request = m_head;
+
+    if (nullptr != request)
+    {
+      m_head        = request->next;
+      request->next = nullptr;
+
+      if (nullptr == m_head)
+      {
+        m_tail = nullptr;
+      }
+    }
+
+    return request;
+  }
+
+  /**
+   * @brief  异步请求队列 移除指定请求
+   *
+   * @param  request  异步请求
+   * @return true     已移除
+   * @return false    不在队列中
+   */
+  bool remove(device::Io_Request& request)
+  {
+    device::Io_Request* prev = nullptr;
+
+    for (device::Io_Request* node = m_head; nullptr != node; prev = node, node = node->next)
+    {
+      if (node == &request)
+      {
+        if (nullptr == prev)
+        {
+          m_head = node->next;
+        }
+        else
+        {
+          prev->next = node->next;
+        }
+
+        if (m_tail == node)
+        {
+          m_tail = prev;
+        }
+
+        node->next = nullptr;
+        return true;
+      }
+    }
+
+    return false;
+  }
+
+  /**
+   * @brief  异步请求队列 获取队首请求
+   *
+   * @return Io_Request*  队首请求，队列为空返回nullptr
+   */
+  device::Io_Request* front(void) const
+  {
+    return m_head;
+  }
+
+  /**
+   * @brief  异步请求队列 是否为空
+   *
+   * @return true   为空
+   * @return false  不为空
+   */
+  bool empty(void) const
+  {
+    return nullptr == m_head;
+  }
+};
+
+/**
+ * @brief 异步输入输出 (设备侧请求队列与完成分发)
+ *
+ * @note  提交与完成可在任务或中断中调用; 数据搬运与完成回调在设备管理器线程中执行 (async_handler)，
+ *        回调执行时不持有中断保护，可在回调中再次提交请求
+ */
+class Async_Io
+{
+  // 禁止拷贝和移动
+  QAQ_NO_COPY_MOVE(Async_Io)
+
+private:
+  /// @brief 待处理读请求
+  Io_Request_List     m_reads;
+  /// @brief 待处理写请求
+  Io_Request_List     m_writes;
+  /// @brief 按提交顺序执行的读写请求
+  Io_Request_List     m_ordered;
+  /// @brief 已完成请求
+  Io_Request_List     m_done;
+  /// @brief 正在由硬件发送的写请求
+  device::Io_Request* m_active_write = nullptr;
+
+  /**
+   * @brief  异步输入输出 请求结束 (调用方持有中断保护)
+   *
+   * @param  request  异步请求
+   * @param  status   结束状态
+   * @param  result   传输结果
+   */
+  void finish(device::Io_Request& request, device::Io_Status status, int64_t result)
+  {
+    request.result = result;
+    request.status = status;
+    m_done.push(request);
+  }
+
+public:
+  /**
+   * @brief  异步输入输出 构造函数
+   */
+  explicit Async_Io() {}
+
+  /**
+   * @brief  异步输入输出 提交读请求
+   *
+   * @param  request  异步请求
+   * @return true     提交成功
+   * @return false    请求正在进行中
+   */
+  bool submit_read(device::Io_Request& request)
+  {
+    kernel::Interrupt_Guard lock;
+    bool                    ret = (device::Io_Status::PENDING != request.status);
+
+    if (ret)
+    {
+      request.done   = 0;
+      request.op     = device::Io_Op::READ;
+      request.status = device::Io_Status::PENDING;
+      m_reads.push(request);
+    }
+
+    return ret;
+  }
+
+  /**
+   * @brief  异步输入输出 提交写请求
+   *
+   * @param  request  异步请求
+   * @return true     提交成功
+   * @return false    请求正在进行中
+   */
+  bool submit_write(device::Io_Request& request)
+  {
+    kernel::Interrupt_Guard lock;
+    bool                    ret = (device::Io_Status::PENDING != request.status);
+
+    if (ret)
+    {
+      request.done   = 0;
+      request.op     = device::Io_Op::WRITE;
+      request.status = device::Io_Status::PENDING;
+      m_writes.push(request);
+    }
+
+    return ret;
+  }
+
+  /**
+   * @brief  异步输入输出 提交按顺序执行的读写请求 (读写共用一个队列，同步执行请求的设备使用，
+   *         保证同一地址先写后读时读到新数据)
+   *
+   * @param  request  异步请求
+   * @param  op       操作类型
+   * @return true     提交成功
+   * @return false    请求正在进行中
+   */
+  bool submit(device::Io_Request& request, device::Io_Op op)
+  {
+    kernel::Interrupt_Guard lock;
+    bool                    ret = (device::Io_Status::PENDING != request.status);
+
+    if (ret)
+    {
+      request.done   = 0;
+      request.op     = op;
+      request.status = device::Io_Status::PENDING;
+      m_ordered.push(request);
+    }
+
+    return ret;
+  }
+
+  /**
+   * @brief  异步输入输出 取消尚未开始传输的请求 (完成回调照常执行，状态为CANCELLED)
+   *
+   * @param  request  异步请求
+   * @return true     已取消
+   * @return false    请求不在等待队列中
+   */
+  bool cancel(device::Io_Request& request)
+  {
+    kernel::Interrupt_Guard lock;
+    bool                    ret = m_reads.remove(request) || m_writes.remove(request) || m_ordered.remove(request);
+
+    if (ret)
+    {
+      finish(request, device::Io_Status::CANCELLED, -1);
+    }
+
+    return ret;
+  }
+
+  /**
+   * @brief  异步输入输出 取消所有请求 (设备关闭时调用，正在发送的写请求一并取消)
+   */
+  void cancel_all(void)
+  {
+    kernel::Interrupt_Guard lock;
+    device::Io_Request*     request = nullptr;
+
+    while (nullptr != (request = m_reads.pop()))
+    {
+      finish(*request, device::Io_Status::CANCELLED, -1);
+    }
+
+    while (nullptr != (request = m_writes.pop()))
+    {
+      finish(*request, device::Io_Status::CANCELLED, -1);
+    }
+
+    while (nullptr != (request = m_ordered.pop()))
+    {
+      finish(*request, device::Io_Status::CANCELLED, -1);
+    }
+
+    if (nullptr != m_active_write)
+    {
+      finish(*m_active_write, device::Io_Status::CANCELLED, -1);
+      m_active_write = nullptr;
+    }
+  }
+
+  /**
+   * @brief  异步输入输出 是否有待处理读请求
+   *
+   * @return true   有
+   * @return false  无
+   */
+  bool has_reads(void) const
+  {
+    return !m_reads.empty();
+  }
+
+  /**
+   * @brief  异步输入输出 是否有待处理或正在发送的写请求
+   *
+   * @return true   有
+   * @return false  无
+   */
+  bool has_writes(void) const
+  {
+    return !m_writes.empty() || nullptr != m_active_write;
+  }
+
+  /**
+   * @brief  异步输入输出 从输入缓存区满足读请求 (设备管理器线程中调用)
+   *
+   * @tparam Buffer    输入缓存区类型
+   * @param  buffer    输入缓存区
+   * @return uint32_t  完成的请求数
+   */
+  template <typename Buffer>
+  uint32_t fill_reads(Buffer& buffer)
+  {
+    uint32_t count = 0;
+
+    while (!buffer.empty())
+    {
+      device::Io_Request* request = pop_read();
+
+      if (nullptr == request)
+      {
+        break;
+      }
+
+      complete(*request, (0 == request->size) ? 0 : buffer.read(static_cast<uint8_t*>(request->data), request->size));
+      ++count;
+    }
+
+    return count;
+  }
+
+  /**
+   * @brief  异步输入输出 将写请求数据写入输出缓存区 (设备管理器线程中调用)
+   *
+   * @tparam Buffer    输出缓存区类型
+   * @param  buffer    输出缓存区
+   * @return uint32_t  写入的数据大小
+   * @note   部分写入的请求作为正在发送的写请求保留，缓存区有空间后继续写入
+   */
+  template <typename Buffer>
+  uint32_t drain_writes(Buffer& buffer)
+  {
+    uint32_t total = 0;
+
+    while (!buffer.full())
+    {
+      device::Io_Request* request = m_active_write;
+
+      if (nullptr == request && nullptr == (request = start_write()))
+      {
+        break;
+      }
+
+      const uint32_t bytes  = buffer.write(static_cast<const uint8_t*>(request->data) + request->done, request->size - request->done);
+      request->done        += bytes;
+      total                += bytes;
+
+      if (request->done == request->size)
+      {
+        finish_write(true);
+      }
+    }
+
+    return total;
+  }
+
+  /**
+   * @brief  异步输入输出 取出下一个写请求作为正在发送的写请求
+   *
+   * @return Io_Request*  写请求，已有写请求在发送或队列为空返回nullptr
+   */
+  device::Io_Request* start_write(void)
+  {
+    kernel::Interrupt_Guard lock;
+    device::Io_Request*     request = nullptr;
+
+    if (nullptr == m_active_write)
+    {
+      request        = m_writes.pop();
+      m_active_write = request;
+    }
+
+    return request;
+  }
+
+  /**
+   * @brief  异步输入输出 正在发送的写请求结束 (可在中断中调用)
+   *
+   * @param  ok     是否成功
+   * @return true   存在正在发送的写请求
+   * @return false  不存在
+   */
+  bool finish_write(bool ok)
+  {
+    kernel::Interrupt_Guard lock;
+    device::Io_Request*     request = m_active_write;
+
+    if (nullptr != request)
+    {
+      m_active_write = nullptr;
+
+      if (ok)
+      {
+        finish(*request, device::Io_Status::DONE, request->done);
+      }
+      else
+      {
+        finish(*request, device::Io_Status::FAILED, -1);
+      }
+    }
+
+    return nullptr != request;
+  }
+
+  /**
+   * @brief  异步输入输出 结束指定请求 (同步执行请求的设备使用)
+   *
+   * @param  request  异步请求
+   * @param  result   传输结果，小于0表示失败
+   */
+  void complete(device::Io_Request& request, int64_t result)
+  {
+    kernel::Interrupt_Guard lock;
+    finish(request, (result < 0) ? device::Io_Status::FAILED : device::Io_Status::DONE, result);
+  }
+
+  /**
+   * @brief  异步输入输出 取出下一个待处理读请求 (同步执行请求的设备使用)
+   *
+   * @return Io_Request*  读请求，队列为空返回nullptr
+   */
+  device::Io_Request* pop_read(void)
+  {
+    kernel::Interrupt_Guard lock;
+    return m_reads.pop();
+  }
+
+  /**
+   * @brief  异步输入输出 取出下一个按顺序执行的读写请求 (同步执行请求的设备使用)
+   *
+   * @return Io_Request*  异步请求，队列为空返回nullptr
+   */
+  device::Io_Request* pop(void)
+  {
+    kernel::Interrupt_Guard lock;
+    return m_ordered.pop();
+  }
+
+  /**
+   * @brief  异步输入输出 执行已完成请求的回调
+   *
+   * @return uint32_t  执行的回调数
+   */
+  uint32_t dispatch(void)
+  {
+    uint32_t count = 0;
+
+    while (true)
+    {
+      device::Io_Request* request = nullptr;
+
+      {
+        kernel::Interrupt_Guard lock;
+        request = m_done.pop();
+      }
+
+      if (nullptr == request)
+      {
+        break;
+      }
+
+      if (nullptr != request->function)
+      {
+        request->function(*request, request->arg);
+      }
+
+      ++count;
+    }
+
+    return count;
+  }
+};
+} /* namespace device_internal */
+} /* namespace system_internal */
+} /* namespace system */
+} /* namespace QAQ */
+
+#endif /* __ASYNC_IO_HPP__ */
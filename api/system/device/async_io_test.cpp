@@ -0,0 +1,515 @@
+/**
+ * @file   async_io_test.cpp
+ * @brief  异步输入输出 主机测试: 请求队列、流设备 (带/不带输出缓存区) 与储存设备的提交/完成/取消、
+ *         同一设备多请求排队与完成顺序、关闭时取消，以及单个设备管理器线程驱动多个回环设备的吞吐基准
+ *
+ * @note   仅用于主机，不参与固件编译 (已加入 eide excludeList);
+ *         内核由 host_kernel.hpp 仿真 (设备管理器通道线程为主机线程)，完成回调在通道线程中执行;
+ *         基准耗时请以不带 sanitizer 的 -O2 构建为准
+ *
+ *         构建 (仓库根目录):
+ *         g++ -std=c++17 -O2 -g -fsanitize=address,undefined -fpermissive -w \
+ *             $(python3 -c "import json;c=json.load(open('.eide/eide.json'))['targets']['Debug']['custom_dep'];print(' '.join(['-I'+p for p in c['incList']]+['-D'+d for d in c['defineList']]))") \
+ *             api/system/device/async_io_test.cpp -o async_io_test -lpthread && ./async_io_test
+ */
+#include "host_kernel.hpp"
+#include "loopback_device.hpp"
+#include "ram_storage_device.hpp"
+
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace QAQ::system::device;
+
+/* 主机测试不使用信号，对象析构时断开连接为空操作 */
+namespace QAQ
+{
+namespace system
+{
+namespace system_internal
+{
+namespace signal_internal
+{
+class Null_Signal_Manager final : public Signal_Manager_Base
+{
+};
+
+Null_Signal_Manager  g_null_signal_manager;
+Signal_Manager_Base* __signal_manager_base = &g_null_signal_manager;
+} /* namespace signal_internal */
+} /* namespace system_internal */
+} /* namespace system */
+} /* namespace QAQ */
+
+namespace
+{
+/// @brief 失败的检查数
+int g_failures = 0;
+
+#define CHECK(cond)                                                  \
+  do                                                                 \
+  {                                                                  \
+    if (!(cond))                                                     \
+    {                                                                \
+      ++g_failures;                                                  \
+      printf("%s:%d: CHECK(%s) failed\n", __FILE__, __LINE__, #cond); \
+    }                                                                \
+  } while (0)
+
+using Io_Request_List = QAQ::system::system_internal::device_internal::Io_Request_List;
+
+/**
+ * @brief 无输出缓存区的捕获设备 (send_impl 记录发送内容，fail 为真时发送失败)
+ */
+class Capture_Device final : public Stream_Device<Stream_Type::READ_WRITE, 256, 0, QAQ::system::memory::Ring_Buffer_Mode::INPUT_SINGLE_BUFFER>
+{
+  uint32_t send_impl(const uint8_t* data, uint32_t size) override
+  {
+    if (m_fail)
+    {
+      return 0;
+    }
+
+    m_wire.append(reinterpret_cast<const char*>(data), size);
+    output_complete();
+    return size;
+  }
+
+  void manger_handler(uint32_t) override {}
+
+  Device_Error_Code open_impl(void) override
+  {
+    return Device_Error_Code::OK;
+  }
+
+  Device_Error_Code close_impl(void) override
+  {
+    return Device_Error_Code::OK;
+  }
+
+  Device_Error_Code config_impl(uint32_t, uint32_t) override
+  {
+    return Device_Error_Code::INVALID_PARAMETER;
+  }
+
+  uint32_t get_config_impl(uint32_t) const override
+  {
+    return 0;
+  }
+
+public:
+  /// @brief 线路内容
+  std::string      m_wire;
+  /// @brief 发送失败
+  std::atomic_bool m_fail = false;
+};
+
+/// @brief 基准回环设备数
+constexpr uint32_t DEVICES = 4;
+
+/// @brief 回环设备
+Loopback_Device<256>     g_loopback[DEVICES];
+/// @brief 捕获设备
+Capture_Device           g_capture;
+/// @brief 内存储存设备
+Ram_Storage_Device<4096> g_storage;
+
+/// @brief 完成回调次数
+std::atomic<uint32_t> g_completions{ 0 };
+/// @brief 是否有完成回调在测试主线程中执行
+std::atomic_bool      g_on_main_thread{ false };
+/// @brief 测试主线程
+std::thread::id       g_main_thread;
+
+/**
+ * @brief  完成回调: 计数并记录执行线程
+ *
+ * @param  request  异步请求
+ * @param  arg      完成顺序记录 (可为空)
+ */
+void on_complete(Io_Request& request, void* arg)
+{
+  if (std::this_thread::get_id() == g_main_thread)
+  {
+    g_on_main_thread = true;
+  }
+
+  if (nullptr != arg)
+  {
+    static_cast<std::vector<Io_Request*>*>(arg)->push_back(&request);
+  }
+
+  ++g_completions;
+}
+
+/**
+ * @brief  等待完成回调次数达到目标
+ *
+ * @param  target      目标次数
+ * @param  timeout_ms  超时时间 - 毫秒
+ * @return true        已达到
+ * @return false       超时
+ */
+bool wait_completions(uint32_t target, uint32_t timeout_ms = 1000)
+{
+  const auto deadline = std::chrono::steady_clock::now() + std::chrono::milliseconds(timeout_ms);
+
+  while (g_completions < target && std::chrono::steady_clock::now() < deadline)
+  {
+    std::this_thread::sleep_for(std::chrono::microseconds(100));
+  }
+
+  return g_completions >= target;
+}
+} /* namespace */
+
+/**
+ * @brief  测试: 请求队列入队、出队、移除
+ */
+static void test_request_list(void)
+{
+  Io_Request_List list;
+  Io_Request      a;
+  Io_Request      b;
+  Io_Request      c;
+
+  CHECK(list.empty() && nullptr == list.pop());
+  list.push(a);
+  list.push(b);
+  list.push(c);
+  CHECK(&a == list.front());
+
+  // 移除中间与末尾，再入队接到新的末尾
+  CHECK(list.remove(b));
+  CHECK(!list.remove(b));
+  CHECK(list.remove(c));
+  list.push(b);
+  CHECK(&a == list.pop());
+  CHECK(&b == list.pop());
+  CHECK(nullptr == list.pop() && list.empty());
+
+  // 移除唯一元素后队列为空
+  list.push(c);
+  CHECK(list.remove(c));
+  CHECK(list.empty() && nullptr == list.front());
+  list.push(a);
+  CHECK(&a == list.pop());
+}
+
+/**
+ * @brief  测试: 带输出缓存区的回环设备排队多个读写请求，回调在设备管理器线程中按顺序完成
+ */
+static void test_stream_async(void)
+{
+  Loopback_Device<256>&    dev = g_loopback[0];
+  std::vector<Io_Request*> order;
+  char                     message[4][16];
+  char                     received[64];
+  Io_Request               writes[4];
+  Io_Request               read;
+
+  g_completions = 0;
+  CHECK(Device_Error_Code::NOT_OPENED == dev.submit_write(writes[0]));
+  CHECK(Device_Error_Code::OK == dev.open());
+
+  // 同一设备排队4个写请求
+  for (uint32_t i = 0; i < 4; ++i)
+  {
+    snprintf(message[i], sizeof(message[i]), "message-%07u", i);
+    writes[i].prepare(message[i], 16, on_complete, &order);
+    CHECK(Device_Error_Code::OK == dev.submit_write(writes[i]));
+  }
+
+  CHECK(wait_completions(4));
+  CHECK(4 == order.size());
+
+  for (uint32_t i = 0; i < 4 && i < order.size(); ++i)
+  {
+    CHECK(&writes[i] == order[i]);
+    CHECK(Io_Status::DONE == writes[i].status && 16 == writes[i].result);
+  }
+
+  // 读请求有数据即完成，重复提交直至收齐
+  uint32_t total = 0;
+
+  while (total < sizeof(received))
+  {
+    const uint32_t target = g_completions + 1;
+    read.prepare(received + total, sizeof(received) - total, on_complete, nullptr);
+    CHECK(Device_Error_Code::OK == dev.submit_read(read));
+
+    if (!wait_completions(target) || read.result <= 0)
+    {
+      break;
+    }
+
+    total += static_cast<uint32_t>(read.result);
+  }
+
+  CHECK(sizeof(received) == total);
+  CHECK(0 == memcmp(received, message, sizeof(received)));
+
+  // 进行中的请求不可重复提交，取消等待中的请求
+  uint32_t target = g_completions + 1;
+  read.prepare(received, sizeof(received), on_complete, nullptr);
+  CHECK(Device_Error_Code::OK == dev.submit_read(read));
+  CHECK(Device_Error_Code::BUSY == dev.submit_read(read));
+  CHECK(dev.cancel(read));
+  CHECK(!dev.cancel(read));
+  CHECK(Io_Status::CANCELLED == read.status && -1 == read.result);
+  CHECK(wait_completions(target));
+
+  // 关闭时取消等待中的读请求
+  target = g_completions + 1;
+  read.prepare(received, sizeof(received), on_complete, nullptr);
+  CHECK(Device_Error_Code::OK == dev.submit_read(read));
+  CHECK(Device_Error_Code::OK == dev.close());
+  CHECK(wait_completions(target));
+  CHECK(Io_Status::CANCELLED == read.status);
+
+  CHECK(!g_on_main_thread);
+}
+
+/**
+ * @brief  测试: 无输出缓存区的设备逐个启动写请求，发送失败时请求失败
+ */
+static void test_unbuffered_async(void)
+{
+  std::vector<Io_Request*> order;
+  Io_Request               writes[3];
+  const char*              text[3] = { "alpha", "beta", "gamma" };
+
+  g_completions = 0;
+  g_capture.m_wire.clear();
+  CHECK(Device_Error_Code::OK == g_capture.open());
+
+  for (uint32_t i = 0; i < 3; ++i)
+  {
+    writes[i].prepare(const_cast<char*>(text[i]), static_cast<uint32_t>(strlen(text[i])), on_complete, &order);
+    CHECK(Device_Error_Code::OK == g_capture.submit_write(writes[i]));
+  }
+
+  CHECK(wait_completions(3));
+  CHECK("alphabetagamma" == g_capture.m_wire);
+  CHECK(3 == order.size() && &writes[0] == order[0] && &writes[2] == order[2]);
+  CHECK(Io_Status::DONE == writes[1].status && 4 == writes[1].result);
+
+  g_capture.m_fail = true;
+  writes[0].prepare(const_cast<char*>(text[0]), 5, on_complete, nullptr);
+  CHECK(Device_Error_Code::OK == g_capture.submit_write(writes[0]));
+  CHECK(wait_completions(4));
+  CHECK(Io_Status::FAILED == writes[0].status && -1 == writes[0].result);
+  g_capture.m_fail = false;
+
+  CHECK(Device_Error_Code::OK == g_capture.close());
+}
+
+/**
+ * @brief  测试: 储存设备异步读写按提交顺序执行 (先写后读读到新数据，先读后写读到旧数据)，越界失败
+ */
+static void test_storage_async(void)
+{
+  uint8_t    before[32];
+  uint8_t    pattern[32];
+  uint8_t    after[32];
+  Io_Request requests[4];
+
+  g_completions = 0;
+  CHECK(Device_Error_Code::OK == g_storage.open());
+  CHECK(32 == g_storage.erase(0, 32));
+
+  for (uint32_t i = 0; i < sizeof(pattern); ++i)
+  {
+    pattern[i] = static_cast<uint8_t>(i * 3);
+  }
+
+  // 一次提交: 读 - 写 - 读 - 越界写
+  requests[0].prepare(before, sizeof(before), on_complete, nullptr, 0);
+  requests[1].prepare(pattern, sizeof(pattern), on_complete, nullptr, 0);
+  requests[2].prepare(after, sizeof(after), on_complete, nullptr, 0);
+  requests[3].prepare(pattern, sizeof(pattern), on_complete, nullptr, 4090);
+  CHECK(Device_Error_Code::OK == g_storage.submit_read(requests[0]));
+  CHECK(Device_Error_Code::OK == g_storage.submit_write(requests[1]));
+  CHECK(Device_Error_Code::OK == g_storage.submit_read(requests[2]));
+  CHECK(Device_Error_Code::OK == g_storage.submit_write(requests[3]));
+  CHECK(wait_completions(4));
+
+  CHECK(Io_Status::DONE == requests[0].status && 0xFF == before[0] && 0xFF == before[31]);
+  CHECK(Io_Status::DONE == requests[1].status && 32 == requests[1].result);
+  CHECK(Io_Status::DONE == requests[2].status && 0 == memcmp(after, pattern, sizeof(pattern)));
+  CHECK(Io_Status::FAILED == requests[3].status);
+
+  CHECK(Device_Error_Code::OK == g_storage.close());
+  CHECK(Device_Error_Code::NOT_OPENED == g_storage.submit_read(requests[0]));
+}
+
+/// @brief 基准消息大小
+constexpr uint32_t MESSAGE = 32;
+
+/// @brief 基准: 单个回环设备的异步收发状态
+struct Echo_Channel
+{
+  Loopback_Device<256>* device;
+  char                  message[MESSAGE];
+  char                  inbox[MESSAGE];
+  Io_Request            write;
+  Io_Request            read;
+  uint32_t              sent;
+  uint32_t              received;
+  uint32_t              rounds;
+  std::atomic_bool      finished;
+};
+
+/**
+ * @brief  基准: 写完成回调 (继续发送下一条消息)
+ */
+static void echo_written(Io_Request& request, void* arg)
+{
+  Echo_Channel& channel = *static_cast<Echo_Channel*>(arg);
+
+  if (Io_Status::DONE == request.status && ++channel.sent < channel.rounds)
+  {
+    request.prepare(channel.message, MESSAGE, echo_written, &channel);
+    channel.device->submit_write(request);
+  }
+}
+
+/**
+ * @brief  基准: 读完成回调 (累计接收字节并继续读取)
+ */
+static void echo_read(Io_Request& request, void* arg)
+{
+  Echo_Channel& channel = *static_cast<Echo_Channel*>(arg);
+
+  if (Io_Status::DONE != request.status)
+  {
+    channel.finished = true;
+    return;
+  }
+
+  channel.received += static_cast<uint32_t>(request.result);
+
+  if (channel.received >= channel.rounds * MESSAGE)
+  {
+    channel.finished = true;
+  }
+  else
+  {
+    request.prepare(channel.inbox, MESSAGE, echo_read, &channel);
+    channel.device->submit_read(request);
+  }
+}
+
+/**
+ * @brief  基准: 多个回环设备收发32字节消息，完成回调中续交请求 (设备管理器线程驱动全部设备)
+ *         与每个设备一个线程阻塞 write/flush/read 对比
+ */
+static void bench_echo(void)
+{
+  constexpr uint32_t ROUNDS = 2000;
+
+  printf("%-10s %16s %16s %16s\n", "devices", "async msg/s", "blocking msg/s", "blocking threads");
+
+  for (uint32_t devices : { 1u, 2u, 4u })
+  {
+    for (uint32_t i = 0; i < devices; ++i)
+    {
+      CHECK(Device_Error_Code::OK == g_loopback[i].open());
+    }
+
+    // 异步: 调用方只提交首个请求，其后由完成回调续交
+    std::vector<Echo_Channel> channels(devices);
+    auto                      start = std::chrono::steady_clock::now();
+
+    for (uint32_t i = 0; i < devices; ++i)
+    {
+      Echo_Channel& channel = channels[i];
+      channel.device        = &g_loopback[i];
+      channel.sent          = 0;
+      channel.received      = 0;
+      channel.rounds        = ROUNDS;
+      channel.finished      = false;
+      memset(channel.message, 'a' + i, MESSAGE);
+      channel.read.prepare(channel.inbox, MESSAGE, echo_read, &channel);
+      channel.write.prepare(channel.message, MESSAGE, echo_written, &channel);
+      CHECK(Device_Error_Code::OK == channel.device->submit_read(channel.read));
+      CHECK(Device_Error_Code::OK == channel.device->submit_write(channel.write));
+    }
+
+    for (Echo_Channel& channel : channels)
+    {
+      while (!channel.finished)
+      {
+        std::this_thread::sleep_for(std::chrono::microseconds(200));
+      }
+
+      CHECK(ROUNDS * MESSAGE == channel.received);
+    }
+
+    const double async_s = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+    // 阻塞: 每个设备一个线程
+    std::vector<std::thread> workers;
+    start = std::chrono::steady_clock::now();
+
+    for (uint32_t i = 0; i < devices; ++i)
+    {
+      workers.emplace_back([i]() {
+        char message[MESSAGE];
+        char inbox[MESSAGE];
+        memset(message, 'a' + i, MESSAGE);
+
+        for (uint32_t round = 0; round < ROUNDS; ++round)
+        {
+          g_loopback[i].write(message, MESSAGE);
+          g_loopback[i].flush(100);
+
+          for (int64_t got = 0; got < MESSAGE;)
+          {
+            const int64_t ret = g_loopback[i].read(inbox + got, MESSAGE - got, 100);
+
+            if (ret <= 0)
+            {
+              break;
+            }
+
+            got += ret;
+          }
+        }
+      });
+    }
+
+    for (std::thread& worker : workers)
+    {
+      worker.join();
+    }
+
+    const double blocking_s = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+    for (uint32_t i = 0; i < devices; ++i)
+    {
+      CHECK(Device_Error_Code::OK == g_loopback[i].close());
+    }
+
+    printf("%-10u %16.0f %16.0f %16u\n", devices, devices * ROUNDS / async_s, devices * ROUNDS / blocking_s, devices);
+  }
+}
+
+int main(void)
+{
+  g_main_thread = std::this_thread::get_id();
+
+  test_request_list();
+  test_stream_async();
+  test_unbuffered_async();
+  test_storage_async();
+  bench_echo();
+
+  printf("async_io_test: %s (%d failures)\n", 0 == g_failures ? "OK" : "FAILED", g_failures);
+  fflush(stdout);
+  return 0 == g_failures ? 0 : 1;
+}
@@ -0,0 +1,654 @@
+#ifndef __CACHED_STORAGE_DEVICE_HPP__
+#define __CACHED_STORAGE_DEVICE_HPP__
+
+#include "storage_device_base.hpp"
+#include "fast_memory.hpp"
+#include "mutex.hpp"
+
+/// @brief 名称空间 QAQ
+namespace QAQ
+{
+/// @brief 名称空间 系统
+namespace system
+{
+/// @brief 名称空间 设备
+namespace device
+{
+/// @brief 储存缓存 统计
+struct Storage_Cache_Stats
+{
+  uint32_t hits;               /* 命中扇区数 */
+  uint32_t misses;             /* 未命中扇区数 */
+  uint32_t read_ahead;         /* 预读扇区数 */
+  uint32_t bypass;             /* 绕过缓存的整扇区传输次数 */
+  uint32_t write_backs;        /* 回写操作次数 (相邻脏扇区合并为一次) */
+  uint32_t write_back_sectors; /* 回写扇区数 */
+};
+
+/**
+ * @brief  缓存储存设备 (储存设备装饰器: 扇区缓存 + 写回 + 顺序预读)
+ *
+ * @tparam Sector_Size   缓存扇区大小 (2的幂次方)
+ * @tparam Sector_Count  缓存扇区数量
+ * @tparam Read_Ahead    顺序访问时额外预读的扇区数
+ * @note   替换策略为 CLOCK: 命中置访问位，淘汰时跳过并清除访问位; 预读扇区不置访问位，未被使用时优先淘汰;
+ *         写入只修改缓存并标记脏扇区，淘汰、flush() 或关闭时回写; 缓存区中地址连续且扇区号连续的脏扇区合并为一次写入;
+ *         未缓存的连续整扇区读写绕过缓存直接传输; 擦除使范围内的缓存失效 (完全覆盖的脏扇区直接丢弃);
+ *         掉电前未 flush() 的数据会丢失
+ */
+template <uint32_t Sector_Size, uint32_t Sector_Count, uint32_t Read_Ahead = 4>
+class Cached_Storage_Device final : public system_internal::device_internal::Storage_Device_Base
+{
+  // 扇区大小检查
+  static_assert((Sector_Size >= 32) && (0 == (Sector_Size & (Sector_Size - 1))), "Sector_Size must be a power of 2 and >= 32");
+  // 扇区数量检查
+  static_assert(Sector_Count >= 2, "Sector_Count must be >= 2");
+  // 预读数量检查
+  static_assert(Read_Ahead < Sector_Count, "Read_Ahead must be less than Sector_Count");
+
+  // 禁止拷贝和移动
+  QAQ_NO_COPY_MOVE(Cached_Storage_Device)
+
+private:
+  /// @brief 缓存扇区信息
+  struct Slot
+  {
+    uint32_t sector;     /* 扇区号 */
+    bool     valid;      /* 有效 */
+    bool     dirty;      /* 脏 (未回写) */
+    bool     referenced; /* 访问位 */
+  };
+
+  /// @brief 无效索引
+  static constexpr uint32_t INVALID = UINT32_MAX;
+
+  /// @brief 后端储存设备
+  Storage_Device_Base& m_device;
+  /// @brief 后端容量 (字节)
+  const uint32_t       m_capacity;
+  /// @brief 缓存互斥锁
+  kernel::Mutex<true>  m_mutex;
+  /// @brief 缓存扇区信息
+  Slot                 m_slots[Sector_Count] = {};
+  /// @brief 缓存扇区数据
+  uint8_t              m_data[Sector_Count][Sector_Size] QAQ_ALIGN(32);
+  /// @brief CLOCK 指针
+  uint32_t             m_hand                = 0;
+  /// @brief 顺序访问预测的下一扇区
+  uint32_t             m_next_sector         = INVALID;
+  /// @brief 统计
+  Storage_Cache_Stats  m_stats               = { 0 };
+
+  /**
+   * @brief  缓存储存设备 查找缓存扇区
+   *
+   * @param  sector    扇区号
+   * @return uint32_t  缓存索引，未命中返回INVALID
+   */
+  uint32_t lookup(uint32_t sector) const
+  {
+    uint32_t ret = INVALID;
+
+    for (uint32_t i = 0; i < Sector_Count; ++i)
+    {
+      if (m_slots[i].valid && (sector == m_slots[i].sector))
+      {
+        ret = i;
+        break;
+      }
+    }
+
+    return ret;
+  }
+
+  /**
+   * @brief  缓存储存设备 回写脏扇区 (与缓存区中相邻的连续脏扇区合并为一次写入)
+   *
+   * @param  index  缓存索引
+   * @return true   成功
+   * @return false  后端写入失败
+   */
+  bool write_back(uint32_t index)
+  {
+    uint32_t first = index;
+    uint32_t last  = index;
+    bool     ret   = true;
+
+    while ((0 < first) && m_slots[first - 1].valid && m_slots[first - 1].dirty && (m_slots[first - 1].sector + 1 == m_slots[first].sector))
+    {
+      --first;
+    }
+
+    while ((Sector_Count > last + 1) && m_slots[last + 1].valid && m_slots[last + 1].dirty && (m_slots[last].sector + 1 == m_slots[last + 1].sector))
+    {
+      ++last;
+    }
+
+    const uint32_t count = last - first + 1;
+
+    if (m_device.write(m_slots[first].sector * Sector_Size, m_data[first], count * Sector_Size) == static_cast<int64_t>(count * Sector_Size))
+    {
+      for (uint32_t i = first; i <= last; ++i)
+      {
+        m_slots[i].dirty = false;
+      }
+
+      m_stats.write_backs++;
+      m_stats.write_back_sectors += count;
+    }
+    else
+    {
+      ret = false;
+    }
+
+    return ret;
+  }
+
+  /**
+   * @brief  缓存储存设备 选择淘汰扇区 (CLOCK，脏扇区先回写)
+   *
+   * @return uint32_t  缓存索引，回写失败返回INVALID
+   */
+  uint32_t victim(void)
+  {
+    uint32_t ret = INVALID;
+
+    while (INVALID == ret)
+    {
+      const uint32_t index = m_hand;
+      Slot&          slot  = m_slots[index];
+
+      m_hand               = (m_hand + 1) % Sector_Count;
+
+      if (!slot.valid)
+      {
+        ret = index;
+      }
+      else if (slot.referenced)
+      {
+        slot.referenced = false;
+      }
+      else if (slot.dirty && !write_back(index))
+      {
+        break;
+      }
+      else
+      {
+        ret = index;
+      }
+    }
+
+    if (INVALID != ret)
+    {
+      m_slots[ret].valid = false;
+    }
+
+    return ret;
+  }
+
+  /**
+   * @brief  缓存储存设备 缓存扇区可否被预读覆盖
+   *
+   * @param  index  缓存索引
+   * @return true   可覆盖 (无效或未访问的干净扇区)
+   * @return false  不可覆盖
+   */
+  bool reusable(uint32_t index) const
+  {
+    return !m_slots[index].valid || (!m_slots[index].referenced && !m_slots[index].dirty);
+  }
+
+  /**
+   * @brief  缓存储存设备 读入扇区 (顺序访问时将后续未缓存扇区一并读入相邻缓存区)
+   *
+   * @param  sector    扇区号
+   * @return uint32_t  缓存索引，失败返回INVALID
+   */
+  uint32_t fill(uint32_t sector)
+  {
+    uint32_t index = victim();
+
+    if (INVALID != index)
+    {
+      uint32_t count = 1;
+
+      if (sector == m_next_sector)
+      {
+        const uint32_t limit = std::min<uint32_t>(1 + Read_Ahead, m_capacity / Sector_Size - sector);
+
+        while ((count < limit) && (Sector_Count > index + count) && reusable(index + count) && (INVALID == lookup(sector + count)))
+        {
+          m_slots[index + count].valid = false;
+          ++count;
+        }
+      }
+
+      if (m_device.read(sector * Sector_Size, m_data[index], count * Sector_Size) == static_cast<int64_t>(count * Sector_Size))
+      {
+        for (uint32_t i = 0; i < count; ++i)
+        {
+          m_slots[index + i] = { sector + i, true, false, 0 == i };
+        }
+
+        m_stats.read_ahead += count - 1;
+      }
+      else
+      {
+        index = INVALID;
+      }
+    }
+
+    return index;
+  }
+
+  /**
+   * @brief  缓存储存设备 统计从指定扇区起未缓存的连续整扇区数
+   *
+   * @param  sector    起始扇区号
+   * @param  maximum   最大扇区数
+   * @return uint32_t  扇区数
+   */
+  uint32_t uncached_run(uint32_t sector, uint32_t maximum) const
+  {
+    uint32_t count = 0;
+
+    while ((count < maximum) && (INVALID == lookup(sector + count)))
+    {
+      ++count;
+    }
+
+    return count;
+  }
+
+  /**
+   * @brief  缓存储存设备 地址范围检查
+   *
+   * @param  address  起始地址
+   * @param  size     大小
+   * @return true     合法
+   * @return false    越界
+   */
+  bool in_range(uint32_t address, uint32_t size) const
+  {
+    return (address <= m_capacity) && (size <= m_capacity - address);
+  }
+
+  /**
+   * @brief  缓存储存设备 回写全部脏扇区 (调用前需持有互斥锁)
+   *
+   * @return true   成功
+   * @return false  后端写入失败
+   */
+  bool flush_locked(void)
+  {
+    bool ret = true;
+
+    for (uint32_t i = 0; (i < Sector_Count) && ret; ++i)
+    {
+      if (m_slots[i].valid && m_slots[i].dirty)
+      {
+        ret = write_back(i);
+      }
+    }
+
+    return ret;
+  }
+
+  /**
+   * @brief  缓存储存设备 设备管理器事件处理句柄 (无事件)
+   */
+  void manger_handler(uint32_t) override {}
+
+  /**
+   * @brief  缓存储存设备 打开 - 元方法覆写 (后端未打开时一并打开)
+   *
+   * @return Device_Error_Code 错误码
+   */
+  Device_Error_Code open_impl(void) override
+  {
+    Device_Error_Code error_code = Device_Error_Code::OK;
+
+    if (!m_device.is_opened())
+    {
+      error_code = m_device.open();
+    }
+
+    if (Device_Error_Code::OK == error_code)
+    {
+      kernel::Mutex_Guard<kernel::Mutex<true>> guard(m_mutex);
+
+      for (Slot& slot : m_slots)
+      {
+        slot = {};
+      }
+
+      m_hand        = 0;
+      m_next_sector = INVALID;
+    }
+
+    return error_code;
+  }
+
+  /**
+   * @brief  缓存储存设备 关闭 - 元方法覆写 (回写脏扇区后关闭后端)
+   *
+   * @return Device_Error_Code 错误码
+   */
+  Device_Error_Code close_impl(void) override
+  {
+    Device_Error_Code error_code = Device_Error_Code::OK;
+
+    {
+      kernel::Mutex_Guard<kernel::Mutex<true>> guard(m_mutex);
+
+      if (!flush_locked())
+      {
+        error_code = Device_Error_Code::IO_ERROR;
+      }
+    }
+
+    if (Device_Error_Code::OK == error_code)
+    {
+      error_code = m_device.close();
+    }
+
+    return error_code;
+  }
+
+  /**
+   * @brief  缓存储存设备 配置 - 元方法覆写 (转发至后端)
+   *
+   * @param  param              配置参数
+   * @param  value              配置值
+   * @return Device_Error_Code  错误码
+   */
+  Device_Error_Code config_impl(uint32_t param, uint32_t value) override
+  {
+    return m_device.config(param, value);
+  }
+
+  /**
+   * @brief  缓存储存设备 获取配置 - 元方法覆写 (转发至后端)
+   *
+   * @param  param     配置参数
+   * @return uint32_t  配置值
+   */
+  uint32_t get_config_impl(uint32_t param) const override
+  {
+    return m_device.get_config(param);
+  }
+
+public:
+  /**
+   * @brief  缓存储存设备 构造函数
+   *
+   * @param  device    后端储存设备
+   * @param  capacity  后端容量 (字节，按扇区大小向下取整)
+   */
+  explicit Cached_Storage_Device(Storage_Device_Base& device, uint32_t capacity) : m_device(device), m_capacity(capacity & ~(Sector_Size - 1)), m_mutex("Cached Storage Mutex") {}
+
+  /**
+   * @brief  缓存储存设备 析构函数
+   */
+  ~Cached_Storage_Device() {}
+
+  /**
+   * @brief  缓存储存设备 写入数据
+   *
+   * @param  address   写入地址
+   * @param  data      数据缓存
+   * @param  size      数据大小
+   * @return int64_t   实际写入数据大小，未打开、越界或后端失败返回-1
+   */
+  int64_t write(uint32_t address, const uint8_t* data, uint32_t size) override
+  {
+    int64_t ret = -1;
+
+    if (m_opened && in_range(address, size))
+    {
+      kernel::Mutex_Guard<kernel::Mutex<true>> guard(m_mutex);
+      uint32_t                                 done = 0;
+
+      ret                                           = size;
+
+      while (done < size)
+      {
+        const uint32_t position = address + done;
+        const uint32_t sector   = position / Sector_Size;
+        const uint32_t offset   = position % Sector_Size;
+        const uint32_t length   = std::min(Sector_Size - offset, size - done);
+        const uint32_t whole    = (0 == offset) ? uncached_run(sector, (size - done) / Sector_Size) : 0;
+        uint32_t       index    = INVALID;
+
+        if (1 < whole)
+        {
+          if (m_device.write(position, data + done, whole * Sector_Size) != static_cast<int64_t>(whole * Sector_Size))
+          {
+            ret = -1;
+            break;
+          }
+
+          m_stats.bypass++;
+          m_next_sector  = sector + whole;
+          done          += whole * Sector_Size;
+          continue;
+        }
+
+        index = lookup(sector);
+
+        if (INVALID != index)
+        {
+          m_stats.hits++;
+        }
+        else
+        {
+          m_stats.misses++;
+
+          if (Sector_Size == length)
+          {
+            // 整扇区覆盖，无需读入
+            index = victim();
+
+            if (INVALID != index)
+            {
+              m_slots[index] = { sector, true, false, true };
+            }
+          }
+          else
+          {
+            index = fill(sector);
+          }
+        }
+
+        if (INVALID == index)
+        {
+          ret = -1;
+          break;
+        }
+
+        memory::fast_memcpy(&m_data[index][offset], data + done, length);
+        m_slots[index].dirty       = true;
+        m_slots[index].referenced  = true;
+        m_next_sector              = sector + 1;
+        done                      += length;
+      }
+    }
+
+    return ret;
+  }
+
+  /**
+   * @brief  缓存储存设备 读取数据
+   *
+   * @param  address   读取地址
+   * @param  data      数据缓存
+   * @param  size      数据大小
+   * @return int64_t   实际读取数据大小，未打开、越界或后端失败返回-1
+   */
+  int64_t read(uint32_t address, uint8_t* data, uint32_t size) override
+  {
+    int64_t ret = -1;
+
+    if (m_opened && in_range(address, size))
+    {
+      kernel::Mutex_Guard<kernel::Mutex<true>> guard(m_mutex);
+      uint32_t                                 done = 0;
+
+      ret                                           = size;
+
+      while (done < size)
+      {
+        const uint32_t position = address + done;
+        const uint32_t sector   = position / Sector_Size;
+        const uint32_t offset   = position % Sector_Size;
+        const uint32_t length   = std::min(Sector_Size - offset, size - done);
+        const uint32_t whole    = (0 == offset) ? uncached_run(sector, (size - done) / Sector_Size) : 0;
+        uint32_t       index    = INVALID;
+
+        if (1 < whole)
+        {
+          if (m_device.read(position, data + done, whole * Sector_Size) != static_cast<int64_t>(whole * Sector_Size))
+          {
+            ret = -1;
+            break;
+          }
+
+          m_stats.bypass++;
+          m_next_sector  = sector + whole;
+          done          += whole * Sector_Size;
+          continue;
+        }
+
+        index = lookup(sector);
+
+        if (INVALID != index)
+        {
+          m_stats.hits++;
+        }
+        else
+        {
+          m_stats.misses++;
+          index = fill(sector);
+        }
+
+        if (INVALID == index)
+        {
+          ret = -1;
+          break;
+        }
+
+        memory::fast_memcpy(data + done, &m_data[index][offset], length);
+        m_slots[index].referenced  = true;
+        m_next_sector              = sector + 1;
+        done                      += length;
+      }
+    }
+
+    return ret;
+  }
+
+  /**
+   * @brief  缓存储存设备 擦除数据 (范围内缓存失效后转发至后端)
+   *
+   * @param  address   擦除地址
+   * @param  size      擦除大小
+   * @return int64_t   实际擦除数据大小，未打开、越界或后端失败返回-1
+   */
+  int64_t erase(uint32_t address, uint32_t size) override
+  {
+    int64_t ret = -1;
+
+    if (m_opened && in_range(address, size))
+    {
+      kernel::Mutex_Guard<kernel::Mutex<true>> guard(m_mutex);
+
+      ret = size;
+
+      for (uint32_t i = 0; i < Sector_Count; ++i)
+      {
+        const uint32_t start = m_slots[i].sector * Sector_Size;
+
+        if (m_slots[i].valid && (start < address + size) && (address < start + Sector_Size))
+        {
+          const bool covered = (address <= start) && (start + Sector_Size <= address + size);
+
+          // 部分覆盖的脏扇区先回写，保留范围外的数据
+          if (!covered && m_slots[i].dirty && !write_back(i))
+          {
+            ret = -1;
+            break;
+          }
+
+          m_slots[i].valid = false;
+          m_slots[i].dirty = false;
+        }
+      }
+
+      if (0 <= ret)
+      {
+        ret = m_device.erase(address, size);
+      }
+    }
+
+    return ret;
+  }
+
+  /**
+   * @brief  缓存储存设备 回写全部脏扇区
+   *
+   * @return Device_Error_Code 错误码
+   */
+  Device_Error_Code flush(void)
+  {
+    Device_Error_Code error_code = Device_Error_Code::OK;
+
+    if (!m_opened)
+    {
+      error_code = Device_Error_Code::NOT_OPENED;
+    }
+    else
+    {
+      kernel::Mutex_Guard<kernel::Mutex<true>> guard(m_mutex);
+
+      if (!flush_locked())
+      {
+        error_code = Device_Error_Code::IO_ERROR;
+      }
+    }
+
+    return error_code;
+  }
+
+  /**
+   * @brief  缓存储存设备 获取容量
+   *
+   * @return uint32_t 容量 (字节)
+   */
+  uint32_t capacity(void) const
+  {
+    return m_capacity;
+  }
+
+  /**
+   * @brief  缓存储存设备 获取统计
+   *
+   * @return Storage_Cache_Stats 统计
+   */
+  Storage_Cache_Stats stats(void) const
+  {
+    return m_stats;
+  }
+
+  /**
+   * @brief  缓存储存设备 清零统计
+   */
+  void reset_stats(void)
+  {
+    m_stats = { 0 };
+  }
+};
+} /* namespace device */
+} /* namespace system */
+} /* namespace QAQ */
+
+#endif /* __CACHED_STORAGE_DEVICE_HPP__ */
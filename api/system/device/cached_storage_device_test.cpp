@@ -0,0 +1,421 @@
+/**
+ * @file   cached_storage_device_test.cpp
+ * @brief  缓存储存设备 主机测试: 写回与相邻脏扇区合并、顺序预读、整扇区绕过、擦除失效、与平坦内存模型的随机差分，
+ *         以及典型访问模式下的命中率、后端事务数与吞吐基准
+ *
+ * @note   仅用于主机，不参与固件编译 (已加入 eide excludeList);
+ *         内核由 host_kernel.hpp 仿真; 后端为 Ram_Storage_Device，按操作统计折算 QSPI NOR 耗时 (见 Qspi_Model);
+ *         基准耗时请以不带 sanitizer 的 -O2 构建为准
+ *
+ *         构建 (仓库根目录):
+ *         g++ -std=c++17 -O2 -g -fsanitize=address,undefined -fpermissive -w \
+ *             $(python3 -c "import json;c=json.load(open('.eide/eide.json'))['targets']['Debug']['custom_dep'];print(' '.join(['-I'+p for p in c['incList']]+['-D'+d for d in c['defineList']]))") \
+ *             api/system/device/cached_storage_device_test.cpp -o cached_storage_device_test -lpthread && ./cached_storage_device_test
+ */
+#include "host_kernel.hpp"
+#include "cached_storage_device.hpp"
+#include "ram_storage_device.hpp"
+
+#include <chrono>
+#include <cstdio>
+#include <thread>
+#include <vector>
+
+using namespace QAQ::system::device;
+using QAQ::system::system_internal::device_internal::Storage_Device_Base;
+
+/* 主机测试不使用信号，对象析构时断开连接为空操作 */
+namespace QAQ
+{
+namespace system
+{
+namespace system_internal
+{
+namespace signal_internal
+{
+class Null_Signal_Manager final : public Signal_Manager_Base
+{
+};
+
+Null_Signal_Manager  g_null_signal_manager;
+Signal_Manager_Base* __signal_manager_base = &g_null_signal_manager;
+} /* namespace signal_internal */
+} /* namespace system_internal */
+} /* namespace system */
+} /* namespace QAQ */
+
+namespace
+{
+/// @brief 失败的检查数
+int g_failures = 0;
+
+#define CHECK(cond)                                                  \
+  do                                                                 \
+  {                                                                  \
+    if (!(cond))                                                     \
+    {                                                                \
+      ++g_failures;                                                  \
+      printf("%s:%d: CHECK(%s) failed\n", __FILE__, __LINE__, #cond); \
+    }                                                                \
+  } while (0)
+
+/// @brief 后端容量
+constexpr uint32_t CAPACITY = 256 * 1024;
+/// @brief 缓存扇区大小
+constexpr uint32_t SECTOR   = 512;
+
+/// @brief 后端储存设备
+Ram_Storage_Device<CAPACITY>           g_ram;
+/// @brief 缓存储存设备 (16个512字节扇区，顺序访问预读4个扇区)
+Cached_Storage_Device<SECTOR, 16, 4>   g_cache(g_ram, CAPACITY);
+/// @brief 平坦内存模型 (期望内容)
+std::vector<uint8_t>                   g_model(CAPACITY, 0xFF);
+
+/// @brief QSPI NOR 粗略耗时模型: 每次事务2us命令开销，读取15ns/字节，编程每页400us (每次写入至少一页，不足一页按一页计)
+struct Qspi_Model
+{
+  static constexpr double COMMAND_US   = 2.0;
+  static constexpr double READ_NS      = 15.0;
+  static constexpr double PAGE_PROG_US = 400.0;
+
+  /**
+   * @brief  按后端操作统计估算耗时
+   *
+   * @param  stats   后端操作统计
+   * @return double  耗时 - 毫秒
+   */
+  static double ms(const Storage_Op_Stats& stats)
+  {
+    const uint64_t pages = std::max<uint64_t>(stats.write_ops, (stats.write_bytes + 255) / 256);
+
+    return ((stats.read_ops + stats.write_ops) * COMMAND_US + stats.read_bytes * READ_NS / 1000 + pages * PAGE_PROG_US) / 1000;
+  }
+};
+
+/// @brief 伪随机数发生器
+uint32_t next_random(uint32_t& seed)
+{
+  seed = seed * 1664525u + 1013904223u;
+  return seed >> 8;
+}
+
+/**
+ * @brief  写入缓存设备并同步更新模型
+ */
+bool model_write(uint32_t address, const uint8_t* data, uint32_t size)
+{
+  memcpy(g_model.data() + address, data, size);
+  return static_cast<int64_t>(size) == g_cache.write(address, data, size);
+}
+
+/**
+ * @brief  擦除缓存设备并同步更新模型
+ */
+bool model_erase(uint32_t address, uint32_t size)
+{
+  memset(g_model.data() + address, 0xFF, size);
+  return static_cast<int64_t>(size) == g_cache.erase(address, size);
+}
+
+/**
+ * @brief  经缓存读取并与模型比较
+ */
+bool model_check(uint32_t address, uint32_t size)
+{
+  std::vector<uint8_t> data(size);
+  return (static_cast<int64_t>(size) == g_cache.read(address, data.data(), size)) && (0 == memcmp(data.data(), g_model.data() + address, size));
+}
+
+/**
+ * @brief  直接读取后端并与模型比较 (验证回写结果)
+ */
+bool backend_matches(void)
+{
+  std::vector<uint8_t> data(CAPACITY);
+  return (static_cast<int64_t>(CAPACITY) == g_ram.read(0, data.data(), CAPACITY)) && (data == g_model);
+}
+
+/**
+ * @brief  重新打开缓存 (回写并清空缓存，清零统计)
+ */
+void reopen(void)
+{
+  if (g_cache.is_opened())
+  {
+    CHECK(Device_Error_Code::OK == g_cache.close());
+  }
+
+  CHECK(Device_Error_Code::OK == g_cache.open());
+  g_cache.reset_stats();
+  g_ram.reset_stats();
+}
+} /* namespace */
+
+/**
+ * @brief  测试: 写入只修改缓存，flush() 时回写; 地址与扇区号均连续的脏扇区合并为一次后端写入
+ */
+static void test_write_back(void)
+{
+  uint8_t data[SECTOR];
+
+  memset(data, 0xA5, sizeof(data));
+  reopen();
+
+  CHECK(model_write(100, data, 10));
+  CHECK(model_check(100, 10));
+  CHECK(1 == g_ram.stats().read_ops && 0 == g_ram.stats().write_ops);
+  CHECK(Device_Error_Code::OK == g_cache.flush());
+  CHECK(1 == g_ram.stats().write_ops && SECTOR == g_ram.stats().write_bytes);
+  CHECK(Device_Error_Code::OK == g_cache.flush());
+  CHECK(1 == g_ram.stats().write_ops);
+
+  // 扇区8~11各写入部分数据 (扇区9起为顺序访问，预读将10~13读入相邻缓存区)
+  g_cache.reset_stats();
+  g_ram.reset_stats();
+
+  for (uint32_t sector = 8; sector < 12; ++sector)
+  {
+    CHECK(model_write(sector * SECTOR + 16, data, 32));
+  }
+
+  CHECK(0 == g_ram.stats().write_ops);
+  CHECK(2 == g_cache.stats().misses && 2 == g_cache.stats().hits);
+  CHECK(Device_Error_Code::OK == g_cache.flush());
+  CHECK(1 == g_cache.stats().write_backs && 4 == g_cache.stats().write_back_sectors);
+  CHECK(1 == g_ram.stats().write_ops);
+  CHECK(backend_matches());
+
+  // 整扇区写入未缓存扇区无需读入
+  g_ram.reset_stats();
+  CHECK(model_write(40 * SECTOR, data, SECTOR));
+  CHECK(0 == g_ram.stats().read_ops);
+
+  // 关闭时回写
+  CHECK(Device_Error_Code::OK == g_cache.close());
+  CHECK(Device_Error_Code::OK == g_ram.open());
+  CHECK(backend_matches());
+  CHECK(Device_Error_Code::OK == g_ram.close());
+}
+
+/**
+ * @brief  测试: 顺序小块读取触发预读，后端事务数远少于扇区数; 未缓存的连续整扇区读写绕过缓存
+ */
+static void test_read_ahead_bypass(void)
+{
+  uint8_t block[64];
+
+  reopen();
+
+  for (uint32_t address = 64 * SECTOR; address < 96 * SECTOR; address += sizeof(block))
+  {
+    CHECK(static_cast<int64_t>(sizeof(block)) == g_cache.read(address, block, sizeof(block)));
+    CHECK(0 == memcmp(block, g_model.data() + address, sizeof(block)));
+  }
+
+  CHECK(0 != g_cache.stats().read_ahead);
+  CHECK(12 > g_ram.stats().read_ops);
+  CHECK(32 * SECTOR / sizeof(block) == g_cache.stats().hits + g_cache.stats().misses);
+
+  // 8个整扇区读取: 一次后端读取
+  g_cache.reset_stats();
+  g_ram.reset_stats();
+  CHECK(model_check(128 * SECTOR, 8 * SECTOR));
+  CHECK(1 == g_cache.stats().bypass && 1 == g_ram.stats().read_ops);
+
+  // 8个整扇区写入: 一次后端写入，不占用缓存
+  std::vector<uint8_t> data(8 * SECTOR, 0x3C);
+
+  g_ram.reset_stats();
+  CHECK(model_write(200 * SECTOR, data.data(), 8 * SECTOR));
+  CHECK(2 == g_cache.stats().bypass && 1 == g_ram.stats().write_ops);
+  CHECK(backend_matches());
+
+  // 中间扇区已缓存 (脏) 时整扇区写入分段: 已缓存扇区写入缓存，其余绕过
+  CHECK(model_write(210 * SECTOR + 8, data.data(), 4));
+  g_ram.reset_stats();
+  CHECK(model_write(208 * SECTOR, data.data(), 6 * SECTOR));
+  CHECK(model_check(208 * SECTOR, 6 * SECTOR));
+  CHECK(Device_Error_Code::OK == g_cache.flush());
+  CHECK(backend_matches());
+}
+
+/**
+ * @brief  测试: 擦除使范围内缓存失效，完全覆盖的脏扇区丢弃，部分覆盖的脏扇区先回写保留范围外数据
+ */
+static void test_erase(void)
+{
+  uint8_t data[64];
+
+  memset(data, 0x77, sizeof(data));
+  reopen();
+
+  CHECK(model_write(20 * SECTOR + 8, data, sizeof(data)));
+  CHECK(model_write(21 * SECTOR + 400, data, sizeof(data)));
+  CHECK(model_erase(20 * SECTOR, SECTOR + 256));
+  CHECK(1 == g_cache.stats().write_backs && 1 == g_cache.stats().write_back_sectors);
+  CHECK(model_check(20 * SECTOR, 2 * SECTOR));
+  CHECK(Device_Error_Code::OK == g_cache.flush());
+  CHECK(backend_matches());
+
+  // 越界与未打开
+  CHECK(-1 == g_cache.read(CAPACITY - 4, data, 8));
+  CHECK(-1 == g_cache.write(CAPACITY, data, 1));
+  CHECK(-1 == g_cache.erase(CAPACITY - 1, 2));
+  CHECK(Device_Error_Code::OK == g_cache.close());
+  CHECK(-1 == g_cache.read(0, data, 1));
+}
+
+/**
+ * @brief  测试: 随机读写擦除与平坦内存模型逐次比较，定期回写后比较后端内容
+ */
+static void test_random(void)
+{
+  std::vector<uint8_t> data(4 * SECTOR);
+  uint32_t             seed = 2024;
+
+  reopen();
+
+  for (uint32_t i = 0; i < 20000; ++i)
+  {
+    const uint32_t op      = next_random(seed) % 100;
+    const uint32_t size    = 1 + next_random(seed) % ((op < 90) ? 700 : 2048);
+    const uint32_t address = next_random(seed) % (64 * 1024 - size);
+
+    if (op < 50)
+    {
+      CHECK(model_check(address, size));
+    }
+    else if (op < 95)
+    {
+      for (uint32_t j = 0; j < size; ++j)
+      {
+        data[j] = static_cast<uint8_t>(next_random(seed));
+      }
+
+      CHECK(model_write(address, data.data(), size));
+    }
+    else if (op < 98)
+    {
+      CHECK(model_erase(address, size));
+    }
+    else
+    {
+      CHECK(Device_Error_Code::OK == g_cache.flush());
+      CHECK(backend_matches());
+    }
+
+    if (0 != g_failures)
+    {
+      printf("random: op %u failed at step %u (address %u size %u)\n", op, i, address, size);
+      break;
+    }
+  }
+
+  CHECK(Device_Error_Code::OK == g_cache.close());
+  CHECK(Device_Error_Code::OK == g_ram.open());
+  CHECK(backend_matches());
+  CHECK(Device_Error_Code::OK == g_ram.close());
+}
+
+/**
+ * @brief  基准: 访问模式下缓存与直接访问后端的命中率、后端事务数、折算 QSPI 耗时与主机吞吐
+ *
+ * @param  name    访问模式名称
+ * @param  cached  经缓存访问
+ * @param  work    访问函数 (参数为设备，返回访问字节数)
+ */
+template <typename Work>
+static void bench(const char* name, bool cached, Work work)
+{
+  Storage_Device_Base& device = cached ? static_cast<Storage_Device_Base&>(g_cache) : static_cast<Storage_Device_Base&>(g_ram);
+
+  reopen();
+
+  // 等待设备管理器通道线程处理打开、关闭事件，避免计入计时
+  std::this_thread::sleep_for(std::chrono::milliseconds(10));
+
+  const auto     start = std::chrono::steady_clock::now();
+  const uint64_t bytes = work(device);
+
+  CHECK(Device_Error_Code::OK == g_cache.flush());
+
+  const double              seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+  const Storage_Cache_Stats stats   = g_cache.stats();
+  const Storage_Op_Stats    ops     = g_ram.stats();
+  const uint32_t            total   = stats.hits + stats.misses;
+
+  printf("%-14s %-7s %8.1f%% %10u %10u %12.1f %10.1f\n", name, cached ? "cached" : "direct", cached && total ? 100.0 * stats.hits / total : 0.0, ops.read_ops, ops.write_ops, Qspi_Model::ms(ops),
+         bytes / seconds / (1024 * 1024));
+}
+
+int main(void)
+{
+  test_write_back();
+  test_read_ahead_bypass();
+  test_erase();
+  test_random();
+
+  // 顺序读取 64 字节记录 (全部容量，4遍)
+  auto sequential = [](Storage_Device_Base& device) {
+    uint8_t record[64];
+
+    for (uint32_t pass = 0; pass < 4; ++pass)
+    {
+      for (uint32_t address = 0; address < CAPACITY; address += sizeof(record))
+      {
+        device.read(address, record, sizeof(record));
+      }
+    }
+
+    return static_cast<uint64_t>(4 * CAPACITY);
+  };
+
+  // 32 字节随机读取，90% 落在 8 个扇区的热区 (如 FAT 表与目录)
+  auto hot_reads = [](Storage_Device_Base& device) {
+    uint8_t  record[32];
+    uint32_t seed = 7;
+
+    for (uint32_t i = 0; i < 200000; ++i)
+    {
+      const uint32_t span = (next_random(seed) % 10 < 9) ? 8 * SECTOR : CAPACITY;
+      device.read(next_random(seed) % (span - sizeof(record)), record, sizeof(record));
+    }
+
+    return static_cast<uint64_t>(200000 * sizeof(record));
+  };
+
+  // 16 字节随机写入 (元数据更新)，每 256 次写入 flush 一次; 热区 8 个扇区装入缓存，32 个扇区超出缓存容量
+  auto small_writes = [](uint32_t sectors) {
+    return [sectors](Storage_Device_Base& device) {
+      uint8_t  record[16] = { 0 };
+      uint32_t seed       = 11;
+
+      for (uint32_t i = 0; i < 16384; ++i)
+      {
+        device.write(next_random(seed) % (sectors * SECTOR - sizeof(record)), record, sizeof(record));
+
+        if ((255 == (i & 255)) && (&device == &g_cache))
+        {
+          g_cache.flush();
+        }
+      }
+
+      return static_cast<uint64_t>(16384 * sizeof(record));
+    };
+  };
+
+  printf("%-14s %-7s %9s %10s %10s %12s %10s\n", "workload", "path", "hit", "read ops", "write ops", "QSPI ms", "host MB/s");
+  bench("seq 64B read", false, sequential);
+  bench("seq 64B read", true, sequential);
+  bench("hot 32B read", false, hot_reads);
+  bench("hot 32B read", true, hot_reads);
+  bench("16B write x8", false, small_writes(8));
+  bench("16B write x8", true, small_writes(8));
+  bench("16B write x32", false, small_writes(32));
+  bench("16B write x32", true, small_writes(32));
+  CHECK(Device_Error_Code::OK == g_cache.close());
+
+  printf("cached_storage_device_test: %s (%d failures)\n", 0 == g_failures ? "OK" : "FAILED", g_failures);
+  fflush(stdout);
+  return 0 == g_failures ? 0 : 1;
+}
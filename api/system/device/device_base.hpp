@@ -2,6 +2,7 @@
 #define __DEVICE_BASE_HPP__
 
 #include "event_flags.hpp"
+#include "mutex.hpp"
 
 /// @brief 名称空间 QAQ
 namespace QAQ
@@ -28,6 +29,41 @@ enum class Device_Error_Code : uint8_t
   WAIT_FOR_CONNECT,  /* 等待连接 */
 };
 
+/// @brief 分散聚集 输出向量
+struct Io_Vec
+{
+  const void* data; /* 数据地址 */
+  uint32_t    size; /* 数据大小 */
+};
+
+/// @brief 分散聚集 输入向量
+struct Io_Mut_Vec
+{
+  void*    data; /* 数据地址 */
+  uint32_t size; /* 数据大小 */
+};
+
+/**
+ * @brief  分散聚集 计算向量总大小
+ *
+ * @tparam Vec       向量类型
+ * @param  vec       向量数组
+ * @param  count     向量数量
+ * @return uint64_t  总大小
+ */
+template <typename Vec>
+inline uint64_t io_vec_size(const Vec* vec, uint32_t count)
+{
+  uint64_t total = 0;
+
+  for (uint32_t i = 0; i < count; ++i)
+  {
+    total += vec[i].size;
+  }
+
+  return total;
+}
+
 /// @brief 设备类型
 enum class Device_Type : uint8_t
 {
@@ -36,6 +72,14 @@ enum class Device_Type : uint8_t
   DIRECTORY, /* 直接传输设备 */
 };
 
+/// @brief 设备管理器通道 (各通道独立线程，慢设备不阻塞快设备; 通道数量由 DEVICE_MANAGER_LANES 决定，更多通道以 static_cast<Device_Lane>(编号) 选择)
+enum class Device_Lane : uint8_t
+{
+  FAST   = 0, /* 高优先级通道 (串口等中断驱动设备) */
+  NORMAL = 1, /* 普通通道 (默认) */
+  SLOW   = 2, /* 低优先级通道 (网络、存储等可能长时间阻塞的设备) */
+};
+
 /// @brief 流设备类型
 enum class Stream_Type : uint8_t
 {
@@ -52,6 +96,7 @@ namespace system_internal
 namespace device_internal
 {
 class Device_Manager;
+class Device_Lane_Base;
 
 /// @brief 回调函数参数类型
 using Device_Args_t = void*;
@@ -68,9 +113,59 @@ enum class Device_Event_Bits : uint32_t
   Receive_Timeout = 0x10, /* 接收超时 */
   Close           = 0x20, /* 关闭 */
   Error           = 0x40, /* 错误 */
+  Async_Request   = 0x80, /* 异步请求 */
   All             = 0xFF, /* 所有事件 */
 };
 
+/**
+ * @brief 发送通道 写入者锁 (多个写入者时由互斥锁保证整个写入独占发送通道; 中断中不等待互斥锁，仅依赖发送握手)
+ */
+class Device_Write_Lock final
+{
+  // 禁止拷贝和移动
+  QAQ_NO_COPY_MOVE(Device_Write_Lock)
+
+private:
+  /// @brief 互斥锁类型
+  using Mutex = kernel::Mutex<true>;
+
+  /// @brief 写入者互斥锁
+  Mutex&              m_mutex;
+  /// @brief 上锁状态
+  const Mutex::Status m_status;
+
+public:
+  /**
+   * @brief  写入者锁 构造函数
+   *
+   * @param  mutex      写入者互斥锁
+   * @param  timeout_ms 超时时间 - 毫秒
+   */
+  explicit Device_Write_Lock(Mutex& mutex, uint32_t timeout_ms) : m_mutex(mutex), m_status(mutex.lock(timeout_ms)) {}
+
+  /**
+   * @brief  写入者锁 析构函数
+   */
+  ~Device_Write_Lock()
+  {
+    if (Mutex::Status::SUCCESS == m_status)
+    {
+      m_mutex.unlock();
+    }
+  }
+
+  /**
+   * @brief  写入者锁 是否可以使用发送通道
+   *
+   * @return true  已上锁或处于中断中
+   * @return false 等待其他写入者超时
+   */
+  bool owns(void) const
+  {
+    return (Mutex::Status::SUCCESS == m_status) || (Mutex::Status::IN_ISR == m_status);
+  }
+};
+
 /**
  * @brief 设备基类
  *
@@ -79,12 +174,20 @@ class Device_Base
 {
   /// @brief 友元声明 设备管理器
   friend class Device_Manager;
+  /// @brief 友元声明 设备管理器通道
+  friend class Device_Lane_Base;
 
 protected:
   /// @brief 事件标志组
-  kernel::Event_Flags m_event_flags;
+  kernel::Event_Flags   m_event_flags;
   /// @brief 开关状态标志
-  std::atomic_bool    m_opened                                                  = false;
+  std::atomic_bool      m_opened                                                = false;
+  /// @brief 待处理事件标志 (设备管理器按设备合并投递，非零表示已在通道队列中)
+  std::atomic<uint32_t> m_pending_events                                        = 0;
+  /// @brief 设备管理器通道 (派生类构造时指定，首次投递事件后不可更改)
+  device::Device_Lane   m_manager_lane                                          = device::Device_Lane::NORMAL;
+  /// @brief 是否已登记到设备管理器通道 (占用通道队列的一项)
+  std::atomic_bool      m_manager_attached                                      = false;
 
   /**
    * @brief  设备基类 设备管理器事件处理句柄 - 纯虚函数
@@ -133,6 +236,11 @@ protected:
    */
   virtual uint32_t get_config_impl(uint32_t param) const                        = 0;
 
+  /**
+   * @brief  设备基类 异步请求处理句柄 (设备管理器线程中执行，默认无异步请求)
+   */
+  virtual void async_handler(void) {}
+
 public:
   /**
    * @brief  设备基类 打开设备
@@ -181,6 +289,7 @@ public:
       {
         m_opened = false;
         m_event_flags.set(static_cast<uint32_t>(Device_Event_Bits::Close));
+        post_event(static_cast<uint32_t>(Device_Event_Bits::Async_Request));
       }
     }
 
@@ -263,6 +372,38 @@ public:
    * @return int64_t    实际读取数据大小
    */
   virtual int64_t read(void* data, uint32_t size, uint32_t timeout_ms = TX_WAIT_FOREVER) = 0;
+
+  /**
+   * @brief  输入基类 分散读取数据 (默认逐段读取，可由派生类优化)
+   *
+   * @param  vec        输入向量数组
+   * @param  count      输入向量数量
+   * @param  timeout_ms 读取数据超时时间 (每段)
+   * @return int64_t    实际读取数据大小，设备未打开返回-1
+   */
+  virtual int64_t readv(const device::Io_Mut_Vec* vec, uint32_t count, uint32_t timeout_ms = TX_WAIT_FOREVER)
+  {
+    int64_t total = 0;
+
+    for (uint32_t i = 0; i < count; ++i)
+    {
+      int64_t ret = read(vec[i].data, vec[i].size, timeout_ms);
+
+      if (ret < 0)
+      {
+        return (0 == total) ? ret : total;
+      }
+
+      total += ret;
+
+      if (static_cast<uint32_t>(ret) < vec[i].size)
+      {
+        break;
+      }
+    }
+
+    return total;
+  }
 };
 
 /**
@@ -282,6 +423,38 @@ public:
    */
   virtual int64_t write(const void* data, uint32_t size, uint32_t timeout_ms = 0) = 0;
 
+  /**
+   * @brief  输出基类 聚集写入数据 (默认逐段写入，可由派生类优化)
+   *
+   * @param  vec        输出向量数组
+   * @param  count      输出向量数量
+   * @param  timeout_ms 写入数据超时时间
+   * @return int64_t    实际写入数据大小，设备未打开返回-1
+   */
+  virtual int64_t writev(const device::Io_Vec* vec, uint32_t count, uint32_t timeout_ms = 0)
+  {
+    int64_t total = 0;
+
+    for (uint32_t i = 0; i < count; ++i)
+    {
+      int64_t ret = write(vec[i].data, vec[i].size, timeout_ms);
+
+      if (ret < 0)
+      {
+        return (0 == total) ? ret : total;
+      }
+
+      total += ret;
+
+      if (static_cast<uint32_t>(ret) < vec[i].size)
+      {
+        break;
+      }
+    }
+
+    return total;
+  }
+
   /**
    * @brief  输出基类 刷新数据 - 纯虚函数
    *
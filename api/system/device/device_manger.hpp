@@ -10,74 +10,354 @@ namespace QAQ
 /// @brief 名称空间 系统
 namespace system
 {
+/// @brief 名称空间 设备
+namespace device
+{
+/// @brief 设备管理器 通道统计
+struct Device_Lane_Stats
+{
+  uint32_t posted;       /* 入队次数 */
+  uint32_t merged;       /* 合并次数 (设备已在队列中，事件并入待处理标志) */
+  uint32_t dropped;      /* 丢弃次数 (通道登记设备数已满，设备无法登记) */
+  uint32_t devices;      /* 已登记设备数 */
+  uint32_t handled;      /* 处理次数 */
+  uint32_t last_cycles;  /* 最近一次处理耗时 (CPU周期) */
+  uint32_t max_cycles;   /* 最长处理耗时 (CPU周期) */
+  uint64_t total_cycles; /* 累计处理耗时 (CPU周期) */
+};
+} /* namespace device */
+
 /// @brief 命名空间 内部
 namespace system_internal
 {
 /// @brief 名称空间 设备 内部
 namespace device_internal
 {
-/// @brief 设备管理器线程栈大小
-static constexpr uint32_t DEVICE_MANAGER_STACK_SIZE         = 1536;
-/// @brief 设备管理器线程优先级
-static constexpr uint32_t DEVICE_MANAGER_PRIORITY           = 3;
-/// @brief 设备管理器 消息队列大小
+/// @brief 设备管理器 通道配置
+struct Device_Lane_Config
+{
+  uint32_t    priority;   /* 线程优先级 */
+  uint32_t    stack_size; /* 线程栈大小 */
+  const char* name;       /* 线程名称 */
+};
+
+/// @brief 设备管理器 通道配置表 (下标与 Device_Lane 编号对应，由 user_config.h 中的 DEVICE_MANAGER_LANES 决定通道数量)
+static constexpr Device_Lane_Config DEVICE_MANAGER_LANE_CONFIG[] = { DEVICE_MANAGER_LANES };
+/// @brief 设备管理器 通道数量
+static constexpr uint32_t DEVICE_MANAGER_LANE_COUNT         = sizeof(DEVICE_MANAGER_LANE_CONFIG) / sizeof(DEVICE_MANAGER_LANE_CONFIG[0]);
+/// @brief 设备管理器 消息队列大小 (每个设备至多占用一项，亦为每个通道可登记的最大设备数)
 static constexpr uint32_t DEVICE_MANAGER_MASSAGE_QUEUE_SIZE = 32;
 
-/// @brief 设备事件消息结构体
-struct Device_Event_Message
+// 通道配置检查
+static_assert((0 < DEVICE_MANAGER_LANE_COUNT) && (DEVICE_MANAGER_LANE_COUNT <= 256), "Device manager lane count must be between 1 and 256 (Device_Lane is uint8_t)");
+
+/**
+ * @brief  设备管理器 读取CPU周期计数
+ *
+ * @return uint32_t 周期计数
+ */
+QAQ_INLINE uint32_t device_cycle_count(void)
 {
-  /// @brief 设备基类指针
-  Device_Base* device;
-  /// @brief 设备事件标志位
-  uint32_t     event_bits;
-};
+  return DWT->CYCCNT;
+}
 
 /**
- * @brief 设备管理器
+ * @brief 设备管理器 通道基类
  *
+ * @note  事件按设备合并: 投递时将事件并入设备的待处理标志，仅当标志由零变为非零时设备入队;
+ *        处理时一次取出全部标志，处理期间新到的事件使设备重新入队，不会丢失;
+ *        设备首次投递时登记到通道，登记设备数不超过队列大小，因此入队不会失败
  */
-class Device_Manager final : private thread::Thread<DEVICE_MANAGER_STACK_SIZE, 0, Device_Manager>
+class Device_Lane_Base
 {
   // 禁止拷贝和移动
-  QAQ_NO_COPY_MOVE(Device_Manager)
+  QAQ_NO_COPY_MOVE(Device_Lane_Base)
 
-private:
-  /// @brief 设备管理器 消息队列名称
-  static constexpr const char* QUEUE_NAME  = "Device Manager Queue";
-  /// @brief 设备管理器 线程名称
-  static constexpr const char* THREAD_NAME = "Device Manager Thread";
+protected:
+  /// @brief 通道 消息队列类型
+  using Queue = kernel::Message_Queue<Device_Base*, DEVICE_MANAGER_MASSAGE_QUEUE_SIZE>;
+
+  /// @brief 通道 消息队列
+  Queue                 m_queue;
+  /// @brief 入队次数
+  std::atomic<uint32_t> m_posted       = 0;
+  /// @brief 合并次数
+  std::atomic<uint32_t> m_merged       = 0;
+  /// @brief 丢弃次数
+  std::atomic<uint32_t> m_dropped      = 0;
+  /// @brief 已登记设备数 (关中断修改)
+  uint32_t              m_devices      = 0;
+  /// @brief 处理次数
+  uint32_t              m_handled      = 0;
+  /// @brief 最近一次处理耗时
+  uint32_t              m_last_cycles  = 0;
+  /// @brief 最长处理耗时
+  uint32_t              m_max_cycles   = 0;
+  /// @brief 累计处理耗时
+  uint64_t              m_total_cycles = 0;
+
+  /**
+   * @brief  通道 处理设备事件 (通道线程中执行)
+   *
+   * @param  device 设备基类指针
+   */
+  void process(Device_Base* device)
+  {
+    constexpr uint32_t async_bit = static_cast<uint32_t>(Device_Event_Bits::Async_Request);
+
+    const uint32_t event_bits    = device->m_pending_events.exchange(0, std::memory_order_acq_rel);
+    const uint32_t start         = device_cycle_count();
 
-  /// @brief 设备管理器 消息队列类型
-  using Queue                              = kernel::Message_Queue<Device_Event_Message, DEVICE_MANAGER_MASSAGE_QUEUE_SIZE>;
-  /// @brief 设备管理器 消息队列
-  Queue m_queue;
+    if (event_bits & async_bit)
+    {
+      device->async_handler();
+    }
+
+    if (event_bits & ~async_bit)
+    {
+      device->manger_handler(event_bits & ~async_bit);
+    }
+
+    const uint32_t cycles  = device_cycle_count() - start;
+    m_handled             += 1;
+    m_last_cycles          = cycles;
+    m_total_cycles        += cycles;
+
+    if (cycles > m_max_cycles)
+    {
+      m_max_cycles = cycles;
+    }
+  }
+
+  /**
+   * @brief 通道 构造函数
+   *
+   * @param name 消息队列名称
+   */
+  explicit Device_Lane_Base(const char* name) : m_queue(name) {}
+
+  /**
+   * @brief 通道 析构函数
+   */
+  ~Device_Lane_Base() {}
+
+public:
+  /**
+   * @brief  通道 登记设备 (可在中断中调用，已登记时直接返回)
+   *
+   * @param  device     设备基类指针
+   * @return true       已登记
+   * @return false      失败 (通道登记设备数已满)
+   */
+  bool attach(Device_Base* device)
+  {
+    bool ret = device->m_manager_attached.load(std::memory_order_acquire);
+
+    if (!ret)
+    {
+      kernel::Interrupt_Guard guard;
+
+      if (device->m_manager_attached.load(std::memory_order_relaxed))
+      {
+        ret = true;
+      }
+      else if (m_devices < DEVICE_MANAGER_MASSAGE_QUEUE_SIZE)
+      {
+        ++m_devices;
+        device->m_manager_attached.store(true, std::memory_order_release);
+        ret = true;
+      }
+      else
+      {
+        m_dropped.fetch_add(1, std::memory_order_relaxed);
+      }
+    }
+
+    return ret;
+  }
+
+  /**
+   * @brief  通道 注销设备 (设备析构时调用，设备不可仍在队列中)
+   *
+   * @param  device     设备基类指针
+   */
+  void detach(Device_Base* device)
+  {
+    kernel::Interrupt_Guard guard;
+
+    if (device->m_manager_attached.load(std::memory_order_relaxed))
+    {
+      device->m_manager_attached.store(false, std::memory_order_relaxed);
+      --m_devices;
+    }
+  }
+
+  /**
+   * @brief  通道 投递已登记设备的事件 (可在中断中调用)
+   *
+   * @param  device     设备基类指针 (已通过 attach() 登记)
+   * @param  event_bits 设备事件标志位
+   * @return true       成功 (入队或并入待处理标志)
+   * @return false      失败 (入队失败)
+   */
+  bool post(Device_Base* device, uint32_t event_bits)
+  {
+    bool ret = true;
+
+    const uint32_t previous = device->m_pending_events.fetch_or(event_bits, std::memory_order_acq_rel);
+
+    if (0 != previous)
+    {
+      m_merged.fetch_add(1, std::memory_order_relaxed);
+    }
+    else if (Queue::Status::SUCCESS == m_queue.send(device, 0))
+    {
+      m_posted.fetch_add(1, std::memory_order_relaxed);
+    }
+    else
+    {
+      // 登记设备各占至多一项，入队不会失败; 防御性处理: 仅撤回本次投递的标志位
+      device->m_pending_events.fetch_and(~event_bits, std::memory_order_acq_rel);
+      m_dropped.fetch_add(1, std::memory_order_relaxed);
+      ret = false;
+    }
+
+    return ret;
+  }
 
-  /// @brief 设备管理器 线程任务
+  /**
+   * @brief  通道 获取统计 (诊断用途，非原子快照)
+   *
+   * @return device::Device_Lane_Stats 统计
+   */
+  device::Device_Lane_Stats stats(void) const
+  {
+    device::Device_Lane_Stats stats;
+    stats.posted       = m_posted.load(std::memory_order_relaxed);
+    stats.merged       = m_merged.load(std::memory_order_relaxed);
+    stats.dropped      = m_dropped.load(std::memory_order_relaxed);
+    stats.devices      = m_devices;
+    stats.handled      = m_handled;
+    stats.last_cycles  = m_last_cycles;
+    stats.max_cycles   = m_max_cycles;
+    stats.total_cycles = m_total_cycles;
+    return stats;
+  }
+
+  /**
+   * @brief  通道 清零统计
+   */
+  void reset_stats(void)
+  {
+    m_posted.store(0, std::memory_order_relaxed);
+    m_merged.store(0, std::memory_order_relaxed);
+    m_dropped.store(0, std::memory_order_relaxed);
+    m_handled      = 0;
+    m_last_cycles  = 0;
+    m_max_cycles   = 0;
+    m_total_cycles = 0;
+  }
+};
+
+/**
+ * @brief  设备管理器 通道工作线程
+ *
+ * @tparam Lane 通道编号
+ */
+template <uint32_t Lane>
+class Device_Lane_Worker final : public Device_Lane_Base, private thread::Thread<DEVICE_MANAGER_LANE_CONFIG[Lane].stack_size, 0, Device_Lane_Worker<Lane>>
+{
+  // 禁止拷贝和移动
+  QAQ_NO_COPY_MOVE(Device_Lane_Worker)
+
+  /// @brief 通道 线程任务
   THREAD_TASK
   {
-    Device_Event_Message message;
+    Device_Base* device = nullptr;
     while (true)
     {
-      if (m_queue.receive(message, TX_WAIT_FOREVER) == Queue::Status::SUCCESS)
+      if (m_queue.receive(device, TX_WAIT_FOREVER) == Queue::Status::SUCCESS)
       {
-        if (nullptr != message.device)
-          message.device->manger_handler(message.event_bits);
+        if (nullptr != device)
+        {
+          process(device);
+        }
 
-        message.device     = nullptr;
-        message.event_bits = 0;
+        device = nullptr;
       }
     }
   }
 
+public:
+  /**
+   * @brief 通道工作线程 构造函数
+   */
+  explicit Device_Lane_Worker() : Device_Lane_Base(DEVICE_MANAGER_LANE_CONFIG[Lane].name)
+  {
+    this->create(DEVICE_MANAGER_LANE_CONFIG[Lane].name, DEVICE_MANAGER_LANE_CONFIG[Lane].priority);
+    this->start();
+  }
+
+  /**
+   * @brief 通道工作线程 析构函数
+   */
+  ~Device_Lane_Worker() {}
+};
+
+/**
+ * @brief 设备管理器 通道工作线程组
+ *
+ * @tparam Sequence 通道编号序列
+ */
+template <typename Sequence>
+struct Device_Lane_Workers;
+
+/**
+ * @brief 设备管理器 通道工作线程组 - 序列特化
+ *
+ * @tparam Lane 通道编号
+ */
+template <uint32_t... Lane>
+struct Device_Lane_Workers<std::integer_sequence<uint32_t, Lane...>>
+{
+  /// @brief 工作线程元组类型
+  using Type = std::tuple<Device_Lane_Worker<Lane>...>;
+};
+
+/**
+ * @brief 设备管理器 (按设备通道分发至独立的工作线程)
+ *
+ */
+class Device_Manager final
+{
+  // 禁止拷贝和移动
+  QAQ_NO_COPY_MOVE(Device_Manager)
+
 private:
+  /// @brief 设备管理器 工作线程组类型
+  using Workers = typename Device_Lane_Workers<std::make_integer_sequence<uint32_t, DEVICE_MANAGER_LANE_COUNT>>::Type;
+
+  /// @brief 设备管理器 工作线程组
+  Workers           m_workers;
+  /// @brief 设备管理器 通道表
+  Device_Lane_Base* m_lanes[DEVICE_MANAGER_LANE_COUNT];
+
   /**
    * @brief 设备管理器 构造函数
    *
    */
-  explicit Device_Manager() : Thread(), m_queue(QUEUE_NAME)
+  explicit Device_Manager()
   {
-    create(THREAD_NAME, DEVICE_MANAGER_PRIORITY);
-    start();
+    // 使能 DWT 周期计数 (处理耗时统计)
+    CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+    DWT->LAR          = 0xC5ACCE55;
+    DWT->CTRL        |= DWT_CTRL_CYCCNTENA_Msk;
+
+    std::apply([this](auto&... worker) {
+      uint32_t index = 0;
+      ((m_lanes[index++] = &worker), ...);
+    },
+               m_workers);
   }
 
   /**
@@ -86,6 +366,24 @@ private:
    */
   ~Device_Manager() {}
 
+  /**
+   * @brief  设备管理器 获取通道 (超出通道数量的编号归入最后一个通道)
+   *
+   * @param  lane               通道
+   * @return Device_Lane_Base&  通道
+   */
+  Device_Lane_Base& lane(device::Device_Lane lane) const
+  {
+    uint32_t index = static_cast<uint32_t>(lane);
+
+    if (index >= DEVICE_MANAGER_LANE_COUNT)
+    {
+      index = DEVICE_MANAGER_LANE_COUNT - 1;
+    }
+
+    return *m_lanes[index];
+  }
+
 public:
   /**
    * @brief  设备管理器 获取单例
@@ -108,10 +406,49 @@ public:
    */
   bool post_event(Device_Base* device, uint32_t event_bits)
   {
-    Device_Event_Message message;
-    message.device     = device;
-    message.event_bits = event_bits;
-    return m_queue.send(message, 0) == Queue::Status::SUCCESS;
+    bool ret = false;
+
+    if (nullptr != device)
+    {
+      Device_Lane_Base& target = lane(device->m_manager_lane);
+      ret                      = target.attach(device) && target.post(device, event_bits);
+    }
+
+    return ret;
+  }
+
+  /**
+   * @brief  设备管理器 注销设备 (设备析构时调用，释放其占用的通道队列项)
+   *
+   * @param  device 设备基类指针
+   */
+  void detach(Device_Base* device)
+  {
+    if (nullptr != device)
+    {
+      lane(device->m_manager_lane).detach(device);
+    }
+  }
+
+  /**
+   * @brief  设备管理器 获取通道统计
+   *
+   * @param  lane                       通道
+   * @return device::Device_Lane_Stats  统计
+   */
+  device::Device_Lane_Stats stats(device::Device_Lane lane) const
+  {
+    return this->lane(lane).stats();
+  }
+
+  /**
+   * @brief  设备管理器 清零通道统计
+   *
+   * @param  lane 通道
+   */
+  void reset_stats(device::Device_Lane lane)
+  {
+    this->lane(lane).reset_stats();
   }
 };
 } /* namespace device_internal */
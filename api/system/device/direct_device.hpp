@@ -21,6 +21,9 @@ private:
   /// @brief 设备事件标志位
   using Bits = system_internal::device_internal::Device_Event_Bits;
 
+  /// @brief 写入者互斥锁 (多个写入者时整个写入独占发送通道)
+  kernel::Mutex<true> m_write_mutex;
+
 protected:
   /**
    * @brief  直接传输设备 设备数据接收元方法 - 纯虚函数
@@ -40,6 +43,62 @@ protected:
    */
   virtual uint32_t send_impl(const uint8_t* data, uint32_t size) = 0;
 
+  /**
+   * @brief  直接传输设备 设备聚集发送元方法 (默认逐段调用 send_impl 并等待各段发送完成，派生类可合并为一次发送)
+   *
+   * @param  vec        输出向量数组
+   * @param  count      输出向量数量
+   * @param  timeout_ms 段间等待超时时间 - 毫秒
+   * @return uint32_t   实际发送数据大小 (最后一段的发送完成由调用方等待)
+   */
+  virtual uint32_t sendv_impl(const Io_Vec* vec, uint32_t count, uint32_t timeout_ms)
+  {
+    uint32_t sent    = 0;
+    bool     pending = false;
+
+    for (uint32_t i = 0; i < count && m_opened; ++i)
+    {
+      if (0 == vec[i].size)
+      {
+        continue;
+      }
+
+      if (pending)
+      {
+        uint32_t event_bits = m_event_flags.wait((static_cast<uint32_t>(Bits::Transmit_Finish) | static_cast<uint32_t>(Bits::Close)), timeout_ms);
+        if (!(event_bits & static_cast<uint32_t>(Bits::Transmit_Finish)))
+        {
+          break;
+        }
+
+        m_event_flags.set(static_cast<uint32_t>(Bits::Enable_Transfer));
+        m_event_flags.clear(static_cast<uint32_t>(Bits::Transmit_Finish));
+        pending = false;
+      }
+
+      uint32_t bytes = send_impl(static_cast<const uint8_t*>(vec[i].data), vec[i].size);
+      if (0 == bytes)
+      {
+        break;
+      }
+
+      sent    += bytes;
+      pending  = true;
+
+      if (bytes < vec[i].size)
+      {
+        break;
+      }
+    }
+
+    if (0 != sent && !pending)
+    {
+      output_complete();
+    }
+
+    return sent;
+  }
+
   /**
    * @brief  直接传输设备 输入完成
    */
@@ -138,18 +197,37 @@ public:
    */
   int64_t write(const void* data, uint32_t size, uint32_t timeout_ms = 0) override
   {
-    int64_t        ret           = 0;
-    uint32_t       event_bits    = 0;
-    bool           need_transfer = false;
-    const uint8_t* data_ptr      = reinterpret_cast<const uint8_t*>(data);
+    Io_Vec vec = { data, size };
+    return Direct_Device::writev(&vec, 1, timeout_ms);
+  }
+
+  /**
+   * @brief  直接传输设备 聚集写入数据 (一次占用发送通道，各段之间不会插入其他写入者的数据)
+   *
+   * @param  vec                输出向量数组
+   * @param  count              输出向量数量
+   * @param  timeout_ms         超时时间 - 毫秒
+   * @return int64_t            写入数据大小
+   */
+  int64_t writev(const Io_Vec* vec, uint32_t count, uint32_t timeout_ms = 0) override
+  {
+    int64_t  ret           = 0;
+    uint32_t event_bits    = 0;
+    bool     need_transfer = false;
 
     if (!m_opened)
     {
       ret = -1;
     }
-    else if (0 != size)
+    else if (0 != io_vec_size(vec, count))
     {
-      if (m_event_flags.wait(static_cast<uint32_t>(Bits::Enable_Transfer), 0))
+      system_internal::device_internal::Device_Write_Lock lock(m_write_mutex, timeout_ms);
+
+      if (!lock.owns())
+      {
+        ret = 0;
+      }
+      else if (m_event_flags.wait(static_cast<uint32_t>(Bits::Enable_Transfer), 0))
       {
         event_bits = m_event_flags.wait((static_cast<uint32_t>(Bits::Transmit_Finish) | static_cast<uint32_t>(Bits::Close)), timeout_ms);
         if (static_cast<uint32_t>(Bits::Transmit_Finish) & event_bits)
@@ -167,7 +245,7 @@ public:
         m_event_flags.set(static_cast<uint32_t>(Bits::Enable_Transfer));
         m_event_flags.clear(static_cast<uint32_t>(Bits::Transmit_Finish));
 
-        ret = send_impl(data_ptr, size);
+        ret = (1 == count) ? send_impl(static_cast<const uint8_t*>(vec[0].data), vec[0].size) : sendv_impl(vec, count, timeout_ms);
 
         if (ret > 0)
         {
@@ -200,7 +278,13 @@ public:
     }
     else
     {
-      if (m_event_flags.wait(static_cast<uint32_t>(Bits::Enable_Transfer), 0))
+      system_internal::device_internal::Device_Write_Lock lock(m_write_mutex, timeout_ms);
+
+      if (!lock.owns())
+      {
+        error_code = Device_Error_Code::TIMEOUT;
+      }
+      else if (m_event_flags.wait(static_cast<uint32_t>(Bits::Enable_Transfer), 0))
       {
         event_bits = m_event_flags.wait((static_cast<uint32_t>(Bits::Transmit_Finish) | static_cast<uint32_t>(Bits::Close)), timeout_ms);
 
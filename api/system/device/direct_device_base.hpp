@@ -47,7 +47,10 @@ protected:
    * @brief  直接传输设备基类 析构函数
    *
    */
-  virtual ~Direct_Device_Base() {}
+  virtual ~Direct_Device_Base()
+  {
+    Device_Manager::instance().detach(this);
+  }
 
 public:
   /**
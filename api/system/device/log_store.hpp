@@ -0,0 +1,1035 @@
+#ifndef __LOG_STORE_HPP__
+#define __LOG_STORE_HPP__
+
+#include "storage_device_base.hpp"
+#include "crc.hpp"
+#include "mutex.hpp"
+#include "fast_memory.hpp"
+
+/// @brief 名称空间 QAQ
+namespace QAQ
+{
+/// @brief 名称空间 系统
+namespace system
+{
+/// @brief 名称空间 设备
+namespace device
+{
+/// @brief 日志储存 读取游标 (由 seek() 定位，read_next() 推进)
+struct Log_Cursor
+{
+  uint32_t sector;   /* 扇区号 */
+  uint32_t sequence; /* 扇区序号 (扇区被回收后游标失效) */
+  uint32_t offset;   /* 扇区内偏移 */
+};
+
+/// @brief 日志储存 统计
+struct Log_Store_Stats
+{
+  uint32_t appends;           /* 追加记录数 */
+  uint64_t append_bytes;      /* 追加数据字节数 */
+  uint32_t rotations;         /* 扇区切换次数 */
+  uint32_t background_erases; /* 后台擦除次数 */
+  uint32_t inline_erases;     /* 追加路径同步擦除次数 (预留扇区不足) */
+  uint32_t retired_sectors;   /* 回收的数据扇区数 (最旧数据被覆盖) */
+  uint32_t crc_errors;        /* 校验失败记录数 */
+  uint32_t recovered_records; /* 挂载时尾扇区恢复的记录数 */
+};
+
+/**
+ * @brief  日志储存 (基于 NOR 储存设备的追加式记录储存)
+ *
+ * @tparam Sector_Size   擦除扇区大小
+ * @tparam Sector_Count  使用的扇区数量
+ * @tparam Reserve       头扇区之后保持已擦除的预留扇区数
+ * @note   扇区按环形顺序写入，扇区头记录擦除次数、序号与首条记录时间戳，记录带 CRC-32 校验 (短记录与记录头一次编程写入);
+ *         RAM 中保存各扇区头索引，按时间戳定位时二分查找扇区，只扫描目标扇区;
+ *         扇区写满后在设备管理器 SLOW 通道中后台擦除头扇区之后的扇区 (必要时回收最旧扇区)，追加路径通常无需等待擦除;
+ *         挂载只读取各扇区头并扫描最新扇区，掉电造成的残缺记录使该扇区封存，后续记录写入新扇区;
+ *         时间戳需单调不减; 后端设备需支持按位编程 (NOR 语义) 并自行保证并发访问安全，关闭时不关闭后端设备
+ */
+template <uint32_t Sector_Size, uint32_t Sector_Count, uint32_t Reserve = 1>
+class Log_Store final : public system_internal::device_internal::Device_Base
+{
+  // 扇区大小检查
+  static_assert((256 <= Sector_Size) && (0 == (Sector_Size & (Sector_Size - 1))), "Sector_Size must be a power of 2 and >= 256");
+  // 预留扇区检查
+  static_assert(0 < Reserve, "Reserve must be greater than 0");
+  // 扇区数量检查
+  static_assert(Reserve + 2 <= Sector_Count, "Sector_Count must be >= Reserve + 2");
+
+  // 禁止拷贝和移动
+  QAQ_NO_COPY_MOVE(Log_Store)
+
+private:
+  /// @brief 扇区状态
+  enum class Sector_State : uint8_t
+  {
+    DIRTY,   /* 待擦除 */
+    ERASING, /* 后台擦除中 */
+    ERASED,  /* 已擦除 */
+    DATA,    /* 有数据 */
+  };
+
+  /// @brief 记录扫描结果
+  enum class Record_Status : uint8_t
+  {
+    VALID,   /* 有效记录 */
+    END,     /* 无更多记录 */
+    CORRUPT, /* 校验失败 */
+    FAILED,  /* 设备错误或游标失效 */
+  };
+
+  /// @brief 扇区头 (擦除后写入 magic 与 erase_count，启用时写入其余字段)
+  struct Sector_Header
+  {
+    uint32_t magic;           /* 格式标识 */
+    uint32_t erase_count;     /* 擦除次数 */
+    uint32_t sequence;        /* 扇区序号 */
+    uint32_t first_timestamp; /* 首条记录时间戳 */
+    uint32_t check;           /* 序号与时间戳校验 */
+  };
+
+  /// @brief 记录头 (其后为数据，记录按4字节对齐)
+  struct Record_Header
+  {
+    uint16_t length;    /* 数据长度 */
+    uint16_t tag;       /* 记录标识 */
+    uint32_t timestamp; /* 时间戳 */
+    uint32_t crc;       /* 记录头前8字节与数据的 CRC-32 */
+  };
+
+  /// @brief 扇区索引
+  struct Sector_Info
+  {
+    uint32_t     sequence;        /* 扇区序号 */
+    uint32_t     first_timestamp; /* 首条记录时间戳 */
+    uint32_t     erase_count;     /* 擦除次数 */
+    Sector_State state;           /* 状态 */
+  };
+
+  /// @brief 格式标识
+  static constexpr uint32_t MAGIC              = 0x474C4151U;
+  /// @brief 记录标识
+  static constexpr uint16_t RECORD_TAG         = 0x4C52U;
+  /// @brief 扇区头大小 (数据起始偏移)
+  static constexpr uint32_t SECTOR_HEADER_SIZE = 32;
+  /// @brief 记录头大小
+  static constexpr uint32_t RECORD_HEADER_SIZE = sizeof(Record_Header);
+  /// @brief 最大记录数据长度
+  static constexpr uint32_t MAX_RECORD_SIZE    = std::min<uint32_t>(Sector_Size - SECTOR_HEADER_SIZE - RECORD_HEADER_SIZE, 0xFFFEU);
+  /// @brief 合并编程大小 (记录头与数据不超过该大小时一次编程写入)
+  static constexpr uint32_t STAGING_SIZE       = 128;
+  /// @brief 擦除状态字
+  static constexpr uint32_t ERASED_WORD        = 0xFFFFFFFFU;
+  /// @brief 无效扇区
+  static constexpr uint32_t INVALID            = UINT32_MAX;
+
+  /// @brief 后端储存设备
+  system_internal::device_internal::Storage_Device_Base& m_device;
+  /// @brief 后端起始地址
+  const uint32_t                                         m_base;
+  /// @brief 索引互斥锁
+  kernel::Mutex<true>                                    m_mutex;
+  /// @brief 擦除互斥锁 (后台擦除期间持有，加锁顺序: 擦除锁 -> 索引锁)
+  kernel::Mutex<true>                                    m_erase_mutex;
+  /// @brief 扇区索引
+  Sector_Info                                            m_sectors[Sector_Count] = {};
+  /// @brief 头扇区 (最新数据扇区; 无数据时为下一个启用扇区的前一扇区)
+  uint32_t                                               m_head                  = Sector_Count - 1;
+  /// @brief 尾扇区 (最旧数据扇区)
+  uint32_t                                               m_tail                  = 0;
+  /// @brief 数据扇区数
+  uint32_t                                               m_data_count            = 0;
+  /// @brief 头扇区写入偏移
+  uint32_t                                               m_head_offset           = Sector_Size;
+  /// @brief 最新记录时间戳
+  uint32_t                                               m_last_timestamp        = 0;
+  /// @brief 下一个扇区序号
+  uint32_t                                               m_next_sequence         = 0;
+  /// @brief 统计
+  Log_Store_Stats                                        m_stats                 = { 0 };
+
+  /**
+   * @brief  日志储存 记录占用空间
+   *
+   * @param  length    数据长度
+   * @return uint32_t  占用字节数 (4字节对齐)
+   */
+  static constexpr uint32_t record_span(uint32_t length)
+  {
+    return RECORD_HEADER_SIZE + ((length + 3U) & ~3U);
+  }
+
+  /**
+   * @brief  日志储存 扇区头校验值
+   *
+   * @param  sequence         扇区序号
+   * @param  first_timestamp  首条记录时间戳
+   * @return uint32_t         校验值
+   */
+  static uint32_t header_check(uint32_t sequence, uint32_t first_timestamp)
+  {
+    const uint32_t words[2] = { sequence, first_timestamp };
+
+    return algorithm::Crc32::calculate(words, sizeof(words));
+  }
+
+  /**
+   * @brief  日志储存 后端读取
+   *
+   * @param  sector  扇区号
+   * @param  offset  扇区内偏移
+   * @param  data    数据缓存
+   * @param  size    数据大小
+   * @return true    成功
+   * @return false   失败
+   */
+  bool device_read(uint32_t sector, uint32_t offset, void* data, uint32_t size)
+  {
+    return m_device.read(m_base + sector * Sector_Size + offset, static_cast<uint8_t*>(data), size) == static_cast<int64_t>(size);
+  }
+
+  /**
+   * @brief  日志储存 后端编程
+   *
+   * @param  sector  扇区号
+   * @param  offset  扇区内偏移
+   * @param  data    数据缓存
+   * @param  size    数据大小
+   * @return true    成功
+   * @return false   失败
+   */
+  bool device_write(uint32_t sector, uint32_t offset, const void* data, uint32_t size)
+  {
+    return m_device.write(m_base + sector * Sector_Size + offset, static_cast<const uint8_t*>(data), size) == static_cast<int64_t>(size);
+  }
+
+  /**
+   * @brief  日志储存 擦除扇区并写入格式标识
+   *
+   * @param  sector       扇区号
+   * @param  erase_count  擦除后的擦除次数
+   * @return true         成功
+   * @return false        失败
+   */
+  bool format_sector(uint32_t sector, uint32_t erase_count)
+  {
+    const uint32_t words[2] = { MAGIC, erase_count };
+
+    return (m_device.erase(m_base + sector * Sector_Size, Sector_Size) == static_cast<int64_t>(Sector_Size)) && device_write(sector, 0, words, sizeof(words));
+  }
+
+  /**
+   * @brief  日志储存 回收尾扇区 (调用前需持有索引锁)
+   */
+  void retire_tail(void)
+  {
+    m_sectors[m_tail].state  = Sector_State::DIRTY;
+    m_tail                   = (m_tail + 1) % Sector_Count;
+    m_data_count            -= 1;
+    m_stats.retired_sectors++;
+  }
+
+  /**
+   * @brief  日志储存 启用头扇区之后的扇区 (调用前需持有索引锁，扇区不可处于擦除中)
+   *
+   * @param  timestamp  首条记录时间戳
+   * @return true       成功
+   * @return false      擦除或编程失败
+   */
+  bool open_sector(uint32_t timestamp)
+  {
+    const uint32_t sector = (m_head + 1) % Sector_Count;
+    Sector_Info&   info   = m_sectors[sector];
+    bool           ret    = true;
+
+    if (Sector_State::DATA == info.state)
+    {
+      retire_tail();
+    }
+
+    if (Sector_State::DIRTY == info.state)
+    {
+      ret = format_sector(sector, info.erase_count + 1);
+
+      if (ret)
+      {
+        info.erase_count++;
+        info.state = Sector_State::ERASED;
+        m_stats.inline_erases++;
+      }
+    }
+
+    if (ret)
+    {
+      const uint32_t words[3] = { m_next_sequence, timestamp, header_check(m_next_sequence, timestamp) };
+
+      ret = device_write(sector, offsetof(Sector_Header, sequence), words, sizeof(words));
+
+      if (ret)
+      {
+        info.sequence        = m_next_sequence;
+        info.first_timestamp = timestamp;
+        info.state           = Sector_State::DATA;
+        m_tail               = (0 == m_data_count) ? sector : m_tail;
+        m_head               = sector;
+        m_head_offset        = SECTOR_HEADER_SIZE;
+        m_data_count        += 1;
+        m_next_sequence     += 1;
+        m_stats.rotations++;
+      }
+      else
+      {
+        info.state = Sector_State::DIRTY;
+      }
+    }
+
+    return ret;
+  }
+
+  /**
+   * @brief  日志储存 扫描记录 (校验 CRC，可同时复制数据)
+   *
+   * @param  sector  扇区号
+   * @param  offset  扇区内偏移
+   * @param  header  记录头输出
+   * @param  data    数据缓存 (可为空)
+   * @param  size    数据缓存大小 (超出部分只参与校验)
+   * @return Record_Status 扫描结果
+   */
+  Record_Status scan_record(uint32_t sector, uint32_t offset, Record_Header& header, uint8_t* data, uint32_t size)
+  {
+    Record_Status ret = Record_Status::VALID;
+
+    if (offset + RECORD_HEADER_SIZE > Sector_Size)
+    {
+      ret = Record_Status::END;
+    }
+    else if (!device_read(sector, offset, &header, RECORD_HEADER_SIZE))
+    {
+      ret = Record_Status::FAILED;
+    }
+    else if ((0xFFFFU == header.length) && (0xFFFFU == header.tag) && (ERASED_WORD == header.timestamp) && (ERASED_WORD == header.crc))
+    {
+      ret = Record_Status::END;
+    }
+    else if ((RECORD_TAG != header.tag) || (0 == header.length) || (MAX_RECORD_SIZE < header.length) || (offset + record_span(header.length) > Sector_Size))
+    {
+      ret = Record_Status::CORRUPT;
+    }
+    else
+    {
+      const uint32_t copy     = std::min<uint32_t>(size, header.length);
+      uint32_t       position = offset + RECORD_HEADER_SIZE;
+      uint32_t       crc      = algorithm::Crc32::update(algorithm::Crc32::INIT, &header, offsetof(Record_Header, crc));
+
+      if ((0 != copy) && !device_read(sector, position, data, copy))
+      {
+        ret = Record_Status::FAILED;
+      }
+      else
+      {
+        uint8_t scratch[64];
+
+        crc       = algorithm::Crc32::update(crc, data, copy);
+        position += copy;
+
+        while ((Record_Status::VALID == ret) && (position < offset + RECORD_HEADER_SIZE + header.length))
+        {
+          const uint32_t length = std::min<uint32_t>(sizeof(scratch), offset + RECORD_HEADER_SIZE + header.length - position);
+
+          if (device_read(sector, position, scratch, length))
+          {
+            crc       = algorithm::Crc32::update(crc, scratch, length);
+            position += length;
+          }
+          else
+          {
+            ret = Record_Status::FAILED;
+          }
+        }
+
+        if ((Record_Status::VALID == ret) && (algorithm::Crc32::finish(crc) != header.crc))
+        {
+          ret = Record_Status::CORRUPT;
+        }
+      }
+    }
+
+    return ret;
+  }
+
+  /**
+   * @brief  日志储存 定位游标处的下一条有效记录 (调用前需持有索引锁，跨扇区时推进游标)
+   *
+   * @param  cursor  读取游标
+   * @param  header  记录头输出
+   * @param  data    数据缓存 (可为空)
+   * @param  size    数据缓存大小
+   * @return Record_Status VALID: 游标指向该记录; END: 已到最新记录之后; FAILED: 设备错误或游标所在扇区已被回收
+   */
+  Record_Status next_record(Log_Cursor& cursor, Record_Header& header, uint8_t* data, uint32_t size)
+  {
+    Record_Status ret = Record_Status::END;
+
+    while (true)
+    {
+      if ((Sector_Count <= cursor.sector) || (Sector_State::DATA != m_sectors[cursor.sector].state) || (cursor.sequence != m_sectors[cursor.sector].sequence))
+      {
+        ret = Record_Status::FAILED;
+        break;
+      }
+
+      if ((cursor.sector == m_head) && (m_head_offset <= cursor.offset))
+      {
+        ret = Record_Status::END;
+        break;
+      }
+
+      ret = scan_record(cursor.sector, cursor.offset, header, data, size);
+
+      if ((Record_Status::VALID == ret) || (Record_Status::FAILED == ret))
+      {
+        break;
+      }
+
+      if (Record_Status::CORRUPT == ret)
+      {
+        m_stats.crc_errors++;
+      }
+
+      if (cursor.sector == m_head)
+      {
+        ret = Record_Status::END;
+        break;
+      }
+
+      // 当前扇区剩余部分不可用，转到下一扇区
+      cursor.sector   = (cursor.sector + 1) % Sector_Count;
+      cursor.sequence = m_sectors[cursor.sector].sequence;
+      cursor.offset   = SECTOR_HEADER_SIZE;
+    }
+
+    return ret;
+  }
+
+  /**
+   * @brief  日志储存 选择后台擦除扇区 (调用前需持有索引锁)
+   *
+   * @return uint32_t 扇区号，无需擦除返回INVALID
+   */
+  uint32_t erase_target(void)
+  {
+    uint32_t ret = INVALID;
+
+    // 优先保证头扇区之后的预留扇区已擦除，必要时回收最旧扇区
+    for (uint32_t i = 1; (i <= Reserve) && (INVALID == ret); ++i)
+    {
+      const uint32_t sector = (m_head + i) % Sector_Count;
+
+      if (Sector_State::DATA == m_sectors[sector].state)
+      {
+        retire_tail();
+        ret = sector;
+      }
+      else if (Sector_State::DIRTY == m_sectors[sector].state)
+      {
+        ret = sector;
+      }
+    }
+
+    for (uint32_t sector = 0; (sector < Sector_Count) && (INVALID == ret); ++sector)
+    {
+      if (Sector_State::DIRTY == m_sectors[sector].state)
+      {
+        ret = sector;
+      }
+    }
+
+    return ret;
+  }
+
+  /**
+   * @brief  日志储存 后台擦除 (设备管理器线程中执行，擦除期间不持有索引锁)
+   */
+  void maintain(void)
+  {
+    kernel::Mutex_Guard<kernel::Mutex<true>> erase_guard(m_erase_mutex);
+    bool                                     run = true;
+
+    while (run)
+    {
+      uint32_t sector      = INVALID;
+      uint32_t erase_count = 0;
+
+      m_mutex.lock();
+
+      if (m_opened)
+      {
+        sector = erase_target();
+
+        if (INVALID != sector)
+        {
+          m_sectors[sector].state = Sector_State::ERASING;
+          erase_count             = m_sectors[sector].erase_count + 1;
+        }
+      }
+
+      m_mutex.unlock();
+
+      if (INVALID == sector)
+      {
+        break;
+      }
+
+      run = format_sector(sector, erase_count);
+
+      m_mutex.lock();
+      m_sectors[sector].state       = run ? Sector_State::ERASED : Sector_State::DIRTY;
+      m_sectors[sector].erase_count = run ? erase_count : m_sectors[sector].erase_count;
+      m_stats.background_erases++;
+      m_mutex.unlock();
+    }
+  }
+
+  /**
+   * @brief  日志储存 挂载 (读取各扇区头重建索引，只扫描最新扇区)
+   *
+   * @return Device_Error_Code 错误码
+   */
+  Device_Error_Code mount(void)
+  {
+    Device_Error_Code error_code = Device_Error_Code::OK;
+    uint32_t          head       = INVALID;
+
+    for (uint32_t sector = 0; sector < Sector_Count; ++sector)
+    {
+      Sector_Header header;
+      Sector_Info&  info = m_sectors[sector];
+
+      if (!device_read(sector, 0, &header, sizeof(header)))
+      {
+        error_code = Device_Error_Code::IO_ERROR;
+        break;
+      }
+
+      info = { header.sequence, header.first_timestamp, 0, Sector_State::DIRTY };
+
+      if (MAGIC == header.magic)
+      {
+        info.erase_count = header.erase_count;
+
+        if ((ERASED_WORD == header.sequence) && (ERASED_WORD == header.first_timestamp) && (ERASED_WORD == header.check))
+        {
+          info.state = Sector_State::ERASED;
+        }
+        else if (header_check(header.sequence, header.first_timestamp) == header.check)
+        {
+          info.state = Sector_State::DATA;
+
+          if ((INVALID == head) || (0 < static_cast<int32_t>(header.sequence - m_sectors[head].sequence)))
+          {
+            head = sector;
+          }
+        }
+      }
+    }
+
+    m_data_count     = 0;
+    m_head           = Sector_Count - 1;
+    m_tail           = 0;
+    m_head_offset    = Sector_Size;
+    m_last_timestamp = 0;
+    m_next_sequence  = 0;
+
+    if ((Device_Error_Code::OK == error_code) && (INVALID != head))
+    {
+      Record_Header header;
+      Record_Status status = Record_Status::VALID;
+
+      // 自最新扇区向前，序号连续的数据扇区构成日志，其余视为待擦除
+      m_head       = head;
+      m_tail       = head;
+      m_data_count = 1;
+
+      while (m_data_count < Sector_Count)
+      {
+        const uint32_t previous = (m_tail + Sector_Count - 1) % Sector_Count;
+
+        if ((Sector_State::DATA != m_sectors[previous].state) || (m_sectors[m_tail].sequence - 1 != m_sectors[previous].sequence))
+        {
+          break;
+        }
+
+        m_tail        = previous;
+        m_data_count += 1;
+      }
+
+      for (uint32_t sector = 0; sector < Sector_Count; ++sector)
+      {
+        if ((Sector_State::DATA == m_sectors[sector].state) && (m_data_count <= (sector + Sector_Count - m_tail) % Sector_Count))
+        {
+          m_sectors[sector].state = Sector_State::DIRTY;
+        }
+      }
+
+      m_next_sequence  = m_sectors[head].sequence + 1;
+      m_last_timestamp = m_sectors[head].first_timestamp;
+      m_head_offset    = SECTOR_HEADER_SIZE;
+
+      while (true)
+      {
+        status = scan_record(head, m_head_offset, header, nullptr, 0);
+
+        if (Record_Status::VALID != status)
+        {
+          break;
+        }
+
+        m_head_offset    += record_span(header.length);
+        m_last_timestamp  = header.timestamp;
+        m_stats.recovered_records++;
+      }
+
+      if (Record_Status::FAILED == status)
+      {
+        error_code = Device_Error_Code::IO_ERROR;
+      }
+      else if (Record_Status::CORRUPT == status)
+      {
+        // 残缺记录所在位置不可再编程，封存该扇区
+        m_head_offset = Sector_Size;
+        m_stats.crc_errors++;
+      }
+    }
+
+    return error_code;
+  }
+
+  /**
+   * @brief  日志储存 发送事件
+   *
+   * @param  event 事件标志
+   * @return true  发送成功
+   * @return false 发送失败
+   */
+  bool post_event(uint32_t event) override
+  {
+    return system_internal::device_internal::Device_Manager::instance().post_event(this, event);
+  }
+
+  /**
+   * @brief  日志储存 设备管理器事件处理句柄 (任意事件触发后台擦除)
+   */
+  void manger_handler(uint32_t) override
+  {
+    if (m_opened)
+    {
+      maintain();
+    }
+  }
+
+  /**
+   * @brief  日志储存 打开 - 元方法覆写 (后端未打开时一并打开，随后挂载)
+   *
+   * @return Device_Error_Code 错误码
+   */
+  Device_Error_Code open_impl(void) override
+  {
+    Device_Error_Code error_code = Device_Error_Code::OK;
+
+    if (!m_device.is_opened())
+    {
+      error_code = m_device.open();
+    }
+
+    if (Device_Error_Code::OK == error_code)
+    {
+      kernel::Mutex_Guard<kernel::Mutex<true>> erase_guard(m_erase_mutex);
+      kernel::Mutex_Guard<kernel::Mutex<true>> guard(m_mutex);
+
+      error_code = mount();
+    }
+
+    return error_code;
+  }
+
+  /**
+   * @brief  日志储存 关闭 - 元方法覆写 (等待后台擦除结束)
+   *
+   * @return Device_Error_Code 错误码
+   */
+  Device_Error_Code close_impl(void) override
+  {
+    kernel::Mutex_Guard<kernel::Mutex<true>> erase_guard(m_erase_mutex);
+    kernel::Mutex_Guard<kernel::Mutex<true>> guard(m_mutex);
+
+    return Device_Error_Code::OK;
+  }
+
+  /**
+   * @brief  日志储存 配置 - 元方法覆写 (无可配置参数)
+   *
+   * @return Device_Error_Code 错误码
+   */
+  Device_Error_Code config_impl(uint32_t, uint32_t) override
+  {
+    return Device_Error_Code::INVALID_PARAMETER;
+  }
+
+  /**
+   * @brief  日志储存 获取配置 - 元方法覆写 (无可配置参数)
+   *
+   * @return uint32_t 配置值
+   */
+  uint32_t get_config_impl(uint32_t) const override
+  {
+    return 0;
+  }
+
+public:
+  /**
+   * @brief  日志储存 构造函数
+   *
+   * @param  device        后端储存设备
+   * @param  base_address  后端起始地址 (扇区对齐)
+   */
+  explicit Log_Store(system_internal::device_internal::Storage_Device_Base& device, uint32_t base_address = 0)
+      : m_device(device), m_base(base_address), m_mutex("Log Store Mutex"), m_erase_mutex("Log Store Erase Mutex")
+  {
+    m_manager_lane = Device_Lane::SLOW;
+  }
+
+  /**
+   * @brief  日志储存 析构函数
+   */
+  ~Log_Store()
+  {
+    system_internal::device_internal::Device_Manager::instance().detach(this);
+  }
+
+  /**
+   * @brief  日志储存 追加记录
+   *
+   * @param  timestamp  时间戳 (不小于上一条记录)
+   * @param  data       数据
+   * @param  size       数据大小 (1 ~ max_record_size())
+   * @return int64_t    写入数据大小，未打开、参数无效、时间戳回退或后端失败返回-1
+   */
+  int64_t append(uint32_t timestamp, const void* data, uint32_t size)
+  {
+    int64_t ret     = -1;
+    bool    rotated = false;
+
+    if (m_opened && (nullptr != data) && (0 != size) && (MAX_RECORD_SIZE >= size))
+    {
+      kernel::Mutex_Guard<kernel::Mutex<true>> guard(m_mutex);
+      const uint32_t                           span  = record_span(size);
+      bool                                     ready = false;
+
+      while (!ready && ((0 == m_data_count) || (timestamp >= m_last_timestamp)))
+      {
+        if ((0 != m_data_count) && (m_head_offset + span <= Sector_Size))
+        {
+          ready = true;
+        }
+        else if (Sector_State::ERASING == m_sectors[(m_head + 1) % Sector_Count].state)
+        {
+          // 预留扇区耗尽且下一扇区正在后台擦除: 释放索引锁等待擦除结束
+          m_mutex.unlock();
+          m_erase_mutex.lock();
+          m_erase_mutex.unlock();
+          m_mutex.lock();
+        }
+        else if (open_sector(timestamp))
+        {
+          rotated = true;
+        }
+        else
+        {
+          break;
+        }
+      }
+
+      if (ready && (timestamp >= m_last_timestamp))
+      {
+        Record_Header header = { static_cast<uint16_t>(size), RECORD_TAG, timestamp, 0 };
+
+        header.crc = algorithm::Crc32::update(algorithm::Crc32::INIT, &header, offsetof(Record_Header, crc));
+        header.crc = algorithm::Crc32::finish(algorithm::Crc32::update(header.crc, data, size));
+
+        bool written = false;
+
+        if (RECORD_HEADER_SIZE + size <= STAGING_SIZE)
+        {
+          // 短记录合并为一次编程，NOR 编程耗时按次计
+          uint8_t staging[STAGING_SIZE];
+
+          memory::fast_memcpy(staging, &header, RECORD_HEADER_SIZE);
+          memory::fast_memcpy(staging + RECORD_HEADER_SIZE, data, size);
+          written = device_write(m_head, m_head_offset, staging, RECORD_HEADER_SIZE + size);
+        }
+        else
+        {
+          written = device_write(m_head, m_head_offset, &header, RECORD_HEADER_SIZE) && device_write(m_head, m_head_offset + RECORD_HEADER_SIZE, data, size);
+        }
+
+        if (written)
+        {
+          m_head_offset    += span;
+          m_last_timestamp  = timestamp;
+          m_stats.appends++;
+          m_stats.append_bytes += size;
+          ret                   = size;
+        }
+        else
+        {
+          // 编程失败的位置不可再使用，封存头扇区
+          m_head_offset = Sector_Size;
+        }
+      }
+    }
+
+    if (rotated)
+    {
+      post_event(static_cast<uint32_t>(system_internal::device_internal::Device_Event_Bits::Enable_Transfer));
+    }
+
+    return ret;
+  }
+
+  /**
+   * @brief  日志储存 按时间戳定位游标 (二分查找扇区索引，只扫描目标扇区)
+   *
+   * @param  timestamp  起始时间戳 (0 为最旧记录)
+   * @param  cursor     读取游标输出，指向首条时间戳不小于 timestamp 的记录
+   * @return true       成功
+   * @return false      未打开、无数据或设备错误
+   */
+  bool seek(uint32_t timestamp, Log_Cursor& cursor)
+  {
+    bool ret = false;
+
+    if (m_opened)
+    {
+      kernel::Mutex_Guard<kernel::Mutex<true>> guard(m_mutex);
+
+      if (0 != m_data_count)
+      {
+        Record_Header header;
+        Record_Status status = Record_Status::VALID;
+        uint32_t      low    = 0;
+        uint32_t      high   = m_data_count;
+
+        // 首个首条时间戳不小于 timestamp 的扇区，其前一扇区可能含相等时间戳的记录
+        while (low < high)
+        {
+          const uint32_t middle = (low + high) / 2;
+
+          if (m_sectors[(m_tail + middle) % Sector_Count].first_timestamp < timestamp)
+          {
+            low = middle + 1;
+          }
+          else
+          {
+            high = middle;
+          }
+        }
+
+        cursor.sector   = (m_tail + ((0 < low) ? (low - 1) : 0)) % Sector_Count;
+        cursor.sequence = m_sectors[cursor.sector].sequence;
+        cursor.offset   = SECTOR_HEADER_SIZE;
+
+        while ((Record_Status::VALID == (status = next_record(cursor, header, nullptr, 0))) && (header.timestamp < timestamp))
+        {
+          cursor.offset += record_span(header.length);
+        }
+
+        ret = (Record_Status::FAILED != status);
+      }
+    }
+
+    return ret;
+  }
+
+  /**
+   * @brief  日志储存 读取游标处记录并推进游标
+   *
+   * @param  cursor     读取游标
+   * @param  timestamp  记录时间戳输出
+   * @param  data       数据缓存
+   * @param  size       数据缓存大小 (记录超出部分被丢弃)
+   * @return int64_t    读取数据大小，无更多记录返回0，未打开、设备错误或游标所在扇区已被回收返回-1
+   * @note   校验失败的记录及其所在扇区的剩余部分被跳过
+   */
+  int64_t read_next(Log_Cursor& cursor, uint32_t& timestamp, uint8_t* data, uint32_t size)
+  {
+    int64_t ret = -1;
+
+    if (m_opened)
+    {
+      kernel::Mutex_Guard<kernel::Mutex<true>> guard(m_mutex);
+      Record_Header                            header;
+      const Record_Status                      status = next_record(cursor, header, data, size);
+
+      if (Record_Status::VALID == status)
+      {
+        cursor.offset += record_span(header.length);
+        timestamp      = header.timestamp;
+        ret            = std::min<uint32_t>(size, header.length);
+      }
+      else if (Record_Status::END == status)
+      {
+        ret = 0;
+      }
+    }
+
+    return ret;
+  }
+
+  /**
+   * @brief  日志储存 格式化 (同步擦除全部扇区)
+   *
+   * @return Device_Error_Code 错误码
+   */
+  Device_Error_Code format(void)
+  {
+    Device_Error_Code error_code = Device_Error_Code::OK;
+
+    if (!m_opened)
+    {
+      error_code = Device_Error_Code::NOT_OPENED;
+    }
+    else
+    {
+      kernel::Mutex_Guard<kernel::Mutex<true>> erase_guard(m_erase_mutex);
+      kernel::Mutex_Guard<kernel::Mutex<true>> guard(m_mutex);
+
+      for (uint32_t sector = 0; sector < Sector_Count; ++sector)
+      {
+        Sector_Info& info = m_sectors[sector];
+
+        if (format_sector(sector, info.erase_count + 1))
+        {
+          info.erase_count++;
+          info.state = Sector_State::ERASED;
+        }
+        else
+        {
+          info.state = Sector_State::DIRTY;
+          error_code = Device_Error_Code::IO_ERROR;
+        }
+      }
+
+      m_data_count     = 0;
+      m_head           = Sector_Count - 1;
+      m_tail           = 0;
+      m_head_offset    = Sector_Size;
+      m_last_timestamp = 0;
+    }
+
+    return error_code;
+  }
+
+  /**
+   * @brief  日志储存 获取数据扇区数
+   *
+   * @return uint32_t 扇区数
+   */
+  uint32_t used_sectors(void) const
+  {
+    return m_data_count;
+  }
+
+  /**
+   * @brief  日志储存 获取已擦除扇区数
+   *
+   * @return uint32_t 扇区数
+   */
+  uint32_t erased_sectors(void) const
+  {
+    uint32_t count = 0;
+
+    for (const Sector_Info& info : m_sectors)
+    {
+      count += (Sector_State::ERASED == info.state) ? 1 : 0;
+    }
+
+    return count;
+  }
+
+  /**
+   * @brief  日志储存 获取最旧记录所在扇区的首条时间戳
+   *
+   * @return uint32_t 时间戳，无数据返回0
+   */
+  uint32_t first_timestamp(void) const
+  {
+    return (0 != m_data_count) ? m_sectors[m_tail].first_timestamp : 0;
+  }
+
+  /**
+   * @brief  日志储存 获取最新记录时间戳
+   *
+   * @return uint32_t 时间戳，无数据返回0
+   */
+  uint32_t last_timestamp(void) const
+  {
+    return m_last_timestamp;
+  }
+
+  /**
+   * @brief  日志储存 获取扇区擦除次数
+   *
+   * @param  sector    扇区号
+   * @return uint32_t  擦除次数
+   */
+  uint32_t erase_count(uint32_t sector) const
+  {
+    return (sector < Sector_Count) ? m_sectors[sector].erase_count : 0;
+  }
+
+  /**
+   * @brief  日志储存 获取最大记录数据长度
+   *
+   * @return uint32_t 字节数
+   */
+  static constexpr uint32_t max_record_size(void)
+  {
+    return MAX_RECORD_SIZE;
+  }
+
+  /**
+   * @brief  日志储存 获取统计
+   *
+   * @return Log_Store_Stats 统计
+   */
+  Log_Store_Stats stats(void) const
+  {
+    return m_stats;
+  }
+
+  /**
+   * @brief  日志储存 清零统计
+   */
+  void reset_stats(void)
+  {
+    m_stats = { 0 };
+  }
+
+  /**
+   * @brief  日志储存 获取设备类型
+   *
+   * @return Device_Type 设备类型
+   */
+  device::Device_Type get_type(void) const override
+  {
+    return device::Device_Type::STORAGE;
+  }
+};
+} /* namespace device */
+} /* namespace system */
+} /* namespace QAQ */
+
+#endif /* __LOG_STORE_HPP__ */
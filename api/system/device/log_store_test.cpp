@@ -0,0 +1,470 @@
+/**
+ * @file   log_store_test.cpp
+ * @brief  日志储存 主机测试: 追加与按时间戳定位读取、环形回收与游标失效、重新挂载，
+ *         以及在编程与擦除任意字节处掉电后重新挂载的回放一致性 (掉电注入由 Ram_Flash_Device 提供)，
+ *         和不同记录长度下的追加吞吐基准
+ *
+ * @note   仅用于主机，不参与固件编译 (已加入 eide excludeList);
+ *         内核由 host_kernel.hpp 仿真 (后台擦除在设备管理器通道线程中与追加并发执行);
+ *         基准耗时请以不带 sanitizer 的 -O2 构建为准
+ *
+ *         构建 (仓库根目录):
+ *         g++ -std=c++17 -O2 -g -fsanitize=address,undefined -fpermissive -w \
+ *             $(python3 -c "import json;c=json.load(open('.eide/eide.json'))['targets']['Debug']['custom_dep'];print(' '.join(['-I'+p for p in c['incList']]+['-D'+d for d in c['defineList']]))") \
+ *             api/system/device/log_store_test.cpp -o log_store_test -lpthread && ./log_store_test
+ */
+#include "host_kernel.hpp"
+#include "log_store.hpp"
+#include "ram_flash_device.hpp"
+
+#include <chrono>
+#include <cstdio>
+#include <thread>
+#include <vector>
+
+using namespace QAQ::system::device;
+
+/* 主机测试不使用信号，对象析构时断开连接为空操作 */
+namespace QAQ
+{
+namespace system
+{
+namespace system_internal
+{
+namespace signal_internal
+{
+class Null_Signal_Manager final : public Signal_Manager_Base
+{
+};
+
+Null_Signal_Manager  g_null_signal_manager;
+Signal_Manager_Base* __signal_manager_base = &g_null_signal_manager;
+} /* namespace signal_internal */
+} /* namespace system_internal */
+} /* namespace system */
+} /* namespace QAQ */
+
+namespace
+{
+/// @brief 失败的检查数
+int g_failures = 0;
+
+#define CHECK(cond)                                                  \
+  do                                                                 \
+  {                                                                  \
+    if (!(cond))                                                     \
+    {                                                                \
+      ++g_failures;                                                  \
+      printf("%s:%d: CHECK(%s) failed\n", __FILE__, __LINE__, #cond); \
+    }                                                                \
+  } while (0)
+
+/// @brief 扇区大小
+constexpr uint32_t SECTOR       = 4096;
+/// @brief 扇区数量
+constexpr uint32_t SECTOR_COUNT = 8;
+
+/// @brief 模拟 NOR Flash
+Ram_Flash_Device<SECTOR, SECTOR_COUNT> g_flash;
+/// @brief 日志储存 (预留1个已擦除扇区)
+Log_Store<SECTOR, SECTOR_COUNT, 1>     g_log(g_flash);
+
+/// @brief NOR 粗略耗时模型: 每次编程至少一页，每页400us，扇区擦除45ms
+struct Nor_Model
+{
+  static constexpr double PAGE_PROG_US = 400.0;
+  static constexpr double ERASE_MS     = 45.0;
+
+  /**
+   * @brief  按后端操作统计估算编程与擦除耗时
+   *
+   * @param  stats   后端操作统计
+   * @return double  耗时 - 毫秒
+   */
+  static double ms(const Storage_Op_Stats& stats)
+  {
+    const uint64_t pages = std::max<uint64_t>(stats.write_ops, (stats.write_bytes + 255) / 256);
+
+    return pages * PAGE_PROG_US / 1000 + stats.erase_ops * ERASE_MS;
+  }
+};
+
+/**
+ * @brief  记录内容 (前4字节为序号，其余由序号生成，长度8~100字节)
+ *
+ * @param  index   记录序号
+ * @param  data    数据输出
+ * @return uint32_t 记录长度
+ */
+uint32_t make_record(uint32_t index, uint8_t* data)
+{
+  const uint32_t length = 8 + (index * 37) % 93;
+
+  memcpy(data, &index, sizeof(index));
+
+  for (uint32_t i = sizeof(index); i < length; ++i)
+  {
+    data[i] = static_cast<uint8_t>(index * 7 + i);
+  }
+
+  return length;
+}
+
+/**
+ * @brief  记录时间戳 (每3条记录共用一个时间戳)
+ */
+constexpr uint32_t record_timestamp(uint32_t index)
+{
+  return 1000 + index / 3;
+}
+
+/**
+ * @brief  追加序号为 index 的记录
+ */
+bool append_record(uint32_t index)
+{
+  uint8_t        data[128];
+  const uint32_t length = make_record(index, data);
+
+  return static_cast<int64_t>(length) == g_log.append(record_timestamp(index), data, length);
+}
+
+/// @brief 回放结果
+struct Replay
+{
+  uint32_t count; /* 记录数 */
+  uint32_t first; /* 首条记录序号 */
+  uint32_t last;  /* 末条记录序号 */
+  bool     valid; /* 内容正确、时间戳与序号连续 */
+};
+
+/**
+ * @brief  自最旧记录回放一遍，校验内容、时间戳与序号连续
+ */
+Replay replay_once(void)
+{
+  Replay     result = { 0, 0, 0, true };
+  Log_Cursor cursor;
+  uint8_t    data[128];
+  uint8_t    expect[128];
+  uint32_t   timestamp = 0;
+  int64_t    length    = 0;
+
+  if (!g_log.seek(0, cursor))
+  {
+    result.valid = (0 == g_log.used_sectors());
+    return result;
+  }
+
+  while (0 < (length = g_log.read_next(cursor, timestamp, data, sizeof(data))))
+  {
+    uint32_t index;
+
+    memcpy(&index, data, sizeof(index));
+
+    const uint32_t expect_length = make_record(index, expect);
+
+    result.valid = result.valid && (expect_length == length) && (0 == memcmp(expect, data, expect_length));
+    result.valid = result.valid && (record_timestamp(index) == timestamp);
+    result.valid = result.valid && ((0 == result.count) || (result.last + 1 == index));
+    result.first = (0 == result.count) ? index : result.first;
+    result.last  = index;
+    result.count++;
+  }
+
+  result.valid = result.valid && (0 == length);
+  return result;
+}
+
+/**
+ * @brief  自最旧记录回放全部记录 (回放期间后台擦除回收了最旧扇区时重新定位)
+ */
+Replay replay(void)
+{
+  Replay result = { 0, 0, 0, false };
+
+  for (uint32_t retry = 0; (retry < 4) && !result.valid; ++retry)
+  {
+    const uint32_t retired = g_log.stats().retired_sectors;
+
+    result = replay_once();
+
+    if (retired == g_log.stats().retired_sectors)
+    {
+      break;
+    }
+  }
+
+  return result;
+}
+
+/**
+ * @brief  等待设备管理器通道线程处理完追加时发出的后台擦除事件
+ */
+void settle(void)
+{
+  std::this_thread::sleep_for(std::chrono::milliseconds(20));
+}
+
+/**
+ * @brief  关闭并重新打开 (重新挂载)
+ */
+bool remount(void)
+{
+  return (Device_Error_Code::OK == g_log.close()) && (Device_Error_Code::OK == g_log.open());
+}
+
+/**
+ * @brief  格式化为空日志
+ */
+bool reset_log(void)
+{
+  return (g_log.is_opened() || (Device_Error_Code::OK == g_log.open())) && (Device_Error_Code::OK == g_log.format());
+}
+} /* namespace */
+
+/**
+ * @brief  测试: 追加后顺序读取、按时间戳定位 (相同时间戳定位到首条)、读取缓存不足时截断
+ */
+static void test_append_seek(void)
+{
+  CHECK(reset_log());
+  g_flash.reset_stats();
+
+  bool appended = true;
+
+  for (uint32_t i = 0; i < 200; ++i)
+  {
+    appended = appended && append_record(i);
+  }
+
+  CHECK(appended);
+  CHECK(record_timestamp(199) == g_log.last_timestamp());
+  CHECK(record_timestamp(0) == g_log.first_timestamp());
+
+  const Replay all = replay();
+  CHECK(all.valid && (200 == all.count) && (0 == all.first) && (199 == all.last));
+
+  // 时间戳不可回退
+  uint8_t data[128];
+  CHECK(-1 == g_log.append(record_timestamp(199) - 1, data, 8));
+  CHECK(-1 == g_log.append(record_timestamp(199), data, 0));
+  CHECK(-1 == g_log.append(record_timestamp(199), data, g_log.max_record_size() + 1));
+
+  // 相同时间戳 (序号 120、121、122) 定位到首条
+  Log_Cursor cursor;
+  uint32_t   timestamp = 0;
+  uint32_t   index     = 0;
+
+  CHECK(g_log.seek(record_timestamp(121), cursor));
+  CHECK(4 == g_log.read_next(cursor, timestamp, data, 4));
+  memcpy(&index, data, sizeof(index));
+  CHECK((120 == index) && (record_timestamp(120) == timestamp));
+
+  // 定位到最新记录之后
+  CHECK(g_log.seek(record_timestamp(199) + 1, cursor));
+  CHECK(0 == g_log.read_next(cursor, timestamp, data, sizeof(data)));
+  CHECK(append_record(200));
+  CHECK(0 < g_log.read_next(cursor, timestamp, data, sizeof(data)));
+  memcpy(&index, data, sizeof(index));
+  CHECK(200 == index);
+
+  CHECK(0 == g_flash.program_violations());
+}
+
+/**
+ * @brief  测试: 写满后回收最旧扇区、被回收扇区上的游标失效、重新挂载后记录不变且可继续追加
+ */
+static void test_wrap_remount(void)
+{
+  CHECK(reset_log());
+  g_flash.reset_stats();
+
+  Log_Cursor stale;
+  uint32_t   timestamp = 0;
+  uint8_t    data[128];
+  bool       appended  = true;
+
+  CHECK(append_record(0));
+  CHECK(g_log.seek(0, stale));
+
+  // 约 4.5 倍容量
+  for (uint32_t i = 1; i < 2000; ++i)
+  {
+    appended = appended && append_record(i);
+  }
+
+  CHECK(appended);
+  settle();
+  CHECK(-1 == g_log.read_next(stale, timestamp, data, sizeof(data)));
+  CHECK(0 < g_log.stats().retired_sectors);
+  CHECK((SECTOR_COUNT - 2 <= g_log.used_sectors()) && (g_log.used_sectors() <= SECTOR_COUNT));
+
+  const Replay before = replay();
+  CHECK(before.valid && (1999 == before.last) && (0 < before.first));
+  CHECK(record_timestamp(before.first) >= g_log.first_timestamp());
+
+  CHECK(remount());
+  const Replay after = replay();
+  CHECK(after.valid && (before.first == after.first) && (before.last == after.last));
+  CHECK(record_timestamp(1999) == g_log.last_timestamp());
+
+  appended = true;
+
+  for (uint32_t i = 2000; i < 2100; ++i)
+  {
+    appended = appended && append_record(i);
+  }
+
+  CHECK(appended);
+  settle();
+  CHECK(remount());
+  const Replay more = replay();
+  CHECK(more.valid && (2099 == more.last));
+
+  // 擦除次数均衡: 各扇区擦除次数相差不超过1轮
+  uint32_t low  = UINT32_MAX;
+  uint32_t high = 0;
+
+  for (uint32_t sector = 0; sector < SECTOR_COUNT; ++sector)
+  {
+    low  = std::min(low, g_log.erase_count(sector));
+    high = std::max(high, g_log.erase_count(sector));
+    CHECK(g_log.erase_count(sector) == g_flash.erase_count(sector));
+  }
+
+  CHECK(high - low <= 1);
+  CHECK(0 == g_flash.program_violations());
+}
+
+/**
+ * @brief  测试: 掉电回放 (在编程或擦除的任意字节处掉电，重新上电并挂载后)
+ *         已确认的记录不丢失 (回收的最旧扇区除外)、残缺记录不被读出、可继续追加且不对已编程位重复编程
+ *
+ * @param  prefill  掉电前已追加的记录数 (较大时掉电发生在回收与后台擦除过程中)
+ * @param  step     掉电字节位置步长
+ */
+static void test_power_fail_replay(uint32_t prefill, uint32_t step)
+{
+  // 掉电注入覆盖约 2.5 个扇区的编程与擦除 (擦除按每扇区 SECTOR 字节计)
+  constexpr uint32_t SPAN = SECTOR * 5 / 2;
+  // 掉电后至少保留的记录数: 除头扇区、预留扇区与被回收扇区外，每扇区至少35条 (最长记录112字节)
+  constexpr uint32_t KEEP = (SECTOR_COUNT - 3) * 35;
+
+  uint32_t runs     = 0;
+  uint32_t failures = g_failures;
+
+  for (uint32_t budget = 0; budget < SPAN; budget += step)
+  {
+    bool     ok    = reset_log();
+    uint32_t index = 0;
+
+    for (; ok && (index < prefill); ++index)
+    {
+      ok = append_record(index);
+    }
+
+    CHECK(ok);
+    g_flash.reset_stats();
+    g_flash.power_fail_after(budget);
+
+    // 追加直至掉电 (后台擦除可能先耗尽编程预算)
+    while (append_record(index))
+    {
+      ++index;
+    }
+
+    // 等待后台擦除结束后重新上电
+    CHECK(Device_Error_Code::OK == g_log.close());
+    g_flash.power_cycle();
+    CHECK(Device_Error_Code::OK == g_log.open());
+
+    const uint32_t acked  = index;
+    const Replay   result = replay();
+
+    CHECK(result.valid);
+    CHECK((0 == acked) || ((acked - 1 == result.last) && (std::min(acked, KEEP) <= result.count)));
+
+    // 重试未确认的记录并继续追加
+    bool appended = true;
+
+    for (uint32_t i = 0; i < 300; ++i)
+    {
+      appended = appended && append_record(index + i);
+    }
+
+    CHECK(appended);
+    CHECK(remount());
+
+    const Replay resumed = replay();
+
+    CHECK(resumed.valid && (index + 299 == resumed.last));
+    CHECK(0 == g_flash.program_violations());
+    ++runs;
+
+    if (failures != g_failures)
+    {
+      printf("power fail replay: prefill %u, budget %u failed\n", prefill, budget);
+      break;
+    }
+  }
+
+  printf("power fail replay: prefill %-5u %u runs\n", prefill, runs);
+}
+
+/**
+ * @brief  基准: 追加吞吐 (主机耗时与按 NOR 编程/擦除模型估算的耗时)，每次覆盖约4倍容量以包含回收与后台擦除
+ */
+static void bench_append(uint32_t length)
+{
+  const uint32_t count = SECTOR * SECTOR_COUNT * 4 / (length + 12);
+  uint8_t        data[4096];
+  bool           appended = true;
+
+  memset(data, 0x3C, sizeof(data));
+  CHECK(reset_log());
+  settle();
+  g_flash.reset_stats();
+  g_log.reset_stats();
+
+  const auto start = std::chrono::steady_clock::now();
+
+  for (uint32_t i = 0; i < count; ++i)
+  {
+    appended = appended && (static_cast<int64_t>(length) == g_log.append(i, data, length));
+  }
+
+  const double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+  // 等待后台擦除结束
+  CHECK(Device_Error_Code::OK == g_log.close());
+  CHECK(Device_Error_Code::OK == g_log.open());
+  CHECK(appended);
+
+  const Storage_Op_Stats flash = g_flash.stats();
+  const Log_Store_Stats  log   = g_log.stats();
+  const double           nor   = Nor_Model::ms(flash);
+
+  printf("%-8u %10u %12.0f %10.2f %10.2f %8u %8u %12.0f\n", length, count, count / seconds, static_cast<double>(flash.write_bytes) / (static_cast<double>(count) * length),
+         static_cast<double>(flash.write_ops) / count, log.background_erases, log.inline_erases, count / (nor / 1000));
+}
+
+int main(void)
+{
+  test_append_seek();
+  test_wrap_remount();
+  test_power_fail_replay(0, 7);
+  test_power_fail_replay(250, 11);
+  test_power_fail_replay(320, 13);
+
+  printf("%-8s %10s %12s %10s %10s %8s %8s %12s\n", "length", "records", "host rec/s", "write amp", "ops/rec", "bg erase", "inline", "NOR rec/s");
+
+  for (uint32_t length : { 16u, 64u, 256u, 1024u })
+  {
+    bench_append(length);
+  }
+
+  printf("log_store_test: %s (%d failures)\n", 0 == g_failures ? "OK" : "FAILED", g_failures);
+  fflush(stdout);
+  return 0 == g_failures ? 0 : 1;
+}
@@ -0,0 +1,155 @@
+#ifndef __LOOPBACK_DEVICE_HPP__
+#define __LOOPBACK_DEVICE_HPP__
+
+#include "streaming_device.hpp"
+
+/// @brief 名称空间 QAQ
+namespace QAQ
+{
+/// @brief 名称空间 系统
+namespace system
+{
+/// @brief 名称空间 设备
+namespace device
+{
+/**
+ * @brief  回环设备 (写入的数据经设备管理器转入输入缓存区，用于验证同步/异步接口与压测设备管理器)
+ *
+ * @tparam Buf_Size  输入/输出缓存区大小
+ * @note   输入缓存区空间不足时超出部分被丢弃并计入溢出计数 (与串口接收溢出一致)
+ */
+template <uint32_t Buf_Size = 256>
+class Loopback_Device final : public Stream_Device<Stream_Type::READ_WRITE, Buf_Size, Buf_Size, memory::Ring_Buffer_Mode::INPUT_SINGLE_BUFFER>
+{
+  // 禁止拷贝和移动
+  QAQ_NO_COPY_MOVE(Loopback_Device)
+
+private:
+  /// @brief 设备事件标志位
+  using Bits = system_internal::device_internal::Device_Event_Bits;
+
+  /// @brief 回环字节数
+  uint32_t m_loop_bytes    = 0;
+  /// @brief 溢出字节数
+  uint32_t m_overrun_bytes = 0;
+
+  /**
+   * @brief  回环设备 数据发送 - 元方法覆写 (数据直接转入输入缓存区)
+   *
+   * @param  data     数据指针
+   * @param  size     数据大小
+   * @return uint32_t 实际发送大小
+   */
+  uint32_t send_impl(const uint8_t* data, uint32_t size) override
+  {
+    const uint32_t space = this->m_input_buffer.space();
+    uint32_t       count = std::min(size, space);
+
+    if (0 != count)
+    {
+      uint8_t* ptr = this->input_buffer_ptr(count);
+      memory::fast_memcpy(ptr, data, count);
+      this->input_complete(count);
+    }
+
+    m_loop_bytes    += count;
+    m_overrun_bytes += size - count;
+
+    this->output_complete();
+    return size;
+  }
+
+  /**
+   * @brief  回环设备 设备管理器事件处理句柄
+   *
+   * @param  event 事件标志
+   */
+  void manger_handler(uint32_t event) override
+  {
+    if (event & static_cast<uint32_t>(Bits::Enable_Transfer))
+    {
+      uint32_t size = 0;
+      uint8_t* ptr  = this->output_start(size);
+
+      send_impl(ptr, size);
+    }
+  }
+
+  /**
+   * @brief  回环设备 打开 - 元方法覆写
+   *
+   * @return Device_Error_Code 错误码
+   */
+  Device_Error_Code open_impl(void) override
+  {
+    m_loop_bytes    = 0;
+    m_overrun_bytes = 0;
+    return Device_Error_Code::OK;
+  }
+
+  /**
+   * @brief  回环设备 关闭 - 元方法覆写
+   *
+   * @return Device_Error_Code 错误码
+   */
+  Device_Error_Code close_impl(void) override
+  {
+    return Device_Error_Code::OK;
+  }
+
+  /**
+   * @brief  回环设备 配置 - 元方法覆写 (无可配置参数)
+   *
+   * @return Device_Error_Code 错误码
+   */
+  Device_Error_Code config_impl(uint32_t, uint32_t) override
+  {
+    return Device_Error_Code::INVALID_PARAMETER;
+  }
+
+  /**
+   * @brief  回环设备 获取配置 - 元方法覆写 (无可配置参数)
+   *
+   * @return uint32_t 配置值
+   */
+  uint32_t get_config_impl(uint32_t) const override
+  {
+    return 0;
+  }
+
+public:
+  /**
+   * @brief  回环设备 构造函数
+   */
+  explicit Loopback_Device() {}
+
+  /**
+   * @brief  回环设备 析构函数
+   */
+  ~Loopback_Device() {}
+
+  /**
+   * @brief  回环设备 获取回环字节数
+   *
+   * @return uint32_t 回环字节数
+   */
+  uint32_t loop_bytes(void) const
+  {
+    return m_loop_bytes;
+  }
+
+  /**
+   * @brief  回环设备 获取溢出丢弃字节数
+   *
+   * @return uint32_t 溢出字节数
+   */
+  uint32_t overrun_bytes(void) const
+  {
+    return m_overrun_bytes;
+  }
+};
+} /* namespace device */
+} /* namespace system */
+} /* namespace QAQ */
+
+#endif /* __LOOPBACK_DEVICE_HPP__ */
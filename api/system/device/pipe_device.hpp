@@ -0,0 +1,291 @@
+#ifndef __PIPE_DEVICE_HPP__
+#define __PIPE_DEVICE_HPP__
+
+#include "streaming_device.hpp"
+
+/// @brief 名称空间 QAQ
+namespace QAQ
+{
+/// @brief 名称空间 系统
+namespace system
+{
+/// @brief 名称空间 设备
+namespace device
+{
+template <uint32_t In_Buf_Size, uint32_t Out_Buf_Size, memory::Ring_Buffer_Mode In_Buf_Mode>
+class Pipe_Device;
+
+/**
+ * @brief  管道端点 (写入的数据经输入钩子转入对端输入缓存区，输入路径与外设驱动一致)
+ *
+ * @tparam In_Buf_Size   输入缓存区大小
+ * @tparam Out_Buf_Size  输出缓存区大小 (0 为无缓存输出)
+ * @tparam In_Buf_Mode   输入缓存区模式
+ * @note   INPUT_BYTES 逐字节推入 (模拟接收中断); INPUT_SINGLE_BUFFER 整块写入 (模拟 DMA 接收);
+ *         INPUT_DOUBLE_BUFFER 按半区填充并切换 (模拟 DMA 双缓冲), 每次写入结束视为一次空闲帧;
+ *         对端输入缓存区空间不足时超出部分被丢弃并计入溢出计数
+ */
+template <uint32_t In_Buf_Size, uint32_t Out_Buf_Size, memory::Ring_Buffer_Mode In_Buf_Mode>
+class Pipe_End final : public Stream_Device<Stream_Type::READ_WRITE, In_Buf_Size, Out_Buf_Size, In_Buf_Mode>
+{
+  // 禁止拷贝和移动
+  QAQ_NO_COPY_MOVE(Pipe_End)
+
+  /// @brief 友元声明 管道设备
+  friend class Pipe_Device<In_Buf_Size, Out_Buf_Size, In_Buf_Mode>;
+
+private:
+  /// @brief 设备事件标志位
+  using Bits = system_internal::device_internal::Device_Event_Bits;
+
+  /// @brief 对端
+  Pipe_End* m_peer          = nullptr;
+  /// @brief 送达对端的字节数
+  uint32_t  m_sent_bytes    = 0;
+  /// @brief 对端溢出丢弃的字节数
+  uint32_t  m_overrun_bytes = 0;
+
+  /**
+   * @brief  管道端点 接收对端数据 (对端发送上下文中执行)
+   *
+   * @param  data     数据指针
+   * @param  size     数据大小
+   * @return uint32_t 实际接收大小
+   */
+  uint32_t deliver(const uint8_t* data, uint32_t size)
+  {
+    const uint32_t count = std::min(size, this->m_input_buffer.space());
+
+    if constexpr (memory::Ring_Buffer_Mode::INPUT_BYTES == In_Buf_Mode)
+    {
+      for (uint32_t i = 0; i < count; ++i)
+      {
+        this->input_buffer_push(data[i]);
+      }
+
+      this->input_complete();
+    }
+    else if constexpr (memory::Ring_Buffer_Mode::INPUT_SINGLE_BUFFER == In_Buf_Mode)
+    {
+      if (0 != count)
+      {
+        uint32_t length = count;
+        uint8_t* ptr    = this->input_buffer_ptr(length);
+
+        memory::fast_memcpy(ptr, data, count);
+        this->input_complete(count);
+      }
+    }
+    else if constexpr (memory::Ring_Buffer_Mode::INPUT_DOUBLE_BUFFER == In_Buf_Mode)
+    {
+      uint8_t*       memory[2] = { nullptr, nullptr };
+      const uint32_t half      = this->input_buffer_ptr(memory[0], memory[1]);
+      uint32_t       index     = 0;
+      uint32_t       fill      = 0;
+      uint32_t       offset    = 0;
+
+      while (offset < count)
+      {
+        const uint32_t length = std::min(count - offset, half - fill);
+
+        memory::fast_memcpy(memory[index] + fill, data + offset, length);
+        offset += length;
+        fill   += length;
+
+        if (half == fill)
+        {
+          this->memory_switch();
+          index ^= 1;
+          fill   = 0;
+        }
+      }
+
+      if (0 != fill)
+      {
+        this->input_complete(fill);
+      }
+    }
+
+    return count;
+  }
+
+  /**
+   * @brief  管道端点 数据发送 - 元方法覆写 (数据直接转入对端输入缓存区)
+   *
+   * @param  data     数据指针
+   * @param  size     数据大小
+   * @return uint32_t 实际发送大小
+   */
+  uint32_t send_impl(const uint8_t* data, uint32_t size) override
+  {
+    uint32_t count = 0;
+
+    if ((nullptr != m_peer) && m_peer->is_opened())
+    {
+      count = m_peer->deliver(data, size);
+    }
+
+    m_sent_bytes    += count;
+    m_overrun_bytes += size - count;
+
+    this->output_complete();
+    return size;
+  }
+
+  /**
+   * @brief  管道端点 设备管理器事件处理句柄
+   *
+   * @param  event 事件标志
+   */
+  void manger_handler(uint32_t event) override
+  {
+    if constexpr (0 < Out_Buf_Size)
+    {
+      if (event & static_cast<uint32_t>(Bits::Enable_Transfer))
+      {
+        uint32_t size = 0;
+        uint8_t* ptr  = this->output_start(size);
+
+        send_impl(ptr, size);
+      }
+    }
+  }
+
+  /**
+   * @brief  管道端点 打开 - 元方法覆写
+   *
+   * @return Device_Error_Code 错误码
+   */
+  Device_Error_Code open_impl(void) override
+  {
+    m_sent_bytes    = 0;
+    m_overrun_bytes = 0;
+    return Device_Error_Code::OK;
+  }
+
+  /**
+   * @brief  管道端点 关闭 - 元方法覆写
+   *
+   * @return Device_Error_Code 错误码
+   */
+  Device_Error_Code close_impl(void) override
+  {
+    return Device_Error_Code::OK;
+  }
+
+  /**
+   * @brief  管道端点 配置 - 元方法覆写 (无可配置参数)
+   *
+   * @return Device_Error_Code 错误码
+   */
+  Device_Error_Code config_impl(uint32_t, uint32_t) override
+  {
+    return Device_Error_Code::INVALID_PARAMETER;
+  }
+
+  /**
+   * @brief  管道端点 获取配置 - 元方法覆写 (无可配置参数)
+   *
+   * @return uint32_t 配置值
+   */
+  uint32_t get_config_impl(uint32_t) const override
+  {
+    return 0;
+  }
+
+  /**
+   * @brief  管道端点 构造函数
+   */
+  explicit Pipe_End() {}
+
+public:
+  /**
+   * @brief  管道端点 析构函数
+   */
+  ~Pipe_End() {}
+
+  /**
+   * @brief  管道端点 获取送达对端的字节数
+   *
+   * @return uint32_t 字节数
+   */
+  uint32_t sent_bytes(void) const
+  {
+    return m_sent_bytes;
+  }
+
+  /**
+   * @brief  管道端点 获取对端溢出丢弃的字节数
+   *
+   * @return uint32_t 字节数
+   */
+  uint32_t overrun_bytes(void) const
+  {
+    return m_overrun_bytes;
+  }
+};
+
+/**
+ * @brief  管道设备 (一对相互连接的流设备，无需外设即可驱动流设备、设备管理器与协议解析)
+ *
+ * @tparam In_Buf_Size   端点输入缓存区大小
+ * @tparam Out_Buf_Size  端点输出缓存区大小 (0 为无缓存输出)
+ * @tparam In_Buf_Mode   端点输入缓存区模式
+ * @note   两端需分别打开，对端未打开时写入的数据被丢弃
+ */
+template <uint32_t In_Buf_Size, uint32_t Out_Buf_Size, memory::Ring_Buffer_Mode In_Buf_Mode = memory::Ring_Buffer_Mode::INPUT_BYTES>
+class Pipe_Device final
+{
+  // 禁止拷贝和移动
+  QAQ_NO_COPY_MOVE(Pipe_Device)
+
+public:
+  /// @brief 管道端点类型
+  using End = Pipe_End<In_Buf_Size, Out_Buf_Size, In_Buf_Mode>;
+
+private:
+  /// @brief 端点 A
+  End m_end_a;
+  /// @brief 端点 B
+  End m_end_b;
+
+public:
+  /**
+   * @brief  管道设备 构造函数
+   */
+  explicit Pipe_Device()
+  {
+    m_end_a.m_peer = &m_end_b;
+    m_end_b.m_peer = &m_end_a;
+  }
+
+  /**
+   * @brief  管道设备 析构函数
+   */
+  ~Pipe_Device() {}
+
+  /**
+   * @brief  管道设备 获取端点 A
+   *
+   * @return End& 端点 A
+   */
+  End& end_a(void)
+  {
+    return m_end_a;
+  }
+
+  /**
+   * @brief  管道设备 获取端点 B
+   *
+   * @return End& 端点 B
+   */
+  End& end_b(void)
+  {
+    return m_end_b;
+  }
+};
+} /* namespace device */
+} /* namespace system */
+} /* namespace QAQ */
+
+#endif /* __PIPE_DEVICE_HPP__ */
@@ -0,0 +1,272 @@
+/**
+ * @file   pipe_device_test.cpp
+ * @brief  管道设备 主机测试: 三种输入缓存区模式 (逐字节、单缓冲、双缓冲) 与带/不带输出缓存区的收发一致性、
+ *         对端缓存区满与对端未打开时的丢弃计数，以及各模式的吞吐基准
+ *
+ * @note   仅用于主机，不参与固件编译 (已加入 eide excludeList);
+ *         内核由 host_kernel.hpp 仿真 (设备管理器通道线程为主机线程);
+ *         基准耗时请以不带 sanitizer 的 -O2 构建为准
+ *
+ *         构建 (仓库根目录):
+ *         g++ -std=c++17 -O2 -g -fsanitize=address,undefined -fpermissive -w \
+ *             $(python3 -c "import json;c=json.load(open('.eide/eide.json'))['targets']['Debug']['custom_dep'];print(' '.join(['-I'+p for p in c['incList']]+['-D'+d for d in c['defineList']]))") \
+ *             api/system/device/pipe_device_test.cpp -o pipe_device_test -lpthread && ./pipe_device_test
+ */
+#include "host_kernel.hpp"
+#include "pipe_device.hpp"
+
+#include <chrono>
+#include <cstdio>
+#include <vector>
+
+using namespace QAQ::system::device;
+using QAQ::system::memory::Ring_Buffer_Mode;
+
+/* 主机测试不使用信号，对象析构时断开连接为空操作 */
+namespace QAQ
+{
+namespace system
+{
+namespace system_internal
+{
+namespace signal_internal
+{
+class Null_Signal_Manager final : public Signal_Manager_Base
+{
+};
+
+Null_Signal_Manager  g_null_signal_manager;
+Signal_Manager_Base* __signal_manager_base = &g_null_signal_manager;
+} /* namespace signal_internal */
+} /* namespace system_internal */
+} /* namespace system */
+} /* namespace QAQ */
+
+namespace
+{
+/// @brief 失败的检查数
+int g_failures = 0;
+
+#define CHECK(cond)                                                  \
+  do                                                                 \
+  {                                                                  \
+    if (!(cond))                                                     \
+    {                                                                \
+      ++g_failures;                                                  \
+      printf("%s:%d: CHECK(%s) failed\n", __FILE__, __LINE__, #cond); \
+    }                                                                \
+  } while (0)
+
+/// @brief 逐字节输入，无输出缓存区
+Pipe_Device<256, 0, Ring_Buffer_Mode::INPUT_BYTES>            g_bytes_pipe;
+/// @brief 单缓冲输入，无输出缓存区
+Pipe_Device<256, 0, Ring_Buffer_Mode::INPUT_SINGLE_BUFFER>    g_single_pipe;
+/// @brief 双缓冲输入，无输出缓存区
+Pipe_Device<256, 0, Ring_Buffer_Mode::INPUT_DOUBLE_BUFFER>    g_double_pipe;
+/// @brief 单缓冲输入，带输出缓存区
+Pipe_Device<256, 256, Ring_Buffer_Mode::INPUT_SINGLE_BUFFER>  g_buffered_pipe;
+
+/**
+ * @brief  读取直至收齐或超时
+ *
+ * @tparam End       管道端点类型
+ * @param  end       端点
+ * @param  data      数据缓存区
+ * @param  size      数据大小
+ * @return uint32_t  读取数据大小
+ */
+template <typename End>
+uint32_t read_all(End& end, uint8_t* data, uint32_t size)
+{
+  uint32_t total = 0;
+
+  while (total < size)
+  {
+    const int64_t ret = end.read(data + total, size - total, 100);
+
+    if (ret <= 0)
+    {
+      break;
+    }
+
+    total += static_cast<uint32_t>(ret);
+  }
+
+  return total;
+}
+
+/**
+ * @brief  管道双向收发并校验 (每次写入不超过对端输入缓存区)
+ *
+ * @tparam Pipe     管道类型
+ * @param  pipe     管道
+ * @param  chunk    每次写入大小
+ * @param  total    总数据大小
+ * @return true     收发一致
+ * @return false    数据丢失或错误
+ */
+template <typename Pipe>
+bool round_trip(Pipe& pipe, uint32_t chunk, uint32_t total)
+{
+  std::vector<uint8_t> out(chunk);
+  std::vector<uint8_t> in(chunk);
+  bool                 ret = true;
+
+  for (uint32_t offset = 0; offset < total && ret; offset += chunk)
+  {
+    for (uint32_t i = 0; i < chunk; ++i)
+    {
+      out[i] = static_cast<uint8_t>(offset * 13 + i);
+    }
+
+    // A -> B
+    ret = ret && (static_cast<int64_t>(chunk) == pipe.end_a().write(out.data(), chunk, 100));
+    pipe.end_a().flush(100);
+    ret = ret && (chunk == read_all(pipe.end_b(), in.data(), chunk)) && (out == in);
+
+    // B -> A
+    ret = ret && (static_cast<int64_t>(chunk) == pipe.end_b().write(in.data(), chunk, 100));
+    pipe.end_b().flush(100);
+    ret = ret && (chunk == read_all(pipe.end_a(), out.data(), chunk)) && (out == in);
+  }
+
+  return ret;
+}
+
+/**
+ * @brief  打开管道两端
+ */
+template <typename Pipe>
+bool open_pipe(Pipe& pipe)
+{
+  return (Device_Error_Code::OK == pipe.end_a().open()) && (Device_Error_Code::OK == pipe.end_b().open());
+}
+
+/**
+ * @brief  关闭管道两端
+ */
+template <typename Pipe>
+bool close_pipe(Pipe& pipe)
+{
+  return (Device_Error_Code::OK == pipe.end_a().close()) && (Device_Error_Code::OK == pipe.end_b().close());
+}
+} /* namespace */
+
+/**
+ * @brief  测试: 三种输入模式与带输出缓存区的管道双向收发一致 (含双缓冲半区切换与不足半区的空闲提交)
+ */
+static void test_round_trip(void)
+{
+  CHECK(open_pipe(g_bytes_pipe));
+  CHECK(round_trip(g_bytes_pipe, 1, 64));
+  CHECK(round_trip(g_bytes_pipe, 100, 2000));
+  CHECK(0 == g_bytes_pipe.end_a().overrun_bytes());
+  CHECK(2000 + 64 == g_bytes_pipe.end_a().sent_bytes());
+  CHECK(close_pipe(g_bytes_pipe));
+
+  CHECK(open_pipe(g_single_pipe));
+  CHECK(round_trip(g_single_pipe, 7, 700));
+  CHECK(round_trip(g_single_pipe, 200, 4000));
+  CHECK(close_pipe(g_single_pipe));
+
+  // 双缓冲: 128字节半区，写入跨越半区边界
+  CHECK(open_pipe(g_double_pipe));
+  CHECK(round_trip(g_double_pipe, 5, 500));
+  CHECK(round_trip(g_double_pipe, 128, 1280));
+  CHECK(round_trip(g_double_pipe, 200, 4000));
+  CHECK(close_pipe(g_double_pipe));
+
+  CHECK(open_pipe(g_buffered_pipe));
+  CHECK(round_trip(g_buffered_pipe, 1, 64));
+  CHECK(round_trip(g_buffered_pipe, 200, 4000));
+  CHECK(close_pipe(g_buffered_pipe));
+}
+
+/**
+ * @brief  测试: 对端缓存区满时超出部分丢弃并计数，对端未打开时全部丢弃
+ */
+static void test_overrun(void)
+{
+  uint8_t data[200];
+  uint8_t sink[512];
+
+  memset(data, 0x5A, sizeof(data));
+  CHECK(open_pipe(g_single_pipe));
+
+  // 对端输入缓存区 (容量255) 未读取，第二次写入溢出
+  CHECK(200 == g_single_pipe.end_a().write(data, sizeof(data), 100));
+  CHECK(200 == g_single_pipe.end_a().write(data, sizeof(data), 100));
+  CHECK(255 == g_single_pipe.end_a().sent_bytes());
+  CHECK(145 == g_single_pipe.end_a().overrun_bytes());
+  CHECK(255 == read_all(g_single_pipe.end_b(), sink, 255));
+  CHECK(0 == g_single_pipe.end_b().read(sink, 1, 10));
+
+  // 对端关闭后写入仍完成，数据全部丢弃
+  CHECK(Device_Error_Code::OK == g_single_pipe.end_b().close());
+  CHECK(200 == g_single_pipe.end_a().write(data, sizeof(data), 100));
+  CHECK(255 == g_single_pipe.end_a().sent_bytes());
+  CHECK(345 == g_single_pipe.end_a().overrun_bytes());
+  CHECK(Device_Error_Code::OK == g_single_pipe.end_a().close());
+
+  // 重新打开时计数清零
+  CHECK(open_pipe(g_single_pipe));
+  CHECK(0 == g_single_pipe.end_a().sent_bytes() && 0 == g_single_pipe.end_a().overrun_bytes());
+  CHECK(close_pipe(g_single_pipe));
+}
+
+/**
+ * @brief  基准: 单向吞吐 (写入端写满一块后读取端取出)，各输入模式与带输出缓存区对比
+ */
+template <typename Pipe>
+static double bench_pipe(Pipe& pipe, uint32_t chunk)
+{
+  constexpr uint32_t TOTAL = 4 * 1024 * 1024;
+
+  std::vector<uint8_t> data(chunk, 0xA5);
+  std::vector<uint8_t> sink(chunk);
+  uint32_t             moved = 0;
+
+  CHECK(open_pipe(pipe));
+  const auto start = std::chrono::steady_clock::now();
+
+  while (moved < TOTAL)
+  {
+    pipe.end_a().write(data.data(), chunk, 100);
+    pipe.end_a().flush(100);
+    const uint32_t got = read_all(pipe.end_b(), sink.data(), chunk);
+
+    if (got != chunk)
+    {
+      break;
+    }
+
+    moved += got;
+  }
+
+  const double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+  CHECK(TOTAL <= moved);
+  CHECK(close_pipe(pipe));
+
+  return moved / seconds / (1024 * 1024);
+}
+
+int main(void)
+{
+  test_round_trip();
+  test_overrun();
+
+  printf("%-10s %14s %14s %14s %14s\n", "MB/s", "bytes", "single", "double", "buffered");
+
+  for (uint32_t chunk : { 16u, 64u, 200u })
+  {
+    const double bytes    = bench_pipe(g_bytes_pipe, chunk);
+    const double single   = bench_pipe(g_single_pipe, chunk);
+    const double dual     = bench_pipe(g_double_pipe, chunk);
+    const double buffered = bench_pipe(g_buffered_pipe, chunk);
+    printf("%-10u %14.1f %14.1f %14.1f %14.1f\n", chunk, bytes, single, dual, buffered);
+  }
+
+  printf("pipe_device_test: %s (%d failures)\n", 0 == g_failures ? "OK" : "FAILED", g_failures);
+  fflush(stdout);
+  return 0 == g_failures ? 0 : 1;
+}
@@ -0,0 +1,330 @@
+#ifndef __RAM_FLASH_DEVICE_HPP__
+#define __RAM_FLASH_DEVICE_HPP__
+
+#include "ram_storage_device.hpp"
+#include "mutex.hpp"
+
+/// @brief 名称空间 QAQ
+namespace QAQ
+{
+/// @brief 名称空间 系统
+namespace system
+{
+/// @brief 名称空间 设备
+namespace device
+{
+/**
+ * @brief  内存 Flash 模拟设备 (模拟 NOR Flash 的编程与擦除语义，用于日志储存等上层的主机测试与吞吐评估)
+ *
+ * @tparam Sector_Size   擦除扇区大小
+ * @tparam Sector_Count  扇区数量
+ * @note   编程只能将位由1清0 (写入结果为原内容与数据按位与)，试图将0置1计入违例计数;
+ *         擦除必须按扇区对齐，擦除后内容为 0xFF 并累计每扇区擦除次数;
+ *         power_fail_after() 设定剩余可编程字节数，耗尽时当前编程只完成一部分 (擦除只完成前半扇区)，
+ *         之后所有操作失败直至 power_cycle()，用于验证掉电恢复;
+ *         编程、读取与擦除互斥执行 (日志储存在设备管理器线程中后台擦除，与追加并发访问)
+ */
+template <uint32_t Sector_Size, uint32_t Sector_Count>
+class Ram_Flash_Device final : public system_internal::device_internal::Storage_Device_Base
+{
+  // 扇区大小检查
+  static_assert((0 != Sector_Size) && (0 == (Sector_Size & (Sector_Size - 1))), "Sector_Size must be a power of 2");
+  // 扇区数量检查
+  static_assert(0 != Sector_Count, "Sector_Count must be greater than 0");
+
+  // 禁止拷贝和移动
+  QAQ_NO_COPY_MOVE(Ram_Flash_Device)
+
+public:
+  /// @brief 容量 (字节)
+  static constexpr uint32_t SIZE = Sector_Size * Sector_Count;
+
+private:
+  /// @brief 无掉电注入
+  static constexpr uint32_t NO_FAIL = UINT32_MAX;
+
+  /// @brief 储存空间
+  uint8_t             m_memory[SIZE] QAQ_ALIGN(32);
+  /// @brief 每扇区擦除次数
+  uint32_t            m_erase_count[Sector_Count] = {};
+  /// @brief 操作统计
+  Storage_Op_Stats    m_stats                     = { 0 };
+  /// @brief 编程违例字节数 (试图将0置1)
+  uint32_t            m_program_violations        = 0;
+  /// @brief 掉电前剩余可编程字节数
+  uint32_t            m_fail_budget               = NO_FAIL;
+  /// @brief 掉电状态
+  bool                m_powered_off               = false;
+  /// @brief 操作互斥锁
+  kernel::Mutex<true> m_mutex;
+
+  /**
+   * @brief  内存 Flash 模拟设备 地址范围检查
+   *
+   * @param  address  起始地址
+   * @param  size     大小
+   * @return true     合法
+   * @return false    越界
+   */
+  static constexpr bool in_range(uint32_t address, uint32_t size)
+  {
+    return (address <= SIZE) && (size <= SIZE - address);
+  }
+
+  /**
+   * @brief  内存 Flash 模拟设备 设备管理器事件处理句柄 (无事件)
+   */
+  void manger_handler(uint32_t) override {}
+
+  /**
+   * @brief  内存 Flash 模拟设备 打开 - 元方法覆写
+   *
+   * @return Device_Error_Code 错误码
+   */
+  Device_Error_Code open_impl(void) override
+  {
+    return Device_Error_Code::OK;
+  }
+
+  /**
+   * @brief  内存 Flash 模拟设备 关闭 - 元方法覆写
+   *
+   * @return Device_Error_Code 错误码
+   */
+  Device_Error_Code close_impl(void) override
+  {
+    return Device_Error_Code::OK;
+  }
+
+  /**
+   * @brief  内存 Flash 模拟设备 配置 - 元方法覆写 (无可配置参数)
+   *
+   * @return Device_Error_Code 错误码
+   */
+  Device_Error_Code config_impl(uint32_t, uint32_t) override
+  {
+    return Device_Error_Code::INVALID_PARAMETER;
+  }
+
+  /**
+   * @brief  内存 Flash 模拟设备 获取配置 - 元方法覆写 (无可配置参数)
+   *
+   * @return uint32_t 配置值
+   */
+  uint32_t get_config_impl(uint32_t) const override
+  {
+    return 0;
+  }
+
+public:
+  /**
+   * @brief  内存 Flash 模拟设备 构造函数 (初始内容为擦除状态)
+   */
+  explicit Ram_Flash_Device() : m_mutex("Ram Flash Mutex")
+  {
+    memory::fast_memset(m_memory, 0xFF, SIZE);
+  }
+
+  /**
+   * @brief  内存 Flash 模拟设备 析构函数
+   */
+  ~Ram_Flash_Device() {}
+
+  /**
+   * @brief  内存 Flash 模拟设备 编程数据 (按位与写入)
+   *
+   * @param  address   编程地址
+   * @param  data      数据缓存
+   * @param  size      数据大小
+   * @return int64_t   实际编程数据大小，未打开、越界或掉电返回-1
+   */
+  int64_t write(uint32_t address, const uint8_t* data, uint32_t size) override
+  {
+    kernel::Mutex_Guard<kernel::Mutex<true>> guard(m_mutex);
+    int64_t                                  ret = -1;
+
+    if (m_opened && !m_powered_off && in_range(address, size))
+    {
+      const uint32_t count = std::min(size, m_fail_budget);
+
+      for (uint32_t i = 0; i < count; ++i)
+      {
+        if (0 != (data[i] & ~m_memory[address + i]))
+        {
+          m_program_violations++;
+        }
+
+        m_memory[address + i] &= data[i];
+      }
+
+      m_stats.write_ops++;
+      m_stats.write_bytes += count;
+
+      if (NO_FAIL != m_fail_budget)
+      {
+        m_fail_budget -= count;
+        m_powered_off  = (0 == m_fail_budget);
+      }
+
+      ret = (count == size) ? static_cast<int64_t>(size) : -1;
+    }
+
+    return ret;
+  }
+
+  /**
+   * @brief  内存 Flash 模拟设备 读取数据
+   *
+   * @param  address   读取地址
+   * @param  data      数据缓存
+   * @param  size      数据大小
+   * @return int64_t   实际读取数据大小，未打开、越界或掉电返回-1
+   */
+  int64_t read(uint32_t address, uint8_t* data, uint32_t size) override
+  {
+    kernel::Mutex_Guard<kernel::Mutex<true>> guard(m_mutex);
+    int64_t                                  ret = -1;
+
+    if (m_opened && !m_powered_off && in_range(address, size))
+    {
+      memory::fast_memcpy(data, m_memory + address, size);
+      m_stats.read_ops++;
+      m_stats.read_bytes += size;
+      ret                 = size;
+    }
+
+    return ret;
+  }
+
+  /**
+   * @brief  内存 Flash 模拟设备 擦除扇区
+   *
+   * @param  address   擦除地址 (扇区对齐)
+   * @param  size      擦除大小 (扇区整数倍)
+   * @return int64_t   实际擦除数据大小，未打开、越界、未对齐或掉电返回-1
+   */
+  int64_t erase(uint32_t address, uint32_t size) override
+  {
+    kernel::Mutex_Guard<kernel::Mutex<true>> guard(m_mutex);
+    int64_t                                  ret = -1;
+
+    if (m_opened && !m_powered_off && in_range(address, size) && (0 == (address % Sector_Size)) && (0 == (size % Sector_Size)))
+    {
+      ret = size;
+
+      for (uint32_t sector = address / Sector_Size; sector < (address + size) / Sector_Size; ++sector)
+      {
+        if (NO_FAIL != m_fail_budget)
+        {
+          // 擦除中途掉电: 前半扇区已擦除
+          m_fail_budget = (Sector_Size < m_fail_budget) ? (m_fail_budget - Sector_Size) : 0;
+          m_powered_off = (0 == m_fail_budget);
+        }
+
+        memory::fast_memset(m_memory + sector * Sector_Size, 0xFF, m_powered_off ? (Sector_Size / 2) : Sector_Size);
+        m_erase_count[sector]++;
+
+        if (m_powered_off)
+        {
+          ret = -1;
+          break;
+        }
+      }
+
+      m_stats.erase_ops++;
+      m_stats.erase_bytes += size;
+    }
+
+    return ret;
+  }
+
+  /**
+   * @brief  内存 Flash 模拟设备 设定掉电注入 (擦除按每扇区消耗 Sector_Size 字节计)
+   *
+   * @param  bytes  掉电前剩余可编程字节数
+   */
+  void power_fail_after(uint32_t bytes)
+  {
+    kernel::Mutex_Guard<kernel::Mutex<true>> guard(m_mutex);
+
+    m_fail_budget = bytes;
+    m_powered_off = (0 == bytes);
+  }
+
+  /**
+   * @brief  内存 Flash 模拟设备 重新上电 (保留储存内容，清除掉电注入)
+   */
+  void power_cycle(void)
+  {
+    kernel::Mutex_Guard<kernel::Mutex<true>> guard(m_mutex);
+
+    m_fail_budget = NO_FAIL;
+    m_powered_off = false;
+  }
+
+  /**
+   * @brief  内存 Flash 模拟设备 是否处于掉电状态
+   *
+   * @return true   掉电
+   * @return false  正常
+   */
+  bool powered_off(void) const
+  {
+    return m_powered_off;
+  }
+
+  /**
+   * @brief  内存 Flash 模拟设备 获取扇区擦除次数
+   *
+   * @param  sector    扇区号
+   * @return uint32_t  擦除次数
+   */
+  uint32_t erase_count(uint32_t sector) const
+  {
+    return (sector < Sector_Count) ? m_erase_count[sector] : 0;
+  }
+
+  /**
+   * @brief  内存 Flash 模拟设备 获取编程违例字节数
+   *
+   * @return uint32_t 字节数
+   */
+  uint32_t program_violations(void) const
+  {
+    return m_program_violations;
+  }
+
+  /**
+   * @brief  内存 Flash 模拟设备 获取容量
+   *
+   * @return uint32_t 容量 (字节)
+   */
+  static constexpr uint32_t capacity(void)
+  {
+    return SIZE;
+  }
+
+  /**
+   * @brief  内存 Flash 模拟设备 获取操作统计
+   *
+   * @return Storage_Op_Stats 统计
+   */
+  Storage_Op_Stats stats(void) const
+  {
+    return m_stats;
+  }
+
+  /**
+   * @brief  内存 Flash 模拟设备 清零操作统计
+   */
+  void reset_stats(void)
+  {
+    m_stats              = { 0 };
+    m_program_violations = 0;
+  }
+};
+} /* namespace device */
+} /* namespace system */
+} /* namespace QAQ */
+
+#endif /* __RAM_FLASH_DEVICE_HPP__ */
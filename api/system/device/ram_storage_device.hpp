@@ -0,0 +1,217 @@
+#ifndef __RAM_STORAGE_DEVICE_HPP__
+#define __RAM_STORAGE_DEVICE_HPP__
+
+#include "storage_device_base.hpp"
+#include "fast_memory.hpp"
+
+/// @brief 名称空间 QAQ
+namespace QAQ
+{
+/// @brief 名称空间 系统
+namespace system
+{
+/// @brief 名称空间 设备
+namespace device
+{
+/// @brief 储存设备 操作统计
+struct Storage_Op_Stats
+{
+  uint32_t read_ops;    /* 读操作次数 */
+  uint32_t write_ops;   /* 写操作次数 */
+  uint32_t erase_ops;   /* 擦除操作次数 */
+  uint64_t read_bytes;  /* 读取字节数 */
+  uint64_t write_bytes; /* 写入字节数 */
+  uint64_t erase_bytes; /* 擦除字节数 */
+};
+
+/**
+ * @brief  内存储存设备 (以内存模拟储存介质，统计操作次数，用于验证缓存层与文件系统的访问模式)
+ *
+ * @tparam Size  容量 (字节)
+ * @note   擦除后内容为 0xFF，与 NOR Flash 一致; 写入直接覆盖，不模拟编程位约束
+ */
+template <uint32_t Size>
+class Ram_Storage_Device final : public system_internal::device_internal::Storage_Device_Base
+{
+  // 禁止拷贝和移动
+  QAQ_NO_COPY_MOVE(Ram_Storage_Device)
+
+private:
+  /// @brief 储存空间
+  uint8_t          m_memory[Size] QAQ_ALIGN(32);
+  /// @brief 操作统计
+  Storage_Op_Stats m_stats = { 0 };
+
+  /**
+   * @brief  内存储存设备 地址范围检查
+   *
+   * @param  address  起始地址
+   * @param  size     大小
+   * @return true     合法
+   * @return false    越界
+   */
+  static constexpr bool in_range(uint32_t address, uint32_t size)
+  {
+    return (address <= Size) && (size <= Size - address);
+  }
+
+  /**
+   * @brief  内存储存设备 设备管理器事件处理句柄 (无事件)
+   */
+  void manger_handler(uint32_t) override {}
+
+  /**
+   * @brief  内存储存设备 打开 - 元方法覆写
+   *
+   * @return Device_Error_Code 错误码
+   */
+  Device_Error_Code open_impl(void) override
+  {
+    return Device_Error_Code::OK;
+  }
+
+  /**
+   * @brief  内存储存设备 关闭 - 元方法覆写
+   *
+   * @return Device_Error_Code 错误码
+   */
+  Device_Error_Code close_impl(void) override
+  {
+    return Device_Error_Code::OK;
+  }
+
+  /**
+   * @brief  内存储存设备 配置 - 元方法覆写 (无可配置参数)
+   *
+   * @return Device_Error_Code 错误码
+   */
+  Device_Error_Code config_impl(uint32_t, uint32_t) override
+  {
+    return Device_Error_Code::INVALID_PARAMETER;
+  }
+
+  /**
+   * @brief  内存储存设备 获取配置 - 元方法覆写 (无可配置参数)
+   *
+   * @return uint32_t 配置值
+   */
+  uint32_t get_config_impl(uint32_t) const override
+  {
+    return 0;
+  }
+
+public:
+  /**
+   * @brief  内存储存设备 构造函数 (初始内容为擦除状态)
+   */
+  explicit Ram_Storage_Device()
+  {
+    memory::fast_memset(m_memory, 0xFF, Size);
+  }
+
+  /**
+   * @brief  内存储存设备 析构函数
+   */
+  ~Ram_Storage_Device() {}
+
+  /**
+   * @brief  内存储存设备 写入数据
+   *
+   * @param  address   写入地址
+   * @param  data      数据缓存
+   * @param  size      数据大小
+   * @return int64_t   实际写入数据大小，未打开或越界返回-1
+   */
+  int64_t write(uint32_t address, const uint8_t* data, uint32_t size) override
+  {
+    int64_t ret = -1;
+
+    if (m_opened && in_range(address, size))
+    {
+      memory::fast_memcpy(m_memory + address, data, size);
+      m_stats.write_ops++;
+      m_stats.write_bytes += size;
+      ret                  = size;
+    }
+
+    return ret;
+  }
+
+  /**
+   * @brief  内存储存设备 读取数据
+   *
+   * @param  address   读取地址
+   * @param  data      数据缓存
+   * @param  size      数据大小
+   * @return int64_t   实际读取数据大小，未打开或越界返回-1
+   */
+  int64_t read(uint32_t address, uint8_t* data, uint32_t size) override
+  {
+    int64_t ret = -1;
+
+    if (m_opened && in_range(address, size))
+    {
+      memory::fast_memcpy(data, m_memory + address, size);
+      m_stats.read_ops++;
+      m_stats.read_bytes += size;
+      ret                 = size;
+    }
+
+    return ret;
+  }
+
+  /**
+   * @brief  内存储存设备 擦除数据
+   *
+   * @param  address   擦除地址
+   * @param  size      擦除大小
+   * @return int64_t   实际擦除数据大小，未打开或越界返回-1
+   */
+  int64_t erase(uint32_t address, uint32_t size) override
+  {
+    int64_t ret = -1;
+
+    if (m_opened && in_range(address, size))
+    {
+      memory::fast_memset(m_memory + address, 0xFF, size);
+      m_stats.erase_ops++;
+      m_stats.erase_bytes += size;
+      ret                  = size;
+    }
+
+    return ret;
+  }
+
+  /**
+   * @brief  内存储存设备 获取容量
+   *
+   * @return uint32_t 容量 (字节)
+   */
+  static constexpr uint32_t capacity(void)
+  {
+    return Size;
+  }
+
+  /**
+   * @brief  内存储存设备 获取操作统计
+   *
+   * @return Storage_Op_Stats 统计
+   */
+  Storage_Op_Stats stats(void) const
+  {
+    return m_stats;
+  }
+
+  /**
+   * @brief  内存储存设备 清零操作统计
+   */
+  void reset_stats(void)
+  {
+    m_stats = { 0 };
+  }
+};
+} /* namespace device */
+} /* namespace system */
+} /* namespace QAQ */
+
+#endif /* __RAM_STORAGE_DEVICE_HPP__ */
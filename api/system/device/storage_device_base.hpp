@@ -2,6 +2,7 @@
 #define __STORAGE_DEVICE_BASE_HPP__
 
 #include "device_manger.hpp"
+#include "async_io.hpp"
 
 /// @brief 名称空间 QAQ
 namespace QAQ
@@ -25,6 +26,9 @@ class Storage_Device_Base : public Device_Base
   QAQ_NO_COPY_MOVE(Storage_Device_Base)
 
 protected:
+  /// @brief 异步输入输出
+  Async_Io m_async;
+
   /**
    * @brief  储存设备基类 发送事件
    *
@@ -40,12 +44,47 @@ protected:
   /**
    * @brief  储存设备基类 构造函数
    */
-  explicit Storage_Device_Base() {}
+  explicit Storage_Device_Base()
+  {
+    m_manager_lane = device::Device_Lane::SLOW;
+  }
 
   /**
    * @brief  储存设备基类 析构函数
    */
-  virtual ~Storage_Device_Base() {}
+  virtual ~Storage_Device_Base()
+  {
+    Device_Manager::instance().detach(this);
+  }
+
+  /**
+   * @brief  储存设备基类 异步请求处理 (设备管理器线程中按提交顺序执行同步读写，请求方线程无需等待)
+   */
+  void async_handler(void) override
+  {
+    device::Io_Request* request = nullptr;
+
+    if (!m_opened)
+    {
+      m_async.cancel_all();
+    }
+    else
+    {
+      while (nullptr != (request = m_async.pop()))
+      {
+        if (device::Io_Op::WRITE == request->op)
+        {
+          m_async.complete(*request, write(request->address, static_cast<const uint8_t*>(request->data), request->size));
+        }
+        else
+        {
+          m_async.complete(*request, read(request->address, static_cast<uint8_t*>(request->data), request->size));
+        }
+      }
+    }
+
+    m_async.dispatch();
+  }
 
 public:
   /**
@@ -77,6 +116,77 @@ public:
    */
   virtual int64_t erase(uint32_t address, uint32_t size)                      = 0;
 
+  /**
+   * @brief  储存设备基类 提交异步读请求 (request.address 为读取地址)
+   *
+   * @param  request            异步请求 (完成前需保持有效)
+   * @return Device_Error_Code  错误码
+   */
+  device::Device_Error_Code submit_read(device::Io_Request& request)
+  {
+    device::Device_Error_Code error_code = device::Device_Error_Code::OK;
+
+    if (!m_opened)
+    {
+      error_code = device::Device_Error_Code::NOT_OPENED;
+    }
+    else if (!m_async.submit(request, device::Io_Op::READ))
+    {
+      error_code = device::Device_Error_Code::BUSY;
+    }
+    else
+    {
+      post_event(static_cast<uint32_t>(Device_Event_Bits::Async_Request));
+    }
+
+    return error_code;
+  }
+
+  /**
+   * @brief  储存设备基类 提交异步写请求 (request.address 为写入地址)
+   *
+   * @param  request            异步请求 (完成前需保持有效)
+   * @return Device_Error_Code  错误码
+   */
+  device::Device_Error_Code submit_write(device::Io_Request& request)
+  {
+    device::Device_Error_Code error_code = device::Device_Error_Code::OK;
+
+    if (!m_opened)
+    {
+      error_code = device::Device_Error_Code::NOT_OPENED;
+    }
+    else if (!m_async.submit(request, device::Io_Op::WRITE))
+    {
+      error_code = device::Device_Error_Code::BUSY;
+    }
+    else
+    {
+      post_event(static_cast<uint32_t>(Device_Event_Bits::Async_Request));
+    }
+
+    return error_code;
+  }
+
+  /**
+   * @brief  储存设备基类 取消尚未执行的异步请求
+   *
+   * @param  request  异步请求
+   * @return true     已取消 (完成回调中状态为CANCELLED)
+   * @return false    请求已执行或已结束
+   */
+  bool cancel(device::Io_Request& request)
+  {
+    bool ret = m_async.cancel(request);
+
+    if (ret)
+    {
+      post_event(static_cast<uint32_t>(Device_Event_Bits::Async_Request));
+    }
+
+    return ret;
+  }
+
   /**
    * @brief  储存设备基类 获取设备类型
    *
@@ -2,6 +2,7 @@
 #define __STREAM_DEVICE_BASE_HPP__
 
 #include "device_manger.hpp"
+#include "async_io.hpp"
 
 /// @brief 名称空间 QAQ
 namespace QAQ
@@ -25,6 +26,9 @@ class InDevice_Base : public Device_Base, public Input_Base
   QAQ_NO_COPY_MOVE(InDevice_Base)
 
 protected:
+  /// @brief 异步输入输出
+  Async_Io m_async;
+
   /**
    * @brief  输入设备基类 发送事件
    *
@@ -45,7 +49,10 @@ protected:
   /**
    * @brief  输入设备基类 析构函数
    */
-  virtual ~InDevice_Base() {}
+  virtual ~InDevice_Base()
+  {
+    Device_Manager::instance().detach(this);
+  }
 
 public:
   /**
@@ -170,6 +177,51 @@ public:
   {
     return device::Stream_Type::READ_ONLY;
   }
+
+  /**
+   * @brief  输入设备基类 提交异步读请求
+   *
+   * @param  request            异步请求 (完成前需保持有效)
+   * @return Device_Error_Code  错误码
+   */
+  device::Device_Error_Code submit_read(device::Io_Request& request)
+  {
+    device::Device_Error_Code error_code = device::Device_Error_Code::OK;
+
+    if (!m_opened)
+    {
+      error_code = device::Device_Error_Code::NOT_OPENED;
+    }
+    else if (!m_async.submit_read(request))
+    {
+      error_code = device::Device_Error_Code::BUSY;
+    }
+    else
+    {
+      post_event(static_cast<uint32_t>(Device_Event_Bits::Async_Request));
+    }
+
+    return error_code;
+  }
+
+  /**
+   * @brief  输入设备基类 取消尚未开始传输的异步请求
+   *
+   * @param  request  异步请求
+   * @return true     已取消 (完成回调中状态为CANCELLED)
+   * @return false    请求已开始传输或已结束
+   */
+  bool cancel(device::Io_Request& request)
+  {
+    bool ret = m_async.cancel(request);
+
+    if (ret)
+    {
+      post_event(static_cast<uint32_t>(Device_Event_Bits::Async_Request));
+    }
+
+    return ret;
+  }
 };
 
 /**
@@ -182,6 +234,9 @@ class OutDevice_Base : public Device_Base, public Output_Base
   QAQ_NO_COPY_MOVE(OutDevice_Base)
 
 protected:
+  /// @brief 异步输入输出
+  Async_Io m_async;
+
   /**
    * @brief  输出设备基类 发送事件
    *
@@ -202,7 +257,10 @@ protected:
   /**
    * @brief  输出设备基类 析构函数
    */
-  virtual ~OutDevice_Base() {}
+  virtual ~OutDevice_Base()
+  {
+    Device_Manager::instance().detach(this);
+  }
 
 public:
   /**
@@ -244,6 +302,52 @@ public:
   {
     return device::Stream_Type::WRITE_ONLY;
   }
+
+  /**
+   * @brief  输出设备基类 提交异步写请求
+   *
+   * @param  request            异步请求 (完成前需保持有效)
+   * @return Device_Error_Code  错误码
+   * @note   同一设备不应混用同步写入与异步写入
+   */
+  device::Device_Error_Code submit_write(device::Io_Request& request)
+  {
+    device::Device_Error_Code error_code = device::Device_Error_Code::OK;
+
+    if (!m_opened)
+    {
+      error_code = device::Device_Error_Code::NOT_OPENED;
+    }
+    else if (!m_async.submit_write(request))
+    {
+      error_code = device::Device_Error_Code::BUSY;
+    }
+    else
+    {
+      post_event(static_cast<uint32_t>(Device_Event_Bits::Async_Request));
+    }
+
+    return error_code;
+  }
+
+  /**
+   * @brief  输出设备基类 取消尚未开始传输的异步请求
+   *
+   * @param  request  异步请求
+   * @return true     已取消 (完成回调中状态为CANCELLED)
+   * @return false    请求已开始传输或已结束
+   */
+  bool cancel(device::Io_Request& request)
+  {
+    bool ret = m_async.cancel(request);
+
+    if (ret)
+    {
+      post_event(static_cast<uint32_t>(Device_Event_Bits::Async_Request));
+    }
+
+    return ret;
+  }
 };
 
 /**
@@ -256,6 +360,9 @@ class IODevice_Base : public Device_Base, public Input_Base, public Output_Base
   QAQ_NO_COPY_MOVE(IODevice_Base)
 
 protected:
+  /// @brief 异步输入输出
+  Async_Io m_async;
+
   /**
    * @brief  输入输出设备基类 发送事件
    *
@@ -276,7 +383,10 @@ protected:
   /**
    * @brief  输入输出设备基类 析构函数
    */
-  virtual ~IODevice_Base() {}
+  virtual ~IODevice_Base()
+  {
+    Device_Manager::instance().detach(this);
+  }
 
 public:
   /**
@@ -401,6 +511,78 @@ public:
   {
     return device::Stream_Type::READ_WRITE;
   }
+
+  /**
+   * @brief  输入输出设备基类 提交异步读请求
+   *
+   * @param  request            异步请求 (完成前需保持有效)
+   * @return Device_Error_Code  错误码
+   */
+  device::Device_Error_Code submit_read(device::Io_Request& request)
+  {
+    device::Device_Error_Code error_code = device::Device_Error_Code::OK;
+
+    if (!m_opened)
+    {
+      error_code = device::Device_Error_Code::NOT_OPENED;
+    }
+    else if (!m_async.submit_read(request))
+    {
+      error_code = device::Device_Error_Code::BUSY;
+    }
+    else
+    {
+      post_event(static_cast<uint32_t>(Device_Event_Bits::Async_Request));
+    }
+
+    return error_code;
+  }
+
+  /**
+   * @brief  输入输出设备基类 提交异步写请求
+   *
+   * @param  request            异步请求 (完成前需保持有效)
+   * @return Device_Error_Code  错误码
+   * @note   同一设备不应混用同步写入与异步写入
+   */
+  device::Device_Error_Code submit_write(device::Io_Request& request)
+  {
+    device::Device_Error_Code error_code = device::Device_Error_Code::OK;
+
+    if (!m_opened)
+    {
+      error_code = device::Device_Error_Code::NOT_OPENED;
+    }
+    else if (!m_async.submit_write(request))
+    {
+      error_code = device::Device_Error_Code::BUSY;
+    }
+    else
+    {
+      post_event(static_cast<uint32_t>(Device_Event_Bits::Async_Request));
+    }
+
+    return error_code;
+  }
+
+  /**
+   * @brief  输入输出设备基类 取消尚未开始传输的异步请求
+   *
+   * @param  request  异步请求
+   * @return true     已取消 (完成回调中状态为CANCELLED)
+   * @return false    请求已开始传输或已结束
+   */
+  bool cancel(device::Io_Request& request)
+  {
+    bool ret = m_async.cancel(request);
+
+    if (ret)
+    {
+      post_event(static_cast<uint32_t>(Device_Event_Bits::Async_Request));
+    }
+
+    return ret;
+  }
 };
 } /* namespace device_internal */
 } /* namespace system_internal */
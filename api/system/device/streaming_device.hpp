@@ -13,6 +13,15 @@ namespace system
 /// @brief 名称空间 设备
 namespace device
 {
+/// @brief 流设备 长度字段帧格式
+struct Frame_Length_Spec
+{
+  uint16_t offset;     /* 长度字段偏移 */
+  uint8_t  size;       /* 长度字段字节数 (1~4) */
+  bool     big_endian; /* 长度字段是否为大端 */
+  int32_t  adjust;     /* 长度调整值: 帧总长度 = 长度字段结束偏移 + 字段值 + 调整值 */
+};
+
 /**
  * @brief  流设备模版类
  *
@@ -46,6 +55,114 @@ private:
   /// @brief 设备事件标志位
   using Bits = system_internal::device_internal::Device_Event_Bits;
 
+  /// @brief 等待读取的数据大小 (输入数据达到该大小时通知读取者)
+  volatile uint32_t m_wait_size  = 1;
+  /// @brief 等待读取的分隔符 (小于0时不按分隔符等待)
+  volatile int32_t  m_wait_delim = -1;
+  /// @brief 分隔符已扫描偏移
+  volatile uint32_t m_wait_scan  = 0;
+
+  /**
+   * @brief  流设备 输入数据是否满足读取者的等待条件 (输入完成时调用)
+   *
+   * @return true   满足，通知读取者
+   * @return false  不满足
+   */
+  bool input_ready(void)
+  {
+    const uint32_t available = m_input_buffer.available();
+    bool           ret       = (available >= m_wait_size);
+
+    if (!ret && m_wait_delim >= 0)
+    {
+      ret         = (UINT32_MAX != m_input_buffer.find(static_cast<uint8_t>(m_wait_delim), m_wait_scan));
+      m_wait_scan = available;
+    }
+
+    return ret;
+  }
+
+  /**
+   * @brief  流设备 输入通知 (满足读取者的等待条件时通知读取者，有异步读请求时通知设备管理器)
+   */
+  void input_notify(void)
+  {
+    if (input_ready())
+    {
+      m_event_flags.set(static_cast<uint32_t>(Bits::Receive_Finish));
+    }
+
+    if (m_async.has_reads())
+    {
+      post_event(static_cast<uint32_t>(Bits::Async_Request));
+    }
+  }
+
+  /**
+   * @brief  流设备 设置等待条件并等待输入
+   *
+   * @param  size        等待的数据大小
+   * @param  delim       等待的分隔符 (小于0时不按分隔符等待)
+   * @param  scan        分隔符已扫描偏移
+   * @param  timeout_ms  超时时间 - 毫秒
+   * @return true        条件可能已满足，需重新检查
+   * @return false       超时 (超时时间为0时不等待) 或设备关闭
+   */
+  bool wait_input(uint32_t size, int32_t delim, uint32_t scan, uint32_t timeout_ms)
+  {
+    bool ret = false;
+
+    // 不等待时无需发布等待条件
+    if (TX_NO_WAIT != timeout_ms)
+    {
+      ret          = true;
+      m_wait_scan  = scan;
+      m_wait_delim = delim;
+      m_wait_size  = size;
+
+      // 先清除标志再复查，生产者在此之后的通知不会丢失
+      m_event_flags.clear(static_cast<uint32_t>(Bits::Receive_Finish));
+
+      if (!input_ready())
+      {
+        uint32_t event_bits = m_event_flags.wait((static_cast<uint32_t>(Bits::Receive_Finish) | static_cast<uint32_t>(Bits::Close)), timeout_ms);
+        if ((0 == event_bits) || (event_bits & static_cast<uint32_t>(Bits::Close)))
+        {
+          ret = false;
+        }
+      }
+    }
+
+    return ret;
+  }
+
+  /**
+   * @brief  流设备 恢复默认等待条件并取出一帧数据
+   *
+   * @param  data      数据缓存区指针
+   * @param  size      帧大小 (为0时仅恢复等待条件)
+   * @return uint32_t  读取数据大小
+   */
+  uint32_t take_frame(void* data, uint32_t size)
+  {
+    uint32_t ret = 0;
+
+    m_wait_delim = -1;
+    m_wait_size  = 1;
+
+    if (0 != size)
+    {
+      ret = m_input_buffer.read(static_cast<uint8_t*>(data), size);
+    }
+
+    if (m_input_buffer.empty())
+    {
+      m_event_flags.clear(static_cast<uint32_t>(Bits::Receive_Finish));
+    }
+
+    return ret;
+  }
+
 protected:
   /// @brief 输入缓存区
   memory::Ring_Buffer<uint8_t, In_Buf_Size, In_Buf_Mode> m_input_buffer;
@@ -70,7 +187,7 @@ protected:
   template <bool enable = (memory::Ring_Buffer_Mode::INPUT_BYTES == In_Buf_Mode), typename = std::enable_if_t<enable>>
   void input_complete(void)
   {
-    m_event_flags.set(static_cast<uint32_t>(Bits::Receive_Finish));
+    input_notify();
   }
 
   /**
@@ -98,7 +215,7 @@ protected:
     m_input_buffer.input_complete(size);
     if (size)
     {
-      m_event_flags.set(static_cast<uint32_t>(Bits::Receive_Finish));
+      input_notify();
     }
   }
 
@@ -125,7 +242,7 @@ protected:
   void memory_switch(void)
   {
     m_input_buffer.switch_buffer();
-    m_event_flags.set(static_cast<uint32_t>(Bits::Receive_Finish));
+    input_notify();
   }
 
   /**
@@ -138,6 +255,28 @@ protected:
    */
   virtual ~Stream_Device() {}
 
+  /**
+   * @brief  流设备 异步请求处理 (设备管理器线程中执行)
+   */
+  void async_handler(void) override
+  {
+    if (!m_opened)
+    {
+      m_async.cancel_all();
+    }
+    else
+    {
+      m_async.fill_reads(m_input_buffer);
+
+      if (m_input_buffer.empty())
+      {
+        m_event_flags.clear(static_cast<uint32_t>(Bits::Receive_Finish));
+      }
+    }
+
+    m_async.dispatch();
+  }
+
 public:
   /**
    * @brief  流设备 获取输入缓存区大小
@@ -169,8 +308,21 @@ public:
    */
   int64_t read(void* data, uint32_t size, uint32_t timeout_ms = TX_WAIT_FOREVER) override
   {
-    int64_t  ret      = 0;
-    uint8_t* data_ptr = reinterpret_cast<uint8_t*>(data);
+    Io_Mut_Vec vec = { data, size };
+    return Stream_Device::readv(&vec, 1, timeout_ms);
+  }
+
+  /**
+   * @brief  流设备 分散读取数据 (按顺序填满各段)
+   *
+   * @param  vec                输入向量数组
+   * @param  count              输入向量数量
+   * @param  timeout_ms         超时时间 - 毫秒
+   * @return int64_t            读取数据大小
+   */
+  int64_t readv(const Io_Mut_Vec* vec, uint32_t count, uint32_t timeout_ms = TX_WAIT_FOREVER) override
+  {
+    int64_t ret = 0;
 
     if (!m_opened)
     {
@@ -180,8 +332,17 @@ public:
     {
       uint32_t read_bytes = 0;
       uint32_t event_bits = 0;
-      while (read_bytes < size && m_opened)
+      uint32_t index      = 0;
+      uint32_t offset     = 0;
+      while (index < count && m_opened)
       {
+        if (offset >= vec[index].size)
+        {
+          ++index;
+          offset = 0;
+          continue;
+        }
+
         if (m_input_buffer.empty())
         {
           event_bits = m_event_flags.wait((static_cast<uint32_t>(Bits::Receive_Finish) | static_cast<uint32_t>(Bits::Close)), timeout_ms);
@@ -191,7 +352,9 @@ public:
           }
         }
 
-        read_bytes += m_input_buffer.read(data_ptr + read_bytes, std::min(size - read_bytes, m_input_buffer.available()));
+        uint32_t bytes  = m_input_buffer.read(static_cast<uint8_t*>(vec[index].data) + offset, std::min(vec[index].size - offset, m_input_buffer.available()));
+        offset         += bytes;
+        read_bytes     += bytes;
 
         if (m_input_buffer.empty())
         {
@@ -310,7 +473,7 @@ public:
           }
         }
 
-        peek_bytes += m_input_buffer.peek(data_ptr + peek_bytes, std::min(request - peek_bytes, m_input_buffer.available()));
+        peek_bytes += m_input_buffer.peek(data_ptr + peek_bytes, request - peek_bytes, peek_bytes);
       }
       ret = peek_bytes;
     }
@@ -328,6 +491,159 @@ public:
       m_input_buffer.roll_back();
     }
   }
+
+  /**
+   * @brief  流设备 在输入缓存区中原地查找分隔符 (不拷贝数据)
+   *
+   * @param  delim              分隔符
+   * @param  offset             起始偏移
+   * @return uint32_t           相对读取位置的偏移，未找到返回UINT32_MAX
+   */
+  uint32_t find(uint8_t delim, uint32_t offset = 0) const
+  {
+    uint32_t ret = UINT32_MAX;
+
+    if (m_opened)
+    {
+      ret = m_input_buffer.find(delim, offset);
+    }
+
+    return ret;
+  }
+
+  /**
+   * @brief  流设备 读取数据直到分隔符 (包含分隔符)
+   *
+   * @param  delim              分隔符
+   * @param  data               数据缓存区指针
+   * @param  max                数据缓存区大小
+   * @param  timeout_ms         超时时间 - 毫秒
+   * @return int64_t            读取数据大小，超时返回0
+   * @note   分隔符出现或已有max字节 (输入缓存区已满) 时返回，未找到分隔符时返回的数据不以分隔符结尾;
+   *         等待期间仅在新数据中出现分隔符时唤醒
+   */
+  int64_t read_until(uint8_t delim, void* data, uint32_t max, uint32_t timeout_ms = TX_WAIT_FOREVER)
+  {
+    int64_t ret = 0;
+
+    if (!m_opened)
+    {
+      ret = -1;
+    }
+    else if (0 != max)
+    {
+      const uint32_t limit = std::min<uint32_t>(max, In_Buf_Size - 1);
+      uint32_t       scan  = 0;
+      uint32_t       size  = 0;
+
+      while (m_opened)
+      {
+        const uint32_t available = m_input_buffer.available();
+        const uint32_t position  = m_input_buffer.find(delim, scan);
+
+        if (UINT32_MAX != position)
+        {
+          size = std::min<uint32_t>(position + 1, limit);
+          break;
+        }
+        else if (available >= limit)
+        {
+          size = limit;
+          break;
+        }
+
+        scan = available;
+
+        if (!wait_input(limit, delim, scan, timeout_ms))
+        {
+          break;
+        }
+      }
+
+      ret = take_frame(data, size);
+    }
+
+    return ret;
+  }
+
+  /**
+   * @brief  流设备 读取长度字段帧
+   *
+   * @param  spec               长度字段帧格式
+   * @param  data               数据缓存区指针
+   * @param  max                数据缓存区大小
+   * @param  timeout_ms         超时时间 - 毫秒
+   * @return int64_t            帧大小，超时返回0，设备未打开或帧长度非法 (超出max或输入缓存区) 返回-1
+   * @note   帧长度非法时数据保留在输入缓存区，由调用方清空后重新同步;
+   *         等待期间仅在帧头或整帧到齐时唤醒
+   */
+  int64_t read_frame(const Frame_Length_Spec& spec, void* data, uint32_t max, uint32_t timeout_ms = TX_WAIT_FOREVER)
+  {
+    int64_t ret = 0;
+
+    if (!m_opened || 0 == spec.size || spec.size > 4)
+    {
+      ret = -1;
+    }
+    else
+    {
+      const uint32_t header = spec.offset + spec.size;
+      uint32_t       need   = header;
+      uint32_t       size   = 0;
+      bool           parsed = false;
+
+      while (m_opened)
+      {
+        const uint32_t available = m_input_buffer.available();
+
+        if (!parsed && available >= header)
+        {
+          uint8_t  field[4] = { 0 };
+          uint32_t value    = 0;
+
+          m_input_buffer.peek(field, spec.size, spec.offset);
+
+          for (uint32_t i = 0; i < spec.size; ++i)
+          {
+            value |= static_cast<uint32_t>(field[i]) << (8 * (spec.big_endian ? (spec.size - 1 - i) : i));
+          }
+
+          const int64_t frame = static_cast<int64_t>(header) + value + spec.adjust;
+
+          if (frame < header || frame > max || frame > In_Buf_Size - 1)
+          {
+            ret = -1;
+            break;
+          }
+
+          need   = static_cast<uint32_t>(frame);
+          parsed = true;
+        }
+
+        if (parsed && available >= need)
+        {
+          size = need;
+          break;
+        }
+
+        if (!wait_input(need, -1, 0, timeout_ms))
+        {
+          break;
+        }
+      }
+
+      if (0 == ret)
+      {
+        ret = take_frame(data, size);
+      }
+      else
+      {
+        take_frame(data, 0);
+      }
+    }
+
+    return ret;
+  }
 };
 
 /**
@@ -349,6 +665,9 @@ private:
   /// @brief 设备事件标志位
   using Bits = system_internal::device_internal::Device_Event_Bits;
 
+  /// @brief 写入者互斥锁 (多个写入者时整个写入独占发送通道)
+  kernel::Mutex<true> m_write_mutex;
+
 protected:
   /**
    * @brief  流设备 设备数据发送元方法 - 纯虚函数
@@ -359,6 +678,62 @@ protected:
    */
   virtual uint32_t send_impl(const uint8_t* data, uint32_t size) = 0;
 
+  /**
+   * @brief  流设备 设备聚集发送元方法 (默认逐段调用 send_impl 并等待各段发送完成，派生类可合并为一次发送)
+   *
+   * @param  vec        输出向量数组
+   * @param  count      输出向量数量
+   * @param  timeout_ms 段间等待超时时间 - 毫秒
+   * @return uint32_t   实际发送数据大小 (最后一段的发送完成由调用方等待)
+   */
+  virtual uint32_t sendv_impl(const Io_Vec* vec, uint32_t count, uint32_t timeout_ms)
+  {
+    uint32_t sent    = 0;
+    bool     pending = false;
+
+    for (uint32_t i = 0; i < count && m_opened; ++i)
+    {
+      if (0 == vec[i].size)
+      {
+        continue;
+      }
+
+      if (pending)
+      {
+        uint32_t event_bits = m_event_flags.wait((static_cast<uint32_t>(Bits::Transmit_Finish) | static_cast<uint32_t>(Bits::Close)), timeout_ms);
+        if (!(event_bits & static_cast<uint32_t>(Bits::Transmit_Finish)))
+        {
+          break;
+        }
+
+        m_event_flags.set(static_cast<uint32_t>(Bits::Enable_Transfer));
+        m_event_flags.clear(static_cast<uint32_t>(Bits::Transmit_Finish));
+        pending = false;
+      }
+
+      uint32_t bytes = send_impl(static_cast<const uint8_t*>(vec[i].data), vec[i].size);
+      if (0 == bytes)
+      {
+        break;
+      }
+
+      sent    += bytes;
+      pending  = true;
+
+      if (bytes < vec[i].size)
+      {
+        break;
+      }
+    }
+
+    if (0 != sent && !pending)
+    {
+      output_complete();
+    }
+
+    return sent;
+  }
+
   /**
    * @brief  流设备 输出完成
    */
@@ -366,6 +741,11 @@ protected:
   {
     m_event_flags.clear(static_cast<uint32_t>(Bits::Enable_Transfer));
     m_event_flags.set(static_cast<uint32_t>(Bits::Transmit_Finish));
+
+    if (m_async.has_writes())
+    {
+      post_event(static_cast<uint32_t>(Bits::Async_Request));
+    }
   }
 
   /**
@@ -378,6 +758,48 @@ protected:
    */
   virtual ~Stream_Device() {}
 
+  /**
+   * @brief  流设备 异步请求处理 (设备管理器线程中执行)
+   */
+  void async_handler(void) override
+  {
+    if (!m_opened)
+    {
+      m_async.cancel_all();
+    }
+    else
+    {
+      Io_Request* request = nullptr;
+
+      // 发送通道空闲时结束上一个写请求并启动下一个
+      while (!m_event_flags.wait(static_cast<uint32_t>(Bits::Enable_Transfer), 0))
+      {
+        m_async.finish_write(true);
+
+        if (nullptr == (request = m_async.start_write()))
+        {
+          break;
+        }
+
+        if (0 != request->size)
+        {
+          m_event_flags.set(static_cast<uint32_t>(Bits::Enable_Transfer));
+          m_event_flags.clear(static_cast<uint32_t>(Bits::Transmit_Finish));
+
+          request->done = send_impl(static_cast<const uint8_t*>(request->data), request->size);
+
+          if (0 == request->done)
+          {
+            m_event_flags.clear(static_cast<uint32_t>(Bits::Enable_Transfer));
+            m_async.finish_write(false);
+          }
+        }
+      }
+    }
+
+    m_async.dispatch();
+  }
+
 public:
   /**
    * @brief  流设备 获取输入缓存区大小
@@ -409,18 +831,37 @@ public:
    */
   int64_t write(const void* data, uint32_t size, uint32_t timeout_ms = 0) override
   {
-    int64_t        ret           = 0;
-    uint32_t       event_bits    = 0;
-    bool           need_transfer = false;
-    const uint8_t* data_ptr      = reinterpret_cast<const uint8_t*>(data);
+    Io_Vec vec = { data, size };
+    return Stream_Device::writev(&vec, 1, timeout_ms);
+  }
+
+  /**
+   * @brief  流设备 聚集写入数据 (一次占用发送通道，各段之间不会插入其他写入者的数据)
+   *
+   * @param  vec                输出向量数组
+   * @param  count              输出向量数量
+   * @param  timeout_ms         超时时间 - 毫秒
+   * @return int64_t            写入数据大小
+   */
+  int64_t writev(const Io_Vec* vec, uint32_t count, uint32_t timeout_ms = 0) override
+  {
+    int64_t  ret           = 0;
+    uint32_t event_bits    = 0;
+    bool     need_transfer = false;
 
     if (!m_opened)
     {
       ret = -1;
     }
-    else if (0 != size)
+    else if (0 != io_vec_size(vec, count))
     {
-      if (m_event_flags.wait(static_cast<uint32_t>(Bits::Enable_Transfer), 0))
+      system_internal::device_internal::Device_Write_Lock lock(m_write_mutex, timeout_ms);
+
+      if (!lock.owns())
+      {
+        ret = 0;
+      }
+      else if (m_event_flags.wait(static_cast<uint32_t>(Bits::Enable_Transfer), 0))
       {
         event_bits = m_event_flags.wait((static_cast<uint32_t>(Bits::Transmit_Finish) | static_cast<uint32_t>(Bits::Close)), timeout_ms);
         if (static_cast<uint32_t>(Bits::Transmit_Finish) & event_bits)
@@ -438,7 +879,7 @@ public:
         m_event_flags.set(static_cast<uint32_t>(Bits::Enable_Transfer));
         m_event_flags.clear(static_cast<uint32_t>(Bits::Transmit_Finish));
 
-        ret = send_impl(data_ptr, size);
+        ret = (1 == count) ? send_impl(static_cast<const uint8_t*>(vec[0].data), vec[0].size) : sendv_impl(vec, count, timeout_ms);
 
         if (ret > 0)
         {
@@ -471,7 +912,13 @@ public:
     }
     else
     {
-      if (m_event_flags.wait(static_cast<uint32_t>(Bits::Enable_Transfer), 0))
+      system_internal::device_internal::Device_Write_Lock lock(m_write_mutex, timeout_ms);
+
+      if (!lock.owns())
+      {
+        error_code = Device_Error_Code::TIMEOUT;
+      }
+      else if (m_event_flags.wait(static_cast<uint32_t>(Bits::Enable_Transfer), 0))
       {
         event_bits = m_event_flags.wait((static_cast<uint32_t>(Bits::Transmit_Finish) | static_cast<uint32_t>(Bits::Close)), timeout_ms);
 
@@ -528,14 +975,30 @@ protected:
   virtual uint32_t send_impl(const uint8_t* data, uint32_t size) = 0;
 
   /**
-   * @brief  流设备 获取输出缓存区指针
+   * @brief  流设备 设备聚集发送元方法 (输出缓存区模式下写入经由缓存区合并，不调用本方法)
    *
-   * @param  size     输出的数据大小 - 引用返回
-   * @return uint8_t* 数据缓存区指针
+   * @param  vec        输出向量数组
+   * @param  count      输出向量数量
+   * @param  timeout_ms 超时时间 - 毫秒
+   * @return uint32_t   实际发送数据大小
    */
-  uint8_t* output_start(uint32_t& size)
+  virtual uint32_t sendv_impl(const Io_Vec* vec, uint32_t count, uint32_t timeout_ms)
   {
-    return m_output_buffer.output_start(size);
+    (void)vec;
+    (void)count;
+    (void)timeout_ms;
+    return 0;
+  }
+
+  /**
+   * @brief  流设备 获取输出缓存区指针
+   *
+   * @param  size     输出的数据大小 - 引用返回
+   * @return uint8_t* 数据缓存区指针
+   */
+  uint8_t* output_start(uint32_t& size)
+  {
+    return m_output_buffer.output_start(size);
   }
 
   /**
@@ -545,6 +1008,11 @@ protected:
   {
     m_output_buffer.output_complete();
     m_event_flags.set(static_cast<uint32_t>(Bits::Transmit_Finish));
+
+    if (m_async.has_writes())
+    {
+      post_event(static_cast<uint32_t>(Bits::Async_Request));
+    }
   }
 
   /**
@@ -557,6 +1025,26 @@ protected:
    */
   virtual ~Stream_Device() {}
 
+  /**
+   * @brief  流设备 异步请求处理 (设备管理器线程中执行)
+   */
+  void async_handler(void) override
+  {
+    if (!m_opened)
+    {
+      m_async.cancel_all();
+    }
+    else
+    {
+      if (0 != m_async.drain_writes(m_output_buffer))
+      {
+        post_event(static_cast<uint32_t>(Bits::Enable_Transfer));
+      }
+    }
+
+    m_async.dispatch();
+  }
+
 public:
   /**
    * @brief  流设备 获取输入缓存区大小
@@ -588,19 +1076,41 @@ public:
    */
   int64_t write(const void* data, uint32_t size, uint32_t timeout_ms = 0) override
   {
-    int64_t        ret      = 0;
-    const uint8_t* data_ptr = reinterpret_cast<const uint8_t*>(data);
+    Io_Vec vec = { data, size };
+    return Stream_Device::writev(&vec, 1, timeout_ms);
+  }
+
+  /**
+   * @brief  流设备 聚集写入数据 (各段依次写入输出缓存区)
+   *
+   * @param  vec                输出向量数组
+   * @param  count              输出向量数量
+   * @param  timeout_ms         超时时间 - 毫秒
+   * @return int64_t            写入数据大小
+   */
+  int64_t writev(const Io_Vec* vec, uint32_t count, uint32_t timeout_ms = 0) override
+  {
+    int64_t ret = 0;
 
     if (!m_opened)
     {
       ret = -1;
     }
-    else if (0 != size)
+    else
     {
       uint32_t write_bytes = 0;
       uint32_t event_bits  = 0;
-      while (write_bytes < size && m_opened)
+      uint32_t index       = 0;
+      uint32_t offset      = 0;
+      while (index < count && m_opened)
       {
+        if (offset >= vec[index].size)
+        {
+          ++index;
+          offset = 0;
+          continue;
+        }
+
         if (m_output_buffer.full())
         {
           event_bits = m_event_flags.wait((static_cast<uint32_t>(Bits::Transmit_Finish) | static_cast<uint32_t>(Bits::Close)), timeout_ms);
@@ -612,7 +1122,9 @@ public:
 
         if (m_opened)
         {
-          write_bytes += m_output_buffer.write(data_ptr + write_bytes, std::min(size - write_bytes, m_output_buffer.space()));
+          uint32_t bytes  = m_output_buffer.write(static_cast<const uint8_t*>(vec[index].data) + offset, std::min(vec[index].size - offset, m_output_buffer.space()));
+          offset         += bytes;
+          write_bytes    += bytes;
 
           if (m_output_buffer.full())
           {
@@ -687,6 +1199,117 @@ private:
   /// @brief 设备事件标志位
   using Bits = system_internal::device_internal::Device_Event_Bits;
 
+  /// @brief 写入者互斥锁 (多个写入者时整个写入独占发送通道)
+  kernel::Mutex<true> m_write_mutex;
+
+  /// @brief 等待读取的数据大小 (输入数据达到该大小时通知读取者)
+  volatile uint32_t m_wait_size  = 1;
+  /// @brief 等待读取的分隔符 (小于0时不按分隔符等待)
+  volatile int32_t  m_wait_delim = -1;
+  /// @brief 分隔符已扫描偏移
+  volatile uint32_t m_wait_scan  = 0;
+
+  /**
+   * @brief  流设备 输入数据是否满足读取者的等待条件 (输入完成时调用)
+   *
+   * @return true   满足，通知读取者
+   * @return false  不满足
+   */
+  bool input_ready(void)
+  {
+    const uint32_t available = m_input_buffer.available();
+    bool           ret       = (available >= m_wait_size);
+
+    if (!ret && m_wait_delim >= 0)
+    {
+      ret         = (UINT32_MAX != m_input_buffer.find(static_cast<uint8_t>(m_wait_delim), m_wait_scan));
+      m_wait_scan = available;
+    }
+
+    return ret;
+  }
+
+  /**
+   * @brief  流设备 输入通知 (满足读取者的等待条件时通知读取者，有异步读请求时通知设备管理器)
+   */
+  void input_notify(void)
+  {
+    if (input_ready())
+    {
+      m_event_flags.set(static_cast<uint32_t>(Bits::Receive_Finish));
+    }
+
+    if (m_async.has_reads())
+    {
+      post_event(static_cast<uint32_t>(Bits::Async_Request));
+    }
+  }
+
+  /**
+   * @brief  流设备 设置等待条件并等待输入
+   *
+   * @param  size        等待的数据大小
+   * @param  delim       等待的分隔符 (小于0时不按分隔符等待)
+   * @param  scan        分隔符已扫描偏移
+   * @param  timeout_ms  超时时间 - 毫秒
+   * @return true        条件可能已满足，需重新检查
+   * @return false       超时 (超时时间为0时不等待) 或设备关闭
+   */
+  bool wait_input(uint32_t size, int32_t delim, uint32_t scan, uint32_t timeout_ms)
+  {
+    bool ret = false;
+
+    // 不等待时无需发布等待条件
+    if (TX_NO_WAIT != timeout_ms)
+    {
+      ret          = true;
+      m_wait_scan  = scan;
+      m_wait_delim = delim;
+      m_wait_size  = size;
+
+      // 先清除标志再复查，生产者在此之后的通知不会丢失
+      m_event_flags.clear(static_cast<uint32_t>(Bits::Receive_Finish));
+
+      if (!input_ready())
+      {
+        uint32_t event_bits = m_event_flags.wait((static_cast<uint32_t>(Bits::Receive_Finish) | static_cast<uint32_t>(Bits::Close)), timeout_ms);
+        if ((0 == event_bits) || (event_bits & static_cast<uint32_t>(Bits::Close)))
+        {
+          ret = false;
+        }
+      }
+    }
+
+    return ret;
+  }
+
+  /**
+   * @brief  流设备 恢复默认等待条件并取出一帧数据
+   *
+   * @param  data      数据缓存区指针
+   * @param  size      帧大小 (为0时仅恢复等待条件)
+   * @return uint32_t  读取数据大小
+   */
+  uint32_t take_frame(void* data, uint32_t size)
+  {
+    uint32_t ret = 0;
+
+    m_wait_delim = -1;
+    m_wait_size  = 1;
+
+    if (0 != size)
+    {
+      ret = m_input_buffer.read(static_cast<uint8_t*>(data), size);
+    }
+
+    if (m_input_buffer.empty())
+    {
+      m_event_flags.clear(static_cast<uint32_t>(Bits::Receive_Finish));
+    }
+
+    return ret;
+  }
+
 protected:
   /// @brief 输入缓存区
   memory::Ring_Buffer<uint8_t, In_Buf_Size, In_Buf_Mode> m_input_buffer;
@@ -700,6 +1323,62 @@ protected:
    */
   virtual uint32_t send_impl(const uint8_t* data, uint32_t size) = 0;
 
+  /**
+   * @brief  流设备 设备聚集发送元方法 (默认逐段调用 send_impl 并等待各段发送完成，派生类可合并为一次发送)
+   *
+   * @param  vec        输出向量数组
+   * @param  count      输出向量数量
+   * @param  timeout_ms 段间等待超时时间 - 毫秒
+   * @return uint32_t   实际发送数据大小 (最后一段的发送完成由调用方等待)
+   */
+  virtual uint32_t sendv_impl(const Io_Vec* vec, uint32_t count, uint32_t timeout_ms)
+  {
+    uint32_t sent    = 0;
+    bool     pending = false;
+
+    for (uint32_t i = 0; i < count && m_opened; ++i)
+    {
+      if (0 == vec[i].size)
+      {
+        continue;
+      }
+
+      if (pending)
+      {
+        uint32_t event_bits = m_event_flags.wait((static_cast<uint32_t>(Bits::Transmit_Finish) | static_cast<uint32_t>(Bits::Close)), timeout_ms);
+        if (!(event_bits & static_cast<uint32_t>(Bits::Transmit_Finish)))
+        {
+          break;
+        }
+
+        m_event_flags.set(static_cast<uint32_t>(Bits::Enable_Transfer));
+        m_event_flags.clear(static_cast<uint32_t>(Bits::Transmit_Finish));
+        pending = false;
+      }
+
+      uint32_t bytes = send_impl(static_cast<const uint8_t*>(vec[i].data), vec[i].size);
+      if (0 == bytes)
+      {
+        break;
+      }
+
+      sent    += bytes;
+      pending  = true;
+
+      if (bytes < vec[i].size)
+      {
+        break;
+      }
+    }
+
+    if (0 != sent && !pending)
+    {
+      output_complete();
+    }
+
+    return sent;
+  }
+
   /**
    * @brief  流设备 推送数据进入缓存区
    *
@@ -720,7 +1399,7 @@ protected:
   template <bool enable = (memory::Ring_Buffer_Mode::INPUT_BYTES == In_Buf_Mode), typename = std::enable_if_t<enable>>
   void input_complete(void)
   {
-    m_event_flags.set(static_cast<uint32_t>(Bits::Receive_Finish));
+    input_notify();
   }
 
   /**
@@ -748,7 +1427,7 @@ protected:
     m_input_buffer.input_complete(size);
     if (size)
     {
-      m_event_flags.set(static_cast<uint32_t>(Bits::Receive_Finish));
+      input_notify();
     }
   }
 
@@ -775,7 +1454,7 @@ protected:
   void memory_switch(void)
   {
     m_input_buffer.switch_buffer();
-    m_event_flags.set(static_cast<uint32_t>(Bits::Receive_Finish));
+    input_notify();
   }
 
   /**
@@ -785,6 +1464,11 @@ protected:
   {
     m_event_flags.clear(static_cast<uint32_t>(Bits::Enable_Transfer));
     m_event_flags.set(static_cast<uint32_t>(Bits::Transmit_Finish));
+
+    if (m_async.has_writes())
+    {
+      post_event(static_cast<uint32_t>(Bits::Async_Request));
+    }
   }
 
   /**
@@ -797,6 +1481,55 @@ protected:
    */
   virtual ~Stream_Device() {}
 
+  /**
+   * @brief  流设备 异步请求处理 (设备管理器线程中执行)
+   */
+  void async_handler(void) override
+  {
+    if (!m_opened)
+    {
+      m_async.cancel_all();
+    }
+    else
+    {
+      m_async.fill_reads(m_input_buffer);
+
+      if (m_input_buffer.empty())
+      {
+        m_event_flags.clear(static_cast<uint32_t>(Bits::Receive_Finish));
+      }
+
+      Io_Request* request = nullptr;
+
+      // 发送通道空闲时结束上一个写请求并启动下一个
+      while (!m_event_flags.wait(static_cast<uint32_t>(Bits::Enable_Transfer), 0))
+      {
+        m_async.finish_write(true);
+
+        if (nullptr == (request = m_async.start_write()))
+        {
+          break;
+        }
+
+        if (0 != request->size)
+        {
+          m_event_flags.set(static_cast<uint32_t>(Bits::Enable_Transfer));
+          m_event_flags.clear(static_cast<uint32_t>(Bits::Transmit_Finish));
+
+          request->done = send_impl(static_cast<const uint8_t*>(request->data), request->size);
+
+          if (0 == request->done)
+          {
+            m_event_flags.clear(static_cast<uint32_t>(Bits::Enable_Transfer));
+            m_async.finish_write(false);
+          }
+        }
+      }
+    }
+
+    m_async.dispatch();
+  }
+
 public:
   /**
    * @brief  流设备 获取输入缓存区大小
@@ -828,8 +1561,21 @@ public:
    */
   int64_t read(void* data, uint32_t size, uint32_t timeout_ms = TX_WAIT_FOREVER) override
   {
-    int64_t  ret      = 0;
-    uint8_t* data_ptr = reinterpret_cast<uint8_t*>(data);
+    Io_Mut_Vec vec = { data, size };
+    return Stream_Device::readv(&vec, 1, timeout_ms);
+  }
+
+  /**
+   * @brief  流设备 分散读取数据 (按顺序填满各段)
+   *
+   * @param  vec                输入向量数组
+   * @param  count              输入向量数量
+   * @param  timeout_ms         超时时间 - 毫秒
+   * @return int64_t            读取数据大小
+   */
+  int64_t readv(const Io_Mut_Vec* vec, uint32_t count, uint32_t timeout_ms = TX_WAIT_FOREVER) override
+  {
+    int64_t ret = 0;
 
     if (!m_opened)
     {
@@ -839,8 +1585,17 @@ public:
     {
       uint32_t read_bytes = 0;
       uint32_t event_bits = 0;
-      while (read_bytes < size && m_opened)
+      uint32_t index      = 0;
+      uint32_t offset     = 0;
+      while (index < count && m_opened)
       {
+        if (offset >= vec[index].size)
+        {
+          ++index;
+          offset = 0;
+          continue;
+        }
+
         if (m_input_buffer.empty())
         {
           event_bits = m_event_flags.wait((static_cast<uint32_t>(Bits::Receive_Finish) | static_cast<uint32_t>(Bits::Close)), timeout_ms);
@@ -850,7 +1605,9 @@ public:
           }
         }
 
-        read_bytes += m_input_buffer.read(data_ptr + read_bytes, std::min(size - read_bytes, m_input_buffer.available()));
+        uint32_t bytes  = m_input_buffer.read(static_cast<uint8_t*>(vec[index].data) + offset, std::min(vec[index].size - offset, m_input_buffer.available()));
+        offset         += bytes;
+        read_bytes     += bytes;
 
         if (m_input_buffer.empty())
         {
@@ -873,18 +1630,37 @@ public:
    */
   int64_t write(const void* data, uint32_t size, uint32_t timeout_ms = 0) override
   {
-    int64_t        ret           = 0;
-    uint32_t       event_bits    = 0;
-    bool           need_transfer = false;
-    const uint8_t* data_ptr      = reinterpret_cast<const uint8_t*>(data);
+    Io_Vec vec = { data, size };
+    return Stream_Device::writev(&vec, 1, timeout_ms);
+  }
+
+  /**
+   * @brief  流设备 聚集写入数据 (一次占用发送通道，各段之间不会插入其他写入者的数据)
+   *
+   * @param  vec                输出向量数组
+   * @param  count              输出向量数量
+   * @param  timeout_ms         超时时间 - 毫秒
+   * @return int64_t            写入数据大小
+   */
+  int64_t writev(const Io_Vec* vec, uint32_t count, uint32_t timeout_ms = 0) override
+  {
+    int64_t  ret           = 0;
+    uint32_t event_bits    = 0;
+    bool     need_transfer = false;
 
     if (!m_opened)
     {
       ret = -1;
     }
-    else if (0 != size)
+    else if (0 != io_vec_size(vec, count))
     {
-      if (m_event_flags.wait(static_cast<uint32_t>(Bits::Enable_Transfer), 0))
+      system_internal::device_internal::Device_Write_Lock lock(m_write_mutex, timeout_ms);
+
+      if (!lock.owns())
+      {
+        ret = 0;
+      }
+      else if (m_event_flags.wait(static_cast<uint32_t>(Bits::Enable_Transfer), 0))
       {
         event_bits = m_event_flags.wait((static_cast<uint32_t>(Bits::Transmit_Finish) | static_cast<uint32_t>(Bits::Close)), timeout_ms);
         if (static_cast<uint32_t>(Bits::Transmit_Finish) & event_bits)
@@ -902,7 +1678,7 @@ public:
         m_event_flags.set(static_cast<uint32_t>(Bits::Enable_Transfer));
         m_event_flags.clear(static_cast<uint32_t>(Bits::Transmit_Finish));
 
-        ret = send_impl(data_ptr, size);
+        ret = (1 == count) ? send_impl(static_cast<const uint8_t*>(vec[0].data), vec[0].size) : sendv_impl(vec, count, timeout_ms);
 
         if (ret > 0)
         {
@@ -935,7 +1711,13 @@ public:
     }
     else
     {
-      if (m_event_flags.wait(static_cast<uint32_t>(Bits::Enable_Transfer), 0))
+      system_internal::device_internal::Device_Write_Lock lock(m_write_mutex, timeout_ms);
+
+      if (!lock.owns())
+      {
+        error_code = Device_Error_Code::TIMEOUT;
+      }
+      else if (m_event_flags.wait(static_cast<uint32_t>(Bits::Enable_Transfer), 0))
       {
         event_bits = m_event_flags.wait((static_cast<uint32_t>(Bits::Transmit_Finish) | static_cast<uint32_t>(Bits::Close)), timeout_ms);
 
@@ -1063,7 +1845,7 @@ public:
           }
         }
 
-        peek_bytes += m_input_buffer.peek(data_ptr + peek_bytes, std::min(request - peek_bytes, m_input_buffer.available()));
+        peek_bytes += m_input_buffer.peek(data_ptr + peek_bytes, request - peek_bytes, peek_bytes);
       }
       ret = peek_bytes;
     }
@@ -1081,6 +1863,159 @@ public:
       m_input_buffer.roll_back();
     }
   }
+
+  /**
+   * @brief  流设备 在输入缓存区中原地查找分隔符 (不拷贝数据)
+   *
+   * @param  delim              分隔符
+   * @param  offset             起始偏移
+   * @return uint32_t           相对读取位置的偏移，未找到返回UINT32_MAX
+   */
+  uint32_t find(uint8_t delim, uint32_t offset = 0) const
+  {
+    uint32_t ret = UINT32_MAX;
+
+    if (m_opened)
+    {
+      ret = m_input_buffer.find(delim, offset);
+    }
+
+    return ret;
+  }
+
+  /**
+   * @brief  流设备 读取数据直到分隔符 (包含分隔符)
+   *
+   * @param  delim              分隔符
+   * @param  data               数据缓存区指针
+   * @param  max                数据缓存区大小
+   * @param  timeout_ms         超时时间 - 毫秒
+   * @return int64_t            读取数据大小，超时返回0
+   * @note   分隔符出现或已有max字节 (输入缓存区已满) 时返回，未找到分隔符时返回的数据不以分隔符结尾;
+   *         等待期间仅在新数据中出现分隔符时唤醒
+   */
+  int64_t read_until(uint8_t delim, void* data, uint32_t max, uint32_t timeout_ms = TX_WAIT_FOREVER)
+  {
+    int64_t ret = 0;
+
+    if (!m_opened)
+    {
+      ret = -1;
+    }
+    else if (0 != max)
+    {
+      const uint32_t limit = std::min<uint32_t>(max, In_Buf_Size - 1);
+      uint32_t       scan  = 0;
+      uint32_t       size  = 0;
+
+      while (m_opened)
+      {
+        const uint32_t available = m_input_buffer.available();
+        const uint32_t position  = m_input_buffer.find(delim, scan);
+
+        if (UINT32_MAX != position)
+        {
+          size = std::min<uint32_t>(position + 1, limit);
+          break;
+        }
+        else if (available >= limit)
+        {
+          size = limit;
+          break;
+        }
+
+        scan = available;
+
+        if (!wait_input(limit, delim, scan, timeout_ms))
+        {
+          break;
+        }
+      }
+
+      ret = take_frame(data, size);
+    }
+
+    return ret;
+  }
+
+  /**
+   * @brief  流设备 读取长度字段帧
+   *
+   * @param  spec               长度字段帧格式
+   * @param  data               数据缓存区指针
+   * @param  max                数据缓存区大小
+   * @param  timeout_ms         超时时间 - 毫秒
+   * @return int64_t            帧大小，超时返回0，设备未打开或帧长度非法 (超出max或输入缓存区) 返回-1
+   * @note   帧长度非法时数据保留在输入缓存区，由调用方清空后重新同步;
+   *         等待期间仅在帧头或整帧到齐时唤醒
+   */
+  int64_t read_frame(const Frame_Length_Spec& spec, void* data, uint32_t max, uint32_t timeout_ms = TX_WAIT_FOREVER)
+  {
+    int64_t ret = 0;
+
+    if (!m_opened || 0 == spec.size || spec.size > 4)
+    {
+      ret = -1;
+    }
+    else
+    {
+      const uint32_t header = spec.offset + spec.size;
+      uint32_t       need   = header;
+      uint32_t       size   = 0;
+      bool           parsed = false;
+
+      while (m_opened)
+      {
+        const uint32_t available = m_input_buffer.available();
+
+        if (!parsed && available >= header)
+        {
+          uint8_t  field[4] = { 0 };
+          uint32_t value    = 0;
+
+          m_input_buffer.peek(field, spec.size, spec.offset);
+
+          for (uint32_t i = 0; i < spec.size; ++i)
+          {
+            value |= static_cast<uint32_t>(field[i]) << (8 * (spec.big_endian ? (spec.size - 1 - i) : i));
+          }
+
+          const int64_t frame = static_cast<int64_t>(header) + value + spec.adjust;
+
+          if (frame < header || frame > max || frame > In_Buf_Size - 1)
+          {
+            ret = -1;
+            break;
+          }
+
+          need   = static_cast<uint32_t>(frame);
+          parsed = true;
+        }
+
+        if (parsed && available >= need)
+        {
+          size = need;
+          break;
+        }
+
+        if (!wait_input(need, -1, 0, timeout_ms))
+        {
+          break;
+        }
+      }
+
+      if (0 == ret)
+      {
+        ret = take_frame(data, size);
+      }
+      else
+      {
+        take_frame(data, 0);
+      }
+    }
+
+    return ret;
+  }
 };
 
 /**
@@ -1103,6 +2038,114 @@ private:
   /// @brief 设备事件标志位
   using Bits = system_internal::device_internal::Device_Event_Bits;
 
+  /// @brief 等待读取的数据大小 (输入数据达到该大小时通知读取者)
+  volatile uint32_t m_wait_size  = 1;
+  /// @brief 等待读取的分隔符 (小于0时不按分隔符等待)
+  volatile int32_t  m_wait_delim = -1;
+  /// @brief 分隔符已扫描偏移
+  volatile uint32_t m_wait_scan  = 0;
+
+  /**
+   * @brief  流设备 输入数据是否满足读取者的等待条件 (输入完成时调用)
+   *
+   * @return true   满足，通知读取者
+   * @return false  不满足
+   */
+  bool input_ready(void)
+  {
+    const uint32_t available = m_input_buffer.available();
+    bool           ret       = (available >= m_wait_size);
+
+    if (!ret && m_wait_delim >= 0)
+    {
+      ret         = (UINT32_MAX != m_input_buffer.find(static_cast<uint8_t>(m_wait_delim), m_wait_scan));
+      m_wait_scan = available;
+    }
+
+    return ret;
+  }
+
+  /**
+   * @brief  流设备 输入通知 (满足读取者的等待条件时通知读取者，有异步读请求时通知设备管理器)
+   */
+  void input_notify(void)
+  {
+    if (input_ready())
+    {
+      m_event_flags.set(static_cast<uint32_t>(Bits::Receive_Finish));
+    }
+
+    if (m_async.has_reads())
+    {
+      post_event(static_cast<uint32_t>(Bits::Async_Request));
+    }
+  }
+
+  /**
+   * @brief  流设备 设置等待条件并等待输入
+   *
+   * @param  size        等待的数据大小
+   * @param  delim       等待的分隔符 (小于0时不按分隔符等待)
+   * @param  scan        分隔符已扫描偏移
+   * @param  timeout_ms  超时时间 - 毫秒
+   * @return true        条件可能已满足，需重新检查
+   * @return false       超时 (超时时间为0时不等待) 或设备关闭
+   */
+  bool wait_input(uint32_t size, int32_t delim, uint32_t scan, uint32_t timeout_ms)
+  {
+    bool ret = false;
+
+    // 不等待时无需发布等待条件
+    if (TX_NO_WAIT != timeout_ms)
+    {
+      ret          = true;
+      m_wait_scan  = scan;
+      m_wait_delim = delim;
+      m_wait_size  = size;
+
+      // 先清除标志再复查，生产者在此之后的通知不会丢失
+      m_event_flags.clear(static_cast<uint32_t>(Bits::Receive_Finish));
+
+      if (!input_ready())
+      {
+        uint32_t event_bits = m_event_flags.wait((static_cast<uint32_t>(Bits::Receive_Finish) | static_cast<uint32_t>(Bits::Close)), timeout_ms);
+        if ((0 == event_bits) || (event_bits & static_cast<uint32_t>(Bits::Close)))
+        {
+          ret = false;
+        }
+      }
+    }
+
+    return ret;
+  }
+
+  /**
+   * @brief  流设备 恢复默认等待条件并取出一帧数据
+   *
+   * @param  data      数据缓存区指针
+   * @param  size      帧大小 (为0时仅恢复等待条件)
+   * @return uint32_t  读取数据大小
+   */
+  uint32_t take_frame(void* data, uint32_t size)
+  {
+    uint32_t ret = 0;
+
+    m_wait_delim = -1;
+    m_wait_size  = 1;
+
+    if (0 != size)
+    {
+      ret = m_input_buffer.read(static_cast<uint8_t*>(data), size);
+    }
+
+    if (m_input_buffer.empty())
+    {
+      m_event_flags.clear(static_cast<uint32_t>(Bits::Receive_Finish));
+    }
+
+    return ret;
+  }
+
 protected:
   /// @brief 输入缓存区
   memory::Ring_Buffer<uint8_t, In_Buf_Size, In_Buf_Mode>                       m_input_buffer;
@@ -1118,6 +2161,22 @@ protected:
    */
   virtual uint32_t send_impl(const uint8_t* data, uint32_t size) = 0;
 
+  /**
+   * @brief  流设备 设备聚集发送元方法 (输出缓存区模式下写入经由缓存区合并，不调用本方法)
+   *
+   * @param  vec        输出向量数组
+   * @param  count      输出向量数量
+   * @param  timeout_ms 超时时间 - 毫秒
+   * @return uint32_t   实际发送数据大小
+   */
+  virtual uint32_t sendv_impl(const Io_Vec* vec, uint32_t count, uint32_t timeout_ms)
+  {
+    (void)vec;
+    (void)count;
+    (void)timeout_ms;
+    return 0;
+  }
+
   /**
    * @brief  流设备 推送数据进入缓存区
    *
@@ -1138,7 +2197,7 @@ protected:
   template <bool enable = (memory::Ring_Buffer_Mode::INPUT_BYTES == In_Buf_Mode), typename = std::enable_if_t<enable>>
   void input_complete(void)
   {
-    m_event_flags.set(static_cast<uint32_t>(Bits::Receive_Finish));
+    input_notify();
   }
 
   /**
@@ -1166,7 +2225,7 @@ protected:
     m_input_buffer.input_complete(size);
     if (0 != size)
     {
-      m_event_flags.set(static_cast<uint32_t>(Bits::Receive_Finish));
+      input_notify();
     }
   }
 
@@ -1193,7 +2252,7 @@ protected:
   void memory_switch(void)
   {
     m_input_buffer.switch_buffer();
-    m_event_flags.set(static_cast<uint32_t>(Bits::Receive_Finish));
+    input_notify();
   }
 
   /**
@@ -1214,6 +2273,11 @@ protected:
   {
     m_output_buffer.output_complete();
     m_event_flags.set(static_cast<uint32_t>(Bits::Transmit_Finish));
+
+    if (m_async.has_writes())
+    {
+      post_event(static_cast<uint32_t>(Bits::Async_Request));
+    }
   }
 
   /**
@@ -1226,6 +2290,33 @@ protected:
    */
   virtual ~Stream_Device() {}
 
+  /**
+   * @brief  流设备 异步请求处理 (设备管理器线程中执行)
+   */
+  void async_handler(void) override
+  {
+    if (!m_opened)
+    {
+      m_async.cancel_all();
+    }
+    else
+    {
+      m_async.fill_reads(m_input_buffer);
+
+      if (m_input_buffer.empty())
+      {
+        m_event_flags.clear(static_cast<uint32_t>(Bits::Receive_Finish));
+      }
+
+      if (0 != m_async.drain_writes(m_output_buffer))
+      {
+        post_event(static_cast<uint32_t>(Bits::Enable_Transfer));
+      }
+    }
+
+    m_async.dispatch();
+  }
+
 public:
   /**
    * @brief  流设备 获取输入缓存区大小
@@ -1257,8 +2348,21 @@ public:
    */
   int64_t read(void* data, uint32_t size, uint32_t timeout_ms = TX_WAIT_FOREVER) override
   {
-    int64_t  ret      = 0;
-    uint8_t* data_ptr = reinterpret_cast<uint8_t*>(data);
+    Io_Mut_Vec vec = { data, size };
+    return Stream_Device::readv(&vec, 1, timeout_ms);
+  }
+
+  /**
+   * @brief  流设备 分散读取数据 (按顺序填满各段)
+   *
+   * @param  vec                输入向量数组
+   * @param  count              输入向量数量
+   * @param  timeout_ms         超时时间 - 毫秒
+   * @return int64_t            读取数据大小
+   */
+  int64_t readv(const Io_Mut_Vec* vec, uint32_t count, uint32_t timeout_ms = TX_WAIT_FOREVER) override
+  {
+    int64_t ret = 0;
 
     if (!m_opened)
     {
@@ -1268,8 +2372,17 @@ public:
     {
       uint32_t read_bytes = 0;
       uint32_t event_bits = 0;
-      while (read_bytes < size && m_opened)
+      uint32_t index      = 0;
+      uint32_t offset     = 0;
+      while (index < count && m_opened)
       {
+        if (offset >= vec[index].size)
+        {
+          ++index;
+          offset = 0;
+          continue;
+        }
+
         if (m_input_buffer.empty())
         {
           event_bits = m_event_flags.wait((static_cast<uint32_t>(Bits::Receive_Finish) | static_cast<uint32_t>(Bits::Close)), timeout_ms);
@@ -1279,7 +2392,9 @@ public:
           }
         }
 
-        read_bytes += m_input_buffer.read(data_ptr + read_bytes, std::min(size - read_bytes, m_input_buffer.available()));
+        uint32_t bytes  = m_input_buffer.read(static_cast<uint8_t*>(vec[index].data) + offset, std::min(vec[index].size - offset, m_input_buffer.available()));
+        offset         += bytes;
+        read_bytes     += bytes;
 
         if (m_input_buffer.empty())
         {
@@ -1302,19 +2417,41 @@ public:
    */
   int64_t write(const void* data, uint32_t size, uint32_t timeout_ms = 0) override
   {
-    int64_t        ret      = 0;
-    const uint8_t* data_ptr = static_cast<const uint8_t*>(data);
+    Io_Vec vec = { data, size };
+    return Stream_Device::writev(&vec, 1, timeout_ms);
+  }
+
+  /**
+   * @brief  流设备 聚集写入数据 (各段依次写入输出缓存区)
+   *
+   * @param  vec                输出向量数组
+   * @param  count              输出向量数量
+   * @param  timeout_ms         超时时间 - 毫秒
+   * @return int64_t            写入数据大小
+   */
+  int64_t writev(const Io_Vec* vec, uint32_t count, uint32_t timeout_ms = 0) override
+  {
+    int64_t ret = 0;
 
     if (!m_opened)
     {
       ret = -1;
     }
-    else if (0 != size)
+    else
     {
       uint32_t write_bytes = 0;
       uint32_t event_bits  = 0;
-      while (write_bytes < size && m_opened)
+      uint32_t index       = 0;
+      uint32_t offset      = 0;
+      while (index < count && m_opened)
       {
+        if (offset >= vec[index].size)
+        {
+          ++index;
+          offset = 0;
+          continue;
+        }
+
         if (m_output_buffer.full())
         {
           event_bits = m_event_flags.wait((static_cast<uint32_t>(Bits::Transmit_Finish) | static_cast<uint32_t>(Bits::Close)), timeout_ms);
@@ -1326,7 +2463,9 @@ public:
 
         if (m_opened)
         {
-          write_bytes += m_output_buffer.write(data_ptr + write_bytes, std::min(size - write_bytes, m_output_buffer.space()));
+          uint32_t bytes  = m_output_buffer.write(static_cast<const uint8_t*>(vec[index].data) + offset, std::min(vec[index].size - offset, m_output_buffer.space()));
+          offset         += bytes;
+          write_bytes    += bytes;
 
           if (m_output_buffer.full())
           {
@@ -1487,7 +2626,7 @@ public:
           }
         }
 
-        peek_bytes += m_input_buffer.peek(data_ptr + peek_bytes, std::min(request - peek_bytes, m_input_buffer.available()));
+        peek_bytes += m_input_buffer.peek(data_ptr + peek_bytes, request - peek_bytes, peek_bytes);
       }
       ret = peek_bytes;
     }
@@ -1505,6 +2644,159 @@ public:
       m_input_buffer.roll_back();
     }
   }
+
+  /**
+   * @brief  流设备 在输入缓存区中原地查找分隔符 (不拷贝数据)
+   *
+   * @param  delim              分隔符
+   * @param  offset             起始偏移
+   * @return uint32_t           相对读取位置的偏移，未找到返回UINT32_MAX
+   */
+  uint32_t find(uint8_t delim, uint32_t offset = 0) const
+  {
+    uint32_t ret = UINT32_MAX;
+
+    if (m_opened)
+    {
+      ret = m_input_buffer.find(delim, offset);
+    }
+
+    return ret;
+  }
+
+  /**
+   * @brief  流设备 读取数据直到分隔符 (包含分隔符)
+   *
+   * @param  delim              分隔符
+   * @param  data               数据缓存区指针
+   * @param  max                数据缓存区大小
+   * @param  timeout_ms         超时时间 - 毫秒
+   * @return int64_t            读取数据大小，超时返回0
+   * @note   分隔符出现或已有max字节 (输入缓存区已满) 时返回，未找到分隔符时返回的数据不以分隔符结尾;
+   *         等待期间仅在新数据中出现分隔符时唤醒
+   */
+  int64_t read_until(uint8_t delim, void* data, uint32_t max, uint32_t timeout_ms = TX_WAIT_FOREVER)
+  {
+    int64_t ret = 0;
+
+    if (!m_opened)
+    {
+      ret = -1;
+    }
+    else if (0 != max)
+    {
+      const uint32_t limit = std::min<uint32_t>(max, In_Buf_Size - 1);
+      uint32_t       scan  = 0;
+      uint32_t       size  = 0;
+
+      while (m_opened)
+      {
+        const uint32_t available = m_input_buffer.available();
+        const uint32_t position  = m_input_buffer.find(delim, scan);
+
+        if (UINT32_MAX != position)
+        {
+          size = std::min<uint32_t>(position + 1, limit);
+          break;
+        }
+        else if (available >= limit)
+        {
+          size = limit;
+          break;
+        }
+
+        scan = available;
+
+        if (!wait_input(limit, delim, scan, timeout_ms))
+        {
+          break;
+        }
+      }
+
+      ret = take_frame(data, size);
+    }
+
+    return ret;
+  }
+
+  /**
+   * @brief  流设备 读取长度字段帧
+   *
+   * @param  spec               长度字段帧格式
+   * @param  data               数据缓存区指针
+   * @param  max                数据缓存区大小
+   * @param  timeout_ms         超时时间 - 毫秒
+   * @return int64_t            帧大小，超时返回0，设备未打开或帧长度非法 (超出max或输入缓存区) 返回-1
+   * @note   帧长度非法时数据保留在输入缓存区，由调用方清空后重新同步;
+   *         等待期间仅在帧头或整帧到齐时唤醒
+   */
+  int64_t read_frame(const Frame_Length_Spec& spec, void* data, uint32_t max, uint32_t timeout_ms = TX_WAIT_FOREVER)
+  {
+    int64_t ret = 0;
+
+    if (!m_opened || 0 == spec.size || spec.size > 4)
+    {
+      ret = -1;
+    }
+    else
+    {
+      const uint32_t header = spec.offset + spec.size;
+      uint32_t       need   = header;
+      uint32_t       size   = 0;
+      bool           parsed = false;
+
+      while (m_opened)
+      {
+        const uint32_t available = m_input_buffer.available();
+
+        if (!parsed && available >= header)
+        {
+          uint8_t  field[4] = { 0 };
+          uint32_t value    = 0;
+
+          m_input_buffer.peek(field, spec.size, spec.offset);
+
+          for (uint32_t i = 0; i < spec.size; ++i)
+          {
+            value |= static_cast<uint32_t>(field[i]) << (8 * (spec.big_endian ? (spec.size - 1 - i) : i));
+          }
+
+          const int64_t frame = static_cast<int64_t>(header) + value + spec.adjust;
+
+          if (frame < header || frame > max || frame > In_Buf_Size - 1)
+          {
+            ret = -1;
+            break;
+          }
+
+          need   = static_cast<uint32_t>(frame);
+          parsed = true;
+        }
+
+        if (parsed && available >= need)
+        {
+          size = need;
+          break;
+        }
+
+        if (!wait_input(need, -1, 0, timeout_ms))
+        {
+          break;
+        }
+      }
+
+      if (0 == ret)
+      {
+        ret = take_frame(data, size);
+      }
+      else
+      {
+        take_frame(data, 0);
+      }
+    }
+
+    return ret;
+  }
 };
 } /* namespace device */
 } /* namespace system */
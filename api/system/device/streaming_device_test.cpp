@@ -0,0 +1,1008 @@
+/**
+ * @file   streaming_device_test.cpp
+ * @brief  流设备 主机测试: 聚集写入/分散读取 (writev/readv) 与逐段读写的一致性、零长度段与部分读取、
+ *         无缓冲输出的逐段发送与派生类合并发送、多写入者并发时帧不交错，以及小分段帧的帧率基准;
+ *         find/read_until/read_frame 的分隔符与长度字段分帧、帧未到齐时不唤醒读取者，以及每帧 CPU 耗时基准
+ *
+ * @note   仅用于主机，不参与固件编译 (已加入 eide excludeList);
+ *         内核由 host_kernel.hpp 仿真 (设备管理器通道线程为主机线程)，Loopback_Device 走带输出缓存区的路径,
+ *         Capture_Device/Direct_Capture 为无输出缓存区的设备，send_impl 记录每次发送并立即完成 (对应 DMA 完成中断);
+ *         Byte_Device 为字节输入设备，feed 对应接收中断分批写入;
+ *         基准耗时请以不带 sanitizer 的 -O2 构建为准
+ *
+ *         构建 (仓库根目录):
+ *         g++ -std=c++17 -O2 -g -fsanitize=address,undefined -fpermissive -w \
+ *             $(python3 -c "import json;c=json.load(open('.eide/eide.json'))['targets']['Debug']['custom_dep'];print(' '.join(['-I'+p for p in c['incList']]+['-D'+d for d in c['defineList']]))") \
+ *             api/system/device/streaming_device_test.cpp -o streaming_device_test -lpthread && ./streaming_device_test
+ */
+#include "host_kernel.hpp"
+#include "direct_device.hpp"
+#include "loopback_device.hpp"
+
+#include <chrono>
+#include <cstdio>
+#include <ctime>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace QAQ::system::device;
+
+/* 主机测试不使用信号，对象析构时断开连接为空操作 */
+namespace QAQ
+{
+namespace system
+{
+namespace system_internal
+{
+namespace signal_internal
+{
+class Null_Signal_Manager final : public Signal_Manager_Base
+{
+};
+
+Null_Signal_Manager  g_null_signal_manager;
+Signal_Manager_Base* __signal_manager_base = &g_null_signal_manager;
+} /* namespace signal_internal */
+} /* namespace system_internal */
+} /* namespace system */
+} /* namespace QAQ */
+
+namespace
+{
+/// @brief 失败的检查数
+int g_failures = 0;
+
+#define CHECK(cond)                                                  \
+  do                                                                 \
+  {                                                                  \
+    if (!(cond))                                                     \
+    {                                                                \
+      ++g_failures;                                                  \
+      printf("%s:%d: CHECK(%s) failed\n", __FILE__, __LINE__, #cond); \
+    }                                                                \
+  } while (0)
+
+/**
+ * @brief 无输出缓存区的捕获设备 (send_impl 记录发送内容并立即完成)
+ */
+class Capture_Device : public Stream_Device<Stream_Type::READ_WRITE, 256, 0, QAQ::system::memory::Ring_Buffer_Mode::INPUT_SINGLE_BUFFER>
+{
+protected:
+  uint32_t send_impl(const uint8_t* data, uint32_t size) override
+  {
+    {
+      std::lock_guard<std::mutex> lock(m_mutex);
+      m_wire.append(reinterpret_cast<const char*>(data), size);
+      ++m_sends;
+    }
+
+    output_complete();
+    return size;
+  }
+
+  void manger_handler(uint32_t) override {}
+
+  Device_Error_Code open_impl(void) override
+  {
+    return Device_Error_Code::OK;
+  }
+
+  Device_Error_Code close_impl(void) override
+  {
+    return Device_Error_Code::OK;
+  }
+
+  Device_Error_Code config_impl(uint32_t, uint32_t) override
+  {
+    return Device_Error_Code::INVALID_PARAMETER;
+  }
+
+  uint32_t get_config_impl(uint32_t) const override
+  {
+    return 0;
+  }
+
+public:
+  /// @brief 线路内容保护
+  std::mutex  m_mutex;
+  /// @brief 线路内容
+  std::string m_wire;
+  /// @brief send_impl 调用次数
+  uint32_t    m_sends = 0;
+
+  void reset(void)
+  {
+    m_wire.clear();
+    m_sends = 0;
+  }
+};
+
+/**
+ * @brief 合并发送的捕获设备 (重写 sendv_impl，各段拼接后一次发送，对应 TCP 客户端的包链)
+ */
+class Gather_Device final : public Capture_Device
+{
+  uint32_t sendv_impl(const Io_Vec* vec, uint32_t count, uint32_t) override
+  {
+    uint8_t  frame[256];
+    uint32_t size = 0;
+
+    for (uint32_t i = 0; i < count && size + vec[i].size <= sizeof(frame); ++i)
+    {
+      memcpy(frame + size, vec[i].data, vec[i].size);
+      size += vec[i].size;
+    }
+
+    return send_impl(frame, size);
+  }
+};
+
+/**
+ * @brief 直接传输捕获设备 (Direct_Device 的发送路径)
+ */
+class Direct_Capture final : public Direct_Device
+{
+  uint32_t recv_impl(uint8_t*, uint32_t) override
+  {
+    return 0;
+  }
+
+  uint32_t send_impl(const uint8_t* data, uint32_t size) override
+  {
+    m_wire.append(reinterpret_cast<const char*>(data), size);
+    ++m_sends;
+    output_complete();
+    return size;
+  }
+
+  void manger_handler(uint32_t) override {}
+
+  Device_Error_Code open_impl(void) override
+  {
+    return Device_Error_Code::OK;
+  }
+
+  Device_Error_Code close_impl(void) override
+  {
+    return Device_Error_Code::OK;
+  }
+
+  Device_Error_Code config_impl(uint32_t, uint32_t) override
+  {
+    return Device_Error_Code::INVALID_PARAMETER;
+  }
+
+  uint32_t get_config_impl(uint32_t) const override
+  {
+    return 0;
+  }
+
+public:
+  /// @brief 线路内容
+  std::string m_wire;
+  /// @brief send_impl 调用次数
+  uint32_t    m_sends = 0;
+};
+
+/**
+ * @brief 字节输入设备 (feed 对应接收中断逐字节写入输入缓存区后调用 input_complete)
+ */
+class Byte_Device final : public Stream_Device<Stream_Type::READ_ONLY, 256, 0>
+{
+  void manger_handler(uint32_t) override {}
+
+  Device_Error_Code open_impl(void) override
+  {
+    return Device_Error_Code::OK;
+  }
+
+  Device_Error_Code close_impl(void) override
+  {
+    return Device_Error_Code::OK;
+  }
+
+  Device_Error_Code config_impl(uint32_t, uint32_t) override
+  {
+    return Device_Error_Code::INVALID_PARAMETER;
+  }
+
+  uint32_t get_config_impl(uint32_t) const override
+  {
+    return 0;
+  }
+
+public:
+  /// @brief 输入数据
+  void feed(const void* data, uint32_t size)
+  {
+    for (uint32_t i = 0; i < size; ++i)
+    {
+      input_buffer_push(static_cast<const uint8_t*>(data)[i]);
+    }
+
+    input_complete();
+  }
+
+  /// @brief 是否已通知读取者
+  bool notified(void)
+  {
+    return 0 != m_event_flags.wait(static_cast<uint32_t>(QAQ::system::system_internal::device_internal::Device_Event_Bits::Receive_Finish), 0);
+  }
+};
+
+/// @brief 回环设备
+Loopback_Device<256> g_loopback;
+/// @brief 捕获设备
+Capture_Device       g_capture;
+/// @brief 合并发送设备
+Gather_Device        g_gather;
+/// @brief 直接传输捕获设备
+Direct_Capture       g_direct;
+/// @brief 字节输入设备
+Byte_Device          g_bytes;
+
+/**
+ * @brief  生成测试帧 (4 字节帧头 + 负载 + 2 字节校验)
+ *
+ * @param  seq      帧序号
+ * @param  payload  负载大小
+ * @param  head     帧头 - 输出
+ * @param  body     负载 - 输出
+ * @param  tail     校验 - 输出
+ */
+static void make_frame(uint32_t seq, uint32_t payload, uint8_t (&head)[4], uint8_t* body, uint8_t (&tail)[2])
+{
+  uint16_t sum = 0;
+
+  head[0] = 0xA5;
+  head[1] = static_cast<uint8_t>(seq);
+  head[2] = static_cast<uint8_t>(seq >> 8);
+  head[3] = static_cast<uint8_t>(payload);
+
+  for (uint32_t i = 0; i < payload; ++i)
+  {
+    body[i]  = static_cast<uint8_t>(seq * 7 + i);
+    sum     += body[i];
+  }
+
+  tail[0] = static_cast<uint8_t>(sum);
+  tail[1] = static_cast<uint8_t>(sum >> 8);
+}
+
+/**
+ * @brief  回环设备读取直至收齐 (输出缓存区回绕时一次刷新只发送连续的一段)
+ *
+ * @param  data  数据缓存区
+ * @param  size  数据大小
+ * @return int64_t 读取数据大小
+ */
+static int64_t loopback_read_all(void* data, uint32_t size)
+{
+  int64_t total = 0;
+
+  for (uint32_t retry = 0; retry < 4 && total < size; ++retry)
+  {
+    g_loopback.flush(100);
+    int64_t ret = g_loopback.read(static_cast<uint8_t*>(data) + total, size - total, 100);
+
+    if (ret < 0)
+    {
+      return ret;
+    }
+
+    total += ret;
+  }
+
+  return total;
+}
+
+/**
+ * @brief  生成 Modbus TCP 帧 (MBAP 头 + 单元标识 + PDU)
+ *
+ * @param  tid       事务标识
+ * @param  pdu       PDU 大小 (含功能码)
+ * @param  frame     帧 - 输出
+ * @return uint32_t  帧大小
+ */
+static uint32_t make_mbap(uint16_t tid, uint32_t pdu, uint8_t* frame)
+{
+  frame[0] = static_cast<uint8_t>(tid >> 8);
+  frame[1] = static_cast<uint8_t>(tid);
+  frame[2] = 0;
+  frame[3] = 0;
+  frame[4] = static_cast<uint8_t>((pdu + 1) >> 8);
+  frame[5] = static_cast<uint8_t>(pdu + 1);
+  frame[6] = 1;
+
+  for (uint32_t i = 0; i < pdu; ++i)
+  {
+    frame[7 + i] = static_cast<uint8_t>(tid + i);
+  }
+
+  return 7 + pdu;
+}
+
+/// @brief Modbus TCP 长度字段帧格式 (MBAP 偏移4的大端2字节长度，其后为单元标识与PDU)
+constexpr Frame_Length_Spec MBAP_SPEC = { 4, 2, true, 0 };
+} /* namespace */
+
+/**
+ * @brief  测试: 带输出缓存区的设备 writev/readv 与逐段读写一致
+ */
+static void test_buffered(void)
+{
+  uint8_t head[4];
+  uint8_t body[32];
+  uint8_t tail[2];
+
+  CHECK(Device_Error_Code::OK == g_loopback.open());
+
+  for (uint32_t seq = 0; seq < 200; ++seq)
+  {
+    const uint32_t payload = seq % 33;
+    make_frame(seq, payload, head, body, tail);
+
+    // 零长度段被跳过
+    const Io_Vec vec[] = {
+      { head, sizeof(head) },
+      { nullptr, 0 },
+      { body, payload },
+      { tail, sizeof(tail) },
+    };
+    CHECK(static_cast<int64_t>(6 + payload) == g_loopback.writev(vec, 4));
+
+    // 按与写入不同的切分读回
+    uint8_t          first[3];
+    uint8_t          rest[64];
+    const Io_Mut_Vec in[] = {
+      { first, sizeof(first) },
+      { rest, 3 + payload },
+    };
+    g_loopback.flush(100);
+    int64_t got = g_loopback.readv(in, 2, 100);
+
+    if (got < static_cast<int64_t>(6 + payload))
+    {
+      got += loopback_read_all(rest + (got - 3), static_cast<uint32_t>(6 + payload - got));
+    }
+
+    CHECK(static_cast<int64_t>(6 + payload) == got);
+    CHECK(0 == memcmp(first, head, 3));
+    CHECK(head[3] == rest[0]);
+    CHECK(0 == memcmp(rest + 1, body, payload));
+    CHECK(0 == memcmp(rest + 1 + payload, tail, 2));
+  }
+
+  CHECK(0 == g_loopback.overrun_bytes());
+
+  // 空向量与全零长度向量
+  const Io_Vec empty[] = { { nullptr, 0 } };
+  CHECK(0 == g_loopback.writev(empty, 0));
+  CHECK(0 == g_loopback.writev(empty, 1));
+
+  // 部分读取: 数据不足时超时返回已读部分
+  CHECK(5 == g_loopback.write("abcde", 5));
+  g_loopback.flush(100);
+  char             part_a[2];
+  char             part_b[8];
+  const Io_Mut_Vec part[] = {
+    { part_a, sizeof(part_a) },
+    { part_b, sizeof(part_b) },
+  };
+  CHECK(5 == g_loopback.readv(part, 2, 20));
+  CHECK(0 == memcmp(part_a, "ab", 2) && 0 == memcmp(part_b, "cde", 3));
+
+  // 关闭后返回 -1
+  CHECK(Device_Error_Code::OK == g_loopback.close());
+  const Io_Vec closed[] = { { "x", 1 } };
+  CHECK(-1 == g_loopback.writev(closed, 1));
+  CHECK(-1 == g_loopback.readv(part, 2, 0));
+}
+
+/**
+ * @brief  测试: 无输出缓存区的设备逐段发送、派生类合并发送、Direct_Device 路径
+ */
+static void test_unbuffered(void)
+{
+  uint8_t head[4];
+  uint8_t body[16];
+  uint8_t tail[2];
+
+  make_frame(1, sizeof(body), head, body, tail);
+  const Io_Vec vec[] = {
+    { head, sizeof(head) },
+    { body, 0 },
+    { body, sizeof(body) },
+    { tail, sizeof(tail) },
+  };
+  const std::string expect = std::string(reinterpret_cast<char*>(head), 4) + std::string(reinterpret_cast<char*>(body), 16) + std::string(reinterpret_cast<char*>(tail), 2);
+
+  // 默认 sendv_impl: 每个非空段一次 send_impl，按顺序发送
+  CHECK(Device_Error_Code::OK == g_capture.open());
+  CHECK(22 == g_capture.writev(vec, 4, 100));
+  CHECK(expect == g_capture.m_wire);
+  CHECK(3 == g_capture.m_sends);
+
+  // 单段写入不经过 sendv_impl
+  g_capture.reset();
+  CHECK(4 == g_capture.write(head, 4, 100));
+  CHECK(1 == g_capture.m_sends);
+
+  // 发送通道在写入结束后空闲，不等待即可再次写入
+  CHECK(4 == g_capture.write(head, 4, 0));
+  CHECK(Device_Error_Code::OK == g_capture.flush(0));
+  CHECK(Device_Error_Code::OK == g_capture.close());
+
+  // 派生类合并发送: 一次 send_impl
+  CHECK(Device_Error_Code::OK == g_gather.open());
+  CHECK(22 == g_gather.writev(vec, 4, 100));
+  CHECK(expect == g_gather.m_wire);
+  CHECK(1 == g_gather.m_sends);
+  CHECK(Device_Error_Code::OK == g_gather.close());
+
+  // Direct_Device 同样逐段发送
+  CHECK(Device_Error_Code::OK == g_direct.open());
+  CHECK(22 == g_direct.writev(vec, 4, 100));
+  CHECK(expect == g_direct.m_wire);
+  CHECK(3 == g_direct.m_sends);
+  CHECK(Device_Error_Code::OK == g_direct.close());
+  CHECK(-1 == g_direct.writev(vec, 4, 100));
+}
+
+/**
+ * @brief  测试: 多个写入者并发 writev 时各帧在线路上不交错
+ */
+static void test_concurrent_writers(void)
+{
+  constexpr uint32_t WRITERS = 3;
+  constexpr uint32_t FRAMES  = 3000;
+
+  g_capture.reset();
+  CHECK(Device_Error_Code::OK == g_capture.open());
+
+  std::vector<std::thread> writers;
+
+  for (uint32_t w = 0; w < WRITERS; ++w)
+  {
+    writers.emplace_back([w]() {
+      uint8_t head[4];
+      uint8_t body[8];
+      uint8_t tail[2];
+
+      for (uint32_t seq = 0; seq < FRAMES; ++seq)
+      {
+        make_frame((w << 12) | seq, sizeof(body), head, body, tail);
+        const Io_Vec vec[] = {
+          { head, sizeof(head) },
+          { body, sizeof(body) },
+          { tail, sizeof(tail) },
+        };
+
+        while (14 != g_capture.writev(vec, 3, TX_WAIT_FOREVER))
+        {
+        }
+      }
+    });
+  }
+
+  for (std::thread& writer : writers)
+  {
+    writer.join();
+  }
+
+  // 逐帧解析线路内容: 每帧首字节为 0xA5 且校验正确
+  const std::string& wire   = g_capture.m_wire;
+  uint32_t           frames = 0;
+  uint32_t           broken = 0;
+
+  CHECK(WRITERS * FRAMES * 14 == wire.size());
+
+  for (size_t offset = 0; offset + 14 <= wire.size(); offset += 14, ++frames)
+  {
+    const uint8_t* frame = reinterpret_cast<const uint8_t*>(wire.data() + offset);
+    uint16_t       sum   = 0;
+
+    for (uint32_t i = 0; i < 8; ++i)
+    {
+      sum += frame[4 + i];
+    }
+
+    if (0xA5 != frame[0] || 8 != frame[3] || frame[12] != static_cast<uint8_t>(sum) || frame[13] != static_cast<uint8_t>(sum >> 8))
+    {
+      ++broken;
+    }
+  }
+
+  CHECK(WRITERS * FRAMES == frames);
+  CHECK(0 == broken);
+
+  if (0 != broken)
+  {
+    printf("concurrent writers: %u of %u frames interleaved\n", broken, frames);
+  }
+
+  CHECK(Device_Error_Code::OK == g_capture.close());
+}
+
+/**
+ * @brief  测试: find 在回绕的两段中原地查找，read_until 按分隔符取出整行、未到分隔符时不唤醒读取者
+ */
+static void test_read_until(void)
+{
+  char    line[64];
+  int64_t got = 0;
+
+  CHECK(UINT32_MAX == g_bytes.find('\n'));
+  CHECK(-1 == g_bytes.read_until('\n', line, sizeof(line), 0));
+  CHECK(Device_Error_Code::OK == g_bytes.open());
+
+  // 使下一批数据跨越输入缓存区末尾
+  uint8_t junk[250];
+  memset(junk, 'x', sizeof(junk));
+  g_bytes.feed(junk, sizeof(junk));
+  CHECK(250 == g_bytes.read(junk, sizeof(junk), 0));
+
+  g_bytes.feed("hello\nworld\nabc", 15);
+  CHECK(5 == g_bytes.find('\n'));
+  CHECK(11 == g_bytes.find('\n', 6));
+  CHECK(UINT32_MAX == g_bytes.find('\n', 12));
+  CHECK(UINT32_MAX == g_bytes.find('z'));
+
+  CHECK(6 == g_bytes.read_until('\n', line, sizeof(line), 0));
+  CHECK(0 == memcmp(line, "hello\n", 6));
+  CHECK(6 == g_bytes.read_until('\n', line, sizeof(line), 0));
+  CHECK(0 == memcmp(line, "world\n", 6));
+
+  // 未到分隔符: 超时返回0，数据保留
+  CHECK(0 == g_bytes.read_until('\n', line, sizeof(line), 10));
+  CHECK(3 == g_bytes.available());
+
+  // 缓存区不足一行时按 max 截断
+  CHECK(2 == g_bytes.read_until('\n', line, 2, 0));
+  CHECK(0 == memcmp(line, "ab", 2));
+  CHECK(Device_Error_Code::OK == g_bytes.clear());
+
+  // 阻塞读取: 分隔符到达前的输入不通知读取者
+  std::thread reader([&]() { got = g_bytes.read_until('\n', line, sizeof(line), 1000); });
+  std::this_thread::sleep_for(std::chrono::milliseconds(20));
+  g_bytes.feed("par", 3);
+  CHECK(!g_bytes.notified());
+  g_bytes.feed("tial", 4);
+  CHECK(!g_bytes.notified());
+  g_bytes.feed("\n", 1);
+  reader.join();
+  CHECK(8 == got && 0 == memcmp(line, "partial\n", 8));
+  CHECK(!g_bytes.notified());
+
+  CHECK(Device_Error_Code::OK == g_bytes.close());
+}
+
+/**
+ * @brief  测试: read_frame 按长度字段取出整帧 (Modbus TCP 与小端单字节长度)，非法长度保留数据
+ */
+static void test_read_frame(void)
+{
+  uint8_t frame[256];
+  uint8_t out[64];
+  int64_t got = 0;
+
+  CHECK(-1 == g_bytes.read_frame(MBAP_SPEC, out, sizeof(out), 0));
+  CHECK(Device_Error_Code::OK == g_bytes.open());
+  CHECK(-1 == g_bytes.read_frame({ 0, 0, false, 0 }, out, sizeof(out), 0));
+
+  // 两帧按5字节分批到达，每批后非阻塞读取
+  uint8_t        stream[128];
+  const uint32_t first  = make_mbap(0x1234, 5, stream);
+  const uint32_t second = make_mbap(0x1235, 20, stream + first);
+  uint32_t       frames = 0;
+
+  for (uint32_t offset = 0; offset < first + second; offset += 5)
+  {
+    g_bytes.feed(stream + offset, std::min<uint32_t>(5, first + second - offset));
+    got = g_bytes.read_frame(MBAP_SPEC, out, sizeof(out), 0);
+
+    if (0 != got)
+    {
+      const uint32_t expect = (0 == frames) ? first : second;
+      CHECK(static_cast<int64_t>(expect) == got);
+      CHECK(0 == memcmp(out, stream + ((0 == frames) ? 0 : first), expect));
+      ++frames;
+    }
+  }
+
+  CHECK(2 == frames);
+  CHECK(g_bytes.empty());
+
+  // 小端单字节长度，其后2字节校验
+  const uint8_t tagged[] = { 3, 'a', 'b', 'c', 0x12, 0x34 };
+  g_bytes.feed(tagged, sizeof(tagged));
+  CHECK(6 == g_bytes.read_frame({ 0, 1, false, 2 }, out, sizeof(out), 0));
+  CHECK(0 == memcmp(out, tagged, sizeof(tagged)));
+
+  // 帧长度超出 max: 返回-1，数据保留供调用方重新同步
+  make_mbap(0x0001, 199, frame);
+  g_bytes.feed(frame, 7);
+  CHECK(-1 == g_bytes.read_frame(MBAP_SPEC, out, sizeof(out), 0));
+  CHECK(7 == g_bytes.available());
+  CHECK(Device_Error_Code::OK == g_bytes.clear());
+
+  // 阻塞读取: 帧头到齐前的输入不通知读取者
+  const uint32_t size = make_mbap(0x4242, 9, frame);
+  std::thread    reader([&]() { got = g_bytes.read_frame(MBAP_SPEC, out, sizeof(out), 1000); });
+  std::this_thread::sleep_for(std::chrono::milliseconds(20));
+  g_bytes.feed(frame, 3);
+  CHECK(!g_bytes.notified());
+  g_bytes.feed(frame + 3, size - 3);
+  reader.join();
+  CHECK(static_cast<int64_t>(size) == got && 0 == memcmp(out, frame, size));
+
+  CHECK(Device_Error_Code::OK == g_bytes.close());
+}
+
+/**
+ * @brief  测试: 输入线程按1~7字节分批写入，读取线程阻塞读取行与 Modbus 帧，内容与顺序不变
+ */
+static void test_framed_stream(void)
+{
+  constexpr uint32_t LINES = 2000;
+
+  CHECK(Device_Error_Code::OK == g_bytes.open());
+
+  std::string traffic;
+
+  for (uint32_t i = 0; i < LINES; ++i)
+  {
+    traffic += std::string(1 + i % 60, static_cast<char>('a' + i % 26)) + '\n';
+  }
+
+  for (uint32_t i = 0; i < LINES; ++i)
+  {
+    uint8_t frame[64];
+    traffic.append(reinterpret_cast<char*>(frame), make_mbap(static_cast<uint16_t>(i), 1 + i % 50, frame));
+  }
+
+  std::thread producer([&traffic]() {
+    for (size_t offset = 0, chunk = 1; offset < traffic.size(); offset += chunk, chunk = 1 + offset % 7)
+    {
+      while (g_bytes.available() > 200)
+      {
+        std::this_thread::yield();
+      }
+
+      g_bytes.feed(traffic.data() + offset, static_cast<uint32_t>(std::min(chunk, traffic.size() - offset)));
+    }
+  });
+
+  size_t   offset = 0;
+  uint32_t lines  = 0;
+  uint32_t frames = 0;
+  uint8_t  out[64];
+
+  for (; lines < LINES; ++lines)
+  {
+    const int64_t got = g_bytes.read_until('\n', out, sizeof(out), 1000);
+
+    if (got <= 0 || 0 != memcmp(out, traffic.data() + offset, static_cast<size_t>(got)) || '\n' != out[got - 1])
+    {
+      break;
+    }
+
+    offset += static_cast<size_t>(got);
+  }
+
+  for (; frames < LINES; ++frames)
+  {
+    const int64_t got = g_bytes.read_frame(MBAP_SPEC, out, sizeof(out), 1000);
+
+    if (got <= 0 || 0 != memcmp(out, traffic.data() + offset, static_cast<size_t>(got)))
+    {
+      break;
+    }
+
+    offset += static_cast<size_t>(got);
+  }
+
+  producer.join();
+  CHECK(LINES == lines);
+  CHECK(LINES == frames);
+  CHECK(traffic.size() == offset);
+  CHECK(Device_Error_Code::OK == g_bytes.close());
+}
+
+/**
+ * @brief  计时 (纳秒/次)
+ *
+ * @param  rounds  运行次数
+ * @param  func    被测函数
+ * @return double  每次耗时 (纳秒)
+ */
+template <typename Func>
+static double time_ns(uint32_t rounds, Func&& func)
+{
+  auto start = std::chrono::steady_clock::now();
+
+  for (uint32_t i = 0; i < rounds; ++i)
+  {
+    func(i);
+  }
+
+  return std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count() / rounds;
+}
+
+/**
+ * @brief  基准: 小分段帧 (帧头 + 负载 + 校验) 的帧率，writev 与逐段 write、先拼接再 write 对比
+ */
+static void bench_frames(void)
+{
+  constexpr uint32_t ROUNDS = 20000;
+
+  uint8_t head[4];
+  uint8_t body[64];
+  uint8_t tail[2];
+
+  CHECK(Device_Error_Code::OK == g_capture.open());
+  CHECK(Device_Error_Code::OK == g_gather.open());
+
+  printf("%-10s %8s %14s %14s %14s %14s %10s\n", "payload", "", "writev", "3x write", "copy+write", "gather", "sends");
+
+  for (uint32_t payload : { 8u, 16u, 64u })
+  {
+    make_frame(0, payload, head, body, tail);
+    const Io_Vec vec[] = {
+      { head, sizeof(head) },
+      { body, payload },
+      { tail, sizeof(tail) },
+    };
+
+    g_capture.reset();
+    const double writev_ns = time_ns(ROUNDS, [&](uint32_t) {
+      g_capture.writev(vec, 3, 100);
+      g_capture.m_wire.clear();
+    });
+    const uint32_t writev_sends = g_capture.m_sends / ROUNDS;
+
+    const double write_ns = time_ns(ROUNDS, [&](uint32_t) {
+      g_capture.write(head, sizeof(head), 100);
+      g_capture.write(body, payload, 100);
+      g_capture.write(tail, sizeof(tail), 100);
+      g_capture.m_wire.clear();
+    });
+
+    const double copy_ns = time_ns(ROUNDS, [&](uint32_t) {
+      uint8_t frame[sizeof(head) + sizeof(body) + sizeof(tail)];
+      memcpy(frame, head, sizeof(head));
+      memcpy(frame + sizeof(head), body, payload);
+      memcpy(frame + sizeof(head) + payload, tail, sizeof(tail));
+      g_capture.write(frame, sizeof(head) + payload + sizeof(tail), 100);
+      g_capture.m_wire.clear();
+    });
+
+    g_gather.reset();
+    const double gather_ns = time_ns(ROUNDS, [&](uint32_t) {
+      g_gather.writev(vec, 3, 100);
+      g_gather.m_wire.clear();
+    });
+    const uint32_t gather_sends = g_gather.m_sends / ROUNDS;
+
+    printf("%-10u %8s %14.0f %14.0f %14.0f %14.0f %5u/%-4u\n", payload, "fps", 1e9 / writev_ns, 1e9 / write_ns, 1e9 / copy_ns, 1e9 / gather_ns, writev_sends, gather_sends);
+  }
+
+  CHECK(Device_Error_Code::OK == g_capture.close());
+  CHECK(Device_Error_Code::OK == g_gather.close());
+
+  // 带输出缓存区: 各段写入缓存区，周期性刷新并读回
+  CHECK(Device_Error_Code::OK == g_loopback.open());
+
+  for (uint32_t payload : { 8u, 16u, 64u })
+  {
+    make_frame(0, payload, head, body, tail);
+    const Io_Vec vec[] = {
+      { head, sizeof(head) },
+      { body, payload },
+      { tail, sizeof(tail) },
+    };
+    uint8_t sink[256];
+
+    const double writev_ns = time_ns(ROUNDS / 10, [&](uint32_t) {
+      g_loopback.writev(vec, 3);
+      g_loopback.flush(100);
+      g_loopback.read(sink, sizeof(head) + payload + sizeof(tail), 100);
+    });
+    const double write_ns = time_ns(ROUNDS / 10, [&](uint32_t) {
+      g_loopback.write(head, sizeof(head));
+      g_loopback.write(body, payload);
+      g_loopback.write(tail, sizeof(tail));
+      g_loopback.flush(100);
+      g_loopback.read(sink, sizeof(head) + payload + sizeof(tail), 100);
+    });
+
+    printf("%-10u %8s %14.0f %14.0f %14s %14s %10s\n", payload, "loopback", 1e9 / writev_ns, 1e9 / write_ns, "-", "-", "-");
+  }
+
+  CHECK(Device_Error_Code::OK == g_loopback.close());
+}
+
+/**
+ * @brief  基准: 每帧 CPU 耗时，换行分隔与 Modbus TCP 流量按8字节分批输入，
+ *         read_until/read_frame 与 available + peek + 查找 + read 的写法对比
+ */
+static void bench_parse(void)
+{
+  constexpr uint32_t FRAMES = 1000;
+  constexpr uint32_t ROUNDS = 20;
+  constexpr uint32_t CHUNK  = 8;
+
+  std::string lines;
+  std::string mbap;
+
+  for (uint32_t i = 0; i < FRAMES; ++i)
+  {
+    uint8_t frame[64];
+    lines += std::string(10 + i % 60, static_cast<char>('a' + i % 26)) + '\n';
+    mbap.append(reinterpret_cast<char*>(frame), make_mbap(static_cast<uint16_t>(i), 5 + i % 30, frame));
+  }
+
+  CHECK(Device_Error_Code::OK == g_bytes.open());
+
+  // 按8字节分批输入，每批后取出所有完整帧
+  auto run = [](const std::string& traffic, auto&& take) {
+    uint32_t frames = 0;
+
+    for (size_t offset = 0; offset < traffic.size(); offset += CHUNK)
+    {
+      g_bytes.feed(traffic.data() + offset, static_cast<uint32_t>(std::min<size_t>(CHUNK, traffic.size() - offset)));
+
+      while (take())
+      {
+        ++frames;
+      }
+    }
+
+    return frames;
+  };
+
+  uint8_t  out[128];
+  uint8_t  scratch[256];
+  uint32_t frames = 0;
+
+  // 仅输入 (每批后清空)
+  const double feed_line_ns = time_ns(ROUNDS, [&](uint32_t) {
+    run(lines, []() { return (Device_Error_Code::OK != g_bytes.clear()); });
+  });
+  const double feed_frame_ns = time_ns(ROUNDS, [&](uint32_t) {
+    run(mbap, []() { return (Device_Error_Code::OK != g_bytes.clear()); });
+  });
+
+  const double until_ns = time_ns(ROUNDS, [&](uint32_t) {
+    frames = run(lines, [&]() { return 0 < g_bytes.read_until('\n', out, sizeof(out), 0); });
+  });
+  CHECK(FRAMES == frames);
+
+  const double peek_line_ns = time_ns(ROUNDS, [&](uint32_t) {
+    frames = run(lines, [&]() {
+      const uint32_t available = g_bytes.available();
+      const void*    delim     = (0 == available) ? nullptr : memchr(scratch, '\n', static_cast<size_t>(g_bytes.peek(scratch, available, 0)));
+      return (nullptr != delim) && (0 < g_bytes.read(out, static_cast<uint32_t>(static_cast<const uint8_t*>(delim) - scratch + 1), 0));
+    });
+  });
+  CHECK(FRAMES == frames);
+
+  const double frame_ns = time_ns(ROUNDS, [&](uint32_t) {
+    frames = run(mbap, [&]() { return 0 < g_bytes.read_frame(MBAP_SPEC, out, sizeof(out), 0); });
+  });
+  CHECK(FRAMES == frames);
+
+  const double peek_frame_ns = time_ns(ROUNDS, [&](uint32_t) {
+    frames = run(mbap, [&]() {
+      uint8_t        header[6];
+      const uint32_t available = g_bytes.available();
+
+      if (available < sizeof(header) || sizeof(header) != g_bytes.peek(header, sizeof(header), 0))
+      {
+        return false;
+      }
+
+      const uint32_t size = sizeof(header) + ((static_cast<uint32_t>(header[4]) << 8) | header[5]);
+      return (available >= size) && (0 < g_bytes.read(out, size, 0));
+    });
+  });
+  CHECK(FRAMES == frames);
+
+  // 阻塞读取: 读取线程阻塞等待，输入按8字节分批到达 (每批后让出处理器)，统计读取线程唤醒次数与 CPU 耗时
+  auto blocking = [](const std::string& traffic, auto&& take, double& wakeups, double& cpu_ns) {
+    const uint64_t start  = QAQ::system::kernel::host::state().event_wakeups;
+    uint32_t       frames = 0;
+    std::thread    reader([&]() {
+      timespec begin;
+      timespec end;
+      clock_gettime(CLOCK_THREAD_CPUTIME_ID, &begin);
+
+      while (frames < FRAMES && take())
+      {
+        ++frames;
+      }
+
+      clock_gettime(CLOCK_THREAD_CPUTIME_ID, &end);
+      cpu_ns = ((end.tv_sec - begin.tv_sec) * 1e9 + (end.tv_nsec - begin.tv_nsec)) / FRAMES;
+    });
+
+    for (size_t offset = 0; offset < traffic.size(); offset += CHUNK)
+    {
+      while (g_bytes.available() > 200)
+      {
+        std::this_thread::yield();
+      }
+
+      g_bytes.feed(traffic.data() + offset, static_cast<uint32_t>(std::min<size_t>(CHUNK, traffic.size() - offset)));
+      std::this_thread::yield();
+    }
+
+    reader.join();
+    wakeups = static_cast<double>(QAQ::system::kernel::host::state().event_wakeups - start) / FRAMES;
+    return frames;
+  };
+
+  double until_wakeups;
+  double until_cpu;
+  double byte_wakeups;
+  double byte_cpu;
+  double frame_wakeups;
+  double frame_cpu;
+  double split_wakeups;
+  double split_cpu;
+
+  frames = blocking(lines, [&]() { return 0 < g_bytes.read_until('\n', out, sizeof(out), 1000); }, until_wakeups, until_cpu);
+  CHECK(FRAMES == frames);
+
+  frames = blocking(lines, [&]() {
+    uint8_t c = 0;
+
+    while ('\n' != c && 1 == g_bytes.read(&c, 1, 1000))
+    {
+    }
+
+    return '\n' == c;
+  }, byte_wakeups, byte_cpu);
+  CHECK(FRAMES == frames);
+
+  frames = blocking(mbap, [&]() { return 0 < g_bytes.read_frame(MBAP_SPEC, out, sizeof(out), 1000); }, frame_wakeups, frame_cpu);
+  CHECK(FRAMES == frames);
+
+  frames = blocking(mbap, [&]() {
+    if (6 != g_bytes.read(out, 6, 1000))
+    {
+      return false;
+    }
+
+    const uint32_t size = (static_cast<uint32_t>(out[4]) << 8) | out[5];
+    return size == g_bytes.read(out + 6, size, 1000);
+  }, split_wakeups, split_cpu);
+  CHECK(FRAMES == frames);
+
+  CHECK(Device_Error_Code::OK == g_bytes.close());
+
+  printf("%-10s %14s %14s %14s\n", "ns/frame", "framed read", "peek+scan", "input only");
+  printf("%-10s %14.0f %14.0f %14.0f\n", "newline", until_ns / FRAMES, peek_line_ns / FRAMES, feed_line_ns / FRAMES);
+  printf("%-10s %14.0f %14.0f %14.0f\n", "modbus", frame_ns / FRAMES, peek_frame_ns / FRAMES, feed_frame_ns / FRAMES);
+  printf("%-10s %14s %14s %14s %14s\n", "blocking", "framed wakeup", "framed cpu", "plain wakeup", "plain cpu");
+  printf("%-10s %14.2f %14.0f %14.2f %14.0f\n", "newline", until_wakeups, until_cpu, byte_wakeups, byte_cpu);
+  printf("%-10s %14.2f %14.0f %14.2f %14.0f\n", "modbus", frame_wakeups, frame_cpu, split_wakeups, split_cpu);
+}
+
+int main(void)
+{
+  test_buffered();
+  test_unbuffered();
+  test_concurrent_writers();
+  test_read_until();
+  test_read_frame();
+  test_framed_stream();
+  bench_frames();
+  bench_parse();
+
+  printf("streaming_device_test: %s (%d failures)\n", 0 == g_failures ? "OK" : "FAILED", g_failures);
+  fflush(stdout);
+  return 0 == g_failures ? 0 : 1;
+}
@@ -62,7 +62,7 @@ public:
    */
   uint32_t QAQ_O3 wait(uint32_t flags, uint32_t timeout = TX_WAIT_FOREVER, Options wait_option = Options::Or)
   {
-    uint32_t   result = 0;
+    ULONG      result = 0;
     const UINT status = tx_event_flags_get(&m_event_group, flags, static_cast<UINT>(wait_option), &result, timeout);
 
     if (status == TX_NO_EVENTS)
@@ -77,7 +77,7 @@ public:
     }
 #endif /* (SYSTEM_ERROR_LOG_ENABLE && EVENT_FLAGS_ERROR_LOG_ENABLE) */
 
-    return result;
+    return static_cast<uint32_t>(result);
   }
 
   /**
@@ -88,14 +88,14 @@ public:
    */
   uint32_t QAQ_O3 get(uint32_t timeout = TX_NO_WAIT)
   {
-    uint32_t   result = 0;
+    ULONG      result = 0;
     const UINT status = tx_event_flags_get(&m_event_group, 0xFFFFFFFF, static_cast<UINT>(Options::Or), &result, timeout);
 
 #if (SYSTEM_ERROR_LOG_ENABLE && EVENT_FLAGS_ERROR_LOG_ENABLE)
     System_Monitor::check_status(status, "Failed to get event flags");
 #endif /* (SYSTEM_ERROR_LOG_ENABLE && EVENT_FLAGS_ERROR_LOG_ENABLE) */
 
-    return (status == TX_SUCCESS) ? result : 0;
+    return (status == TX_SUCCESS) ? static_cast<uint32_t>(result) : 0;
   }
 
   /**
@@ -0,0 +1,1004 @@
+#ifndef __HOST_KERNEL_HPP__
+#define __HOST_KERNEL_HPP__
+
+/**
+ * @note  主机内核仿真: 仅用于主机测试，不参与固件编译; 每个测试程序仅在一个源文件中、且在其他 api 头文件之前包含
+ *        (头文件内定义了 ThreadX 桩函数的实体，并须先于 system_include.hpp 重定向中断开关与 DWT);
+ *        以 std::thread 实现线程 (首次恢复时启动)，以一把全局递归锁实现关中断 (Interrupt_Guard)，
+ *        事件标志、消息队列、互斥锁、信号量按 ThreadX 语义在该锁与条件变量上实现，阻塞等待的超时按 1 节拍 = 1 毫秒实时等待;
+ *        块内存池按块大小连续划分 (空闲块内保存链表指针，不附加块头)，字节内存池在池内存上首次适配分配 (分配记录保存在仿真状态中);
+ *        系统时钟 (tx_time_get) 与软件定时器由测试调用 tick() 推进，定时器回调在调用者线程中以定时器线程身份执行;
+ *        Isr_Scope 将当前线程标记为中断上下文 (QAQ_IS_IN_ISR 为真); 仿真状态在进程退出时不析构，阻塞中的线程随进程结束
+ */
+
+#ifndef TX_MISRA_ENABLE
+#define TX_MISRA_ENABLE
+#endif /* TX_MISRA_ENABLE */
+
+#include "system_include.hpp"
+#include "system_define.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <condition_variable>
+#include <cstring>
+#include <map>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+/// @brief 名称空间 QAQ
+namespace QAQ
+{
+/// @brief 名称空间 系统
+namespace system
+{
+/// @brief 名称空间 内核
+namespace kernel
+{
+/// @brief 名称空间 主机内核仿真
+namespace host
+{
+/// @brief 仿真 DWT (周期计数恒为0)
+struct Host_Dwt
+{
+  volatile uint32_t CTRL;
+  volatile uint32_t CYCCNT;
+  volatile uint32_t LAR;
+};
+
+/// @brief 仿真 CoreDebug
+struct Host_Core_Debug
+{
+  volatile uint32_t DEMCR;
+};
+
+/// @brief 仿真 DWT 实例
+inline Host_Dwt        g_dwt        = {};
+/// @brief 仿真 CoreDebug 实例
+inline Host_Core_Debug g_core_debug = {};
+
+/// @brief 仿真内核 事件标志等待者 (与 ThreadX 一致，设置标志时即满足挂起中的等待者，之后的清除不影响已满足的等待者)
+struct Event_Waiter
+{
+  TX_EVENT_FLAGS_GROUP* group;     /* 事件标志组 */
+  ULONG                 requested; /* 等待的标志 */
+  UINT                  option;    /* 等待选项 */
+  ULONG                 actual;    /* 满足时的标志 */
+  bool                  satisfied; /* 已满足 */
+};
+
+/// @brief 仿真内核 状态
+struct State
+{
+  /// @brief 内核锁 (关中断)
+  std::recursive_mutex        lock;
+  /// @brief 内核对象状态变化通知
+  std::condition_variable_any changed;
+  /// @brief 系统节拍
+  ULONG                       ticks = 0;
+  /// @brief 激活的软件定时器
+  std::vector<TX_TIMER*>      timers;
+  /// @brief 挂起中的事件标志等待者
+  std::vector<Event_Waiter*>  event_waiters;
+  /// @brief 挂起的事件标志等待者被唤醒的次数 (统计)
+  uint64_t                    event_wakeups = 0;
+  /// @brief 已创建的块内存池
+  std::vector<TX_BLOCK_POOL*> block_pools;
+  /// @brief 已创建的字节内存池及其已分配区间 (起始地址 -> 大小)
+  std::map<TX_BYTE_POOL*, std::map<UCHAR*, ULONG>> byte_pools;
+};
+
+/**
+ * @brief  仿真内核 获取状态 (首次使用时创建，进程退出时不析构)
+ *
+ * @return State& 状态
+ */
+inline State& state(void)
+{
+  static State* instance = new State();
+  return *instance;
+}
+
+/// @brief 当前线程控制块 (仿真内核创建的线程)
+inline thread_local TX_THREAD* t_current  = nullptr;
+/// @brief 主机线程控制块 (未由仿真内核创建的线程，每个主机线程各自一个，互斥锁据此区分持有者)
+inline thread_local TX_THREAD  t_foreign  = {};
+/// @brief 当前线程处于中断上下文
+inline thread_local bool       t_in_isr   = false;
+/// @brief 当前线程处于定时器回调
+inline thread_local bool       t_in_timer = false;
+
+/**
+ * @brief 仿真内核 中断上下文作用域 (作用域内 QAQ_IS_IN_ISR 为真)
+ */
+class Isr_Scope final
+{
+  // 禁止拷贝和移动
+  QAQ_NO_COPY_MOVE(Isr_Scope)
+
+private:
+  /// @brief 进入前的状态
+  bool m_saved;
+
+public:
+  /**
+   * @brief 中断上下文作用域 构造函数
+   */
+  Isr_Scope() : m_saved(t_in_isr)
+  {
+    t_in_isr = true;
+  }
+
+  /**
+   * @brief 中断上下文作用域 析构函数
+   */
+  ~Isr_Scope()
+  {
+    t_in_isr = m_saved;
+  }
+};
+
+/**
+ * @brief  仿真内核 按 ThreadX 超时等待条件成立
+ *
+ * @tparam Predicate 条件类型
+ * @param  lock      已持有的内核锁
+ * @param  timeout   超时时间 - 节拍
+ * @param  predicate 条件
+ * @return true      条件成立
+ * @return false     超时
+ */
+template <typename Predicate>
+bool wait(std::unique_lock<std::recursive_mutex>& lock, ULONG timeout, Predicate predicate)
+{
+  if (TX_NO_WAIT == timeout)
+  {
+    return predicate();
+  }
+
+  if (TX_WAIT_FOREVER == timeout)
+  {
+    state().changed.wait(lock, predicate);
+    return true;
+  }
+
+  return state().changed.wait_for(lock, std::chrono::milliseconds(static_cast<uint64_t>(timeout) * 1000 / TX_TIMER_TICKS_PER_SECOND), predicate);
+}
+
+/**
+ * @brief  仿真内核 尝试以事件标志组当前标志满足等待条件 (满足且需清除时清除等待的标志)
+ *
+ * @param  waiter 等待者
+ * @return true   已满足
+ * @return false  未满足
+ */
+inline bool event_try_satisfy(Event_Waiter& waiter)
+{
+  const ULONG current = waiter.group->tx_event_flags_group_current;
+  const bool  all     = (TX_AND == waiter.option) || (TX_AND_CLEAR == waiter.option);
+  const ULONG matched = current & waiter.requested;
+
+  if (all ? (matched != waiter.requested) : (0 == matched))
+  {
+    return false;
+  }
+
+  waiter.actual    = current;
+  waiter.satisfied = true;
+
+  if ((TX_OR_CLEAR == waiter.option) || (TX_AND_CLEAR == waiter.option))
+  {
+    waiter.group->tx_event_flags_group_current &= ~waiter.requested;
+  }
+
+  return true;
+}
+
+/**
+ * @brief  仿真内核 推进系统节拍并执行到期的软件定时器回调
+ *
+ * @param  ticks 推进的节拍数
+ */
+inline void tick(uint32_t ticks = 1)
+{
+  State&                 kernel = state();
+  std::vector<TX_TIMER*> expired;
+
+  for (uint32_t i = 0; i < ticks; ++i)
+  {
+    {
+      std::unique_lock<std::recursive_mutex> lock(kernel.lock);
+      ++kernel.ticks;
+
+      for (TX_TIMER* timer : kernel.timers)
+      {
+        TX_TIMER_INTERNAL& internal = timer->tx_timer_internal;
+
+        if (0 == --internal.tx_timer_internal_remaining_ticks)
+        {
+          expired.push_back(timer);
+          internal.tx_timer_internal_remaining_ticks = internal.tx_timer_internal_re_initialize_ticks;
+        }
+      }
+
+      kernel.timers.erase(std::remove_if(kernel.timers.begin(), kernel.timers.end(), [](TX_TIMER* timer) { return 0 == timer->tx_timer_internal.tx_timer_internal_remaining_ticks; }), kernel.timers.end());
+    }
+
+    t_in_timer = true;
+
+    for (TX_TIMER* timer : expired)
+    {
+      timer->tx_timer_internal.tx_timer_internal_timeout_function(timer->tx_timer_internal.tx_timer_internal_timeout_param);
+    }
+
+    t_in_timer = false;
+    expired.clear();
+  }
+}
+
+/**
+ * @brief  仿真内核 线程外壳 (执行线程入口并在返回后标记完成)
+ *
+ * @param  thread 线程控制块
+ */
+inline void thread_shell(TX_THREAD* thread)
+{
+  t_current = thread;
+  thread->tx_thread_entry(thread->tx_thread_entry_parameter);
+
+  std::unique_lock<std::recursive_mutex> lock(state().lock);
+  thread->tx_thread_state = TX_COMPLETED;
+}
+} /* namespace host */
+} /* namespace kernel */
+} /* namespace system */
+} /* namespace QAQ */
+
+// 重定向调试外设与上下文判断 (须在使用它们的头文件之前)
+#undef DWT
+#undef CoreDebug
+#define DWT       (&QAQ::system::kernel::host::g_dwt)
+#define CoreDebug (&QAQ::system::kernel::host::g_core_debug)
+
+#undef QAQ_IS_IN_ISR
+#undef QAQ_IS_IN_TIMER
+#define QAQ_IS_IN_ISR   (QAQ::system::kernel::host::t_in_isr)
+#define QAQ_IS_IN_TIMER (QAQ::system::kernel::host::t_in_timer)
+
+/* ThreadX 仿真实现 */
+extern "C"
+{
+  UINT _tx_thread_interrupt_disable(VOID)
+  {
+    QAQ::system::kernel::host::state().lock.lock();
+    return 0;
+  }
+
+  VOID _tx_thread_interrupt_restore(UINT)
+  {
+    QAQ::system::kernel::host::state().lock.unlock();
+  }
+
+  ULONG _tx_time_get(VOID)
+  {
+    std::unique_lock<std::recursive_mutex> lock(QAQ::system::kernel::host::state().lock);
+    return QAQ::system::kernel::host::state().ticks;
+  }
+
+  /* 线程 */
+  UINT _tx_thread_create(TX_THREAD* thread_ptr, CHAR* name_ptr, VOID (*entry_function)(ULONG), ULONG entry_input, VOID* stack_start, ULONG stack_size, UINT priority, UINT preempt_threshold, ULONG, UINT auto_start)
+  {
+    memset(thread_ptr, 0, sizeof(TX_THREAD));
+    thread_ptr->tx_thread_name                 = name_ptr;
+    thread_ptr->tx_thread_entry                = entry_function;
+    thread_ptr->tx_thread_entry_parameter      = entry_input;
+    thread_ptr->tx_thread_stack_start          = stack_start;
+    thread_ptr->tx_thread_stack_size           = stack_size;
+    thread_ptr->tx_thread_stack_end            = static_cast<UCHAR*>(stack_start) + stack_size - 1;
+    thread_ptr->tx_thread_stack_ptr            = thread_ptr->tx_thread_stack_end;
+    thread_ptr->tx_thread_stack_highest_ptr    = thread_ptr->tx_thread_stack_end;
+    thread_ptr->tx_thread_priority             = priority;
+    thread_ptr->tx_thread_preempt_threshold    = preempt_threshold;
+    thread_ptr->tx_thread_state                = TX_SUSPENDED;
+
+    return (TX_AUTO_START == auto_start) ? _tx_thread_resume(thread_ptr) : TX_SUCCESS;
+  }
+
+  UINT _tx_thread_resume(TX_THREAD* thread_ptr)
+  {
+    std::unique_lock<std::recursive_mutex> lock(QAQ::system::kernel::host::state().lock);
+
+    // 首次恢复时启动主机线程; 已启动的线程不支持挂起，恢复视为成功
+    if (TX_SUSPENDED == thread_ptr->tx_thread_state && 0 == thread_ptr->tx_thread_run_count)
+    {
+      thread_ptr->tx_thread_run_count = 1;
+      std::thread(QAQ::system::kernel::host::thread_shell, thread_ptr).detach();
+    }
+
+    thread_ptr->tx_thread_state = TX_READY;
+    return TX_SUCCESS;
+  }
+
+  UINT _tx_thread_suspend(TX_THREAD*)
+  {
+    return TX_SUCCESS;
+  }
+
+  UINT _tx_thread_terminate(TX_THREAD* thread_ptr)
+  {
+    thread_ptr->tx_thread_state = TX_TERMINATED;
+    return TX_SUCCESS;
+  }
+
+  UINT _tx_thread_reset(TX_THREAD*)
+  {
+    return TX_NOT_DONE;
+  }
+
+  UINT _tx_thread_delete(TX_THREAD* thread_ptr)
+  {
+    return TX_SUCCESS;
+  }
+
+  UINT _tx_thread_priority_change(TX_THREAD* thread_ptr, UINT new_priority, UINT* old_priority)
+  {
+    if (old_priority)
+    {
+      *old_priority = thread_ptr->tx_thread_priority;
+    }
+
+    thread_ptr->tx_thread_priority = new_priority;
+    return TX_SUCCESS;
+  }
+
+  UINT _tx_thread_stack_error_notify(VOID (*)(TX_THREAD*))
+  {
+    return TX_SUCCESS;
+  }
+
+  TX_THREAD* _tx_thread_identify(VOID)
+  {
+    TX_THREAD* current = QAQ::system::kernel::host::t_current;
+    return (nullptr != current) ? current : &QAQ::system::kernel::host::t_foreign;
+  }
+
+  UINT _tx_thread_sleep(ULONG timer_ticks)
+  {
+    std::this_thread::sleep_for(std::chrono::milliseconds(static_cast<uint64_t>(timer_ticks) * 1000 / TX_TIMER_TICKS_PER_SECOND));
+    return TX_SUCCESS;
+  }
+
+  VOID _tx_thread_relinquish(VOID)
+  {
+    std::this_thread::yield();
+  }
+
+  /* 事件标志 */
+  UINT _tx_event_flags_create(TX_EVENT_FLAGS_GROUP* group_ptr, CHAR* name_ptr)
+  {
+    memset(group_ptr, 0, sizeof(TX_EVENT_FLAGS_GROUP));
+    group_ptr->tx_event_flags_group_name = name_ptr;
+    return TX_SUCCESS;
+  }
+
+  UINT _tx_event_flags_delete(TX_EVENT_FLAGS_GROUP* group_ptr)
+  {
+    return TX_SUCCESS;
+  }
+
+  UINT _tx_event_flags_get(TX_EVENT_FLAGS_GROUP* group_ptr, ULONG requested_flags, UINT get_option, ULONG* actual_flags_ptr, ULONG wait_option)
+  {
+    QAQ::system::kernel::host::State&       kernel = QAQ::system::kernel::host::state();
+    std::unique_lock<std::recursive_mutex>  lock(kernel.lock);
+    QAQ::system::kernel::host::Event_Waiter waiter = { group_ptr, requested_flags, get_option, 0, false };
+
+    if (!QAQ::system::kernel::host::event_try_satisfy(waiter) && TX_NO_WAIT != wait_option)
+    {
+      kernel.event_waiters.push_back(&waiter);
+      QAQ::system::kernel::host::wait(lock, wait_option, [&waiter]() { return waiter.satisfied; });
+      kernel.event_waiters.erase(std::find(kernel.event_waiters.begin(), kernel.event_waiters.end(), &waiter));
+    }
+
+    if (!waiter.satisfied)
+    {
+      return TX_NO_EVENTS;
+    }
+
+    *actual_flags_ptr = waiter.actual;
+    return TX_SUCCESS;
+  }
+
+  UINT _tx_event_flags_set(TX_EVENT_FLAGS_GROUP* group_ptr, ULONG flags_to_set, UINT set_option)
+  {
+    std::unique_lock<std::recursive_mutex> lock(QAQ::system::kernel::host::state().lock);
+
+    if (TX_AND == set_option)
+    {
+      group_ptr->tx_event_flags_group_current &= flags_to_set;
+    }
+    else
+    {
+      group_ptr->tx_event_flags_group_current |= flags_to_set;
+
+      // 按挂起顺序满足等待者
+      for (QAQ::system::kernel::host::Event_Waiter* waiter : QAQ::system::kernel::host::state().event_waiters)
+      {
+        if (group_ptr == waiter->group && !waiter->satisfied && QAQ::system::kernel::host::event_try_satisfy(*waiter))
+        {
+          ++QAQ::system::kernel::host::state().event_wakeups;
+        }
+      }
+
+      QAQ::system::kernel::host::state().changed.notify_all();
+    }
+
+    return TX_SUCCESS;
+  }
+
+  /* 消息队列 */
+  UINT _tx_queue_create(TX_QUEUE* queue_ptr, CHAR* name_ptr, UINT message_size, VOID* queue_start, ULONG queue_size)
+  {
+    const UINT capacity = static_cast<UINT>(queue_size / (message_size * sizeof(ULONG)));
+
+    memset(queue_ptr, 0, sizeof(TX_QUEUE));
+    queue_ptr->tx_queue_name              = name_ptr;
+    queue_ptr->tx_queue_message_size      = message_size;
+    queue_ptr->tx_queue_capacity          = capacity;
+    queue_ptr->tx_queue_available_storage = capacity;
+    queue_ptr->tx_queue_start             = static_cast<ULONG*>(queue_start);
+    queue_ptr->tx_queue_end               = queue_ptr->tx_queue_start + capacity * message_size;
+    queue_ptr->tx_queue_read              = queue_ptr->tx_queue_start;
+    queue_ptr->tx_queue_write             = queue_ptr->tx_queue_start;
+    return TX_SUCCESS;
+  }
+
+  UINT _tx_queue_delete(TX_QUEUE* queue_ptr)
+  {
+    return TX_SUCCESS;
+  }
+
+  UINT _tx_queue_send(TX_QUEUE* queue_ptr, VOID* source_ptr, ULONG wait_option)
+  {
+    std::unique_lock<std::recursive_mutex> lock(QAQ::system::kernel::host::state().lock);
+
+    if (!QAQ::system::kernel::host::wait(lock, wait_option, [queue_ptr]() { return 0 != queue_ptr->tx_queue_available_storage; }))
+    {
+      return TX_QUEUE_FULL;
+    }
+
+    memcpy(queue_ptr->tx_queue_write, source_ptr, queue_ptr->tx_queue_message_size * sizeof(ULONG));
+    queue_ptr->tx_queue_write += queue_ptr->tx_queue_message_size;
+
+    if (queue_ptr->tx_queue_write == queue_ptr->tx_queue_end)
+    {
+      queue_ptr->tx_queue_write = queue_ptr->tx_queue_start;
+    }
+
+    --queue_ptr->tx_queue_available_storage;
+    ++queue_ptr->tx_queue_enqueued;
+    QAQ::system::kernel::host::state().changed.notify_all();
+    return TX_SUCCESS;
+  }
+
+  UINT _tx_queue_front_send(TX_QUEUE* queue_ptr, VOID* source_ptr, ULONG wait_option)
+  {
+    std::unique_lock<std::recursive_mutex> lock(QAQ::system::kernel::host::state().lock);
+
+    if (!QAQ::system::kernel::host::wait(lock, wait_option, [queue_ptr]() { return 0 != queue_ptr->tx_queue_available_storage; }))
+    {
+      return TX_QUEUE_FULL;
+    }
+
+    if (queue_ptr->tx_queue_read == queue_ptr->tx_queue_start)
+    {
+      queue_ptr->tx_queue_read = queue_ptr->tx_queue_end;
+    }
+
+    queue_ptr->tx_queue_read -= queue_ptr->tx_queue_message_size;
+    memcpy(queue_ptr->tx_queue_read, source_ptr, queue_ptr->tx_queue_message_size * sizeof(ULONG));
+
+    --queue_ptr->tx_queue_available_storage;
+    ++queue_ptr->tx_queue_enqueued;
+    QAQ::system::kernel::host::state().changed.notify_all();
+    return TX_SUCCESS;
+  }
+
+  UINT _tx_queue_receive(TX_QUEUE* queue_ptr, VOID* destination_ptr, ULONG wait_option)
+  {
+    std::unique_lock<std::recursive_mutex> lock(QAQ::system::kernel::host::state().lock);
+
+    if (!QAQ::system::kernel::host::wait(lock, wait_option, [queue_ptr]() { return 0 != queue_ptr->tx_queue_enqueued; }))
+    {
+      return TX_QUEUE_EMPTY;
+    }
+
+    memcpy(destination_ptr, queue_ptr->tx_queue_read, queue_ptr->tx_queue_message_size * sizeof(ULONG));
+    queue_ptr->tx_queue_read += queue_ptr->tx_queue_message_size;
+
+    if (queue_ptr->tx_queue_read == queue_ptr->tx_queue_end)
+    {
+      queue_ptr->tx_queue_read = queue_ptr->tx_queue_start;
+    }
+
+    ++queue_ptr->tx_queue_available_storage;
+    --queue_ptr->tx_queue_enqueued;
+    QAQ::system::kernel::host::state().changed.notify_all();
+    return TX_SUCCESS;
+  }
+
+  UINT _tx_queue_flush(TX_QUEUE* queue_ptr)
+  {
+    std::unique_lock<std::recursive_mutex> lock(QAQ::system::kernel::host::state().lock);
+
+    queue_ptr->tx_queue_read              = queue_ptr->tx_queue_start;
+    queue_ptr->tx_queue_write             = queue_ptr->tx_queue_start;
+    queue_ptr->tx_queue_enqueued          = 0;
+    queue_ptr->tx_queue_available_storage = queue_ptr->tx_queue_capacity;
+    QAQ::system::kernel::host::state().changed.notify_all();
+    return TX_SUCCESS;
+  }
+
+  /* 互斥锁 */
+  UINT _tx_mutex_create(TX_MUTEX* mutex_ptr, CHAR* name_ptr, UINT inherit)
+  {
+    memset(mutex_ptr, 0, sizeof(TX_MUTEX));
+    mutex_ptr->tx_mutex_name    = name_ptr;
+    mutex_ptr->tx_mutex_inherit = inherit;
+    return TX_SUCCESS;
+  }
+
+  UINT _tx_mutex_delete(TX_MUTEX* mutex_ptr)
+  {
+    return TX_SUCCESS;
+  }
+
+  UINT _tx_mutex_get(TX_MUTEX* mutex_ptr, ULONG wait_option)
+  {
+    std::unique_lock<std::recursive_mutex> lock(QAQ::system::kernel::host::state().lock);
+    TX_THREAD* const                       self = _tx_thread_identify();
+
+    if (self == mutex_ptr->tx_mutex_owner)
+    {
+      ++mutex_ptr->tx_mutex_ownership_count;
+      return TX_SUCCESS;
+    }
+
+    if (!QAQ::system::kernel::host::wait(lock, wait_option, [mutex_ptr]() { return nullptr == mutex_ptr->tx_mutex_owner; }))
+    {
+      return TX_NOT_AVAILABLE;
+    }
+
+    mutex_ptr->tx_mutex_owner           = self;
+    mutex_ptr->tx_mutex_ownership_count = 1;
+    return TX_SUCCESS;
+  }
+
+  UINT _tx_mutex_put(TX_MUTEX* mutex_ptr)
+  {
+    std::unique_lock<std::recursive_mutex> lock(QAQ::system::kernel::host::state().lock);
+
+    if (_tx_thread_identify() != mutex_ptr->tx_mutex_owner)
+    {
+      return TX_NOT_OWNED;
+    }
+
+    if (0 == --mutex_ptr->tx_mutex_ownership_count)
+    {
+      mutex_ptr->tx_mutex_owner = nullptr;
+      QAQ::system::kernel::host::state().changed.notify_all();
+    }
+
+    return TX_SUCCESS;
+  }
+
+  /* 信号量 */
+  UINT _tx_semaphore_create(TX_SEMAPHORE* semaphore_ptr, CHAR* name_ptr, ULONG initial_count)
+  {
+    memset(semaphore_ptr, 0, sizeof(TX_SEMAPHORE));
+    semaphore_ptr->tx_semaphore_name  = name_ptr;
+    semaphore_ptr->tx_semaphore_count = initial_count;
+    return TX_SUCCESS;
+  }
+
+  UINT _tx_semaphore_delete(TX_SEMAPHORE* semaphore_ptr)
+  {
+    return TX_SUCCESS;
+  }
+
+  UINT _tx_semaphore_get(TX_SEMAPHORE* semaphore_ptr, ULONG wait_option)
+  {
+    std::unique_lock<std::recursive_mutex> lock(QAQ::system::kernel::host::state().lock);
+
+    if (!QAQ::system::kernel::host::wait(lock, wait_option, [semaphore_ptr]() { return 0 != semaphore_ptr->tx_semaphore_count; }))
+    {
+      return TX_NO_INSTANCE;
+    }
+
+    --semaphore_ptr->tx_semaphore_count;
+    return TX_SUCCESS;
+  }
+
+  UINT _tx_semaphore_put(TX_SEMAPHORE* semaphore_ptr)
+  {
+    std::unique_lock<std::recursive_mutex> lock(QAQ::system::kernel::host::state().lock);
+
+    ++semaphore_ptr->tx_semaphore_count;
+    QAQ::system::kernel::host::state().changed.notify_all();
+    return TX_SUCCESS;
+  }
+
+  UINT _tx_semaphore_ceiling_put(TX_SEMAPHORE* semaphore_ptr, ULONG ceiling)
+  {
+    std::unique_lock<std::recursive_mutex> lock(QAQ::system::kernel::host::state().lock);
+
+    if (semaphore_ptr->tx_semaphore_count >= ceiling)
+    {
+      return TX_CEILING_EXCEEDED;
+    }
+
+    ++semaphore_ptr->tx_semaphore_count;
+    QAQ::system::kernel::host::state().changed.notify_all();
+    return TX_SUCCESS;
+  }
+
+  UINT _tx_semaphore_info_get(TX_SEMAPHORE* semaphore_ptr, CHAR** name, ULONG* current_value, TX_THREAD** first_suspended, ULONG* suspended_count, TX_SEMAPHORE** next_semaphore)
+  {
+    std::unique_lock<std::recursive_mutex> lock(QAQ::system::kernel::host::state().lock);
+
+    if (name)
+    {
+      *name = semaphore_ptr->tx_semaphore_name;
+    }
+
+    if (current_value)
+    {
+      *current_value = semaphore_ptr->tx_semaphore_count;
+    }
+
+    if (first_suspended)
+    {
+      *first_suspended = nullptr;
+    }
+
+    if (suspended_count)
+    {
+      *suspended_count = 0;
+    }
+
+    if (next_semaphore)
+    {
+      *next_semaphore = nullptr;
+    }
+
+    return TX_SUCCESS;
+  }
+
+  /* 块内存池 */
+  UINT _tx_block_pool_create(TX_BLOCK_POOL* pool_ptr, CHAR* name_ptr, ULONG block_size, VOID* pool_start, ULONG pool_size)
+  {
+    std::unique_lock<std::recursive_mutex> lock(QAQ::system::kernel::host::state().lock);
+    UCHAR*                                 block = static_cast<UCHAR*>(pool_start);
+
+    if (block_size < sizeof(UCHAR*) || pool_size < block_size)
+    {
+      return TX_SIZE_ERROR;
+    }
+
+    memset(pool_ptr, 0, sizeof(TX_BLOCK_POOL));
+    pool_ptr->tx_block_pool_name       = name_ptr;
+    pool_ptr->tx_block_pool_start      = block;
+    pool_ptr->tx_block_pool_size       = pool_size;
+    pool_ptr->tx_block_pool_block_size = block_size;
+    pool_ptr->tx_block_pool_total      = pool_size / block_size;
+    pool_ptr->tx_block_pool_available  = pool_ptr->tx_block_pool_total;
+
+    // 空闲块链表 (链表指针保存在空闲块内)
+    for (UINT i = pool_ptr->tx_block_pool_total; 0 != i; --i)
+    {
+      UCHAR* current = block + (i - 1) * block_size;
+
+      memcpy(current, &pool_ptr->tx_block_pool_available_list, sizeof(UCHAR*));
+      pool_ptr->tx_block_pool_available_list = current;
+    }
+
+    QAQ::system::kernel::host::state().block_pools.push_back(pool_ptr);
+    return TX_SUCCESS;
+  }
+
+  UINT _tx_block_pool_delete(TX_BLOCK_POOL* pool_ptr)
+  {
+    std::unique_lock<std::recursive_mutex> lock(QAQ::system::kernel::host::state().lock);
+    std::vector<TX_BLOCK_POOL*>&           pools = QAQ::system::kernel::host::state().block_pools;
+
+    pools.erase(std::remove(pools.begin(), pools.end(), pool_ptr), pools.end());
+    QAQ::system::kernel::host::state().changed.notify_all();
+    return TX_SUCCESS;
+  }
+
+  UINT _tx_block_allocate(TX_BLOCK_POOL* pool_ptr, VOID** block_ptr, ULONG wait_option)
+  {
+    std::unique_lock<std::recursive_mutex> lock(QAQ::system::kernel::host::state().lock);
+
+    if (!QAQ::system::kernel::host::wait(lock, wait_option, [pool_ptr]() { return 0 != pool_ptr->tx_block_pool_available; }))
+    {
+      return TX_NO_MEMORY;
+    }
+
+    UCHAR* block = pool_ptr->tx_block_pool_available_list;
+
+    memcpy(&pool_ptr->tx_block_pool_available_list, block, sizeof(UCHAR*));
+    --pool_ptr->tx_block_pool_available;
+    *block_ptr = block;
+    return TX_SUCCESS;
+  }
+
+  UINT _tx_block_release(VOID* block_ptr)
+  {
+    std::unique_lock<std::recursive_mutex> lock(QAQ::system::kernel::host::state().lock);
+    UCHAR*                                 block = static_cast<UCHAR*>(block_ptr);
+
+    for (TX_BLOCK_POOL* pool_ptr : QAQ::system::kernel::host::state().block_pools)
+    {
+      if (block >= pool_ptr->tx_block_pool_start && block < pool_ptr->tx_block_pool_start + pool_ptr->tx_block_pool_size)
+      {
+        memcpy(block, &pool_ptr->tx_block_pool_available_list, sizeof(UCHAR*));
+        pool_ptr->tx_block_pool_available_list = block;
+        ++pool_ptr->tx_block_pool_available;
+        QAQ::system::kernel::host::state().changed.notify_all();
+        return TX_SUCCESS;
+      }
+    }
+
+    return TX_PTR_ERROR;
+  }
+
+  UINT _tx_block_pool_info_get(TX_BLOCK_POOL* pool_ptr, CHAR** name, ULONG* available_blocks, ULONG* total_blocks, TX_THREAD** first_suspended, ULONG* suspended_count, TX_BLOCK_POOL** next_pool)
+  {
+    std::unique_lock<std::recursive_mutex> lock(QAQ::system::kernel::host::state().lock);
+
+    if (name)
+    {
+      *name = pool_ptr->tx_block_pool_name;
+    }
+
+    if (available_blocks)
+    {
+      *available_blocks = pool_ptr->tx_block_pool_available;
+    }
+
+    if (total_blocks)
+    {
+      *total_blocks = pool_ptr->tx_block_pool_total;
+    }
+
+    if (first_suspended)
+    {
+      *first_suspended = nullptr;
+    }
+
+    if (suspended_count)
+    {
+      *suspended_count = 0;
+    }
+
+    if (next_pool)
+    {
+      *next_pool = nullptr;
+    }
+
+    return TX_SUCCESS;
+  }
+
+  /* 字节内存池 */
+  UINT _tx_byte_pool_create(TX_BYTE_POOL* pool_ptr, CHAR* name_ptr, VOID* pool_start, ULONG pool_size)
+  {
+    std::unique_lock<std::recursive_mutex> lock(QAQ::system::kernel::host::state().lock);
+
+    memset(pool_ptr, 0, sizeof(TX_BYTE_POOL));
+    pool_ptr->tx_byte_pool_name      = name_ptr;
+    pool_ptr->tx_byte_pool_start     = static_cast<UCHAR*>(pool_start);
+    pool_ptr->tx_byte_pool_size      = pool_size;
+    pool_ptr->tx_byte_pool_available = pool_size;
+    pool_ptr->tx_byte_pool_fragments = 1;
+
+    QAQ::system::kernel::host::state().byte_pools[pool_ptr].clear();
+    return TX_SUCCESS;
+  }
+
+  UINT _tx_byte_pool_delete(TX_BYTE_POOL* pool_ptr)
+  {
+    std::unique_lock<std::recursive_mutex> lock(QAQ::system::kernel::host::state().lock);
+
+    QAQ::system::kernel::host::state().byte_pools.erase(pool_ptr);
+    QAQ::system::kernel::host::state().changed.notify_all();
+    return TX_SUCCESS;
+  }
+
+  UINT _tx_byte_allocate(TX_BYTE_POOL* pool_ptr, VOID** memory_ptr, ULONG memory_size, ULONG wait_option)
+  {
+    std::unique_lock<std::recursive_mutex> lock(QAQ::system::kernel::host::state().lock);
+    std::map<UCHAR*, ULONG>&               used  = QAQ::system::kernel::host::state().byte_pools[pool_ptr];
+    const ULONG                            size  = (memory_size + sizeof(ALIGN_TYPE) - 1) & ~static_cast<ULONG>(sizeof(ALIGN_TYPE) - 1);
+    UCHAR*                                 found = nullptr;
+
+    // 首次适配: 在已分配区间之间查找足够大的空隙
+    auto fit = [pool_ptr, &used, size, &found]() {
+      UCHAR* start = pool_ptr->tx_byte_pool_start;
+
+      for (const auto& range : used)
+      {
+        if (static_cast<ULONG>(range.first - start) >= size)
+        {
+          break;
+        }
+
+        start = range.first + range.second;
+      }
+
+      if (static_cast<ULONG>(pool_ptr->tx_byte_pool_start + pool_ptr->tx_byte_pool_size - start) >= size)
+      {
+        found = start;
+      }
+
+      return nullptr != found;
+    };
+
+    if (0 == size || !QAQ::system::kernel::host::wait(lock, wait_option, fit))
+    {
+      return TX_NO_MEMORY;
+    }
+
+    used[found]                       = size;
+    pool_ptr->tx_byte_pool_available -= size;
+    *memory_ptr                       = found;
+    return TX_SUCCESS;
+  }
+
+  UINT _tx_byte_release(VOID* memory_ptr)
+  {
+    std::unique_lock<std::recursive_mutex> lock(QAQ::system::kernel::host::state().lock);
+
+    for (auto& pool : QAQ::system::kernel::host::state().byte_pools)
+    {
+      auto range = pool.second.find(static_cast<UCHAR*>(memory_ptr));
+
+      if (pool.second.end() != range)
+      {
+        pool.first->tx_byte_pool_available += range->second;
+        pool.second.erase(range);
+        QAQ::system::kernel::host::state().changed.notify_all();
+        return TX_SUCCESS;
+      }
+    }
+
+    return TX_PTR_ERROR;
+  }
+
+  UINT _tx_byte_pool_info_get(TX_BYTE_POOL* pool_ptr, CHAR** name, ULONG* available_bytes, ULONG* fragments, TX_THREAD** first_suspended, ULONG* suspended_count, TX_BYTE_POOL** next_pool)
+  {
+    std::unique_lock<std::recursive_mutex> lock(QAQ::system::kernel::host::state().lock);
+
+    if (name)
+    {
+      *name = pool_ptr->tx_byte_pool_name;
+    }
+
+    if (available_bytes)
+    {
+      *available_bytes = pool_ptr->tx_byte_pool_available;
+    }
+
+    if (fragments)
+    {
+      *fragments = QAQ::system::kernel::host::state().byte_pools[pool_ptr].size() + 1;
+    }
+
+    if (first_suspended)
+    {
+      *first_suspended = nullptr;
+    }
+
+    if (suspended_count)
+    {
+      *suspended_count = 0;
+    }
+
+    if (next_pool)
+    {
+      *next_pool = nullptr;
+    }
+
+    return TX_SUCCESS;
+  }
+
+  /* 软件定时器 */
+  UINT _tx_timer_create(TX_TIMER* timer_ptr, CHAR* name_ptr, VOID (*expiration_function)(ULONG), ULONG expiration_input, ULONG initial_ticks, ULONG reschedule_ticks, UINT auto_activate)
+  {
+    memset(timer_ptr, 0, sizeof(TX_TIMER));
+    timer_ptr->tx_timer_name                                            = name_ptr;
+    timer_ptr->tx_timer_internal.tx_timer_internal_remaining_ticks      = initial_ticks;
+    timer_ptr->tx_timer_internal.tx_timer_internal_re_initialize_ticks  = reschedule_ticks;
+    timer_ptr->tx_timer_internal.tx_timer_internal_timeout_function     = expiration_function;
+    timer_ptr->tx_timer_internal.tx_timer_internal_timeout_param        = expiration_input;
+
+    return (TX_AUTO_ACTIVATE == auto_activate) ? _tx_timer_activate(timer_ptr) : TX_SUCCESS;
+  }
+
+  UINT _tx_timer_delete(TX_TIMER* timer_ptr)
+  {
+    _tx_timer_deactivate(timer_ptr);
+    return TX_SUCCESS;
+  }
+
+  UINT _tx_timer_activate(TX_TIMER* timer_ptr)
+  {
+    std::unique_lock<std::recursive_mutex> lock(QAQ::system::kernel::host::state().lock);
+    std::vector<TX_TIMER*>&                timers = QAQ::system::kernel::host::state().timers;
+
+    if (0 == timer_ptr->tx_timer_internal.tx_timer_internal_remaining_ticks)
+    {
+      return TX_ACTIVATE_ERROR;
+    }
+
+    if (timers.end() == std::find(timers.begin(), timers.end(), timer_ptr))
+    {
+      timers.push_back(timer_ptr);
+    }
+
+    return TX_SUCCESS;
+  }
+
+  UINT _tx_timer_deactivate(TX_TIMER* timer_ptr)
+  {
+    std::unique_lock<std::recursive_mutex> lock(QAQ::system::kernel::host::state().lock);
+    std::vector<TX_TIMER*>&                timers = QAQ::system::kernel::host::state().timers;
+
+    timers.erase(std::remove(timers.begin(), timers.end(), timer_ptr), timers.end());
+    return TX_SUCCESS;
+  }
+
+  UINT _tx_timer_change(TX_TIMER* timer_ptr, ULONG initial_ticks, ULONG reschedule_ticks)
+  {
+    std::unique_lock<std::recursive_mutex> lock(QAQ::system::kernel::host::state().lock);
+
+    timer_ptr->tx_timer_internal.tx_timer_internal_remaining_ticks     = initial_ticks;
+    timer_ptr->tx_timer_internal.tx_timer_internal_re_initialize_ticks = reschedule_ticks;
+    return TX_SUCCESS;
+  }
+
+  UINT _tx_timer_info_get(TX_TIMER* timer_ptr, CHAR** name, UINT* active, ULONG* remaining_ticks, ULONG* reschedule_ticks, TX_TIMER** next_timer)
+  {
+    std::unique_lock<std::recursive_mutex> lock(QAQ::system::kernel::host::state().lock);
+    std::vector<TX_TIMER*>&                timers = QAQ::system::kernel::host::state().timers;
+
+    if (name)
+    {
+      *name = timer_ptr->tx_timer_name;
+    }
+
+    if (active)
+    {
+      *active = (timers.end() != std::find(timers.begin(), timers.end(), timer_ptr)) ? TX_TRUE : TX_FALSE;
+    }
+
+    if (remaining_ticks)
+    {
+      *remaining_ticks = timer_ptr->tx_timer_internal.tx_timer_internal_remaining_ticks;
+    }
+
+    if (reschedule_ticks)
+    {
+      *reschedule_ticks = timer_ptr->tx_timer_internal.tx_timer_internal_re_initialize_ticks;
+    }
+
+    if (next_timer)
+    {
+      *next_timer = nullptr;
+    }
+
+    return TX_SUCCESS;
+  }
+}
+
+#endif /* __HOST_KERNEL_HPP__ */
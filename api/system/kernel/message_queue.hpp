@@ -29,12 +29,24 @@ class Message_Queue final
   QAQ_NO_COPY_MOVE(Message_Queue)
 
 private:
+  /// @brief 消息字数 (ThreadX 消息大小以 ULONG 为单位)
+  static constexpr UINT              message_words = (sizeof(T) + sizeof(ULONG) - 1) / sizeof(ULONG);
+  // 消息大小检查 - ThreadX 单条消息最大 16 字
+  static_assert(message_words <= TX_16_ULONG, "Message_Queue element type must be no larger than 16 words");
+
+  /// @brief 消息槽 (按字收发，消息不足整字的部分由槽补齐，避免越界读写)
+  union Slot
+  {
+    T     message;
+    ULONG words[message_words];
+  };
+
   /// @brief 消息队列默认名称
   static constexpr const char* const default_name = "Message_Queue";
   /// @brief 消息队列句柄
   TX_QUEUE                           m_queue;
   /// @brief 消息队列缓冲区
-  uint8_t                            m_buffer[sizeof(T) * size] QAQ_ALIGN(32);
+  ULONG                              m_buffer[message_words * size] QAQ_ALIGN(32);
 
 public:
   /// @brief 消息队列 状态
@@ -54,10 +66,10 @@ public:
   explicit QAQ_O3 Message_Queue(const char* name = default_name)
   {
 #if (SYSTEM_ERROR_LOG_ENABLE && MESSAGE_QUEUE_ERROR_LOG_ENABLE)
-    const UINT status = tx_queue_create(&m_queue, const_cast<CHAR*>(name), sizeof(T), m_buffer, sizeof(m_buffer));
+    const UINT status = tx_queue_create(&m_queue, const_cast<CHAR*>(name), message_words, m_buffer, sizeof(m_buffer));
     system::System_Monitor::check_status(status, "Message_Queue create failed");
 #else
-    tx_queue_create(&m_queue, const_cast<CHAR*>(name), sizeof(T), m_buffer, sizeof(m_buffer));
+    tx_queue_create(&m_queue, const_cast<CHAR*>(name), message_words, m_buffer, sizeof(m_buffer));
 #endif /* (SYSTEM_ERROR_LOG_ENABLE && MESSAGE_QUEUE_ERROR_LOG_ENABLE) */
   }
 
@@ -75,7 +87,9 @@ public:
       timeout = 0;
     }
 
-    const UINT status = tx_queue_send(&m_queue, const_cast<T*>(&message), timeout);
+    Slot slot;
+    slot.message      = message;
+    const UINT status = tx_queue_send(&m_queue, slot.words, timeout);
     if (status == TX_SUCCESS)
     {
       return Status::SUCCESS;
@@ -107,7 +121,9 @@ public:
       timeout = 0;
     }
 
-    const UINT status = tx_queue_front_send(&m_queue, const_cast<T*>(&message), timeout);
+    Slot slot;
+    slot.message      = message;
+    const UINT status = tx_queue_front_send(&m_queue, slot.words, timeout);
     if (status == TX_SUCCESS)
     {
       return Status::SUCCESS;
@@ -139,9 +155,11 @@ public:
       timeout = 0;
     }
 
-    const UINT status = tx_queue_receive(&m_queue, &message, timeout);
+    Slot       slot;
+    const UINT status = tx_queue_receive(&m_queue, slot.words, timeout);
     if (status == TX_SUCCESS)
     {
+      message = slot.message;
       return Status::SUCCESS;
     }
     else if (status == TX_QUEUE_EMPTY)
@@ -185,7 +203,7 @@ public:
    */
   uint32_t QAQ_O3 available() const
   {
-    return m_queue.tx_queue_available_storage / sizeof(T);
+    return m_queue.tx_queue_available_storage;
   }
 
   /**
@@ -195,7 +213,7 @@ public:
    */
   uint32_t QAQ_O3 enqueued() const
   {
-    return m_queue.tx_queue_enqueued / sizeof(T);
+    return m_queue.tx_queue_enqueued;
   }
 
   /**
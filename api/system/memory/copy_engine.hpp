@@ -0,0 +1,562 @@
+#ifndef __COPY_ENGINE_HPP__
+#define __COPY_ENGINE_HPP__
+
+#include "fast_memory.hpp"
+
+/// @brief 名称空间 QAQ
+namespace QAQ
+{
+/// @brief 名称空间 系统
+namespace system
+{
+/// @brief 名称空间 内存
+namespace memory
+{
+/// @brief 拷贝完成回调函数参数类型
+using Copy_Callback_Args_t   = void*;
+/// @brief 拷贝完成回调函数类型 (参数, 是否成功)，在完成上下文 (目标板为DMA中断) 中执行
+using Copy_Callback_Func_t   = void (*)(Copy_Callback_Args_t, bool);
+/// @brief 拷贝引擎后端完成回调函数类型 (参数, 通道, 是否成功)
+using Copy_Completion_Func_t = void (*)(void*, uint32_t, bool);
+
+/**
+ * @brief 拷贝引擎 拷贝段 (分散聚集列表的元素)
+ */
+struct Copy_Segment
+{
+  void*       dest; /* 目标地址 */
+  const void* src;  /* 源地址 */
+  uint32_t    size; /* 拷贝大小 */
+};
+
+/**
+ * @brief 拷贝引擎 任务状态
+ */
+enum class Copy_Status : uint8_t
+{
+  Queued,  /* 排队中 */
+  Running, /* 传输中 */
+  Done,    /* 已完成 */
+  Failed,  /* 传输失败 */
+};
+
+/**
+ * @brief 拷贝引擎 完成令牌
+ */
+struct Copy_Token
+{
+  /// @brief 同步完成 (未进入队列) 的任务索引
+  static constexpr uint16_t SYNC_INDEX = UINT16_MAX;
+
+  uint16_t index      = SYNC_INDEX; /* 任务槽索引 */
+  uint16_t generation = 0;          /* 任务槽代数 */
+};
+
+/**
+ * @brief 拷贝引擎 (异步内存到内存拷贝，任务排队后分发到后端通道池)
+ *
+ * @note  后端需提供:
+ *        - static constexpr uint32_t CHANNELS        通道数
+ *        - static constexpr uint32_t MAX_SEGMENT     单次传输最大字节数 (超出部分由引擎分块)
+ *        - bool init(Copy_Completion_Func_t, void*)  初始化并绑定完成回调
+ *        - bool accessible(const void*, uint32_t)    地址区间是否可被后端访问
+ *        - bool start(uint32_t, void*, const void*, uint32_t)  在指定通道上启动一次传输
+ *
+ * @note  每段传输前清除源区间缓存、清除并失效目标区间缓存，完成后失效目标区间缓存;
+ *        传输期间CPU不得访问目标区间，目标区间应按缓存行对齐 (首尾共享缓存行中的CPU数据会被丢弃);
+ *        分散聚集列表在任务完成前必须保持有效; 同一任务的各段按顺序执行，不同任务在各通道上并行
+ *
+ * @tparam Backend   传输后端
+ * @tparam Max_Jobs  最大在途任务数
+ */
+template <typename Backend, uint16_t Max_Jobs = 16>
+class Copy_Engine final
+{
+  static_assert(0 < Max_Jobs && Max_Jobs < Copy_Token::SYNC_INDEX, "Copy_Engine job count out of range");
+  static_assert(0 < Backend::CHANNELS && Backend::CHANNELS < UINT8_MAX, "Copy_Engine channel count out of range");
+
+  // 禁止拷贝和移动
+  QAQ_NO_COPY_MOVE(Copy_Engine)
+
+public:
+  /// @brief 默认异步阈值 (小于该大小的 copy() 直接同步拷贝)
+  static constexpr uint32_t DEFAULT_ASYNC_THRESHOLD = 2048;
+
+private:
+  /// @brief 中断保护器类型
+  using Irq_Guard = system_internal::memory_internal::port::Irq_Guard;
+
+  /// @brief 空闲通道标记
+  static constexpr uint16_t NO_JOB = UINT16_MAX;
+
+  /// @brief 拷贝任务
+  struct Job
+  {
+    const Copy_Segment*  segments;   /* 分散聚集列表 */
+    Copy_Segment         single;     /* 单段任务的内联段 */
+    uint32_t             count;      /* 段数 */
+    uint32_t             index;      /* 当前段 */
+    uint32_t             offset;     /* 当前段内已完成字节数 */
+    uint32_t             chunk;      /* 当前传输字节数 */
+    Copy_Callback_Func_t callback;   /* 完成回调函数 */
+    Copy_Callback_Args_t arg;        /* 完成回调函数参数 */
+    uint16_t             generation; /* 任务槽代数 */
+    Copy_Status          status;     /* 任务状态 */
+  };
+
+  /// @brief 传输后端
+  Backend  m_backend;
+  /// @brief 任务槽
+  Job      m_jobs[Max_Jobs]          = {};
+  /// @brief 空闲任务槽队列 (先进先出，延迟复用以保留已完成状态)
+  uint16_t m_free[Max_Jobs]          = {};
+  /// @brief 待分发任务队列
+  uint16_t m_queue[Max_Jobs]         = {};
+  /// @brief 各通道正在执行的任务
+  uint16_t m_active[Backend::CHANNELS];
+  /// @brief 空闲任务槽队列头
+  uint16_t m_free_head               = 0;
+  /// @brief 空闲任务槽数量
+  uint16_t m_free_count              = Max_Jobs;
+  /// @brief 待分发任务队列头
+  uint16_t m_queue_head              = 0;
+  /// @brief 待分发任务数量
+  uint16_t m_queue_count             = 0;
+  /// @brief 异步阈值
+  uint32_t m_async_threshold         = DEFAULT_ASYNC_THRESHOLD;
+
+  /**
+   * @brief  拷贝引擎 后端完成回调
+   *
+   * @param  arg      拷贝引擎
+   * @param  channel  通道
+   * @param  ok       是否成功
+   */
+  static void completion_handler(void* arg, uint32_t channel, bool ok)
+  {
+    static_cast<Copy_Engine*>(arg)->on_complete(channel, ok);
+  }
+
+  /**
+   * @brief  拷贝引擎 在通道上启动任务的当前段 (跳过空段)
+   *
+   * @param  channel  通道
+   * @return true     已启动或任务已无剩余段
+   * @return false    后端启动失败
+   */
+  bool start_segment(uint32_t channel)
+  {
+    Job& job = m_jobs[m_active[channel]];
+
+    while (job.index < job.count && job.offset >= job.segments[job.index].size)
+    {
+      ++job.index;
+      job.offset = 0;
+    }
+
+    if (job.index >= job.count)
+    {
+      job.chunk = 0;
+      return true;
+    }
+
+    const Copy_Segment& segment = job.segments[job.index];
+    uint32_t            remain  = segment.size - job.offset;
+    uint8_t*            dest    = static_cast<uint8_t*>(segment.dest) + job.offset;
+    const uint8_t*      src     = static_cast<const uint8_t*>(segment.src) + job.offset;
+
+    job.chunk                   = (remain < Backend::MAX_SEGMENT) ? remain : Backend::MAX_SEGMENT;
+
+    system_internal::memory_internal::port::cache_clean(src, job.chunk);
+    system_internal::memory_internal::port::cache_clean_invalidate(dest, job.chunk);
+    system_internal::memory_internal::port::sync_barrier();
+
+    return m_backend.start(channel, dest, src, job.chunk);
+  }
+
+  /**
+   * @brief  拷贝引擎 结束通道上的任务并回收任务槽 (需在中断保护内调用)
+   *
+   * @param  channel  通道
+   * @param  ok       是否成功
+   * @param  job      通道上的任务
+   */
+  void finish(uint32_t channel, bool ok, Job& job)
+  {
+    job.status                                      = ok ? Copy_Status::Done : Copy_Status::Failed;
+    m_free[(m_free_head + m_free_count) % Max_Jobs] = m_active[channel];
+    ++m_free_count;
+    m_active[channel]                               = NO_JOB;
+  }
+
+  /**
+   * @brief  拷贝引擎 将一个排队任务分发到空闲通道 (需在中断保护内调用)
+   *
+   * @param  callback  启动即结束任务的回调函数输出
+   * @param  arg       启动即结束任务的回调参数输出
+   * @param  ok        启动即结束任务是否成功输出
+   * @return true      有任务启动即结束 (需在保护外执行回调后继续分发)
+   * @return false     无任务可分发或已全部启动
+   */
+  bool dispatch(Copy_Callback_Func_t& callback, Copy_Callback_Args_t& arg, bool& ok)
+  {
+    for (uint32_t channel = 0; channel < Backend::CHANNELS && 0 < m_queue_count; ++channel)
+    {
+      if (NO_JOB != m_active[channel])
+      {
+        continue;
+      }
+
+      uint16_t index    = m_queue[m_queue_head];
+      m_queue_head      = (m_queue_head + 1) % Max_Jobs;
+      --m_queue_count;
+
+      Job& job          = m_jobs[index];
+      job.status        = Copy_Status::Running;
+      m_active[channel] = index;
+
+      ok                = start_segment(channel);
+
+      if (!ok || 0 == job.chunk)
+      {
+        finish(channel, ok, job);
+        callback = job.callback;
+        arg      = job.arg;
+        return true;
+      }
+    }
+
+    return false;
+  }
+
+  /**
+   * @brief  拷贝引擎 分发排队任务，并在保护外执行启动即结束任务的回调
+   */
+  void dispatch_all(void)
+  {
+    while (true)
+    {
+      Copy_Callback_Func_t callback = nullptr;
+      Copy_Callback_Args_t arg      = nullptr;
+      bool                 ok       = false;
+      bool                 finished = false;
+
+      {
+        Irq_Guard guard;
+        finished = dispatch(callback, arg, ok);
+      }
+
+      if (!finished)
+      {
+        return;
+      }
+
+      if (nullptr != callback)
+      {
+        callback(arg, ok);
+      }
+    }
+  }
+
+  /**
+   * @brief  拷贝引擎 任务入队
+   *
+   * @param  segments  分散聚集列表 (single 非空时忽略)
+   * @param  count     段数
+   * @param  single    单段任务 (拷贝到任务槽内，可为nullptr)
+   * @param  callback  完成回调函数
+   * @param  arg       完成回调函数参数
+   * @param  token     完成令牌输出 (可为nullptr)
+   * @return true      入队成功
+   * @return false     任务槽已满
+   */
+  bool enqueue(const Copy_Segment* segments, uint32_t count, const Copy_Segment* single, Copy_Callback_Func_t callback, Copy_Callback_Args_t arg, Copy_Token* token)
+  {
+    {
+      Irq_Guard guard;
+
+      if (0 == m_free_count)
+      {
+        return false;
+      }
+
+      uint16_t index = m_free[m_free_head];
+      m_free_head    = (m_free_head + 1) % Max_Jobs;
+      --m_free_count;
+
+      Job& job       = m_jobs[index];
+
+      if (nullptr != single)
+      {
+        job.single = *single;
+        segments   = std::addressof(job.single);
+        count      = 1;
+      }
+
+      job.segments = segments;
+      job.count    = count;
+      job.index    = 0;
+      job.offset   = 0;
+      job.chunk    = 0;
+      job.callback = callback;
+      job.arg      = arg;
+      job.status   = Copy_Status::Queued;
+      ++job.generation;
+
+      m_queue[(m_queue_head + m_queue_count) % Max_Jobs] = index;
+      ++m_queue_count;
+
+      if (nullptr != token)
+      {
+        token->index      = index;
+        token->generation = job.generation;
+      }
+    }
+
+    dispatch_all();
+    return true;
+  }
+
+  /**
+   * @brief  拷贝引擎 通道传输完成处理 (完成上下文中执行)
+   *
+   * @param  channel  通道
+   * @param  ok       是否成功
+   */
+  void on_complete(uint32_t channel, bool ok)
+  {
+    Copy_Callback_Func_t callback = nullptr;
+    Copy_Callback_Args_t arg      = nullptr;
+
+    {
+      Irq_Guard guard;
+
+      if (channel >= Backend::CHANNELS || NO_JOB == m_active[channel])
+      {
+        return;
+      }
+
+      Job&                job     = m_jobs[m_active[channel]];
+      const Copy_Segment& segment = job.segments[job.index];
+
+      system_internal::memory_internal::port::cache_invalidate(static_cast<uint8_t*>(segment.dest) + job.offset, job.chunk);
+
+      if (ok)
+      {
+        job.offset += job.chunk;
+        ok          = start_segment(channel);
+
+        if (ok && 0 != job.chunk)
+        {
+          return;
+        }
+      }
+
+      finish(channel, ok, job);
+      callback = job.callback;
+      arg      = job.arg;
+    }
+
+    if (nullptr != callback)
+    {
+      callback(arg, ok);
+    }
+
+    dispatch_all();
+  }
+
+public:
+  /**
+   * @brief  拷贝引擎 构造函数
+   *
+   * @param  args  后端构造参数
+   */
+  template <typename... Args>
+  explicit Copy_Engine(Args&&... args) : m_backend(std::forward<Args>(args)...)
+  {
+    for (uint16_t i = 0; i < Max_Jobs; ++i)
+    {
+      m_free[i] = i;
+    }
+
+    for (uint32_t i = 0; i < Backend::CHANNELS; ++i)
+    {
+      m_active[i] = NO_JOB;
+    }
+  }
+
+  /**
+   * @brief  拷贝引擎 初始化后端
+   *
+   * @return true   成功
+   * @return false  失败
+   */
+  bool init(void)
+  {
+    return m_backend.init(completion_handler, this);
+  }
+
+  /**
+   * @brief  拷贝引擎 获取后端
+   *
+   * @return Backend&  后端
+   */
+  Backend& backend(void) noexcept
+  {
+    return m_backend;
+  }
+
+  /**
+   * @brief  拷贝引擎 设置异步阈值
+   *
+   * @param  threshold  阈值 (字节)
+   */
+  void set_async_threshold(uint32_t threshold) noexcept
+  {
+    m_async_threshold = threshold;
+  }
+
+  /**
+   * @brief  拷贝引擎 获取异步阈值
+   *
+   * @return uint32_t  阈值 (字节)
+   */
+  uint32_t get_async_threshold(void) const noexcept
+  {
+    return m_async_threshold;
+  }
+
+  /**
+   * @brief  拷贝引擎 提交分散聚集任务
+   *
+   * @param  segments  分散聚集列表 (任务完成前必须保持有效)
+   * @param  count     段数
+   * @param  callback  完成回调函数 (可为nullptr)
+   * @param  arg       完成回调函数参数
+   * @param  token     完成令牌输出 (可为nullptr)
+   * @return true      提交成功
+   * @return false     参数错误或任务槽已满
+   */
+  bool submit(const Copy_Segment* segments, uint32_t count, Copy_Callback_Func_t callback = nullptr, Copy_Callback_Args_t arg = nullptr, Copy_Token* token = nullptr)
+  {
+    if (nullptr == segments || 0 == count)
+    {
+      return false;
+    }
+
+    return enqueue(segments, count, nullptr, callback, arg, token);
+  }
+
+  /**
+   * @brief  拷贝引擎 提交单段任务
+   *
+   * @param  dest      目标地址
+   * @param  src       源地址
+   * @param  size      拷贝大小
+   * @param  callback  完成回调函数 (可为nullptr)
+   * @param  arg       完成回调函数参数
+   * @param  token     完成令牌输出 (可为nullptr)
+   * @return true      提交成功
+   * @return false     参数错误或任务槽已满
+   */
+  bool submit(void* dest, const void* src, uint32_t size, Copy_Callback_Func_t callback = nullptr, Copy_Callback_Args_t arg = nullptr, Copy_Token* token = nullptr)
+  {
+    if (nullptr == dest || nullptr == src || 0 == size)
+    {
+      return false;
+    }
+
+    const Copy_Segment single { dest, src, size };
+    return enqueue(nullptr, 1, std::addressof(single), callback, arg, token);
+  }
+
+  /**
+   * @brief  拷贝引擎 拷贝 (异步可选: 小于阈值、后端不可访问或任务槽已满时同步拷贝并立即回调)
+   *
+   * @param  dest        目标地址
+   * @param  src         源地址
+   * @param  size        拷贝大小
+   * @param  callback    完成回调函数 (可为nullptr)
+   * @param  arg         完成回调函数参数
+   * @return Copy_Token  完成令牌 (同步完成时 index 为 SYNC_INDEX)
+   */
+  Copy_Token copy(void* dest, const void* src, uint32_t size, Copy_Callback_Func_t callback = nullptr, Copy_Callback_Args_t arg = nullptr)
+  {
+    Copy_Token token;
+
+    if (size >= m_async_threshold && m_backend.accessible(dest, size) && m_backend.accessible(src, size))
+    {
+      if (submit(dest, src, size, callback, arg, std::addressof(token)))
+      {
+        return token;
+      }
+    }
+
+    fast_memcpy(dest, src, size);
+
+    if (nullptr != callback)
+    {
+      callback(arg, true);
+    }
+
+    return token;
+  }
+
+  /**
+   * @brief  拷贝引擎 查询任务状态 (任务槽已被复用时视为已完成，需区分失败请使用回调)
+   *
+   * @param  token        完成令牌
+   * @return Copy_Status  任务状态
+   */
+  Copy_Status status(const Copy_Token& token) const
+  {
+    if (token.index >= Max_Jobs)
+    {
+      return Copy_Status::Done;
+    }
+
+    Irq_Guard  guard;
+    const Job& job = m_jobs[token.index];
+    return (job.generation == token.generation) ? job.status : Copy_Status::Done;
+  }
+
+  /**
+   * @brief  拷贝引擎 判断任务是否结束
+   *
+   * @param  token  完成令牌
+   * @return true   已完成或失败
+   * @return false  排队或传输中
+   */
+  bool is_finished(const Copy_Token& token) const
+  {
+    Copy_Status state = status(token);
+    return Copy_Status::Done == state || Copy_Status::Failed == state;
+  }
+
+  /**
+   * @brief  拷贝引擎 获取在途任务数
+   *
+   * @return uint32_t  在途任务数
+   */
+  uint32_t pending(void) const
+  {
+    Irq_Guard guard;
+    return Max_Jobs - m_free_count;
+  }
+
+  /**
+   * @brief  拷贝引擎 判断是否空闲
+   *
+   * @return true   无在途任务
+   * @return false  有在途任务
+   */
+  bool idle(void) const
+  {
+    return 0 == pending();
+  }
+};
+} /* namespace memory */
+} /* namespace system */
+} /* namespace QAQ */
+
+#endif /* __COPY_ENGINE_HPP__ */
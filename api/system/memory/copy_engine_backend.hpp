@@ -0,0 +1,393 @@
+#ifndef __COPY_ENGINE_BACKEND_HPP__
+#define __COPY_ENGINE_BACKEND_HPP__
+
+#include "copy_engine.hpp"
+
+#if defined(__arm__)
+#include "hardware/inc/pt_dma_api.h"
+#endif
+
+/// @brief 名称空间 QAQ
+namespace QAQ
+{
+/// @brief 名称空间 系统
+namespace system
+{
+/// @brief 名称空间 内存
+namespace memory
+{
+#if defined(__arm__)
+
+/**
+ * @brief 拷贝引擎 DMA后端 (基于 pt_dma 通道 API 的内存到内存传输)
+ *
+ * @note  使用前需已调用 pt_dma_system_init(); 通道在 init() 时从共享通道池分配，需将各通道 handle()
+ *        所在数据流的中断转发至 pt_dma_irq_handler() (如 base::dma::Dma_Pool::attach());
+ *        源/目标地址及长度均4字节对齐时按字传输，否则按字节传输 (宽度变化时原地重建，数据流不变);
+ *        DMA1/DMA2 无法访问 ITCM 与 DTCM，此类区间由 accessible() 拒绝
+ *
+ * @tparam Channels  占用的DMA通道数
+ */
+template <uint32_t Channels = 2>
+class Pt_Dma_Copy_Backend final
+{
+  // 禁止拷贝和移动
+  QAQ_NO_COPY_MOVE(Pt_Dma_Copy_Backend)
+
+public:
+  /// @brief 通道数
+  static constexpr uint32_t CHANNELS    = Channels;
+  /// @brief 单次传输最大字节数 (数据流计数器为16位，保持4字节对齐)
+  static constexpr uint32_t MAX_SEGMENT = 0xFFFC;
+
+private:
+  /// @brief ITCM 结束地址
+  static constexpr uintptr_t ITCM_END   = 0x00010000;
+  /// @brief DTCM 起始地址
+  static constexpr uintptr_t DTCM_START = 0x20000000;
+  /// @brief DTCM 结束地址
+  static constexpr uintptr_t DTCM_END   = 0x20020000;
+
+  /// @brief DMA 通道
+  PT_DMA                 m_channels[Channels] = {};
+  /// @brief 各通道当前数据宽度
+  pt_dma_data_width_e    m_width[Channels]    = {};
+  /// @brief 完成回调函数
+  Copy_Completion_Func_t m_function           = nullptr;
+  /// @brief 完成回调函数参数
+  void*                  m_arg                = nullptr;
+
+  /**
+   * @brief  DMA后端 传输完成回调 (中断中执行)
+   *
+   * @param  handle  DMA 通道
+   * @param  arg     DMA后端
+   */
+  static void transferred_handler(PT_DMA* handle, void* arg)
+  {
+    Pt_Dma_Copy_Backend* backend = static_cast<Pt_Dma_Copy_Backend*>(arg);
+    backend->m_function(backend->m_arg, static_cast<uint32_t>(handle - backend->m_channels), true);
+  }
+
+  /**
+   * @brief  DMA后端 传输错误回调 (中断中执行)
+   *
+   * @param  handle  DMA 通道
+   * @param  arg     DMA后端
+   */
+  static void error_handler(PT_DMA* handle, void* arg)
+  {
+    Pt_Dma_Copy_Backend* backend = static_cast<Pt_Dma_Copy_Backend*>(arg);
+    backend->m_function(backend->m_arg, static_cast<uint32_t>(handle - backend->m_channels), false);
+  }
+
+  /**
+   * @brief  DMA后端 创建通道
+   *
+   * @param  channel  通道
+   * @param  width    数据宽度
+   * @return true     成功
+   * @return false    失败
+   */
+  bool create(uint32_t channel, pt_dma_data_width_e width)
+  {
+    m_width[channel] = width;
+    return PT_SUCCEED == pt_dma_creat(&m_channels[channel], DMA_DIRE_MEM_TO_MEM, DMA_MODE_NORMAL, 1, 1, width, width, DMA_PRIO_MEDIUM);
+  }
+
+public:
+  /**
+   * @brief  DMA后端 构造函数
+   */
+  explicit Pt_Dma_Copy_Backend() {}
+
+  /**
+   * @brief  DMA后端 初始化
+   *
+   * @param  function  完成回调函数
+   * @param  arg       完成回调函数参数
+   * @return true      成功
+   * @return false     通道创建失败
+   */
+  bool init(Copy_Completion_Func_t function, void* arg)
+  {
+    m_function = function;
+    m_arg      = arg;
+
+    for (uint32_t i = 0; i < Channels; ++i)
+    {
+      if (!create(i, DMA_DATA_WIDTH_WORD))
+      {
+        return false;
+      }
+    }
+
+    return true;
+  }
+
+  /**
+   * @brief  DMA后端 获取通道句柄
+   *
+   * @param  channel  通道
+   * @return PT_DMA*  pt_dma 句柄
+   */
+  PT_DMA* handle(uint32_t channel) noexcept
+  {
+    return &m_channels[channel];
+  }
+
+  /**
+   * @brief  DMA后端 判断地址区间是否可被DMA访问
+   *
+   * @param  ptr   起始地址
+   * @param  size  大小
+   * @return true  可访问
+   * @return false 位于 ITCM 或 DTCM
+   */
+  bool accessible(const void* ptr, uint32_t size) const noexcept
+  {
+    const uintptr_t start = reinterpret_cast<uintptr_t>(ptr);
+    const uintptr_t end   = start + size;
+    return !(start < ITCM_END) && !(start < DTCM_END && end > DTCM_START);
+  }
+
+  /**
+   * @brief  DMA后端 启动传输
+   *
+   * @param  channel  通道
+   * @param  dest     目标地址
+   * @param  src      源地址
+   * @param  size     大小 (字节)
+   * @return true     启动成功
+   * @return false    启动失败
+   */
+  bool start(uint32_t channel, void* dest, const void* src, uint32_t size)
+  {
+    const uint32_t            dest_address = reinterpret_cast<uint32_t>(dest);
+    const uint32_t            src_address  = reinterpret_cast<uint32_t>(src);
+    const pt_dma_data_width_e width        = (0 == ((dest_address | src_address | size) & 3)) ? DMA_DATA_WIDTH_WORD : DMA_DATA_WIDTH_BYTE;
+
+    if (width != m_width[channel])
+    {
+      if (!create(channel, width))
+      {
+        return false;
+      }
+    }
+
+    if (PT_SUCCEED != pt_dma_config(&m_channels[channel], src_address, dest_address, size, transferred_handler, error_handler, this))
+    {
+      return false;
+    }
+
+    return PT_SUCCEED == pt_dma_start(&m_channels[channel]);
+  }
+};
+
+#endif /* defined(__arm__) */
+
+/**
+ * @brief 拷贝引擎 仿真后端 (主机上验证排队、分块、链式执行与完成逻辑)
+ *
+ * @note  start() 仅登记传输，由 step()/run() 逐个完成 (拷贝数据后触发完成回调);
+ *        fail_next() 注入传输错误，reject_start() 模拟启动失败
+ *
+ * @tparam Channels     模拟通道数
+ * @tparam Max_Segment  单次传输最大字节数
+ */
+template <uint32_t Channels = 2, uint32_t Max_Segment = 4096>
+class Sim_Copy_Backend final
+{
+  // 禁止拷贝和移动
+  QAQ_NO_COPY_MOVE(Sim_Copy_Backend)
+
+public:
+  /// @brief 通道数
+  static constexpr uint32_t CHANNELS    = Channels;
+  /// @brief 单次传输最大字节数
+  static constexpr uint32_t MAX_SEGMENT = Max_Segment;
+
+private:
+  /// @brief 模拟传输
+  struct Transfer
+  {
+    void*       dest; /* 目标地址 */
+    const void* src;  /* 源地址 */
+    uint32_t    size; /* 大小 */
+    bool        busy; /* 是否进行中 */
+  };
+
+  /// @brief 各通道传输
+  Transfer               m_transfers[Channels] = {};
+  /// @brief 完成回调函数
+  Copy_Completion_Func_t m_function            = nullptr;
+  /// @brief 完成回调函数参数
+  void*                  m_arg                 = nullptr;
+  /// @brief 下一个完成的通道 (轮询)
+  uint32_t               m_next                = 0;
+  /// @brief 待注入错误次数
+  uint32_t               m_fail_count          = 0;
+  /// @brief 已启动传输次数
+  uint32_t               m_started             = 0;
+  /// @brief 是否拒绝启动
+  bool                   m_reject              = false;
+
+public:
+  /**
+   * @brief  仿真后端 构造函数
+   */
+  explicit Sim_Copy_Backend() {}
+
+  /**
+   * @brief  仿真后端 初始化
+   *
+   * @param  function  完成回调函数
+   * @param  arg       完成回调函数参数
+   * @return true      成功
+   */
+  bool init(Copy_Completion_Func_t function, void* arg)
+  {
+    m_function = function;
+    m_arg      = arg;
+    return true;
+  }
+
+  /**
+   * @brief  仿真后端 判断地址区间是否可访问
+   *
+   * @return true  可访问
+   */
+  bool accessible(const void*, uint32_t) const noexcept
+  {
+    return true;
+  }
+
+  /**
+   * @brief  仿真后端 登记传输
+   *
+   * @param  channel  通道
+   * @param  dest     目标地址
+   * @param  src      源地址
+   * @param  size     大小
+   * @return true     登记成功
+   * @return false    拒绝启动、通道忙或超出单次传输上限
+   */
+  bool start(uint32_t channel, void* dest, const void* src, uint32_t size)
+  {
+    if (m_reject || channel >= Channels || m_transfers[channel].busy || size > Max_Segment)
+    {
+      return false;
+    }
+
+    m_transfers[channel] = Transfer { dest, src, size, true };
+    ++m_started;
+    return true;
+  }
+
+  /**
+   * @brief  仿真后端 完成一个进行中的传输
+   *
+   * @return true   已完成一个传输
+   * @return false  无进行中的传输
+   */
+  bool step(void)
+  {
+    for (uint32_t i = 0; i < Channels; ++i)
+    {
+      uint32_t channel = (m_next + i) % Channels;
+
+      if (!m_transfers[channel].busy)
+      {
+        continue;
+      }
+
+      Transfer& transfer = m_transfers[channel];
+      bool      ok       = (0 == m_fail_count);
+
+      if (ok)
+      {
+        __builtin_memcpy(transfer.dest, transfer.src, transfer.size);
+      }
+      else
+      {
+        --m_fail_count;
+      }
+
+      transfer.busy = false;
+      m_next        = (channel + 1) % Channels;
+      m_function(m_arg, channel, ok);
+      return true;
+    }
+
+    return false;
+  }
+
+  /**
+   * @brief  仿真后端 完成所有传输 (包括完成回调中新启动的传输)
+   *
+   * @return uint32_t  完成的传输次数
+   */
+  uint32_t run(void)
+  {
+    uint32_t count = 0;
+
+    while (step())
+    {
+      ++count;
+    }
+
+    return count;
+  }
+
+  /**
+   * @brief  仿真后端 注入传输错误
+   *
+   * @param  count  接下来失败的传输次数
+   */
+  void fail_next(uint32_t count) noexcept
+  {
+    m_fail_count = count;
+  }
+
+  /**
+   * @brief  仿真后端 模拟启动失败
+   *
+   * @param  reject  是否拒绝启动
+   */
+  void reject_start(bool reject) noexcept
+  {
+    m_reject = reject;
+  }
+
+  /**
+   * @brief  仿真后端 获取已启动传输次数
+   *
+   * @return uint32_t  已启动传输次数
+   */
+  uint32_t started(void) const noexcept
+  {
+    return m_started;
+  }
+
+  /**
+   * @brief  仿真后端 获取进行中的传输数
+   *
+   * @return uint32_t  进行中的传输数
+   */
+  uint32_t busy(void) const noexcept
+  {
+    uint32_t count = 0;
+
+    for (uint32_t i = 0; i < Channels; ++i)
+    {
+      count += m_transfers[i].busy ? 1 : 0;
+    }
+
+    return count;
+  }
+};
+} /* namespace memory */
+} /* namespace system */
+} /* namespace QAQ */
+
+#endif /* __COPY_ENGINE_BACKEND_HPP__ */
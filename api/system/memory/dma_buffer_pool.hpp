@@ -0,0 +1,520 @@
+#ifndef __DMA_BUFFER_POOL_HPP__
+#define __DMA_BUFFER_POOL_HPP__
+
+#include "fast_memory_port.hpp"
+
+/// @brief 名称空间 QAQ
+namespace QAQ
+{
+/// @brief 名称空间 系统
+namespace system
+{
+/// @brief 名称空间 内存
+namespace memory
+{
+/**
+ * @brief DMA缓冲区 设备访问方式
+ */
+enum class Dma_Access : uint8_t
+{
+  Device_Read,       /* 设备读取 (发送) */
+  Device_Write,      /* 设备写入 (接收) */
+  Device_Read_Write, /* 设备读写 */
+};
+
+class Dma_Buffer_Pool_Base;
+
+template <Dma_Access Access>
+class Dma_Device_Buffer;
+
+/**
+ * @brief DMA缓冲区 CPU持有 (仅可移动，析构时归还内存池)
+ *
+ * @note  可写访问 data() 会标记缓冲区为脏，转交设备时仅在必要时清除/失效缓存
+ */
+class Dma_Buffer final
+{
+  // 禁止拷贝
+  NO_COPY(Dma_Buffer)
+
+  friend class Dma_Buffer_Pool_Base;
+  template <Dma_Access Access>
+  friend class Dma_Device_Buffer;
+
+private:
+  /// @brief 所属内存池
+  Dma_Buffer_Pool_Base* m_pool  = nullptr;
+  /// @brief 缓冲区地址
+  uint8_t*              m_data  = nullptr;
+  /// @brief 有效数据大小
+  uint32_t              m_size  = 0;
+  /// @brief 缓存中可能存在未写回的数据
+  bool                  m_dirty = false;
+
+  /**
+   * @brief  DMA缓冲区 构造函数
+   *
+   * @param  pool   所属内存池
+   * @param  data   缓冲区地址
+   * @param  size   有效数据大小
+   * @param  dirty  是否为脏
+   */
+  Dma_Buffer(Dma_Buffer_Pool_Base* pool, uint8_t* data, uint32_t size, bool dirty) noexcept : m_pool(pool), m_data(data), m_size(size), m_dirty(dirty) {}
+
+  /**
+   * @brief  DMA缓冲区 置空 (所有权已转移)
+   */
+  void detach(void) noexcept
+  {
+    m_pool  = nullptr;
+    m_data  = nullptr;
+    m_size  = 0;
+    m_dirty = false;
+  }
+
+public:
+  /**
+   * @brief  DMA缓冲区 构造函数 (空缓冲区)
+   */
+  Dma_Buffer() noexcept {}
+
+  /**
+   * @brief  DMA缓冲区 移动构造函数
+   *
+   * @param  other  其他缓冲区
+   */
+  Dma_Buffer(Dma_Buffer&& other) noexcept : m_pool(other.m_pool), m_data(other.m_data), m_size(other.m_size), m_dirty(other.m_dirty)
+  {
+    other.detach();
+  }
+
+  /**
+   * @brief  DMA缓冲区 移动赋值
+   *
+   * @param  other        其他缓冲区
+   * @return Dma_Buffer&  自身
+   */
+  Dma_Buffer& operator=(Dma_Buffer&& other) noexcept;
+
+  /**
+   * @brief  DMA缓冲区 析构函数 (归还内存池)
+   */
+  ~Dma_Buffer()
+  {
+    release();
+  }
+
+  /**
+   * @brief  DMA缓冲区 归还内存池
+   */
+  void release(void) noexcept;
+
+  /**
+   * @brief  DMA缓冲区 判断是否有效
+   *
+   * @return true   有效
+   * @return false  空缓冲区
+   */
+  explicit operator bool(void) const noexcept
+  {
+    return nullptr != m_data;
+  }
+
+  /**
+   * @brief  DMA缓冲区 获取可写数据 (标记为脏)
+   *
+   * @return uint8_t*  数据地址
+   */
+  uint8_t* data(void) noexcept
+  {
+    m_dirty = true;
+    return m_data;
+  }
+
+  /**
+   * @brief  DMA缓冲区 获取只读数据
+   *
+   * @return const uint8_t*  数据地址
+   */
+  const uint8_t* data(void) const noexcept
+  {
+    return m_data;
+  }
+
+  /**
+   * @brief  DMA缓冲区 获取有效数据大小
+   *
+   * @return uint32_t  有效数据大小
+   */
+  uint32_t size(void) const noexcept
+  {
+    return m_size;
+  }
+
+  /**
+   * @brief  DMA缓冲区 获取容量 (按缓存行填充后的块大小)
+   *
+   * @return uint32_t  容量
+   */
+  uint32_t capacity(void) const noexcept;
+
+  /**
+   * @brief  DMA缓冲区 设置有效数据大小
+   *
+   * @param  size   有效数据大小
+   * @return true   成功
+   * @return false  超出容量
+   */
+  bool resize(uint32_t size) noexcept
+  {
+    if (nullptr == m_data || size > capacity())
+    {
+      return false;
+    }
+
+    m_size = size;
+    return true;
+  }
+
+  /**
+   * @brief  DMA缓冲区 判断缓存中是否可能有未写回的数据
+   *
+   * @return true   脏
+   * @return false  干净
+   */
+  bool dirty(void) const noexcept
+  {
+    return m_dirty;
+  }
+
+  /**
+   * @brief  DMA缓冲区 转交设备 (按访问方式执行最少的缓存维护)
+   *
+   * @tparam Access                     设备访问方式
+   * @return Dma_Device_Buffer<Access>  设备持有的缓冲区
+   */
+  template <Dma_Access Access>
+  Dma_Device_Buffer<Access> to_device(void) &&;
+};
+
+/**
+ * @brief DMA缓冲区 设备持有 (CPU不可访问数据，仅提供传输地址)
+ *
+ * @tparam Access  设备访问方式
+ */
+template <Dma_Access Access>
+class Dma_Device_Buffer final
+{
+  // 禁止拷贝
+  NO_COPY(Dma_Device_Buffer)
+
+  friend class Dma_Buffer;
+
+private:
+  /// @brief 缓冲区 (所有权)
+  Dma_Buffer m_buffer;
+
+  /**
+   * @brief  设备缓冲区 构造函数
+   *
+   * @param  buffer  CPU缓冲区
+   */
+  explicit Dma_Device_Buffer(Dma_Buffer&& buffer) noexcept : m_buffer(std::move(buffer)) {}
+
+public:
+  /**
+   * @brief  设备缓冲区 构造函数 (空缓冲区)
+   */
+  Dma_Device_Buffer() noexcept {}
+
+  /**
+   * @brief  设备缓冲区 移动构造函数
+   *
+   * @param  other  其他缓冲区
+   */
+  Dma_Device_Buffer(Dma_Device_Buffer&& other) noexcept = default;
+
+  /**
+   * @brief  设备缓冲区 移动赋值
+   *
+   * @param  other               其他缓冲区
+   * @return Dma_Device_Buffer&  自身
+   */
+  Dma_Device_Buffer& operator=(Dma_Device_Buffer&& other) noexcept = default;
+
+  /**
+   * @brief  设备缓冲区 判断是否有效
+   *
+   * @return true   有效
+   * @return false  空缓冲区
+   */
+  explicit operator bool(void) const noexcept
+  {
+    return static_cast<bool>(m_buffer);
+  }
+
+  /**
+   * @brief  设备缓冲区 获取传输地址
+   *
+   * @return void*  传输地址
+   */
+  void* address(void) const noexcept
+  {
+    return m_buffer.m_data;
+  }
+
+  /**
+   * @brief  设备缓冲区 获取有效数据大小
+   *
+   * @return uint32_t  有效数据大小
+   */
+  uint32_t size(void) const noexcept
+  {
+    return m_buffer.m_size;
+  }
+
+  /**
+   * @brief  设备缓冲区 获取容量
+   *
+   * @return uint32_t  容量
+   */
+  uint32_t capacity(void) const noexcept
+  {
+    return m_buffer.capacity();
+  }
+
+  /**
+   * @brief  设备缓冲区 设置设备写入的数据大小
+   *
+   * @param  size   数据大小
+   * @return true   成功
+   * @return false  超出容量
+   */
+  bool resize(uint32_t size) noexcept
+  {
+    return m_buffer.resize(size);
+  }
+
+  /**
+   * @brief  设备缓冲区 收回至CPU (设备写入过的缓冲区失效缓存)
+   *
+   * @return Dma_Buffer  CPU持有的缓冲区
+   */
+  Dma_Buffer to_cpu(void) &&
+  {
+    if constexpr (Dma_Access::Device_Read != Access)
+    {
+      if (m_buffer.m_data)
+      {
+        system_internal::memory_internal::port::cache_invalidate(m_buffer.m_data, m_buffer.capacity());
+      }
+    }
+
+    return std::move(m_buffer);
+  }
+};
+
+/**
+ * @brief DMA缓冲区 内存池基类 (固定块，块按缓存行对齐并填充)
+ */
+class Dma_Buffer_Pool_Base
+{
+  // 禁止拷贝和移动
+  QAQ_NO_COPY_MOVE(Dma_Buffer_Pool_Base)
+
+  friend class Dma_Buffer;
+
+private:
+  /// @brief 中断保护器类型
+  using Irq_Guard = system_internal::memory_internal::port::Irq_Guard;
+
+  /// @brief 块存储
+  uint8_t*  m_memory;
+  /// @brief 空闲块栈
+  uint16_t* m_free;
+  /// @brief 块大小
+  uint32_t  m_block_size;
+  /// @brief 块数量
+  uint16_t  m_block_count;
+  /// @brief 空闲块数量
+  uint16_t  m_free_count;
+
+  /**
+   * @brief  DMA内存池 归还块
+   *
+   * @param  block  块地址
+   */
+  void deallocate(uint8_t* block) noexcept
+  {
+    uintptr_t offset = reinterpret_cast<uintptr_t>(block) - reinterpret_cast<uintptr_t>(m_memory);
+
+    if (block < m_memory || 0 != offset % m_block_size || offset / m_block_size >= m_block_count)
+    {
+      return;
+    }
+
+    Irq_Guard guard;
+    m_free[m_free_count++] = static_cast<uint16_t>(offset / m_block_size);
+  }
+
+protected:
+  /**
+   * @brief  DMA内存池基类 构造函数
+   *
+   * @param  memory       块存储 (按缓存行对齐)
+   * @param  free         空闲块栈存储
+   * @param  block_size   块大小 (缓存行整数倍)
+   * @param  block_count  块数量
+   */
+  Dma_Buffer_Pool_Base(uint8_t* memory, uint16_t* free, uint32_t block_size, uint16_t block_count) noexcept : m_memory(memory), m_free(free), m_block_size(block_size), m_block_count(block_count), m_free_count(block_count)
+  {
+    for (uint16_t i = 0; i < block_count; ++i)
+    {
+      m_free[i] = static_cast<uint16_t>(block_count - 1 - i);
+    }
+  }
+
+  ~Dma_Buffer_Pool_Base() {}
+
+public:
+  /**
+   * @brief  DMA内存池 申请缓冲区 (CPU持有，内容未定义)
+   *
+   * @param  size        有效数据大小
+   * @return Dma_Buffer  缓冲区，失败返回空缓冲区
+   */
+  Dma_Buffer allocate(uint32_t size) noexcept
+  {
+    if (size > m_block_size)
+    {
+      return Dma_Buffer();
+    }
+
+    uint16_t index = 0;
+
+    {
+      Irq_Guard guard;
+
+      if (0 == m_free_count)
+      {
+        return Dma_Buffer();
+      }
+
+      index = m_free[--m_free_count];
+    }
+
+    return Dma_Buffer(this, m_memory + static_cast<uint32_t>(index) * m_block_size, size, false);
+  }
+
+  /**
+   * @brief  DMA内存池 获取块大小
+   *
+   * @return uint32_t  块大小
+   */
+  uint32_t block_size(void) const noexcept
+  {
+    return m_block_size;
+  }
+
+  /**
+   * @brief  DMA内存池 获取空闲块数量
+   *
+   * @return uint32_t  空闲块数量
+   */
+  uint32_t available(void) const noexcept
+  {
+    return m_free_count;
+  }
+};
+
+/**
+ * @brief DMA缓冲区 内存池
+ *
+ * @note  实例应以 QAQ_DMA_BUFFER 声明为静态对象，使块位于DMA区域;
+ *        块按32字节缓存行对齐且大小填充至缓存行整数倍，缓冲区之间不共享缓存行，
+ *        因此所有权转换时的失效操作不会影响相邻数据
+ *
+ * @tparam Block_Size   块大小 (向上填充至缓存行整数倍)
+ * @tparam Block_Count  块数量
+ */
+template <uint32_t Block_Size, uint16_t Block_Count>
+class Dma_Buffer_Pool final : public Dma_Buffer_Pool_Base
+{
+  static_assert(0 < Block_Size && 0 < Block_Count, "Dma_Buffer_Pool size must be positive");
+
+  // 禁止拷贝和移动
+  QAQ_NO_COPY_MOVE(Dma_Buffer_Pool)
+
+public:
+  /// @brief 填充后的块大小
+  static constexpr uint32_t BLOCK_SIZE = (Block_Size + system_internal::memory_internal::port::CACHE_LINE_SIZE - 1) & ~static_cast<uint32_t>(system_internal::memory_internal::port::CACHE_LINE_SIZE - 1);
+
+private:
+  /// @brief 块存储
+  uint8_t  m_blocks[BLOCK_SIZE * Block_Count] QAQ_ALIGN(32);
+  /// @brief 空闲块栈存储 (独占缓存行，不与块共享)
+  uint16_t m_free_list[Block_Count] QAQ_ALIGN(32);
+
+public:
+  /**
+   * @brief  DMA内存池 构造函数
+   */
+  explicit Dma_Buffer_Pool() noexcept : Dma_Buffer_Pool_Base(m_blocks, m_free_list, BLOCK_SIZE, Block_Count) {}
+};
+
+inline Dma_Buffer& Dma_Buffer::operator=(Dma_Buffer&& other) noexcept
+{
+  if (this != std::addressof(other))
+  {
+    release();
+    m_pool  = other.m_pool;
+    m_data  = other.m_data;
+    m_size  = other.m_size;
+    m_dirty = other.m_dirty;
+    other.detach();
+  }
+
+  return *this;
+}
+
+inline void Dma_Buffer::release(void) noexcept
+{
+  if (nullptr != m_pool)
+  {
+    m_pool->deallocate(m_data);
+  }
+
+  detach();
+}
+
+inline uint32_t Dma_Buffer::capacity(void) const noexcept
+{
+  return (nullptr != m_pool) ? m_pool->block_size() : 0;
+}
+
+template <Dma_Access Access>
+inline Dma_Device_Buffer<Access> Dma_Buffer::to_device(void) &&
+{
+  if (m_dirty)
+  {
+    if constexpr (Dma_Access::Device_Write == Access)
+    {
+      // 设备将覆盖内容，直接丢弃脏数据，避免其写回覆盖设备写入
+      system_internal::memory_internal::port::cache_invalidate(m_data, capacity());
+    }
+    else
+    {
+      system_internal::memory_internal::port::cache_clean(m_data, (Dma_Access::Device_Read == Access) ? m_size : capacity());
+    }
+
+    system_internal::memory_internal::port::sync_barrier();
+    m_dirty = false;
+  }
+
+  return Dma_Device_Buffer<Access>(std::move(*this));
+}
+} /* namespace memory */
+} /* namespace system */
+} /* namespace QAQ */
+
+#endif /* __DMA_BUFFER_POOL_HPP__ */
@@ -0,0 +1,430 @@
+/**
+ * @file   dma_buffer_pool_test.cpp
+ * @brief  DMA缓冲区内存池 主机测试: 所有权状态机模型对照与非法转换
+ *
+ * @note   仅用于主机，不参与固件编译 (已加入 eide excludeList);
+ *         以 空闲 / CPU干净 / CPU脏 / 设备读 / 设备写 / 设备读写 六个状态的参考模型驱动随机操作序列，
+ *         每步对照主机缓存操作计数、空闲块数量与各句柄的有效性和地址唯一性;
+ *         非法转换: 对左值转交设备/收回、设备持有时经CPU访问数据在编译期被拒绝 (检测惯用法)，
+ *         重复归还、已转移句柄的访问与归还、越界/未对齐地址的归还均不影响内存池
+ *
+ *         构建 (仓库根目录):
+ *         g++ -std=c++17 -O2 -g -fsanitize=address,undefined -Iapi/system/memory \
+ *             api/system/memory/dma_buffer_pool_test.cpp -o dma_buffer_pool_test && ./dma_buffer_pool_test
+ */
+#include "dma_buffer_pool.hpp"
+
+#include <cstdio>
+#include <type_traits>
+#include <utility>
+
+using namespace QAQ::system::memory;
+using Cache_Counter = QAQ::system::system_internal::memory_internal::port::Cache_Counter;
+
+namespace
+{
+/// @brief 块数量
+constexpr uint16_t BLOCK_COUNT = 6;
+/// @brief 句柄槽数量 (多于块数量，覆盖内存池耗尽)
+constexpr uint32_t SLOT_COUNT  = 8;
+
+/// @brief 被测内存池 (块大小 40 填充至 64)
+using Pool = Dma_Buffer_Pool<40, BLOCK_COUNT>;
+
+/// @brief 失败的检查数
+int g_failures = 0;
+
+#define CHECK(cond)                                                  \
+  do                                                                 \
+  {                                                                  \
+    if (!(cond))                                                     \
+    {                                                                \
+      ++g_failures;                                                  \
+      printf("%s:%d: CHECK(%s) failed\n", __FILE__, __LINE__, #cond); \
+    }                                                                \
+  } while (0)
+
+/// @brief 参考模型状态
+enum class State : uint8_t
+{
+  Free,
+  Cpu_Clean,
+  Cpu_Dirty,
+  Device_Read,
+  Device_Write,
+  Device_Read_Write,
+};
+
+/// @brief 预期的缓存操作
+struct Expected
+{
+  uint32_t clean;
+  uint32_t invalidate;
+};
+
+/// @brief 句柄槽 (同一时刻最多一个句柄有效，与模型状态对应)
+struct Slot
+{
+  Dma_Buffer                                     cpu;
+  Dma_Device_Buffer<Dma_Access::Device_Read>       read;
+  Dma_Device_Buffer<Dma_Access::Device_Write>      write;
+  Dma_Device_Buffer<Dma_Access::Device_Read_Write> read_write;
+  State                                          state = State::Free;
+};
+
+// 非法转换的编译期检测: 设备持有时不可访问数据，转交与收回只能作用于右值 (转移所有权)
+template <typename T, typename = void>
+struct has_data : std::false_type
+{
+};
+
+template <typename T>
+struct has_data<T, std::void_t<decltype(std::declval<T&>().data())>> : std::true_type
+{
+};
+
+template <typename T, typename = void>
+struct lvalue_to_device : std::false_type
+{
+};
+
+template <typename T>
+struct lvalue_to_device<T, std::void_t<decltype(std::declval<T&>().template to_device<Dma_Access::Device_Read>())>> : std::true_type
+{
+};
+
+template <typename T, typename = void>
+struct lvalue_to_cpu : std::false_type
+{
+};
+
+template <typename T>
+struct lvalue_to_cpu<T, std::void_t<decltype(std::declval<T&>().to_cpu())>> : std::true_type
+{
+};
+
+template <typename T, typename = void>
+struct rvalue_to_cpu : std::false_type
+{
+};
+
+template <typename T>
+struct rvalue_to_cpu<T, std::void_t<decltype(std::declval<T&&>().to_cpu())>> : std::true_type
+{
+};
+
+static_assert(has_data<Dma_Buffer>::value, "CPU-owned buffer exposes its data");
+static_assert(!has_data<Dma_Device_Buffer<Dma_Access::Device_Read>>::value && !has_data<Dma_Device_Buffer<Dma_Access::Device_Write>>::value &&
+                !has_data<Dma_Device_Buffer<Dma_Access::Device_Read_Write>>::value,
+              "Device-owned buffer must not expose data to the CPU");
+static_assert(!lvalue_to_device<Dma_Buffer>::value, "Handing a buffer to the device must consume the CPU handle");
+static_assert(!lvalue_to_cpu<Dma_Device_Buffer<Dma_Access::Device_Write>>::value && rvalue_to_cpu<Dma_Device_Buffer<Dma_Access::Device_Write>>::value,
+              "Reclaiming a buffer must consume the device handle");
+static_assert(!std::is_copy_constructible_v<Dma_Buffer> && !std::is_copy_assignable_v<Dma_Buffer> && std::is_nothrow_move_constructible_v<Dma_Buffer>, "CPU handle is move-only");
+static_assert(!std::is_copy_constructible_v<Dma_Device_Buffer<Dma_Access::Device_Read>> && std::is_nothrow_move_assignable_v<Dma_Device_Buffer<Dma_Access::Device_Read>>, "Device handle is move-only");
+
+/// @brief 伪随机数
+uint32_t g_seed = 1;
+
+uint32_t next_random(uint32_t range)
+{
+  g_seed = g_seed * 1664525U + 1013904223U;
+  return (g_seed >> 8) % range;
+}
+
+/**
+ * @brief  槽当前有效句柄的传输/数据地址
+ */
+const void* slot_address(const Slot& slot)
+{
+  switch (slot.state)
+  {
+    case State::Cpu_Clean :
+    case State::Cpu_Dirty :
+      return std::as_const(slot.cpu).data();
+    case State::Device_Read :
+      return slot.read.address();
+    case State::Device_Write :
+      return slot.write.address();
+    case State::Device_Read_Write :
+      return slot.read_write.address();
+    default :
+      return nullptr;
+  }
+}
+
+/**
+ * @brief  转交设备 (模型: 仅脏缓冲区需要维护，设备写入时以失效代替清除)
+ */
+template <Dma_Access Access>
+void to_device(Slot& slot, Dma_Device_Buffer<Access>& device, State target, Expected& expected)
+{
+  if (State::Cpu_Dirty == slot.state)
+  {
+    (Dma_Access::Device_Write == Access) ? ++expected.invalidate : ++expected.clean;
+  }
+
+  device = std::move(slot.cpu).template to_device<Access>();
+  CHECK(!slot.cpu && static_cast<bool>(device) && nullptr == std::as_const(slot.cpu).data());
+  slot.state = target;
+}
+
+/**
+ * @brief  收回至CPU (模型: 设备写入过的缓冲区失效缓存)
+ */
+template <Dma_Access Access>
+void to_cpu(Slot& slot, Dma_Device_Buffer<Access>& device, Expected& expected)
+{
+  if (Dma_Access::Device_Read != Access)
+  {
+    ++expected.invalidate;
+  }
+
+  slot.cpu = std::move(device).to_cpu();
+  CHECK(!device && static_cast<bool>(slot.cpu) && !slot.cpu.dirty());
+  slot.state = State::Cpu_Clean;
+}
+
+/**
+ * @brief  归还槽中的缓冲区 (任意状态)
+ */
+void release(Slot& slot)
+{
+  slot.cpu.release();
+  slot.read       = Dma_Device_Buffer<Dma_Access::Device_Read>();
+  slot.write      = Dma_Device_Buffer<Dma_Access::Device_Write>();
+  slot.read_write = Dma_Device_Buffer<Dma_Access::Device_Read_Write>();
+  slot.state      = State::Free;
+}
+} /* namespace */
+
+/**
+ * @brief  随机操作序列与参考模型对照
+ */
+static void test_model(Pool& pool)
+{
+  static Slot slots[SLOT_COUNT];
+  Expected    expected = {};
+  uint32_t    failed   = 0;
+
+  Cache_Counter::reset();
+
+  for (uint32_t step = 0; step < 200000; ++step)
+  {
+    Slot&          slot = slots[next_random(SLOT_COUNT)];
+    const uint32_t op   = next_random(8);
+
+    switch (slot.state)
+    {
+      case State::Free :
+      {
+        uint32_t free = 0;
+
+        for (const Slot& other : slots)
+        {
+          free += (State::Free == other.state);
+        }
+
+        const uint32_t size = next_random(Pool::BLOCK_SIZE + 8);
+
+        slot.cpu = pool.allocate(size);
+
+        // 超出块大小或内存池耗尽时申请失败
+        const bool ok = (size <= Pool::BLOCK_SIZE) && (free > SLOT_COUNT - BLOCK_COUNT);
+
+        failed += !ok;
+        CHECK(ok == static_cast<bool>(slot.cpu));
+        slot.state = ok ? State::Cpu_Clean : State::Free;
+
+        if (ok)
+        {
+          CHECK(size == slot.cpu.size() && Pool::BLOCK_SIZE == slot.cpu.capacity() && !slot.cpu.dirty());
+        }
+        break;
+      }
+
+      case State::Cpu_Clean :
+      case State::Cpu_Dirty :
+        if (0 == op)
+        {
+          release(slot);
+        }
+        else if (1 == op)
+        {
+          slot.cpu.data()[0] = static_cast<uint8_t>(step);
+          slot.state         = State::Cpu_Dirty;
+        }
+        else if (2 == op)
+        {
+          // 只读访问不标记为脏
+          CHECK(nullptr != std::as_const(slot.cpu).data());
+        }
+        else if (3 == op)
+        {
+          CHECK(slot.cpu.resize(Pool::BLOCK_SIZE) && !slot.cpu.resize(Pool::BLOCK_SIZE + 1));
+        }
+        else if (4 == op)
+        {
+          to_device(slot, slot.read, State::Device_Read, expected);
+        }
+        else if (5 == op)
+        {
+          to_device(slot, slot.write, State::Device_Write, expected);
+        }
+        else if (6 == op)
+        {
+          to_device(slot, slot.read_write, State::Device_Read_Write, expected);
+        }
+        else
+        {
+          // 移动至其他空闲槽 (目标原有缓冲区先归还)
+          Slot& target = slots[next_random(SLOT_COUNT)];
+
+          if (&target != &slot && (State::Cpu_Clean == target.state || State::Cpu_Dirty == target.state || State::Free == target.state))
+          {
+            target.cpu   = std::move(slot.cpu);
+            target.state = slot.state;
+            slot.state   = State::Free;
+            CHECK(!slot.cpu);
+          }
+        }
+        break;
+
+      case State::Device_Read :
+        (op < 2) ? release(slot) : to_cpu(slot, slot.read, expected);
+        break;
+
+      case State::Device_Write :
+        if (op < 2)
+        {
+          release(slot);
+        }
+        else
+        {
+          CHECK(slot.write.resize(next_random(Pool::BLOCK_SIZE + 1)));
+          to_cpu(slot, slot.write, expected);
+        }
+        break;
+
+      case State::Device_Read_Write :
+        (op < 2) ? release(slot) : to_cpu(slot, slot.read_write, expected);
+        break;
+    }
+
+    // 对照: 缓存操作计数、空闲块数量、句柄有效性与地址唯一性
+    uint32_t    live                  = 0;
+    const void* address[SLOT_COUNT]   = {};
+    bool        step_ok               = (expected.clean == Cache_Counter::clean) && (expected.invalidate == Cache_Counter::invalidate) && (0 == Cache_Counter::clean_invalidate);
+
+    for (const Slot& other : slots)
+    {
+      const void* ptr = slot_address(other);
+
+      step_ok = step_ok && ((State::Free == other.state) == (nullptr == ptr));
+      step_ok = step_ok && (0 == reinterpret_cast<uintptr_t>(ptr) % 32);
+
+      for (uint32_t i = 0; i < live && nullptr != ptr; ++i)
+      {
+        step_ok = step_ok && (address[i] != ptr);
+      }
+
+      if (nullptr != ptr)
+      {
+        address[live++] = ptr;
+      }
+    }
+
+    step_ok = step_ok && (BLOCK_COUNT - live == pool.available());
+
+    if (!step_ok)
+    {
+      CHECK(step_ok);
+      printf("  model diverged at step %u\n", step);
+      break;
+    }
+  }
+
+  for (Slot& slot : slots)
+  {
+    release(slot);
+  }
+
+  CHECK(BLOCK_COUNT == pool.available() && 0 != failed);
+}
+
+/**
+ * @brief  非法转换: 重复归还、已转移句柄的访问与归还、自移动赋值
+ */
+static void test_illegal_transitions(Pool& pool)
+{
+  Dma_Buffer buffer = pool.allocate(16);
+
+  CHECK(BLOCK_COUNT - 1 == pool.available());
+
+  // 重复归还只归还一次
+  buffer.release();
+  buffer.release();
+  CHECK(BLOCK_COUNT == pool.available() && !buffer && nullptr == buffer.data() && 0 == buffer.capacity() && !buffer.resize(0));
+
+  // 转交设备后原句柄为空，CPU 经原句柄访问得到空指针，归还原句柄不影响设备持有的缓冲区
+  buffer = pool.allocate(16);
+
+  uint8_t* raw = buffer.data();
+
+  Dma_Device_Buffer<Dma_Access::Device_Write> device = std::move(buffer).to_device<Dma_Access::Device_Write>();
+
+  CHECK(!buffer && nullptr == buffer.data());
+  buffer.release();
+  CHECK(BLOCK_COUNT - 1 == pool.available() && device.address() == raw);
+
+  // 已收回的设备句柄为空，再次收回得到空缓冲区且不做缓存维护
+  Cache_Counter::reset();
+  buffer                     = std::move(device).to_cpu();
+  Dma_Buffer again           = std::move(device).to_cpu();
+  CHECK(1 == Cache_Counter::invalidate && static_cast<bool>(buffer) && !again && !device && nullptr == device.address());
+
+  // 空句柄转交设备不做缓存维护
+  Cache_Counter::reset();
+  Dma_Device_Buffer<Dma_Access::Device_Read> empty = std::move(again).to_device<Dma_Access::Device_Read>();
+  CHECK(!empty && 0 == Cache_Counter::clean && 0 == Cache_Counter::invalidate);
+
+  // 自移动赋值保持所有权
+  Dma_Buffer& self = buffer;
+  buffer           = std::move(self);
+  CHECK(static_cast<bool>(buffer) && BLOCK_COUNT - 1 == pool.available());
+
+  buffer.release();
+  CHECK(BLOCK_COUNT == pool.available());
+
+  // 耗尽后申请失败，超出块大小申请失败
+  Dma_Buffer all[BLOCK_COUNT];
+
+  for (Dma_Buffer& item : all)
+  {
+    item = pool.allocate(Pool::BLOCK_SIZE);
+    CHECK(static_cast<bool>(item));
+  }
+
+  CHECK(!pool.allocate(1) && 0 == pool.available());
+
+  for (Dma_Buffer& item : all)
+  {
+    item.release();
+  }
+
+  CHECK(!pool.allocate(Pool::BLOCK_SIZE + 1) && BLOCK_COUNT == pool.available());
+}
+
+int main(void)
+{
+  static Pool pool;
+
+  CHECK(64 == Pool::BLOCK_SIZE && BLOCK_COUNT == pool.available());
+
+  test_illegal_transitions(pool);
+  test_model(pool);
+
+  printf("dma_buffer_pool_test: %s (%d failures)\n", 0 == g_failures ? "OK" : "FAILED", g_failures);
+  fflush(stdout);
+  return 0 == g_failures ? 0 : 1;
+}
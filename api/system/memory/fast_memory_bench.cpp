@@ -0,0 +1,20 @@
+/**
+ * @file   fast_memory_bench.cpp
+ * @brief  快速内存函数 主机基准测试入口
+ *
+ * @note   仅用于主机，不参与固件编译 (已加入 eide excludeList);
+ *         目标板直接在线程中调用 Fast_Memory_Bench<>::run() 并以串口输出表格
+ *
+ *         构建 (仓库根目录):
+ *         g++ -std=c++17 -O2 -Iapi/system/memory \
+ *             api/system/memory/fast_memory_bench.cpp -o fast_memory_bench && ./fast_memory_bench
+ */
+#include "fast_memory_bench.hpp"
+
+#include <cstdio>
+
+int main(void)
+{
+  QAQ::system::memory::Fast_Memory_Bench<20000>::run([](const char* line) { puts(line); });
+  return 0;
+}
@@ -0,0 +1,326 @@
+#ifndef __FAST_MEMORY_BENCH_HPP__
+#define __FAST_MEMORY_BENCH_HPP__
+
+#include "fast_memory.hpp"
+
+#include <stdio.h>
+
+#if !defined(__arm__)
+#include <chrono>
+#endif
+
+/**
+ * @note  快速内存函数 基准测试: 按大小区间对比编译器内置实现与向量后端 (fast_memory.hpp 中的实现，
+ *        与 FAST_MEMORY_VECTOR_BACKEND 的设置无关); 结果用于决定目标板上 FAST_MEMORY_VECTOR_BACKEND 的取舍;
+ *        目标板以 DWT 周期计数，主机以纳秒计时; 每个区间交替使用对齐与非对齐 (源+1、目标+3) 的地址;
+ *        目标板在线程中调用 Fast_Memory_Bench::run() 输出表格，主机由 fast_memory_bench.cpp 运行
+ */
+
+/// @brief 名称空间 QAQ
+namespace QAQ
+{
+/// @brief 名称空间 系统
+namespace system
+{
+/// @brief 命名空间 内部
+namespace system_internal
+{
+/// @brief 命名空间 内存 内部
+namespace memory_internal
+{
+/// @brief 命名空间 基准测试
+namespace bench
+{
+/// @brief 拷贝函数类型
+using Copy_Func_t    = void (*)(void*, const void*, size_t);
+/// @brief 填充函数类型
+using Set_Func_t     = void (*)(void*, int, size_t);
+/// @brief 比较函数类型
+using Compare_Func_t = int (*)(const void*, const void*, size_t);
+
+/**
+ * @brief  阻止编译器消除对缓冲区的访问
+ *
+ * @param  ptr  缓冲区
+ */
+QAQ_INLINE void escape(const void* ptr) noexcept
+{
+  __asm__ volatile("" : : "r"(ptr) : "memory");
+}
+
+/**
+ * @brief  读取时间戳 (目标板: CPU周期，主机: 纳秒)
+ *
+ * @return uint32_t  时间戳
+ */
+QAQ_INLINE uint32_t timestamp(void) noexcept
+{
+#if defined(__arm__)
+  return DWT->CYCCNT;
+#else
+  return static_cast<uint32_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count());
+#endif
+}
+
+/// @brief 时间戳单位
+#if defined(__arm__)
+constexpr const char* TIMESTAMP_UNIT = "cycles";
+#else
+constexpr const char* TIMESTAMP_UNIT = "ns";
+#endif
+
+__attribute__((noinline)) inline void builtin_copy(void* dest, const void* src, size_t n) noexcept
+{
+  __builtin_memcpy(dest, src, n);
+}
+
+__attribute__((noinline)) inline void builtin_move(void* dest, const void* src, size_t n) noexcept
+{
+  __builtin_memmove(dest, src, n);
+}
+
+__attribute__((noinline)) inline void builtin_set(void* dest, int ch, size_t n) noexcept
+{
+  __builtin_memset(dest, ch, n);
+}
+
+__attribute__((noinline)) inline int builtin_compare(const void* s1, const void* s2, size_t n) noexcept
+{
+  return __builtin_memcmp(s1, s2, n);
+}
+
+__attribute__((noinline)) inline void vector_copy(void* dest, const void* src, size_t n) noexcept
+{
+  memory_internal::vector_copy(dest, src, n);
+}
+
+__attribute__((noinline)) inline void vector_move(void* dest, const void* src, size_t n) noexcept
+{
+  memory_internal::vector_copy_backward(dest, src, n);
+}
+
+__attribute__((noinline)) inline void vector_set(void* dest, int ch, size_t n) noexcept
+{
+  memory_internal::vector_set(dest, ch, n);
+}
+
+__attribute__((noinline)) inline int vector_compare(const void* s1, const void* s2, size_t n) noexcept
+{
+  return memory_internal::vector_compare(s1, s2, n);
+}
+} /* namespace bench */
+} /* namespace memory_internal */
+} /* namespace system_internal */
+
+/// @brief 名称空间 内存
+namespace memory
+{
+/**
+ * @brief 快速内存函数 基准测试
+ *
+ * @tparam Repeat  每个区间的重复次数
+ */
+template <uint32_t Repeat = 200>
+class Fast_Memory_Bench final
+{
+  /// @brief 大小类型
+  using Bench_Size = size_t;
+
+public:
+  /// @brief 输出函数类型 (每次输出一行，不含换行符)
+  using Print_Func_t = void (*)(const char*);
+
+private:
+  /// @brief 大小区间
+  struct Bucket
+  {
+    Bench_Size low;  /* 最小大小 */
+    Bench_Size high; /* 最大大小 */
+  };
+
+  /// @brief 大小区间表
+  static constexpr Bucket BUCKETS[] = {
+    {1,    8   },
+    {9,    32  },
+    {33,   128 },
+    {129,  512 },
+    {513,  2048},
+    {2049, 4096},
+  };
+
+  /// @brief 最大大小
+  static constexpr Bench_Size MAX_SIZE = 4096;
+  /// @brief 每个区间的采样大小数
+  static constexpr Bench_Size SAMPLES  = 16;
+
+  /// @brief 源缓冲区
+  alignas(32) static inline uint8_t s_src[MAX_SIZE + 64];
+  /// @brief 目标缓冲区
+  alignas(32) static inline uint8_t s_dst[MAX_SIZE + 64];
+
+  /**
+   * @brief  计算区间内第 i 个采样大小
+   */
+  static Bench_Size sample(const Bucket& bucket, Bench_Size i) noexcept
+  {
+    return bucket.low + (bucket.high - bucket.low) * i / (SAMPLES - 1);
+  }
+
+  /**
+   * @brief  测量拷贝函数在区间内的平均耗时
+   *
+   * @param  func     拷贝函数
+   * @param  bucket   大小区间
+   * @param  overlap  是否在同一缓冲区内反向重叠移动
+   * @return uint32_t 每次调用的平均耗时
+   */
+  static uint32_t measure(system_internal::memory_internal::bench::Copy_Func_t func, const Bucket& bucket, bool overlap) noexcept
+  {
+    using namespace system_internal::memory_internal::bench;
+
+    uint32_t total = 0;
+
+    for (uint32_t r = 0; r < Repeat; ++r)
+    {
+      const Bench_Size sa    = (r & 1) ? 1 : 0;
+      const Bench_Size da    = (r & 1) ? 3 : 0;
+      const uint32_t   start = timestamp();
+
+      for (Bench_Size i = 0; i < SAMPLES; ++i)
+      {
+        if (overlap)
+        {
+          func(s_dst + 8 + da, s_dst + sa, sample(bucket, i));
+        }
+        else
+        {
+          func(s_dst + da, s_src + sa, sample(bucket, i));
+        }
+
+        escape(s_dst);
+      }
+
+      total += timestamp() - start;
+    }
+
+    return total / (Repeat * SAMPLES);
+  }
+
+  /**
+   * @brief  测量填充函数在区间内的平均耗时
+   */
+  static uint32_t measure(system_internal::memory_internal::bench::Set_Func_t func, const Bucket& bucket) noexcept
+  {
+    using namespace system_internal::memory_internal::bench;
+
+    uint32_t total = 0;
+
+    for (uint32_t r = 0; r < Repeat; ++r)
+    {
+      const Bench_Size da    = (r & 1) ? 3 : 0;
+      const uint32_t   start = timestamp();
+
+      for (Bench_Size i = 0; i < SAMPLES; ++i)
+      {
+        func(s_dst + da, static_cast<int>(r), sample(bucket, i));
+        escape(s_dst);
+      }
+
+      total += timestamp() - start;
+    }
+
+    return total / (Repeat * SAMPLES);
+  }
+
+  /**
+   * @brief  测量比较函数在区间内的平均耗时 (内容相等，比较全部字节)
+   */
+  static uint32_t measure(system_internal::memory_internal::bench::Compare_Func_t func, const Bucket& bucket) noexcept
+  {
+    using namespace system_internal::memory_internal::bench;
+
+    uint32_t     total = 0;
+    volatile int sink  = 0;
+
+    for (uint32_t r = 0; r < Repeat; ++r)
+    {
+      const Bench_Size sa = (r & 1) ? 1 : 0;
+      const Bench_Size da = (r & 1) ? 3 : 0;
+
+      __builtin_memcpy(s_dst + da, s_src + sa, MAX_SIZE);
+
+      const uint32_t start = timestamp();
+
+      for (Bench_Size i = 0; i < SAMPLES; ++i)
+      {
+        sink = func(s_src + sa, s_dst + da, sample(bucket, i));
+      }
+
+      total += timestamp() - start;
+    }
+
+    (void)sink;
+    return total / (Repeat * SAMPLES);
+  }
+
+  /**
+   * @brief  输出一行对比结果
+   */
+  static void report(Print_Func_t print, const char* name, const Bucket& bucket, uint32_t builtin, uint32_t vector) noexcept
+  {
+    char line[96];
+    snprintf(line, sizeof(line), "%-8s %5u-%-5u %10lu %10lu %7.2f", name, static_cast<unsigned>(bucket.low), static_cast<unsigned>(bucket.high), static_cast<unsigned long>(builtin), static_cast<unsigned long>(vector),
+             0 != builtin ? static_cast<double>(vector) / builtin : 0.0);
+    print(line);
+  }
+
+public:
+  /**
+   * @brief  运行基准测试并输出表格 (向量/内置 > 1 表示向量后端更慢)
+   *
+   * @param  print  输出函数
+   */
+  static void run(Print_Func_t print) noexcept
+  {
+    using namespace system_internal::memory_internal::bench;
+
+#if defined(__arm__)
+    CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+    DWT->CTRL        |= DWT_CTRL_CYCCNTENA_Msk;
+#endif
+
+    for (Bench_Size i = 0; i < sizeof(s_src); ++i)
+    {
+      s_src[i] = static_cast<uint8_t>(i * 131u + 7u);
+    }
+
+    char header[96];
+    snprintf(header, sizeof(header), "%-8s %-11s %10s %10s %7s  (%s/call)", "path", "bytes", "builtin", "vector", "ratio", TIMESTAMP_UNIT);
+    print(header);
+
+    for (const Bucket& bucket : BUCKETS)
+    {
+      report(print, "copy.vec", bucket, measure(builtin_copy, bucket, false), measure(vector_copy, bucket, false));
+    }
+
+    for (const Bucket& bucket : BUCKETS)
+    {
+      report(print, "move.vec", bucket, measure(builtin_move, bucket, true), measure(vector_move, bucket, true));
+    }
+
+    for (const Bucket& bucket : BUCKETS)
+    {
+      report(print, "set.vec", bucket, measure(builtin_set, bucket), measure(vector_set, bucket));
+    }
+
+    for (const Bucket& bucket : BUCKETS)
+    {
+      report(print, "cmp.vec", bucket, measure(builtin_compare, bucket), measure(vector_compare, bucket));
+    }
+  }
+};
+} /* namespace memory */
+} /* namespace system */
+} /* namespace QAQ */
+
+#endif /* __FAST_MEMORY_BENCH_HPP__ */
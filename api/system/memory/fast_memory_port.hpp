@@ -0,0 +1,244 @@
+#ifndef __FAST_MEMORY_PORT_HPP__
+#define __FAST_MEMORY_PORT_HPP__
+
+/**
+ * @brief 内存模块 移植层 (快速内存函数、拷贝引擎)
+ *
+ * @note  目标板 (ARM) 使用 CMSIS 屏障、SCB 缓存维护与 ThreadX 中断保护; 主机构建 (测试/仿真) 不依赖 ThreadX 与 HAL,
+ *        屏障退化为线程栅栏，缓存维护为空操作，中断保护退化为递归互斥锁，DMA区域默认为空
+ */
+#if defined(__arm__)
+
+#include "system_include.hpp"
+
+#else
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+#include <atomic>
+#include <mutex>
+#include <utility>
+
+#ifndef QAQ_INLINE
+#define QAQ_INLINE inline __attribute__((always_inline))
+#endif
+
+#ifndef QAQ_O3
+#define QAQ_O3 __attribute__((optimize("O3")))
+#endif
+
+#ifndef QAQ_NO_COPY_MOVE
+#define QAQ_NO_COPY_MOVE(NAME)           \
+  NAME(const NAME&)            = delete; \
+  NAME& operator=(const NAME&) = delete; \
+  NAME(NAME&&)                 = delete; \
+  NAME& operator=(NAME&&)      = delete;
+#endif
+
+#ifndef QAQ_ALIGN
+#define QAQ_ALIGN(N) __attribute__((aligned(N)))
+#endif
+
+#ifndef QAQ_DMA_BUFFER
+#define QAQ_DMA_BUFFER
+#endif
+
+#ifndef NO_COPY
+#define NO_COPY(NAME)                    \
+  NAME(const NAME&)            = delete; \
+  NAME& operator=(const NAME&) = delete;
+#endif
+
+#ifndef FAST_MEMORY_CACHE_MAINTENANCE
+#define FAST_MEMORY_CACHE_MAINTENANCE 1
+#endif
+
+#ifndef FAST_MEMORY_VECTOR_BACKEND
+#define FAST_MEMORY_VECTOR_BACKEND 1
+#endif
+
+#ifndef DMA_REGION_START_ADDRESSES
+#define DMA_REGION_START_ADDRESSES 0x00000001
+#define DMA_REGION_END_ADDRESSES   0x00000000
+#endif
+
+#endif /* defined(__arm__) */
+
+/// @brief 名称空间 QAQ
+namespace QAQ
+{
+/// @brief 名称空间 系统
+namespace system
+{
+/// @brief 命名空间 内部
+namespace system_internal
+{
+/// @brief 命名空间 内存 内部
+namespace memory_internal
+{
+/// @brief 命名空间 移植层
+namespace port
+{
+/// @brief DMA区域起始地址
+constexpr uintptr_t DMA_REGION_START = DMA_REGION_START_ADDRESSES;
+/// @brief DMA区域结束地址
+constexpr uintptr_t DMA_REGION_END   = DMA_REGION_END_ADDRESSES;
+/// @brief 缓存行大小
+constexpr uintptr_t CACHE_LINE_SIZE  = 32;
+
+#if !defined(__arm__)
+
+/**
+ * @brief 移植层 主机缓存操作计数 (用于验证缓存维护次数)
+ */
+struct Cache_Counter
+{
+  static inline uint32_t clean            = 0; /* 清除次数 */
+  static inline uint32_t invalidate       = 0; /* 失效次数 */
+  static inline uint32_t clean_invalidate = 0; /* 清除并失效次数 */
+
+  /**
+   * @brief  主机缓存操作计数 清零
+   */
+  static void reset(void) noexcept
+  {
+    clean            = 0;
+    invalidate       = 0;
+    clean_invalidate = 0;
+  }
+};
+
+#endif /* !defined(__arm__) */
+
+/**
+ * @brief  移植层 数据内存屏障
+ */
+QAQ_INLINE void data_barrier(void) noexcept
+{
+#if defined(__arm__)
+  __DMB();
+#else
+  std::atomic_thread_fence(std::memory_order_seq_cst);
+#endif
+}
+
+/**
+ * @brief  移植层 数据同步屏障
+ */
+QAQ_INLINE void sync_barrier(void) noexcept
+{
+#if defined(__arm__)
+  __DSB();
+#else
+  std::atomic_thread_fence(std::memory_order_seq_cst);
+#endif
+}
+
+/**
+ * @brief  移植层 清除缓存 (写回至内存，供DMA读取)
+ *
+ * @param  ptr   起始地址
+ * @param  size  大小
+ */
+QAQ_INLINE void cache_clean(const void* ptr, size_t size) noexcept
+{
+#if defined(__arm__)
+  const uintptr_t start = reinterpret_cast<uintptr_t>(ptr) & ~(CACHE_LINE_SIZE - 1);
+  const uintptr_t end   = reinterpret_cast<uintptr_t>(ptr) + size;
+  SCB_CleanDCache_by_Addr(reinterpret_cast<uint32_t*>(start), static_cast<int32_t>(end - start));
+#else
+  (void)ptr;
+  (void)size;
+  ++Cache_Counter::clean;
+#endif
+}
+
+/**
+ * @brief  移植层 清除并失效缓存 (读取DMA写入的数据前调用，首尾不完整的缓存行中的CPU数据不会丢失)
+ *
+ * @param  ptr   起始地址
+ * @param  size  大小
+ */
+QAQ_INLINE void cache_clean_invalidate(const void* ptr, size_t size) noexcept
+{
+#if defined(__arm__)
+  const uintptr_t start = reinterpret_cast<uintptr_t>(ptr) & ~(CACHE_LINE_SIZE - 1);
+  const uintptr_t end   = reinterpret_cast<uintptr_t>(ptr) + size;
+  SCB_CleanInvalidateDCache_by_Addr(reinterpret_cast<uint32_t*>(start), static_cast<int32_t>(end - start));
+#else
+  (void)ptr;
+  (void)size;
+  ++Cache_Counter::clean_invalidate;
+#endif
+}
+
+/**
+ * @brief  移植层 失效缓存 (DMA写入完成后调用，首尾不完整缓存行中的CPU数据会被丢弃，目标区域应按缓存行对齐)
+ *
+ * @param  ptr   起始地址
+ * @param  size  大小
+ */
+QAQ_INLINE void cache_invalidate(const void* ptr, size_t size) noexcept
+{
+#if defined(__arm__)
+  const uintptr_t start = reinterpret_cast<uintptr_t>(ptr) & ~(CACHE_LINE_SIZE - 1);
+  const uintptr_t end   = reinterpret_cast<uintptr_t>(ptr) + size;
+  SCB_InvalidateDCache_by_Addr(reinterpret_cast<uint32_t*>(start), static_cast<int32_t>(end - start));
+#else
+  (void)ptr;
+  (void)size;
+  ++Cache_Counter::invalidate;
+#endif
+}
+
+#if defined(__arm__)
+
+/// @brief 移植层 中断保护器 (任务与中断间互斥)
+using Irq_Guard = kernel::Interrupt_Guard;
+
+#else
+
+/**
+ * @brief 移植层 中断保护器 主机版本 (递归互斥锁，允许完成回调中再次提交)
+ */
+class Irq_Guard
+{
+private:
+  /**
+   * @brief  中断保护器 获取全局锁
+   *
+   * @return std::recursive_mutex&  全局锁
+   */
+  static std::recursive_mutex& lock(void)
+  {
+    static std::recursive_mutex s_lock;
+    return s_lock;
+  }
+
+public:
+  /**
+   * @brief 中断保护器 构造函数
+   */
+  Irq_Guard()
+  {
+    lock().lock();
+  }
+
+  /**
+   * @brief 中断保护器 析构函数
+   */
+  ~Irq_Guard()
+  {
+    lock().unlock();
+  }
+};
+
+#endif /* defined(__arm__) */
+} /* namespace port */
+} /* namespace memory_internal */
+} /* namespace system_internal */
+} /* namespace system */
+} /* namespace QAQ */
+
+#endif /* __FAST_MEMORY_PORT_HPP__ */
@@ -0,0 +1,240 @@
+/**
+ * @file   fast_memory_test.cpp
+ * @brief  快速内存函数 主机差分测试 (与 libc 逐字节对比)
+ *
+ * @note   仅用于主机，不参与固件编译 (已加入 eide excludeList);
+ *         覆盖大小 0 ~ 4096 与源/目标对齐 0 ~ 15 的全部组合，检查结果、返回值与越界写入;
+ *         整个地址空间视为DMA区域，同时经主机缓存操作计数验证缓存维护次数
+ *
+ *         构建 (仓库根目录):
+ *         g++ -std=c++17 -O2 -g -fsanitize=address,undefined -Iapi/system/memory \
+ *             api/system/memory/fast_memory_test.cpp -o fast_memory_test && ./fast_memory_test
+ */
+#include <cstdint>
+
+// 整个地址空间视为DMA区域，使每次调用都经过缓存维护路径
+#define DMA_REGION_START_ADDRESSES 0x00000001
+#define DMA_REGION_END_ADDRESSES   UINTPTR_MAX
+
+#include "fast_memory.hpp"
+
+#include <cstdio>
+#include <cstring>
+
+using namespace QAQ::system::memory;
+using Cache_Counter = QAQ::system::system_internal::memory_internal::port::Cache_Counter;
+
+namespace
+{
+/// @brief 最大测试大小
+constexpr size_t MAX_SIZE  = 4096;
+/// @brief 对齐偏移数
+constexpr size_t ALIGNS    = 16;
+/// @brief 缓冲区前后保护区大小
+constexpr size_t GUARD     = 32;
+/// @brief 缓冲区大小
+constexpr size_t BUF_SIZE  = GUARD + ALIGNS + MAX_SIZE + GUARD;
+/// @brief 保护区填充值
+constexpr uint8_t CANARY   = 0xA5;
+
+/// @brief 源数据 (伪随机)
+alignas(64) uint8_t g_src[BUF_SIZE];
+/// @brief 被测目标缓冲区
+alignas(64) uint8_t g_dst[BUF_SIZE];
+/// @brief 参考目标缓冲区
+alignas(64) uint8_t g_ref[BUF_SIZE];
+
+/// @brief 失败的检查数
+unsigned g_failures = 0;
+
+#define CHECK(cond, ...)                                         \
+  do                                                             \
+  {                                                              \
+    if (!(cond) && ++g_failures <= 20)                           \
+    {                                                            \
+      printf("%s:%d: CHECK(%s) failed: ", __FILE__, __LINE__, #cond); \
+      printf(__VA_ARGS__);                                       \
+      printf("\n");                                              \
+    }                                                            \
+  } while (0)
+
+/**
+ * @brief  填充伪随机数据
+ *
+ * @param  buf   缓冲区
+ * @param  size  大小
+ * @param  seed  种子
+ */
+void fill_random(uint8_t* buf, size_t size, uint32_t seed)
+{
+  for (size_t i = 0; i < size; ++i)
+  {
+    seed   = seed * 1664525u + 1013904223u;
+    buf[i] = static_cast<uint8_t>(seed >> 24);
+  }
+}
+
+/**
+ * @brief  返回值符号
+ */
+int sign(int value)
+{
+  return (value > 0) - (value < 0);
+}
+
+/**
+ * @brief  fast_memcpy: 全部大小与源/目标对齐组合
+ */
+void test_memcpy(void)
+{
+  for (size_t n = 0; n <= MAX_SIZE; ++n)
+  {
+    for (size_t sa = 0; sa < ALIGNS; ++sa)
+    {
+      for (size_t da = 0; da < ALIGNS; ++da)
+      {
+        memset(g_dst, CANARY, sizeof(g_dst));
+        memset(g_ref, CANARY, sizeof(g_ref));
+
+        void* ret = fast_memcpy(g_dst + GUARD + da, g_src + GUARD + sa, n);
+        memcpy(g_ref + GUARD + da, g_src + GUARD + sa, n);
+
+        CHECK(ret == g_dst + GUARD + da, "memcpy n=%zu sa=%zu da=%zu return", n, sa, da);
+        CHECK(0 == memcmp(g_dst, g_ref, sizeof(g_dst)), "memcpy n=%zu sa=%zu da=%zu", n, sa, da);
+      }
+    }
+  }
+}
+
+/**
+ * @brief  fast_memmove: 同一缓冲区内全部大小与源/目标对齐组合 (含正向、反向与完全重叠)
+ */
+void test_memmove(void)
+{
+  for (size_t n = 0; n <= MAX_SIZE; ++n)
+  {
+    for (size_t sa = 0; sa < ALIGNS; ++sa)
+    {
+      for (size_t da = 0; da < ALIGNS; ++da)
+      {
+        memcpy(g_dst, g_src, sizeof(g_dst));
+        memcpy(g_ref, g_src, sizeof(g_ref));
+
+        void* ret = fast_memmove(g_dst + GUARD + da, g_dst + GUARD + sa, n);
+        memmove(g_ref + GUARD + da, g_ref + GUARD + sa, n);
+
+        CHECK(ret == g_dst + GUARD + da, "memmove n=%zu sa=%zu da=%zu return", n, sa, da);
+        CHECK(0 == memcmp(g_dst, g_ref, sizeof(g_dst)), "memmove n=%zu sa=%zu da=%zu", n, sa, da);
+      }
+    }
+  }
+}
+
+/**
+ * @brief  fast_memset: 全部大小与目标对齐组合
+ */
+void test_memset(void)
+{
+  static const int values[] = { 0x00, 0xFF, 0x5A, 0x1234 };
+
+  for (size_t n = 0; n <= MAX_SIZE; ++n)
+  {
+    for (size_t da = 0; da < ALIGNS; ++da)
+    {
+      for (int value : values)
+      {
+        memset(g_dst, CANARY, sizeof(g_dst));
+        memset(g_ref, CANARY, sizeof(g_ref));
+
+        void* ret = fast_memset(g_dst + GUARD + da, value, n);
+        memset(g_ref + GUARD + da, value, n);
+
+        CHECK(ret == g_dst + GUARD + da, "memset n=%zu da=%zu return", n, da);
+        CHECK(0 == memcmp(g_dst, g_ref, sizeof(g_dst)), "memset n=%zu da=%zu value=%#x", n, da, value);
+      }
+    }
+  }
+}
+
+/**
+ * @brief  fast_memcmp: 全部大小与对齐组合，相等及首/中/尾处单字节差异 (双向)
+ */
+void test_memcmp(void)
+{
+  for (size_t n = 0; n <= MAX_SIZE; ++n)
+  {
+    for (size_t sa = 0; sa < ALIGNS; ++sa)
+    {
+      for (size_t da = 0; da < ALIGNS; ++da)
+      {
+        const uint8_t* a = g_src + GUARD + sa;
+        uint8_t*       b = g_dst + GUARD + da;
+
+        memcpy(b, a, n);
+        CHECK(0 == fast_memcmp(a, b, n), "memcmp n=%zu sa=%zu da=%zu equal", n, sa, da);
+
+        if (0 == n)
+        {
+          continue;
+        }
+
+        const size_t positions[] = { 0, n / 2, n - 1, (n * 7 + sa * 31 + da) % n };
+
+        for (size_t pos : positions)
+        {
+          const uint8_t saved = b[pos];
+          b[pos]              = static_cast<uint8_t>(saved + 1 + ((sa + da) % 254));
+
+          CHECK(sign(fast_memcmp(a, b, n)) == sign(memcmp(a, b, n)), "memcmp n=%zu sa=%zu da=%zu pos=%zu", n, sa, da, pos);
+          CHECK(sign(fast_memcmp(b, a, n)) == sign(memcmp(b, a, n)), "memcmp n=%zu sa=%zu da=%zu pos=%zu (swapped)", n, sa, da, pos);
+
+          b[pos] = saved;
+        }
+      }
+    }
+  }
+}
+
+/**
+ * @brief  缓存维护次数: 读取前清除并失效源，写入后清除目标，零长度不维护
+ */
+void test_cache_maintenance(void)
+{
+  Cache_Counter::reset();
+  fast_memcpy(g_dst, g_src, 0);
+  fast_memset(g_dst, 0, 0);
+  fast_memmove(g_dst, g_src, 0);
+  fast_memcmp(g_dst, g_src, 0);
+  CHECK(0 == Cache_Counter::clean && 0 == Cache_Counter::invalidate && 0 == Cache_Counter::clean_invalidate, "zero length");
+
+  Cache_Counter::reset();
+  fast_memcpy(g_dst, g_src, 64);
+  CHECK(1 == Cache_Counter::clean_invalidate && 1 == Cache_Counter::clean && 0 == Cache_Counter::invalidate, "memcpy");
+
+  Cache_Counter::reset();
+  fast_memmove(g_dst + 1, g_dst, 64);
+  CHECK(1 == Cache_Counter::clean_invalidate && 1 == Cache_Counter::clean && 0 == Cache_Counter::invalidate, "memmove");
+
+  Cache_Counter::reset();
+  fast_memset(g_dst, 0, 64);
+  CHECK(0 == Cache_Counter::clean_invalidate && 1 == Cache_Counter::clean && 0 == Cache_Counter::invalidate, "memset");
+
+  Cache_Counter::reset();
+  fast_memcmp(g_dst, g_src, 64);
+  CHECK(2 == Cache_Counter::clean_invalidate && 0 == Cache_Counter::clean && 0 == Cache_Counter::invalidate, "memcmp");
+}
+} /* namespace */
+
+int main(void)
+{
+  fill_random(g_src, sizeof(g_src), 0x12345678u);
+
+  test_cache_maintenance();
+  test_memcpy();
+  test_memmove();
+  test_memset();
+  test_memcmp();
+
+  printf("fast_memory_test: %s (%u failures)\n", 0 == g_failures ? "OK" : "FAILED", g_failures);
+  return 0 == g_failures ? 0 : 1;
+}
@@ -197,19 +197,21 @@ private:
    *
    * @param  data      要探视的数据(指针)
    * @param  request   要探视的数据数量
+   * @param  offset    相对读取位置的偏移
    * @return uint32_t  实际探视的数据数量
    */
-  uint32_t QAQ_O3 try_peek(T* data, uint32_t request) const noexcept
+  uint32_t QAQ_O3 try_peek(T* data, uint32_t request, uint32_t offset) const noexcept
   {
-    const uint32_t used = available();
+    const uint32_t total = available();
 
-    if (request == 0 || data == nullptr || used == 0)
+    if (request == 0 || data == nullptr || total <= offset)
     {
       return 0;
     }
 
+    const uint32_t used            = total - offset;
     const uint32_t copy_size       = (request > used) ? used : request;
-    const uint32_t current_head    = m_head;
+    const uint32_t current_head    = (m_head + offset) & (N - 1);
     const uint32_t first_copy      = N - (current_head & (N - 1));
     const uint32_t first_copy_size = (first_copy < copy_size) ? first_copy : copy_size;
 
@@ -300,12 +302,13 @@ protected:
    *
    * @param  data     要探视的数据(指针)
    * @param  request  要探视的数据数量
+   * @param  offset   相对读取位置的偏移
    * @return uint32_t 实际探视的数据数量
    */
-  uint32_t peek(T* data, uint32_t request) noexcept
+  uint32_t peek(T* data, uint32_t request, uint32_t offset = 0) noexcept
   {
     system::kernel::Interrupt_Guard lock;
-    const uint32_t                  result = try_peek(data, request);
+    const uint32_t                  result = try_peek(data, request, offset);
     return result;
   }
 
@@ -376,6 +379,107 @@ public:
   {
     return ((m_tail + 1) & (N - 1)) == m_head;
   }
+
+  /**
+   * @brief  环形缓冲区 原地查找元素 (分两段在缓冲区内扫描，不拷贝数据)
+   *
+   * @param  value      要查找的元素
+   * @param  offset     相对读取位置的起始偏移
+   * @return uint32_t   相对读取位置的偏移，未找到返回UINT32_MAX
+   * @note   仅支持单字节元素，逐段调用 memchr (按字扫描)；
+   *         单生产者单消费者下由消费者或生产者调用均无需关中断
+   */
+  template <bool enable = (1 == sizeof(T)), typename = std::enable_if_t<enable>>
+  uint32_t QAQ_O3 find(T value, uint32_t offset = 0) const noexcept
+  {
+    const uint32_t current_head = m_head;
+    const uint32_t used         = (m_tail - current_head) & (N - 1);
+
+    if (offset >= used)
+    {
+      return UINT32_MAX;
+    }
+
+    const uint32_t start      = (current_head + offset) & (N - 1);
+    const uint32_t first_size = std::min(N - start, used - offset);
+    const void*    found      = memchr(&m_buffer[start], static_cast<uint8_t>(value), first_size);
+
+    if (nullptr != found)
+    {
+      return offset + static_cast<uint32_t>(static_cast<const T*>(found) - &m_buffer[start]);
+    }
+
+    if (first_size < used - offset)
+    {
+      found = memchr(m_buffer, static_cast<uint8_t>(value), used - offset - first_size);
+
+      if (nullptr != found)
+      {
+        return offset + first_size + static_cast<uint32_t>(static_cast<const T*>(found) - m_buffer);
+      }
+    }
+
+    return UINT32_MAX;
+  }
+
+  /**
+   * @brief  环形缓冲区 读取位置
+   *
+   * @return uint32_t 读取位置 (缓冲区下标)
+   */
+  uint32_t read_index(void) const noexcept
+  {
+    return m_head;
+  }
+
+  /**
+   * @brief  环形缓冲区 写入位置
+   *
+   * @return uint32_t 写入位置 (缓冲区下标)
+   */
+  uint32_t write_index(void) const noexcept
+  {
+    return m_tail;
+  }
+
+  /**
+   * @brief  环形缓冲区 原地查看数据 (不拷贝数据，回绕时分为两段)
+   *
+   * @param  first        第一段起始地址 - 引用返回
+   * @param  first_size   第一段数据数量 - 引用返回
+   * @param  second       第二段起始地址 (未回绕时为nullptr) - 引用返回
+   * @param  request      要查看的数据数量
+   * @return uint32_t     实际可查看的数据数量 (两段之和)
+   * @note   数据在 skip() 或读取前保持有效
+   */
+  uint32_t view(const T*& first, uint32_t& first_size, const T*& second, uint32_t request) const noexcept
+  {
+    const uint32_t current_head = m_head;
+    const uint32_t size         = std::min(request, (m_tail - current_head) & (N - 1));
+
+    first_size = std::min(size, N - current_head);
+    first      = &m_buffer[current_head];
+    second     = (first_size < size) ? m_buffer : nullptr;
+
+    return size;
+  }
+
+  /**
+   * @brief  环形缓冲区 丢弃数据 (与 view() 配合完成原地读取)
+   *
+   * @param  request      要丢弃的数据数量
+   * @return uint32_t     实际丢弃的数据数量
+   */
+  uint32_t skip(uint32_t request) noexcept
+  {
+    system::kernel::Interrupt_Guard lock;
+    const uint32_t                  current_head = m_head;
+    const uint32_t                  size         = std::min(request, (m_tail - current_head) & (N - 1));
+
+    m_roll_back_save = current_head;
+    m_head           = (current_head + size) & (N - 1);
+    return size;
+  }
 };
 } /* namespace ring_buffer_internal */
 } /* namespace system_internal */
@@ -479,11 +583,12 @@ public:
    *
    * @param  data     要探视的数据(指针)
    * @param  request  要探视的数据数量
+   * @param  offset   相对读取位置的偏移
    * @return uint32_t 实际探视的数据数量
    */
-  uint32_t peek(T* data, uint32_t request) noexcept
+  uint32_t peek(T* data, uint32_t request, uint32_t offset = 0) noexcept
   {
-    return Base::peek(data, request);
+    return Base::peek(data, request, offset);
   }
 
   /**
@@ -583,11 +688,12 @@ public:
    *
    * @param  data     要探视的数据(指针)
    * @param  request  要探视的数据数量
+   * @param  offset   相对读取位置的偏移
    * @return uint32_t 实际探视的数据数量
    */
-  uint32_t peek(T* data, uint32_t request) noexcept
+  uint32_t peek(T* data, uint32_t request, uint32_t offset = 0) noexcept
   {
-    return Base::peek(data, request);
+    return Base::peek(data, request, offset);
   }
 
   /**
@@ -651,6 +757,9 @@ private:
     {
       kernel::Interrupt_Guard lock;
 
+      // 上一次输入中止 (未调用 input_complete) 时可能仍标记为额外缓冲区
+      m_is_used_ex_buffer = false;
+
       if (new_tail > current_head && current_head > current_tail)
       {
         this->m_head = new_tail;
@@ -725,11 +834,12 @@ public:
    *
    * @param  data     要探视的数据(指针)
    * @param  request  要探视的数据数量
+   * @param  offset   相对读取位置的偏移
    * @return uint32_t 实际探视的数据数量
    */
-  uint32_t peek(T* data, uint32_t request) noexcept
+  uint32_t peek(T* data, uint32_t request, uint32_t offset = 0) noexcept
   {
-    return Base::peek(data, request);
+    return Base::peek(data, request, offset);
   }
 
   /**
@@ -858,11 +968,12 @@ public:
    *
    * @param  data     要探视的数据(指针)
    * @param  request  要探视的数据数量
+   * @param  offset   相对读取位置的偏移
    * @return uint32_t 实际探视的数据数量
    */
-  uint32_t peek(T* data, uint32_t request) noexcept
+  uint32_t peek(T* data, uint32_t request, uint32_t offset = 0) noexcept
   {
-    return Base::peek(data, request);
+    return Base::peek(data, request, offset);
   }
 
   /**
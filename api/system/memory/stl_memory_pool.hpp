@@ -38,8 +38,8 @@ public:
   };
 
 private:
-  // 使用结构型内存池
-  using Pool_Type = Struct_Memory_Pool<Pool_Size, T>;
+  // 使用字节型内存池 (连续容器一次申请n个元素，结构型内存池只能提供单个元素)
+  using Pool_Type = Byte_Memory_Pool<Pool_Size * sizeof(T)>;
   static Pool_Type s_pool;
 
 public:
@@ -73,7 +73,7 @@ public:
     size_t bytes_needed = n * sizeof(T);
 
     // 使用字节型分配以支持非固定大小请求
-    void* ptr           = s_pool.template allocate(bytes_needed, TX_WAIT_FOREVER);
+    void* ptr           = s_pool.allocate(bytes_needed, TX_WAIT_FOREVER);
     if (!ptr)
     {
       return nullptr;
@@ -29,6 +29,8 @@ extern TX_THREAD _tx_timer_thread;
 #define QAQ_SRAM3       __attribute__((section(".sram3")))
 /// @brief 宏定义 置于SRAM4中运行
 #define QAQ_SRAM4       __attribute__((section(".sram4")))
+/// @brief 宏定义 置于DMA缓冲区 (SRAM1，与 DMA_REGION_START_ADDRESSES 一致)
+#define QAQ_DMA_BUFFER  QAQ_SRAM1
 
 /// @brief 宏定义 禁止拷贝
 #define NO_COPY(NAME)                    \
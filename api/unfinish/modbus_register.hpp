@@ -2,6 +2,7 @@
 #define __MODBUS_REGISTER_HPP__
 
 #include "system_include.hpp"
+#include "fast_memory.hpp"
 
 /// @brief 名称空间 QAQ
 namespace QAQ
@@ -34,21 +35,121 @@ namespace protocol_internal
 /// @brief 名称空间 Modbus 内部
 namespace modbus_internal
 {
-template <typename... Registers>
-struct Storage;
+/// @brief 稠密索引地址跨度上限 (超过时改用二分查找)
+static constexpr uint32_t DENSE_SPAN_MAX = 512;
+/// @brief 稠密索引空洞标记
+static constexpr uint16_t DENSE_HOLE     = 0xFFFF;
 
-template <typename First, typename... Rest>
-struct Storage<First, Rest...>
+/// @brief 连续地址区间 (按地址排序并合并相邻段)
+struct Register_Run
 {
-  uint16_t         data[First::length] = { 0 };
-  Storage<Rest...> rest;
+  uint32_t start  = 0; /* 起始地址 */
+  uint32_t end    = 0; /* 结束地址 (不含) */
+  uint32_t offset = 0; /* 储存区偏移 */
 };
 
-template <>
-struct Storage<>
+/**
+ * @brief 寄存器布局表 (编译期生成)
+ *
+ * @tparam Registers  寄存器段
+ * @note   段按起始地址排序后依次排布在同一储存区中，地址相邻的段合并为一个区间，
+ *         因此任意地址区间与每个区间的交集都对应一块连续储存
+ */
+template <typename... Registers>
+struct Register_Layout
 {
+  /// @brief 段数量
+  static constexpr uint32_t COUNT = sizeof...(Registers);
+
+  Register_Run run[COUNT ? COUNT : 1];
+  uint32_t     run_count;
+  uint32_t     total; /* 寄存器总数 */
+  bool         valid; /* 段长度非0、不越出16位地址空间且互不重叠 */
+
+  /**
+   * @brief  寄存器布局表 构造函数
+   */
+  constexpr Register_Layout() : run(), run_count(0), total(0), valid(true)
+  {
+    const uint32_t start[COUNT ? COUNT : 1]  = { Registers::start... };
+    const uint32_t length[COUNT ? COUNT : 1] = { Registers::length... };
+    uint32_t       order[COUNT ? COUNT : 1]  = {};
+
+    for (uint32_t i = 0; i < COUNT; ++i)
+    {
+      uint32_t j = i;
+
+      while (j > 0 && start[order[j - 1]] > start[i])
+      {
+        order[j] = order[j - 1];
+        --j;
+      }
+
+      order[j] = i;
+    }
+
+    for (uint32_t i = 0; i < COUNT; ++i)
+    {
+      const uint32_t begin = start[order[i]];
+      const uint32_t end   = begin + length[order[i]];
+
+      if (0 == length[order[i]] || end > 0x10000U || (0 != run_count && begin < run[run_count - 1].end))
+      {
+        valid = false;
+      }
+      else if (0 != run_count && begin == run[run_count - 1].end)
+      {
+        run[run_count - 1].end = end;
+      }
+      else
+      {
+        run[run_count++] = { begin, end, total };
+      }
+
+      total += length[order[i]];
+    }
+  }
+};
+
+/**
+ * @brief 寄存器稠密索引 (编译期生成，地址 - 跨度起点 => 储存区偏移)
+ *
+ * @tparam Span  地址跨度
+ */
+template <uint32_t Span>
+struct Register_Index
+{
+  uint16_t value[Span ? Span : 1];
+
+  /**
+   * @brief  寄存器稠密索引 构造函数
+   *
+   * @param  run        区间表
+   * @param  run_count  区间数量
+   * @param  begin      跨度起点
+   */
+  constexpr Register_Index(const Register_Run* run, uint32_t run_count, uint32_t begin) : value()
+  {
+    for (uint32_t i = 0; i < (Span ? Span : 1); ++i)
+    {
+      value[i] = DENSE_HOLE;
+    }
+
+    for (uint32_t i = 0; i < run_count; ++i)
+    {
+      for (uint32_t addr = run[i].start; addr < run[i].end && (addr - begin) < Span; ++addr)
+      {
+        value[addr - begin] = static_cast<uint16_t>(run[i].offset + addr - run[i].start);
+      }
+    }
+  }
 };
 
+// 布局生成自检: 乱序段排序合并、重叠段拒绝、空洞保留
+static_assert(Register_Layout<modbus::Register<10, 5>, modbus::Register<0, 10>, modbus::Register<20, 2>>().run_count == 2, "Register layout must merge adjacent segments");
+static_assert(Register_Layout<modbus::Register<10, 5>, modbus::Register<0, 10>, modbus::Register<20, 2>>().run[1].offset == 15, "Register layout must place storage in address order");
+static_assert(!Register_Layout<modbus::Register<0, 10>, modbus::Register<5, 10>>().valid, "Register layout must reject overlapping segments");
+
 constexpr bool is_little_endian_host()
 {
   return __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__;
@@ -63,7 +164,24 @@ template <typename... Registers>
 class Register_Group
 {
 private:
-  protocol_internal::modbus_internal::Storage<Registers...> storage;   // 静态分配的存储空间
+  using Layout = protocol_internal::modbus_internal::Register_Layout<Registers...>;
+
+  // 编译期布局表（排序并合并相邻段）
+  static constexpr Layout LAYOUT = Layout();
+
+  static_assert(LAYOUT.valid, "Register segments must be non-empty, inside the 16-bit address space and must not overlap");
+
+  // 地址跨度（跨度较小时使用稠密索引 O(1) 查找，否则二分查找区间表）
+  static constexpr uint32_t SPAN_BEGIN = LAYOUT.run_count ? LAYOUT.run[0].start : 0U;
+  static constexpr uint32_t SPAN       = LAYOUT.run_count ? (LAYOUT.run[LAYOUT.run_count - 1].end - SPAN_BEGIN) : 0U;
+  static constexpr bool     DENSE      = (SPAN <= protocol_internal::modbus_internal::DENSE_SPAN_MAX);
+
+  using Index = protocol_internal::modbus_internal::Register_Index<DENSE ? SPAN : 0U>;
+
+  // 编译期稠密索引
+  static constexpr Index INDEX = Index(LAYOUT.run, LAYOUT.run_count, SPAN_BEGIN);
+
+  uint16_t storage[LAYOUT.total ? LAYOUT.total : 1] = { 0 };   // 静态分配的存储空间（按地址顺序排布）
 
   // 编译期段验证（零成本抽象）
   template <uint16_t Addr>
@@ -72,81 +190,91 @@ private:
     return ((Addr >= Registers::start && Addr < Registers::start + Registers::length) || ...);
   }
 
-  // 运行时单寄存器查找（高效实现）
-  template <typename First, typename... Rest>
-  static uint16_t* find_register(uint16_t addr, Storage<First, Rest...>& s)
+  // 查找首个结束地址大于 addr 的区间（二分查找）
+  static constexpr uint32_t upper_run(uint32_t addr)
   {
-    if (addr >= First::start && addr < First::start + First::length)
+    uint32_t low  = 0;
+    uint32_t high = LAYOUT.run_count;
+
+    while (low < high)
     {
-      return &s.data[addr - First::start];
+      const uint32_t mid = (low + high) / 2;
+
+      if (LAYOUT.run[mid].end <= addr)
+      {
+        low = mid + 1;
+      }
+      else
+      {
+        high = mid;
+      }
     }
-    return find_register(addr, s.rest);
+    return low;
   }
 
-  static uint16_t* find_register(uint16_t, Storage<>&)
+  // 运行时单寄存器查找
+  uint16_t* find_register(uint16_t addr)
   {
-    return nullptr;
+    const uint32_t offset = offset_of(addr);
+    return (NPOS != offset) ? &storage[offset] : nullptr;
   }
 
-  // 批量操作核心：编译期展开的段处理
-  template <bool is_write, typename First, typename... Rest>
-  static uint16_t process_segment(uint16_t start, uint16_t count, uint16_t* buffer, Storage<First, Rest...>& s)
+  // 寄存器块与大端字节流互转（小端主机逐字 bswap16，编译器可展开为 REV16 / 向量字块操作）
+  template <bool is_write>
+  static void QAQ_O3 swap_words(uint16_t* reg, uint8_t* bytes, uint32_t count)
   {
-    constexpr auto bounds    = SegmentBounds<First> {};
-    uint16_t       processed = 0;
-
-    // 计算地址交集（编译期可优化常量）
-    if (start < bounds.end && start + count > bounds.start)
+    for (uint32_t i = 0; i < count; ++i)
     {
-      const uint16_t overlap_start = (start > bounds.start) ? start : bounds.start;
-      const uint16_t overlap_end   = (start + count < bounds.end) ? start + count : bounds.end;
-      const uint16_t overlap_count = overlap_end - overlap_start;
+      uint16_t value = 0;
 
-      if (overlap_count > 0)
+      if constexpr (is_write)
       {
-        const uint16_t seg_offset = overlap_start - bounds.start;
-        const uint16_t buf_offset = overlap_start - start;
-
-        if constexpr (is_write)
-        {
-          // 写操作：硬件友好循环（避免memcpy调用开销）
-          for (uint16_t i = 0; i < overlap_count; ++i)
-          {
-            s.data[seg_offset + i] = buffer[buf_offset + i];
-          }
-        }
-        else
-        {
-          // 读操作：硬件友好循环
-          for (uint16_t i = 0; i < overlap_count; ++i)
-          {
-            buffer[buf_offset + i] = s.data[seg_offset + i];
-          }
-        }
-        processed = overlap_count;
+        memcpy(&value, bytes + i * 2, sizeof(value));
+        reg[i] = protocol_internal::modbus_internal::is_little_endian_host() ? __builtin_bswap16(value) : value;
+      }
+      else
+      {
+        value = protocol_internal::modbus_internal::is_little_endian_host() ? __builtin_bswap16(reg[i]) : reg[i];
+        memcpy(bytes + i * 2, &value, sizeof(value));
       }
     }
+  }
 
-    // 递归处理剩余段（编译期展开为线性代码）
-    if constexpr (sizeof...(Rest) > 0)
+  // 批量操作核心：二分定位首个区间，每段连续交集一次块拷贝
+  template <bool is_write, bool big_endian, typename T>
+  uint16_t transfer(uint16_t start, uint16_t count, T* buffer)
+  {
+    const uint32_t end       = static_cast<uint32_t>(start) + count;
+    uint16_t       processed = 0;
+
+    for (uint32_t i = upper_run(start); i < LAYOUT.run_count && LAYOUT.run[i].start < end; ++i)
     {
-      processed += process_segment<is_write, Rest...>(start, count, buffer, s.rest);
+      const uint32_t first = std::max<uint32_t>(start, LAYOUT.run[i].start);
+      const uint32_t last  = std::min<uint32_t>(end, LAYOUT.run[i].end);
+      uint16_t*      reg   = &storage[LAYOUT.run[i].offset + first - LAYOUT.run[i].start];
+
+      if constexpr (big_endian)
+      {
+        swap_words<is_write>(reg, buffer + (first - start) * 2, last - first);
+      }
+      else if constexpr (is_write)
+      {
+        system::memory::fast_memcpy(reg, buffer + (first - start), (last - first) * sizeof(uint16_t));
+      }
+      else
+      {
+        system::memory::fast_memcpy(buffer + (first - start), reg, (last - first) * sizeof(uint16_t));
+      }
+      processed += static_cast<uint16_t>(last - first);
     }
     return processed;
   }
 
-  // 递归终止（编译期消除）
-  template <bool is_write>
-  static uint16_t process_segment(uint16_t, uint16_t, uint16_t*, Storage<>&)
-  {
-    return 0;
-  }
-
   // 辅助函数：将任意类型转换为大端字节数组
   template <typename T>
   static void to_big_endian_bytes(const T& value, uint8_t* big_endian_bytes)
   {
-    if constexpr (internal::modbus_internal::is_little_endian_host())
+    if constexpr (protocol_internal::modbus_internal::is_little_endian_host())
     {
       const uint8_t* src = reinterpret_cast<const uint8_t*>(&value);
       for (size_t i = 0; i < sizeof(T); ++i)
@@ -156,7 +284,7 @@ private:
     }
     else
     {
-      std::memcpy(big_endian_bytes, &value, sizeof(T));
+      memcpy(big_endian_bytes, &value, sizeof(T));
     }
   }
 
@@ -164,7 +292,7 @@ private:
   template <typename T>
   static void from_big_endian_bytes(const uint8_t* big_endian_bytes, T& value)
   {
-    if constexpr (internal::modbus_internal::is_little_endian_host())
+    if constexpr (protocol_internal::modbus_internal::is_little_endian_host())
     {
       uint8_t* dst = reinterpret_cast<uint8_t*>(&value);
       for (size_t i = 0; i < sizeof(T); ++i)
@@ -174,7 +302,7 @@ private:
     }
     else
     {
-      std::memcpy(&value, big_endian_bytes, sizeof(T));
+      memcpy(&value, big_endian_bytes, sizeof(T));
     }
   }
 
@@ -279,14 +407,14 @@ public:
   // 单寄存器读（保留原始接口）
   uint16_t read(uint16_t addr)
   {
-    uint16_t* reg = find_register(addr, storage);
+    uint16_t* reg = find_register(addr);
     return reg ? *reg : 0;
   }
 
   // 单寄存器写（返回操作结果）
   bool write(uint16_t addr, uint16_t value)
   {
-    uint16_t* reg = find_register(addr, storage);
+    uint16_t* reg = find_register(addr);
     if (reg)
     {
       *reg = value;
@@ -305,14 +433,27 @@ public:
     }
 
     // 批量处理（返回实际读取数量）
-    return process_segment<false, Registers...>(start, count, buffer, storage);
+    return transfer<false, false>(start, count, buffer);
   }
 
   // 优化的多写操作（工业级实现）
   uint16_t write(uint16_t start, uint16_t count, const uint16_t* buffer)
   {
     // 直接处理有效段（返回实际写入数量）
-    return process_segment<true, Registers...>(start, count, const_cast<uint16_t*>(buffer), storage);
+    return transfer<true, false>(start, count, const_cast<uint16_t*>(buffer));
+  }
+
+  // 大端字节流多读（Modbus 报文格式，非法地址对应字节置0）
+  uint16_t read_be(uint16_t start, uint16_t count, uint8_t* data)
+  {
+    system::memory::fast_memset(data, 0, count * sizeof(uint16_t));
+    return transfer<false, true>(start, count, data);
+  }
+
+  // 大端字节流多写（Modbus 报文格式）
+  uint16_t write_be(uint16_t start, uint16_t count, const uint8_t* data)
+  {
+    return transfer<true, true>(start, count, const_cast<uint8_t*>(data));
   }
 
   // 编译期地址验证（开发时使用）
@@ -322,6 +463,54 @@ public:
     return is_in_segment<Addr>();
   }
 
+  // 运行时区间验证（区间内每个地址均落在某个段内，用于写入前的整体校验）
+  static constexpr bool contains(uint16_t start, uint16_t count)
+  {
+    const uint32_t i = upper_run(start);
+    return (0 != count) && (i < LAYOUT.run_count) && (start >= LAYOUT.run[i].start) && (static_cast<uint32_t>(start) + count <= LAYOUT.run[i].end);
+  }
+
+  // 地址不存在时的储存偏移
+  static constexpr uint32_t NPOS = 0xFFFFFFFFU;
+
+  // 单寄存器储存偏移（稠密索引 O(1) / 二分查找 O(log n)，地址不存在返回 NPOS）
+  static constexpr uint32_t offset_of(uint16_t addr)
+  {
+    uint32_t ret = NPOS;
+
+    if constexpr (DENSE)
+    {
+      const uint32_t index = static_cast<uint32_t>(addr) - SPAN_BEGIN;
+
+      if (index < SPAN && protocol_internal::modbus_internal::DENSE_HOLE != INDEX.value[index])
+      {
+        ret = INDEX.value[index];
+      }
+    }
+    else
+    {
+      const uint32_t i = upper_run(addr);
+
+      if (i < LAYOUT.run_count && addr >= LAYOUT.run[i].start)
+      {
+        ret = LAYOUT.run[i].offset + addr - LAYOUT.run[i].start;
+      }
+    }
+    return ret;
+  }
+
+  // 是否使用稠密索引（否则二分查找区间表）
+  static constexpr bool dense_index()
+  {
+    return DENSE;
+  }
+
+  // 段数量（为0表示空表）
+  static constexpr uint32_t segment_count()
+  {
+    return sizeof...(Registers);
+  }
+
   // ============== 新增：多类型读写接口 ==============
 
   // 通用类型读取（支持float/double等）
@@ -352,71 +541,79 @@ public:
     return write(start, reg_count, reg_buffer) == reg_count;
   }
 
-  // 字符串读取（支持字节序选择）
+  // 字符串读取（支持字节序选择，逐寄存器读取直至遇到非法地址）
   template <Register_Endianness E = Register_Endianness::Big_Endian>
   uint16_t read(uint16_t start, uint16_t max_bytes, char* buffer)
   {
-    const uint16_t reg_count = (max_bytes + 1) / 2;
-    uint16_t       reg_buffer[reg_count];
-    const uint16_t actual_regs  = read(start, reg_count, reg_buffer);
-    uint16_t       actual_bytes = 0;
+    uint16_t actual_bytes = 0;
 
-    for (uint16_t i = 0; i < actual_regs && actual_bytes < max_bytes; ++i)
+    for (uint16_t i = 0; actual_bytes < max_bytes; ++i)
     {
+      const uint16_t* reg = find_register(start + i);
+      if (!reg)
+      {
+        break;
+      }
+
       if (E == Register_Endianness::Big_Endian || E == Register_Endianness::Big_Endian_Swap)
       {
         // 大端字节序：高字节在前
-        buffer[actual_bytes++] = (reg_buffer[i] >> 8) & 0xFF;
+        buffer[actual_bytes++] = (*reg >> 8) & 0xFF;
         if (actual_bytes < max_bytes)
         {
-          buffer[actual_bytes++] = reg_buffer[i] & 0xFF;
+          buffer[actual_bytes++] = *reg & 0xFF;
         }
       }
       else
       {
         // 小端字节序：低字节在前
-        buffer[actual_bytes++] = reg_buffer[i] & 0xFF;
+        buffer[actual_bytes++] = *reg & 0xFF;
         if (actual_bytes < max_bytes)
         {
-          buffer[actual_bytes++] = (reg_buffer[i] >> 8) & 0xFF;
+          buffer[actual_bytes++] = (*reg >> 8) & 0xFF;
         }
       }
     }
     return actual_bytes;
   }
 
-  // 字符串写入（支持字节序选择）
+  // 字符串写入（支持字节序选择，逐寄存器写入直至遇到非法地址）
   template <Register_Endianness E = Register_Endianness::Big_Endian>
   uint16_t write(uint16_t start, uint16_t byte_count, const char* buffer)
   {
-    const uint16_t reg_count             = (byte_count + 1) / 2;
-    uint16_t       reg_buffer[reg_count] = { 0 };
-    uint16_t       bytes_written         = 0;
+    uint16_t bytes_written = 0;
 
-    for (uint16_t i = 0; i < reg_count && bytes_written < byte_count; ++i)
+    for (uint16_t i = 0; bytes_written < byte_count; ++i)
     {
+      uint16_t* reg = find_register(start + i);
+      if (!reg)
+      {
+        break;
+      }
+
+      uint16_t value = 0;
       if (E == Register_Endianness::Big_Endian || E == Register_Endianness::Big_Endian_Swap)
       {
         // 大端：高字节在前
-        reg_buffer[i] = (buffer[bytes_written++] << 8);
+        value = (static_cast<uint8_t>(buffer[bytes_written++]) << 8);
         if (bytes_written < byte_count)
         {
-          reg_buffer[i] |= static_cast<uint8_t>(buffer[bytes_written++]);
+          value |= static_cast<uint8_t>(buffer[bytes_written++]);
         }
       }
       else
       {
         // 小端：低字节在前
-        reg_buffer[i] = static_cast<uint8_t>(buffer[bytes_written++]);
+        value = static_cast<uint8_t>(buffer[bytes_written++]);
         if (bytes_written < byte_count)
         {
-          reg_buffer[i] |= (static_cast<uint8_t>(buffer[bytes_written++]) << 8);
+          value |= (static_cast<uint8_t>(buffer[bytes_written++]) << 8);
         }
       }
+      *reg = value;
     }
 
-    const uint16_t actual_regs = write(start, reg_count, reg_buffer);
-    return std::min(static_cast<uint16_t>(actual_regs * 2), byte_count);
+    return bytes_written;
   }
 
   // 8位整数数组读取（支持字节序选择）
@@ -434,6 +631,31 @@ public:
   }
 };
 } /* namespace modbus */
+
+/// @brief 命名空间 内部
+namespace protocol_internal
+{
+/// @brief 名称空间 Modbus 内部
+namespace modbus_internal
+{
+// 查找自检: 稠密索引与二分查找两条路径的命中、空洞与边界
+using Dense_Lookup_Check  = modbus::Register_Group<modbus::Register<10, 5>, modbus::Register<0, 10>, modbus::Register<20, 2>>;
+using Binary_Lookup_Check = modbus::Register_Group<modbus::Register<1000, 2>, modbus::Register<0, 4>, modbus::Register<0xFFFA, 6>>;
+
+static_assert(Dense_Lookup_Check::dense_index() && !Binary_Lookup_Check::dense_index(), "Register lookup must select the dense index only for small spans");
+static_assert(Dense_Lookup_Check::offset_of(0) == 0 && Dense_Lookup_Check::offset_of(14) == 14 && Dense_Lookup_Check::offset_of(20) == 15 && Dense_Lookup_Check::offset_of(21) == 16,
+              "Dense register lookup must hit every segment edge");
+static_assert(Dense_Lookup_Check::offset_of(15) == Dense_Lookup_Check::NPOS && Dense_Lookup_Check::offset_of(19) == Dense_Lookup_Check::NPOS && Dense_Lookup_Check::offset_of(22) == Dense_Lookup_Check::NPOS &&
+                Dense_Lookup_Check::offset_of(0xFFFF) == Dense_Lookup_Check::NPOS,
+              "Dense register lookup must miss gaps and addresses outside the span");
+static_assert(Binary_Lookup_Check::offset_of(3) == 3 && Binary_Lookup_Check::offset_of(1000) == 4 && Binary_Lookup_Check::offset_of(1001) == 5 && Binary_Lookup_Check::offset_of(0xFFFF) == 11,
+              "Binary register lookup must hit every segment edge");
+static_assert(Binary_Lookup_Check::offset_of(4) == Binary_Lookup_Check::NPOS && Binary_Lookup_Check::offset_of(999) == Binary_Lookup_Check::NPOS && Binary_Lookup_Check::offset_of(1002) == Binary_Lookup_Check::NPOS &&
+                Binary_Lookup_Check::offset_of(0xFFF9) == Binary_Lookup_Check::NPOS,
+              "Binary register lookup must miss gaps");
+static_assert(modbus::Register_Group<>::offset_of(0) == modbus::Register_Group<>::NPOS, "Empty register group must not resolve any address");
+} /* namespace modbus_internal */
+} /* namespace protocol_internal */
 } /* namespace protocol */
 } /* namespace QAQ */
 
@@ -0,0 +1,254 @@
+/**
+ * @file   modbus_register_test.cpp
+ * @brief  Modbus 寄存器表 主机测试: 稠密索引与二分查找的编译期/运行时查找校验与查找基准
+ *
+ * @note   仅用于主机，不参与固件编译 (已加入 eide excludeList);
+ *         编译期以 static_assert 对照逐段计算的参考偏移检查每个段的首尾与两侧空洞，运行时对全部 65536 个地址
+ *         检查查找结果与单寄存器读写; 基准输出不同段数与跨度布局下单寄存器查找的耗时 (主机实测，纳秒/次)
+ *
+ *         构建 (仓库根目录):
+ *         g++ -std=c++17 -O2 -g -fsanitize=address,undefined -fpermissive -w \
+ *             $(python3 -c "import json;c=json.load(open('.eide/eide.json'))['targets']['Debug']['custom_dep'];print(' '.join(['-I'+p for p in c['incList']]+['-D'+d for d in c['defineList']]))") \
+ *             api/unfinish/modbus_register_test.cpp -o modbus_register_test && ./modbus_register_test
+ */
+#include "modbus_register.hpp"
+
+#include <chrono>
+#include <cstdio>
+#include <utility>
+
+using namespace QAQ::protocol::modbus;
+
+namespace
+{
+/// @brief 失败的检查数
+int g_failures = 0;
+
+#define CHECK(cond)                                                  \
+  do                                                                 \
+  {                                                                  \
+    if (!(cond))                                                     \
+    {                                                                \
+      ++g_failures;                                                  \
+      printf("%s:%d: CHECK(%s) failed\n", __FILE__, __LINE__, #cond); \
+    }                                                                \
+  } while (0)
+
+/**
+ * @brief  参考偏移: 逐段判断地址，偏移为起始地址更小的段长度之和
+ */
+template <typename... Registers>
+constexpr uint32_t reference_offset(uint32_t addr)
+{
+  constexpr uint32_t COUNT                  = sizeof...(Registers);
+  const uint32_t     start[COUNT ? COUNT : 1]  = { Registers::start... };
+  const uint32_t     length[COUNT ? COUNT : 1] = { Registers::length... };
+  uint32_t           ret                       = Register_Group<>::NPOS;
+
+  for (uint32_t i = 0; i < COUNT; ++i)
+  {
+    if (addr >= start[i] && addr < start[i] + length[i])
+    {
+      ret = addr - start[i];
+
+      for (uint32_t j = 0; j < COUNT; ++j)
+      {
+        ret += (start[j] < start[i]) ? length[j] : 0U;
+      }
+    }
+  }
+  return ret;
+}
+
+/**
+ * @brief  编译期边界检查: 每个段的首尾地址、两侧相邻地址与地址空间两端
+ */
+template <typename... Registers>
+constexpr bool check_edges()
+{
+  using Group = Register_Group<Registers...>;
+
+  constexpr uint32_t COUNT                  = sizeof...(Registers);
+  const uint32_t     start[COUNT ? COUNT : 1]  = { Registers::start... };
+  const uint32_t     length[COUNT ? COUNT : 1] = { Registers::length... };
+  bool               ret                       = (Group::offset_of(0) == reference_offset<Registers...>(0)) && (Group::offset_of(0xFFFF) == reference_offset<Registers...>(0xFFFF));
+
+  for (uint32_t i = 0; i < COUNT; ++i)
+  {
+    const uint32_t probe[4] = { start[i] - 1, start[i], start[i] + length[i] - 1, start[i] + length[i] };
+
+    for (uint32_t addr : probe)
+    {
+      if (addr <= 0xFFFF)
+      {
+        ret = ret && (Group::offset_of(static_cast<uint16_t>(addr)) == reference_offset<Registers...>(addr));
+      }
+    }
+  }
+  return ret;
+}
+
+/**
+ * @brief  稀疏段序列 (Count 个段，间隔 Stride，每段 Length 个寄存器)
+ */
+template <uint16_t Stride, uint16_t Length, size_t... I>
+Register_Group<Register<static_cast<uint16_t>(I * Stride), Length>...> make_group(std::index_sequence<I...>);
+
+template <size_t Count, uint16_t Stride, uint16_t Length>
+using Spread_Group = decltype(make_group<Stride, Length>(std::make_index_sequence<Count>()));
+
+/// @brief 单寄存器
+using Single_Group     = Register_Group<Register<0, 1>>;
+/// @brief 乱序、相邻合并与空洞 (稠密)
+using Mixed_Group      = Register_Group<Register<100, 8>, Register<40, 10>, Register<60, 1>, Register<50, 5>>;
+/// @brief 跨度恰为稠密上限
+using Dense_Max_Group  = Register_Group<Register<0, 1>, Register<511, 1>>;
+/// @brief 跨度超出稠密上限一个地址 (二分)
+using Binary_Min_Group = Register_Group<Register<0, 1>, Register<512, 1>>;
+/// @brief 地址空间两端 (二分)
+using Extreme_Group    = Register_Group<Register<0xFFFF, 1>, Register<0, 1>>;
+/// @brief 遍布地址空间的 16 段 (二分)
+using Wide_Group       = Register_Group<Register<0xF000, 16>, Register<0xE000, 16>, Register<0xD000, 16>, Register<0xC000, 16>, Register<0xB000, 16>, Register<0xA000, 16>, Register<0x9000, 16>,
+                                  Register<0x8000, 16>, Register<0x7000, 16>, Register<0x6000, 16>, Register<0x5000, 16>, Register<0x4000, 16>, Register<0x3000, 16>, Register<0x2000, 16>,
+                                  Register<0x1000, 16>, Register<0x0000, 16>>;
+
+static_assert(Single_Group::dense_index() && Mixed_Group::dense_index() && Dense_Max_Group::dense_index(), "Dense layouts must use the dense index");
+static_assert(!Binary_Min_Group::dense_index() && !Extreme_Group::dense_index() && !Wide_Group::dense_index(), "Sparse layouts must use binary search");
+static_assert(check_edges<Register<0, 1>>(), "Single register lookup");
+static_assert(check_edges<Register<100, 8>, Register<40, 10>, Register<60, 1>, Register<50, 5>>(), "Mixed dense lookup");
+static_assert(check_edges<Register<0, 1>, Register<511, 1>>(), "Dense lookup at the span limit");
+static_assert(check_edges<Register<0, 1>, Register<512, 1>>(), "Binary lookup just above the span limit");
+static_assert(check_edges<Register<0xFFFF, 1>, Register<0, 1>>(), "Binary lookup at both ends of the address space");
+static_assert(Mixed_Group::offset_of(54) == 14 && Mixed_Group::offset_of(55) == Mixed_Group::NPOS && Mixed_Group::offset_of(60) == 15 && Mixed_Group::offset_of(100) == 16, "Merged segments keep address order");
+static_assert(Wide_Group::offset_of(0x1000) == 16 && Wide_Group::offset_of(0xF00F) == 255 && Wide_Group::offset_of(0xF010) == Wide_Group::NPOS, "Unsorted wide layout");
+} /* namespace */
+
+/**
+ * @brief  运行时全地址检查: 查找结果与参考偏移一致，命中的地址读写独立，空洞读为0且写入失败
+ */
+template <typename... Registers>
+static void test_all_addresses(const char* name, Register_Group<Registers...>& group)
+{
+  using Group = Register_Group<Registers...>;
+
+  uint32_t errors = 0;
+  uint32_t hits   = 0;
+
+  for (uint32_t addr = 0; addr <= 0xFFFF; ++addr)
+  {
+    const uint32_t expected = reference_offset<Registers...>(addr);
+
+    errors += (Group::offset_of(static_cast<uint16_t>(addr)) != expected);
+    errors += (group.write(static_cast<uint16_t>(addr), static_cast<uint16_t>(addr ^ 0x5A5A)) != (Group::NPOS != expected));
+    hits   += (Group::NPOS != expected);
+  }
+
+  for (uint32_t addr = 0; addr <= 0xFFFF; ++addr)
+  {
+    const bool hit = (Group::NPOS != reference_offset<Registers...>(addr));
+    errors        += (group.read(static_cast<uint16_t>(addr)) != (hit ? static_cast<uint16_t>(addr ^ 0x5A5A) : 0U));
+  }
+
+  if (0 != errors)
+  {
+    printf("  %s: %u lookup errors\n", name, errors);
+  }
+
+  CHECK(0 == errors && 0 != hits);
+}
+
+/**
+ * @brief  单寄存器查找基准 (一半命中、一半落在空洞或跨度外)
+ */
+template <typename Group>
+static void bench_lookup(const char* name, Group& group)
+{
+  static uint16_t addresses[4096];
+  uint32_t        seed  = 1;
+  uint32_t        hits  = 0;
+  uint32_t        count = 0;
+
+  while (count < 4096)
+  {
+    seed                = seed * 1664525U + 1013904223U;
+    const uint16_t addr = static_cast<uint16_t>(seed >> 16);
+    const bool     hit  = (Group::NPOS != Group::offset_of(addr));
+
+    // 命中地址稀少时逐个向上寻找命中地址，保证一半命中
+    if ((count & 1U) && !hit)
+    {
+      for (uint32_t next = addr; next <= 0xFFFF; ++next)
+      {
+        if (Group::NPOS != Group::offset_of(static_cast<uint16_t>(next)))
+        {
+          addresses[count++] = static_cast<uint16_t>(next);
+          ++hits;
+          break;
+        }
+      }
+    }
+    else if (!(count & 1U) || hit)
+    {
+      addresses[count++]  = addr;
+      hits               += hit;
+    }
+  }
+
+  const uint32_t    rounds = 2000;
+  volatile uint32_t sink   = 0;
+  const auto        start  = std::chrono::steady_clock::now();
+
+  for (uint32_t r = 0; r < rounds; ++r)
+  {
+    uint32_t sum = 0;
+
+    for (uint16_t addr : addresses)
+    {
+      sum += group.read(addr);
+    }
+    sink = sink + sum;
+  }
+
+  const double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+  printf("%-18s %8u %8s %8.1f %10.2f\n", name, static_cast<unsigned>(Group::segment_count()), Group::dense_index() ? "dense" : "binary", 100.0 * hits / 4096, seconds * 1e9 / (rounds * 4096.0));
+}
+
+int main(void)
+{
+  static Single_Group     single;
+  static Mixed_Group      mixed;
+  static Dense_Max_Group  dense_max;
+  static Binary_Min_Group binary_min;
+  static Extreme_Group    extreme;
+  static Wide_Group       wide;
+
+  test_all_addresses("single", single);
+  test_all_addresses("mixed", mixed);
+  test_all_addresses("dense max", dense_max);
+  test_all_addresses("binary min", binary_min);
+  test_all_addresses("extreme", extreme);
+  test_all_addresses("wide", wide);
+
+  static Spread_Group<8, 16, 8>     dense_8;
+  static Spread_Group<32, 16, 8>    dense_32;
+  static Spread_Group<4, 4096, 64>  binary_4;
+  static Spread_Group<16, 4096, 16> binary_16;
+  static Spread_Group<64, 1024, 8>  binary_64;
+
+  test_all_addresses("dense 8", dense_8);
+  test_all_addresses("binary 64", binary_64);
+
+  printf("%-18s %8s %8s %8s %10s\n", "layout", "segments", "index", "hit %", "ns/lookup");
+  bench_lookup("single", single);
+  bench_lookup("mixed", mixed);
+  bench_lookup("8 x 8 / 16", dense_8);
+  bench_lookup("32 x 8 / 16", dense_32);
+  bench_lookup("4 x 64 / 4096", binary_4);
+  bench_lookup("16 x 16 / 4096", binary_16);
+  bench_lookup("64 x 8 / 1024", binary_64);
+
+  printf("modbus_register_test: %s (%d failures)\n", 0 == g_failures ? "OK" : "FAILED", g_failures);
+  fflush(stdout);
+  return 0 == g_failures ? 0 : 1;
+}
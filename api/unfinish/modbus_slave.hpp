@@ -0,0 +1,1076 @@
+#ifndef __MODBUS_SLAVE_HPP__
+#define __MODBUS_SLAVE_HPP__
+
+#include "modbus_register.hpp"
+#include "streaming_device.hpp"
+#include "device_manger.hpp"
+#include "fast_memory.hpp"
+#include "crc.hpp"
+
+/// @brief 名称空间 QAQ
+namespace QAQ
+{
+/// @brief 名称空间 协议
+namespace protocol
+{
+/// @brief 名称空间 Modbus
+namespace modbus
+{
+/// @brief Modbus 功能码
+class Function_Code
+{
+public:
+  /// @brief 读线圈
+  static constexpr uint8_t Read_Coils                    = 0x01;
+  /// @brief 读离散输入
+  static constexpr uint8_t Read_Discrete_Inputs          = 0x02;
+  /// @brief 读保持寄存器
+  static constexpr uint8_t Read_Holding_Registers        = 0x03;
+  /// @brief 读输入寄存器
+  static constexpr uint8_t Read_Input_Registers          = 0x04;
+  /// @brief 写单个线圈
+  static constexpr uint8_t Write_Single_Coil             = 0x05;
+  /// @brief 写单个保持寄存器
+  static constexpr uint8_t Write_Single_Register         = 0x06;
+  /// @brief 写多个线圈
+  static constexpr uint8_t Write_Multiple_Coils          = 0x0F;
+  /// @brief 写多个保持寄存器
+  static constexpr uint8_t Write_Multiple_Registers      = 0x10;
+  /// @brief 读写多个保持寄存器
+  static constexpr uint8_t Read_Write_Multiple_Registers = 0x17;
+  /// @brief 异常响应标志
+  static constexpr uint8_t Exception_Flag                = 0x80;
+};
+
+/// @brief Modbus 异常码
+class Exception_Code
+{
+public:
+  /// @brief 无异常
+  static constexpr uint8_t None                 = 0x00;
+  /// @brief 非法功能码
+  static constexpr uint8_t Illegal_Function     = 0x01;
+  /// @brief 非法数据地址
+  static constexpr uint8_t Illegal_Data_Address = 0x02;
+  /// @brief 非法数据值
+  static constexpr uint8_t Illegal_Data_Value   = 0x03;
+  /// @brief 从站设备故障
+  static constexpr uint8_t Slave_Device_Failure = 0x04;
+};
+
+/// @brief Modbus 从站 处理统计
+struct Slave_Stats
+{
+  uint32_t requests;   /* 已处理请求数 */
+  uint32_t exceptions; /* 异常响应数 */
+};
+
+/// @brief Modbus 传输层 统计
+struct Transport_Stats
+{
+  uint32_t frames;       /* 已交付从站处理的帧数 */
+  uint32_t responses;    /* 已发送响应数 */
+  uint32_t broadcasts;   /* 广播帧数 (不响应) */
+  uint32_t ignored;      /* 非本站地址帧数 */
+  uint32_t crc_errors;   /* 校验错误帧数 */
+  uint32_t frame_errors; /* 格式错误帧数 (过短、超长、字符间隔超时或报文头非法) */
+};
+
+/// @brief PDU 最大长度
+static constexpr uint16_t PDU_MAX_SIZE     = 253;
+/// @brief RTU ADU 最大长度 (地址 + PDU + CRC)
+static constexpr uint16_t RTU_ADU_MAX_SIZE = PDU_MAX_SIZE + 3;
+/// @brief MBAP 报文头长度
+static constexpr uint16_t MBAP_HEADER_SIZE = 7;
+/// @brief TCP ADU 最大长度 (MBAP + PDU)
+static constexpr uint16_t TCP_ADU_MAX_SIZE = PDU_MAX_SIZE + MBAP_HEADER_SIZE;
+} /* namespace modbus */
+
+/// @brief 命名空间 内部
+namespace protocol_internal
+{
+/// @brief 名称空间 Modbus 内部
+namespace modbus_internal
+{
+/// @brief 单次读取寄存器数量上限 (功能码 0x03/0x04/0x17)
+static constexpr uint16_t READ_REGISTERS_MAX  = 125;
+/// @brief 单次写入寄存器数量上限 (功能码 0x10)
+static constexpr uint16_t WRITE_REGISTERS_MAX = 123;
+/// @brief 读写功能中写入寄存器数量上限 (功能码 0x17)
+static constexpr uint16_t RW_WRITE_MAX        = 121;
+/// @brief 单次读取位数量上限 (功能码 0x01/0x02)
+static constexpr uint16_t READ_BITS_MAX       = 2000;
+/// @brief 单次写入位数量上限 (功能码 0x0F)
+static constexpr uint16_t WRITE_BITS_MAX      = 1968;
+
+/**
+ * @brief  Modbus 读取大端16位字段
+ *
+ * @param  data      数据指针
+ * @return uint16_t  字段值
+ */
+QAQ_INLINE uint16_t get_u16(const uint8_t* data)
+{
+  return static_cast<uint16_t>((static_cast<uint16_t>(data[0]) << 8) | data[1]);
+}
+
+/**
+ * @brief  Modbus 写入大端16位字段
+ *
+ * @param  data   数据指针
+ * @param  value  字段值
+ */
+QAQ_INLINE void put_u16(uint8_t* data, uint16_t value)
+{
+  data[0] = static_cast<uint8_t>(value >> 8);
+  data[1] = static_cast<uint8_t>(value);
+}
+} /* namespace modbus_internal */
+} /* namespace protocol_internal */
+
+/// @brief 名称空间 Modbus
+namespace modbus
+{
+/**
+ * @brief  Modbus 从站 协议数据单元 (PDU) 处理引擎
+ *
+ * @tparam Holding_Registers  保持寄存器表 (Register_Group)
+ * @tparam Input_Registers    输入寄存器表 (Register_Group)
+ * @tparam Coils              线圈表 (Register_Group，每个线圈占一个寄存器，非0为ON)
+ * @tparam Discrete_Inputs    离散输入表 (Register_Group，每个输入占一个寄存器，非0为ON)
+ * @note   支持功能码 0x01~0x06、0x0F、0x10、0x17; 空表 (Register_Group<>) 对应的功能码回复非法功能码;
+ *         请求先整体校验数量与地址范围再访问数据表，任何异常都不会产生部分写入;
+ *         数据表直接以成员储存，寄存器在数据表与报文之间直接按大端拷贝，处理过程无堆分配
+ */
+template <typename Holding_Registers, typename Input_Registers = Register_Group<>, typename Coils = Register_Group<>, typename Discrete_Inputs = Register_Group<>>
+class Slave
+{
+  // 禁止拷贝和移动
+  QAQ_NO_COPY_MOVE(Slave)
+
+private:
+  /// @brief 位暂存区大小 (寄存器)
+  static constexpr uint16_t SCRATCH_SIZE = protocol_internal::modbus_internal::READ_REGISTERS_MAX;
+
+  /// @brief 保持寄存器表
+  Holding_Registers m_holding_registers;
+  /// @brief 输入寄存器表
+  Input_Registers   m_input_registers;
+  /// @brief 线圈表
+  Coils             m_coils;
+  /// @brief 离散输入表
+  Discrete_Inputs   m_discrete_inputs;
+  /// @brief 位暂存区 (线圈与离散输入分块读写)
+  uint16_t          m_scratch[SCRATCH_SIZE] = { 0 };
+  /// @brief 处理统计
+  Slave_Stats       m_stats                 = { 0 };
+
+  /**
+   * @brief  Modbus 从站 读取位 (功能码 0x01/0x02)
+   *
+   * @tparam Table      数据表类型
+   * @param  table      数据表
+   * @param  request    请求PDU
+   * @param  size       请求PDU长度
+   * @param  response   响应PDU缓存区
+   * @param  exception  异常码
+   * @return uint16_t   响应PDU长度
+   */
+  template <typename Table>
+  uint16_t read_bits(Table& table, const uint8_t* request, uint16_t size, uint8_t* response, uint8_t& exception)
+  {
+    using namespace protocol_internal::modbus_internal;
+
+    uint16_t ret = 0;
+
+    if (0 == Table::segment_count())
+    {
+      exception = Exception_Code::Illegal_Function;
+    }
+    else if (5 != size)
+    {
+      exception = Exception_Code::Illegal_Data_Value;
+    }
+    else
+    {
+      const uint16_t start = get_u16(request + 1);
+      const uint16_t count = get_u16(request + 3);
+
+      if (0 == count || count > READ_BITS_MAX)
+      {
+        exception = Exception_Code::Illegal_Data_Value;
+      }
+      else if (!Table::contains(start, count))
+      {
+        exception = Exception_Code::Illegal_Data_Address;
+      }
+      else
+      {
+        const uint16_t bytes = static_cast<uint16_t>((count + 7) / 8);
+
+        response[0] = request[0];
+        response[1] = static_cast<uint8_t>(bytes);
+        system::memory::fast_memset(response + 2, 0, bytes);
+
+        for (uint16_t offset = 0; offset < count; offset += SCRATCH_SIZE)
+        {
+          const uint16_t chunk = std::min<uint16_t>(count - offset, SCRATCH_SIZE);
+
+          table.read(static_cast<uint16_t>(start + offset), chunk, m_scratch);
+
+          for (uint16_t i = 0; i < chunk; ++i)
+          {
+            if (0 != m_scratch[i])
+            {
+              response[2 + (offset + i) / 8] |= static_cast<uint8_t>(1U << ((offset + i) % 8));
+            }
+          }
+        }
+
+        ret = 2 + bytes;
+      }
+    }
+
+    return ret;
+  }
+
+  /**
+   * @brief  Modbus 从站 读取寄存器 (功能码 0x03/0x04)
+   *
+   * @tparam Table      数据表类型
+   * @param  table      数据表
+   * @param  request    请求PDU
+   * @param  size       请求PDU长度
+   * @param  response   响应PDU缓存区
+   * @param  exception  异常码
+   * @return uint16_t   响应PDU长度
+   */
+  template <typename Table>
+  uint16_t read_registers(Table& table, const uint8_t* request, uint16_t size, uint8_t* response, uint8_t& exception)
+  {
+    using namespace protocol_internal::modbus_internal;
+
+    uint16_t ret = 0;
+
+    if (0 == Table::segment_count())
+    {
+      exception = Exception_Code::Illegal_Function;
+    }
+    else if (5 != size)
+    {
+      exception = Exception_Code::Illegal_Data_Value;
+    }
+    else
+    {
+      const uint16_t start = get_u16(request + 1);
+      const uint16_t count = get_u16(request + 3);
+
+      if (0 == count || count > READ_REGISTERS_MAX)
+      {
+        exception = Exception_Code::Illegal_Data_Value;
+      }
+      else if (!Table::contains(start, count))
+      {
+        exception = Exception_Code::Illegal_Data_Address;
+      }
+      else
+      {
+        response[0] = request[0];
+        ret         = 2 + encode_registers(table, start, count, response + 1);
+      }
+    }
+
+    return ret;
+  }
+
+  /**
+   * @brief  Modbus 从站 读取寄存器并编码为 字节数 + 大端数据
+   *
+   * @tparam Table      数据表类型
+   * @param  table      数据表
+   * @param  start      起始地址
+   * @param  count      寄存器数量 (已校验)
+   * @param  output     输出缓存区 (首字节为字节数)
+   * @return uint16_t   数据字节数
+   */
+  template <typename Table>
+  uint16_t encode_registers(Table& table, uint16_t start, uint16_t count, uint8_t* output)
+  {
+    output[0] = static_cast<uint8_t>(count * 2);
+    table.read_be(start, count, output + 1);
+
+    return static_cast<uint16_t>(count * 2);
+  }
+
+  /**
+   * @brief  Modbus 从站 解码大端数据并写入寄存器
+   *
+   * @param  start      起始地址
+   * @param  count      寄存器数量 (已校验)
+   * @param  input      大端数据
+   * @param  exception  异常码
+   */
+  void decode_registers(uint16_t start, uint16_t count, const uint8_t* input, uint8_t& exception)
+  {
+    if (count != m_holding_registers.write_be(start, count, input))
+    {
+      exception = Exception_Code::Slave_Device_Failure;
+    }
+  }
+
+  /**
+   * @brief  Modbus 从站 写单个线圈 (功能码 0x05)
+   *
+   * @param  request    请求PDU
+   * @param  size       请求PDU长度
+   * @param  response   响应PDU缓存区
+   * @param  exception  异常码
+   * @return uint16_t   响应PDU长度
+   */
+  uint16_t write_single_coil(const uint8_t* request, uint16_t size, uint8_t* response, uint8_t& exception)
+  {
+    using namespace protocol_internal::modbus_internal;
+
+    uint16_t ret = 0;
+
+    if (0 == Coils::segment_count())
+    {
+      exception = Exception_Code::Illegal_Function;
+    }
+    else if (5 != size || (0xFF00 != get_u16(request + 3) && 0x0000 != get_u16(request + 3)))
+    {
+      exception = Exception_Code::Illegal_Data_Value;
+    }
+    else if (!Coils::contains(get_u16(request + 1), 1))
+    {
+      exception = Exception_Code::Illegal_Data_Address;
+    }
+    else
+    {
+      const uint16_t value = (0xFF00 == get_u16(request + 3)) ? 1U : 0U;
+
+      m_coils.write(get_u16(request + 1), value);
+      system::memory::fast_memcpy(response, request, 5);
+      ret = 5;
+    }
+
+    return ret;
+  }
+
+  /**
+   * @brief  Modbus 从站 写单个保持寄存器 (功能码 0x06)
+   *
+   * @param  request    请求PDU
+   * @param  size       请求PDU长度
+   * @param  response   响应PDU缓存区
+   * @param  exception  异常码
+   * @return uint16_t   响应PDU长度
+   */
+  uint16_t write_single_register(const uint8_t* request, uint16_t size, uint8_t* response, uint8_t& exception)
+  {
+    using namespace protocol_internal::modbus_internal;
+
+    uint16_t ret = 0;
+
+    if (0 == Holding_Registers::segment_count())
+    {
+      exception = Exception_Code::Illegal_Function;
+    }
+    else if (5 != size)
+    {
+      exception = Exception_Code::Illegal_Data_Value;
+    }
+    else if (!Holding_Registers::contains(get_u16(request + 1), 1))
+    {
+      exception = Exception_Code::Illegal_Data_Address;
+    }
+    else
+    {
+      const uint16_t value = get_u16(request + 3);
+
+      m_holding_registers.write(get_u16(request + 1), value);
+      system::memory::fast_memcpy(response, request, 5);
+      ret = 5;
+    }
+
+    return ret;
+  }
+
+  /**
+   * @brief  Modbus 从站 写多个线圈 (功能码 0x0F)
+   *
+   * @param  request    请求PDU
+   * @param  size       请求PDU长度
+   * @param  response   响应PDU缓存区
+   * @param  exception  异常码
+   * @return uint16_t   响应PDU长度
+   */
+  uint16_t write_multiple_coils(const uint8_t* request, uint16_t size, uint8_t* response, uint8_t& exception)
+  {
+    using namespace protocol_internal::modbus_internal;
+
+    uint16_t ret = 0;
+
+    if (0 == Coils::segment_count())
+    {
+      exception = Exception_Code::Illegal_Function;
+    }
+    else if (size < 6)
+    {
+      exception = Exception_Code::Illegal_Data_Value;
+    }
+    else
+    {
+      const uint16_t start = get_u16(request + 1);
+      const uint16_t count = get_u16(request + 3);
+      const uint8_t  bytes = request[5];
+
+      if (0 == count || count > WRITE_BITS_MAX || bytes != (count + 7) / 8 || size != 6 + bytes)
+      {
+        exception = Exception_Code::Illegal_Data_Value;
+      }
+      else if (!Coils::contains(start, count))
+      {
+        exception = Exception_Code::Illegal_Data_Address;
+      }
+      else
+      {
+        for (uint16_t offset = 0; offset < count; offset += SCRATCH_SIZE)
+        {
+          const uint16_t chunk = std::min<uint16_t>(count - offset, SCRATCH_SIZE);
+
+          for (uint16_t i = 0; i < chunk; ++i)
+          {
+            m_scratch[i] = (request[6 + (offset + i) / 8] >> ((offset + i) % 8)) & 1U;
+          }
+
+          m_coils.write(static_cast<uint16_t>(start + offset), chunk, m_scratch);
+        }
+
+        system::memory::fast_memcpy(response, request, 5);
+        ret = 5;
+      }
+    }
+
+    return ret;
+  }
+
+  /**
+   * @brief  Modbus 从站 写多个保持寄存器 (功能码 0x10)
+   *
+   * @param  request    请求PDU
+   * @param  size       请求PDU长度
+   * @param  response   响应PDU缓存区
+   * @param  exception  异常码
+   * @return uint16_t   响应PDU长度
+   */
+  uint16_t write_multiple_registers(const uint8_t* request, uint16_t size, uint8_t* response, uint8_t& exception)
+  {
+    using namespace protocol_internal::modbus_internal;
+
+    uint16_t ret = 0;
+
+    if (0 == Holding_Registers::segment_count())
+    {
+      exception = Exception_Code::Illegal_Function;
+    }
+    else if (size < 6)
+    {
+      exception = Exception_Code::Illegal_Data_Value;
+    }
+    else
+    {
+      const uint16_t start = get_u16(request + 1);
+      const uint16_t count = get_u16(request + 3);
+      const uint8_t  bytes = request[5];
+
+      if (0 == count || count > WRITE_REGISTERS_MAX || bytes != count * 2 || size != 6 + bytes)
+      {
+        exception = Exception_Code::Illegal_Data_Value;
+      }
+      else if (!Holding_Registers::contains(start, count))
+      {
+        exception = Exception_Code::Illegal_Data_Address;
+      }
+      else
+      {
+        decode_registers(start, count, request + 6, exception);
+        system::memory::fast_memcpy(response, request, 5);
+        ret = 5;
+      }
+    }
+
+    return ret;
+  }
+
+  /**
+   * @brief  Modbus 从站 读写多个保持寄存器 (功能码 0x17，先写后读)
+   *
+   * @param  request    请求PDU
+   * @param  size       请求PDU长度
+   * @param  response   响应PDU缓存区
+   * @param  exception  异常码
+   * @return uint16_t   响应PDU长度
+   */
+  uint16_t read_write_registers(const uint8_t* request, uint16_t size, uint8_t* response, uint8_t& exception)
+  {
+    using namespace protocol_internal::modbus_internal;
+
+    uint16_t ret = 0;
+
+    if (0 == Holding_Registers::segment_count())
+    {
+      exception = Exception_Code::Illegal_Function;
+    }
+    else if (size < 10)
+    {
+      exception = Exception_Code::Illegal_Data_Value;
+    }
+    else
+    {
+      const uint16_t read_start  = get_u16(request + 1);
+      const uint16_t read_count  = get_u16(request + 3);
+      const uint16_t write_start = get_u16(request + 5);
+      const uint16_t write_count = get_u16(request + 7);
+      const uint8_t  bytes       = request[9];
+
+      if (0 == read_count || read_count > READ_REGISTERS_MAX || 0 == write_count || write_count > RW_WRITE_MAX || bytes != write_count * 2 || size != 10 + bytes)
+      {
+        exception = Exception_Code::Illegal_Data_Value;
+      }
+      else if (!Holding_Registers::contains(read_start, read_count) || !Holding_Registers::contains(write_start, write_count))
+      {
+        exception = Exception_Code::Illegal_Data_Address;
+      }
+      else
+      {
+        decode_registers(write_start, write_count, request + 10, exception);
+        response[0] = request[0];
+        ret         = 2 + encode_registers(m_holding_registers, read_start, read_count, response + 1);
+      }
+    }
+
+    return ret;
+  }
+
+public:
+  /**
+   * @brief  Modbus 从站 构造函数
+   */
+  explicit Slave() {}
+
+  /**
+   * @brief  Modbus 从站 析构函数
+   */
+  ~Slave() {}
+
+  /**
+   * @brief  Modbus 从站 处理请求PDU
+   *
+   * @param  request   请求PDU (功能码 + 数据)
+   * @param  size      请求PDU长度
+   * @param  response  响应PDU缓存区 (不小于 PDU_MAX_SIZE，不可与请求重叠)
+   * @return uint16_t  响应PDU长度，请求为空返回0
+   */
+  uint16_t process(const uint8_t* request, uint16_t size, uint8_t* response)
+  {
+    uint16_t ret       = 0;
+    uint8_t  exception = Exception_Code::None;
+
+    if (0 != size)
+    {
+      m_stats.requests++;
+
+      switch (request[0])
+      {
+        case Function_Code::Read_Coils :
+          ret = read_bits(m_coils, request, size, response, exception);
+          break;
+        case Function_Code::Read_Discrete_Inputs :
+          ret = read_bits(m_discrete_inputs, request, size, response, exception);
+          break;
+        case Function_Code::Read_Holding_Registers :
+          ret = read_registers(m_holding_registers, request, size, response, exception);
+          break;
+        case Function_Code::Read_Input_Registers :
+          ret = read_registers(m_input_registers, request, size, response, exception);
+          break;
+        case Function_Code::Write_Single_Coil :
+          ret = write_single_coil(request, size, response, exception);
+          break;
+        case Function_Code::Write_Single_Register :
+          ret = write_single_register(request, size, response, exception);
+          break;
+        case Function_Code::Write_Multiple_Coils :
+          ret = write_multiple_coils(request, size, response, exception);
+          break;
+        case Function_Code::Write_Multiple_Registers :
+          ret = write_multiple_registers(request, size, response, exception);
+          break;
+        case Function_Code::Read_Write_Multiple_Registers :
+          ret = read_write_registers(request, size, response, exception);
+          break;
+        default :
+          exception = Exception_Code::Illegal_Function;
+          break;
+      }
+
+      if (Exception_Code::None != exception)
+      {
+        response[0] = request[0] | Function_Code::Exception_Flag;
+        response[1] = exception;
+        ret         = 2;
+        m_stats.exceptions++;
+      }
+    }
+
+    return ret;
+  }
+
+  /**
+   * @brief  Modbus 从站 获取保持寄存器表
+   *
+   * @return Holding_Registers& 数据表
+   */
+  Holding_Registers& holding_registers(void)
+  {
+    return m_holding_registers;
+  }
+
+  /**
+   * @brief  Modbus 从站 获取输入寄存器表
+   *
+   * @return Input_Registers& 数据表
+   */
+  Input_Registers& input_registers(void)
+  {
+    return m_input_registers;
+  }
+
+  /**
+   * @brief  Modbus 从站 获取线圈表
+   *
+   * @return Coils& 数据表
+   */
+  Coils& coils(void)
+  {
+    return m_coils;
+  }
+
+  /**
+   * @brief  Modbus 从站 获取离散输入表
+   *
+   * @return Discrete_Inputs& 数据表
+   */
+  Discrete_Inputs& discrete_inputs(void)
+  {
+    return m_discrete_inputs;
+  }
+
+  /**
+   * @brief  Modbus 从站 获取处理统计
+   *
+   * @return Slave_Stats 统计
+   */
+  Slave_Stats stats(void) const
+  {
+    return m_stats;
+  }
+
+  /**
+   * @brief  Modbus 从站 清零处理统计
+   */
+  void reset_stats(void)
+  {
+    m_stats = { 0 };
+  }
+};
+
+/**
+ * @brief  Modbus RTU 传输层 (帧间隔分帧 + CRC-16)
+ *
+ * @tparam Slave_Type  从站类型 (modbus::Slave)
+ * @note   receive() 按到达顺序输入数据块及其最后一个字节的时间戳 (任意频率的自由计数)，poll() 在静默超过 t3.5 后完成分帧并生成响应;
+ *         块间隔扣除块内字符时间后超过 t1.5 的帧判为格式错误并丢弃; 波特率高于 19200 时 t1.5/t3.5 固定为 750us/1750us;
+ *         serve() 适配任意流设备，以线程读到数据时的 DWT 周期计数为时间戳 (而非到达时刻)，线程唤醒延迟的抖动超过 t1.5
+ *         (19200 波特时 859us，更高波特率时 750us) 后完好的帧会被误判为损坏 (实测见 modbus_slave_test);
+ *         无法保证该延迟时应在接收中断/线路空闲回调中以到达时间戳调用 receive()，线程中关中断调用 poll();
+ *         广播帧 (地址0) 照常处理但不响应
+ */
+template <typename Slave_Type>
+class Rtu_Transport
+{
+  // 禁止拷贝和移动
+  QAQ_NO_COPY_MOVE(Rtu_Transport)
+
+private:
+  /// @brief 从站
+  Slave_Type&     m_slave;
+  /// @brief 本站地址
+  uint8_t         m_address;
+  /// @brief 字符时间 (计数)
+  uint32_t        m_char_ticks                   = 0;
+  /// @brief t1.5 字符间隔上限 (计数)
+  uint32_t        m_t15_ticks                    = 0;
+  /// @brief t3.5 帧间隔 (计数)
+  uint32_t        m_t35_ticks                    = 0;
+  /// @brief t3.5 帧间隔等待时间 - 毫秒 (serve 使用)
+  uint32_t        m_silence_ms                   = 1;
+  /// @brief 最后一个字节时间戳
+  uint32_t        m_last_tick                    = 0;
+  /// @brief 已接收长度
+  uint16_t        m_rx_size                      = 0;
+  /// @brief 当前帧已损坏
+  bool            m_damaged                      = false;
+  /// @brief 接收缓存区
+  uint8_t         m_rx_buffer[RTU_ADU_MAX_SIZE]  = { 0 };
+  /// @brief 发送缓存区
+  uint8_t         m_tx_buffer[RTU_ADU_MAX_SIZE]  = { 0 };
+  /// @brief 设备读取块缓存区 (serve 使用)
+  uint8_t         m_rx_chunk[64]                 = { 0 };
+  /// @brief 传输统计
+  Transport_Stats m_stats                        = { 0 };
+
+  /**
+   * @brief  Modbus RTU 完成一帧处理
+   *
+   * @return uint16_t 响应ADU长度，无响应返回0
+   */
+  uint16_t complete(void)
+  {
+    uint16_t ret = 0;
+
+    if (m_damaged || m_rx_size < 4)
+    {
+      m_stats.frame_errors++;
+    }
+    else if (0 != system::algorithm::Crc16_Modbus::calculate(m_rx_buffer, m_rx_size))
+    {
+      m_stats.crc_errors++;
+    }
+    else if (0 != m_rx_buffer[0] && m_address != m_rx_buffer[0])
+    {
+      m_stats.ignored++;
+    }
+    else
+    {
+      const uint16_t length = m_slave.process(m_rx_buffer + 1, m_rx_size - 3, m_tx_buffer + 1);
+
+      m_stats.frames++;
+
+      if (0 == m_rx_buffer[0])
+      {
+        m_stats.broadcasts++;
+      }
+      else if (0 != length)
+      {
+        m_tx_buffer[0] = m_address;
+
+        const uint16_t crc      = system::algorithm::Crc16_Modbus::calculate(m_tx_buffer, length + 1);
+        m_tx_buffer[length + 1] = static_cast<uint8_t>(crc);
+        m_tx_buffer[length + 2] = static_cast<uint8_t>(crc >> 8);
+        ret                     = length + 3;
+        m_stats.responses++;
+      }
+    }
+
+    m_rx_size = 0;
+    m_damaged = false;
+
+    return ret;
+  }
+
+public:
+  /**
+   * @brief  Modbus RTU 构造函数
+   *
+   * @param  slave      从站
+   * @param  address    本站地址 (1~247)
+   * @param  baud_rate  波特率
+   * @param  tick_freq  时间戳计数频率 (Hz)，默认 DWT 周期计数
+   */
+  explicit Rtu_Transport(Slave_Type& slave, uint8_t address, uint32_t baud_rate = 115200, uint32_t tick_freq = SystemCoreClock) : m_slave(slave), m_address(address)
+  {
+    set_timing(baud_rate, tick_freq);
+  }
+
+  /**
+   * @brief  Modbus RTU 析构函数
+   */
+  ~Rtu_Transport() {}
+
+  /**
+   * @brief  Modbus RTU 设置帧间隔时序 (每字符按 11 位计)
+   *
+   * @param  baud_rate  波特率
+   * @param  tick_freq  时间戳计数频率 (Hz)
+   */
+  void set_timing(uint32_t baud_rate, uint32_t tick_freq)
+  {
+    const uint32_t t15_us = (baud_rate > 19200) ? 750U : static_cast<uint32_t>(16500000ULL / baud_rate);
+    const uint32_t t35_us = (baud_rate > 19200) ? 1750U : static_cast<uint32_t>(38500000ULL / baud_rate);
+
+    m_char_ticks = static_cast<uint32_t>(11ULL * tick_freq / baud_rate);
+    m_t15_ticks  = static_cast<uint32_t>(static_cast<uint64_t>(t15_us) * tick_freq / 1000000U);
+    m_t35_ticks  = static_cast<uint32_t>(static_cast<uint64_t>(t35_us) * tick_freq / 1000000U);
+    m_silence_ms = (t35_us + 999U) / 1000U + 1U;
+  }
+
+  /**
+   * @brief  Modbus RTU 输入数据块
+   *
+   * @param  data  数据指针
+   * @param  size  数据大小
+   * @param  tick  数据块最后一个字节的到达时间戳
+   * @note   距上一块的静默已超过 t3.5 而未调用 poll() 时，上一帧按格式错误丢弃
+   */
+  void receive(const uint8_t* data, uint32_t size, uint32_t tick)
+  {
+    if (0 != size)
+    {
+      if (0 != m_rx_size)
+      {
+        const uint32_t elapsed = tick - m_last_tick;
+        const uint32_t span    = size * m_char_ticks;
+        const uint32_t gap     = (elapsed > span) ? (elapsed - span) : 0U;
+
+        if (gap >= m_t35_ticks)
+        {
+          m_stats.frame_errors++;
+          m_rx_size = 0;
+          m_damaged = false;
+        }
+        else if (gap > m_t15_ticks)
+        {
+          m_damaged = true;
+        }
+      }
+
+      const uint32_t copy = std::min<uint32_t>(size, RTU_ADU_MAX_SIZE - m_rx_size);
+
+      system::memory::fast_memcpy(m_rx_buffer + m_rx_size, data, copy);
+      m_rx_size   += copy;
+      m_damaged   |= (copy != size);
+      m_last_tick  = tick;
+    }
+  }
+
+  /**
+   * @brief  Modbus RTU 帧间隔检查
+   *
+   * @param  tick      当前时间戳
+   * @param  response  响应ADU指针 (返回值非0时有效，至下一次 poll 前不变)
+   * @return uint16_t  响应ADU长度，帧未结束或无需响应返回0
+   */
+  uint16_t poll(uint32_t tick, const uint8_t*& response)
+  {
+    uint16_t ret = 0;
+
+    if (0 != m_rx_size && (tick - m_last_tick) >= m_t35_ticks)
+    {
+      ret      = complete();
+      response = m_tx_buffer;
+    }
+
+    return ret;
+  }
+
+  /**
+   * @brief  Modbus RTU 在流设备上处理一个请求
+   *
+   * @tparam Device      流设备类型
+   * @param  device      流设备
+   * @param  timeout_ms  等待请求首字节超时时间 - 毫秒
+   * @return true        已处理完整帧 (含无需响应的帧)
+   * @return false       超时或设备错误
+   */
+  template <typename Device>
+  bool serve(Device& device, uint32_t timeout_ms = TX_WAIT_FOREVER)
+  {
+    bool    ret  = false;
+    int64_t size = device.read(m_rx_chunk, 1, timeout_ms);
+
+    while (size > 0)
+    {
+      const int64_t more = device.read(m_rx_chunk + 1, sizeof(m_rx_chunk) - 1, 0);
+
+      size += (more > 0) ? more : 0;
+      receive(m_rx_chunk, static_cast<uint32_t>(size), system::system_internal::device_internal::device_cycle_count());
+      size  = device.read(m_rx_chunk, 1, m_silence_ms);
+    }
+
+    const bool     pending  = (0 != m_rx_size);
+    const uint8_t* response = nullptr;
+    const uint16_t length   = poll(system::system_internal::device_internal::device_cycle_count(), response);
+
+    if (0 != length && length == device.write(response, length, TX_WAIT_FOREVER))
+    {
+      device.flush();
+    }
+
+    ret = pending && (0 == m_rx_size);
+
+    return ret;
+  }
+
+  /**
+   * @brief  Modbus RTU 设置本站地址
+   *
+   * @param  address 本站地址 (1~247)
+   */
+  void set_address(uint8_t address)
+  {
+    m_address = address;
+  }
+
+  /**
+   * @brief  Modbus RTU 获取传输统计
+   *
+   * @return Transport_Stats 统计
+   */
+  Transport_Stats stats(void) const
+  {
+    return m_stats;
+  }
+
+  /**
+   * @brief  Modbus RTU 清零传输统计
+   */
+  void reset_stats(void)
+  {
+    m_stats = { 0 };
+  }
+};
+
+/**
+ * @brief  Modbus TCP 传输层 (MBAP 报文头分帧)
+ *
+ * @tparam Slave_Type  从站类型 (modbus::Slave)
+ * @note   MBAP: 事务标识(2) + 协议标识(2，须为0) + 长度(2，单元标识与PDU字节数) + 单元标识(1)，均为大端;
+ *         单元标识原样回送; serve() 基于流设备的 read_frame() 分帧，适用于 TCP 服务器客户端设备;
+ *         各客户端共享收发缓存区，serve() 须在同一线程 (如服务器线程的客户端回调) 中调用
+ */
+template <typename Slave_Type>
+class Tcp_Transport
+{
+  // 禁止拷贝和移动
+  QAQ_NO_COPY_MOVE(Tcp_Transport)
+
+private:
+  /// @brief 从站
+  Slave_Type&     m_slave;
+  /// @brief 接收缓存区
+  uint8_t         m_rx_buffer[TCP_ADU_MAX_SIZE] = { 0 };
+  /// @brief 发送缓存区
+  uint8_t         m_tx_buffer[TCP_ADU_MAX_SIZE] = { 0 };
+  /// @brief 传输统计
+  Transport_Stats m_stats                       = { 0 };
+
+public:
+  /**
+   * @brief  Modbus TCP 构造函数
+   *
+   * @param  slave  从站
+   */
+  explicit Tcp_Transport(Slave_Type& slave) : m_slave(slave) {}
+
+  /**
+   * @brief  Modbus TCP 析构函数
+   */
+  ~Tcp_Transport() {}
+
+  /**
+   * @brief  Modbus TCP 处理一帧ADU
+   *
+   * @param  request   请求ADU (MBAP + PDU)
+   * @param  size      请求ADU长度
+   * @param  response  响应ADU指针 (返回值非0时有效，至下一次处理前不变)
+   * @return uint16_t  响应ADU长度，报文头非法返回0
+   */
+  uint16_t process(const uint8_t* request, uint16_t size, const uint8_t*& response)
+  {
+    using namespace protocol_internal::modbus_internal;
+
+    uint16_t ret = 0;
+
+    if (size <= MBAP_HEADER_SIZE || size > TCP_ADU_MAX_SIZE || 0 != get_u16(request + 2) || get_u16(request + 4) != size - 6)
+    {
+      m_stats.frame_errors++;
+    }
+    else
+    {
+      const uint16_t length = m_slave.process(request + MBAP_HEADER_SIZE, size - MBAP_HEADER_SIZE, m_tx_buffer + MBAP_HEADER_SIZE);
+
+      m_stats.frames++;
+      system::memory::fast_memcpy(m_tx_buffer, request, 4);
+      put_u16(m_tx_buffer + 4, static_cast<uint16_t>(length + 1));
+      m_tx_buffer[6] = request[6];
+      response       = m_tx_buffer;
+      ret            = MBAP_HEADER_SIZE + length;
+      m_stats.responses++;
+    }
+
+    return ret;
+  }
+
+  /**
+   * @brief  Modbus TCP 在流设备上处理一个请求
+   *
+   * @tparam Device      流设备类型 (须支持 read_frame)
+   * @param  device      流设备
+   * @param  timeout_ms  等待请求超时时间 - 毫秒
+   * @return true        已处理完整帧
+   * @return false       超时、报文头非法 (输入缓存区已清空) 或设备错误
+   */
+  template <typename Device>
+  bool serve(Device& device, uint32_t timeout_ms = TX_WAIT_FOREVER)
+  {
+    static constexpr system::device::Frame_Length_Spec MBAP_SPEC = { 4, 2, true, 0 };
+
+    bool          ret  = false;
+    const int64_t size = device.read_frame(MBAP_SPEC, m_rx_buffer, sizeof(m_rx_buffer), timeout_ms);
+
+    if (size < 0)
+    {
+      m_stats.frame_errors++;
+      device.clear();
+    }
+    else if (size > 0)
+    {
+      const uint8_t* response = nullptr;
+      const uint16_t length   = process(m_rx_buffer, static_cast<uint16_t>(size), response);
+
+      if (0 != length && length == device.write(response, length, TX_WAIT_FOREVER))
+      {
+        device.flush();
+      }
+
+      ret = (0 != length);
+    }
+
+    return ret;
+  }
+
+  /**
+   * @brief  Modbus TCP 获取传输统计
+   *
+   * @return Transport_Stats 统计
+   */
+  Transport_Stats stats(void) const
+  {
+    return m_stats;
+  }
+
+  /**
+   * @brief  Modbus TCP 清零传输统计
+   */
+  void reset_stats(void)
+  {
+    m_stats = { 0 };
+  }
+};
+} /* namespace modbus */
+} /* namespace protocol */
+} /* namespace QAQ */
+
+#endif /* __MODBUS_SLAVE_HPP__ */
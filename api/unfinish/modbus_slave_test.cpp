@@ -0,0 +1,385 @@
+/**
+ * @file   modbus_slave_test.cpp
+ * @brief  Modbus 从站 主机测试: 报文回放、处理吞吐与响应延迟，以及 serve() 读取时间戳的误判阈值
+ *
+ * @note   仅用于主机，不参与固件编译 (已加入 eide excludeList);
+ *         回放一段按线路格式记录的 RTU 报文序列 (请求 ADU、期望响应 ADU 与帧前静默)，按字节中断与 FIFO/DMA 分块两种方式
+ *         以到达时间戳输入 Rtu_Transport，逐帧比对响应与统计，TCP 报文经 Tcp_Transport 回放;
+ *         基准输出主机处理吞吐 (请求/秒)、最坏处理时间与线路上的最坏响应延迟 (t3.5 + 处理);
+ *         最后以唤醒延迟抖动模型回放 serve() 的读取时间戳，给出完好帧被误判为损坏的比例
+ *
+ *         构建 (仓库根目录):
+ *         g++ -std=c++17 -O2 -g -fsanitize=address,undefined -fpermissive -w \
+ *             $(python3 -c "import json;c=json.load(open('.eide/eide.json'))['targets']['Debug']['custom_dep'];print(' '.join(['-I'+p for p in c['incList']]+['-D'+d for d in c['defineList']]))") \
+ *             api/unfinish/modbus_slave_test.cpp -o modbus_slave_test && ./modbus_slave_test
+ */
+#include "modbus_slave.hpp"
+
+#include <chrono>
+#include <cstdio>
+
+using namespace QAQ::protocol::modbus;
+
+uint32_t SystemCoreClock = 480000000;
+
+/* ThreadX 桩函数 (从站与传输层不使用内核对象，仅满足头文件中内联函数的链接) */
+extern "C"
+{
+  ULONG _tx_time_get(VOID)
+  {
+    return 0;
+  }
+
+  TX_THREAD* _tx_thread_identify(VOID)
+  {
+    return nullptr;
+  }
+
+  UINT _tx_thread_sleep(ULONG)
+  {
+    return TX_SUCCESS;
+  }
+
+  VOID _tx_thread_relinquish(VOID) {}
+}
+
+namespace
+{
+/// @brief 时间戳频率 (1 计数 = 1us)
+constexpr uint32_t TICK_FREQ = 1000000;
+/// @brief 本站地址
+constexpr uint8_t  ADDRESS   = 1;
+
+/// @brief 测试从站: 保持寄存器 0~15、32~39，输入寄存器 0~7，线圈 0~31，离散输入 0~15
+using Test_Slave = Slave<Register_Group<Register<0, 16>, Register<32, 8>>, Register_Group<Register<0, 8>>, Register_Group<Register<0, 32>>, Register_Group<Register<0, 16>>>;
+using Test_Rtu   = Rtu_Transport<Test_Slave>;
+using Test_Tcp   = Tcp_Transport<Test_Slave>;
+
+/// @brief 失败的检查数
+int g_failures = 0;
+
+#define CHECK(cond)                                                  \
+  do                                                                 \
+  {                                                                  \
+    if (!(cond))                                                     \
+    {                                                                \
+      ++g_failures;                                                  \
+      printf("%s:%d: CHECK(%s) failed\n", __FILE__, __LINE__, #cond); \
+    }                                                                \
+  } while (0)
+
+/// @brief 报文记录
+struct Record
+{
+  const char* name;           /* 名称 */
+  uint8_t     request[20];    /* 请求 ADU */
+  uint8_t     request_size;   /* 请求 ADU 长度 */
+  uint8_t     response[16];   /* 期望响应 ADU */
+  uint8_t     response_size;  /* 期望响应 ADU 长度 (0 为不响应) */
+  uint8_t     pause_after;    /* 帧内停顿位置 (字节数，0 为无停顿) */
+  uint16_t    pause_us;       /* 帧内停顿时间 - 微秒 */
+};
+
+/// @brief RTU 报文序列 (按顺序回放，后续读取依赖前面的写入)
+const Record g_trace[] = {
+  { "write single register", { 0x01, 0x06, 0x00, 0x01, 0x12, 0x34, 0xD5, 0x7D }, 8, { 0x01, 0x06, 0x00, 0x01, 0x12, 0x34, 0xD5, 0x7D }, 8, 0, 0 },
+  { "write multiple registers", { 0x01, 0x10, 0x00, 0x02, 0x00, 0x02, 0x04, 0xAB, 0xCD, 0x00, 0x01, 0x02, 0x6D }, 13, { 0x01, 0x10, 0x00, 0x02, 0x00, 0x02, 0xE0, 0x08 }, 8, 0, 0 },
+  { "read holding registers", { 0x01, 0x03, 0x00, 0x00, 0x00, 0x04, 0x44, 0x09 }, 8, { 0x01, 0x03, 0x08, 0x00, 0x00, 0x12, 0x34, 0xAB, 0xCD, 0x00, 0x01, 0x57, 0x7A }, 13, 0, 0 },
+  { "read register gap", { 0x01, 0x03, 0x00, 0x10, 0x00, 0x01, 0x85, 0xCF }, 8, { 0x01, 0x83, 0x02, 0xC0, 0xF1 }, 5, 0, 0 },
+  { "broadcast write", { 0x00, 0x06, 0x00, 0x05, 0x00, 0x07, 0xD9, 0xD8 }, 8, {}, 0, 0, 0 },
+  { "read broadcast result", { 0x01, 0x03, 0x00, 0x05, 0x00, 0x01, 0x94, 0x0B }, 8, { 0x01, 0x03, 0x02, 0x00, 0x07, 0xF9, 0x86 }, 7, 0, 0 },
+  { "other station", { 0x02, 0x03, 0x00, 0x00, 0x00, 0x01, 0x84, 0x39 }, 8, {}, 0, 0, 0 },
+  { "write single coil", { 0x01, 0x05, 0x00, 0x03, 0xFF, 0x00, 0x7C, 0x3A }, 8, { 0x01, 0x05, 0x00, 0x03, 0xFF, 0x00, 0x7C, 0x3A }, 8, 0, 0 },
+  { "read coils", { 0x01, 0x01, 0x00, 0x00, 0x00, 0x08, 0x3D, 0xCC }, 8, { 0x01, 0x01, 0x01, 0x08, 0x50, 0x4E }, 6, 0, 0 },
+  { "bad crc", { 0x01, 0x03, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00 }, 8, {}, 0, 0, 0 },
+  { "inter-char pause", { 0x01, 0x03, 0x00, 0x00, 0x00, 0x01, 0x84, 0x0A }, 8, {}, 0, 3, 1200 },
+  { "tolerated pause", { 0x01, 0x03, 0x00, 0x05, 0x00, 0x01, 0x94, 0x0B }, 8, { 0x01, 0x03, 0x02, 0x00, 0x07, 0xF9, 0x86 }, 7, 3, 500 },
+  { "illegal function", { 0x01, 0x2B, 0x0E, 0x01, 0x00, 0x70, 0x77 }, 7, { 0x01, 0xAB, 0x01, 0x9E, 0xF0 }, 5, 0, 0 },
+  { "read/write registers", { 0x01, 0x17, 0x00, 0x20, 0x00, 0x02, 0x00, 0x20, 0x00, 0x02, 0x04, 0x11, 0x11, 0x22, 0x22, 0x89, 0x67 }, 17, { 0x01, 0x17, 0x04, 0x11, 0x11, 0x22, 0x22, 0x34, 0xA7 }, 9, 0, 0 },
+  { "read input registers", { 0x01, 0x04, 0x00, 0x00, 0x00, 0x02, 0x71, 0xCB }, 8, { 0x01, 0x04, 0x04, 0x00, 0x00, 0x00, 0x00, 0xFB, 0x84 }, 9, 0, 0 },
+};
+
+/// @brief 报文序列长度
+constexpr uint32_t TRACE_SIZE = sizeof(g_trace) / sizeof(g_trace[0]);
+
+/// @brief 回放结果
+struct Replay_Result
+{
+  uint32_t requests;   /* 回放的请求数 */
+  uint32_t mismatches; /* 响应不符的请求数 */
+  uint64_t total_ns;   /* 主机处理总时间 */
+  uint64_t worst_ns;   /* 单帧最坏处理时间 (完成分帧的 poll) */
+  uint64_t wire_us;    /* 线路占用时间 */
+};
+
+/**
+ * @brief  t1.5/t3.5 (us)，与 Rtu_Transport::set_timing 一致
+ */
+uint32_t t15_us(uint32_t baud_rate)
+{
+  return (baud_rate > 19200) ? 750U : static_cast<uint32_t>(16500000ULL / baud_rate);
+}
+
+uint32_t t35_us(uint32_t baud_rate)
+{
+  return (baud_rate > 19200) ? 1750U : static_cast<uint32_t>(38500000ULL / baud_rate);
+}
+
+/**
+ * @brief  回放报文序列
+ *
+ * @param  rtu        传输层
+ * @param  baud_rate  波特率
+ * @param  chunk      每次输入的最大字节数 (1 为字节中断，其余为 FIFO/DMA 分块)
+ * @param  tick       起始时间戳 (返回回放结束时间戳)
+ * @param  result     回放结果 (累加)
+ */
+void replay(Test_Rtu& rtu, uint32_t baud_rate, uint32_t chunk, uint32_t& tick, Replay_Result& result)
+{
+  const uint32_t char_us = 11000000U / baud_rate;
+
+  for (const Record& record : g_trace)
+  {
+    const uint8_t* response = nullptr;
+    uint32_t       sent     = 0;
+
+    // 帧前静默 t3.5 以上
+    tick += t35_us(baud_rate) + char_us;
+
+    while (sent < record.request_size)
+    {
+      uint32_t size = std::min(chunk, static_cast<uint32_t>(record.request_size) - sent);
+
+      if (0 != record.pause_after && sent < record.pause_after)
+      {
+        size = std::min(size, record.pause_after - sent);
+      }
+
+      tick += size * char_us;
+      rtu.receive(record.request + sent, size, tick);
+      sent += size;
+
+      // 帧内未到 t3.5 的 poll 不得结束分帧
+      CHECK(0 == rtu.poll(tick + t15_us(baud_rate), response));
+
+      if (sent == record.pause_after)
+      {
+        tick += record.pause_us;
+      }
+    }
+
+    tick += t35_us(baud_rate);
+
+    const auto     start  = std::chrono::steady_clock::now();
+    const uint16_t length = rtu.poll(tick, response);
+    const uint64_t ns     = static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start).count());
+
+    if (length != record.response_size || (0 != length && 0 != memcmp(response, record.response, length)))
+    {
+      ++result.mismatches;
+      printf("  %s: response mismatch (length %u)\n", record.name, length);
+    }
+
+    result.requests++;
+    result.total_ns += ns;
+    result.worst_ns  = std::max(result.worst_ns, ns);
+    result.wire_us  += (t35_us(baud_rate) + char_us) + (record.request_size + record.response_size) * char_us + record.pause_us + t35_us(baud_rate);
+  }
+}
+} /* namespace */
+
+/**
+ * @brief  RTU 回放: 逐帧响应与传输统计，字节中断与分块输入结果一致
+ */
+static void test_rtu_replay(void)
+{
+  const uint32_t chunks[] = { 1, 4, 16, 64 };
+
+  for (uint32_t chunk : chunks)
+  {
+    Test_Slave    slave;
+    Test_Rtu      rtu(slave, ADDRESS, 19200, TICK_FREQ);
+    Replay_Result result = {};
+    uint32_t      tick   = 0xFFFF0000U; // 回放过程中时间戳回绕
+
+    replay(rtu, 19200, chunk, tick, result);
+
+    const Transport_Stats stats = rtu.stats();
+
+    CHECK(TRACE_SIZE == result.requests && 0 == result.mismatches);
+    CHECK(12 == stats.frames && 11 == stats.responses && 1 == stats.broadcasts && 1 == stats.ignored);
+    CHECK(1 == stats.crc_errors && 1 == stats.frame_errors);
+    CHECK(12 == slave.stats().requests && 2 == slave.stats().exceptions);
+    CHECK(0x2222 == slave.holding_registers().read(33));
+  }
+}
+
+/**
+ * @brief  RTU 分帧边界: 超长帧、静默超过 t3.5 未 poll 的残帧与过短帧
+ */
+static void test_rtu_framing(void)
+{
+  Test_Slave     slave;
+  Test_Rtu       rtu(slave, ADDRESS, 115200, TICK_FREQ);
+  const uint8_t* response = nullptr;
+  uint8_t        noise[300];
+
+  memset(noise, 0x55, sizeof(noise));
+
+  // 超长帧截断后判为格式错误
+  rtu.receive(noise, sizeof(noise), 1000);
+  CHECK(0 == rtu.poll(1000 + 1750, response));
+  CHECK(1 == rtu.stats().frame_errors);
+
+  // 残帧在下一块到达时丢弃，后一帧正常处理
+  rtu.receive(g_trace[2].request, 3, 10000);
+  rtu.receive(g_trace[2].request, g_trace[2].request_size, 20000);
+  CHECK(2 == rtu.stats().frame_errors);
+  CHECK(13 == rtu.poll(20000 + 1750, response) && 0x03 == response[1]);
+
+  // 过短帧
+  rtu.receive(g_trace[2].request, 3, 30000);
+  CHECK(0 == rtu.poll(30000 + 1750, response));
+  CHECK(3 == rtu.stats().frame_errors && 1 == rtu.stats().responses);
+}
+
+/**
+ * @brief  TCP 回放: MBAP 事务标识与单元标识回送，非法报文头不响应
+ */
+static void test_tcp_replay(void)
+{
+  Test_Slave     slave;
+  Test_Tcp       tcp(slave);
+  const uint8_t* response = nullptr;
+
+  const uint8_t write[] = { 0x00, 0x07, 0x00, 0x00, 0x00, 0x06, 0xFF, 0x06, 0x00, 0x01, 0x12, 0x34 };
+  const uint8_t read[]  = { 0x12, 0x34, 0x00, 0x00, 0x00, 0x06, 0x11, 0x03, 0x00, 0x00, 0x00, 0x02 };
+  const uint8_t reply[] = { 0x12, 0x34, 0x00, 0x00, 0x00, 0x07, 0x11, 0x03, 0x04, 0x00, 0x00, 0x12, 0x34 };
+  const uint8_t proto[] = { 0x00, 0x01, 0x00, 0x01, 0x00, 0x06, 0x01, 0x03, 0x00, 0x00, 0x00, 0x01 };
+  const uint8_t len[]   = { 0x00, 0x01, 0x00, 0x00, 0x00, 0x07, 0x01, 0x03, 0x00, 0x00, 0x00, 0x01 };
+
+  CHECK(12 == tcp.process(write, sizeof(write), response) && 0 == memcmp(response, write, 12));
+  CHECK(sizeof(reply) == tcp.process(read, sizeof(read), response) && 0 == memcmp(response, reply, sizeof(reply)));
+  CHECK(0 == tcp.process(proto, sizeof(proto), response));
+  CHECK(0 == tcp.process(len, sizeof(len), response));
+  CHECK(2 == tcp.stats().frames && 2 == tcp.stats().frame_errors);
+}
+
+/**
+ * @brief  回放吞吐与响应延迟基准
+ */
+static void bench_replay(void)
+{
+  const uint32_t bauds[] = { 19200, 115200 };
+  const uint32_t rounds  = 20000;
+
+  printf("%-7s %-6s %12s %12s %12s %14s %14s\n", "baud", "chunk", "host req/s", "avg ns", "worst ns", "wire req/s", "worst resp us");
+
+  for (uint32_t baud_rate : bauds)
+  {
+    for (uint32_t chunk : { 1U, 64U })
+    {
+      Test_Slave    slave;
+      Test_Rtu      rtu(slave, ADDRESS, baud_rate, TICK_FREQ);
+      Replay_Result result = {};
+      uint32_t      tick   = 0;
+
+      for (uint32_t i = 0; i < rounds; ++i)
+      {
+        replay(rtu, baud_rate, chunk, tick, result);
+      }
+
+      CHECK(0 == result.mismatches);
+
+      // 线路上的最坏响应延迟: 末字节后等待 t3.5 判定帧结束，再加最坏处理时间
+      const double worst_response_us = t35_us(baud_rate) + result.worst_ns / 1000.0;
+
+      printf("%-7u %-6u %12.0f %12.1f %12llu %14.1f %14.1f\n", baud_rate, chunk, result.requests * 1e9 / result.total_ns, static_cast<double>(result.total_ns) / result.requests,
+             static_cast<unsigned long long>(result.worst_ns), result.requests * 1e6 / result.wire_us, worst_response_us);
+    }
+  }
+}
+
+/**
+ * @brief  serve() 读取时间戳误判: 以线程读取时刻作时间戳，唤醒延迟抖动超过 t1.5 后完好帧开始被判为损坏;
+ *         同样的分块以到达时间戳输入 (接收中断/线路空闲回调) 时不受影响
+ */
+static void bench_read_latency(void)
+{
+  const uint32_t baud_rate = 19200;
+  const uint32_t char_us   = 11000000U / baud_rate;
+  const uint32_t jitters[] = { 0, 250, 500, 750, 1000, 1500, 2000, 4000 };
+  const uint32_t frames    = 2000;
+  const Record&  record    = g_trace[2];
+  uint32_t       seed      = 1;
+
+  printf("read-time stamps @%u baud (t1.5 = %u us, char = %u us)\n", baud_rate, t15_us(baud_rate), char_us);
+  printf("%-10s %16s %16s\n", "jitter us", "read-time dmg %", "arrival dmg %");
+
+  for (uint32_t jitter : jitters)
+  {
+    Test_Slave slave;
+    Test_Rtu   thread_rtu(slave, ADDRESS, baud_rate, TICK_FREQ);
+    Test_Rtu   isr_rtu(slave, ADDRESS, baud_rate, TICK_FREQ);
+    uint32_t   tick = 0;
+
+    for (uint32_t f = 0; f < frames; ++f)
+    {
+      const uint8_t* response = nullptr;
+      const uint32_t start    = tick + t35_us(baud_rate) + char_us;
+      uint32_t       sent     = 0;
+      uint32_t       wake     = 0;
+
+      // 线程在未读字节到达后经过随机唤醒延迟读取此前到达的全部字节
+      while (sent < record.request_size)
+      {
+        seed = seed * 1664525U + 1013904223U;
+
+        const uint32_t arrival = start + (sent + 1) * char_us;
+        const uint32_t latency = (0 != jitter) ? ((seed >> 8) % (jitter + 1)) : 0U;
+
+        wake = arrival + latency;
+
+        const uint32_t ready = std::min<uint32_t>(record.request_size, (wake - start) / char_us);
+        const uint32_t size  = ready - sent;
+
+        thread_rtu.receive(record.request + sent, size, wake);
+        isr_rtu.receive(record.request + sent, size, start + ready * char_us);
+        sent = ready;
+      }
+
+      tick = std::max(wake, start + record.request_size * char_us) + t35_us(baud_rate) + jitter;
+      thread_rtu.poll(tick, response);
+      isr_rtu.poll(tick, response);
+    }
+
+    const double thread_damaged = 100.0 * thread_rtu.stats().frame_errors / frames;
+    const double isr_damaged    = 100.0 * isr_rtu.stats().frame_errors / frames;
+
+    CHECK(0 == isr_rtu.stats().frame_errors);
+
+    if (jitter <= t15_us(baud_rate) - char_us)
+    {
+      CHECK(0 == thread_rtu.stats().frame_errors);
+    }
+    else if (jitter >= 2 * t15_us(baud_rate))
+    {
+      CHECK(0 != thread_rtu.stats().frame_errors);
+    }
+
+    printf("%-10u %16.1f %16.1f\n", jitter, thread_damaged, isr_damaged);
+  }
+}
+
+int main(void)
+{
+  test_rtu_replay();
+  test_rtu_framing();
+  test_tcp_replay();
+  bench_replay();
+  bench_read_latency();
+
+  printf("modbus_slave_test: %s (%d failures)\n", 0 == g_failures ? "OK" : "FAILED", g_failures);
+  fflush(stdout);
+  return 0 == g_failures ? 0 : 1;
+}
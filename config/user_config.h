@@ -9,9 +9,31 @@ extern "C"
 #define DMA_REGION_START_ADDRESSES 0x30000000
 #define DMA_REGION_END_ADDRESSES   0x3001FFFF
 
+/// @brief 快速内存函数对DMA区域执行缓存维护 (DMA缓冲区全部由 Dma_Buffer_Pool 管理时可关闭)
+#define FAST_MEMORY_CACHE_MAINTENANCE 1
+
+/// @brief 快速内存函数使用 GCC 向量扩展实现 (0为编译器内置实现，按 Fast_Memory_Bench 的目标板周期计数取舍)
+#define FAST_MEMORY_VECTOR_BACKEND 1
+
 /// @brief 内存安全检查
 #define MEMORY_SAFETY_CHECKS 0
 
+/// @brief 设备管理器 快速通道 (串口等中断驱动设备) 线程优先级与栈大小
+#define DEVICE_MANAGER_FAST_PRIORITY     2
+#define DEVICE_MANAGER_FAST_STACK_SIZE   1536
+/// @brief 设备管理器 普通通道 (默认) 线程优先级与栈大小
+#define DEVICE_MANAGER_NORMAL_PRIORITY   3
+#define DEVICE_MANAGER_NORMAL_STACK_SIZE 1536
+/// @brief 设备管理器 慢速通道 (网络、存储等可能长时间阻塞的设备) 线程优先级与栈大小
+#define DEVICE_MANAGER_SLOW_PRIORITY     5
+#define DEVICE_MANAGER_SLOW_STACK_SIZE   2048
+/// @brief 设备管理器 通道配置表 {优先级, 栈大小, 线程名称}: 下标即 Device_Lane 编号 (前三项依次为 FAST/NORMAL/SLOW)，
+///        通道数量由表项数决定，可增加通道 (设备以 static_cast<Device_Lane>(编号) 选择) 或减少通道 (超出的编号归入最后一个通道)
+#define DEVICE_MANAGER_LANES                                                                           \
+  {DEVICE_MANAGER_FAST_PRIORITY,   DEVICE_MANAGER_FAST_STACK_SIZE,   "Device Manager Fast Thread"  }, \
+  {DEVICE_MANAGER_NORMAL_PRIORITY, DEVICE_MANAGER_NORMAL_STACK_SIZE, "Device Manager Normal Thread"}, \
+  {DEVICE_MANAGER_SLOW_PRIORITY,   DEVICE_MANAGER_SLOW_STACK_SIZE,   "Device Manager Slow Thread"  }
+
 /// @brief 系统错误日志
 #define SYSTEM_ERROR_LOG_ENABLE 1
 
@@ -73,6 +73,8 @@ extern "C"
 
     uint32_t pt_dma_total_transfer_count;
     uint32_t pt_dma_total_transfer_size;
+    uint32_t pt_dma_total_transfer_cycles;
+    uint32_t pt_dma_start_cycle;
 
 #endif
   } PT_DMA;
@@ -82,6 +84,8 @@ extern "C"
   #ifdef DMA_API_CHECK
 
     #define pt_dma_system_init               __pt_dma_system_init
+    #define pt_dma_channel_alloc             __pt_dma_channel_alloc
+    #define pt_dma_channel_free              __ptc_dma_channel_free
     #define pt_dma_creat                     __ptc_dma_creat
     #define pt_dma_delete                    __ptc_dma_delete
     #define pt_dma_config                    __ptc_dma_config
@@ -99,6 +103,8 @@ extern "C"
   #else
 
     #define pt_dma_system_init               __pt_dma_system_init
+    #define pt_dma_channel_alloc             __pt_dma_channel_alloc
+    #define pt_dma_channel_free              __pt_dma_channel_free
     #define pt_dma_creat                     __pt_dma_creat
     #define pt_dma_delete                    __pt_dma_delete
     #define pt_dma_config                    __pt_dma_config
@@ -122,6 +128,8 @@ extern "C"
 #endif /* PT_SOURCE_CODE */
 
   uint32_t __pt_dma_system_init(void);
+  uint32_t __pt_dma_channel_alloc(uint32_t* dma_channel_index);
+  uint32_t __pt_dma_channel_free(uint32_t dma_channel_index);
   uint32_t __pt_dma_creat(PT_DMA* dma_channel_ptr, pt_dma_direction_e dma_direction, pt_dma_mode_e dma_mode, uint8_t dma_src_address_is_auto_increment, uint8_t dma_dst_address_is_auto_increment, pt_dma_data_width_e dma_src_data_width, pt_dma_data_width_e dma_dst_data_width, pt_dma_priority_e dma_priority);
   uint32_t __pt_dma_delete(PT_DMA* dma_channel_ptr);
   uint32_t __pt_dma_config(PT_DMA* dma_channel_ptr, uint32_t dma_src_address, uint32_t dma_dst_address, uint32_t dma_memory_size, void (*dma_transferred_callback_function)(PT_DMA* pt_dma_handle, void* arg), void (*dma_error_callback_function)(PT_DMA* pt_dma_handle, void* arg), void* callback_arg);
@@ -138,6 +146,7 @@ extern "C"
 
 #ifdef DMA_API_CHECK
 
+  uint32_t __ptc_dma_channel_free(uint32_t dma_channel_index);
   uint32_t __ptc_dma_creat(PT_DMA* dma_channel_ptr, pt_dma_direction_e dma_direction, pt_dma_mode_e dma_mode, uint8_t dma_src_address_is_auto_increment, uint8_t dma_dst_address_is_auto_increment, pt_dma_data_width_e dma_src_data_width, pt_dma_data_width_e dma_dst_data_width, pt_dma_priority_e dma_priority);
   uint32_t __ptc_dma_delete(PT_DMA* dma_channel_ptr);
   uint32_t __ptc_dma_config(PT_DMA* dma_channel_ptr, uint32_t dma_src_address, uint32_t dma_dst_address, uint32_t dma_memory_size, void (*dma_transferred_callback_function)(PT_DMA* pt_dma_handle, void* arg), void (*dma_error_callback_function)(PT_DMA* pt_dma_handle, void* arg), void* callback_arg);
@@ -1,5 +1,8 @@
-#define PT_SOURCE_CODE
+#include "pt_dma_internal.h"
 
-#include "hardware/inc/pt_dma_api.h"
+uint32_t __pt_dma_active_memory_get(PT_DMA* dma_channel_ptr, uint8_t* dma_active_memory)
+{
+  *dma_active_memory = (0U != (pt_dma_stream(dma_channel_ptr)->CR & DMA_SxCR_CT)) ? 1U : 0U;
 
-uint32_t __pt_dma_active_memory_get(PT_DMA* dma_channel_ptr, uint8_t* dma_active_memory) {}
\ No newline at end of file
+  return PT_SUCCEED;
+}
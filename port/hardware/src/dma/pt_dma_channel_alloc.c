@@ -0,0 +1,22 @@
+#include "pt_dma_internal.h"
+
+uint32_t __pt_dma_channel_alloc(uint32_t* dma_channel_index)
+{
+  uint32_t ret     = PT_DMA_NO_CHANNEL;
+  uint32_t primask = pt_dma_lock();
+  uint32_t free    = (uint16_t)~g_pt_dma_channel_used_bitmap;
+
+  if (0U != free)
+  {
+    uint32_t index                = (uint32_t)__builtin_ctz(free);
+    g_pt_dma_channel_used_bitmap |= (uint16_t)(1U << index);
+    *dma_channel_index            = index;
+    ret                           = PT_SUCCEED;
+  }
+
+  pt_dma_unlock(primask);
+
+  PT_DMA_TRACE("Channel alloc: %d\n", (int)ret);
+
+  return ret;
+}
@@ -1,5 +1,93 @@
-#define PT_SOURCE_CODE
+#include "pt_dma_internal.h"
 
-#include "hardware/inc/pt_dma_api.h"
+static const uint32_t s_pt_dma_direction[] = { LL_DMA_DIRECTION_MEMORY_TO_MEMORY, LL_DMA_DIRECTION_MEMORY_TO_PERIPH, LL_DMA_DIRECTION_PERIPH_TO_MEMORY, LL_DMA_DIRECTION_PERIPH_TO_MEMORY };
+static const uint32_t s_pt_dma_mode[]      = { LL_DMA_MODE_NORMAL, LL_DMA_MODE_CIRCULAR, LL_DMA_MODE_PFCTRL };
+static const uint32_t s_pt_dma_priority[]  = { LL_DMA_PRIORITY_LOW, LL_DMA_PRIORITY_MEDIUM, LL_DMA_PRIORITY_HIGH, LL_DMA_PRIORITY_VERYHIGH };
 
-uint32_t __pt_dma_creat(PT_DMA* dma_channel_ptr, pt_dma_direction_e dma_direction, pt_dma_mode_e dma_mode, uint8_t dma_src_address_is_auto_increment, uint8_t dma_dst_address_is_auto_increment, pt_dma_data_width_e dma_src_data_width, pt_dma_data_width_e dma_dst_data_width, pt_dma_priority_e dma_priority) {}
\ No newline at end of file
+static void pt_dma_channel_configure(PT_DMA* dma_channel_ptr, pt_dma_direction_e dma_direction, pt_dma_mode_e dma_mode, uint8_t dma_src_address_is_auto_increment, uint8_t dma_dst_address_is_auto_increment, pt_dma_data_width_e dma_src_data_width, pt_dma_data_width_e dma_dst_data_width, pt_dma_priority_e dma_priority)
+{
+  /* 外设侧对应源 (内存到外设时为目标)，内存侧对应另一端 */
+  uint8_t             periph_increment = dma_src_address_is_auto_increment;
+  uint8_t             memory_increment = dma_dst_address_is_auto_increment;
+  pt_dma_data_width_e periph_width     = dma_src_data_width;
+  pt_dma_data_width_e memory_width     = dma_dst_data_width;
+
+  if (DMA_DIRE_MEM_TO_DEV == dma_direction)
+  {
+    periph_increment = dma_dst_address_is_auto_increment;
+    memory_increment = dma_src_address_is_auto_increment;
+    periph_width     = dma_dst_data_width;
+    memory_width     = dma_src_data_width;
+  }
+
+  uint32_t configuration = s_pt_dma_direction[dma_direction] | s_pt_dma_mode[dma_mode] | s_pt_dma_priority[dma_priority];
+  configuration         |= (periph_increment ? LL_DMA_PERIPH_INCREMENT : LL_DMA_PERIPH_NOINCREMENT) | (memory_increment ? LL_DMA_MEMORY_INCREMENT : LL_DMA_MEMORY_NOINCREMENT);
+  configuration         |= ((uint32_t)periph_width << DMA_SxCR_PSIZE_Pos) | ((uint32_t)memory_width << DMA_SxCR_MSIZE_Pos);
+
+  LL_DMA_ConfigTransfer(dma_channel_ptr->pt_dma_ptr, dma_channel_ptr->pt_dma_stream_number, configuration);
+
+  /* 内存到内存及两侧宽度不同时必须经过FIFO */
+  if (DMA_DIRE_MEM_TO_MEM == dma_direction || periph_width != memory_width)
+  {
+    LL_DMA_SetFIFOThreshold(dma_channel_ptr->pt_dma_ptr, dma_channel_ptr->pt_dma_stream_number, LL_DMA_FIFOTHRESHOLD_FULL);
+    LL_DMA_EnableFifoMode(dma_channel_ptr->pt_dma_ptr, dma_channel_ptr->pt_dma_stream_number);
+  }
+  else
+  {
+    LL_DMA_DisableFifoMode(dma_channel_ptr->pt_dma_ptr, dma_channel_ptr->pt_dma_stream_number);
+  }
+
+  if (DMA_DIRE_MEM_TO_MEM == dma_direction)
+  {
+    LL_DMA_SetPeriphRequest(dma_channel_ptr->pt_dma_ptr, dma_channel_ptr->pt_dma_stream_number, LL_DMAMUX1_REQ_MEM2MEM);
+  }
+
+  dma_channel_ptr->pt_dma_direction                     = dma_direction;
+  dma_channel_ptr->pt_dma_data_width                    = periph_width;
+  dma_channel_ptr->pt_dma_mode                          = dma_mode;
+  dma_channel_ptr->pt_dma_priority                      = dma_priority;
+  dma_channel_ptr->pt_dma_src_address_is_auto_increment = dma_src_address_is_auto_increment;
+  dma_channel_ptr->pt_dma_dst_address_is_auto_increment = dma_dst_address_is_auto_increment;
+  dma_channel_ptr->pt_dma_is_double_buffer_mode         = 0;
+  dma_channel_ptr->pt_dma_memory_size                   = 0;
+  dma_channel_ptr->pt_dma_transferred_length            = 0;
+
+#ifdef PT_DMA_ENABLE_PERORMANCE_INFO
+
+  dma_channel_ptr->pt_dma_total_transfer_count  = 0;
+  dma_channel_ptr->pt_dma_total_transfer_size   = 0;
+  dma_channel_ptr->pt_dma_total_transfer_cycles = 0;
+
+#endif
+
+}
+
+uint32_t __pt_dma_creat(PT_DMA* dma_channel_ptr, pt_dma_direction_e dma_direction, pt_dma_mode_e dma_mode, uint8_t dma_src_address_is_auto_increment, uint8_t dma_dst_address_is_auto_increment, pt_dma_data_width_e dma_src_data_width, pt_dma_data_width_e dma_dst_data_width, pt_dma_priority_e dma_priority)
+{
+  uint32_t ret   = PT_SUCCEED;
+  uint32_t index = 0;
+
+  /* 已创建的句柄重新创建时沿用原数据流，中断转发关系保持不变；
+     是否已创建以所有者表为准，未初始化或拷贝得到的句柄会分配新的数据流 */
+  if (0U == pt_dma_is_owned(dma_channel_ptr))
+  {
+    ret = __pt_dma_channel_alloc(&index);
+
+    if (PT_SUCCEED == ret)
+    {
+      dma_channel_ptr->pt_dma_ptr           = pt_dma_controller(index);
+      dma_channel_ptr->pt_dma_stream_number = index % PT_DMA_STREAMS_PER_CONTROLLER;
+      g_pt_dma_channel_owner[index]         = dma_channel_ptr;
+    }
+  }
+
+  if (PT_SUCCEED == ret)
+  {
+    pt_dma_stream_disable(dma_channel_ptr);
+    pt_dma_channel_configure(dma_channel_ptr, dma_direction, dma_mode, dma_src_address_is_auto_increment, dma_dst_address_is_auto_increment, dma_src_data_width, dma_dst_data_width, dma_priority);
+
+    PT_DMA_TRACE("DMA channel %d created\n", (int)pt_dma_channel_index(dma_channel_ptr));
+  }
+
+  return ret;
+}
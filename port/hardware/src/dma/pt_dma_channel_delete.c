@@ -1,5 +1,19 @@
-#define PT_SOURCE_CODE
+#include "pt_dma_internal.h"
 
-#include "hardware/inc/pt_dma_api.h"
+uint32_t __pt_dma_delete(PT_DMA* dma_channel_ptr)
+{
+  uint32_t index = pt_dma_channel_index(dma_channel_ptr);
 
-uint32_t __pt_dma_delete(PT_DMA* dma_channel_ptr) {}
\ No newline at end of file
+  pt_dma_stream_disable(dma_channel_ptr);
+  __pt_dma_channel_free(index);
+
+  dma_channel_ptr->pt_dma_ptr                               = NULL;
+  dma_channel_ptr->pt_dma_stream_number                     = 0;
+  dma_channel_ptr->pt_dma_transferred_callback_function     = NULL;
+  dma_channel_ptr->pt_dma_memory_switched_callback_function = NULL;
+  dma_channel_ptr->pt_dma_error_callback_function           = NULL;
+
+  PT_DMA_TRACE("DMA channel %d deleted\n", (int)index);
+
+  return PT_SUCCEED;
+}
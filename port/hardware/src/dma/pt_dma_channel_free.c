@@ -0,0 +1,13 @@
+#include "pt_dma_internal.h"
+
+uint32_t __pt_dma_channel_free(uint32_t dma_channel_index)
+{
+  uint32_t primask                          = pt_dma_lock();
+  g_pt_dma_channel_owner[dma_channel_index]  = NULL;
+  g_pt_dma_channel_used_bitmap             &= (uint16_t)~(1U << dma_channel_index);
+  pt_dma_unlock(primask);
+
+  PT_DMA_TRACE("Channel %d released\n", (int)dma_channel_index);
+
+  return PT_SUCCEED;
+}
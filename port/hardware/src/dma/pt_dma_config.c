@@ -1,5 +1,39 @@
-#define PT_SOURCE_CODE
+#include "pt_dma_internal.h"
 
-#include "hardware/inc/pt_dma_api.h"
+uint32_t __pt_dma_config(PT_DMA* dma_channel_ptr, uint32_t dma_src_address, uint32_t dma_dst_address, uint32_t dma_memory_size, void (*dma_transferred_callback_function)(PT_DMA* pt_dma_handle, void* arg), void (*dma_error_callback_function)(PT_DMA* pt_dma_handle, void* arg), void* callback_arg)
+{
+  uint32_t            ret    = PT_DMA_BUSY;
+  DMA_Stream_TypeDef* stream = pt_dma_stream(dma_channel_ptr);
 
-uint32_t __pt_dma_config(PT_DMA* dma_channel_ptr, uint32_t dma_src_address, uint32_t dma_dst_address, uint32_t dma_memory_size, void (*dma_transferred_callback_function)(PT_DMA* pt_dma_handle, void* arg), void (*dma_error_callback_function)(PT_DMA* pt_dma_handle, void* arg), void* callback_arg) {}
\ No newline at end of file
+  if (0U == (stream->CR & DMA_SxCR_EN))
+  {
+    /* 外设侧地址寄存器存放源地址 (内存到外设时为目标地址) */
+    if (DMA_DIRE_MEM_TO_DEV == dma_channel_ptr->pt_dma_direction)
+    {
+      stream->PAR  = dma_dst_address;
+      stream->M0AR = dma_src_address;
+    }
+    else
+    {
+      stream->PAR  = dma_src_address;
+      stream->M0AR = dma_dst_address;
+    }
+
+    stream->CR   &= ~(DMA_SxCR_DBM | DMA_SxCR_CT);
+    stream->NDTR  = dma_memory_size >> pt_dma_item_shift(dma_channel_ptr);
+
+    dma_channel_ptr->pt_dma_is_double_buffer_mode             = 0;
+    dma_channel_ptr->pt_dma_memory0_address                   = stream->M0AR;
+    dma_channel_ptr->pt_dma_memory1_address                   = 0;
+    dma_channel_ptr->pt_dma_memory_size                       = dma_memory_size;
+    dma_channel_ptr->pt_dma_transferred_length                = 0;
+    dma_channel_ptr->pt_dma_callback_arg                      = callback_arg;
+    dma_channel_ptr->pt_dma_transferred_callback_function     = dma_transferred_callback_function;
+    dma_channel_ptr->pt_dma_memory_switched_callback_function = NULL;
+    dma_channel_ptr->pt_dma_error_callback_function           = dma_error_callback_function;
+
+    ret                                                       = PT_SUCCEED;
+  }
+
+  return ret;
+}
@@ -0,0 +1,118 @@
+#ifndef __PT_DMA_INTERNAL_H__
+#define __PT_DMA_INTERNAL_H__
+
+#define PT_SOURCE_CODE
+
+#include "hardware/inc/pt_dma_api.h"
+#include "stm32h7xx_ll_bus.h"
+#include "stm32h7xx_ll_dma.h"
+
+#define PT_DMA_STREAMS_PER_CONTROLLER (MAX_DMA_CHANNELS / 2)
+
+#define PT_DMA_FLAG_FE  (0x01U)
+#define PT_DMA_FLAG_DME (0x04U)
+#define PT_DMA_FLAG_TE  (0x08U)
+#define PT_DMA_FLAG_HT  (0x10U)
+#define PT_DMA_FLAG_TC  (0x20U)
+#define PT_DMA_FLAG_ALL (PT_DMA_FLAG_FE | PT_DMA_FLAG_DME | PT_DMA_FLAG_TE | PT_DMA_FLAG_HT | PT_DMA_FLAG_TC)
+
+/* 通道占用位图 (bit n 对应通道 n: 0~7 为 DMA1 数据流 0~7，8~15 为 DMA2 数据流 0~7) */
+extern volatile uint16_t g_pt_dma_channel_used_bitmap;
+
+/* 通道所有者表 (由创建时的句柄地址登记，释放时清除；判断句柄是否拥有通道只以此为准，不信任句柄内容) */
+extern PT_DMA* volatile g_pt_dma_channel_owner[MAX_DMA_CHANNELS];
+
+static inline uint32_t pt_dma_lock(void)
+{
+  uint32_t primask = __get_PRIMASK();
+  __disable_irq();
+  return primask;
+}
+
+static inline void pt_dma_unlock(uint32_t primask)
+{
+  __set_PRIMASK(primask);
+}
+
+static inline DMA_TypeDef* pt_dma_controller(uint32_t dma_channel_index)
+{
+  return (dma_channel_index < PT_DMA_STREAMS_PER_CONTROLLER) ? DMA1 : DMA2;
+}
+
+static inline uint32_t pt_dma_channel_index(const PT_DMA* dma_channel_ptr)
+{
+  return ((DMA2 == dma_channel_ptr->pt_dma_ptr) ? PT_DMA_STREAMS_PER_CONTROLLER : 0U) + dma_channel_ptr->pt_dma_stream_number;
+}
+
+static inline uint8_t pt_dma_is_owned(const PT_DMA* dma_channel_ptr)
+{
+  uint8_t ret = 0;
+
+  if ((DMA1 == dma_channel_ptr->pt_dma_ptr || DMA2 == dma_channel_ptr->pt_dma_ptr) && dma_channel_ptr->pt_dma_stream_number < PT_DMA_STREAMS_PER_CONTROLLER)
+  {
+    ret = (dma_channel_ptr == g_pt_dma_channel_owner[pt_dma_channel_index(dma_channel_ptr)]) ? 1U : 0U;
+  }
+
+  return ret;
+}
+
+static inline DMA_Stream_TypeDef* pt_dma_stream(const PT_DMA* dma_channel_ptr)
+{
+  return (DMA_Stream_TypeDef*)((uint32_t)dma_channel_ptr->pt_dma_ptr + LL_DMA_STR_OFFSET_TAB[dma_channel_ptr->pt_dma_stream_number]);
+}
+
+/* 数据流 0/4 的标志位于 LISR/HISR 的 bit0，1/5 位于 bit6，2/6 位于 bit16，3/7 位于 bit22 */
+static inline uint32_t pt_dma_flag_shift(uint32_t stream_number)
+{
+  static const uint8_t shift[4] = { 0U, 6U, 16U, 22U };
+  return shift[stream_number & 3U];
+}
+
+static inline uint32_t pt_dma_flags_get(const PT_DMA* dma_channel_ptr)
+{
+  uint32_t stream = dma_channel_ptr->pt_dma_stream_number;
+  uint32_t isr    = (stream < 4U) ? dma_channel_ptr->pt_dma_ptr->LISR : dma_channel_ptr->pt_dma_ptr->HISR;
+  return (isr >> pt_dma_flag_shift(stream)) & PT_DMA_FLAG_ALL;
+}
+
+static inline void pt_dma_flags_clear(const PT_DMA* dma_channel_ptr, uint32_t flags)
+{
+  uint32_t stream = dma_channel_ptr->pt_dma_stream_number;
+
+  if (stream < 4U)
+  {
+    dma_channel_ptr->pt_dma_ptr->LIFCR = flags << pt_dma_flag_shift(stream);
+  }
+  else
+  {
+    dma_channel_ptr->pt_dma_ptr->HIFCR = flags << pt_dma_flag_shift(stream);
+  }
+}
+
+/* 关闭数据流并等待总线上未完成的传输结束，随后清除全部标志 */
+static inline void pt_dma_stream_disable(const PT_DMA* dma_channel_ptr)
+{
+  DMA_Stream_TypeDef* stream = pt_dma_stream(dma_channel_ptr);
+
+  stream->CR &= ~(DMA_SxCR_TCIE | DMA_SxCR_TEIE | DMA_SxCR_DMEIE | DMA_SxCR_HTIE);
+  stream->CR &= ~DMA_SxCR_EN;
+
+  while (0U != (stream->CR & DMA_SxCR_EN))
+  {
+  }
+
+  pt_dma_flags_clear(dma_channel_ptr, PT_DMA_FLAG_ALL);
+}
+
+/* 数据流计数器以外设侧数据宽度为单位，传输字节数按该宽度换算 */
+static inline uint32_t pt_dma_item_shift(const PT_DMA* dma_channel_ptr)
+{
+  return (pt_dma_stream(dma_channel_ptr)->CR & DMA_SxCR_PSIZE) >> DMA_SxCR_PSIZE_Pos;
+}
+
+static inline uint32_t pt_dma_cycle_count(void)
+{
+  return DWT->CYCCNT;
+}
+
+#endif /* __PT_DMA_INTERNAL_H__ */
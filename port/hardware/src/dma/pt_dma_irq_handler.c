@@ -1,5 +1,49 @@
-#define PT_SOURCE_CODE
+#include "pt_dma_internal.h"
 
-#include "hardware/inc/pt_dma_api.h"
+void __pt_dma_irq_handler(PT_DMA* dma_channel_ptr)
+{
+  uint32_t flags = pt_dma_flags_get(dma_channel_ptr);
 
-void __pt_dma_irq_handler(PT_DMA* dma_channel_ptr) {}
\ No newline at end of file
+  /* 先清除标志再回调，回调内可直接重新配置、启动或删除本通道 */
+  pt_dma_flags_clear(dma_channel_ptr, flags);
+
+  if (0U != (flags & (PT_DMA_FLAG_TE | PT_DMA_FLAG_DME)))
+  {
+    /* 传输错误时硬件已自动关闭数据流 */
+    if (NULL != dma_channel_ptr->pt_dma_error_callback_function)
+    {
+      dma_channel_ptr->pt_dma_error_callback_function(dma_channel_ptr, dma_channel_ptr->pt_dma_callback_arg);
+    }
+  }
+  else if (0U != (flags & PT_DMA_FLAG_TC))
+  {
+    uint32_t size = dma_channel_ptr->pt_dma_memory_size;
+
+#ifdef PT_DMA_ENABLE_PERORMANCE_INFO
+
+    uint32_t now                                   = pt_dma_cycle_count();
+    dma_channel_ptr->pt_dma_total_transfer_count  += 1U;
+    dma_channel_ptr->pt_dma_total_transfer_size   += size;
+    dma_channel_ptr->pt_dma_total_transfer_cycles += now - dma_channel_ptr->pt_dma_start_cycle;
+    dma_channel_ptr->pt_dma_start_cycle            = now;
+
+#endif
+
+    if (0U != dma_channel_ptr->pt_dma_is_double_buffer_mode)
+    {
+      if (NULL != dma_channel_ptr->pt_dma_memory_switched_callback_function)
+      {
+        dma_channel_ptr->pt_dma_memory_switched_callback_function(dma_channel_ptr, dma_channel_ptr->pt_dma_callback_arg);
+      }
+    }
+    else
+    {
+      dma_channel_ptr->pt_dma_transferred_length = size;
+
+      if (NULL != dma_channel_ptr->pt_dma_transferred_callback_function)
+      {
+        dma_channel_ptr->pt_dma_transferred_callback_function(dma_channel_ptr, dma_channel_ptr->pt_dma_callback_arg);
+      }
+    }
+  }
+}
@@ -1,5 +1,16 @@
-#define PT_SOURCE_CODE
+#include "pt_dma_internal.h"
 
-#include "hardware/inc/pt_dma_api.h"
+uint32_t __pt_dma_memory_switch(PT_DMA* dma_channel_ptr)
+{
+  uint32_t            ret    = PT_DMA_BUSY;
+  DMA_Stream_TypeDef* stream = pt_dma_stream(dma_channel_ptr);
 
-uint32_t __pt_dma_memory_switch(PT_DMA* dma_channel_ptr) {}
+  /* 运行中由硬件在每轮结束时切换，仅允许在数据流关闭时指定下次启动的缓冲区 */
+  if (0U == (stream->CR & DMA_SxCR_EN))
+  {
+    stream->CR ^= DMA_SxCR_CT;
+    ret         = PT_SUCCEED;
+  }
+
+  return ret;
+}
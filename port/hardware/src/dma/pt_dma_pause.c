@@ -1,5 +1,32 @@
-#define PT_SOURCE_CODE
+#include "pt_dma_internal.h"
 
-#include "hardware/inc/pt_dma_api.h"
+uint32_t __pt_dma_pause(PT_DMA* dma_channel_ptr)
+{
+  DMA_Stream_TypeDef* stream = pt_dma_stream(dma_channel_ptr);
 
-uint32_t __pt_dma_pause(PT_DMA* dma_channel_ptr) {}
\ No newline at end of file
+  if (0U != (stream->CR & DMA_SxCR_EN))
+  {
+    /* 关闭数据流后计数器保留剩余数据项，但地址寄存器不随传输前移，需按已传输字节推进后再恢复 */
+    pt_dma_stream_disable(dma_channel_ptr);
+
+    if (DMA_MODE_NORMAL == dma_channel_ptr->pt_dma_mode && 0U == dma_channel_ptr->pt_dma_is_double_buffer_mode)
+    {
+      uint32_t transferred = dma_channel_ptr->pt_dma_memory_size - (stream->NDTR << pt_dma_item_shift(dma_channel_ptr));
+      uint32_t delta       = transferred - dma_channel_ptr->pt_dma_transferred_length;
+
+      if (0U != (stream->CR & DMA_SxCR_PINC))
+      {
+        stream->PAR += delta;
+      }
+
+      if (0U != (stream->CR & DMA_SxCR_MINC))
+      {
+        stream->M0AR += delta;
+      }
+
+      dma_channel_ptr->pt_dma_transferred_length = transferred;
+    }
+  }
+
+  return PT_SUCCEED;
+}
@@ -1,5 +1,29 @@
-#define PT_SOURCE_CODE
+#include "pt_dma_internal.h"
 
-#include "hardware/inc/pt_dma_api.h"
+uint32_t __pt_dma_performance_info_get(PT_DMA* dma_channel_ptr, uint32_t* dma_transferred_length, uint32_t* dma_transferred_time)
+{
+  uint32_t ret    = PT_DMA_ERROR;
+  uint32_t length = 0;
+  uint32_t time   = 0;
 
-uint32_t __pt_dma_performance_info_get(PT_DMA* dma_channel_ptr, uint32_t* dma_transferred_length, uint32_t* dma_transferred_time) {}
\ No newline at end of file
+#ifdef PT_DMA_ENABLE_PERORMANCE_INFO
+
+  /* 累计传输字节数及传输耗时 (us)，耗时由启动至完成中断的周期计数换算 */
+  uint32_t primask = pt_dma_lock();
+  length           = dma_channel_ptr->pt_dma_total_transfer_size;
+  time             = dma_channel_ptr->pt_dma_total_transfer_cycles / (SystemCoreClock / 1000000U);
+  pt_dma_unlock(primask);
+
+  ret              = PT_SUCCEED;
+
+#else
+
+  (void)dma_channel_ptr;
+
+#endif
+
+  *dma_transferred_length = length;
+  *dma_transferred_time   = time;
+
+  return ret;
+}
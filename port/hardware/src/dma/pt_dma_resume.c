@@ -1,5 +1,21 @@
-#define PT_SOURCE_CODE
+#include "pt_dma_internal.h"
 
-#include "hardware/inc/pt_dma_api.h"
+uint32_t __pt_dma_resume(PT_DMA* dma_channel_ptr)
+{
+  uint32_t            ret    = PT_DMA_BUSY;
+  DMA_Stream_TypeDef* stream = pt_dma_stream(dma_channel_ptr);
 
-uint32_t __pt_dma_resume(PT_DMA* dma_channel_ptr) {}
\ No newline at end of file
+  if (0U == (stream->CR & DMA_SxCR_EN))
+  {
+    ret = PT_SUCCEED;
+
+    /* 普通模式下已传输完毕则无需恢复 */
+    if (0U != stream->NDTR || DMA_MODE_NORMAL != dma_channel_ptr->pt_dma_mode)
+    {
+      stream->CR |= DMA_SxCR_TCIE | DMA_SxCR_TEIE | DMA_SxCR_DMEIE;
+      stream->CR |= DMA_SxCR_EN;
+    }
+  }
+
+  return ret;
+}
@@ -1,5 +1,27 @@
-#define PT_SOURCE_CODE
+#include "pt_dma_internal.h"
 
-#include "hardware/inc/pt_dma_api.h"
+uint32_t __pt_dma_start(PT_DMA* dma_channel_ptr)
+{
+  uint32_t            ret    = PT_DMA_BUSY;
+  DMA_Stream_TypeDef* stream = pt_dma_stream(dma_channel_ptr);
 
-uint32_t __pt_dma_start(PT_DMA* dma_channel_ptr) {}
\ No newline at end of file
+  if (0U == (stream->CR & DMA_SxCR_EN))
+  {
+    pt_dma_flags_clear(dma_channel_ptr, PT_DMA_FLAG_ALL);
+
+    dma_channel_ptr->pt_dma_transferred_length = 0;
+
+#ifdef PT_DMA_ENABLE_PERORMANCE_INFO
+
+    dma_channel_ptr->pt_dma_start_cycle = pt_dma_cycle_count();
+
+#endif
+
+    stream->CR |= DMA_SxCR_TCIE | DMA_SxCR_TEIE | DMA_SxCR_DMEIE;
+    stream->CR |= DMA_SxCR_EN;
+
+    ret         = PT_SUCCEED;
+  }
+
+  return ret;
+}
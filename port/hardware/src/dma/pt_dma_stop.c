@@ -1,5 +1,18 @@
-#define PT_SOURCE_CODE
+#include "pt_dma_internal.h"
 
-#include "hardware/inc/pt_dma_api.h"
+uint32_t __pt_dma_stop(PT_DMA* dma_channel_ptr)
+{
+  DMA_Stream_TypeDef* stream = pt_dma_stream(dma_channel_ptr);
 
-uint32_t __pt_dma_stop(PT_DMA* dma_channel_ptr) {}
\ No newline at end of file
+  if (0U != (stream->CR & DMA_SxCR_EN))
+  {
+    pt_dma_stream_disable(dma_channel_ptr);
+
+    if (0U == dma_channel_ptr->pt_dma_is_double_buffer_mode)
+    {
+      dma_channel_ptr->pt_dma_transferred_length = dma_channel_ptr->pt_dma_memory_size - (stream->NDTR << pt_dma_item_shift(dma_channel_ptr));
+    }
+  }
+
+  return PT_SUCCEED;
+}
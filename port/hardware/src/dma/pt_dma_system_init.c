@@ -1,9 +1,8 @@
-#define PT_SOURCE_CODE
+#include "pt_dma_internal.h"
 
-#include "hardware/inc/pt_dma_api.h"
-#include "stm32h7xx_ll_bus.h"
+volatile uint16_t g_pt_dma_channel_used_bitmap = 0;
 
-static uint8_t s_pt_dma_channel_used_bitmap[MAX_DMA_CHANNELS / 8];
+PT_DMA* volatile g_pt_dma_channel_owner[MAX_DMA_CHANNELS] = { 0 };
 
 uint32_t __pt_dma_system_init(void)
 {
@@ -12,8 +11,14 @@ uint32_t __pt_dma_system_init(void)
   LL_AHB1_GRP1_EnableClock(LL_AHB1_GRP1_PERIPH_DMA1);
   LL_AHB1_GRP1_EnableClock(LL_AHB1_GRP1_PERIPH_DMA2);
 
-  memset(s_pt_dma_channel_used_bitmap, 0, sizeof(s_pt_dma_channel_used_bitmap));
+#ifdef PT_DMA_ENABLE_PERORMANCE_INFO
 
+  CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+  DWT->CTRL        |= DWT_CTRL_CYCCNTENA_Msk;
+
+#endif
+
+  /* 位图为静态零初始化，此处不清除，以免释放已被其他模块占用的通道 */
   PT_DMA_TRACE("DMA system initialized with %d channels\n", MAX_DMA_CHANNELS);
 
   return PT_SUCCEED;
@@ -1,5 +1,17 @@
-#define PT_SOURCE_CODE
+#include "pt_dma_internal.h"
 
-#include "hardware/inc/pt_dma_api.h"
+uint32_t __pt_dma_transferred_length_get(PT_DMA* dma_channel_ptr, uint32_t* dma_transferred_length)
+{
+  DMA_Stream_TypeDef* stream = pt_dma_stream(dma_channel_ptr);
 
-uint32_t __pt_dma_transferred_length_get(PT_DMA* dma_channel_ptr, uint32_t* dma_transferred_length) {}
\ No newline at end of file
+  if (0U != (stream->CR & DMA_SxCR_EN) && 0U == dma_channel_ptr->pt_dma_is_double_buffer_mode)
+  {
+    *dma_transferred_length = dma_channel_ptr->pt_dma_memory_size - (stream->NDTR << pt_dma_item_shift(dma_channel_ptr));
+  }
+  else
+  {
+    *dma_transferred_length = dma_channel_ptr->pt_dma_transferred_length;
+  }
+
+  return PT_SUCCEED;
+}
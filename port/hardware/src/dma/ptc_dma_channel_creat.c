@@ -1,5 +1,17 @@
-#define PT_SOURCE_CODE
+#include "pt_dma_internal.h"
 
-#include "hardware/inc/pt_dma_api.h"
+uint32_t __ptc_dma_creat(PT_DMA* dma_channel_ptr, pt_dma_direction_e dma_direction, pt_dma_mode_e dma_mode, uint8_t dma_src_address_is_auto_increment, uint8_t dma_dst_address_is_auto_increment, pt_dma_data_width_e dma_src_data_width, pt_dma_data_width_e dma_dst_data_width, pt_dma_priority_e dma_priority)
+{
+  uint32_t ret = PT_DMA_INVALID_ARG;
 
-uint32_t __ptc_dma_creat(PT_DMA* dma_channel_ptr, pt_dma_direction_e dma_direction, pt_dma_mode_e dma_mode, uint8_t dma_src_address_is_auto_increment, uint8_t dma_dst_address_is_auto_increment, pt_dma_data_width_e dma_src_data_width, pt_dma_data_width_e dma_dst_data_width, pt_dma_priority_e dma_priority) {}
\ No newline at end of file
+  /* 数据流不支持外设到外设；内存到内存不支持循环与外设流控 */
+  if (NULL != dma_channel_ptr && dma_direction <= DMA_DIRE_DEV_TO_MEM && dma_mode <= DMA_MODE_PFCTRL && dma_src_data_width <= DMA_DATA_WIDTH_WORD && dma_dst_data_width <= DMA_DATA_WIDTH_WORD && dma_priority <= DMA_PRIO_VERY_HIGH)
+  {
+    if (DMA_DIRE_MEM_TO_MEM != dma_direction || DMA_MODE_NORMAL == dma_mode)
+    {
+      ret = __pt_dma_creat(dma_channel_ptr, dma_direction, dma_mode, dma_src_address_is_auto_increment, dma_dst_address_is_auto_increment, dma_src_data_width, dma_dst_data_width, dma_priority);
+    }
+  }
+
+  return ret;
+}
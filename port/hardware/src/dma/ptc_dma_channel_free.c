@@ -0,0 +1,13 @@
+#include "pt_dma_internal.h"
+
+uint32_t __ptc_dma_channel_free(uint32_t dma_channel_index)
+{
+  uint32_t ret = PT_DMA_INVALID_ARG;
+
+  if (dma_channel_index < MAX_DMA_CHANNELS && 0U != (g_pt_dma_channel_used_bitmap & (1U << dma_channel_index)))
+  {
+    ret = __pt_dma_channel_free(dma_channel_index);
+  }
+
+  return ret;
+}
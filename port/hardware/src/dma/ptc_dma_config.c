@@ -1,5 +1,19 @@
-#define PT_SOURCE_CODE
+#include "pt_dma_internal.h"
 
-#include "hardware/inc/pt_dma_api.h"
+uint32_t __ptc_dma_config(PT_DMA* dma_channel_ptr, uint32_t dma_src_address, uint32_t dma_dst_address, uint32_t dma_memory_size, void (*dma_transferred_callback_function)(PT_DMA* pt_dma_handle, void* arg), void (*dma_error_callback_function)(PT_DMA* pt_dma_handle, void* arg), void* callback_arg)
+{
+  uint32_t ret = PT_DMA_INVALID_ARG;
 
-uint32_t __ptc_dma_config(PT_DMA* dma_channel_ptr, uint32_t dma_src_address, uint32_t dma_dst_address, uint32_t dma_memory_size, void (*dma_transferred_callback_function)(PT_DMA* pt_dma_handle, void* arg), void (*dma_error_callback_function)(PT_DMA* pt_dma_handle, void* arg), void* callback_arg) {}
\ No newline at end of file
+  if (NULL != dma_channel_ptr && pt_dma_is_owned(dma_channel_ptr) && 0U != dma_src_address && 0U != dma_dst_address && 0U != dma_memory_size)
+  {
+    uint32_t shift = pt_dma_item_shift(dma_channel_ptr);
+
+    /* 长度须为外设侧数据宽度的整数倍，且数据项数不超过16位计数器 */
+    if (0U == (dma_memory_size & ((1U << shift) - 1U)) && (dma_memory_size >> shift) <= 0xFFFFU)
+    {
+      ret = __pt_dma_config(dma_channel_ptr, dma_src_address, dma_dst_address, dma_memory_size, dma_transferred_callback_function, dma_error_callback_function, callback_arg);
+    }
+  }
+
+  return ret;
+}
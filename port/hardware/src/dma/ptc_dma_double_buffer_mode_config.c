@@ -1,5 +1,19 @@
-#define PT_SOURCE_CODE
+#include "pt_dma_internal.h"
 
-#include "hardware/inc/pt_dma_api.h"
+uint32_t __ptc_dma_double_buffer_mode_config(PT_DMA* dma_channel_ptr, uint32_t dma_memory0_address, uint32_t dma_memory1_address, uint32_t dma_memory_size, void (*dma_memory_switched_callback_function)(PT_DMA* pt_dma_handle, void* arg), void (*dma_error_callback_function)(PT_DMA* pt_dma_handle, void* arg), void* callback_arg)
+{
+  uint32_t ret = PT_DMA_INVALID_ARG;
 
-uint32_t __ptc_dma_double_buffer_mode_config(PT_DMA* dma_channel_ptr, uint32_t dma_memory0_address, uint32_t dma_memory1_address, uint32_t dma_memory_size, void (*dma_memory_switched_callback_function)(PT_DMA* pt_dma_handle, void* arg), void (*dma_error_callback_function)(PT_DMA* pt_dma_handle, void* arg), void* callback_arg) {}
\ No newline at end of file
+  /* 双缓冲仅用于外设与内存之间 */
+  if (NULL != dma_channel_ptr && pt_dma_is_owned(dma_channel_ptr) && DMA_DIRE_MEM_TO_MEM != dma_channel_ptr->pt_dma_direction && 0U != dma_memory0_address && 0U != dma_memory1_address && 0U != dma_memory_size)
+  {
+    uint32_t shift = pt_dma_item_shift(dma_channel_ptr);
+
+    if (0U == (dma_memory_size & ((1U << shift) - 1U)) && (dma_memory_size >> shift) <= 0xFFFFU)
+    {
+      ret = __pt_dma_double_buffer_mode_config(dma_channel_ptr, dma_memory0_address, dma_memory1_address, dma_memory_size, dma_memory_switched_callback_function, dma_error_callback_function, callback_arg);
+    }
+  }
+
+  return ret;
+}
@@ -1,5 +1,13 @@
-#define PT_SOURCE_CODE
+#include "pt_dma_internal.h"
 
-#include "hardware/inc/pt_dma_api.h"
+uint32_t __ptc_dma_memory_switch(PT_DMA* dma_channel_ptr)
+{
+  uint32_t ret = PT_DMA_INVALID_ARG;
 
-uint32_t __ptc_dma_memory_switch(PT_DMA* dma_channel_ptr) {}
\ No newline at end of file
+  if (NULL != dma_channel_ptr && pt_dma_is_owned(dma_channel_ptr) && 0U != dma_channel_ptr->pt_dma_is_double_buffer_mode)
+  {
+    ret = __pt_dma_memory_switch(dma_channel_ptr);
+  }
+
+  return ret;
+}